@@ -0,0 +1,27 @@
+/**
+ * r3d -- host benchmarks (make bench)
+ * author: Andreas Mantler (ands)
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+// include first: clock_gettime needs POSIX in -std=c99
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+
+// host timings only compare variants relative to each other, the target
+// has neither caches nor the host's SIMD units
+static inline double bench_seconds(void)
+{
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+// results of the measured loops end up here, so they are not optimized away
+static volatile uint32_t bench_sink;
+
+#endif
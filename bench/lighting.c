@@ -0,0 +1,108 @@
+/**
+ * r3d -- lighting benchmark: nanoseconds per specular term, evaluated
+ * with powf, with the inline squaring of the original fragment shader
+ * and with the r3d_specular lookup table. like on the target, one term
+ * at a time (built with -fno-tree-vectorize): independent terms
+ * (throughput) and a dependent chain in which the result of one term
+ * selects the n.h of the next (latency).
+ */
+
+#include "bench.h"
+#include <stdlib.h>
+#include <math.h>
+#include <r3d_lighting.h>
+
+#define COUNT 4096
+#define ROUNDS 2000
+#define BATCHES 10
+
+static float ndoth[COUNT];
+static r3d_specular_lut_t lut;
+static volatile float power = 64.0f; // not folded into multiplies
+
+static inline int specular_powf(float s, float p)
+{
+	return (int)(0.6f * powf(s, p) * 255.0f + 0.5f);
+}
+
+static inline int specular_squared(float s, float p) // n.h squared six times
+{
+	s *= s; s *= s; s *= s; s *= s; s *= s; s *= s;
+	return (int)(0.6f * s * 255.0f + 0.5f);
+}
+
+static inline int specular_lut(float s, float p)
+{
+	return r3d_specular(&lut, s);
+}
+
+// throughput and latency loops of one variant
+#define SPECULAR_BENCH(name) \
+static uint32_t name##_throughput(void) \
+{ \
+	uint32_t sum = 0; \
+	float p = power; \
+	for (int i = 0; i < COUNT; i++) \
+		sum += name(ndoth[i], p); \
+	return sum; \
+} \
+static uint32_t name##_latency(void) \
+{ \
+	uint32_t r = 0; \
+	float p = power; \
+	for (int i = 0; i < COUNT; i++) \
+		r = name(ndoth[(i + r) & (COUNT - 1)], p); \
+	return r; \
+}
+
+SPECULAR_BENCH(specular_powf)
+SPECULAR_BENCH(specular_squared)
+SPECULAR_BENCH(specular_lut)
+
+// fastest of BATCHES batches: the host is noisy, the minimum repeats
+static double bench_ns(uint32_t (*f)(void))
+{
+	double best = 1e9;
+	bench_sink += f(); // warm up
+	for (int b = 0; b < BATCHES; b++) {
+		double t = bench_seconds();
+		for (int i = 0; i < ROUNDS / BATCHES; i++)
+			bench_sink += f();
+		double ns = (bench_seconds() - t) * 1e9 / ((double)(ROUNDS / BATCHES) * COUNT);
+		best = ns < best ? ns : best;
+	}
+	return best;
+}
+
+int main(void)
+{
+	static const struct {
+		const char *name;
+		uint32_t (*throughput)(void), (*latency)(void);
+	} variants[] = {
+		{ "powf", specular_powf_throughput, specular_powf_latency },
+		{ "squared", specular_squared_throughput, specular_squared_latency },
+		{ "lut", specular_lut_throughput, specular_lut_latency }
+	};
+
+	srand(1);
+	for (int i = 0; i < COUNT; i++) // n.h of visible fragments
+		ndoth[i] = (float)rand() / (float)RAND_MAX;
+	r3d_specular_lut(&lut, 64, 0.6f);
+
+	// largest difference to powf of the table, in 8 bit intensities
+	int maxdiff = 0;
+	for (int i = 0; i < COUNT; i++) {
+		int d = r3d_specular(&lut, ndoth[i]) - (int)(0.6f * powf(ndoth[i], 64.0f) * 255.0f + 0.5f);
+		maxdiff = int_max(maxdiff, int_abs(d));
+	}
+
+	printf("         throughput  latency\n");
+	for (int i = 0; i < (int)(sizeof(variants) / sizeof(variants[0])); i++) {
+		double throughput = bench_ns(variants[i].throughput);
+		double latency = bench_ns(variants[i].latency);
+		printf("%-8s %7.2f ns %7.2f ns\n", variants[i].name, throughput, latency);
+	}
+	printf("lut: at most %d off powf (of 255)\n", maxdiff);
+	return 0;
+}
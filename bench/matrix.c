@@ -0,0 +1,132 @@
+/**
+ * r3d -- matrix benchmark: the per frame matrix setup and the per vertex
+ * normal transform of main.c with mat4_t by value (before mat34_t) and
+ * with the affine mat34_t pointer API, and the position transform one
+ * vertex at a time and in vec3x4_t batches (mat4_transform_positions_n)
+ */
+
+#include "bench.h"
+#include <r3d.h>
+
+#define FRAMES 200000
+#define VERTICES 4096
+#define ROUNDS 2000
+#define BATCHES 10
+
+static const vec3_t scale = { { { 1.0f / 65535.0f, 1.0f / 65535.0f, 1.0f / 65535.0f } } };
+static const vec3_t bias = { { { -0.5f, -0.5f, -0.5f } } };
+static mat4_t projection, view4;
+static mat34_t view34;
+static vec3_t normals[VERTICES], out[VERTICES];
+static vec3x4_t positions4[VERTICES / 4], out4[VERTICES / 4];
+static mat4_t mv4, positions_mvp;
+static mat34_t mv34;
+
+static float frame_mat4(float ax, float ay)
+{
+	mat4_t model = mat4_mul(mat4_rotation(ax, vec3(1.0f, 0.0f, 0.0f)), mat4_rotation(ay, vec3(0.0f, 1.0f, 0.0f)));
+	mat4_t mv = mat4_mul(view4, model);
+	mat4_t mvp = mat4_mul(projection, mv);
+	mat4_t mvi = mat4_invert(mv);
+	vec3_t eye = mat4_transform_position(&mvi, vec3(0.0f, 0.0f, 0.0f));
+	mat4_t mvp_q = mat4_mul(mat4_mul(mvp, mat4_translation(bias)), mat4_scaling(scale));
+	mv4 = mv;
+	return eye.x + mvp_q.m33;
+}
+
+static float frame_mat34(float ax, float ay)
+{
+	mat34_t model, rotation, mv, mvi;
+	mat34_rotation(&model, ax, vec3(1.0f, 0.0f, 0.0f));
+	mat34_rotation(&rotation, ay, vec3(0.0f, 1.0f, 0.0f));
+	mat34_mul(&model, &model, &rotation);
+	mat34_mul(&mv, &view34, &model);
+	mat4_t mvp_q;
+	mat4_mul_mat34(&mvp_q, &projection, &mv);
+	mat34_invert(&mvi, &mv);
+	r3d_dequantization_matrix(&mvp_q, scale, bias);
+	mv34 = mv;
+	positions_mvp = mvp_q;
+	return mvi.c[3].x + mvp_q.m33;
+}
+
+static void normals_mat4(void)
+{
+	for (int i = 0; i < VERTICES; i++)
+		out[i] = mat4_transform_vector(&mv4, normals[i]);
+}
+
+static void normals_mat34(void)
+{
+	for (int i = 0; i < VERTICES; i++)
+		out[i] = mat34_transform_vector(&mv34, normals[i]);
+}
+
+static void positions_mat4(void)
+{
+	for (int i = 0; i < VERTICES; i++) {
+		const vec3x4_t *p = &positions4[i / 4];
+		out[i] = mat4_transform_position(&positions_mvp, vec3(p->x[i % 4], p->y[i % 4], p->z[i % 4]));
+	}
+}
+
+static void positions_n(void)
+{
+	mat4_transform_positions_n(&positions_mvp, positions4, out4, VERTICES);
+	out[0].x = out4[0].x[0];
+}
+
+// the fastest of BATCHES batches: less scheduler noise
+static double bench_frame_ns(float (*f)(float, float))
+{
+	double best = 1e30;
+	for (int batch = 0; batch < BATCHES; batch++) {
+		double t = bench_seconds();
+		float sum = 0.0f;
+		for (int i = 0; i < FRAMES / BATCHES; i++)
+			sum += f((float)(i % 180), (float)(i % 360));
+		bench_sink += (uint32_t)sum;
+		t = bench_seconds() - t;
+		best = t < best ? t : best;
+	}
+	return best * 1e9 / (FRAMES / BATCHES);
+}
+
+static double bench_vertex_ns(void (*f)(void))
+{
+	double best = 1e30;
+	for (int batch = 0; batch < BATCHES; batch++) {
+		double t = bench_seconds();
+		for (int i = 0; i < ROUNDS / BATCHES; i++) {
+			f();
+			bench_sink += (uint32_t)out[i % VERTICES].x;
+		}
+		t = bench_seconds() - t;
+		best = t < best ? t : best;
+	}
+	return best * 1e9 / ((double)(ROUNDS / BATCHES) * VERTICES);
+}
+
+int main(void)
+{
+	projection = mat4_perspective(60.0f, 240.0f / 320.0f, 0.5f, 5.0f);
+	view4 = mat4_lookat(vec3(0.0f, 0.25f, 1.5f), vec3(0.0f, 0.0f, 0.0f), vec3(0.0f, 1.0f, 0.0f));
+	mat34_from_mat4(&view34, &view4);
+	for (int i = 0; i < VERTICES; i++)
+		normals[i] = r3d_dequantize_normal(i * 7, i * 13, i * 31);
+	for (int i = 0; i < VERTICES; i++) { // quantized positions: the normals scaled up
+		positions4[i / 4].x[i % 4] = normals[i].x * 32767.0f + 32768.0f;
+		positions4[i / 4].y[i % 4] = normals[i].y * 32767.0f + 32768.0f;
+		positions4[i / 4].z[i % 4] = normals[i].z * 32767.0f + 32768.0f;
+	}
+	frame_mat4(30.0f, 20.0f);
+	frame_mat34(30.0f, 20.0f);
+
+	double f4 = bench_frame_ns(frame_mat4), f34 = bench_frame_ns(frame_mat34);
+	double v4 = bench_vertex_ns(normals_mat4), v34 = bench_vertex_ns(normals_mat34);
+	printf("frame setup      mat4 %7.2f ns  mat34 %7.2f ns (%5.2fx)\n", f4, f34, f34 / f4);
+	printf("normal transform mat4 %7.2f ns  mat34 %7.2f ns (%5.2fx)\n", v4, v34, v34 / v4);
+	double p1 = bench_vertex_ns(positions_mat4), pn = bench_vertex_ns(positions_n);
+	printf("position transform   %7.2f ns  batch %7.2f ns (%5.2fx)\n", p1, pn, pn / p1);
+	return 0;
+}
@@ -0,0 +1,125 @@
+/**
+ * r3d -- mipmap benchmark: the textured box of main.c (128x128 BC1) at
+ * several camera distances, sampled with r3d_mipmap_select and from level
+ * 0 only. milliseconds per frame on the host and the distinct 4x4 blocks
+ * (8 bytes) fetched per frame, which is what the target reads from flash
+ * or SDRAM.
+ */
+
+#include "bench.h"
+#include <stddef.h>
+#include <string.h>
+#include "scene.h"
+#include "box_texture_mips.h"
+
+#define BOX 1 // scene mesh
+#define FRAMES 20
+#define BATCHES 10
+
+typedef struct {
+	vec3_t position;
+	vec2_t uv;
+} mipmap_vs_to_fs_t;
+
+static r3d_mipmap_sampler_t sampler;
+static int mipmapped;
+static uint8_t fetched[R3D_MIPMAP_LEVELS_MAX][32 * 32]; // 4x4 blocks of a level up to 128x128
+static uint32_t fetched_blocks, fetched_levels, fragments;
+
+static void mipmap_attributes(const void *uniforms, const void *const *in, mipmap_vs_to_fs_t *out)
+{
+	const vertex_attributes_t *a = in[1];
+	out->uv = vec2_mul(vec2(a->u, a->v), R3D_UV_ONE / 255.0f);
+}
+
+static inline const r3d_sampler_t *mipmap_level(void)
+{
+	return mipmapped ? r3d_mipmap_select(&sampler) : &sampler.level[0];
+}
+
+static uint16_t mipmap_fragment(const void *uniforms, const mipmap_vs_to_fs_t *in)
+{
+	return r3d_sample_repeat(mipmap_level(), (int32_t)in->uv.x, (int32_t)in->uv.y);
+}
+
+// marks the block of the texel which mipmap_fragment reads
+static uint16_t mipmap_fragment_count(const void *uniforms, const mipmap_vs_to_fs_t *in)
+{
+	const r3d_sampler_t *s = mipmap_level();
+	uint32_t ui = ((int32_t)in->uv.x >> s->ushift) & s->umask;
+	uint32_t vi = ((int32_t)in->uv.y >> s->vshift) & s->vmask;
+	uint8_t *block = &fetched[s - sampler.level][((vi >> 2) << (s->log2width - 2)) | (ui >> 2)];
+	fetched_blocks += !*block;
+	fetched_levels += (uint32_t)(s - sampler.level);
+	fragments++;
+	*block = 1;
+	return 0;
+}
+
+static const r3d_shader_t mipmap_shader = {
+	0,
+	0,
+	sizeof(mipmap_vs_to_fs_t) / sizeof(float),
+	(r3d_vertexshader_func)scene_position,
+	(r3d_vertexshader_func)mipmap_attributes,
+	R3D_VARYINGS(3, 2),
+	0,
+	&scene_uniforms,
+	0,
+	(r3d_fragmentshader565_func)mipmap_fragment,
+	offsetof(mipmap_vs_to_fs_t, uv) / sizeof(float)
+};
+
+static void frame(void)
+{
+	for (int view = 0; view < SCENE_VIEWS; view++)
+		scene_render(BOX, view);
+}
+
+static double bench_ms(void)
+{
+	double best = 1e30;
+	scene_render_shader = &mipmap_shader;
+	frame(); // warm up
+	for (int batch = 0; batch < BATCHES; batch++) { // the fastest batch: less scheduler noise
+		double t = bench_seconds();
+		for (int i = 0; i < FRAMES; i++)
+			frame();
+		t = bench_seconds() - t;
+		best = t < best ? t : best;
+	}
+	bench_sink += r3dfb_color_buffer[R3DFB_PIXEL_WIDTH * R3DFB_PIXEL_HEIGHT / 2];
+	return best * 1e3 / ((double)FRAMES * SCENE_VIEWS);
+}
+
+int main(void)
+{
+	static const float distances[] = { 1.5f, 3.0f, 6.0f, 12.0f };
+	r3d_shader_t count_shader = mipmap_shader;
+	count_shader.fragmentshader565 = (r3d_fragmentshader565_func)mipmap_fragment_count;
+
+	r3dfb_init();
+	r3d_mipmap_sampler(&sampler, (const r3d_mipmap_t *)&box_texture_mips);
+	printf("%-8s %8s %-9s %10s %8s %10s\n", "distance", "pixels", "levels", "ms", "blocks", "mean level");
+	for (int i = 0; i < (int)(sizeof(distances) / sizeof(distances[0])); i++) {
+		scene_distance = distances[i];
+		for (mipmapped = 0; mipmapped < 2; mipmapped++) {
+			uint32_t pixels = 0, blocks = 0;
+			fetched_levels = fragments = 0;
+			for (int view = 0; view < SCENE_VIEWS; view++) {
+				memset(fetched, 0, sizeof(fetched));
+				fetched_blocks = 0;
+				scene_render_shader = &count_shader;
+				scene_render(BOX, view);
+				for (int j = 0; j < R3DFB_PIXEL_WIDTH * R3DFB_PIXEL_HEIGHT; j++)
+					pixels += r3dfb_depth_buffer[j] != 0;
+				blocks += fetched_blocks;
+			}
+			double ms = bench_ms();
+			printf("%8.1f %8u %-9s %7.3f ms %8u %10.2f\n", distances[i], pixels / SCENE_VIEWS,
+			       mipmapped ? "selected" : "0 only", ms, blocks / SCENE_VIEWS,
+			       fragments ? (double)fetched_levels / fragments : 0.0);
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,134 @@
+/**
+ * r3d -- rasterizer benchmark: milliseconds per frame with the scalar,
+ * pixel pair and 8 pixel (x86 hosts) triangle loops, for the example
+ * meshes and for large random triangles of a constant color. also built
+ * as bench/rasterizer1080 with a 1920x1080 host framebuffer
+ */
+
+#include "bench.h"
+#include <stdlib.h>
+#include "scene.h"
+
+#ifndef FRAMES // per batch
+#define FRAMES 4
+#endif
+#ifndef BATCHES
+#define BATCHES 21
+#endif
+#define LARGE 100
+
+typedef struct {
+	float x, y, z;
+} large_vertex_t;
+
+static large_vertex_t large_vertices[3 * LARGE];
+
+static void large_position(const void *uniforms, const void *const *in, float *out)
+{
+	const large_vertex_t *v = in[0];
+	out[0] = v->x;
+	out[1] = v->y;
+	out[2] = v->z;
+}
+
+static void large_attributes(const void *uniforms, const void *const *in, float *out)
+{
+}
+
+static uint16_t large_fragment(const void *uniforms, const float *in)
+{
+	return 0xffff;
+}
+
+static float frand(float min, float max)
+{
+	return min + (max - min) * (float)rand() / (float)RAND_MAX;
+}
+
+static void frame_scene(void)
+{
+	for (int mesh = 0; mesh < SCENE_MESHES; mesh++)
+		for (int view = 0; view < SCENE_VIEWS; view++)
+			scene_render(mesh, view);
+}
+
+static void frame_large(void)
+{
+	static const r3d_shader_t shader = {
+		0, 0, 3, large_position, large_attributes, R3D_VARYINGS(0, 0), 0, 0, 0, large_fragment, 0
+	};
+	r3d_drawcall_t drawcall = {
+		R3D_PRIMITIVE_TYPE_TRIANGLES, { { large_vertices, sizeof(large_vertex_t) } }, 3 * LARGE, 0, 0
+	};
+	r3d_shader = shader;
+	r3d_viewport(0, 0, R3DFB_PIXEL_WIDTH, R3DFB_PIXEL_HEIGHT);
+	r3d_backface_culling = R3D_DISABLE;
+	r3dfb_clear();
+	r3d_draw(&drawcall);
+}
+
+static const struct {
+	const char *name;
+	r3d_rasterizer_loop_t loop;
+} loops[] = {
+	{ "scalar", R3D_RASTERIZER_LOOP_SCALAR },
+	{ "pairs", R3D_RASTERIZER_LOOP_PAIRS },
+	{ "wide", R3D_RASTERIZER_LOOP_WIDE },
+	{ "auto", R3D_RASTERIZER_LOOP_AUTO }
+};
+#define LOOPS ((int)(sizeof(loops) / sizeof(loops[0])))
+
+static double batch_ms(void (*frame)(void), r3d_rasterizer_loop_t loop, int frames_per_call)
+{
+	r3d_rasterizer_loop = loop;
+	double t = bench_seconds();
+	for (int i = 0; i < FRAMES; i++)
+		frame();
+	t = bench_seconds() - t;
+	bench_sink += r3dfb_color_buffer[R3DFB_PIXEL_WIDTH * R3DFB_PIXEL_HEIGHT / 2];
+	return t * 1e3 / ((double)FRAMES * frames_per_call);
+}
+
+static int compare_ms(const void *a, const void *b)
+{
+	double d = *(const double *)a - *(const double *)b;
+	return (d > 0.0) - (d < 0.0);
+}
+
+// the loops take turns within each batch, so that they see the same host
+// load; median and fastest of BATCHES batches per loop
+static void bench(const char *name, void (*frame)(void), int frames_per_call)
+{
+	static double ms[LOOPS][BATCHES];
+	for (int i = 0; i < LOOPS; i++) { // warm up
+		r3d_rasterizer_loop = loops[i].loop;
+		frame();
+	}
+	for (int batch = 0; batch < BATCHES; batch++)
+		for (int i = 0; i < LOOPS; i++)
+			ms[i][batch] = batch_ms(frame, loops[i].loop, frames_per_call);
+	printf("%s (%dx%d, %d batches of %d frames)\n", name, R3DFB_PIXEL_WIDTH, R3DFB_PIXEL_HEIGHT, BATCHES, FRAMES);
+	double base = 0.0;
+	for (int i = 0; i < LOOPS; i++) {
+		qsort(ms[i], BATCHES, sizeof(double), compare_ms);
+		double median = ms[i][BATCHES / 2];
+		if (i == 0)
+			base = median;
+		printf("  %-8s median %8.3f ms (%5.2fx)  fastest %8.3f ms\n", loops[i].name, median, base / median, ms[i][0]);
+	}
+}
+
+int main(void)
+{
+	srand(1);
+	for (int i = 0; i < 3 * LARGE; i++) {
+		large_vertices[i].x = frand(-1.5f, 1.5f);
+		large_vertices[i].y = frand(-1.5f, 1.5f);
+		large_vertices[i].z = frand(-1.0f, 1.0f);
+	}
+
+	r3dfb_init();
+	bench("meshes", frame_scene, SCENE_MESHES * SCENE_VIEWS);
+	bench("large triangles", frame_large, 1);
+	return 0;
+}
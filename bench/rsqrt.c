@@ -0,0 +1,51 @@
+/**
+ * r3d -- reciprocal square root benchmark: nanoseconds per normalize with
+ * 1 / sqrtf and with float_rsqrt_fast
+ */
+
+#include "bench.h"
+#include <stdlib.h>
+#include <r3d_math.h>
+
+#define COUNT 4096
+#define ROUNDS 2000
+
+static vec3_t v[COUNT], n[COUNT];
+
+static void normalize_precise(void)
+{
+	for (int i = 0; i < COUNT; i++) {
+		float fi = 1.0f / sqrtf(vec3_dot(v[i], v[i]));
+		n[i] = vec3_mul(v[i], fi);
+	}
+}
+
+static void normalize_fast(void)
+{
+	for (int i = 0; i < COUNT; i++)
+		n[i] = vec3_normalize_fast(v[i]);
+}
+
+static double bench_ns(void (*f)(void))
+{
+	f(); // warm up
+	double t = bench_seconds();
+	for (int i = 0; i < ROUNDS; i++) {
+		f();
+		bench_sink += (uint32_t)n[i % COUNT].x;
+	}
+	return (bench_seconds() - t) * 1e9 / ((double)ROUNDS * COUNT);
+}
+
+int main(void)
+{
+	srand(1);
+	for (int i = 0; i < COUNT; i++)
+		v[i] = vec3((float)rand() / RAND_MAX - 0.5f, (float)rand() / RAND_MAX - 0.5f, (float)rand() / RAND_MAX + 0.1f);
+
+	double precise = bench_ns(normalize_precise);
+	double fast = bench_ns(normalize_fast);
+	printf("1 / sqrtf         %6.2f ns\n", precise);
+	printf("float_rsqrt_fast  %6.2f ns (%5.2fx)\n", fast, fast / precise);
+	return 0;
+}
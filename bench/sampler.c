@@ -0,0 +1,81 @@
+/**
+ * r3d -- sampler benchmark: nanoseconds per texel fetch of the texture
+ * formats (R3D_TEXTURE_RGB565 is the uncompressed row-major baseline)
+ */
+
+#include "bench.h"
+#include <r3d.h>
+
+// the twilight texture in every format (generated with tools/texconv)
+#define twilight_mips twilight_rgb565
+#include "twilight_mips.h"
+#undef twilight_mips
+#define twilight_mips twilight_tiled
+#include "twilight_tiled.h"
+#undef twilight_mips
+#define twilight_mips twilight_p8
+#include "twilight_p8.h"
+#undef twilight_mips
+#define twilight_mips twilight_p4
+#include "twilight_p4.h"
+#undef twilight_mips
+#define twilight_mips twilight_bc1
+#include "twilight_bc1.h"
+#undef twilight_mips
+
+#define FRAMES 100
+
+// a 240x320 screen of texture coordinates, rotated by 30 degrees and
+// scaled to texels_per_pixel (x 256) texels of a 128x128 level per pixel
+static uint32_t bench_frame(const r3d_sampler_t *s, int32_t texels_per_pixel)
+{
+	int32_t c = 866 * texels_per_pixel * 512 / 256000; // Q16 per pixel
+	int32_t d = 500 * texels_per_pixel * 512 / 256000;
+	int32_t u0 = 0, v0 = 0;
+	uint32_t sum = 0;
+	for (int y = 0; y < 320; y++, u0 -= d, v0 += c) {
+		int32_t u = u0, v = v0;
+		for (int x = 0; x < 240; x++, u += c, v += d)
+			sum += r3d_sample_repeat(s, u, v);
+	}
+	return sum;
+}
+
+static double bench_ns(const r3d_sampler_t *s, int32_t texels_per_pixel)
+{
+	bench_sink += bench_frame(s, texels_per_pixel); // warm up
+	double t = bench_seconds();
+	for (int i = 0; i < FRAMES; i++)
+		bench_sink += bench_frame(s, texels_per_pixel);
+	return (bench_seconds() - t) * 1e9 / (FRAMES * 240 * 320);
+}
+
+int main(void)
+{
+	static const struct {
+		const char *name;
+		const void *mipmap;
+		int bits; // per texel
+	} formats[] = {
+		{ "RGB565", &twilight_rgb565, 16 },
+		{ "RGB565_TILED", &twilight_tiled, 16 },
+		{ "P8", &twilight_p8, 8 },
+		{ "P4", &twilight_p4, 4 },
+		{ "BC1", &twilight_bc1, 4 }
+	};
+	double base[2] = { 0 };
+
+	printf("%-14s %5s %21s %21s\n", "format", "bits", "0.5 texels/pixel", "2 texels/pixel");
+	for (int i = 0; i < (int)(sizeof(formats) / sizeof(formats[0])); i++) {
+		r3d_mipmap_sampler_t s;
+		r3d_mipmap_sampler(&s, formats[i].mipmap);
+		double ns[2] = { bench_ns(&s.level[0], 128), bench_ns(&s.level[0], 512) };
+		if (i == 0) {
+			base[0] = ns[0];
+			base[1] = ns[1];
+		}
+		printf("%-14s %5d %7.2f ns (%5.2fx) %7.2f ns (%5.2fx)\n", formats[i].name, formats[i].bits,
+		       ns[0], ns[0] / base[0], ns[1], ns[1] / base[1]);
+	}
+	return 0;
+}
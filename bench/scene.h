@@ -0,0 +1,177 @@
+/**
+ * r3d -- the example meshes and camera of main.c with a plain diffuse
+ * shader, rendered into libs/r3dfb-host by tests and benchmarks
+ */
+
+#ifndef SCENE_H
+#define SCENE_H
+
+#include <r3d.h>
+#include <r3d_lighting.h>
+#include <r3dfb.h>
+
+// vertex format of main.c
+typedef struct {
+	uint16_t x, y, z;
+} vertex_position_t;
+
+typedef struct {
+	uint8_t nx, ny, nz;
+	uint8_t u, v;
+} vertex_attributes_t;
+
+#include "teapot.h"
+#include "box.h"
+#include "pony.h"
+#include "teapot_faces.h"
+#include "box_faces.h"
+#include "pony_faces.h"
+
+#define SCENE_MESHES 3
+#define SCENE_VIEWS 5
+
+static const r3d_drawcall_t scene_meshes[SCENE_MESHES] = {
+	{ R3D_PRIMITIVE_TYPE_TRIANGLES,
+	  { { positions0, sizeof(vertex_position_t) }, { attributes0, sizeof(vertex_attributes_t) } },
+	  sizeof(positions0) / sizeof(vertex_position_t), 0, faces0 },
+	{ R3D_PRIMITIVE_TYPE_TRIANGLES,
+	  { { positions1, sizeof(vertex_position_t) }, { attributes1, sizeof(vertex_attributes_t) } },
+	  sizeof(positions1) / sizeof(vertex_position_t), 0, faces1 },
+	{ R3D_PRIMITIVE_TYPE_TRIANGLES,
+	  { { positions2, sizeof(vertex_position_t) }, { attributes2, sizeof(vertex_attributes_t) } },
+	  sizeof(positions2) / sizeof(vertex_position_t), 0, faces2 },
+};
+static const r3d_primitive_winding_t scene_windings[SCENE_MESHES] = {
+	R3D_PRIMITIVE_WINDING_CW,
+	R3D_PRIMITIVE_WINDING_CCW,
+	R3D_PRIMITIVE_WINDING_CCW
+};
+static const float scene_angles[SCENE_VIEWS][2] = { // x and y rotation of the model
+	{ 30, 20 }, { 60, 140 }, { 100, 250 }, { 0, 0 }, { 170, 300 }
+};
+
+typedef struct {
+	mat4_t mvp_q;
+	mat4x_t mvp_qx;
+	mat34_t mv;
+	int fixed; // positions transformed in Q16.16 (like main.c with R3D_FIXED)
+} scene_uniforms_t;
+
+typedef struct {
+	vec3_t position;
+	vec3_t normal;
+} scene_vs_to_fs_t;
+
+static scene_uniforms_t scene_uniforms;
+static int scene_mirrored; // model mirrored along x (negative determinant)
+static float scene_distance = 1.5f; // of the camera from the model (main.c: 1.5)
+
+static void scene_position(const scene_uniforms_t *u, const void *const *in, scene_vs_to_fs_t *out)
+{
+	const vertex_position_t *p = in[0];
+	if (u->fixed)
+		out->position = vec3x_to_vec3(mat4x_transform_position(&u->mvp_qx, vec3x(p->x, p->y, p->z)));
+	else
+		out->position = mat4_transform_position(&u->mvp_q, vec3(p->x, p->y, p->z));
+}
+
+// scene_position for R3D_TRIANGLE_BATCH triangles at a time
+static void scene_positions_n(const scene_uniforms_t *u, const void *const (*in)[R3D_VERTEX_STREAMS_MAX], vec3x4_t *out,
+                              uint32_t n)
+{
+	if (u->fixed) {
+		for (uint32_t i = 0; i < n; i++) {
+			const vertex_position_t *p = in[i][0];
+			vec3_t position = vec3x_to_vec3(mat4x_transform_position(&u->mvp_qx, vec3x(p->x, p->y, p->z)));
+			out[i / 4].x[i % 4] = position.x;
+			out[i / 4].y[i % 4] = position.y;
+			out[i / 4].z[i % 4] = position.z;
+		}
+		return;
+	}
+	vec3x4_t q[(3 * R3D_TRIANGLE_BATCH + 3) / 4];
+	for (uint32_t i = 0; i < (n + 3) / 4 * 4; i++) {
+		const vertex_position_t *p = in[i < n ? i : 0][0]; // pad with the first vertex
+		q[i / 4].x[i % 4] = p->x;
+		q[i / 4].y[i % 4] = p->y;
+		q[i / 4].z[i % 4] = p->z;
+	}
+	mat4_transform_positions_n(&u->mvp_q, q, out, n);
+}
+
+static void scene_attributes(const scene_uniforms_t *u, const void *const *in, scene_vs_to_fs_t *out)
+{
+	const vertex_attributes_t *a = in[1];
+	out->normal = mat34_transform_vector(&u->mv, r3d_dequantize_normal(a->nx, a->ny, a->nz));
+}
+
+static uint16_t scene_fragment(const scene_uniforms_t *u, const scene_vs_to_fs_t *in)
+{
+	const vec3_t L = { { { -0.577350269f, 0.577350269f, 0.577350269f } } };
+	int diffuse = r3d_diffuse(float_max(vec3_dot(vec3_normalize_fast(in->normal), L), 0.0f), 0.8f);
+	return r3d_light_rgb565(0xffff, diffuse, 13);
+}
+
+static const r3d_shader_t scene_shader = {
+	0,
+	0,
+	sizeof(scene_vs_to_fs_t) / sizeof(float),
+	(r3d_vertexshader_func)scene_position,
+	(r3d_vertexshader_func)scene_attributes,
+	R3D_VARYINGS(3, 3),
+	0,
+	&scene_uniforms,
+	0,
+	(r3d_fragmentshader565_func)scene_fragment,
+	0,
+	(r3d_positionshader_n_func)scene_positions_n
+};
+
+// shader of scene_render, benchmarks may point it to their own
+static const r3d_shader_t *scene_render_shader = &scene_shader;
+
+// camera of main.c, model rotated by scene_angles[view]
+static void scene_setup(int mesh, int view)
+{
+	float k = scene_distance / 1.5f;
+	mat4_t projection = mat4_perspective(60.0f, (float)R3DFB_PIXEL_WIDTH / (float)R3DFB_PIXEL_HEIGHT, 0.5f,
+	                                     scene_distance + 3.5f);
+	mat4_t lookat = mat4_lookat(vec3(0.0f, 0.25f * k, 1.5f * k), vec3(0.0f, 0.0f, 0.0f), vec3(0.0f, 1.0f, 0.0f));
+	mat34_t camera, model, rotation, mv, mvi;
+	mat34_from_mat4(&camera, &lookat);
+	mat34_rotation(&model, scene_angles[view][0], vec3(1.0f, 0.0f, 0.0f));
+	mat34_rotation(&rotation, scene_angles[view][1], vec3(0.0f, 1.0f, 0.0f));
+	mat34_mul(&model, &model, &rotation);
+	if (mesh == 1)
+		mat34_scale(&model, vec3(0.5f, 0.5f, 0.5f));
+	if (scene_mirrored)
+		mat34_scale(&model, vec3(-1.0f, 1.0f, 1.0f));
+	mat34_mul(&mv, &camera, &model);
+	mat4_t mvp;
+	mat4_mul_mat34(&mvp, &projection, &mv);
+
+	const vec3_t scale = { { { 1.0f / 65535.0f, 1.0f / 65535.0f, 1.0f / 65535.0f } } };
+	const vec3_t bias = { { { -0.5f, -0.5f, -0.5f } } };
+	scene_uniforms.mvp_q = mvp;
+	r3d_dequantization_matrix(&scene_uniforms.mvp_q, scale, bias);
+	r3d_dequantization_matrix_fixed(&scene_uniforms.mvp_qx, &mvp, scale, bias);
+	scene_uniforms.mv = mv;
+
+	mat34_invert(&mvi, &mv);
+	r3d_eye_position = mvi.c[3];
+	r3d_eye_mirrored = mat34_determinant(&mv) < 0.0f;
+	r3d_viewport(1, 1, R3DFB_PIXEL_WIDTH - 1, R3DFB_PIXEL_HEIGHT - 1);
+	r3d_backface_culling = R3D_ENABLE;
+	r3d_primitive_winding = scene_windings[mesh];
+	r3d_shader = *scene_render_shader;
+}
+
+static void scene_render(int mesh, int view)
+{
+	scene_setup(mesh, view);
+	r3dfb_clear();
+	r3d_draw(&scene_meshes[mesh]);
+	r3dfb_resolve();
+}
+
+#endif
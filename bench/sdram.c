@@ -0,0 +1,109 @@
+/**
+ * r3d -- SDRAM traffic of the two STM32F429-DISCOVERY render target
+ * layouts (see R3DFB_INTERLEAVED in libs/r3dfb-stm32f429-discovery):
+ * the pixel accesses of the example views, counted by libs/r3dfb-host
+ * and replayed on a model of the board's SDRAM with 512 byte rows, bank
+ * bits [22:21] and one open row per bank. averages per frame.
+ */
+
+#include "bench.h"
+#include "scene.h"
+
+// addresses relative to 0xD0000000, as in the stm32 r3dfb.h
+#define BACK_BUFFER  0x50000u
+#define DEPTH_BUFFER 0xA0000u
+#define PIXELS (R3DFB_PIXEL_WIDTH * R3DFB_PIXEL_HEIGHT)
+#define RESOLVE_BLOCK 64 // pixel pairs, as in the stm32 r3dfb.c
+
+typedef struct {
+	int32_t open_row[4]; // per bank, -1: none
+	uint64_t accesses, bytes, activations;
+} sdram_t;
+
+static sdram_t separate, interleaved;
+
+static void sdram_reset(sdram_t *s)
+{
+	for (int i = 0; i < 4; i++)
+		s->open_row[i] = -1;
+	s->accesses = s->bytes = s->activations = 0;
+}
+
+static void sdram_access(sdram_t *s, uint32_t address, uint32_t bytes)
+{
+	int bank = (address >> 21) & 3;
+	int32_t row = (address >> 9) & 0xfff;
+	if (s->open_row[bank] != row) {
+		s->open_row[bank] = row;
+		s->activations++;
+	}
+	s->accesses++;
+	s->bytes += bytes;
+}
+
+static void depth_read(uint16_t x, uint16_t y)
+{
+	uint32_t i = x + R3DFB_PIXEL_WIDTH * y;
+	sdram_access(&separate, DEPTH_BUFFER + sizeof(r3d_depth_t) * i, sizeof(r3d_depth_t));
+	sdram_access(&interleaved, DEPTH_BUFFER + 4 * i, 4);
+}
+
+static void pixel_write(uint16_t x, uint16_t y, r3d_depth_t z, uint16_t color)
+{
+	uint32_t i = x + R3DFB_PIXEL_WIDTH * y;
+	sdram_access(&separate, BACK_BUFFER + 2 * i, 2);
+	sdram_access(&separate, DEPTH_BUFFER + sizeof(r3d_depth_t) * i, sizeof(r3d_depth_t));
+	sdram_access(&interleaved, DEPTH_BUFFER + 4 * i, 4);
+}
+
+static void clear_words(sdram_t *s, uint32_t address, uint32_t bytes) // memset as word stores
+{
+	for (uint32_t i = 0; i < bytes; i += 4)
+		sdram_access(s, address + i, 4);
+}
+
+static void print(const char *name, const sdram_t *s, int frames)
+{
+	printf("%-24s %9.0f %9.0f %9.0f\n", name, (double)s->accesses / frames,
+	       (double)s->bytes / frames, (double)s->activations / frames);
+}
+
+int main(void)
+{
+	const int frames = SCENE_MESHES * SCENE_VIEWS;
+
+	sdram_reset(&separate);
+	sdram_reset(&interleaved);
+	r3dfb_init();
+	r3dfb_depth_trace = depth_read;
+	r3dfb_trace = pixel_write;
+	for (int mesh = 0; mesh < SCENE_MESHES; mesh++)
+		for (int view = 0; view < SCENE_VIEWS; view++)
+			scene_render(mesh, view);
+	r3dfb_depth_trace = 0;
+	r3dfb_trace = 0;
+
+	printf("%-24s %9s %9s %9s\n", "", "accesses", "bytes", "rows");
+	print("separate: pixels", &separate, frames);
+	print("interleaved: pixels", &interleaved, frames);
+
+	// per frame costs of the r3dfb_clear and r3dfb_resolve loops
+	sdram_reset(&separate);
+	clear_words(&separate, DEPTH_BUFFER, PIXELS * sizeof(r3d_depth_t));
+	clear_words(&separate, BACK_BUFFER, PIXELS * 2);
+	print("separate: clear", &separate, 1);
+	sdram_reset(&interleaved);
+	clear_words(&interleaved, DEPTH_BUFFER, PIXELS * 4);
+	print("interleaved: clear", &interleaved, 1);
+	sdram_reset(&interleaved);
+	for (uint32_t i = 0; i < PIXELS / 2; i += RESOLVE_BLOCK) { // a row of words in, half a row out
+		for (uint32_t j = i; j < i + RESOLVE_BLOCK; j++) {
+			sdram_access(&interleaved, DEPTH_BUFFER + 8 * j, 4);
+			sdram_access(&interleaved, DEPTH_BUFFER + 8 * j + 4, 4);
+		}
+		for (uint32_t j = i; j < i + RESOLVE_BLOCK; j++)
+			sdram_access(&interleaved, BACK_BUFFER + 4 * j, 4);
+	}
+	print("interleaved: resolve", &interleaved, 1);
+	return 0;
+}
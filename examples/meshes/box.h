@@ -1,2309 +1,4617 @@
-const vertex_t vertices1[] =
-{ // position[xyz], normal[xyz], uv[xy]
-	{ 806, 785, 64548,  127, 127, 255,  0, 0 },
-	{ 5279, 6796, 64548,  127, 127, 255,  18, 24 },
-	{ 5279, 58957, 64548,  127, 127, 255,  18, 231 },
-	{ 645, 64973, 64548,  127, 127, 255,  0, 255 },
-	{ 5387, 59193, 64548,  127, 127, 255,  18, 232 },
-	{ 64594, 64973, 64548,  127, 127, 255,  253, 255 },
-	{ 64831, 625, 64548,  127, 127, 255,  254, 0 },
-	{ 60089, 6405, 64548,  127, 127, 255,  235, 22 },
-	{ 5150, 6405, 64548,  127, 127, 255,  17, 22 },
-	{ 5150, 6405, 62589,  127, 86, 6,  17, 22 },
-	{ 60089, 6405, 62589,  127, 86, 6,  235, 22 },
-	{ 883, 625, 64548,  127, 86, 6,  0, 0 },
-	{ 5279, 6796, 62589,  255, 127, 127,  122, 25 },
-	{ 5279, 58957, 62589,  255, 127, 127,  122, 229 },
-	{ 5279, 58957, 64548,  255, 127, 127,  132, 229 },
-	{ 60381, 6622, 62589,  177, 127, 10,  236, 23 },
-	{ 60381, 58783, 62589,  177, 127, 10,  236, 230 },
-	{ 64966, 958, 64548,  177, 127, 10,  255, 1 },
-	{ 60381, 58783, 62589,  0, 127, 127,  122, 25 },
-	{ 60381, 6622, 62589,  0, 127, 127,  122, 229 },
-	{ 60381, 58783, 64548,  0, 127, 127,  132, 25 },
-	{ 60089, 6405, 62589,  127, 255, 127,  122, 25 },
-	{ 5150, 6405, 62589,  127, 255, 127,  122, 229 },
-	{ 5150, 6405, 64548,  127, 255, 127,  132, 229 },
-	{ 5279, 58957, 62589,  226, 207, 127,  18, 231 },
-	{ 695, 64621, 64548,  226, 207, 127,  0, 253 },
-	{ 5279, 58957, 64548,  226, 207, 127,  18, 231 },
-	{ 5279, 58957, 62589,  76, 127, 10,  18, 231 },
-	{ 5279, 6796, 62589,  76, 127, 10,  18, 24 },
-	{ 806, 785, 64548,  76, 127, 10,  0, 0 },
-	{ 5150, 6405, 62589,  24, 203, 127,  17, 22 },
-	{ 883, 625, 64548,  24, 203, 127,  0, 0 },
-	{ 5150, 6405, 64548,  24, 203, 127,  17, 22 },
-	{ 60326, 59193, 62589,  127, 168, 6,  236, 232 },
-	{ 5387, 59193, 62589,  127, 168, 6,  18, 232 },
-	{ 645, 64973, 64548,  127, 168, 6,  0, 255 },
-	{ 60381, 6622, 62589,  28, 47, 127,  236, 23 },
-	{ 64966, 958, 64548,  28, 47, 127,  255, 1 },
-	{ 60381, 6622, 64548,  28, 47, 127,  236, 23 },
-	{ 5387, 59193, 62589,  127, 0, 127,  122, 25 },
-	{ 60326, 59193, 62589,  127, 0, 127,  122, 229 },
-	{ 5387, 59193, 64548,  127, 0, 127,  132, 25 },
-	{ 5387, 59193, 62589,  28, 46, 127,  18, 232 },
-	{ 5387, 59193, 64548,  28, 46, 127,  18, 232 },
-	{ 645, 64973, 64548,  28, 46, 127,  0, 255 },
-	{ 60326, 59193, 62589,  230, 51, 127,  236, 232 },
-	{ 64594, 64973, 64548,  230, 51, 127,  253, 255 },
-	{ 60326, 59193, 64548,  230, 51, 127,  236, 232 },
-	{ 60089, 6405, 62589,  226, 208, 127,  235, 22 },
-	{ 60089, 6405, 64548,  226, 208, 127,  235, 22 },
-	{ 64831, 625, 64548,  226, 208, 127,  254, 0 },
-	{ 5279, 6796, 62589,  229, 51, 127,  18, 24 },
-	{ 5279, 6796, 64548,  229, 51, 127,  18, 24 },
-	{ 806, 785, 64548,  229, 51, 127,  0, 0 },
-	{ 60381, 58783, 62589,  25, 203, 127,  236, 230 },
-	{ 60381, 58783, 64548,  25, 203, 127,  236, 230 },
-	{ 64855, 64794, 64548,  25, 203, 127,  254, 254 },
-	{ 5309, 6199, 62589,  127, 127, 255,  18, 22 },
-	{ 12703, 6199, 62589,  127, 127, 255,  47, 22 },
-	{ 12703, 59160, 62589,  127, 127, 255,  47, 231 },
-	{ 13218, 6199, 62589,  127, 127, 255,  49, 22 },
-	{ 20613, 6199, 62589,  127, 127, 255,  79, 22 },
-	{ 13218, 59160, 62589,  127, 127, 255,  49, 231 },
-	{ 21127, 6199, 62589,  127, 127, 255,  81, 22 },
-	{ 28522, 6199, 62589,  127, 127, 255,  110, 22 },
-	{ 28522, 59160, 62589,  127, 127, 255,  110, 231 },
-	{ 29037, 6199, 62589,  127, 127, 255,  112, 22 },
-	{ 36431, 6199, 62589,  127, 127, 255,  141, 22 },
-	{ 36431, 59160, 62589,  127, 127, 255,  141, 231 },
-	{ 36946, 6199, 62589,  127, 127, 255,  143, 22 },
-	{ 44340, 6199, 62589,  127, 127, 255,  173, 22 },
-	{ 44340, 59160, 62589,  127, 127, 255,  173, 231 },
-	{ 44855, 6199, 62589,  127, 127, 255,  175, 22 },
-	{ 52250, 6199, 62589,  127, 127, 255,  204, 22 },
-	{ 44855, 59160, 62589,  127, 127, 255,  175, 231 },
-	{ 52764, 6199, 62589,  127, 127, 255,  206, 22 },
-	{ 60159, 6199, 62589,  127, 127, 255,  235, 22 },
-	{ 60159, 59160, 62589,  127, 127, 255,  235, 231 },
-	{ 5309, 6199, 60962,  127, 127, 0,  18, 22 },
-	{ 5309, 59160, 60962,  127, 127, 0,  18, 231 },
-	{ 12703, 6199, 60962,  127, 127, 0,  47, 22 },
-	{ 13218, 6199, 60962,  127, 127, 0,  49, 22 },
-	{ 13218, 59160, 60962,  127, 127, 0,  49, 231 },
-	{ 20613, 59160, 60962,  127, 127, 0,  79, 231 },
-	{ 21127, 6199, 60962,  127, 127, 0,  81, 22 },
-	{ 21127, 59160, 60962,  127, 127, 0,  81, 231 },
-	{ 28522, 59160, 60962,  127, 127, 0,  110, 231 },
-	{ 29037, 6199, 60962,  127, 127, 0,  112, 22 },
-	{ 29037, 59160, 60962,  127, 127, 0,  112, 231 },
-	{ 36431, 6199, 60962,  127, 127, 0,  141, 22 },
-	{ 36946, 6199, 60962,  127, 127, 0,  143, 22 },
-	{ 36946, 59160, 60962,  127, 127, 0,  143, 231 },
-	{ 44340, 6199, 60962,  127, 127, 0,  173, 22 },
-	{ 44855, 6199, 60962,  127, 127, 0,  175, 22 },
-	{ 44855, 59160, 60962,  127, 127, 0,  175, 231 },
-	{ 52250, 59160, 60962,  127, 127, 0,  204, 231 },
-	{ 52764, 6199, 60962,  127, 127, 0,  206, 22 },
-	{ 52765, 59160, 60962,  127, 127, 0,  206, 231 },
-	{ 60159, 59160, 60962,  127, 127, 0,  235, 231 },
-	{ 60159, 59160, 62589,  127, 255, 127,  235, 231 },
-	{ 60159, 59160, 60962,  127, 255, 127,  235, 231 },
-	{ 52765, 59160, 60962,  127, 255, 127,  206, 231 },
-	{ 44855, 6199, 62589,  127, 0, 127,  175, 22 },
-	{ 44855, 6199, 60962,  127, 0, 127,  175, 22 },
-	{ 52250, 6199, 62589,  127, 0, 127,  204, 22 },
-	{ 29037, 59160, 62589,  0, 127, 127,  112, 231 },
-	{ 29037, 59160, 60962,  0, 127, 127,  112, 231 },
-	{ 29037, 6199, 62589,  0, 127, 127,  112, 22 },
-	{ 28522, 6199, 62589,  255, 127, 127,  110, 22 },
-	{ 28522, 6199, 60962,  255, 127, 127,  110, 22 },
-	{ 28522, 59160, 60962,  255, 127, 127,  110, 231 },
-	{ 20613, 59160, 62589,  127, 255, 127,  79, 231 },
-	{ 20613, 59160, 60962,  127, 255, 127,  79, 231 },
-	{ 13218, 59160, 60962,  127, 255, 127,  49, 231 },
-	{ 5309, 6199, 62589,  127, 0, 127,  18, 22 },
-	{ 5309, 6199, 60962,  127, 0, 127,  18, 22 },
-	{ 12703, 6199, 62589,  127, 0, 127,  47, 22 },
-	{ 60159, 6199, 62589,  255, 127, 127,  235, 22 },
-	{ 60159, 6199, 60962,  255, 127, 127,  235, 22 },
-	{ 60159, 59160, 60962,  255, 127, 127,  235, 231 },
-	{ 52250, 59160, 62589,  127, 255, 127,  204, 231 },
-	{ 52250, 59160, 60962,  127, 255, 127,  204, 231 },
-	{ 44855, 59160, 60962,  127, 255, 127,  175, 231 },
-	{ 36946, 6199, 62589,  127, 0, 127,  143, 22 },
-	{ 36946, 6199, 60962,  127, 0, 127,  143, 22 },
-	{ 44340, 6199, 62589,  127, 0, 127,  173, 22 },
-	{ 21127, 59160, 62589,  0, 127, 127,  81, 231 },
-	{ 21127, 59160, 60962,  0, 127, 127,  81, 231 },
-	{ 21127, 6199, 62589,  0, 127, 127,  81, 22 },
-	{ 20613, 6199, 62589,  255, 127, 127,  79, 22 },
-	{ 20613, 6199, 60962,  255, 127, 127,  79, 22 },
-	{ 20613, 59160, 60962,  255, 127, 127,  79, 231 },
-	{ 12703, 59160, 62589,  127, 255, 127,  47, 231 },
-	{ 12703, 59160, 60962,  127, 255, 127,  47, 231 },
-	{ 5309, 59160, 60962,  127, 255, 127,  18, 231 },
-	{ 52765, 59160, 62589,  0, 127, 127,  206, 231 },
-	{ 52765, 59160, 60962,  0, 127, 127,  206, 231 },
-	{ 52764, 6199, 62589,  0, 127, 127,  206, 22 },
-	{ 52250, 6199, 62589,  255, 127, 127,  204, 22 },
-	{ 52250, 6199, 60962,  255, 127, 127,  204, 22 },
-	{ 52250, 59160, 60962,  255, 127, 127,  204, 231 },
-	{ 44340, 59160, 62589,  127, 255, 127,  173, 231 },
-	{ 44340, 59160, 60962,  127, 255, 127,  173, 231 },
-	{ 36946, 59160, 60962,  127, 255, 127,  143, 231 },
-	{ 29037, 6199, 62589,  127, 0, 127,  112, 22 },
-	{ 29037, 6199, 60962,  127, 0, 127,  112, 22 },
-	{ 36431, 6199, 62589,  127, 0, 127,  141, 22 },
-	{ 13218, 59160, 62589,  0, 127, 127,  49, 231 },
-	{ 13218, 59160, 60962,  0, 127, 127,  49, 231 },
-	{ 13218, 6199, 62589,  0, 127, 127,  49, 22 },
-	{ 12703, 6199, 62589,  255, 127, 127,  47, 22 },
-	{ 12703, 6199, 60962,  255, 127, 127,  47, 22 },
-	{ 12703, 59160, 60962,  255, 127, 127,  47, 231 },
-	{ 44855, 59160, 62589,  0, 127, 127,  175, 231 },
-	{ 44855, 59160, 60962,  0, 127, 127,  175, 231 },
-	{ 44855, 6199, 62589,  0, 127, 127,  175, 22 },
-	{ 44340, 6199, 62589,  255, 127, 127,  173, 22 },
-	{ 44340, 6199, 60962,  255, 127, 127,  173, 22 },
-	{ 44340, 59160, 60962,  255, 127, 127,  173, 231 },
-	{ 36431, 59160, 62589,  127, 255, 127,  141, 231 },
-	{ 36431, 59160, 60962,  127, 255, 127,  141, 231 },
-	{ 29037, 59160, 60962,  127, 255, 127,  112, 231 },
-	{ 21127, 6199, 62589,  127, 0, 127,  81, 22 },
-	{ 21127, 6199, 60962,  127, 0, 127,  81, 22 },
-	{ 28522, 6199, 62589,  127, 0, 127,  110, 22 },
-	{ 5309, 59160, 62589,  0, 127, 127,  18, 231 },
-	{ 5309, 59160, 60962,  0, 127, 127,  18, 231 },
-	{ 5309, 6199, 62589,  0, 127, 127,  18, 22 },
-	{ 52764, 6199, 62589,  127, 0, 127,  206, 22 },
-	{ 52764, 6199, 60962,  127, 0, 127,  206, 22 },
-	{ 60159, 6199, 62589,  127, 0, 127,  235, 22 },
-	{ 36946, 59160, 62589,  0, 127, 127,  143, 231 },
-	{ 36946, 59160, 60962,  0, 127, 127,  143, 231 },
-	{ 36946, 6199, 62589,  0, 127, 127,  143, 22 },
-	{ 36431, 6199, 62589,  255, 127, 127,  141, 22 },
-	{ 36431, 6199, 60962,  255, 127, 127,  141, 22 },
-	{ 36431, 59160, 60962,  255, 127, 127,  141, 231 },
-	{ 28522, 59160, 62589,  127, 255, 127,  110, 231 },
-	{ 28522, 59160, 60962,  127, 255, 127,  110, 231 },
-	{ 21127, 59160, 60962,  127, 255, 127,  81, 231 },
-	{ 13218, 6199, 62589,  127, 0, 127,  49, 22 },
-	{ 13218, 6199, 60962,  127, 0, 127,  49, 22 },
-	{ 20613, 6199, 62589,  127, 0, 127,  79, 22 },
-	{ 64855, 64794, 64548,  127, 127, 255,  254, 254 },
-	{ 60381, 58783, 64548,  127, 127, 255,  236, 230 },
-	{ 60381, 6622, 64548,  127, 127, 255,  236, 23 },
-	{ 5549, 11146, 64244,  118, 135, 254,  81, 22 },
-	{ 11406, 6685, 64937,  118, 135, 254,  110, 22 },
-	{ 59868, 54371, 65115,  118, 135, 254,  110, 231 },
-	{ 5674, 11058, 62624,  136, 119, 0,  81, 22 },
-	{ 54136, 58744, 62802,  136, 119, 0,  81, 231 },
-	{ 11531, 6597, 63318,  136, 119, 0,  110, 22 },
-	{ 11406, 6685, 64937,  216, 36, 139,  131, 27 },
-	{ 11531, 6597, 63318,  216, 36, 139,  123, 27 },
-	{ 59868, 54371, 65115,  216, 36, 139,  131, 227 },
-	{ 54012, 58832, 64422,  38, 218, 115,  131, 27 },
-	{ 54136, 58744, 62802,  38, 218, 115,  123, 27 },
-	{ 5549, 11146, 64244,  38, 218, 115,  131, 227 },
-	{ 5549, 11146, 64244,  50, 26, 127,  80, 29 },
-	{ 5674, 11058, 62624,  50, 26, 127,  81, 22 },
-	{ 11406, 6685, 64937,  50, 26, 127,  110, 29 },
-	{ 59868, 54371, 65115,  204, 228, 127,  109, 226 },
-	{ 59993, 54283, 63496,  204, 228, 127,  110, 231 },
-	{ 54136, 58744, 62802,  204, 228, 127,  81, 231 },
-	{ 695, 64621, 64548,  127, 127, 255,  0, 253 },
-	{ 806, 785, 64548,  127, 127, 255,  0, 0 },
-	{ 5279, 58957, 64548,  127, 127, 255,  18, 231 },
-	{ 5387, 59193, 64548,  127, 127, 255,  18, 232 },
-	{ 60326, 59193, 64548,  127, 127, 255,  236, 232 },
-	{ 64594, 64973, 64548,  127, 127, 255,  253, 255 },
-	{ 883, 625, 64548,  127, 127, 255,  0, 0 },
-	{ 64831, 625, 64548,  127, 127, 255,  254, 0 },
-	{ 5150, 6405, 64548,  127, 127, 255,  17, 22 },
-	{ 60089, 6405, 62589,  127, 86, 6,  235, 22 },
-	{ 64831, 625, 64548,  127, 86, 6,  254, 0 },
-	{ 883, 625, 64548,  127, 86, 6,  0, 0 },
-	{ 5279, 6796, 64548,  255, 127, 127,  132, 25 },
-	{ 5279, 6796, 62589,  255, 127, 127,  122, 25 },
-	{ 5279, 58957, 64548,  255, 127, 127,  132, 229 },
-	{ 60381, 58783, 62589,  178, 127, 10,  236, 230 },
-	{ 64855, 64794, 64548,  178, 127, 10,  254, 254 },
-	{ 64966, 958, 64548,  178, 127, 10,  255, 1 },
-	{ 60381, 6622, 62589,  0, 127, 127,  122, 229 },
-	{ 60381, 6622, 64548,  0, 127, 127,  132, 229 },
-	{ 60381, 58783, 64548,  0, 127, 127,  132, 25 },
-	{ 60089, 6405, 64548,  127, 255, 127,  132, 25 },
-	{ 60089, 6405, 62589,  127, 255, 127,  122, 25 },
-	{ 5150, 6405, 64548,  127, 255, 127,  132, 229 },
-	{ 695, 64621, 64548,  77, 127, 10,  0, 253 },
-	{ 5279, 58957, 62589,  77, 127, 10,  18, 231 },
-	{ 806, 785, 64548,  77, 127, 10,  0, 0 },
-	{ 64594, 64973, 64548,  127, 168, 6,  253, 255 },
-	{ 60326, 59193, 62589,  127, 168, 6,  236, 232 },
-	{ 645, 64973, 64548,  127, 168, 6,  0, 255 },
-	{ 60326, 59193, 62589,  127, 0, 127,  122, 229 },
-	{ 60326, 59193, 64548,  127, 0, 127,  132, 229 },
-	{ 5387, 59193, 64548,  127, 0, 127,  132, 25 },
-	{ 5309, 59160, 62589,  127, 127, 255,  18, 231 },
-	{ 5309, 6199, 62589,  127, 127, 255,  18, 22 },
-	{ 12703, 59160, 62589,  127, 127, 255,  47, 231 },
-	{ 20613, 6199, 62589,  127, 127, 255,  79, 22 },
-	{ 20613, 59160, 62589,  127, 127, 255,  79, 231 },
-	{ 13218, 59160, 62589,  127, 127, 255,  49, 231 },
-	{ 21127, 59160, 62589,  127, 127, 255,  81, 231 },
-	{ 21127, 6199, 62589,  127, 127, 255,  81, 22 },
-	{ 28522, 59160, 62589,  127, 127, 255,  110, 231 },
-	{ 29037, 59160, 62589,  127, 127, 255,  112, 231 },
-	{ 29037, 6199, 62589,  127, 127, 255,  112, 22 },
-	{ 36431, 59160, 62589,  127, 127, 255,  141, 231 },
-	{ 36946, 59160, 62589,  127, 127, 255,  143, 231 },
-	{ 36946, 6199, 62589,  127, 127, 255,  143, 22 },
-	{ 44340, 59160, 62589,  127, 127, 255,  173, 231 },
-	{ 52250, 6199, 62589,  127, 127, 255,  204, 22 },
-	{ 52250, 59160, 62589,  127, 127, 255,  204, 231 },
-	{ 44855, 59160, 62589,  127, 127, 255,  175, 231 },
-	{ 52765, 59160, 62589,  127, 127, 255,  206, 231 },
-	{ 52764, 6199, 62589,  127, 127, 255,  206, 22 },
-	{ 60159, 59160, 62589,  127, 127, 255,  235, 231 },
-	{ 5309, 59160, 60962,  127, 127, 0,  18, 231 },
-	{ 12703, 59160, 60962,  127, 127, 0,  47, 231 },
-	{ 12703, 6199, 60962,  127, 127, 0,  47, 22 },
-	{ 20613, 6199, 60962,  127, 127, 0,  79, 22 },
-	{ 13218, 6199, 60962,  127, 127, 0,  49, 22 },
-	{ 20613, 59160, 60962,  127, 127, 0,  79, 231 },
-	{ 28522, 6199, 60962,  127, 127, 0,  110, 22 },
-	{ 21127, 6199, 60962,  127, 127, 0,  81, 22 },
-	{ 28522, 59160, 60962,  127, 127, 0,  110, 231 },
-	{ 29037, 59160, 60962,  127, 127, 0,  112, 231 },
-	{ 36431, 59160, 60962,  127, 127, 0,  141, 231 },
-	{ 36431, 6199, 60962,  127, 127, 0,  141, 22 },
-	{ 36946, 59160, 60962,  127, 127, 0,  143, 231 },
-	{ 44340, 59160, 60962,  127, 127, 0,  173, 231 },
-	{ 44340, 6199, 60962,  127, 127, 0,  173, 22 },
-	{ 52250, 6199, 60962,  127, 127, 0,  204, 22 },
-	{ 44855, 6199, 60962,  127, 127, 0,  175, 22 },
-	{ 52250, 59160, 60962,  127, 127, 0,  204, 231 },
-	{ 60159, 6199, 60962,  127, 127, 0,  235, 22 },
-	{ 52764, 6199, 60962,  127, 127, 0,  206, 22 },
-	{ 60159, 59160, 60962,  127, 127, 0,  235, 231 },
-	{ 52765, 59160, 62589,  127, 255, 127,  206, 231 },
-	{ 60159, 59160, 62589,  127, 255, 127,  235, 231 },
-	{ 52765, 59160, 60962,  127, 255, 127,  206, 231 },
-	{ 44855, 6199, 60962,  127, 0, 127,  175, 22 },
-	{ 52250, 6199, 60962,  127, 0, 127,  204, 22 },
-	{ 52250, 6199, 62589,  127, 0, 127,  204, 22 },
-	{ 29037, 59160, 60962,  0, 127, 127,  112, 231 },
-	{ 29037, 6199, 60962,  0, 127, 127,  112, 22 },
-	{ 29037, 6199, 62589,  0, 127, 127,  112, 22 },
-	{ 28522, 59160, 62589,  255, 127, 127,  110, 231 },
-	{ 28522, 6199, 62589,  255, 127, 127,  110, 22 },
-	{ 28522, 59160, 60962,  255, 127, 127,  110, 231 },
-	{ 13218, 59160, 62589,  127, 255, 127,  49, 231 },
-	{ 20613, 59160, 62589,  127, 255, 127,  79, 231 },
-	{ 13218, 59160, 60962,  127, 255, 127,  49, 231 },
-	{ 5309, 6199, 60962,  127, 0, 127,  18, 22 },
-	{ 12703, 6199, 60962,  127, 0, 127,  47, 22 },
-	{ 12703, 6199, 62589,  127, 0, 127,  47, 22 },
-	{ 60159, 59160, 62589,  255, 127, 127,  235, 231 },
-	{ 60159, 6199, 62589,  255, 127, 127,  235, 22 },
-	{ 60159, 59160, 60962,  255, 127, 127,  235, 231 },
-	{ 44855, 59160, 62589,  127, 255, 127,  175, 231 },
-	{ 52250, 59160, 62589,  127, 255, 127,  204, 231 },
-	{ 44855, 59160, 60962,  127, 255, 127,  175, 231 },
-	{ 36946, 6199, 60962,  127, 0, 127,  143, 22 },
-	{ 44340, 6199, 60962,  127, 0, 127,  173, 22 },
-	{ 44340, 6199, 62589,  127, 0, 127,  173, 22 },
-	{ 21127, 59160, 60962,  0, 127, 127,  81, 231 },
-	{ 21127, 6199, 60962,  0, 127, 127,  81, 22 },
-	{ 21127, 6199, 62589,  0, 127, 127,  81, 22 },
-	{ 20613, 59160, 62589,  255, 127, 127,  79, 231 },
-	{ 20613, 6199, 62589,  255, 127, 127,  79, 22 },
-	{ 20613, 59160, 60962,  255, 127, 127,  79, 231 },
-	{ 5309, 59160, 62589,  127, 255, 127,  18, 231 },
-	{ 12703, 59160, 62589,  127, 255, 127,  47, 231 },
-	{ 5309, 59160, 60962,  127, 255, 127,  18, 231 },
-	{ 52765, 59160, 60962,  0, 127, 127,  206, 231 },
-	{ 52764, 6199, 60962,  0, 127, 127,  206, 22 },
-	{ 52764, 6199, 62589,  0, 127, 127,  206, 22 },
-	{ 52250, 59160, 62589,  255, 127, 127,  204, 231 },
-	{ 52250, 6199, 62589,  255, 127, 127,  204, 22 },
-	{ 52250, 59160, 60962,  255, 127, 127,  204, 231 },
-	{ 36946, 59160, 62589,  127, 255, 127,  143, 231 },
-	{ 44340, 59160, 62589,  127, 255, 127,  173, 231 },
-	{ 36946, 59160, 60962,  127, 255, 127,  143, 231 },
-	{ 29037, 6199, 60962,  127, 0, 127,  112, 22 },
-	{ 36431, 6199, 60962,  127, 0, 127,  141, 22 },
-	{ 36431, 6199, 62589,  127, 0, 127,  141, 22 },
-	{ 13218, 59160, 60962,  0, 127, 127,  49, 231 },
-	{ 13218, 6199, 60962,  0, 127, 127,  49, 22 },
-	{ 13218, 6199, 62589,  0, 127, 127,  49, 22 },
-	{ 12703, 59160, 62589,  255, 127, 127,  47, 231 },
-	{ 12703, 6199, 62589,  255, 127, 127,  47, 22 },
-	{ 12703, 59160, 60962,  255, 127, 127,  47, 231 },
-	{ 44855, 59160, 60962,  0, 127, 127,  175, 231 },
-	{ 44855, 6199, 60962,  0, 127, 127,  175, 22 },
-	{ 44855, 6199, 62589,  0, 127, 127,  175, 22 },
-	{ 44340, 59160, 62589,  255, 127, 127,  173, 231 },
-	{ 44340, 6199, 62589,  255, 127, 127,  173, 22 },
-	{ 44340, 59160, 60962,  255, 127, 127,  173, 231 },
-	{ 29037, 59160, 62589,  127, 255, 127,  112, 231 },
-	{ 36431, 59160, 62589,  127, 255, 127,  141, 231 },
-	{ 29037, 59160, 60962,  127, 255, 127,  112, 231 },
-	{ 21127, 6199, 60962,  127, 0, 127,  81, 22 },
-	{ 28522, 6199, 60962,  127, 0, 127,  110, 22 },
-	{ 28522, 6199, 62589,  127, 0, 127,  110, 22 },
-	{ 5309, 59160, 60962,  0, 127, 127,  18, 231 },
-	{ 5309, 6199, 60962,  0, 127, 127,  18, 22 },
-	{ 5309, 6199, 62589,  0, 127, 127,  18, 22 },
-	{ 52764, 6199, 60962,  127, 0, 127,  206, 22 },
-	{ 60159, 6199, 60962,  127, 0, 127,  235, 22 },
-	{ 60159, 6199, 62589,  127, 0, 127,  235, 22 },
-	{ 36946, 59160, 60962,  0, 127, 127,  143, 231 },
-	{ 36946, 6199, 60962,  0, 127, 127,  143, 22 },
-	{ 36946, 6199, 62589,  0, 127, 127,  143, 22 },
-	{ 36431, 59160, 62589,  255, 127, 127,  141, 231 },
-	{ 36431, 6199, 62589,  255, 127, 127,  141, 22 },
-	{ 36431, 59160, 60962,  255, 127, 127,  141, 231 },
-	{ 21127, 59160, 62589,  127, 255, 127,  81, 231 },
-	{ 28522, 59160, 62589,  127, 255, 127,  110, 231 },
-	{ 21127, 59160, 60962,  127, 255, 127,  81, 231 },
-	{ 13218, 6199, 60962,  127, 0, 127,  49, 22 },
-	{ 20613, 6199, 60962,  127, 0, 127,  79, 22 },
-	{ 20613, 6199, 62589,  127, 0, 127,  79, 22 },
-	{ 64966, 958, 64548,  127, 127, 255,  255, 1 },
-	{ 64855, 64794, 64548,  127, 127, 255,  254, 254 },
-	{ 60381, 6622, 64548,  127, 127, 255,  236, 23 },
-	{ 54012, 58832, 64422,  118, 135, 254,  81, 231 },
-	{ 5549, 11146, 64244,  118, 135, 254,  81, 22 },
-	{ 59868, 54371, 65115,  118, 135, 254,  110, 231 },
-	{ 54136, 58744, 62802,  136, 119, 0,  81, 231 },
-	{ 59993, 54283, 63496,  136, 119, 0,  110, 231 },
-	{ 11531, 6597, 63318,  136, 119, 0,  110, 22 },
-	{ 11531, 6597, 63318,  216, 36, 139,  123, 27 },
-	{ 59993, 54283, 63496,  216, 36, 139,  123, 227 },
-	{ 59868, 54371, 65115,  216, 36, 139,  131, 227 },
-	{ 54136, 58744, 62802,  38, 218, 115,  123, 27 },
-	{ 5674, 11058, 62624,  38, 218, 115,  123, 227 },
-	{ 5549, 11146, 64244,  38, 218, 115,  131, 227 },
-	{ 5674, 11058, 62624,  50, 26, 127,  81, 22 },
-	{ 11531, 6597, 63318,  50, 26, 127,  110, 22 },
-	{ 11406, 6685, 64937,  50, 26, 127,  110, 29 },
-	{ 54012, 58832, 64422,  204, 228, 127,  82, 225 },
-	{ 59868, 54371, 65115,  204, 228, 127,  109, 226 },
-	{ 54136, 58744, 62802,  204, 228, 127,  81, 231 },
-	{ 65241, 785, 966,  127, 127, 0,  0, 0 },
-	{ 60767, 6796, 966,  127, 127, 0,  18, 24 },
-	{ 65352, 64621, 966,  127, 127, 0,  0, 253 },
-	{ 65401, 64973, 966,  127, 127, 0,  0, 255 },
-	{ 60659, 59193, 966,  127, 127, 0,  18, 232 },
-	{ 5720, 59193, 966,  127, 127, 0,  236, 232 },
-	{ 1215, 625, 966,  127, 127, 0,  254, 0 },
-	{ 5957, 6405, 966,  127, 127, 0,  235, 22 },
-	{ 65164, 625, 966,  127, 127, 0,  0, 0 },
-	{ 60896, 6405, 2926,  127, 86, 248,  17, 22 },
-	{ 5957, 6405, 2926,  127, 86, 248,  235, 22 },
-	{ 1215, 625, 966,  127, 86, 248,  254, 0 },
-	{ 60767, 6796, 2926,  0, 127, 127,  122, 25 },
-	{ 60768, 58957, 2926,  0, 127, 127,  122, 229 },
-	{ 60767, 6796, 966,  0, 127, 127,  132, 25 },
-	{ 5665, 6622, 2926,  76, 127, 244,  236, 23 },
-	{ 5665, 58783, 2926,  76, 127, 244,  236, 230 },
-	{ 1192, 64794, 966,  76, 127, 244,  254, 254 },
-	{ 5665, 58783, 2926,  255, 127, 127,  122, 25 },
-	{ 5665, 6622, 2926,  255, 127, 127,  122, 229 },
-	{ 5665, 6622, 966,  255, 127, 127,  132, 229 },
-	{ 5957, 6405, 2926,  127, 255, 127,  122, 25 },
-	{ 60896, 6405, 2926,  127, 255, 127,  122, 229 },
-	{ 60896, 6405, 966,  127, 255, 127,  132, 229 },
-	{ 60768, 58957, 2926,  28, 207, 127,  18, 231 },
-	{ 65352, 64621, 966,  28, 207, 127,  0, 253 },
-	{ 60768, 58957, 966,  28, 207, 127,  18, 231 },
-	{ 60768, 58957, 2926,  177, 127, 244,  18, 231 },
-	{ 60767, 6796, 2926,  177, 127, 244,  18, 24 },
-	{ 65352, 64621, 966,  177, 127, 244,  0, 253 },
-	{ 60896, 6405, 2926,  230, 203, 127,  17, 22 },
-	{ 65164, 625, 966,  230, 203, 127,  0, 0 },
-	{ 60896, 6405, 966,  230, 203, 127,  17, 22 },
-	{ 5720, 59193, 2926,  127, 168, 248,  236, 232 },
-	{ 60659, 59193, 2926,  127, 168, 248,  18, 232 },
-	{ 1453, 64973, 966,  127, 168, 248,  253, 255 },
-	{ 5665, 6622, 2926,  226, 47, 127,  236, 23 },
-	{ 1081, 958, 966,  226, 47, 127,  255, 1 },
-	{ 5665, 6622, 966,  226, 47, 127,  236, 23 },
-	{ 60659, 59193, 2926,  127, 0, 127,  122, 25 },
-	{ 5720, 59193, 2926,  127, 0, 127,  122, 229 },
-	{ 60659, 59193, 966,  127, 0, 127,  132, 25 },
-	{ 60659, 59193, 2926,  226, 46, 127,  18, 232 },
-	{ 60659, 59193, 966,  226, 46, 127,  18, 232 },
-	{ 65401, 64973, 966,  226, 46, 127,  0, 255 },
-	{ 5720, 59193, 2926,  24, 51, 127,  236, 232 },
-	{ 1453, 64973, 966,  24, 51, 127,  253, 255 },
-	{ 5720, 59193, 966,  24, 51, 127,  236, 232 },
-	{ 5957, 6405, 2926,  28, 208, 127,  235, 22 },
-	{ 5957, 6405, 966,  28, 208, 127,  235, 22 },
-	{ 1215, 625, 966,  28, 208, 127,  254, 0 },
-	{ 60767, 6796, 2926,  25, 51, 127,  18, 24 },
-	{ 60767, 6796, 966,  25, 51, 127,  18, 24 },
-	{ 65241, 785, 966,  25, 51, 127,  0, 0 },
-	{ 5665, 58783, 2926,  229, 203, 127,  236, 230 },
-	{ 5665, 58783, 966,  229, 203, 127,  236, 230 },
-	{ 1192, 64794, 966,  229, 203, 127,  254, 254 },
-	{ 60738, 6199, 2926,  127, 127, 0,  18, 22 },
-	{ 53343, 6199, 2926,  127, 127, 0,  47, 22 },
-	{ 53343, 59160, 2926,  127, 127, 0,  47, 231 },
-	{ 52829, 6199, 2926,  127, 127, 0,  49, 22 },
-	{ 45434, 6199, 2926,  127, 127, 0,  79, 22 },
-	{ 45434, 59160, 2926,  127, 127, 0,  79, 231 },
-	{ 44919, 6199, 2926,  127, 127, 0,  81, 22 },
-	{ 37525, 6199, 2926,  127, 127, 0,  110, 22 },
-	{ 37525, 59160, 2926,  127, 127, 0,  110, 231 },
-	{ 37010, 6199, 2926,  127, 127, 0,  112, 22 },
-	{ 29616, 6199, 2926,  127, 127, 0,  141, 22 },
-	{ 37010, 59160, 2926,  127, 127, 0,  112, 231 },
-	{ 29101, 6199, 2926,  127, 127, 0,  143, 22 },
-	{ 21706, 6199, 2926,  127, 127, 0,  173, 22 },
-	{ 29101, 59160, 2926,  127, 127, 0,  143, 231 },
-	{ 21191, 6199, 2926,  127, 127, 0,  175, 22 },
-	{ 13797, 6199, 2926,  127, 127, 0,  204, 22 },
-	{ 13797, 59160, 2926,  127, 127, 0,  204, 231 },
-	{ 13282, 6199, 2926,  127, 127, 0,  206, 22 },
-	{ 5888, 6199, 2926,  127, 127, 0,  235, 22 },
-	{ 5888, 59160, 2926,  127, 127, 0,  235, 231 },
-	{ 60738, 6199, 4552,  127, 127, 255,  18, 22 },
-	{ 60738, 59160, 4552,  127, 127, 255,  18, 231 },
-	{ 53343, 6199, 4552,  127, 127, 255,  47, 22 },
-	{ 52829, 6199, 4552,  127, 127, 255,  49, 22 },
-	{ 52829, 59160, 4552,  127, 127, 255,  49, 231 },
-	{ 45434, 6199, 4552,  127, 127, 255,  79, 22 },
-	{ 44919, 6199, 4552,  127, 127, 255,  81, 22 },
-	{ 44919, 59160, 4552,  127, 127, 255,  81, 231 },
-	{ 37525, 6199, 4552,  127, 127, 255,  110, 22 },
-	{ 37010, 6199, 4552,  127, 127, 255,  112, 22 },
-	{ 37010, 59160, 4552,  127, 127, 255,  112, 231 },
-	{ 29616, 6199, 4552,  127, 127, 255,  141, 22 },
-	{ 29101, 6199, 4552,  127, 127, 255,  143, 22 },
-	{ 29101, 59160, 4552,  127, 127, 255,  143, 231 },
-	{ 21706, 59160, 4552,  127, 127, 255,  173, 231 },
-	{ 21191, 6199, 4552,  127, 127, 255,  175, 22 },
-	{ 21191, 59160, 4552,  127, 127, 255,  175, 231 },
-	{ 13797, 6199, 4552,  127, 127, 255,  204, 22 },
-	{ 13282, 6199, 4552,  127, 127, 255,  206, 22 },
-	{ 13282, 59160, 4552,  127, 127, 255,  206, 231 },
-	{ 5888, 6199, 4552,  127, 127, 255,  235, 22 },
-	{ 5888, 59160, 2926,  127, 255, 127,  235, 231 },
-	{ 5888, 59160, 4552,  127, 255, 127,  235, 231 },
-	{ 13282, 59160, 2926,  127, 255, 127,  206, 231 },
-	{ 21191, 6199, 2926,  127, 0, 127,  175, 22 },
-	{ 21191, 6199, 4552,  127, 0, 127,  175, 22 },
-	{ 13797, 6199, 4552,  127, 0, 127,  204, 22 },
-	{ 37010, 59160, 2926,  255, 127, 127,  112, 231 },
-	{ 37010, 59160, 4552,  255, 127, 127,  112, 231 },
-	{ 37010, 6199, 4552,  255, 127, 127,  112, 22 },
-	{ 37525, 6199, 2926,  0, 127, 127,  110, 22 },
-	{ 37525, 6199, 4552,  0, 127, 127,  110, 22 },
-	{ 37525, 59160, 2926,  0, 127, 127,  110, 231 },
-	{ 45434, 59160, 2926,  127, 255, 127,  79, 231 },
-	{ 45434, 59160, 4552,  127, 255, 127,  79, 231 },
-	{ 52829, 59160, 2926,  127, 255, 127,  49, 231 },
-	{ 60738, 6199, 2926,  127, 0, 127,  18, 22 },
-	{ 60738, 6199, 4552,  127, 0, 127,  18, 22 },
-	{ 53343, 6199, 4552,  127, 0, 127,  47, 22 },
-	{ 5888, 6199, 2926,  0, 127, 127,  235, 22 },
-	{ 5888, 6199, 4552,  0, 127, 127,  235, 22 },
-	{ 5888, 59160, 2926,  0, 127, 127,  235, 231 },
-	{ 13797, 59160, 2926,  127, 255, 127,  204, 231 },
-	{ 13797, 59160, 4552,  127, 255, 127,  204, 231 },
-	{ 21191, 59160, 2926,  127, 255, 127,  175, 231 },
-	{ 29101, 6199, 2926,  127, 0, 127,  143, 22 },
-	{ 29101, 6199, 4552,  127, 0, 127,  143, 22 },
-	{ 21706, 6199, 4552,  127, 0, 127,  173, 22 },
-	{ 44919, 59160, 2926,  255, 127, 127,  81, 231 },
-	{ 44919, 59160, 4552,  255, 127, 127,  81, 231 },
-	{ 44919, 6199, 4552,  255, 127, 127,  81, 22 },
-	{ 45434, 6199, 2926,  0, 127, 127,  79, 22 },
-	{ 45434, 6199, 4552,  0, 127, 127,  79, 22 },
-	{ 45434, 59160, 2926,  0, 127, 127,  79, 231 },
-	{ 53343, 59160, 2926,  127, 255, 127,  47, 231 },
-	{ 53343, 59160, 4552,  127, 255, 127,  47, 231 },
-	{ 60738, 59160, 2926,  127, 255, 127,  18, 231 },
-	{ 13282, 59160, 2926,  255, 127, 127,  206, 231 },
-	{ 13282, 59160, 4552,  255, 127, 127,  206, 231 },
-	{ 13282, 6199, 4552,  255, 127, 127,  206, 22 },
-	{ 13797, 6199, 2926,  0, 127, 127,  204, 22 },
-	{ 13797, 6199, 4552,  0, 127, 127,  204, 22 },
-	{ 13797, 59160, 2926,  0, 127, 127,  204, 231 },
-	{ 21706, 59160, 2926,  127, 255, 127,  173, 231 },
-	{ 21706, 59160, 4552,  127, 255, 127,  173, 231 },
-	{ 29101, 59160, 2926,  127, 255, 127,  143, 231 },
-	{ 37010, 6199, 2926,  127, 0, 127,  112, 22 },
-	{ 37010, 6199, 4552,  127, 0, 127,  112, 22 },
-	{ 29616, 6199, 4552,  127, 0, 127,  141, 22 },
-	{ 52829, 59160, 2926,  255, 127, 127,  49, 231 },
-	{ 52829, 59160, 4552,  255, 127, 127,  49, 231 },
-	{ 52829, 6199, 4552,  255, 127, 127,  49, 22 },
-	{ 53343, 6199, 2926,  0, 127, 127,  47, 22 },
-	{ 53343, 6199, 4552,  0, 127, 127,  47, 22 },
-	{ 53343, 59160, 2926,  0, 127, 127,  47, 231 },
-	{ 21191, 59160, 2926,  255, 127, 127,  175, 231 },
-	{ 21191, 59160, 4552,  255, 127, 127,  175, 231 },
-	{ 21191, 6199, 4552,  255, 127, 127,  175, 22 },
-	{ 21706, 6199, 2926,  0, 127, 127,  173, 22 },
-	{ 21706, 6199, 4552,  0, 127, 127,  173, 22 },
-	{ 21706, 59160, 2926,  0, 127, 127,  173, 231 },
-	{ 29616, 59160, 2926,  127, 255, 127,  141, 231 },
-	{ 29616, 59160, 4552,  127, 255, 127,  141, 231 },
-	{ 37010, 59160, 2926,  127, 255, 127,  112, 231 },
-	{ 44919, 6199, 2926,  127, 0, 127,  81, 22 },
-	{ 44919, 6199, 4552,  127, 0, 127,  81, 22 },
-	{ 37525, 6199, 4552,  127, 0, 127,  110, 22 },
-	{ 60738, 59160, 2926,  255, 127, 127,  18, 231 },
-	{ 60738, 59160, 4552,  255, 127, 127,  18, 231 },
-	{ 60738, 6199, 4552,  255, 127, 127,  18, 22 },
-	{ 13282, 6199, 2926,  127, 0, 127,  206, 22 },
-	{ 13282, 6199, 4552,  127, 0, 127,  206, 22 },
-	{ 5888, 6199, 4552,  127, 0, 127,  235, 22 },
-	{ 29101, 59160, 2926,  255, 127, 127,  143, 231 },
-	{ 29101, 59160, 4552,  255, 127, 127,  143, 231 },
-	{ 29101, 6199, 4552,  255, 127, 127,  143, 22 },
-	{ 29616, 6199, 2926,  0, 127, 127,  141, 22 },
-	{ 29616, 6199, 4552,  0, 127, 127,  141, 22 },
-	{ 29616, 59160, 2926,  0, 127, 127,  141, 231 },
-	{ 37525, 59160, 2926,  127, 255, 127,  110, 231 },
-	{ 37525, 59160, 4552,  127, 255, 127,  110, 231 },
-	{ 44919, 59160, 2926,  127, 255, 127,  81, 231 },
-	{ 52829, 6199, 2926,  127, 0, 127,  49, 22 },
-	{ 52829, 6199, 4552,  127, 0, 127,  49, 22 },
-	{ 45434, 6199, 4552,  127, 0, 127,  79, 22 },
-	{ 1192, 64794, 966,  127, 127, 0,  254, 254 },
-	{ 5665, 58783, 966,  127, 127, 0,  236, 230 },
-	{ 1081, 958, 966,  127, 127, 0,  255, 1 },
-	{ 60497, 11146, 1271,  136, 135, 0,  81, 22 },
-	{ 54641, 6685, 577,  136, 135, 0,  110, 22 },
-	{ 12035, 58832, 1093,  136, 135, 0,  81, 231 },
-	{ 60373, 11058, 2890,  118, 119, 254,  81, 22 },
-	{ 11910, 58744, 2712,  118, 119, 254,  81, 231 },
-	{ 6054, 54283, 2018,  118, 119, 254,  110, 231 },
-	{ 54641, 6685, 577,  38, 36, 115,  131, 27 },
-	{ 54516, 6597, 2196,  38, 36, 115,  123, 27 },
-	{ 6054, 54283, 2018,  38, 36, 115,  123, 227 },
-	{ 12035, 58832, 1093,  216, 218, 139,  131, 27 },
-	{ 11910, 58744, 2712,  216, 218, 139,  123, 27 },
-	{ 60373, 11058, 2890,  216, 218, 139,  123, 227 },
-	{ 60497, 11146, 1271,  204, 26, 127,  80, 29 },
-	{ 60373, 11058, 2890,  204, 26, 127,  81, 22 },
-	{ 54516, 6597, 2196,  204, 26, 127,  110, 22 },
-	{ 6179, 54371, 399,  50, 228, 127,  109, 226 },
-	{ 6054, 54283, 2018,  50, 228, 127,  110, 231 },
-	{ 12035, 58832, 1093,  50, 228, 127,  82, 225 },
-	{ 60767, 6796, 966,  127, 127, 0,  18, 24 },
-	{ 60768, 58957, 966,  127, 127, 0,  18, 231 },
-	{ 65352, 64621, 966,  127, 127, 0,  0, 253 },
-	{ 1453, 64973, 966,  127, 127, 0,  253, 255 },
-	{ 65401, 64973, 966,  127, 127, 0,  0, 255 },
-	{ 5720, 59193, 966,  127, 127, 0,  236, 232 },
-	{ 5957, 6405, 966,  127, 127, 0,  235, 22 },
-	{ 60896, 6405, 966,  127, 127, 0,  17, 22 },
-	{ 65164, 625, 966,  127, 127, 0,  0, 0 },
-	{ 65164, 625, 966,  127, 86, 248,  0, 0 },
-	{ 60896, 6405, 2926,  127, 86, 248,  17, 22 },
-	{ 1215, 625, 966,  127, 86, 248,  254, 0 },
-	{ 60768, 58957, 2926,  0, 127, 127,  122, 229 },
-	{ 60768, 58957, 966,  0, 127, 127,  132, 229 },
-	{ 60767, 6796, 966,  0, 127, 127,  132, 25 },
-	{ 1081, 958, 966,  77, 127, 244,  255, 1 },
-	{ 5665, 6622, 2926,  77, 127, 244,  236, 23 },
-	{ 1192, 64794, 966,  77, 127, 244,  254, 254 },
-	{ 5665, 58783, 966,  255, 127, 127,  132, 25 },
-	{ 5665, 58783, 2926,  255, 127, 127,  122, 25 },
-	{ 5665, 6622, 966,  255, 127, 127,  132, 229 },
-	{ 5957, 6405, 966,  127, 255, 127,  132, 25 },
-	{ 5957, 6405, 2926,  127, 255, 127,  122, 25 },
-	{ 60896, 6405, 966,  127, 255, 127,  132, 229 },
-	{ 60767, 6796, 2926,  178, 127, 244,  18, 24 },
-	{ 65241, 785, 966,  178, 127, 244,  0, 0 },
-	{ 65352, 64621, 966,  178, 127, 244,  0, 253 },
-	{ 60659, 59193, 2926,  127, 168, 248,  18, 232 },
-	{ 65401, 64973, 966,  127, 168, 248,  0, 255 },
-	{ 1453, 64973, 966,  127, 168, 248,  253, 255 },
-	{ 5720, 59193, 2926,  127, 0, 127,  122, 229 },
-	{ 5720, 59193, 966,  127, 0, 127,  132, 229 },
-	{ 60659, 59193, 966,  127, 0, 127,  132, 25 },
-	{ 60738, 59160, 2926,  127, 127, 0,  18, 231 },
-	{ 60738, 6199, 2926,  127, 127, 0,  18, 22 },
-	{ 53343, 59160, 2926,  127, 127, 0,  47, 231 },
-	{ 52829, 59160, 2926,  127, 127, 0,  49, 231 },
-	{ 52829, 6199, 2926,  127, 127, 0,  49, 22 },
-	{ 45434, 59160, 2926,  127, 127, 0,  79, 231 },
-	{ 44919, 59160, 2926,  127, 127, 0,  81, 231 },
-	{ 44919, 6199, 2926,  127, 127, 0,  81, 22 },
-	{ 37525, 59160, 2926,  127, 127, 0,  110, 231 },
-	{ 29616, 6199, 2926,  127, 127, 0,  141, 22 },
-	{ 29616, 59160, 2926,  127, 127, 0,  141, 231 },
-	{ 37010, 59160, 2926,  127, 127, 0,  112, 231 },
-	{ 21706, 6199, 2926,  127, 127, 0,  173, 22 },
-	{ 21706, 59160, 2926,  127, 127, 0,  173, 231 },
-	{ 29101, 59160, 2926,  127, 127, 0,  143, 231 },
-	{ 21191, 59160, 2926,  127, 127, 0,  175, 231 },
-	{ 21191, 6199, 2926,  127, 127, 0,  175, 22 },
-	{ 13797, 59160, 2926,  127, 127, 0,  204, 231 },
-	{ 13282, 59160, 2926,  127, 127, 0,  206, 231 },
-	{ 13282, 6199, 2926,  127, 127, 0,  206, 22 },
-	{ 5888, 59160, 2926,  127, 127, 0,  235, 231 },
-	{ 60738, 59160, 4552,  127, 127, 255,  18, 231 },
-	{ 53343, 59160, 4552,  127, 127, 255,  47, 231 },
-	{ 53343, 6199, 4552,  127, 127, 255,  47, 22 },
-	{ 52829, 59160, 4552,  127, 127, 255,  49, 231 },
-	{ 45434, 59160, 4552,  127, 127, 255,  79, 231 },
-	{ 45434, 6199, 4552,  127, 127, 255,  79, 22 },
-	{ 44919, 59160, 4552,  127, 127, 255,  81, 231 },
-	{ 37525, 59160, 4552,  127, 127, 255,  110, 231 },
-	{ 37525, 6199, 4552,  127, 127, 255,  110, 22 },
-	{ 37010, 59160, 4552,  127, 127, 255,  112, 231 },
-	{ 29616, 59160, 4552,  127, 127, 255,  141, 231 },
-	{ 29616, 6199, 4552,  127, 127, 255,  141, 22 },
-	{ 21706, 6199, 4552,  127, 127, 255,  173, 22 },
-	{ 29101, 6199, 4552,  127, 127, 255,  143, 22 },
-	{ 21706, 59160, 4552,  127, 127, 255,  173, 231 },
-	{ 21191, 59160, 4552,  127, 127, 255,  175, 231 },
-	{ 13797, 59160, 4552,  127, 127, 255,  204, 231 },
-	{ 13797, 6199, 4552,  127, 127, 255,  204, 22 },
-	{ 13282, 59160, 4552,  127, 127, 255,  206, 231 },
-	{ 5888, 59160, 4552,  127, 127, 255,  235, 231 },
-	{ 5888, 6199, 4552,  127, 127, 255,  235, 22 },
-	{ 5888, 59160, 4552,  127, 255, 127,  235, 231 },
-	{ 13282, 59160, 4552,  127, 255, 127,  206, 231 },
-	{ 13282, 59160, 2926,  127, 255, 127,  206, 231 },
-	{ 13797, 6199, 2926,  127, 0, 127,  204, 22 },
-	{ 21191, 6199, 2926,  127, 0, 127,  175, 22 },
-	{ 13797, 6199, 4552,  127, 0, 127,  204, 22 },
-	{ 37010, 6199, 2926,  255, 127, 127,  112, 22 },
-	{ 37010, 59160, 2926,  255, 127, 127,  112, 231 },
-	{ 37010, 6199, 4552,  255, 127, 127,  112, 22 },
-	{ 37525, 6199, 4552,  0, 127, 127,  110, 22 },
-	{ 37525, 59160, 4552,  0, 127, 127,  110, 231 },
-	{ 37525, 59160, 2926,  0, 127, 127,  110, 231 },
-	{ 45434, 59160, 4552,  127, 255, 127,  79, 231 },
-	{ 52829, 59160, 4552,  127, 255, 127,  49, 231 },
-	{ 52829, 59160, 2926,  127, 255, 127,  49, 231 },
-	{ 53343, 6199, 2926,  127, 0, 127,  47, 22 },
-	{ 60738, 6199, 2926,  127, 0, 127,  18, 22 },
-	{ 53343, 6199, 4552,  127, 0, 127,  47, 22 },
-	{ 5888, 6199, 4552,  0, 127, 127,  235, 22 },
-	{ 5888, 59160, 4552,  0, 127, 127,  235, 231 },
-	{ 5888, 59160, 2926,  0, 127, 127,  235, 231 },
-	{ 13797, 59160, 4552,  127, 255, 127,  204, 231 },
-	{ 21191, 59160, 4552,  127, 255, 127,  175, 231 },
-	{ 21191, 59160, 2926,  127, 255, 127,  175, 231 },
-	{ 21706, 6199, 2926,  127, 0, 127,  173, 22 },
-	{ 29101, 6199, 2926,  127, 0, 127,  143, 22 },
-	{ 21706, 6199, 4552,  127, 0, 127,  173, 22 },
-	{ 44919, 6199, 2926,  255, 127, 127,  81, 22 },
-	{ 44919, 59160, 2926,  255, 127, 127,  81, 231 },
-	{ 44919, 6199, 4552,  255, 127, 127,  81, 22 },
-	{ 45434, 6199, 4552,  0, 127, 127,  79, 22 },
-	{ 45434, 59160, 4552,  0, 127, 127,  79, 231 },
-	{ 45434, 59160, 2926,  0, 127, 127,  79, 231 },
-	{ 53343, 59160, 4552,  127, 255, 127,  47, 231 },
-	{ 60738, 59160, 4552,  127, 255, 127,  18, 231 },
-	{ 60738, 59160, 2926,  127, 255, 127,  18, 231 },
-	{ 13282, 6199, 2926,  255, 127, 127,  206, 22 },
-	{ 13282, 59160, 2926,  255, 127, 127,  206, 231 },
-	{ 13282, 6199, 4552,  255, 127, 127,  206, 22 },
-	{ 13797, 6199, 4552,  0, 127, 127,  204, 22 },
-	{ 13797, 59160, 4552,  0, 127, 127,  204, 231 },
-	{ 13797, 59160, 2926,  0, 127, 127,  204, 231 },
-	{ 21706, 59160, 4552,  127, 255, 127,  173, 231 },
-	{ 29101, 59160, 4552,  127, 255, 127,  143, 231 },
-	{ 29101, 59160, 2926,  127, 255, 127,  143, 231 },
-	{ 29616, 6199, 2926,  127, 0, 127,  141, 22 },
-	{ 37010, 6199, 2926,  127, 0, 127,  112, 22 },
-	{ 29616, 6199, 4552,  127, 0, 127,  141, 22 },
-	{ 52829, 6199, 2926,  255, 127, 127,  49, 22 },
-	{ 52829, 59160, 2926,  255, 127, 127,  49, 231 },
-	{ 52829, 6199, 4552,  255, 127, 127,  49, 22 },
-	{ 53343, 6199, 4552,  0, 127, 127,  47, 22 },
-	{ 53343, 59160, 4552,  0, 127, 127,  47, 231 },
-	{ 53343, 59160, 2926,  0, 127, 127,  47, 231 },
-	{ 21191, 6199, 2926,  255, 127, 127,  175, 22 },
-	{ 21191, 59160, 2926,  255, 127, 127,  175, 231 },
-	{ 21191, 6199, 4552,  255, 127, 127,  175, 22 },
-	{ 21706, 6199, 4552,  0, 127, 127,  173, 22 },
-	{ 21706, 59160, 4552,  0, 127, 127,  173, 231 },
-	{ 21706, 59160, 2926,  0, 127, 127,  173, 231 },
-	{ 29616, 59160, 4552,  127, 255, 127,  141, 231 },
-	{ 37010, 59160, 4552,  127, 255, 127,  112, 231 },
-	{ 37010, 59160, 2926,  127, 255, 127,  112, 231 },
-	{ 37525, 6199, 2926,  127, 0, 127,  110, 22 },
-	{ 44919, 6199, 2926,  127, 0, 127,  81, 22 },
-	{ 37525, 6199, 4552,  127, 0, 127,  110, 22 },
-	{ 60738, 6199, 2926,  255, 127, 127,  18, 22 },
-	{ 60738, 59160, 2926,  255, 127, 127,  18, 231 },
-	{ 60738, 6199, 4552,  255, 127, 127,  18, 22 },
-	{ 5888, 6199, 2926,  127, 0, 127,  235, 22 },
-	{ 13282, 6199, 2926,  127, 0, 127,  206, 22 },
-	{ 5888, 6199, 4552,  127, 0, 127,  235, 22 },
-	{ 29101, 6199, 2926,  255, 127, 127,  143, 22 },
-	{ 29101, 59160, 2926,  255, 127, 127,  143, 231 },
-	{ 29101, 6199, 4552,  255, 127, 127,  143, 22 },
-	{ 29616, 6199, 4552,  0, 127, 127,  141, 22 },
-	{ 29616, 59160, 4552,  0, 127, 127,  141, 231 },
-	{ 29616, 59160, 2926,  0, 127, 127,  141, 231 },
-	{ 37525, 59160, 4552,  127, 255, 127,  110, 231 },
-	{ 44919, 59160, 4552,  127, 255, 127,  81, 231 },
-	{ 44919, 59160, 2926,  127, 255, 127,  81, 231 },
-	{ 45434, 6199, 2926,  127, 0, 127,  79, 22 },
-	{ 52829, 6199, 2926,  127, 0, 127,  49, 22 },
-	{ 45434, 6199, 4552,  127, 0, 127,  79, 22 },
-	{ 5665, 58783, 966,  127, 127, 0,  236, 230 },
-	{ 5665, 6622, 966,  127, 127, 0,  236, 23 },
-	{ 1081, 958, 966,  127, 127, 0,  255, 1 },
-	{ 54641, 6685, 577,  136, 135, 0,  110, 22 },
-	{ 6179, 54371, 399,  136, 135, 0,  110, 231 },
-	{ 12035, 58832, 1093,  136, 135, 0,  81, 231 },
-	{ 54516, 6597, 2196,  118, 119, 254,  110, 22 },
-	{ 60373, 11058, 2890,  118, 119, 254,  81, 22 },
-	{ 6054, 54283, 2018,  118, 119, 254,  110, 231 },
-	{ 6179, 54371, 399,  38, 36, 115,  131, 227 },
-	{ 54641, 6685, 577,  38, 36, 115,  131, 27 },
-	{ 6054, 54283, 2018,  38, 36, 115,  123, 227 },
-	{ 60497, 11146, 1271,  216, 218, 139,  131, 227 },
-	{ 12035, 58832, 1093,  216, 218, 139,  131, 27 },
-	{ 60373, 11058, 2890,  216, 218, 139,  123, 227 },
-	{ 54641, 6685, 577,  204, 26, 127,  110, 29 },
-	{ 60497, 11146, 1271,  204, 26, 127,  80, 29 },
-	{ 54516, 6597, 2196,  204, 26, 127,  110, 22 },
-	{ 6054, 54283, 2018,  50, 228, 127,  110, 231 },
-	{ 11910, 58744, 2712,  50, 228, 127,  81, 231 },
-	{ 12035, 58832, 1093,  50, 228, 127,  82, 225 },
-	{ 64882, 64967, 64975,  127, 255, 127,  0, 0 },
-	{ 58872, 64967, 60501,  127, 255, 127,  18, 24 },
-	{ 6710, 64967, 60501,  127, 255, 127,  18, 231 },
-	{ 694, 64967, 65135,  127, 255, 127,  0, 255 },
-	{ 6474, 64967, 60393,  127, 255, 127,  18, 232 },
-	{ 6474, 64967, 5454,  127, 255, 127,  236, 232 },
-	{ 65042, 64967, 949,  127, 255, 127,  254, 0 },
-	{ 59262, 64967, 5691,  127, 255, 127,  235, 22 },
-	{ 65042, 64967, 64898,  127, 255, 127,  0, 0 },
-	{ 59262, 63008, 60630,  168, 6, 127,  17, 22 },
-	{ 59262, 63008, 5691,  168, 6, 127,  235, 22 },
-	{ 65042, 64967, 64898,  168, 6, 127,  0, 0 },
-	{ 58872, 63008, 60501,  127, 127, 0,  122, 25 },
-	{ 6710, 63008, 60501,  127, 127, 0,  122, 229 },
-	{ 58872, 64967, 60501,  127, 127, 0,  132, 25 },
-	{ 59045, 63008, 5399,  127, 10, 76,  236, 23 },
-	{ 6884, 63008, 5399,  127, 10, 76,  236, 230 },
-	{ 873, 64967, 926,  127, 10, 76,  254, 254 },
-	{ 6884, 63008, 5399,  127, 127, 255,  122, 25 },
-	{ 59045, 63008, 5399,  127, 127, 255,  122, 229 },
-	{ 59045, 64967, 5399,  127, 127, 255,  132, 229 },
-	{ 59262, 63008, 5691,  0, 127, 127,  122, 25 },
-	{ 59262, 63008, 60630,  0, 127, 127,  122, 229 },
-	{ 59262, 64967, 5691,  0, 127, 127,  132, 25 },
-	{ 6710, 63008, 60501,  47, 127, 28,  18, 231 },
-	{ 1047, 64967, 65086,  47, 127, 28,  0, 253 },
-	{ 6710, 64967, 60501,  47, 127, 28,  18, 231 },
-	{ 6710, 63008, 60501,  127, 10, 177,  18, 231 },
-	{ 58872, 63008, 60501,  127, 10, 177,  18, 24 },
-	{ 1047, 64967, 65086,  127, 10, 177,  0, 253 },
-	{ 59262, 63008, 60630,  51, 127, 230,  17, 22 },
-	{ 65042, 64967, 64898,  51, 127, 230,  0, 0 },
-	{ 59262, 64967, 60630,  51, 127, 230,  17, 22 },
-	{ 6474, 63008, 5454,  86, 6, 127,  236, 232 },
-	{ 6474, 63008, 60393,  86, 6, 127,  18, 232 },
-	{ 694, 64967, 65135,  86, 6, 127,  0, 255 },
-	{ 59045, 63008, 5399,  207, 127, 226,  236, 23 },
-	{ 64709, 64967, 815,  207, 127, 226,  255, 1 },
-	{ 59045, 64967, 5399,  207, 127, 226,  236, 23 },
-	{ 6474, 63008, 60393,  255, 127, 127,  122, 25 },
-	{ 6474, 63008, 5454,  255, 127, 127,  122, 229 },
-	{ 6474, 64967, 5454,  255, 127, 127,  132, 229 },
-	{ 6474, 63008, 60393,  208, 127, 226,  18, 232 },
-	{ 6474, 64967, 60393,  208, 127, 226,  18, 232 },
-	{ 694, 64967, 65135,  208, 127, 226,  0, 255 },
-	{ 6474, 63008, 5454,  203, 127, 24,  236, 232 },
-	{ 694, 64967, 1186,  203, 127, 24,  253, 255 },
-	{ 6474, 64967, 5454,  203, 127, 24,  236, 232 },
-	{ 59262, 63008, 5691,  46, 127, 28,  235, 22 },
-	{ 59262, 64967, 5691,  46, 127, 28,  235, 22 },
-	{ 65042, 64967, 949,  46, 127, 28,  254, 0 },
-	{ 58872, 63008, 60501,  203, 127, 25,  18, 24 },
-	{ 58872, 64967, 60501,  203, 127, 25,  18, 24 },
-	{ 64882, 64967, 64975,  203, 127, 25,  0, 0 },
-	{ 6884, 63008, 5399,  51, 127, 229,  236, 230 },
-	{ 6884, 64967, 5399,  51, 127, 229,  236, 230 },
-	{ 873, 64967, 926,  51, 127, 229,  254, 254 },
-	{ 59468, 63008, 60472,  127, 255, 127,  18, 22 },
-	{ 59468, 63008, 53077,  127, 255, 127,  47, 22 },
-	{ 6507, 63008, 60472,  127, 255, 127,  18, 231 },
-	{ 59468, 63008, 52562,  127, 255, 127,  49, 22 },
-	{ 59468, 63008, 45168,  127, 255, 127,  79, 22 },
-	{ 6507, 63008, 52562,  127, 255, 127,  49, 231 },
-	{ 59468, 63008, 44653,  127, 255, 127,  81, 22 },
-	{ 59468, 63008, 37259,  127, 255, 127,  110, 22 },
-	{ 6507, 63008, 44653,  127, 255, 127,  81, 231 },
-	{ 59468, 63008, 36744,  127, 255, 127,  112, 22 },
-	{ 59468, 63008, 29349,  127, 255, 127,  141, 22 },
-	{ 6507, 63008, 36744,  127, 255, 127,  112, 231 },
-	{ 59468, 63008, 28835,  127, 255, 127,  143, 22 },
-	{ 59468, 63008, 21440,  127, 255, 127,  173, 22 },
-	{ 6507, 63008, 28835,  127, 255, 127,  143, 231 },
-	{ 59468, 63008, 20925,  127, 255, 127,  175, 22 },
-	{ 59468, 63008, 13531,  127, 255, 127,  204, 22 },
-	{ 6507, 63008, 20925,  127, 255, 127,  175, 231 },
-	{ 59468, 63008, 13016,  127, 255, 127,  206, 22 },
-	{ 59468, 63008, 5622,  127, 255, 127,  235, 22 },
-	{ 6507, 63008, 13016,  127, 255, 127,  206, 231 },
-	{ 59468, 61381, 60472,  127, 0, 127,  18, 22 },
-	{ 6507, 61381, 60472,  127, 0, 127,  18, 231 },
-	{ 6507, 61381, 53077,  127, 0, 127,  47, 231 },
-	{ 59468, 61381, 52562,  127, 0, 127,  49, 22 },
-	{ 6507, 61381, 52562,  127, 0, 127,  49, 231 },
-	{ 6507, 61381, 45168,  127, 0, 127,  79, 231 },
-	{ 59468, 61381, 44653,  127, 0, 127,  81, 22 },
-	{ 6507, 61381, 44653,  127, 0, 127,  81, 231 },
-	{ 6507, 61381, 37259,  127, 0, 127,  110, 231 },
-	{ 59468, 61381, 36744,  127, 0, 127,  112, 22 },
-	{ 6507, 61381, 36744,  127, 0, 127,  112, 231 },
-	{ 6507, 61381, 29349,  127, 0, 127,  141, 231 },
-	{ 59468, 61381, 28835,  127, 0, 127,  143, 22 },
-	{ 6507, 61381, 28835,  127, 0, 127,  143, 231 },
-	{ 6507, 61381, 21440,  127, 0, 127,  173, 231 },
-	{ 59468, 61381, 20925,  127, 0, 127,  175, 22 },
-	{ 6507, 61381, 20925,  127, 0, 127,  175, 231 },
-	{ 6507, 61381, 13531,  127, 0, 127,  204, 231 },
-	{ 59468, 61381, 13016,  127, 0, 127,  206, 22 },
-	{ 6507, 61381, 13016,  127, 0, 127,  206, 231 },
-	{ 6507, 61381, 5622,  127, 0, 127,  235, 231 },
-	{ 6507, 63008, 5622,  0, 127, 127,  235, 231 },
-	{ 6507, 61381, 5622,  0, 127, 127,  235, 231 },
-	{ 6507, 63008, 13016,  0, 127, 127,  206, 231 },
-	{ 59468, 63008, 20925,  255, 127, 127,  175, 22 },
-	{ 59468, 61381, 20925,  255, 127, 127,  175, 22 },
-	{ 59468, 61381, 13531,  255, 127, 127,  204, 22 },
-	{ 6507, 63008, 36744,  127, 127, 255,  112, 231 },
-	{ 6507, 61381, 36744,  127, 127, 255,  112, 231 },
-	{ 59468, 63008, 36744,  127, 127, 255,  112, 22 },
-	{ 59468, 63008, 37259,  127, 127, 0,  110, 22 },
-	{ 59468, 61381, 37259,  127, 127, 0,  110, 22 },
-	{ 6507, 61381, 37259,  127, 127, 0,  110, 231 },
-	{ 6507, 63008, 45168,  0, 127, 127,  79, 231 },
-	{ 6507, 61381, 45168,  0, 127, 127,  79, 231 },
-	{ 6507, 63008, 52562,  0, 127, 127,  49, 231 },
-	{ 59468, 63008, 60472,  255, 127, 127,  18, 22 },
-	{ 59468, 61381, 60472,  255, 127, 127,  18, 22 },
-	{ 59468, 61381, 53077,  255, 127, 127,  47, 22 },
-	{ 59468, 63008, 5622,  127, 127, 0,  235, 22 },
-	{ 59468, 61381, 5622,  127, 127, 0,  235, 22 },
-	{ 6507, 61381, 5622,  127, 127, 0,  235, 231 },
-	{ 6507, 63008, 13531,  0, 127, 127,  204, 231 },
-	{ 6507, 61381, 13531,  0, 127, 127,  204, 231 },
-	{ 6507, 63008, 20925,  0, 127, 127,  175, 231 },
-	{ 59468, 63008, 28835,  255, 127, 127,  143, 22 },
-	{ 59468, 61381, 28835,  255, 127, 127,  143, 22 },
-	{ 59468, 63008, 21440,  255, 127, 127,  173, 22 },
-	{ 6507, 63008, 44653,  127, 127, 255,  81, 231 },
-	{ 6507, 61381, 44653,  127, 127, 255,  81, 231 },
-	{ 59468, 63008, 44653,  127, 127, 255,  81, 22 },
-	{ 59468, 63008, 45168,  127, 127, 0,  79, 22 },
-	{ 59468, 61381, 45168,  127, 127, 0,  79, 22 },
-	{ 6507, 61381, 45168,  127, 127, 0,  79, 231 },
-	{ 6507, 63008, 53077,  0, 127, 127,  47, 231 },
-	{ 6507, 61381, 53077,  0, 127, 127,  47, 231 },
-	{ 6507, 63008, 60472,  0, 127, 127,  18, 231 },
-	{ 6507, 63008, 13016,  127, 127, 255,  206, 231 },
-	{ 6507, 61381, 13016,  127, 127, 255,  206, 231 },
-	{ 59468, 63008, 13016,  127, 127, 255,  206, 22 },
-	{ 59468, 63008, 13531,  127, 127, 0,  204, 22 },
-	{ 59468, 61381, 13531,  127, 127, 0,  204, 22 },
-	{ 6507, 61381, 13531,  127, 127, 0,  204, 231 },
-	{ 6507, 63008, 21440,  0, 127, 127,  173, 231 },
-	{ 6507, 61381, 21440,  0, 127, 127,  173, 231 },
-	{ 6507, 63008, 28835,  0, 127, 127,  143, 231 },
-	{ 59468, 63008, 36744,  255, 127, 127,  112, 22 },
-	{ 59468, 61381, 36744,  255, 127, 127,  112, 22 },
-	{ 59468, 61381, 29349,  255, 127, 127,  141, 22 },
-	{ 6507, 63008, 52562,  127, 127, 255,  49, 231 },
-	{ 6507, 61381, 52562,  127, 127, 255,  49, 231 },
-	{ 59468, 63008, 52562,  127, 127, 255,  49, 22 },
-	{ 59468, 63008, 53077,  127, 127, 0,  47, 22 },
-	{ 59468, 61381, 53077,  127, 127, 0,  47, 22 },
-	{ 6507, 61381, 53077,  127, 127, 0,  47, 231 },
-	{ 6507, 63008, 20925,  127, 127, 255,  175, 231 },
-	{ 6507, 61381, 20925,  127, 127, 255,  175, 231 },
-	{ 59468, 63008, 20925,  127, 127, 255,  175, 22 },
-	{ 59468, 63008, 21440,  127, 127, 0,  173, 22 },
-	{ 59468, 61381, 21440,  127, 127, 0,  173, 22 },
-	{ 6507, 61381, 21440,  127, 127, 0,  173, 231 },
-	{ 6507, 63008, 29349,  0, 127, 127,  141, 231 },
-	{ 6507, 61381, 29349,  0, 127, 127,  141, 231 },
-	{ 6507, 63008, 36744,  0, 127, 127,  112, 231 },
-	{ 59468, 63008, 44653,  255, 127, 127,  81, 22 },
-	{ 59468, 61381, 44653,  255, 127, 127,  81, 22 },
-	{ 59468, 61381, 37259,  255, 127, 127,  110, 22 },
-	{ 6507, 63008, 60472,  127, 127, 255,  18, 231 },
-	{ 6507, 61381, 60472,  127, 127, 255,  18, 231 },
-	{ 59468, 63008, 60472,  127, 127, 255,  18, 22 },
-	{ 59468, 63008, 13016,  255, 127, 127,  206, 22 },
-	{ 59468, 61381, 13016,  255, 127, 127,  206, 22 },
-	{ 59468, 61381, 5622,  255, 127, 127,  235, 22 },
-	{ 6507, 63008, 28835,  127, 127, 255,  143, 231 },
-	{ 6507, 61381, 28835,  127, 127, 255,  143, 231 },
-	{ 59468, 63008, 28835,  127, 127, 255,  143, 22 },
-	{ 59468, 63008, 29349,  127, 127, 0,  141, 22 },
-	{ 59468, 61381, 29349,  127, 127, 0,  141, 22 },
-	{ 6507, 61381, 29349,  127, 127, 0,  141, 231 },
-	{ 6507, 63008, 37259,  0, 127, 127,  110, 231 },
-	{ 6507, 61381, 37259,  0, 127, 127,  110, 231 },
-	{ 6507, 63008, 44653,  0, 127, 127,  81, 231 },
-	{ 59468, 63008, 52562,  255, 127, 127,  49, 22 },
-	{ 59468, 61381, 52562,  255, 127, 127,  49, 22 },
-	{ 59468, 61381, 45168,  255, 127, 127,  79, 22 },
-	{ 873, 64967, 926,  127, 255, 127,  254, 254 },
-	{ 6884, 64967, 5399,  127, 255, 127,  236, 230 },
-	{ 64709, 64967, 815,  127, 255, 127,  255, 1 },
-	{ 54521, 64663, 60231,  119, 254, 136,  81, 22 },
-	{ 58982, 65357, 54375,  119, 254, 136,  110, 22 },
-	{ 11296, 65534, 5912,  119, 254, 136,  110, 231 },
-	{ 54609, 63043, 60106,  135, 0, 118,  81, 22 },
-	{ 6923, 63221, 11644,  135, 0, 118,  81, 231 },
-	{ 59070, 63737, 54250,  135, 0, 118,  110, 22 },
-	{ 58982, 65357, 54375,  218, 139, 38,  131, 27 },
-	{ 59070, 63737, 54250,  218, 139, 38,  123, 27 },
-	{ 11296, 65534, 5912,  218, 139, 38,  131, 227 },
-	{ 6835, 64841, 11769,  36, 115, 216,  131, 27 },
-	{ 6923, 63221, 11644,  36, 115, 216,  123, 27 },
-	{ 54521, 64663, 60231,  36, 115, 216,  131, 227 },
-	{ 54521, 64663, 60231,  228, 127, 204,  80, 29 },
-	{ 54609, 63043, 60106,  228, 127, 204,  81, 22 },
-	{ 59070, 63737, 54250,  228, 127, 204,  110, 22 },
-	{ 11296, 65534, 5912,  26, 127, 50,  109, 226 },
-	{ 11384, 63915, 5788,  26, 127, 50,  110, 231 },
-	{ 6835, 64841, 11769,  26, 127, 50,  82, 225 },
-	{ 1047, 64967, 65086,  127, 255, 127,  0, 253 },
-	{ 64882, 64967, 64975,  127, 255, 127,  0, 0 },
-	{ 6710, 64967, 60501,  127, 255, 127,  18, 231 },
-	{ 694, 64967, 1186,  127, 255, 127,  253, 255 },
-	{ 694, 64967, 65135,  127, 255, 127,  0, 255 },
-	{ 6474, 64967, 5454,  127, 255, 127,  236, 232 },
-	{ 59262, 64967, 5691,  127, 255, 127,  235, 22 },
-	{ 59262, 64967, 60630,  127, 255, 127,  17, 22 },
-	{ 65042, 64967, 64898,  127, 255, 127,  0, 0 },
-	{ 59262, 63008, 5691,  168, 6, 127,  235, 22 },
-	{ 65042, 64967, 949,  168, 6, 127,  254, 0 },
-	{ 65042, 64967, 64898,  168, 6, 127,  0, 0 },
-	{ 6710, 63008, 60501,  127, 127, 0,  122, 229 },
-	{ 6710, 64967, 60501,  127, 127, 0,  132, 229 },
-	{ 58872, 64967, 60501,  127, 127, 0,  132, 25 },
-	{ 64709, 64967, 815,  127, 10, 77,  255, 1 },
-	{ 59045, 63008, 5399,  127, 10, 77,  236, 23 },
-	{ 873, 64967, 926,  127, 10, 77,  254, 254 },
-	{ 6884, 64967, 5399,  127, 127, 255,  132, 25 },
-	{ 6884, 63008, 5399,  127, 127, 255,  122, 25 },
-	{ 59045, 64967, 5399,  127, 127, 255,  132, 229 },
-	{ 59262, 63008, 60630,  0, 127, 127,  122, 229 },
-	{ 59262, 64967, 60630,  0, 127, 127,  132, 229 },
-	{ 59262, 64967, 5691,  0, 127, 127,  132, 25 },
-	{ 58872, 63008, 60501,  127, 10, 178,  18, 24 },
-	{ 64882, 64967, 64975,  127, 10, 178,  0, 0 },
-	{ 1047, 64967, 65086,  127, 10, 178,  0, 253 },
-	{ 694, 64967, 1186,  86, 6, 127,  253, 255 },
-	{ 6474, 63008, 5454,  86, 6, 127,  236, 232 },
-	{ 694, 64967, 65135,  86, 6, 127,  0, 255 },
-	{ 6474, 64967, 60393,  255, 127, 127,  132, 25 },
-	{ 6474, 63008, 60393,  255, 127, 127,  122, 25 },
-	{ 6474, 64967, 5454,  255, 127, 127,  132, 229 },
-	{ 59468, 63008, 53077,  127, 255, 127,  47, 22 },
-	{ 6507, 63008, 53077,  127, 255, 127,  47, 231 },
-	{ 6507, 63008, 60472,  127, 255, 127,  18, 231 },
-	{ 59468, 63008, 45168,  127, 255, 127,  79, 22 },
-	{ 6507, 63008, 45168,  127, 255, 127,  79, 231 },
-	{ 6507, 63008, 52562,  127, 255, 127,  49, 231 },
-	{ 59468, 63008, 37259,  127, 255, 127,  110, 22 },
-	{ 6507, 63008, 37259,  127, 255, 127,  110, 231 },
-	{ 6507, 63008, 44653,  127, 255, 127,  81, 231 },
-	{ 59468, 63008, 29349,  127, 255, 127,  141, 22 },
-	{ 6507, 63008, 29349,  127, 255, 127,  141, 231 },
-	{ 6507, 63008, 36744,  127, 255, 127,  112, 231 },
-	{ 59468, 63008, 21440,  127, 255, 127,  173, 22 },
-	{ 6507, 63008, 21440,  127, 255, 127,  173, 231 },
-	{ 6507, 63008, 28835,  127, 255, 127,  143, 231 },
-	{ 59468, 63008, 13531,  127, 255, 127,  204, 22 },
-	{ 6507, 63008, 13531,  127, 255, 127,  204, 231 },
-	{ 6507, 63008, 20925,  127, 255, 127,  175, 231 },
-	{ 59468, 63008, 5622,  127, 255, 127,  235, 22 },
-	{ 6507, 63008, 5622,  127, 255, 127,  235, 231 },
-	{ 6507, 63008, 13016,  127, 255, 127,  206, 231 },
-	{ 59468, 61381, 53077,  127, 0, 127,  47, 22 },
-	{ 59468, 61381, 60472,  127, 0, 127,  18, 22 },
-	{ 6507, 61381, 53077,  127, 0, 127,  47, 231 },
-	{ 59468, 61381, 45168,  127, 0, 127,  79, 22 },
-	{ 59468, 61381, 52562,  127, 0, 127,  49, 22 },
-	{ 6507, 61381, 45168,  127, 0, 127,  79, 231 },
-	{ 59468, 61381, 37259,  127, 0, 127,  110, 22 },
-	{ 59468, 61381, 44653,  127, 0, 127,  81, 22 },
-	{ 6507, 61381, 37259,  127, 0, 127,  110, 231 },
-	{ 59468, 61381, 29349,  127, 0, 127,  141, 22 },
-	{ 59468, 61381, 36744,  127, 0, 127,  112, 22 },
-	{ 6507, 61381, 29349,  127, 0, 127,  141, 231 },
-	{ 59468, 61381, 21440,  127, 0, 127,  173, 22 },
-	{ 59468, 61381, 28835,  127, 0, 127,  143, 22 },
-	{ 6507, 61381, 21440,  127, 0, 127,  173, 231 },
-	{ 59468, 61381, 13531,  127, 0, 127,  204, 22 },
-	{ 59468, 61381, 20925,  127, 0, 127,  175, 22 },
-	{ 6507, 61381, 13531,  127, 0, 127,  204, 231 },
-	{ 59468, 61381, 5622,  127, 0, 127,  235, 22 },
-	{ 59468, 61381, 13016,  127, 0, 127,  206, 22 },
-	{ 6507, 61381, 5622,  127, 0, 127,  235, 231 },
-	{ 6507, 61381, 5622,  0, 127, 127,  235, 231 },
-	{ 6507, 61381, 13016,  0, 127, 127,  206, 231 },
-	{ 6507, 63008, 13016,  0, 127, 127,  206, 231 },
-	{ 59468, 63008, 13531,  255, 127, 127,  204, 22 },
-	{ 59468, 63008, 20925,  255, 127, 127,  175, 22 },
-	{ 59468, 61381, 13531,  255, 127, 127,  204, 22 },
-	{ 6507, 61381, 36744,  127, 127, 255,  112, 231 },
-	{ 59468, 61381, 36744,  127, 127, 255,  112, 22 },
-	{ 59468, 63008, 36744,  127, 127, 255,  112, 22 },
-	{ 6507, 63008, 37259,  127, 127, 0,  110, 231 },
-	{ 59468, 63008, 37259,  127, 127, 0,  110, 22 },
-	{ 6507, 61381, 37259,  127, 127, 0,  110, 231 },
-	{ 6507, 61381, 45168,  0, 127, 127,  79, 231 },
-	{ 6507, 61381, 52562,  0, 127, 127,  49, 231 },
-	{ 6507, 63008, 52562,  0, 127, 127,  49, 231 },
-	{ 59468, 63008, 53077,  255, 127, 127,  47, 22 },
-	{ 59468, 63008, 60472,  255, 127, 127,  18, 22 },
-	{ 59468, 61381, 53077,  255, 127, 127,  47, 22 },
-	{ 6507, 63008, 5622,  127, 127, 0,  235, 231 },
-	{ 59468, 63008, 5622,  127, 127, 0,  235, 22 },
-	{ 6507, 61381, 5622,  127, 127, 0,  235, 231 },
-	{ 6507, 61381, 13531,  0, 127, 127,  204, 231 },
-	{ 6507, 61381, 20925,  0, 127, 127,  175, 231 },
-	{ 6507, 63008, 20925,  0, 127, 127,  175, 231 },
-	{ 59468, 61381, 28835,  255, 127, 127,  143, 22 },
-	{ 59468, 61381, 21440,  255, 127, 127,  173, 22 },
-	{ 59468, 63008, 21440,  255, 127, 127,  173, 22 },
-	{ 6507, 61381, 44653,  127, 127, 255,  81, 231 },
-	{ 59468, 61381, 44653,  127, 127, 255,  81, 22 },
-	{ 59468, 63008, 44653,  127, 127, 255,  81, 22 },
-	{ 6507, 63008, 45168,  127, 127, 0,  79, 231 },
-	{ 59468, 63008, 45168,  127, 127, 0,  79, 22 },
-	{ 6507, 61381, 45168,  127, 127, 0,  79, 231 },
-	{ 6507, 61381, 53077,  0, 127, 127,  47, 231 },
-	{ 6507, 61381, 60472,  0, 127, 127,  18, 231 },
-	{ 6507, 63008, 60472,  0, 127, 127,  18, 231 },
-	{ 6507, 61381, 13016,  127, 127, 255,  206, 231 },
-	{ 59468, 61381, 13016,  127, 127, 255,  206, 22 },
-	{ 59468, 63008, 13016,  127, 127, 255,  206, 22 },
-	{ 6507, 63008, 13531,  127, 127, 0,  204, 231 },
-	{ 59468, 63008, 13531,  127, 127, 0,  204, 22 },
-	{ 6507, 61381, 13531,  127, 127, 0,  204, 231 },
-	{ 6507, 61381, 21440,  0, 127, 127,  173, 231 },
-	{ 6507, 61381, 28835,  0, 127, 127,  143, 231 },
-	{ 6507, 63008, 28835,  0, 127, 127,  143, 231 },
-	{ 59468, 63008, 29349,  255, 127, 127,  141, 22 },
-	{ 59468, 63008, 36744,  255, 127, 127,  112, 22 },
-	{ 59468, 61381, 29349,  255, 127, 127,  141, 22 },
-	{ 6507, 61381, 52562,  127, 127, 255,  49, 231 },
-	{ 59468, 61381, 52562,  127, 127, 255,  49, 22 },
-	{ 59468, 63008, 52562,  127, 127, 255,  49, 22 },
-	{ 6507, 63008, 53077,  127, 127, 0,  47, 231 },
-	{ 59468, 63008, 53077,  127, 127, 0,  47, 22 },
-	{ 6507, 61381, 53077,  127, 127, 0,  47, 231 },
-	{ 6507, 61381, 20925,  127, 127, 255,  175, 231 },
-	{ 59468, 61381, 20925,  127, 127, 255,  175, 22 },
-	{ 59468, 63008, 20925,  127, 127, 255,  175, 22 },
-	{ 6507, 63008, 21440,  127, 127, 0,  173, 231 },
-	{ 59468, 63008, 21440,  127, 127, 0,  173, 22 },
-	{ 6507, 61381, 21440,  127, 127, 0,  173, 231 },
-	{ 6507, 61381, 29349,  0, 127, 127,  141, 231 },
-	{ 6507, 61381, 36744,  0, 127, 127,  112, 231 },
-	{ 6507, 63008, 36744,  0, 127, 127,  112, 231 },
-	{ 59468, 63008, 37259,  255, 127, 127,  110, 22 },
-	{ 59468, 63008, 44653,  255, 127, 127,  81, 22 },
-	{ 59468, 61381, 37259,  255, 127, 127,  110, 22 },
-	{ 6507, 61381, 60472,  127, 127, 255,  18, 231 },
-	{ 59468, 61381, 60472,  127, 127, 255,  18, 22 },
-	{ 59468, 63008, 60472,  127, 127, 255,  18, 22 },
-	{ 59468, 63008, 5622,  255, 127, 127,  235, 22 },
-	{ 59468, 63008, 13016,  255, 127, 127,  206, 22 },
-	{ 59468, 61381, 5622,  255, 127, 127,  235, 22 },
-	{ 6507, 61381, 28835,  127, 127, 255,  143, 231 },
-	{ 59468, 61381, 28835,  127, 127, 255,  143, 22 },
-	{ 59468, 63008, 28835,  127, 127, 255,  143, 22 },
-	{ 6507, 63008, 29349,  127, 127, 0,  141, 231 },
-	{ 59468, 63008, 29349,  127, 127, 0,  141, 22 },
-	{ 6507, 61381, 29349,  127, 127, 0,  141, 231 },
-	{ 6507, 61381, 37259,  0, 127, 127,  110, 231 },
-	{ 6507, 61381, 44653,  0, 127, 127,  81, 231 },
-	{ 6507, 63008, 44653,  0, 127, 127,  81, 231 },
-	{ 59468, 63008, 45168,  255, 127, 127,  79, 22 },
-	{ 59468, 63008, 52562,  255, 127, 127,  49, 22 },
-	{ 59468, 61381, 45168,  255, 127, 127,  79, 22 },
-	{ 6884, 64967, 5399,  127, 255, 127,  236, 230 },
-	{ 59045, 64967, 5399,  127, 255, 127,  236, 23 },
-	{ 64709, 64967, 815,  127, 255, 127,  255, 1 },
-	{ 6835, 64841, 11769,  119, 254, 136,  81, 231 },
-	{ 54521, 64663, 60231,  119, 254, 136,  81, 22 },
-	{ 11296, 65534, 5912,  119, 254, 136,  110, 231 },
-	{ 6923, 63221, 11644,  135, 0, 118,  81, 231 },
-	{ 11384, 63915, 5788,  135, 0, 118,  110, 231 },
-	{ 59070, 63737, 54250,  135, 0, 118,  110, 22 },
-	{ 59070, 63737, 54250,  218, 139, 38,  123, 27 },
-	{ 11384, 63915, 5788,  218, 139, 38,  123, 227 },
-	{ 11296, 65534, 5912,  218, 139, 38,  131, 227 },
-	{ 6923, 63221, 11644,  36, 115, 216,  123, 27 },
-	{ 54609, 63043, 60106,  36, 115, 216,  123, 227 },
-	{ 54521, 64663, 60231,  36, 115, 216,  131, 227 },
-	{ 58982, 65357, 54375,  228, 127, 204,  110, 29 },
-	{ 54521, 64663, 60231,  228, 127, 204,  80, 29 },
-	{ 59070, 63737, 54250,  228, 127, 204,  110, 22 },
-	{ 11384, 63915, 5788,  26, 127, 50,  110, 231 },
-	{ 6923, 63221, 11644,  26, 127, 50,  81, 231 },
-	{ 6835, 64841, 11769,  26, 127, 50,  82, 225 },
-	{ 700, 64680, 64975,  0, 127, 127,  0, 0 },
-	{ 700, 58670, 60501,  0, 127, 127,  18, 24 },
-	{ 700, 6508, 60501,  0, 127, 127,  18, 231 },
-	{ 700, 492, 65135,  0, 127, 127,  0, 255 },
-	{ 700, 6272, 60393,  0, 127, 127,  18, 232 },
-	{ 700, 6272, 5454,  0, 127, 127,  236, 232 },
-	{ 700, 64840, 949,  0, 127, 127,  254, 0 },
-	{ 700, 59060, 5691,  0, 127, 127,  235, 22 },
-	{ 700, 59060, 60630,  0, 127, 127,  17, 22 },
-	{ 2659, 59060, 60630,  248, 168, 127,  17, 22 },
-	{ 2659, 59060, 5691,  248, 168, 127,  235, 22 },
-	{ 700, 64840, 64898,  248, 168, 127,  0, 0 },
-	{ 2659, 58670, 60501,  127, 127, 0,  122, 25 },
-	{ 2660, 6508, 60501,  127, 127, 0,  122, 229 },
-	{ 700, 6508, 60501,  127, 127, 0,  132, 229 },
-	{ 2659, 58843, 5399,  244, 127, 77,  236, 23 },
-	{ 2659, 6682, 5399,  244, 127, 77,  236, 230 },
-	{ 700, 64507, 815,  244, 127, 77,  255, 1 },
-	{ 2659, 6682, 5399,  127, 127, 255,  122, 25 },
-	{ 2659, 58843, 5399,  127, 127, 255,  122, 229 },
-	{ 700, 58843, 5399,  127, 127, 255,  132, 229 },
-	{ 2659, 59060, 5691,  127, 0, 127,  122, 25 },
-	{ 2659, 59060, 60630,  127, 0, 127,  122, 229 },
-	{ 700, 59060, 60630,  127, 0, 127,  132, 229 },
-	{ 2660, 6508, 60501,  127, 47, 28,  18, 231 },
-	{ 700, 845, 65086,  127, 47, 28,  0, 253 },
-	{ 700, 6508, 60501,  127, 47, 28,  18, 231 },
-	{ 2660, 6508, 60501,  244, 127, 177,  18, 231 },
-	{ 2659, 58670, 60501,  244, 127, 177,  18, 24 },
-	{ 700, 845, 65086,  244, 127, 177,  0, 253 },
-	{ 2659, 59060, 60630,  127, 51, 230,  17, 22 },
-	{ 700, 64840, 64898,  127, 51, 230,  0, 0 },
-	{ 700, 59060, 60630,  127, 51, 230,  17, 22 },
-	{ 2660, 6272, 5454,  248, 86, 127,  236, 232 },
-	{ 2659, 6272, 60393,  248, 86, 127,  18, 232 },
-	{ 700, 492, 1186,  248, 86, 127,  253, 255 },
-	{ 2659, 58843, 5399,  127, 207, 226,  236, 23 },
-	{ 700, 64507, 815,  127, 207, 226,  255, 1 },
-	{ 700, 58843, 5399,  127, 207, 226,  236, 23 },
-	{ 2659, 6272, 60393,  127, 255, 127,  122, 25 },
-	{ 2660, 6272, 5454,  127, 255, 127,  122, 229 },
-	{ 700, 6272, 5454,  127, 255, 127,  132, 229 },
-	{ 2659, 6272, 60393,  127, 208, 226,  18, 232 },
-	{ 700, 6272, 60393,  127, 208, 226,  18, 232 },
-	{ 700, 492, 65135,  127, 208, 226,  0, 255 },
-	{ 2660, 6272, 5454,  127, 203, 24,  236, 232 },
-	{ 700, 492, 1186,  127, 203, 24,  253, 255 },
-	{ 700, 6272, 5454,  127, 203, 24,  236, 232 },
-	{ 2659, 59060, 5691,  127, 46, 28,  235, 22 },
-	{ 700, 59060, 5691,  127, 46, 28,  235, 22 },
-	{ 700, 64840, 949,  127, 46, 28,  254, 0 },
-	{ 2659, 58670, 60501,  127, 203, 25,  18, 24 },
-	{ 700, 58670, 60501,  127, 203, 25,  18, 24 },
-	{ 700, 64680, 64975,  127, 203, 25,  0, 0 },
-	{ 2659, 6682, 5399,  127, 51, 229,  236, 230 },
-	{ 700, 6682, 5399,  127, 51, 229,  236, 230 },
-	{ 700, 671, 926,  127, 51, 229,  254, 254 },
-	{ 2659, 59266, 60472,  0, 127, 127,  18, 22 },
-	{ 2659, 59266, 53077,  0, 127, 127,  47, 22 },
-	{ 2660, 6305, 60472,  0, 127, 127,  18, 231 },
-	{ 2659, 59266, 52562,  0, 127, 127,  49, 22 },
-	{ 2659, 59266, 45168,  0, 127, 127,  79, 22 },
-	{ 2660, 6305, 52562,  0, 127, 127,  49, 231 },
-	{ 2659, 59266, 44653,  0, 127, 127,  81, 22 },
-	{ 2659, 59266, 37259,  0, 127, 127,  110, 22 },
-	{ 2660, 6305, 44653,  0, 127, 127,  81, 231 },
-	{ 2659, 59266, 36744,  0, 127, 127,  112, 22 },
-	{ 2659, 59266, 29349,  0, 127, 127,  141, 22 },
-	{ 2660, 6305, 36744,  0, 127, 127,  112, 231 },
-	{ 2659, 59266, 28835,  0, 127, 127,  143, 22 },
-	{ 2659, 59266, 21440,  0, 127, 127,  173, 22 },
-	{ 2660, 6305, 28835,  0, 127, 127,  143, 231 },
-	{ 2659, 59266, 20925,  0, 127, 127,  175, 22 },
-	{ 2659, 59266, 13531,  0, 127, 127,  204, 22 },
-	{ 2660, 6305, 20925,  0, 127, 127,  175, 231 },
-	{ 2659, 59266, 13016,  0, 127, 127,  206, 22 },
-	{ 2659, 59266, 5622,  0, 127, 127,  235, 22 },
-	{ 2660, 6305, 13016,  0, 127, 127,  206, 231 },
-	{ 4286, 59266, 60472,  255, 127, 127,  18, 22 },
-	{ 4286, 6305, 60472,  255, 127, 127,  18, 231 },
-	{ 4286, 6305, 53077,  255, 127, 127,  47, 231 },
-	{ 4286, 59266, 52562,  255, 127, 127,  49, 22 },
-	{ 4286, 6305, 52562,  255, 127, 127,  49, 231 },
-	{ 4286, 6305, 45168,  255, 127, 127,  79, 231 },
-	{ 4286, 59266, 44653,  255, 127, 127,  81, 22 },
-	{ 4286, 6305, 44653,  255, 127, 127,  81, 231 },
-	{ 4286, 6305, 37259,  255, 127, 127,  110, 231 },
-	{ 4286, 59266, 36744,  255, 127, 127,  112, 22 },
-	{ 4286, 6305, 36744,  255, 127, 127,  112, 231 },
-	{ 4286, 6305, 29349,  255, 127, 127,  141, 231 },
-	{ 4286, 59266, 28835,  255, 127, 127,  143, 22 },
-	{ 4286, 6305, 28835,  255, 127, 127,  143, 231 },
-	{ 4286, 6305, 21440,  255, 127, 127,  173, 231 },
-	{ 4286, 59266, 20925,  255, 127, 127,  175, 22 },
-	{ 4286, 6305, 20925,  255, 127, 127,  175, 231 },
-	{ 4286, 6305, 13531,  255, 127, 127,  204, 231 },
-	{ 4286, 59266, 13016,  255, 127, 127,  206, 22 },
-	{ 4286, 6305, 13016,  255, 127, 127,  206, 231 },
-	{ 4286, 6305, 5622,  255, 127, 127,  235, 231 },
-	{ 2660, 6305, 5622,  127, 0, 127,  235, 231 },
-	{ 4286, 6305, 5622,  127, 0, 127,  235, 231 },
-	{ 2660, 6305, 13016,  127, 0, 127,  206, 231 },
-	{ 2659, 59266, 20925,  127, 255, 127,  175, 22 },
-	{ 4286, 59266, 20925,  127, 255, 127,  175, 22 },
-	{ 2659, 59266, 13531,  127, 255, 127,  204, 22 },
-	{ 2660, 6305, 36744,  127, 127, 255,  112, 231 },
-	{ 4286, 6305, 36744,  127, 127, 255,  112, 231 },
-	{ 4286, 59266, 36744,  127, 127, 255,  112, 22 },
-	{ 2659, 59266, 37259,  127, 127, 0,  110, 22 },
-	{ 4286, 59266, 37259,  127, 127, 0,  110, 22 },
-	{ 2660, 6305, 37259,  127, 127, 0,  110, 231 },
-	{ 2660, 6305, 45168,  127, 0, 127,  79, 231 },
-	{ 4286, 6305, 45168,  127, 0, 127,  79, 231 },
-	{ 2660, 6305, 52562,  127, 0, 127,  49, 231 },
-	{ 2659, 59266, 60472,  127, 255, 127,  18, 22 },
-	{ 4286, 59266, 60472,  127, 255, 127,  18, 22 },
-	{ 2659, 59266, 53077,  127, 255, 127,  47, 22 },
-	{ 2659, 59266, 5622,  127, 127, 0,  235, 22 },
-	{ 4286, 59266, 5622,  127, 127, 0,  235, 22 },
-	{ 4286, 6305, 5622,  127, 127, 0,  235, 231 },
-	{ 2660, 6305, 13531,  127, 0, 127,  204, 231 },
-	{ 4286, 6305, 13531,  127, 0, 127,  204, 231 },
-	{ 2660, 6305, 20925,  127, 0, 127,  175, 231 },
-	{ 2659, 59266, 28835,  127, 255, 127,  143, 22 },
-	{ 4286, 59266, 28835,  127, 255, 127,  143, 22 },
-	{ 4286, 59266, 21440,  127, 255, 127,  173, 22 },
-	{ 2660, 6305, 44653,  127, 127, 255,  81, 231 },
-	{ 4286, 6305, 44653,  127, 127, 255,  81, 231 },
-	{ 4286, 59266, 44653,  127, 127, 255,  81, 22 },
-	{ 2659, 59266, 45168,  127, 127, 0,  79, 22 },
-	{ 4286, 59266, 45168,  127, 127, 0,  79, 22 },
-	{ 2660, 6305, 45168,  127, 127, 0,  79, 231 },
-	{ 2660, 6305, 53077,  127, 0, 127,  47, 231 },
-	{ 4286, 6305, 53077,  127, 0, 127,  47, 231 },
-	{ 2660, 6305, 60472,  127, 0, 127,  18, 231 },
-	{ 2660, 6305, 13016,  127, 127, 255,  206, 231 },
-	{ 4286, 6305, 13016,  127, 127, 255,  206, 231 },
-	{ 4286, 59266, 13016,  127, 127, 255,  206, 22 },
-	{ 2659, 59266, 13531,  127, 127, 0,  204, 22 },
-	{ 4286, 59266, 13531,  127, 127, 0,  204, 22 },
-	{ 4286, 6305, 13531,  127, 127, 0,  204, 231 },
-	{ 2660, 6305, 21440,  127, 0, 127,  173, 231 },
-	{ 4286, 6305, 21440,  127, 0, 127,  173, 231 },
-	{ 2660, 6305, 28835,  127, 0, 127,  143, 231 },
-	{ 2659, 59266, 36744,  127, 255, 127,  112, 22 },
-	{ 4286, 59266, 36744,  127, 255, 127,  112, 22 },
-	{ 2659, 59266, 29349,  127, 255, 127,  141, 22 },
-	{ 2660, 6305, 52562,  127, 127, 255,  49, 231 },
-	{ 4286, 6305, 52562,  127, 127, 255,  49, 231 },
-	{ 4286, 59266, 52562,  127, 127, 255,  49, 22 },
-	{ 2659, 59266, 53077,  127, 127, 0,  47, 22 },
-	{ 4286, 59266, 53077,  127, 127, 0,  47, 22 },
-	{ 4286, 6305, 53077,  127, 127, 0,  47, 231 },
-	{ 2660, 6305, 20925,  127, 127, 255,  175, 231 },
-	{ 4286, 6305, 20925,  127, 127, 255,  175, 231 },
-	{ 4286, 59266, 20925,  127, 127, 255,  175, 22 },
-	{ 2659, 59266, 21440,  127, 127, 0,  173, 22 },
-	{ 4286, 59266, 21440,  127, 127, 0,  173, 22 },
-	{ 4286, 6305, 21440,  127, 127, 0,  173, 231 },
-	{ 2660, 6305, 29349,  127, 0, 127,  141, 231 },
-	{ 4286, 6305, 29349,  127, 0, 127,  141, 231 },
-	{ 2660, 6305, 36744,  127, 0, 127,  112, 231 },
-	{ 2659, 59266, 44653,  127, 255, 127,  81, 22 },
-	{ 4286, 59266, 44653,  127, 255, 127,  81, 22 },
-	{ 2659, 59266, 37259,  127, 255, 127,  110, 22 },
-	{ 2660, 6305, 60472,  127, 127, 255,  18, 231 },
-	{ 4286, 6305, 60472,  127, 127, 255,  18, 231 },
-	{ 4286, 59266, 60472,  127, 127, 255,  18, 22 },
-	{ 2659, 59266, 13016,  127, 255, 127,  206, 22 },
-	{ 4286, 59266, 13016,  127, 255, 127,  206, 22 },
-	{ 2659, 59266, 5622,  127, 255, 127,  235, 22 },
-	{ 2660, 6305, 28835,  127, 127, 255,  143, 231 },
-	{ 4286, 6305, 28835,  127, 127, 255,  143, 231 },
-	{ 4286, 59266, 28835,  127, 127, 255,  143, 22 },
-	{ 2659, 59266, 29349,  127, 127, 0,  141, 22 },
-	{ 4286, 59266, 29349,  127, 127, 0,  141, 22 },
-	{ 4286, 6305, 29349,  127, 127, 0,  141, 231 },
-	{ 2660, 6305, 37259,  127, 0, 127,  110, 231 },
-	{ 4286, 6305, 37259,  127, 0, 127,  110, 231 },
-	{ 2660, 6305, 44653,  127, 0, 127,  81, 231 },
-	{ 2659, 59266, 52562,  127, 255, 127,  49, 22 },
-	{ 4286, 59266, 52562,  127, 255, 127,  49, 22 },
-	{ 2659, 59266, 45168,  127, 255, 127,  79, 22 },
-	{ 700, 671, 926,  0, 127, 127,  254, 254 },
-	{ 700, 6682, 5399,  0, 127, 127,  236, 230 },
-	{ 700, 58843, 5399,  0, 127, 127,  236, 23 },
-	{ 1004, 54319, 60231,  0, 119, 136,  81, 22 },
-	{ 311, 58780, 54375,  0, 119, 136,  110, 22 },
-	{ 133, 11094, 5912,  0, 119, 136,  110, 231 },
-	{ 2624, 54407, 60106,  254, 135, 118,  81, 22 },
-	{ 2446, 6721, 11644,  254, 135, 118,  81, 231 },
-	{ 1930, 58868, 54250,  254, 135, 118,  110, 22 },
-	{ 311, 58780, 54375,  115, 218, 38,  131, 27 },
-	{ 1930, 58868, 54250,  115, 218, 38,  123, 27 },
-	{ 1752, 11182, 5788,  115, 218, 38,  123, 227 },
-	{ 827, 6633, 11769,  139, 36, 216,  131, 27 },
-	{ 2446, 6721, 11644,  139, 36, 216,  123, 27 },
-	{ 2624, 54407, 60106,  139, 36, 216,  123, 227 },
-	{ 1004, 54319, 60231,  127, 228, 204,  80, 29 },
-	{ 2624, 54407, 60106,  127, 228, 204,  81, 22 },
-	{ 1930, 58868, 54250,  127, 228, 204,  110, 22 },
-	{ 133, 11094, 5912,  127, 26, 50,  109, 226 },
-	{ 1752, 11182, 5788,  127, 26, 50,  110, 231 },
-	{ 827, 6633, 11769,  127, 26, 50,  82, 225 },
-	{ 700, 845, 65086,  0, 127, 127,  0, 253 },
-	{ 700, 64680, 64975,  0, 127, 127,  0, 0 },
-	{ 700, 6508, 60501,  0, 127, 127,  18, 231 },
-	{ 700, 492, 1186,  0, 127, 127,  253, 255 },
-	{ 700, 492, 65135,  0, 127, 127,  0, 255 },
-	{ 700, 6272, 5454,  0, 127, 127,  236, 232 },
-	{ 700, 64840, 64898,  0, 127, 127,  0, 0 },
-	{ 700, 64840, 949,  0, 127, 127,  254, 0 },
-	{ 700, 59060, 60630,  0, 127, 127,  17, 22 },
-	{ 2659, 59060, 5691,  248, 168, 127,  235, 22 },
-	{ 700, 64840, 949,  248, 168, 127,  254, 0 },
-	{ 700, 64840, 64898,  248, 168, 127,  0, 0 },
-	{ 700, 58670, 60501,  127, 127, 0,  132, 25 },
-	{ 2659, 58670, 60501,  127, 127, 0,  122, 25 },
-	{ 700, 6508, 60501,  127, 127, 0,  132, 229 },
-	{ 2659, 6682, 5399,  244, 127, 76,  236, 230 },
-	{ 700, 671, 926,  244, 127, 76,  254, 254 },
-	{ 700, 64507, 815,  244, 127, 76,  255, 1 },
-	{ 700, 6682, 5399,  127, 127, 255,  132, 25 },
-	{ 2659, 6682, 5399,  127, 127, 255,  122, 25 },
-	{ 700, 58843, 5399,  127, 127, 255,  132, 229 },
-	{ 700, 59060, 5691,  127, 0, 127,  132, 25 },
-	{ 2659, 59060, 5691,  127, 0, 127,  122, 25 },
-	{ 700, 59060, 60630,  127, 0, 127,  132, 229 },
-	{ 2659, 58670, 60501,  244, 127, 178,  18, 24 },
-	{ 700, 64680, 64975,  244, 127, 178,  0, 0 },
-	{ 700, 845, 65086,  244, 127, 178,  0, 253 },
-	{ 2659, 6272, 60393,  248, 86, 127,  18, 232 },
-	{ 700, 492, 65135,  248, 86, 127,  0, 255 },
-	{ 700, 492, 1186,  248, 86, 127,  253, 255 },
-	{ 700, 6272, 60393,  127, 255, 127,  132, 25 },
-	{ 2659, 6272, 60393,  127, 255, 127,  122, 25 },
-	{ 700, 6272, 5454,  127, 255, 127,  132, 229 },
-	{ 2659, 59266, 53077,  0, 127, 127,  47, 22 },
-	{ 2660, 6305, 53077,  0, 127, 127,  47, 231 },
-	{ 2660, 6305, 60472,  0, 127, 127,  18, 231 },
-	{ 2659, 59266, 45168,  0, 127, 127,  79, 22 },
-	{ 2660, 6305, 45168,  0, 127, 127,  79, 231 },
-	{ 2660, 6305, 52562,  0, 127, 127,  49, 231 },
-	{ 2659, 59266, 37259,  0, 127, 127,  110, 22 },
-	{ 2660, 6305, 37259,  0, 127, 127,  110, 231 },
-	{ 2660, 6305, 44653,  0, 127, 127,  81, 231 },
-	{ 2659, 59266, 29349,  0, 127, 127,  141, 22 },
-	{ 2660, 6305, 29349,  0, 127, 127,  141, 231 },
-	{ 2660, 6305, 36744,  0, 127, 127,  112, 231 },
-	{ 2659, 59266, 21440,  0, 127, 127,  173, 22 },
-	{ 2660, 6305, 21440,  0, 127, 127,  173, 231 },
-	{ 2660, 6305, 28835,  0, 127, 127,  143, 231 },
-	{ 2659, 59266, 13531,  0, 127, 127,  204, 22 },
-	{ 2660, 6305, 13531,  0, 127, 127,  204, 231 },
-	{ 2660, 6305, 20925,  0, 127, 127,  175, 231 },
-	{ 2659, 59266, 5622,  0, 127, 127,  235, 22 },
-	{ 2660, 6305, 5622,  0, 127, 127,  235, 231 },
-	{ 2660, 6305, 13016,  0, 127, 127,  206, 231 },
-	{ 4286, 59266, 53077,  255, 127, 127,  47, 22 },
-	{ 4286, 59266, 60472,  255, 127, 127,  18, 22 },
-	{ 4286, 6305, 53077,  255, 127, 127,  47, 231 },
-	{ 4286, 59266, 45168,  255, 127, 127,  79, 22 },
-	{ 4286, 59266, 52562,  255, 127, 127,  49, 22 },
-	{ 4286, 6305, 45168,  255, 127, 127,  79, 231 },
-	{ 4286, 59266, 37259,  255, 127, 127,  110, 22 },
-	{ 4286, 59266, 44653,  255, 127, 127,  81, 22 },
-	{ 4286, 6305, 37259,  255, 127, 127,  110, 231 },
-	{ 4286, 59266, 29349,  255, 127, 127,  141, 22 },
-	{ 4286, 59266, 36744,  255, 127, 127,  112, 22 },
-	{ 4286, 6305, 29349,  255, 127, 127,  141, 231 },
-	{ 4286, 59266, 21440,  255, 127, 127,  173, 22 },
-	{ 4286, 59266, 28835,  255, 127, 127,  143, 22 },
-	{ 4286, 6305, 21440,  255, 127, 127,  173, 231 },
-	{ 4286, 59266, 13531,  255, 127, 127,  204, 22 },
-	{ 4286, 59266, 20925,  255, 127, 127,  175, 22 },
-	{ 4286, 6305, 13531,  255, 127, 127,  204, 231 },
-	{ 4286, 59266, 5622,  255, 127, 127,  235, 22 },
-	{ 4286, 59266, 13016,  255, 127, 127,  206, 22 },
-	{ 4286, 6305, 5622,  255, 127, 127,  235, 231 },
-	{ 4286, 6305, 5622,  127, 0, 127,  235, 231 },
-	{ 4286, 6305, 13016,  127, 0, 127,  206, 231 },
-	{ 2660, 6305, 13016,  127, 0, 127,  206, 231 },
-	{ 4286, 59266, 20925,  127, 255, 127,  175, 22 },
-	{ 4286, 59266, 13531,  127, 255, 127,  204, 22 },
-	{ 2659, 59266, 13531,  127, 255, 127,  204, 22 },
-	{ 2659, 59266, 36744,  127, 127, 255,  112, 22 },
-	{ 2660, 6305, 36744,  127, 127, 255,  112, 231 },
-	{ 4286, 59266, 36744,  127, 127, 255,  112, 22 },
-	{ 4286, 59266, 37259,  127, 127, 0,  110, 22 },
-	{ 4286, 6305, 37259,  127, 127, 0,  110, 231 },
-	{ 2660, 6305, 37259,  127, 127, 0,  110, 231 },
-	{ 4286, 6305, 45168,  127, 0, 127,  79, 231 },
-	{ 4286, 6305, 52562,  127, 0, 127,  49, 231 },
-	{ 2660, 6305, 52562,  127, 0, 127,  49, 231 },
-	{ 4286, 59266, 60472,  127, 255, 127,  18, 22 },
-	{ 4286, 59266, 53077,  127, 255, 127,  47, 22 },
-	{ 2659, 59266, 53077,  127, 255, 127,  47, 22 },
-	{ 2660, 6305, 5622,  127, 127, 0,  235, 231 },
-	{ 2659, 59266, 5622,  127, 127, 0,  235, 22 },
-	{ 4286, 6305, 5622,  127, 127, 0,  235, 231 },
-	{ 4286, 6305, 13531,  127, 0, 127,  204, 231 },
-	{ 4286, 6305, 20925,  127, 0, 127,  175, 231 },
-	{ 2660, 6305, 20925,  127, 0, 127,  175, 231 },
-	{ 2659, 59266, 21440,  127, 255, 127,  173, 22 },
-	{ 2659, 59266, 28835,  127, 255, 127,  143, 22 },
-	{ 4286, 59266, 21440,  127, 255, 127,  173, 22 },
-	{ 2659, 59266, 44653,  127, 127, 255,  81, 22 },
-	{ 2660, 6305, 44653,  127, 127, 255,  81, 231 },
-	{ 4286, 59266, 44653,  127, 127, 255,  81, 22 },
-	{ 4286, 59266, 45168,  127, 127, 0,  79, 22 },
-	{ 4286, 6305, 45168,  127, 127, 0,  79, 231 },
-	{ 2660, 6305, 45168,  127, 127, 0,  79, 231 },
-	{ 4286, 6305, 53077,  127, 0, 127,  47, 231 },
-	{ 4286, 6305, 60472,  127, 0, 127,  18, 231 },
-	{ 2660, 6305, 60472,  127, 0, 127,  18, 231 },
-	{ 2659, 59266, 13016,  127, 127, 255,  206, 22 },
-	{ 2660, 6305, 13016,  127, 127, 255,  206, 231 },
-	{ 4286, 59266, 13016,  127, 127, 255,  206, 22 },
-	{ 2660, 6305, 13531,  127, 127, 0,  204, 231 },
-	{ 2659, 59266, 13531,  127, 127, 0,  204, 22 },
-	{ 4286, 6305, 13531,  127, 127, 0,  204, 231 },
-	{ 4286, 6305, 21440,  127, 0, 127,  173, 231 },
-	{ 4286, 6305, 28835,  127, 0, 127,  143, 231 },
-	{ 2660, 6305, 28835,  127, 0, 127,  143, 231 },
-	{ 4286, 59266, 36744,  127, 255, 127,  112, 22 },
-	{ 4286, 59266, 29349,  127, 255, 127,  141, 22 },
-	{ 2659, 59266, 29349,  127, 255, 127,  141, 22 },
-	{ 2659, 59266, 52562,  127, 127, 255,  49, 22 },
-	{ 2660, 6305, 52562,  127, 127, 255,  49, 231 },
-	{ 4286, 59266, 52562,  127, 127, 255,  49, 22 },
-	{ 2660, 6305, 53077,  127, 127, 0,  47, 231 },
-	{ 2659, 59266, 53077,  127, 127, 0,  47, 22 },
-	{ 4286, 6305, 53077,  127, 127, 0,  47, 231 },
-	{ 2659, 59266, 20925,  127, 127, 255,  175, 22 },
-	{ 2660, 6305, 20925,  127, 127, 255,  175, 231 },
-	{ 4286, 59266, 20925,  127, 127, 255,  175, 22 },
-	{ 2660, 6305, 21440,  127, 127, 0,  173, 231 },
-	{ 2659, 59266, 21440,  127, 127, 0,  173, 22 },
-	{ 4286, 6305, 21440,  127, 127, 0,  173, 231 },
-	{ 4286, 6305, 29349,  127, 0, 127,  141, 231 },
-	{ 4286, 6305, 36744,  127, 0, 127,  112, 231 },
-	{ 2660, 6305, 36744,  127, 0, 127,  112, 231 },
-	{ 4286, 59266, 44653,  127, 255, 127,  81, 22 },
-	{ 4286, 59266, 37259,  127, 255, 127,  110, 22 },
-	{ 2659, 59266, 37259,  127, 255, 127,  110, 22 },
-	{ 2659, 59266, 60472,  127, 127, 255,  18, 22 },
-	{ 2660, 6305, 60472,  127, 127, 255,  18, 231 },
-	{ 4286, 59266, 60472,  127, 127, 255,  18, 22 },
-	{ 4286, 59266, 13016,  127, 255, 127,  206, 22 },
-	{ 4286, 59266, 5622,  127, 255, 127,  235, 22 },
-	{ 2659, 59266, 5622,  127, 255, 127,  235, 22 },
-	{ 2659, 59266, 28835,  127, 127, 255,  143, 22 },
-	{ 2660, 6305, 28835,  127, 127, 255,  143, 231 },
-	{ 4286, 59266, 28835,  127, 127, 255,  143, 22 },
-	{ 2660, 6305, 29349,  127, 127, 0,  141, 231 },
-	{ 2659, 59266, 29349,  127, 127, 0,  141, 22 },
-	{ 4286, 6305, 29349,  127, 127, 0,  141, 231 },
-	{ 4286, 6305, 37259,  127, 0, 127,  110, 231 },
-	{ 4286, 6305, 44653,  127, 0, 127,  81, 231 },
-	{ 2660, 6305, 44653,  127, 0, 127,  81, 231 },
-	{ 4286, 59266, 52562,  127, 255, 127,  49, 22 },
-	{ 4286, 59266, 45168,  127, 255, 127,  79, 22 },
-	{ 2659, 59266, 45168,  127, 255, 127,  79, 22 },
-	{ 700, 64507, 815,  0, 127, 127,  255, 1 },
-	{ 700, 671, 926,  0, 127, 127,  254, 254 },
-	{ 700, 58843, 5399,  0, 127, 127,  236, 23 },
-	{ 827, 6633, 11769,  0, 119, 136,  81, 231 },
-	{ 1004, 54319, 60231,  0, 119, 136,  81, 22 },
-	{ 133, 11094, 5912,  0, 119, 136,  110, 231 },
-	{ 2446, 6721, 11644,  254, 135, 118,  81, 231 },
-	{ 1752, 11182, 5788,  254, 135, 118,  110, 231 },
-	{ 1930, 58868, 54250,  254, 135, 118,  110, 22 },
-	{ 133, 11094, 5912,  115, 218, 38,  131, 227 },
-	{ 311, 58780, 54375,  115, 218, 38,  131, 27 },
-	{ 1752, 11182, 5788,  115, 218, 38,  123, 227 },
-	{ 1004, 54319, 60231,  139, 36, 216,  131, 227 },
-	{ 827, 6633, 11769,  139, 36, 216,  131, 27 },
-	{ 2624, 54407, 60106,  139, 36, 216,  123, 227 },
-	{ 311, 58780, 54375,  127, 228, 204,  110, 29 },
-	{ 1004, 54319, 60231,  127, 228, 204,  80, 29 },
-	{ 1930, 58868, 54250,  127, 228, 204,  110, 22 },
-	{ 1752, 11182, 5788,  127, 26, 50,  110, 231 },
-	{ 2446, 6721, 11644,  127, 26, 50,  81, 231 },
-	{ 827, 6633, 11769,  127, 26, 50,  82, 225 },
-	{ 701, 567, 64975,  127, 0, 127,  0, 0 },
-	{ 6711, 567, 60501,  127, 0, 127,  18, 24 },
-	{ 64536, 567, 65086,  127, 0, 127,  0, 253 },
-	{ 64889, 567, 65135,  127, 0, 127,  0, 255 },
-	{ 59109, 567, 60393,  127, 0, 127,  18, 232 },
-	{ 64889, 567, 1186,  127, 0, 127,  253, 255 },
-	{ 541, 567, 949,  127, 0, 127,  254, 0 },
-	{ 6321, 567, 5691,  127, 0, 127,  235, 22 },
-	{ 6321, 567, 60630,  127, 0, 127,  17, 22 },
-	{ 6321, 2526, 60630,  86, 248, 127,  17, 22 },
-	{ 6321, 2526, 5691,  86, 248, 127,  235, 22 },
-	{ 541, 567, 949,  86, 248, 127,  254, 0 },
-	{ 6711, 2526, 60501,  127, 127, 0,  122, 25 },
-	{ 58873, 2526, 60501,  127, 127, 0,  122, 229 },
-	{ 58873, 567, 60501,  127, 127, 0,  132, 229 },
-	{ 6538, 2526, 5399,  127, 244, 76,  236, 23 },
-	{ 58699, 2526, 5399,  127, 244, 76,  236, 230 },
-	{ 64710, 567, 926,  127, 244, 76,  254, 254 },
-	{ 58699, 2526, 5399,  127, 127, 255,  122, 25 },
-	{ 6538, 2526, 5399,  127, 127, 255,  122, 229 },
-	{ 58699, 567, 5399,  127, 127, 255,  132, 25 },
-	{ 6321, 2526, 5691,  255, 127, 127,  122, 25 },
-	{ 6321, 2526, 60630,  255, 127, 127,  122, 229 },
-	{ 6321, 567, 60630,  255, 127, 127,  132, 229 },
-	{ 58873, 2526, 60501,  207, 127, 28,  18, 231 },
-	{ 64536, 567, 65086,  207, 127, 28,  0, 253 },
-	{ 58873, 567, 60501,  207, 127, 28,  18, 231 },
-	{ 58873, 2526, 60501,  127, 244, 178,  18, 231 },
-	{ 6711, 2526, 60501,  127, 244, 178,  18, 24 },
-	{ 701, 567, 64975,  127, 244, 178,  0, 0 },
-	{ 6321, 2526, 60630,  203, 127, 230,  17, 22 },
-	{ 541, 567, 64898,  203, 127, 230,  0, 0 },
-	{ 6321, 567, 60630,  203, 127, 230,  17, 22 },
-	{ 59109, 2526, 5454,  168, 248, 127,  236, 232 },
-	{ 59109, 2526, 60393,  168, 248, 127,  18, 232 },
-	{ 64889, 567, 1186,  168, 248, 127,  253, 255 },
-	{ 6538, 2526, 5399,  47, 127, 226,  236, 23 },
-	{ 874, 567, 815,  47, 127, 226,  255, 1 },
-	{ 6538, 567, 5399,  47, 127, 226,  236, 23 },
-	{ 59109, 2526, 60393,  0, 127, 127,  122, 25 },
-	{ 59109, 2526, 5454,  0, 127, 127,  122, 229 },
-	{ 59109, 567, 60393,  0, 127, 127,  132, 25 },
-	{ 59109, 2526, 60393,  46, 127, 226,  18, 232 },
-	{ 59109, 567, 60393,  46, 127, 226,  18, 232 },
-	{ 64889, 567, 65135,  46, 127, 226,  0, 255 },
-	{ 59109, 2526, 5454,  51, 127, 24,  236, 232 },
-	{ 64889, 567, 1186,  51, 127, 24,  253, 255 },
-	{ 59109, 567, 5454,  51, 127, 24,  236, 232 },
-	{ 6321, 2526, 5691,  208, 127, 28,  235, 22 },
-	{ 6321, 567, 5691,  208, 127, 28,  235, 22 },
-	{ 541, 567, 949,  208, 127, 28,  254, 0 },
-	{ 6711, 2526, 60501,  51, 127, 25,  18, 24 },
-	{ 6711, 567, 60501,  51, 127, 25,  18, 24 },
-	{ 701, 567, 64975,  51, 127, 25,  0, 0 },
-	{ 58699, 2526, 5399,  203, 127, 229,  236, 230 },
-	{ 58699, 567, 5399,  203, 127, 229,  236, 230 },
-	{ 64710, 567, 926,  203, 127, 229,  254, 254 },
-	{ 6115, 2526, 60472,  127, 0, 127,  18, 22 },
-	{ 6115, 2526, 53077,  127, 0, 127,  47, 22 },
-	{ 59076, 2526, 53077,  127, 0, 127,  47, 231 },
-	{ 6115, 2526, 52562,  127, 0, 127,  49, 22 },
-	{ 6115, 2526, 45168,  127, 0, 127,  79, 22 },
-	{ 59076, 2526, 45168,  127, 0, 127,  79, 231 },
-	{ 6115, 2526, 44653,  127, 0, 127,  81, 22 },
-	{ 6115, 2526, 37259,  127, 0, 127,  110, 22 },
-	{ 59076, 2526, 37259,  127, 0, 127,  110, 231 },
-	{ 6115, 2526, 36744,  127, 0, 127,  112, 22 },
-	{ 6115, 2526, 29349,  127, 0, 127,  141, 22 },
-	{ 59076, 2526, 29349,  127, 0, 127,  141, 231 },
-	{ 6115, 2526, 28835,  127, 0, 127,  143, 22 },
-	{ 6115, 2526, 21440,  127, 0, 127,  173, 22 },
-	{ 59076, 2526, 21440,  127, 0, 127,  173, 231 },
-	{ 6115, 2526, 20925,  127, 0, 127,  175, 22 },
-	{ 6115, 2526, 13531,  127, 0, 127,  204, 22 },
-	{ 59076, 2526, 13531,  127, 0, 127,  204, 231 },
-	{ 6115, 2526, 13016,  127, 0, 127,  206, 22 },
-	{ 6115, 2526, 5622,  127, 0, 127,  235, 22 },
-	{ 59076, 2526, 5622,  127, 0, 127,  235, 231 },
-	{ 6115, 4153, 60472,  127, 255, 127,  18, 22 },
-	{ 59076, 4153, 60472,  127, 255, 127,  18, 231 },
-	{ 6115, 4153, 53077,  127, 255, 127,  47, 22 },
-	{ 6115, 4153, 52562,  127, 255, 127,  49, 22 },
-	{ 59076, 4153, 52562,  127, 255, 127,  49, 231 },
-	{ 6115, 4153, 45168,  127, 255, 127,  79, 22 },
-	{ 6115, 4153, 44653,  127, 255, 127,  81, 22 },
-	{ 59076, 4153, 44653,  127, 255, 127,  81, 231 },
-	{ 6115, 4153, 37259,  127, 255, 127,  110, 22 },
-	{ 6115, 4153, 36744,  127, 255, 127,  112, 22 },
-	{ 59076, 4153, 36744,  127, 255, 127,  112, 231 },
-	{ 6115, 4153, 29349,  127, 255, 127,  141, 22 },
-	{ 6115, 4153, 28835,  127, 255, 127,  143, 22 },
-	{ 59076, 4153, 28835,  127, 255, 127,  143, 231 },
-	{ 6115, 4153, 21440,  127, 255, 127,  173, 22 },
-	{ 6115, 4153, 20925,  127, 255, 127,  175, 22 },
-	{ 59076, 4153, 20925,  127, 255, 127,  175, 231 },
-	{ 6115, 4153, 13531,  127, 255, 127,  204, 22 },
-	{ 6115, 4153, 13016,  127, 255, 127,  206, 22 },
-	{ 59076, 4153, 13016,  127, 255, 127,  206, 231 },
-	{ 6115, 4153, 5622,  127, 255, 127,  235, 22 },
-	{ 59076, 2526, 5622,  255, 127, 127,  235, 231 },
-	{ 59076, 4153, 5622,  255, 127, 127,  235, 231 },
-	{ 59076, 4153, 13016,  255, 127, 127,  206, 231 },
-	{ 6115, 2526, 20925,  0, 127, 127,  175, 22 },
-	{ 6115, 4153, 20925,  0, 127, 127,  175, 22 },
-	{ 6115, 2526, 13531,  0, 127, 127,  204, 22 },
-	{ 59076, 2526, 36744,  127, 127, 255,  112, 231 },
-	{ 59076, 4153, 36744,  127, 127, 255,  112, 231 },
-	{ 6115, 4153, 36744,  127, 127, 255,  112, 22 },
-	{ 6115, 2526, 37259,  127, 127, 0,  110, 22 },
-	{ 6115, 4153, 37259,  127, 127, 0,  110, 22 },
-	{ 59076, 2526, 37259,  127, 127, 0,  110, 231 },
-	{ 59076, 2526, 45168,  255, 127, 127,  79, 231 },
-	{ 59076, 4153, 45168,  255, 127, 127,  79, 231 },
-	{ 59076, 4153, 52562,  255, 127, 127,  49, 231 },
-	{ 6115, 2526, 60472,  0, 127, 127,  18, 22 },
-	{ 6115, 4153, 60472,  0, 127, 127,  18, 22 },
-	{ 6115, 2526, 53077,  0, 127, 127,  47, 22 },
-	{ 6115, 2526, 5622,  127, 127, 0,  235, 22 },
-	{ 6115, 4153, 5622,  127, 127, 0,  235, 22 },
-	{ 59076, 2526, 5622,  127, 127, 0,  235, 231 },
-	{ 59076, 2526, 13531,  255, 127, 127,  204, 231 },
-	{ 59076, 4153, 13531,  255, 127, 127,  204, 231 },
-	{ 59076, 4153, 20925,  255, 127, 127,  175, 231 },
-	{ 6115, 2526, 28835,  0, 127, 127,  143, 22 },
-	{ 6115, 4153, 28835,  0, 127, 127,  143, 22 },
-	{ 6115, 4153, 21440,  0, 127, 127,  173, 22 },
-	{ 59076, 2526, 44653,  127, 127, 255,  81, 231 },
-	{ 59076, 4153, 44653,  127, 127, 255,  81, 231 },
-	{ 6115, 4153, 44653,  127, 127, 255,  81, 22 },
-	{ 6115, 2526, 45168,  127, 127, 0,  79, 22 },
-	{ 6115, 4153, 45168,  127, 127, 0,  79, 22 },
-	{ 59076, 2526, 45168,  127, 127, 0,  79, 231 },
-	{ 59076, 2526, 53077,  255, 127, 127,  47, 231 },
-	{ 59076, 4153, 53077,  255, 127, 127,  47, 231 },
-	{ 59076, 4153, 60472,  255, 127, 127,  18, 231 },
-	{ 59076, 2526, 13016,  127, 127, 255,  206, 231 },
-	{ 59076, 4153, 13016,  127, 127, 255,  206, 231 },
-	{ 6115, 4153, 13016,  127, 127, 255,  206, 22 },
-	{ 6115, 2526, 13531,  127, 127, 0,  204, 22 },
-	{ 6115, 4153, 13531,  127, 127, 0,  204, 22 },
-	{ 59076, 2526, 13531,  127, 127, 0,  204, 231 },
-	{ 59076, 2526, 21440,  255, 127, 127,  173, 231 },
-	{ 59076, 4153, 21440,  255, 127, 127,  173, 231 },
-	{ 59076, 4153, 28835,  255, 127, 127,  143, 231 },
-	{ 6115, 2526, 36744,  0, 127, 127,  112, 22 },
-	{ 6115, 4153, 36744,  0, 127, 127,  112, 22 },
-	{ 6115, 2526, 29349,  0, 127, 127,  141, 22 },
-	{ 59076, 2526, 52562,  127, 127, 255,  49, 231 },
-	{ 59076, 4153, 52562,  127, 127, 255,  49, 231 },
-	{ 6115, 4153, 52562,  127, 127, 255,  49, 22 },
-	{ 6115, 2526, 53077,  127, 127, 0,  47, 22 },
-	{ 6115, 4153, 53077,  127, 127, 0,  47, 22 },
-	{ 59076, 2526, 53077,  127, 127, 0,  47, 231 },
-	{ 59076, 2526, 20925,  127, 127, 255,  175, 231 },
-	{ 59076, 4153, 20925,  127, 127, 255,  175, 231 },
-	{ 6115, 4153, 20925,  127, 127, 255,  175, 22 },
-	{ 6115, 2526, 21440,  127, 127, 0,  173, 22 },
-	{ 6115, 4153, 21440,  127, 127, 0,  173, 22 },
-	{ 59076, 2526, 21440,  127, 127, 0,  173, 231 },
-	{ 59076, 2526, 29349,  255, 127, 127,  141, 231 },
-	{ 59076, 4153, 29349,  255, 127, 127,  141, 231 },
-	{ 59076, 4153, 36744,  255, 127, 127,  112, 231 },
-	{ 6115, 2526, 44653,  0, 127, 127,  81, 22 },
-	{ 6115, 4153, 44653,  0, 127, 127,  81, 22 },
-	{ 6115, 2526, 37259,  0, 127, 127,  110, 22 },
-	{ 59076, 2526, 60472,  127, 127, 255,  18, 231 },
-	{ 59076, 4153, 60472,  127, 127, 255,  18, 231 },
-	{ 6115, 4153, 60472,  127, 127, 255,  18, 22 },
-	{ 6115, 2526, 13016,  0, 127, 127,  206, 22 },
-	{ 6115, 4153, 13016,  0, 127, 127,  206, 22 },
-	{ 6115, 2526, 5622,  0, 127, 127,  235, 22 },
-	{ 59076, 2526, 28835,  127, 127, 255,  143, 231 },
-	{ 59076, 4153, 28835,  127, 127, 255,  143, 231 },
-	{ 6115, 4153, 28835,  127, 127, 255,  143, 22 },
-	{ 6115, 2526, 29349,  127, 127, 0,  141, 22 },
-	{ 6115, 4153, 29349,  127, 127, 0,  141, 22 },
-	{ 59076, 2526, 29349,  127, 127, 0,  141, 231 },
-	{ 59076, 2526, 37259,  255, 127, 127,  110, 231 },
-	{ 59076, 4153, 37259,  255, 127, 127,  110, 231 },
-	{ 59076, 4153, 44653,  255, 127, 127,  81, 231 },
-	{ 6115, 2526, 52562,  0, 127, 127,  49, 22 },
-	{ 6115, 4153, 52562,  0, 127, 127,  49, 22 },
-	{ 6115, 2526, 45168,  0, 127, 127,  79, 22 },
-	{ 64710, 567, 926,  127, 0, 127,  254, 254 },
-	{ 58699, 567, 5399,  127, 0, 127,  236, 230 },
-	{ 874, 567, 815,  127, 0, 127,  255, 1 },
-	{ 11062, 871, 60231,  135, 0, 136,  81, 22 },
-	{ 6601, 177, 54375,  135, 0, 136,  110, 22 },
-	{ 58748, 693, 11769,  135, 0, 136,  81, 231 },
-	{ 10974, 2490, 60106,  119, 254, 118,  81, 22 },
-	{ 58660, 2313, 11644,  119, 254, 118,  81, 231 },
-	{ 54199, 1619, 5788,  119, 254, 118,  110, 231 },
-	{ 6601, 177, 54375,  36, 115, 38,  131, 27 },
-	{ 6513, 1797, 54250,  36, 115, 38,  123, 27 },
-	{ 54199, 1619, 5788,  36, 115, 38,  123, 227 },
-	{ 58748, 693, 11769,  218, 139, 216,  131, 27 },
-	{ 58660, 2313, 11644,  218, 139, 216,  123, 27 },
-	{ 10974, 2490, 60106,  218, 139, 216,  123, 227 },
-	{ 11062, 871, 60231,  26, 127, 204,  80, 29 },
-	{ 10974, 2490, 60106,  26, 127, 204,  81, 22 },
-	{ 6601, 177, 54375,  26, 127, 204,  110, 29 },
-	{ 54287, 0, 5912,  228, 127, 50,  109, 226 },
-	{ 54199, 1619, 5788,  228, 127, 50,  110, 231 },
-	{ 58660, 2313, 11644,  228, 127, 50,  81, 231 },
-	{ 6711, 567, 60501,  127, 0, 127,  18, 24 },
-	{ 58873, 567, 60501,  127, 0, 127,  18, 231 },
-	{ 64536, 567, 65086,  127, 0, 127,  0, 253 },
-	{ 59109, 567, 60393,  127, 0, 127,  18, 232 },
-	{ 59109, 567, 5454,  127, 0, 127,  236, 232 },
-	{ 64889, 567, 1186,  127, 0, 127,  253, 255 },
-	{ 541, 567, 64898,  127, 0, 127,  0, 0 },
-	{ 541, 567, 949,  127, 0, 127,  254, 0 },
-	{ 6321, 567, 60630,  127, 0, 127,  17, 22 },
-	{ 541, 567, 64898,  86, 248, 127,  0, 0 },
-	{ 6321, 2526, 60630,  86, 248, 127,  17, 22 },
-	{ 541, 567, 949,  86, 248, 127,  254, 0 },
-	{ 6711, 567, 60501,  127, 127, 0,  132, 25 },
-	{ 6711, 2526, 60501,  127, 127, 0,  122, 25 },
-	{ 58873, 567, 60501,  127, 127, 0,  132, 229 },
-	{ 874, 567, 815,  127, 244, 77,  255, 1 },
-	{ 6538, 2526, 5399,  127, 244, 77,  236, 23 },
-	{ 64710, 567, 926,  127, 244, 77,  254, 254 },
-	{ 6538, 2526, 5399,  127, 127, 255,  122, 229 },
-	{ 6538, 567, 5399,  127, 127, 255,  132, 229 },
-	{ 58699, 567, 5399,  127, 127, 255,  132, 25 },
-	{ 6321, 567, 5691,  255, 127, 127,  132, 25 },
-	{ 6321, 2526, 5691,  255, 127, 127,  122, 25 },
-	{ 6321, 567, 60630,  255, 127, 127,  132, 229 },
-	{ 64536, 567, 65086,  127, 244, 177,  0, 253 },
-	{ 58873, 2526, 60501,  127, 244, 177,  18, 231 },
-	{ 701, 567, 64975,  127, 244, 177,  0, 0 },
-	{ 59109, 2526, 60393,  168, 248, 127,  18, 232 },
-	{ 64889, 567, 65135,  168, 248, 127,  0, 255 },
-	{ 64889, 567, 1186,  168, 248, 127,  253, 255 },
-	{ 59109, 2526, 5454,  0, 127, 127,  122, 229 },
-	{ 59109, 567, 5454,  0, 127, 127,  132, 229 },
-	{ 59109, 567, 60393,  0, 127, 127,  132, 25 },
-	{ 59076, 2526, 60472,  127, 0, 127,  18, 231 },
-	{ 6115, 2526, 60472,  127, 0, 127,  18, 22 },
-	{ 59076, 2526, 53077,  127, 0, 127,  47, 231 },
-	{ 59076, 2526, 52562,  127, 0, 127,  49, 231 },
-	{ 6115, 2526, 52562,  127, 0, 127,  49, 22 },
-	{ 59076, 2526, 45168,  127, 0, 127,  79, 231 },
-	{ 59076, 2526, 44653,  127, 0, 127,  81, 231 },
-	{ 6115, 2526, 44653,  127, 0, 127,  81, 22 },
-	{ 59076, 2526, 37259,  127, 0, 127,  110, 231 },
-	{ 59076, 2526, 36744,  127, 0, 127,  112, 231 },
-	{ 6115, 2526, 36744,  127, 0, 127,  112, 22 },
-	{ 59076, 2526, 29349,  127, 0, 127,  141, 231 },
-	{ 59076, 2526, 28835,  127, 0, 127,  143, 231 },
-	{ 6115, 2526, 28835,  127, 0, 127,  143, 22 },
-	{ 59076, 2526, 21440,  127, 0, 127,  173, 231 },
-	{ 59076, 2526, 20925,  127, 0, 127,  175, 231 },
-	{ 6115, 2526, 20925,  127, 0, 127,  175, 22 },
-	{ 59076, 2526, 13531,  127, 0, 127,  204, 231 },
-	{ 59076, 2526, 13016,  127, 0, 127,  206, 231 },
-	{ 6115, 2526, 13016,  127, 0, 127,  206, 22 },
-	{ 59076, 2526, 5622,  127, 0, 127,  235, 231 },
-	{ 59076, 4153, 60472,  127, 255, 127,  18, 231 },
-	{ 59076, 4153, 53077,  127, 255, 127,  47, 231 },
-	{ 6115, 4153, 53077,  127, 255, 127,  47, 22 },
-	{ 59076, 4153, 52562,  127, 255, 127,  49, 231 },
-	{ 59076, 4153, 45168,  127, 255, 127,  79, 231 },
-	{ 6115, 4153, 45168,  127, 255, 127,  79, 22 },
-	{ 59076, 4153, 44653,  127, 255, 127,  81, 231 },
-	{ 59076, 4153, 37259,  127, 255, 127,  110, 231 },
-	{ 6115, 4153, 37259,  127, 255, 127,  110, 22 },
-	{ 59076, 4153, 36744,  127, 255, 127,  112, 231 },
-	{ 59076, 4153, 29349,  127, 255, 127,  141, 231 },
-	{ 6115, 4153, 29349,  127, 255, 127,  141, 22 },
-	{ 59076, 4153, 28835,  127, 255, 127,  143, 231 },
-	{ 59076, 4153, 21440,  127, 255, 127,  173, 231 },
-	{ 6115, 4153, 21440,  127, 255, 127,  173, 22 },
-	{ 59076, 4153, 20925,  127, 255, 127,  175, 231 },
-	{ 59076, 4153, 13531,  127, 255, 127,  204, 231 },
-	{ 6115, 4153, 13531,  127, 255, 127,  204, 22 },
-	{ 59076, 4153, 13016,  127, 255, 127,  206, 231 },
-	{ 59076, 4153, 5622,  127, 255, 127,  235, 231 },
-	{ 6115, 4153, 5622,  127, 255, 127,  235, 22 },
-	{ 59076, 2526, 13016,  255, 127, 127,  206, 231 },
-	{ 59076, 2526, 5622,  255, 127, 127,  235, 231 },
-	{ 59076, 4153, 13016,  255, 127, 127,  206, 231 },
-	{ 6115, 4153, 20925,  0, 127, 127,  175, 22 },
-	{ 6115, 4153, 13531,  0, 127, 127,  204, 22 },
-	{ 6115, 2526, 13531,  0, 127, 127,  204, 22 },
-	{ 6115, 2526, 36744,  127, 127, 255,  112, 22 },
-	{ 59076, 2526, 36744,  127, 127, 255,  112, 231 },
-	{ 6115, 4153, 36744,  127, 127, 255,  112, 22 },
-	{ 6115, 4153, 37259,  127, 127, 0,  110, 22 },
-	{ 59076, 4153, 37259,  127, 127, 0,  110, 231 },
-	{ 59076, 2526, 37259,  127, 127, 0,  110, 231 },
-	{ 59076, 2526, 52562,  255, 127, 127,  49, 231 },
-	{ 59076, 2526, 45168,  255, 127, 127,  79, 231 },
-	{ 59076, 4153, 52562,  255, 127, 127,  49, 231 },
-	{ 6115, 4153, 60472,  0, 127, 127,  18, 22 },
-	{ 6115, 4153, 53077,  0, 127, 127,  47, 22 },
-	{ 6115, 2526, 53077,  0, 127, 127,  47, 22 },
-	{ 6115, 4153, 5622,  127, 127, 0,  235, 22 },
-	{ 59076, 4153, 5622,  127, 127, 0,  235, 231 },
-	{ 59076, 2526, 5622,  127, 127, 0,  235, 231 },
-	{ 59076, 2526, 20925,  255, 127, 127,  175, 231 },
-	{ 59076, 2526, 13531,  255, 127, 127,  204, 231 },
-	{ 59076, 4153, 20925,  255, 127, 127,  175, 231 },
-	{ 6115, 2526, 21440,  0, 127, 127,  173, 22 },
-	{ 6115, 2526, 28835,  0, 127, 127,  143, 22 },
-	{ 6115, 4153, 21440,  0, 127, 127,  173, 22 },
-	{ 6115, 2526, 44653,  127, 127, 255,  81, 22 },
-	{ 59076, 2526, 44653,  127, 127, 255,  81, 231 },
-	{ 6115, 4153, 44653,  127, 127, 255,  81, 22 },
-	{ 6115, 4153, 45168,  127, 127, 0,  79, 22 },
-	{ 59076, 4153, 45168,  127, 127, 0,  79, 231 },
-	{ 59076, 2526, 45168,  127, 127, 0,  79, 231 },
-	{ 59076, 2526, 60472,  255, 127, 127,  18, 231 },
-	{ 59076, 2526, 53077,  255, 127, 127,  47, 231 },
-	{ 59076, 4153, 60472,  255, 127, 127,  18, 231 },
-	{ 6115, 2526, 13016,  127, 127, 255,  206, 22 },
-	{ 59076, 2526, 13016,  127, 127, 255,  206, 231 },
-	{ 6115, 4153, 13016,  127, 127, 255,  206, 22 },
-	{ 6115, 4153, 13531,  127, 127, 0,  204, 22 },
-	{ 59076, 4153, 13531,  127, 127, 0,  204, 231 },
-	{ 59076, 2526, 13531,  127, 127, 0,  204, 231 },
-	{ 59076, 2526, 28835,  255, 127, 127,  143, 231 },
-	{ 59076, 2526, 21440,  255, 127, 127,  173, 231 },
-	{ 59076, 4153, 28835,  255, 127, 127,  143, 231 },
-	{ 6115, 4153, 36744,  0, 127, 127,  112, 22 },
-	{ 6115, 4153, 29349,  0, 127, 127,  141, 22 },
-	{ 6115, 2526, 29349,  0, 127, 127,  141, 22 },
-	{ 6115, 2526, 52562,  127, 127, 255,  49, 22 },
-	{ 59076, 2526, 52562,  127, 127, 255,  49, 231 },
-	{ 6115, 4153, 52562,  127, 127, 255,  49, 22 },
-	{ 6115, 4153, 53077,  127, 127, 0,  47, 22 },
-	{ 59076, 4153, 53077,  127, 127, 0,  47, 231 },
-	{ 59076, 2526, 53077,  127, 127, 0,  47, 231 },
-	{ 6115, 2526, 20925,  127, 127, 255,  175, 22 },
-	{ 59076, 2526, 20925,  127, 127, 255,  175, 231 },
-	{ 6115, 4153, 20925,  127, 127, 255,  175, 22 },
-	{ 6115, 4153, 21440,  127, 127, 0,  173, 22 },
-	{ 59076, 4153, 21440,  127, 127, 0,  173, 231 },
-	{ 59076, 2526, 21440,  127, 127, 0,  173, 231 },
-	{ 59076, 2526, 36744,  255, 127, 127,  112, 231 },
-	{ 59076, 2526, 29349,  255, 127, 127,  141, 231 },
-	{ 59076, 4153, 36744,  255, 127, 127,  112, 231 },
-	{ 6115, 4153, 44653,  0, 127, 127,  81, 22 },
-	{ 6115, 4153, 37259,  0, 127, 127,  110, 22 },
-	{ 6115, 2526, 37259,  0, 127, 127,  110, 22 },
-	{ 6115, 2526, 60472,  127, 127, 255,  18, 22 },
-	{ 59076, 2526, 60472,  127, 127, 255,  18, 231 },
-	{ 6115, 4153, 60472,  127, 127, 255,  18, 22 },
-	{ 6115, 4153, 13016,  0, 127, 127,  206, 22 },
-	{ 6115, 4153, 5622,  0, 127, 127,  235, 22 },
-	{ 6115, 2526, 5622,  0, 127, 127,  235, 22 },
-	{ 6115, 2526, 28835,  127, 127, 255,  143, 22 },
-	{ 59076, 2526, 28835,  127, 127, 255,  143, 231 },
-	{ 6115, 4153, 28835,  127, 127, 255,  143, 22 },
-	{ 6115, 4153, 29349,  127, 127, 0,  141, 22 },
-	{ 59076, 4153, 29349,  127, 127, 0,  141, 231 },
-	{ 59076, 2526, 29349,  127, 127, 0,  141, 231 },
-	{ 59076, 2526, 44653,  255, 127, 127,  81, 231 },
-	{ 59076, 2526, 37259,  255, 127, 127,  110, 231 },
-	{ 59076, 4153, 44653,  255, 127, 127,  81, 231 },
-	{ 6115, 4153, 52562,  0, 127, 127,  49, 22 },
-	{ 6115, 4153, 45168,  0, 127, 127,  79, 22 },
-	{ 6115, 2526, 45168,  0, 127, 127,  79, 22 },
-	{ 58699, 567, 5399,  127, 0, 127,  236, 230 },
-	{ 6538, 567, 5399,  127, 0, 127,  236, 23 },
-	{ 874, 567, 815,  127, 0, 127,  255, 1 },
-	{ 6601, 177, 54375,  135, 0, 136,  110, 22 },
-	{ 54287, 0, 5912,  135, 0, 136,  110, 231 },
-	{ 58748, 693, 11769,  135, 0, 136,  81, 231 },
-	{ 6513, 1797, 54250,  119, 254, 118,  110, 22 },
-	{ 10974, 2490, 60106,  119, 254, 118,  81, 22 },
-	{ 54199, 1619, 5788,  119, 254, 118,  110, 231 },
-	{ 54287, 0, 5912,  36, 115, 38,  131, 227 },
-	{ 6601, 177, 54375,  36, 115, 38,  131, 27 },
-	{ 54199, 1619, 5788,  36, 115, 38,  123, 227 },
-	{ 11062, 871, 60231,  218, 139, 216,  131, 227 },
-	{ 58748, 693, 11769,  218, 139, 216,  131, 27 },
-	{ 10974, 2490, 60106,  218, 139, 216,  123, 227 },
-	{ 10974, 2490, 60106,  26, 127, 204,  81, 22 },
-	{ 6513, 1797, 54250,  26, 127, 204,  110, 22 },
-	{ 6601, 177, 54375,  26, 127, 204,  110, 29 },
-	{ 58748, 693, 11769,  228, 127, 50,  82, 225 },
-	{ 54287, 0, 5912,  228, 127, 50,  109, 226 },
-	{ 58660, 2313, 11644,  228, 127, 50,  81, 231 },
-	{ 64814, 785, 64975,  255, 127, 127,  0, 0 },
-	{ 64814, 6796, 60501,  255, 127, 127,  18, 24 },
-	{ 64814, 64621, 65086,  255, 127, 127,  0, 253 },
-	{ 64814, 64973, 65135,  255, 127, 127,  0, 255 },
-	{ 64814, 59193, 60393,  255, 127, 127,  18, 232 },
-	{ 64814, 64973, 1186,  255, 127, 127,  253, 255 },
-	{ 64814, 625, 949,  255, 127, 127,  254, 0 },
-	{ 64814, 6405, 5691,  255, 127, 127,  235, 22 },
-	{ 64814, 625, 64898,  255, 127, 127,  0, 0 },
-	{ 62855, 6405, 60630,  6, 86, 127,  17, 22 },
-	{ 62855, 6405, 5691,  6, 86, 127,  235, 22 },
-	{ 64814, 625, 949,  6, 86, 127,  254, 0 },
-	{ 62855, 6796, 60501,  127, 127, 0,  122, 25 },
-	{ 62855, 58957, 60501,  127, 127, 0,  122, 229 },
-	{ 64814, 58957, 60501,  127, 127, 0,  132, 229 },
-	{ 62855, 6622, 5399,  10, 127, 76,  236, 23 },
-	{ 62855, 58783, 5399,  10, 127, 76,  236, 230 },
-	{ 64814, 64794, 926,  10, 127, 76,  254, 254 },
-	{ 62855, 58783, 5399,  127, 127, 255,  122, 25 },
-	{ 62855, 6622, 5399,  127, 127, 255,  122, 229 },
-	{ 64814, 6622, 5399,  127, 127, 255,  132, 229 },
-	{ 62855, 6405, 5691,  127, 255, 127,  122, 25 },
-	{ 62855, 6405, 60630,  127, 255, 127,  122, 229 },
-	{ 64814, 6405, 60630,  127, 255, 127,  132, 229 },
-	{ 62855, 58957, 60501,  127, 207, 28,  18, 231 },
-	{ 64814, 64621, 65086,  127, 207, 28,  0, 253 },
-	{ 64814, 58957, 60501,  127, 207, 28,  18, 231 },
-	{ 62855, 58957, 60501,  10, 127, 178,  18, 231 },
-	{ 62855, 6796, 60501,  10, 127, 178,  18, 24 },
-	{ 64814, 785, 64975,  10, 127, 178,  0, 0 },
-	{ 62855, 6405, 60630,  127, 203, 230,  17, 22 },
-	{ 64814, 625, 64898,  127, 203, 230,  0, 0 },
-	{ 64814, 6405, 60630,  127, 203, 230,  17, 22 },
-	{ 62855, 59193, 5454,  6, 168, 127,  236, 232 },
-	{ 62855, 59193, 60393,  6, 168, 127,  18, 232 },
-	{ 64814, 64973, 65135,  6, 168, 127,  0, 255 },
-	{ 62855, 6622, 5399,  127, 47, 226,  236, 23 },
-	{ 64814, 958, 815,  127, 47, 226,  255, 1 },
-	{ 64814, 6622, 5399,  127, 47, 226,  236, 23 },
-	{ 62855, 59193, 60393,  127, 0, 127,  122, 25 },
-	{ 62855, 59193, 5454,  127, 0, 127,  122, 229 },
-	{ 64814, 59193, 5454,  127, 0, 127,  132, 229 },
-	{ 62855, 59193, 60393,  127, 46, 226,  18, 232 },
-	{ 64814, 59193, 60393,  127, 46, 226,  18, 232 },
-	{ 64814, 64973, 65135,  127, 46, 226,  0, 255 },
-	{ 62855, 59193, 5454,  127, 51, 24,  236, 232 },
-	{ 64814, 64973, 1186,  127, 51, 24,  253, 255 },
-	{ 64814, 59193, 5454,  127, 51, 24,  236, 232 },
-	{ 62855, 6405, 5691,  127, 208, 28,  235, 22 },
-	{ 64814, 6405, 5691,  127, 208, 28,  235, 22 },
-	{ 64814, 625, 949,  127, 208, 28,  254, 0 },
-	{ 62855, 6796, 60501,  127, 51, 25,  18, 24 },
-	{ 64814, 6796, 60501,  127, 51, 25,  18, 24 },
-	{ 64814, 785, 64975,  127, 51, 25,  0, 0 },
-	{ 62855, 58783, 5399,  127, 203, 229,  236, 230 },
-	{ 64814, 58783, 5399,  127, 203, 229,  236, 230 },
-	{ 64814, 64794, 926,  127, 203, 229,  254, 254 },
-	{ 62855, 6199, 60472,  255, 127, 127,  18, 22 },
-	{ 62855, 6199, 53077,  255, 127, 127,  47, 22 },
-	{ 62855, 59160, 53077,  255, 127, 127,  47, 231 },
-	{ 62855, 6199, 52562,  255, 127, 127,  49, 22 },
-	{ 62855, 6199, 45168,  255, 127, 127,  79, 22 },
-	{ 62855, 59160, 45168,  255, 127, 127,  79, 231 },
-	{ 62855, 6199, 44653,  255, 127, 127,  81, 22 },
-	{ 62855, 6199, 37259,  255, 127, 127,  110, 22 },
-	{ 62855, 59160, 37259,  255, 127, 127,  110, 231 },
-	{ 62855, 6199, 36744,  255, 127, 127,  112, 22 },
-	{ 62855, 6199, 29349,  255, 127, 127,  141, 22 },
-	{ 62855, 59160, 29349,  255, 127, 127,  141, 231 },
-	{ 62855, 6199, 28835,  255, 127, 127,  143, 22 },
-	{ 62855, 6199, 21440,  255, 127, 127,  173, 22 },
-	{ 62855, 59160, 21440,  255, 127, 127,  173, 231 },
-	{ 62855, 6199, 20925,  255, 127, 127,  175, 22 },
-	{ 62855, 6199, 13531,  255, 127, 127,  204, 22 },
-	{ 62855, 59160, 13531,  255, 127, 127,  204, 231 },
-	{ 62855, 6199, 13016,  255, 127, 127,  206, 22 },
-	{ 62855, 6199, 5622,  255, 127, 127,  235, 22 },
-	{ 62855, 59160, 5622,  255, 127, 127,  235, 231 },
-	{ 61228, 6199, 60472,  0, 127, 127,  18, 22 },
-	{ 61228, 59160, 60472,  0, 127, 127,  18, 231 },
-	{ 61228, 6199, 53077,  0, 127, 127,  47, 22 },
-	{ 61228, 6199, 52562,  0, 127, 127,  49, 22 },
-	{ 61228, 59160, 52562,  0, 127, 127,  49, 231 },
-	{ 61228, 6199, 45168,  0, 127, 127,  79, 22 },
-	{ 61228, 6199, 44653,  0, 127, 127,  81, 22 },
-	{ 61228, 59160, 44653,  0, 127, 127,  81, 231 },
-	{ 61228, 6199, 37259,  0, 127, 127,  110, 22 },
-	{ 61228, 6199, 36744,  0, 127, 127,  112, 22 },
-	{ 61228, 59160, 36744,  0, 127, 127,  112, 231 },
-	{ 61228, 6199, 29349,  0, 127, 127,  141, 22 },
-	{ 61228, 6199, 28835,  0, 127, 127,  143, 22 },
-	{ 61228, 59160, 28835,  0, 127, 127,  143, 231 },
-	{ 61228, 6199, 21440,  0, 127, 127,  173, 22 },
-	{ 61228, 6199, 20925,  0, 127, 127,  175, 22 },
-	{ 61228, 59160, 20925,  0, 127, 127,  175, 231 },
-	{ 61228, 6199, 13531,  0, 127, 127,  204, 22 },
-	{ 61228, 6199, 13016,  0, 127, 127,  206, 22 },
-	{ 61228, 59160, 13016,  0, 127, 127,  206, 231 },
-	{ 61228, 6199, 5622,  0, 127, 127,  235, 22 },
-	{ 62855, 59160, 5622,  127, 255, 127,  235, 231 },
-	{ 61228, 59160, 5622,  127, 255, 127,  235, 231 },
-	{ 61228, 59160, 13016,  127, 255, 127,  206, 231 },
-	{ 62855, 6199, 20925,  127, 0, 127,  175, 22 },
-	{ 61228, 6199, 20925,  127, 0, 127,  175, 22 },
-	{ 61228, 6199, 13531,  127, 0, 127,  204, 22 },
-	{ 62855, 59160, 36744,  127, 127, 255,  112, 231 },
-	{ 61228, 59160, 36744,  127, 127, 255,  112, 231 },
-	{ 62855, 6199, 36744,  127, 127, 255,  112, 22 },
-	{ 62855, 6199, 37259,  127, 127, 0,  110, 22 },
-	{ 61228, 6199, 37259,  127, 127, 0,  110, 22 },
-	{ 61228, 59160, 37259,  127, 127, 0,  110, 231 },
-	{ 62855, 59160, 45168,  127, 255, 127,  79, 231 },
-	{ 61228, 59160, 45168,  127, 255, 127,  79, 231 },
-	{ 61228, 59160, 52562,  127, 255, 127,  49, 231 },
-	{ 62855, 6199, 60472,  127, 0, 127,  18, 22 },
-	{ 61228, 6199, 60472,  127, 0, 127,  18, 22 },
-	{ 61228, 6199, 53077,  127, 0, 127,  47, 22 },
-	{ 62855, 6199, 5622,  127, 127, 0,  235, 22 },
-	{ 61228, 6199, 5622,  127, 127, 0,  235, 22 },
-	{ 62855, 59160, 5622,  127, 127, 0,  235, 231 },
-	{ 62855, 59160, 13531,  127, 255, 127,  204, 231 },
-	{ 61228, 59160, 13531,  127, 255, 127,  204, 231 },
-	{ 61228, 59160, 20925,  127, 255, 127,  175, 231 },
-	{ 62855, 6199, 28835,  127, 0, 127,  143, 22 },
-	{ 61228, 6199, 28835,  127, 0, 127,  143, 22 },
-	{ 62855, 6199, 21440,  127, 0, 127,  173, 22 },
-	{ 62855, 59160, 44653,  127, 127, 255,  81, 231 },
-	{ 61228, 59160, 44653,  127, 127, 255,  81, 231 },
-	{ 62855, 6199, 44653,  127, 127, 255,  81, 22 },
-	{ 62855, 6199, 45168,  127, 127, 0,  79, 22 },
-	{ 61228, 6199, 45168,  127, 127, 0,  79, 22 },
-	{ 61228, 59160, 45168,  127, 127, 0,  79, 231 },
-	{ 62855, 59160, 53077,  127, 255, 127,  47, 231 },
-	{ 61228, 59160, 53077,  127, 255, 127,  47, 231 },
-	{ 61228, 59160, 60472,  127, 255, 127,  18, 231 },
-	{ 62855, 59160, 13016,  127, 127, 255,  206, 231 },
-	{ 61228, 59160, 13016,  127, 127, 255,  206, 231 },
-	{ 62855, 6199, 13016,  127, 127, 255,  206, 22 },
-	{ 62855, 6199, 13531,  127, 127, 0,  204, 22 },
-	{ 61228, 6199, 13531,  127, 127, 0,  204, 22 },
-	{ 62855, 59160, 13531,  127, 127, 0,  204, 231 },
-	{ 62855, 59160, 21440,  127, 255, 127,  173, 231 },
-	{ 61228, 59160, 21440,  127, 255, 127,  173, 231 },
-	{ 61228, 59160, 28835,  127, 255, 127,  143, 231 },
-	{ 62855, 6199, 36744,  127, 0, 127,  112, 22 },
-	{ 61228, 6199, 36744,  127, 0, 127,  112, 22 },
-	{ 61228, 6199, 29349,  127, 0, 127,  141, 22 },
-	{ 62855, 59160, 52562,  127, 127, 255,  49, 231 },
-	{ 61228, 59160, 52562,  127, 127, 255,  49, 231 },
-	{ 62855, 6199, 52562,  127, 127, 255,  49, 22 },
-	{ 62855, 6199, 53077,  127, 127, 0,  47, 22 },
-	{ 61228, 6199, 53077,  127, 127, 0,  47, 22 },
-	{ 62855, 59160, 53077,  127, 127, 0,  47, 231 },
-	{ 62855, 59160, 20925,  127, 127, 255,  175, 231 },
-	{ 61228, 59160, 20925,  127, 127, 255,  175, 231 },
-	{ 62855, 6199, 20925,  127, 127, 255,  175, 22 },
-	{ 62855, 6199, 21440,  127, 127, 0,  173, 22 },
-	{ 61228, 6199, 21440,  127, 127, 0,  173, 22 },
-	{ 62855, 59160, 21440,  127, 127, 0,  173, 231 },
-	{ 62855, 59160, 29349,  127, 255, 127,  141, 231 },
-	{ 61228, 59160, 29349,  127, 255, 127,  141, 231 },
-	{ 61228, 59160, 36744,  127, 255, 127,  112, 231 },
-	{ 62855, 6199, 44653,  127, 0, 127,  81, 22 },
-	{ 61228, 6199, 44653,  127, 0, 127,  81, 22 },
-	{ 61228, 6199, 37259,  127, 0, 127,  110, 22 },
-	{ 62855, 59160, 60472,  127, 127, 255,  18, 231 },
-	{ 61228, 59160, 60472,  127, 127, 255,  18, 231 },
-	{ 62855, 6199, 60472,  127, 127, 255,  18, 22 },
-	{ 62855, 6199, 13016,  127, 0, 127,  206, 22 },
-	{ 61228, 6199, 13016,  127, 0, 127,  206, 22 },
-	{ 61228, 6199, 5622,  127, 0, 127,  235, 22 },
-	{ 62855, 59160, 28835,  127, 127, 255,  143, 231 },
-	{ 61228, 59160, 28835,  127, 127, 255,  143, 231 },
-	{ 62855, 6199, 28835,  127, 127, 255,  143, 22 },
-	{ 62855, 6199, 29349,  127, 127, 0,  141, 22 },
-	{ 61228, 6199, 29349,  127, 127, 0,  141, 22 },
-	{ 62855, 59160, 29349,  127, 127, 0,  141, 231 },
-	{ 62855, 59160, 37259,  127, 255, 127,  110, 231 },
-	{ 61228, 59160, 37259,  127, 255, 127,  110, 231 },
-	{ 61228, 59160, 44653,  127, 255, 127,  81, 231 },
-	{ 62855, 6199, 52562,  127, 0, 127,  49, 22 },
-	{ 61228, 6199, 52562,  127, 0, 127,  49, 22 },
-	{ 61228, 6199, 45168,  127, 0, 127,  79, 22 },
-	{ 64814, 64794, 926,  255, 127, 127,  254, 254 },
-	{ 64814, 58783, 5399,  255, 127, 127,  236, 230 },
-	{ 64814, 958, 815,  255, 127, 127,  255, 1 },
-	{ 64510, 11146, 60231,  254, 135, 136,  81, 22 },
-	{ 65204, 6685, 54375,  254, 135, 136,  110, 22 },
-	{ 64688, 58832, 11769,  254, 135, 136,  81, 231 },
-	{ 62891, 11058, 60106,  0, 119, 118,  81, 22 },
-	{ 63069, 58744, 11644,  0, 119, 118,  81, 231 },
-	{ 63762, 54283, 5788,  0, 119, 118,  110, 231 },
-	{ 65204, 6685, 54375,  139, 36, 38,  131, 27 },
-	{ 63584, 6597, 54250,  139, 36, 38,  123, 27 },
-	{ 65382, 54371, 5912,  139, 36, 38,  131, 227 },
-	{ 64688, 58832, 11769,  115, 218, 216,  131, 27 },
-	{ 63069, 58744, 11644,  115, 218, 216,  123, 27 },
-	{ 64510, 11146, 60231,  115, 218, 216,  131, 227 },
-	{ 64510, 11146, 60231,  127, 26, 204,  80, 29 },
-	{ 62891, 11058, 60106,  127, 26, 204,  81, 22 },
-	{ 65204, 6685, 54375,  127, 26, 204,  110, 29 },
-	{ 65382, 54371, 5912,  127, 228, 50,  109, 226 },
-	{ 63762, 54283, 5788,  127, 228, 50,  110, 231 },
-	{ 63069, 58744, 11644,  127, 228, 50,  81, 231 },
-	{ 64814, 6796, 60501,  255, 127, 127,  18, 24 },
-	{ 64814, 58957, 60501,  255, 127, 127,  18, 231 },
-	{ 64814, 64621, 65086,  255, 127, 127,  0, 253 },
-	{ 64814, 59193, 60393,  255, 127, 127,  18, 232 },
-	{ 64814, 59193, 5454,  255, 127, 127,  236, 232 },
-	{ 64814, 64973, 1186,  255, 127, 127,  253, 255 },
-	{ 64814, 6405, 5691,  255, 127, 127,  235, 22 },
-	{ 64814, 6405, 60630,  255, 127, 127,  17, 22 },
-	{ 64814, 625, 64898,  255, 127, 127,  0, 0 },
-	{ 64814, 625, 64898,  6, 86, 127,  0, 0 },
-	{ 62855, 6405, 60630,  6, 86, 127,  17, 22 },
-	{ 64814, 625, 949,  6, 86, 127,  254, 0 },
-	{ 64814, 6796, 60501,  127, 127, 0,  132, 25 },
-	{ 62855, 6796, 60501,  127, 127, 0,  122, 25 },
-	{ 64814, 58957, 60501,  127, 127, 0,  132, 229 },
-	{ 64814, 958, 815,  10, 127, 77,  255, 1 },
-	{ 62855, 6622, 5399,  10, 127, 77,  236, 23 },
-	{ 64814, 64794, 926,  10, 127, 77,  254, 254 },
-	{ 64814, 58783, 5399,  127, 127, 255,  132, 25 },
-	{ 62855, 58783, 5399,  127, 127, 255,  122, 25 },
-	{ 64814, 6622, 5399,  127, 127, 255,  132, 229 },
-	{ 64814, 6405, 5691,  127, 255, 127,  132, 25 },
-	{ 62855, 6405, 5691,  127, 255, 127,  122, 25 },
-	{ 64814, 6405, 60630,  127, 255, 127,  132, 229 },
-	{ 64814, 64621, 65086,  10, 127, 177,  0, 253 },
-	{ 62855, 58957, 60501,  10, 127, 177,  18, 231 },
-	{ 64814, 785, 64975,  10, 127, 177,  0, 0 },
-	{ 64814, 64973, 1186,  6, 168, 127,  253, 255 },
-	{ 62855, 59193, 5454,  6, 168, 127,  236, 232 },
-	{ 64814, 64973, 65135,  6, 168, 127,  0, 255 },
-	{ 64814, 59193, 60393,  127, 0, 127,  132, 25 },
-	{ 62855, 59193, 60393,  127, 0, 127,  122, 25 },
-	{ 64814, 59193, 5454,  127, 0, 127,  132, 229 },
-	{ 62855, 59160, 60472,  255, 127, 127,  18, 231 },
-	{ 62855, 6199, 60472,  255, 127, 127,  18, 22 },
-	{ 62855, 59160, 53077,  255, 127, 127,  47, 231 },
-	{ 62855, 59160, 52562,  255, 127, 127,  49, 231 },
-	{ 62855, 6199, 52562,  255, 127, 127,  49, 22 },
-	{ 62855, 59160, 45168,  255, 127, 127,  79, 231 },
-	{ 62855, 59160, 44653,  255, 127, 127,  81, 231 },
-	{ 62855, 6199, 44653,  255, 127, 127,  81, 22 },
-	{ 62855, 59160, 37259,  255, 127, 127,  110, 231 },
-	{ 62855, 59160, 36744,  255, 127, 127,  112, 231 },
-	{ 62855, 6199, 36744,  255, 127, 127,  112, 22 },
-	{ 62855, 59160, 29349,  255, 127, 127,  141, 231 },
-	{ 62855, 59160, 28835,  255, 127, 127,  143, 231 },
-	{ 62855, 6199, 28835,  255, 127, 127,  143, 22 },
-	{ 62855, 59160, 21440,  255, 127, 127,  173, 231 },
-	{ 62855, 59160, 20925,  255, 127, 127,  175, 231 },
-	{ 62855, 6199, 20925,  255, 127, 127,  175, 22 },
-	{ 62855, 59160, 13531,  255, 127, 127,  204, 231 },
-	{ 62855, 59160, 13016,  255, 127, 127,  206, 231 },
-	{ 62855, 6199, 13016,  255, 127, 127,  206, 22 },
-	{ 62855, 59160, 5622,  255, 127, 127,  235, 231 },
-	{ 61228, 59160, 60472,  0, 127, 127,  18, 231 },
-	{ 61228, 59160, 53077,  0, 127, 127,  47, 231 },
-	{ 61228, 6199, 53077,  0, 127, 127,  47, 22 },
-	{ 61228, 59160, 52562,  0, 127, 127,  49, 231 },
-	{ 61228, 59160, 45168,  0, 127, 127,  79, 231 },
-	{ 61228, 6199, 45168,  0, 127, 127,  79, 22 },
-	{ 61228, 59160, 44653,  0, 127, 127,  81, 231 },
-	{ 61228, 59160, 37259,  0, 127, 127,  110, 231 },
-	{ 61228, 6199, 37259,  0, 127, 127,  110, 22 },
-	{ 61228, 59160, 36744,  0, 127, 127,  112, 231 },
-	{ 61228, 59160, 29349,  0, 127, 127,  141, 231 },
-	{ 61228, 6199, 29349,  0, 127, 127,  141, 22 },
-	{ 61228, 59160, 28835,  0, 127, 127,  143, 231 },
-	{ 61228, 59160, 21440,  0, 127, 127,  173, 231 },
-	{ 61228, 6199, 21440,  0, 127, 127,  173, 22 },
-	{ 61228, 59160, 20925,  0, 127, 127,  175, 231 },
-	{ 61228, 59160, 13531,  0, 127, 127,  204, 231 },
-	{ 61228, 6199, 13531,  0, 127, 127,  204, 22 },
-	{ 61228, 59160, 13016,  0, 127, 127,  206, 231 },
-	{ 61228, 59160, 5622,  0, 127, 127,  235, 231 },
-	{ 61228, 6199, 5622,  0, 127, 127,  235, 22 },
-	{ 62855, 59160, 13016,  127, 255, 127,  206, 231 },
-	{ 62855, 59160, 5622,  127, 255, 127,  235, 231 },
-	{ 61228, 59160, 13016,  127, 255, 127,  206, 231 },
-	{ 62855, 6199, 13531,  127, 0, 127,  204, 22 },
-	{ 62855, 6199, 20925,  127, 0, 127,  175, 22 },
-	{ 61228, 6199, 13531,  127, 0, 127,  204, 22 },
-	{ 61228, 59160, 36744,  127, 127, 255,  112, 231 },
-	{ 61228, 6199, 36744,  127, 127, 255,  112, 22 },
-	{ 62855, 6199, 36744,  127, 127, 255,  112, 22 },
-	{ 62855, 59160, 37259,  127, 127, 0,  110, 231 },
-	{ 62855, 6199, 37259,  127, 127, 0,  110, 22 },
-	{ 61228, 59160, 37259,  127, 127, 0,  110, 231 },
-	{ 62855, 59160, 52562,  127, 255, 127,  49, 231 },
-	{ 62855, 59160, 45168,  127, 255, 127,  79, 231 },
-	{ 61228, 59160, 52562,  127, 255, 127,  49, 231 },
-	{ 62855, 6199, 53077,  127, 0, 127,  47, 22 },
-	{ 62855, 6199, 60472,  127, 0, 127,  18, 22 },
-	{ 61228, 6199, 53077,  127, 0, 127,  47, 22 },
-	{ 61228, 6199, 5622,  127, 127, 0,  235, 22 },
-	{ 61228, 59160, 5622,  127, 127, 0,  235, 231 },
-	{ 62855, 59160, 5622,  127, 127, 0,  235, 231 },
-	{ 62855, 59160, 20925,  127, 255, 127,  175, 231 },
-	{ 62855, 59160, 13531,  127, 255, 127,  204, 231 },
-	{ 61228, 59160, 20925,  127, 255, 127,  175, 231 },
-	{ 61228, 6199, 28835,  127, 0, 127,  143, 22 },
-	{ 61228, 6199, 21440,  127, 0, 127,  173, 22 },
-	{ 62855, 6199, 21440,  127, 0, 127,  173, 22 },
-	{ 61228, 59160, 44653,  127, 127, 255,  81, 231 },
-	{ 61228, 6199, 44653,  127, 127, 255,  81, 22 },
-	{ 62855, 6199, 44653,  127, 127, 255,  81, 22 },
-	{ 62855, 59160, 45168,  127, 127, 0,  79, 231 },
-	{ 62855, 6199, 45168,  127, 127, 0,  79, 22 },
-	{ 61228, 59160, 45168,  127, 127, 0,  79, 231 },
-	{ 62855, 59160, 60472,  127, 255, 127,  18, 231 },
-	{ 62855, 59160, 53077,  127, 255, 127,  47, 231 },
-	{ 61228, 59160, 60472,  127, 255, 127,  18, 231 },
-	{ 61228, 59160, 13016,  127, 127, 255,  206, 231 },
-	{ 61228, 6199, 13016,  127, 127, 255,  206, 22 },
-	{ 62855, 6199, 13016,  127, 127, 255,  206, 22 },
-	{ 61228, 6199, 13531,  127, 127, 0,  204, 22 },
-	{ 61228, 59160, 13531,  127, 127, 0,  204, 231 },
-	{ 62855, 59160, 13531,  127, 127, 0,  204, 231 },
-	{ 62855, 59160, 28835,  127, 255, 127,  143, 231 },
-	{ 62855, 59160, 21440,  127, 255, 127,  173, 231 },
-	{ 61228, 59160, 28835,  127, 255, 127,  143, 231 },
-	{ 62855, 6199, 29349,  127, 0, 127,  141, 22 },
-	{ 62855, 6199, 36744,  127, 0, 127,  112, 22 },
-	{ 61228, 6199, 29349,  127, 0, 127,  141, 22 },
-	{ 61228, 59160, 52562,  127, 127, 255,  49, 231 },
-	{ 61228, 6199, 52562,  127, 127, 255,  49, 22 },
-	{ 62855, 6199, 52562,  127, 127, 255,  49, 22 },
-	{ 61228, 6199, 53077,  127, 127, 0,  47, 22 },
-	{ 61228, 59160, 53077,  127, 127, 0,  47, 231 },
-	{ 62855, 59160, 53077,  127, 127, 0,  47, 231 },
-	{ 61228, 59160, 20925,  127, 127, 255,  175, 231 },
-	{ 61228, 6199, 20925,  127, 127, 255,  175, 22 },
-	{ 62855, 6199, 20925,  127, 127, 255,  175, 22 },
-	{ 61228, 6199, 21440,  127, 127, 0,  173, 22 },
-	{ 61228, 59160, 21440,  127, 127, 0,  173, 231 },
-	{ 62855, 59160, 21440,  127, 127, 0,  173, 231 },
-	{ 62855, 59160, 36744,  127, 255, 127,  112, 231 },
-	{ 62855, 59160, 29349,  127, 255, 127,  141, 231 },
-	{ 61228, 59160, 36744,  127, 255, 127,  112, 231 },
-	{ 62855, 6199, 37259,  127, 0, 127,  110, 22 },
-	{ 62855, 6199, 44653,  127, 0, 127,  81, 22 },
-	{ 61228, 6199, 37259,  127, 0, 127,  110, 22 },
-	{ 61228, 59160, 60472,  127, 127, 255,  18, 231 },
-	{ 61228, 6199, 60472,  127, 127, 255,  18, 22 },
-	{ 62855, 6199, 60472,  127, 127, 255,  18, 22 },
-	{ 62855, 6199, 5622,  127, 0, 127,  235, 22 },
-	{ 62855, 6199, 13016,  127, 0, 127,  206, 22 },
-	{ 61228, 6199, 5622,  127, 0, 127,  235, 22 },
-	{ 61228, 59160, 28835,  127, 127, 255,  143, 231 },
-	{ 61228, 6199, 28835,  127, 127, 255,  143, 22 },
-	{ 62855, 6199, 28835,  127, 127, 255,  143, 22 },
-	{ 61228, 6199, 29349,  127, 127, 0,  141, 22 },
-	{ 61228, 59160, 29349,  127, 127, 0,  141, 231 },
-	{ 62855, 59160, 29349,  127, 127, 0,  141, 231 },
-	{ 62855, 59160, 44653,  127, 255, 127,  81, 231 },
-	{ 62855, 59160, 37259,  127, 255, 127,  110, 231 },
-	{ 61228, 59160, 44653,  127, 255, 127,  81, 231 },
-	{ 62855, 6199, 45168,  127, 0, 127,  79, 22 },
-	{ 62855, 6199, 52562,  127, 0, 127,  49, 22 },
-	{ 61228, 6199, 45168,  127, 0, 127,  79, 22 },
-	{ 64814, 58783, 5399,  255, 127, 127,  236, 230 },
-	{ 64814, 6622, 5399,  255, 127, 127,  236, 23 },
-	{ 64814, 958, 815,  255, 127, 127,  255, 1 },
-	{ 65204, 6685, 54375,  254, 135, 136,  110, 22 },
-	{ 65382, 54371, 5912,  254, 135, 136,  110, 231 },
-	{ 64688, 58832, 11769,  254, 135, 136,  81, 231 },
-	{ 63584, 6597, 54250,  0, 119, 118,  110, 22 },
-	{ 62891, 11058, 60106,  0, 119, 118,  81, 22 },
-	{ 63762, 54283, 5788,  0, 119, 118,  110, 231 },
-	{ 63584, 6597, 54250,  139, 36, 38,  123, 27 },
-	{ 63762, 54283, 5788,  139, 36, 38,  123, 227 },
-	{ 65382, 54371, 5912,  139, 36, 38,  131, 227 },
-	{ 63069, 58744, 11644,  115, 218, 216,  123, 27 },
-	{ 62891, 11058, 60106,  115, 218, 216,  123, 227 },
-	{ 64510, 11146, 60231,  115, 218, 216,  131, 227 },
-	{ 62891, 11058, 60106,  127, 26, 204,  81, 22 },
-	{ 63584, 6597, 54250,  127, 26, 204,  110, 22 },
-	{ 65204, 6685, 54375,  127, 26, 204,  110, 29 },
-	{ 64688, 58832, 11769,  127, 228, 50,  82, 225 },
-	{ 65382, 54371, 5912,  127, 228, 50,  109, 226 },
-	{ 63069, 58744, 11644,  127, 228, 50,  81, 231 },
+const vertex_position_t positions1[] =
+{ // position[xyz]
+	{ 806, 785, 64548 },
+	{ 5279, 6796, 64548 },
+	{ 5279, 58957, 64548 },
+	{ 645, 64973, 64548 },
+	{ 5387, 59193, 64548 },
+	{ 64594, 64973, 64548 },
+	{ 64831, 625, 64548 },
+	{ 60089, 6405, 64548 },
+	{ 5150, 6405, 64548 },
+	{ 5150, 6405, 62589 },
+	{ 60089, 6405, 62589 },
+	{ 883, 625, 64548 },
+	{ 5279, 6796, 62589 },
+	{ 5279, 58957, 62589 },
+	{ 5279, 58957, 64548 },
+	{ 60381, 6622, 62589 },
+	{ 60381, 58783, 62589 },
+	{ 64966, 958, 64548 },
+	{ 60381, 58783, 62589 },
+	{ 60381, 6622, 62589 },
+	{ 60381, 58783, 64548 },
+	{ 60089, 6405, 62589 },
+	{ 5150, 6405, 62589 },
+	{ 5150, 6405, 64548 },
+	{ 5279, 58957, 62589 },
+	{ 695, 64621, 64548 },
+	{ 5279, 58957, 64548 },
+	{ 5279, 58957, 62589 },
+	{ 5279, 6796, 62589 },
+	{ 806, 785, 64548 },
+	{ 5150, 6405, 62589 },
+	{ 883, 625, 64548 },
+	{ 5150, 6405, 64548 },
+	{ 60326, 59193, 62589 },
+	{ 5387, 59193, 62589 },
+	{ 645, 64973, 64548 },
+	{ 60381, 6622, 62589 },
+	{ 64966, 958, 64548 },
+	{ 60381, 6622, 64548 },
+	{ 5387, 59193, 62589 },
+	{ 60326, 59193, 62589 },
+	{ 5387, 59193, 64548 },
+	{ 5387, 59193, 62589 },
+	{ 5387, 59193, 64548 },
+	{ 645, 64973, 64548 },
+	{ 60326, 59193, 62589 },
+	{ 64594, 64973, 64548 },
+	{ 60326, 59193, 64548 },
+	{ 60089, 6405, 62589 },
+	{ 60089, 6405, 64548 },
+	{ 64831, 625, 64548 },
+	{ 5279, 6796, 62589 },
+	{ 5279, 6796, 64548 },
+	{ 806, 785, 64548 },
+	{ 60381, 58783, 62589 },
+	{ 60381, 58783, 64548 },
+	{ 64855, 64794, 64548 },
+	{ 5309, 6199, 62589 },
+	{ 12703, 6199, 62589 },
+	{ 12703, 59160, 62589 },
+	{ 13218, 6199, 62589 },
+	{ 20613, 6199, 62589 },
+	{ 13218, 59160, 62589 },
+	{ 21127, 6199, 62589 },
+	{ 28522, 6199, 62589 },
+	{ 28522, 59160, 62589 },
+	{ 29037, 6199, 62589 },
+	{ 36431, 6199, 62589 },
+	{ 36431, 59160, 62589 },
+	{ 36946, 6199, 62589 },
+	{ 44340, 6199, 62589 },
+	{ 44340, 59160, 62589 },
+	{ 44855, 6199, 62589 },
+	{ 52250, 6199, 62589 },
+	{ 44855, 59160, 62589 },
+	{ 52764, 6199, 62589 },
+	{ 60159, 6199, 62589 },
+	{ 60159, 59160, 62589 },
+	{ 5309, 6199, 60962 },
+	{ 5309, 59160, 60962 },
+	{ 12703, 6199, 60962 },
+	{ 13218, 6199, 60962 },
+	{ 13218, 59160, 60962 },
+	{ 20613, 59160, 60962 },
+	{ 21127, 6199, 60962 },
+	{ 21127, 59160, 60962 },
+	{ 28522, 59160, 60962 },
+	{ 29037, 6199, 60962 },
+	{ 29037, 59160, 60962 },
+	{ 36431, 6199, 60962 },
+	{ 36946, 6199, 60962 },
+	{ 36946, 59160, 60962 },
+	{ 44340, 6199, 60962 },
+	{ 44855, 6199, 60962 },
+	{ 44855, 59160, 60962 },
+	{ 52250, 59160, 60962 },
+	{ 52764, 6199, 60962 },
+	{ 52765, 59160, 60962 },
+	{ 60159, 59160, 60962 },
+	{ 60159, 59160, 62589 },
+	{ 60159, 59160, 60962 },
+	{ 52765, 59160, 60962 },
+	{ 44855, 6199, 62589 },
+	{ 44855, 6199, 60962 },
+	{ 52250, 6199, 62589 },
+	{ 29037, 59160, 62589 },
+	{ 29037, 59160, 60962 },
+	{ 29037, 6199, 62589 },
+	{ 28522, 6199, 62589 },
+	{ 28522, 6199, 60962 },
+	{ 28522, 59160, 60962 },
+	{ 20613, 59160, 62589 },
+	{ 20613, 59160, 60962 },
+	{ 13218, 59160, 60962 },
+	{ 5309, 6199, 62589 },
+	{ 5309, 6199, 60962 },
+	{ 12703, 6199, 62589 },
+	{ 60159, 6199, 62589 },
+	{ 60159, 6199, 60962 },
+	{ 60159, 59160, 60962 },
+	{ 52250, 59160, 62589 },
+	{ 52250, 59160, 60962 },
+	{ 44855, 59160, 60962 },
+	{ 36946, 6199, 62589 },
+	{ 36946, 6199, 60962 },
+	{ 44340, 6199, 62589 },
+	{ 21127, 59160, 62589 },
+	{ 21127, 59160, 60962 },
+	{ 21127, 6199, 62589 },
+	{ 20613, 6199, 62589 },
+	{ 20613, 6199, 60962 },
+	{ 20613, 59160, 60962 },
+	{ 12703, 59160, 62589 },
+	{ 12703, 59160, 60962 },
+	{ 5309, 59160, 60962 },
+	{ 52765, 59160, 62589 },
+	{ 52765, 59160, 60962 },
+	{ 52764, 6199, 62589 },
+	{ 52250, 6199, 62589 },
+	{ 52250, 6199, 60962 },
+	{ 52250, 59160, 60962 },
+	{ 44340, 59160, 62589 },
+	{ 44340, 59160, 60962 },
+	{ 36946, 59160, 60962 },
+	{ 29037, 6199, 62589 },
+	{ 29037, 6199, 60962 },
+	{ 36431, 6199, 62589 },
+	{ 13218, 59160, 62589 },
+	{ 13218, 59160, 60962 },
+	{ 13218, 6199, 62589 },
+	{ 12703, 6199, 62589 },
+	{ 12703, 6199, 60962 },
+	{ 12703, 59160, 60962 },
+	{ 44855, 59160, 62589 },
+	{ 44855, 59160, 60962 },
+	{ 44855, 6199, 62589 },
+	{ 44340, 6199, 62589 },
+	{ 44340, 6199, 60962 },
+	{ 44340, 59160, 60962 },
+	{ 36431, 59160, 62589 },
+	{ 36431, 59160, 60962 },
+	{ 29037, 59160, 60962 },
+	{ 21127, 6199, 62589 },
+	{ 21127, 6199, 60962 },
+	{ 28522, 6199, 62589 },
+	{ 5309, 59160, 62589 },
+	{ 5309, 59160, 60962 },
+	{ 5309, 6199, 62589 },
+	{ 52764, 6199, 62589 },
+	{ 52764, 6199, 60962 },
+	{ 60159, 6199, 62589 },
+	{ 36946, 59160, 62589 },
+	{ 36946, 59160, 60962 },
+	{ 36946, 6199, 62589 },
+	{ 36431, 6199, 62589 },
+	{ 36431, 6199, 60962 },
+	{ 36431, 59160, 60962 },
+	{ 28522, 59160, 62589 },
+	{ 28522, 59160, 60962 },
+	{ 21127, 59160, 60962 },
+	{ 13218, 6199, 62589 },
+	{ 13218, 6199, 60962 },
+	{ 20613, 6199, 62589 },
+	{ 64855, 64794, 64548 },
+	{ 60381, 58783, 64548 },
+	{ 60381, 6622, 64548 },
+	{ 5549, 11146, 64244 },
+	{ 11406, 6685, 64937 },
+	{ 59868, 54371, 65115 },
+	{ 5674, 11058, 62624 },
+	{ 54136, 58744, 62802 },
+	{ 11531, 6597, 63318 },
+	{ 11406, 6685, 64937 },
+	{ 11531, 6597, 63318 },
+	{ 59868, 54371, 65115 },
+	{ 54012, 58832, 64422 },
+	{ 54136, 58744, 62802 },
+	{ 5549, 11146, 64244 },
+	{ 5549, 11146, 64244 },
+	{ 5674, 11058, 62624 },
+	{ 11406, 6685, 64937 },
+	{ 59868, 54371, 65115 },
+	{ 59993, 54283, 63496 },
+	{ 54136, 58744, 62802 },
+	{ 695, 64621, 64548 },
+	{ 806, 785, 64548 },
+	{ 5279, 58957, 64548 },
+	{ 5387, 59193, 64548 },
+	{ 60326, 59193, 64548 },
+	{ 64594, 64973, 64548 },
+	{ 883, 625, 64548 },
+	{ 64831, 625, 64548 },
+	{ 5150, 6405, 64548 },
+	{ 60089, 6405, 62589 },
+	{ 64831, 625, 64548 },
+	{ 883, 625, 64548 },
+	{ 5279, 6796, 64548 },
+	{ 5279, 6796, 62589 },
+	{ 5279, 58957, 64548 },
+	{ 60381, 58783, 62589 },
+	{ 64855, 64794, 64548 },
+	{ 64966, 958, 64548 },
+	{ 60381, 6622, 62589 },
+	{ 60381, 6622, 64548 },
+	{ 60381, 58783, 64548 },
+	{ 60089, 6405, 64548 },
+	{ 60089, 6405, 62589 },
+	{ 5150, 6405, 64548 },
+	{ 695, 64621, 64548 },
+	{ 5279, 58957, 62589 },
+	{ 806, 785, 64548 },
+	{ 64594, 64973, 64548 },
+	{ 60326, 59193, 62589 },
+	{ 645, 64973, 64548 },
+	{ 60326, 59193, 62589 },
+	{ 60326, 59193, 64548 },
+	{ 5387, 59193, 64548 },
+	{ 5309, 59160, 62589 },
+	{ 5309, 6199, 62589 },
+	{ 12703, 59160, 62589 },
+	{ 20613, 6199, 62589 },
+	{ 20613, 59160, 62589 },
+	{ 13218, 59160, 62589 },
+	{ 21127, 59160, 62589 },
+	{ 21127, 6199, 62589 },
+	{ 28522, 59160, 62589 },
+	{ 29037, 59160, 62589 },
+	{ 29037, 6199, 62589 },
+	{ 36431, 59160, 62589 },
+	{ 36946, 59160, 62589 },
+	{ 36946, 6199, 62589 },
+	{ 44340, 59160, 62589 },
+	{ 52250, 6199, 62589 },
+	{ 52250, 59160, 62589 },
+	{ 44855, 59160, 62589 },
+	{ 52765, 59160, 62589 },
+	{ 52764, 6199, 62589 },
+	{ 60159, 59160, 62589 },
+	{ 5309, 59160, 60962 },
+	{ 12703, 59160, 60962 },
+	{ 12703, 6199, 60962 },
+	{ 20613, 6199, 60962 },
+	{ 13218, 6199, 60962 },
+	{ 20613, 59160, 60962 },
+	{ 28522, 6199, 60962 },
+	{ 21127, 6199, 60962 },
+	{ 28522, 59160, 60962 },
+	{ 29037, 59160, 60962 },
+	{ 36431, 59160, 60962 },
+	{ 36431, 6199, 60962 },
+	{ 36946, 59160, 60962 },
+	{ 44340, 59160, 60962 },
+	{ 44340, 6199, 60962 },
+	{ 52250, 6199, 60962 },
+	{ 44855, 6199, 60962 },
+	{ 52250, 59160, 60962 },
+	{ 60159, 6199, 60962 },
+	{ 52764, 6199, 60962 },
+	{ 60159, 59160, 60962 },
+	{ 52765, 59160, 62589 },
+	{ 60159, 59160, 62589 },
+	{ 52765, 59160, 60962 },
+	{ 44855, 6199, 60962 },
+	{ 52250, 6199, 60962 },
+	{ 52250, 6199, 62589 },
+	{ 29037, 59160, 60962 },
+	{ 29037, 6199, 60962 },
+	{ 29037, 6199, 62589 },
+	{ 28522, 59160, 62589 },
+	{ 28522, 6199, 62589 },
+	{ 28522, 59160, 60962 },
+	{ 13218, 59160, 62589 },
+	{ 20613, 59160, 62589 },
+	{ 13218, 59160, 60962 },
+	{ 5309, 6199, 60962 },
+	{ 12703, 6199, 60962 },
+	{ 12703, 6199, 62589 },
+	{ 60159, 59160, 62589 },
+	{ 60159, 6199, 62589 },
+	{ 60159, 59160, 60962 },
+	{ 44855, 59160, 62589 },
+	{ 52250, 59160, 62589 },
+	{ 44855, 59160, 60962 },
+	{ 36946, 6199, 60962 },
+	{ 44340, 6199, 60962 },
+	{ 44340, 6199, 62589 },
+	{ 21127, 59160, 60962 },
+	{ 21127, 6199, 60962 },
+	{ 21127, 6199, 62589 },
+	{ 20613, 59160, 62589 },
+	{ 20613, 6199, 62589 },
+	{ 20613, 59160, 60962 },
+	{ 5309, 59160, 62589 },
+	{ 12703, 59160, 62589 },
+	{ 5309, 59160, 60962 },
+	{ 52765, 59160, 60962 },
+	{ 52764, 6199, 60962 },
+	{ 52764, 6199, 62589 },
+	{ 52250, 59160, 62589 },
+	{ 52250, 6199, 62589 },
+	{ 52250, 59160, 60962 },
+	{ 36946, 59160, 62589 },
+	{ 44340, 59160, 62589 },
+	{ 36946, 59160, 60962 },
+	{ 29037, 6199, 60962 },
+	{ 36431, 6199, 60962 },
+	{ 36431, 6199, 62589 },
+	{ 13218, 59160, 60962 },
+	{ 13218, 6199, 60962 },
+	{ 13218, 6199, 62589 },
+	{ 12703, 59160, 62589 },
+	{ 12703, 6199, 62589 },
+	{ 12703, 59160, 60962 },
+	{ 44855, 59160, 60962 },
+	{ 44855, 6199, 60962 },
+	{ 44855, 6199, 62589 },
+	{ 44340, 59160, 62589 },
+	{ 44340, 6199, 62589 },
+	{ 44340, 59160, 60962 },
+	{ 29037, 59160, 62589 },
+	{ 36431, 59160, 62589 },
+	{ 29037, 59160, 60962 },
+	{ 21127, 6199, 60962 },
+	{ 28522, 6199, 60962 },
+	{ 28522, 6199, 62589 },
+	{ 5309, 59160, 60962 },
+	{ 5309, 6199, 60962 },
+	{ 5309, 6199, 62589 },
+	{ 52764, 6199, 60962 },
+	{ 60159, 6199, 60962 },
+	{ 60159, 6199, 62589 },
+	{ 36946, 59160, 60962 },
+	{ 36946, 6199, 60962 },
+	{ 36946, 6199, 62589 },
+	{ 36431, 59160, 62589 },
+	{ 36431, 6199, 62589 },
+	{ 36431, 59160, 60962 },
+	{ 21127, 59160, 62589 },
+	{ 28522, 59160, 62589 },
+	{ 21127, 59160, 60962 },
+	{ 13218, 6199, 60962 },
+	{ 20613, 6199, 60962 },
+	{ 20613, 6199, 62589 },
+	{ 64966, 958, 64548 },
+	{ 64855, 64794, 64548 },
+	{ 60381, 6622, 64548 },
+	{ 54012, 58832, 64422 },
+	{ 5549, 11146, 64244 },
+	{ 59868, 54371, 65115 },
+	{ 54136, 58744, 62802 },
+	{ 59993, 54283, 63496 },
+	{ 11531, 6597, 63318 },
+	{ 11531, 6597, 63318 },
+	{ 59993, 54283, 63496 },
+	{ 59868, 54371, 65115 },
+	{ 54136, 58744, 62802 },
+	{ 5674, 11058, 62624 },
+	{ 5549, 11146, 64244 },
+	{ 5674, 11058, 62624 },
+	{ 11531, 6597, 63318 },
+	{ 11406, 6685, 64937 },
+	{ 54012, 58832, 64422 },
+	{ 59868, 54371, 65115 },
+	{ 54136, 58744, 62802 },
+	{ 65241, 785, 966 },
+	{ 60767, 6796, 966 },
+	{ 65352, 64621, 966 },
+	{ 65401, 64973, 966 },
+	{ 60659, 59193, 966 },
+	{ 5720, 59193, 966 },
+	{ 1215, 625, 966 },
+	{ 5957, 6405, 966 },
+	{ 65164, 625, 966 },
+	{ 60896, 6405, 2926 },
+	{ 5957, 6405, 2926 },
+	{ 1215, 625, 966 },
+	{ 60767, 6796, 2926 },
+	{ 60768, 58957, 2926 },
+	{ 60767, 6796, 966 },
+	{ 5665, 6622, 2926 },
+	{ 5665, 58783, 2926 },
+	{ 1192, 64794, 966 },
+	{ 5665, 58783, 2926 },
+	{ 5665, 6622, 2926 },
+	{ 5665, 6622, 966 },
+	{ 5957, 6405, 2926 },
+	{ 60896, 6405, 2926 },
+	{ 60896, 6405, 966 },
+	{ 60768, 58957, 2926 },
+	{ 65352, 64621, 966 },
+	{ 60768, 58957, 966 },
+	{ 60768, 58957, 2926 },
+	{ 60767, 6796, 2926 },
+	{ 65352, 64621, 966 },
+	{ 60896, 6405, 2926 },
+	{ 65164, 625, 966 },
+	{ 60896, 6405, 966 },
+	{ 5720, 59193, 2926 },
+	{ 60659, 59193, 2926 },
+	{ 1453, 64973, 966 },
+	{ 5665, 6622, 2926 },
+	{ 1081, 958, 966 },
+	{ 5665, 6622, 966 },
+	{ 60659, 59193, 2926 },
+	{ 5720, 59193, 2926 },
+	{ 60659, 59193, 966 },
+	{ 60659, 59193, 2926 },
+	{ 60659, 59193, 966 },
+	{ 65401, 64973, 966 },
+	{ 5720, 59193, 2926 },
+	{ 1453, 64973, 966 },
+	{ 5720, 59193, 966 },
+	{ 5957, 6405, 2926 },
+	{ 5957, 6405, 966 },
+	{ 1215, 625, 966 },
+	{ 60767, 6796, 2926 },
+	{ 60767, 6796, 966 },
+	{ 65241, 785, 966 },
+	{ 5665, 58783, 2926 },
+	{ 5665, 58783, 966 },
+	{ 1192, 64794, 966 },
+	{ 60738, 6199, 2926 },
+	{ 53343, 6199, 2926 },
+	{ 53343, 59160, 2926 },
+	{ 52829, 6199, 2926 },
+	{ 45434, 6199, 2926 },
+	{ 45434, 59160, 2926 },
+	{ 44919, 6199, 2926 },
+	{ 37525, 6199, 2926 },
+	{ 37525, 59160, 2926 },
+	{ 37010, 6199, 2926 },
+	{ 29616, 6199, 2926 },
+	{ 37010, 59160, 2926 },
+	{ 29101, 6199, 2926 },
+	{ 21706, 6199, 2926 },
+	{ 29101, 59160, 2926 },
+	{ 21191, 6199, 2926 },
+	{ 13797, 6199, 2926 },
+	{ 13797, 59160, 2926 },
+	{ 13282, 6199, 2926 },
+	{ 5888, 6199, 2926 },
+	{ 5888, 59160, 2926 },
+	{ 60738, 6199, 4552 },
+	{ 60738, 59160, 4552 },
+	{ 53343, 6199, 4552 },
+	{ 52829, 6199, 4552 },
+	{ 52829, 59160, 4552 },
+	{ 45434, 6199, 4552 },
+	{ 44919, 6199, 4552 },
+	{ 44919, 59160, 4552 },
+	{ 37525, 6199, 4552 },
+	{ 37010, 6199, 4552 },
+	{ 37010, 59160, 4552 },
+	{ 29616, 6199, 4552 },
+	{ 29101, 6199, 4552 },
+	{ 29101, 59160, 4552 },
+	{ 21706, 59160, 4552 },
+	{ 21191, 6199, 4552 },
+	{ 21191, 59160, 4552 },
+	{ 13797, 6199, 4552 },
+	{ 13282, 6199, 4552 },
+	{ 13282, 59160, 4552 },
+	{ 5888, 6199, 4552 },
+	{ 5888, 59160, 2926 },
+	{ 5888, 59160, 4552 },
+	{ 13282, 59160, 2926 },
+	{ 21191, 6199, 2926 },
+	{ 21191, 6199, 4552 },
+	{ 13797, 6199, 4552 },
+	{ 37010, 59160, 2926 },
+	{ 37010, 59160, 4552 },
+	{ 37010, 6199, 4552 },
+	{ 37525, 6199, 2926 },
+	{ 37525, 6199, 4552 },
+	{ 37525, 59160, 2926 },
+	{ 45434, 59160, 2926 },
+	{ 45434, 59160, 4552 },
+	{ 52829, 59160, 2926 },
+	{ 60738, 6199, 2926 },
+	{ 60738, 6199, 4552 },
+	{ 53343, 6199, 4552 },
+	{ 5888, 6199, 2926 },
+	{ 5888, 6199, 4552 },
+	{ 5888, 59160, 2926 },
+	{ 13797, 59160, 2926 },
+	{ 13797, 59160, 4552 },
+	{ 21191, 59160, 2926 },
+	{ 29101, 6199, 2926 },
+	{ 29101, 6199, 4552 },
+	{ 21706, 6199, 4552 },
+	{ 44919, 59160, 2926 },
+	{ 44919, 59160, 4552 },
+	{ 44919, 6199, 4552 },
+	{ 45434, 6199, 2926 },
+	{ 45434, 6199, 4552 },
+	{ 45434, 59160, 2926 },
+	{ 53343, 59160, 2926 },
+	{ 53343, 59160, 4552 },
+	{ 60738, 59160, 2926 },
+	{ 13282, 59160, 2926 },
+	{ 13282, 59160, 4552 },
+	{ 13282, 6199, 4552 },
+	{ 13797, 6199, 2926 },
+	{ 13797, 6199, 4552 },
+	{ 13797, 59160, 2926 },
+	{ 21706, 59160, 2926 },
+	{ 21706, 59160, 4552 },
+	{ 29101, 59160, 2926 },
+	{ 37010, 6199, 2926 },
+	{ 37010, 6199, 4552 },
+	{ 29616, 6199, 4552 },
+	{ 52829, 59160, 2926 },
+	{ 52829, 59160, 4552 },
+	{ 52829, 6199, 4552 },
+	{ 53343, 6199, 2926 },
+	{ 53343, 6199, 4552 },
+	{ 53343, 59160, 2926 },
+	{ 21191, 59160, 2926 },
+	{ 21191, 59160, 4552 },
+	{ 21191, 6199, 4552 },
+	{ 21706, 6199, 2926 },
+	{ 21706, 6199, 4552 },
+	{ 21706, 59160, 2926 },
+	{ 29616, 59160, 2926 },
+	{ 29616, 59160, 4552 },
+	{ 37010, 59160, 2926 },
+	{ 44919, 6199, 2926 },
+	{ 44919, 6199, 4552 },
+	{ 37525, 6199, 4552 },
+	{ 60738, 59160, 2926 },
+	{ 60738, 59160, 4552 },
+	{ 60738, 6199, 4552 },
+	{ 13282, 6199, 2926 },
+	{ 13282, 6199, 4552 },
+	{ 5888, 6199, 4552 },
+	{ 29101, 59160, 2926 },
+	{ 29101, 59160, 4552 },
+	{ 29101, 6199, 4552 },
+	{ 29616, 6199, 2926 },
+	{ 29616, 6199, 4552 },
+	{ 29616, 59160, 2926 },
+	{ 37525, 59160, 2926 },
+	{ 37525, 59160, 4552 },
+	{ 44919, 59160, 2926 },
+	{ 52829, 6199, 2926 },
+	{ 52829, 6199, 4552 },
+	{ 45434, 6199, 4552 },
+	{ 1192, 64794, 966 },
+	{ 5665, 58783, 966 },
+	{ 1081, 958, 966 },
+	{ 60497, 11146, 1271 },
+	{ 54641, 6685, 577 },
+	{ 12035, 58832, 1093 },
+	{ 60373, 11058, 2890 },
+	{ 11910, 58744, 2712 },
+	{ 6054, 54283, 2018 },
+	{ 54641, 6685, 577 },
+	{ 54516, 6597, 2196 },
+	{ 6054, 54283, 2018 },
+	{ 12035, 58832, 1093 },
+	{ 11910, 58744, 2712 },
+	{ 60373, 11058, 2890 },
+	{ 60497, 11146, 1271 },
+	{ 60373, 11058, 2890 },
+	{ 54516, 6597, 2196 },
+	{ 6179, 54371, 399 },
+	{ 6054, 54283, 2018 },
+	{ 12035, 58832, 1093 },
+	{ 60767, 6796, 966 },
+	{ 60768, 58957, 966 },
+	{ 65352, 64621, 966 },
+	{ 1453, 64973, 966 },
+	{ 65401, 64973, 966 },
+	{ 5720, 59193, 966 },
+	{ 5957, 6405, 966 },
+	{ 60896, 6405, 966 },
+	{ 65164, 625, 966 },
+	{ 65164, 625, 966 },
+	{ 60896, 6405, 2926 },
+	{ 1215, 625, 966 },
+	{ 60768, 58957, 2926 },
+	{ 60768, 58957, 966 },
+	{ 60767, 6796, 966 },
+	{ 1081, 958, 966 },
+	{ 5665, 6622, 2926 },
+	{ 1192, 64794, 966 },
+	{ 5665, 58783, 966 },
+	{ 5665, 58783, 2926 },
+	{ 5665, 6622, 966 },
+	{ 5957, 6405, 966 },
+	{ 5957, 6405, 2926 },
+	{ 60896, 6405, 966 },
+	{ 60767, 6796, 2926 },
+	{ 65241, 785, 966 },
+	{ 65352, 64621, 966 },
+	{ 60659, 59193, 2926 },
+	{ 65401, 64973, 966 },
+	{ 1453, 64973, 966 },
+	{ 5720, 59193, 2926 },
+	{ 5720, 59193, 966 },
+	{ 60659, 59193, 966 },
+	{ 60738, 59160, 2926 },
+	{ 60738, 6199, 2926 },
+	{ 53343, 59160, 2926 },
+	{ 52829, 59160, 2926 },
+	{ 52829, 6199, 2926 },
+	{ 45434, 59160, 2926 },
+	{ 44919, 59160, 2926 },
+	{ 44919, 6199, 2926 },
+	{ 37525, 59160, 2926 },
+	{ 29616, 6199, 2926 },
+	{ 29616, 59160, 2926 },
+	{ 37010, 59160, 2926 },
+	{ 21706, 6199, 2926 },
+	{ 21706, 59160, 2926 },
+	{ 29101, 59160, 2926 },
+	{ 21191, 59160, 2926 },
+	{ 21191, 6199, 2926 },
+	{ 13797, 59160, 2926 },
+	{ 13282, 59160, 2926 },
+	{ 13282, 6199, 2926 },
+	{ 5888, 59160, 2926 },
+	{ 60738, 59160, 4552 },
+	{ 53343, 59160, 4552 },
+	{ 53343, 6199, 4552 },
+	{ 52829, 59160, 4552 },
+	{ 45434, 59160, 4552 },
+	{ 45434, 6199, 4552 },
+	{ 44919, 59160, 4552 },
+	{ 37525, 59160, 4552 },
+	{ 37525, 6199, 4552 },
+	{ 37010, 59160, 4552 },
+	{ 29616, 59160, 4552 },
+	{ 29616, 6199, 4552 },
+	{ 21706, 6199, 4552 },
+	{ 29101, 6199, 4552 },
+	{ 21706, 59160, 4552 },
+	{ 21191, 59160, 4552 },
+	{ 13797, 59160, 4552 },
+	{ 13797, 6199, 4552 },
+	{ 13282, 59160, 4552 },
+	{ 5888, 59160, 4552 },
+	{ 5888, 6199, 4552 },
+	{ 5888, 59160, 4552 },
+	{ 13282, 59160, 4552 },
+	{ 13282, 59160, 2926 },
+	{ 13797, 6199, 2926 },
+	{ 21191, 6199, 2926 },
+	{ 13797, 6199, 4552 },
+	{ 37010, 6199, 2926 },
+	{ 37010, 59160, 2926 },
+	{ 37010, 6199, 4552 },
+	{ 37525, 6199, 4552 },
+	{ 37525, 59160, 4552 },
+	{ 37525, 59160, 2926 },
+	{ 45434, 59160, 4552 },
+	{ 52829, 59160, 4552 },
+	{ 52829, 59160, 2926 },
+	{ 53343, 6199, 2926 },
+	{ 60738, 6199, 2926 },
+	{ 53343, 6199, 4552 },
+	{ 5888, 6199, 4552 },
+	{ 5888, 59160, 4552 },
+	{ 5888, 59160, 2926 },
+	{ 13797, 59160, 4552 },
+	{ 21191, 59160, 4552 },
+	{ 21191, 59160, 2926 },
+	{ 21706, 6199, 2926 },
+	{ 29101, 6199, 2926 },
+	{ 21706, 6199, 4552 },
+	{ 44919, 6199, 2926 },
+	{ 44919, 59160, 2926 },
+	{ 44919, 6199, 4552 },
+	{ 45434, 6199, 4552 },
+	{ 45434, 59160, 4552 },
+	{ 45434, 59160, 2926 },
+	{ 53343, 59160, 4552 },
+	{ 60738, 59160, 4552 },
+	{ 60738, 59160, 2926 },
+	{ 13282, 6199, 2926 },
+	{ 13282, 59160, 2926 },
+	{ 13282, 6199, 4552 },
+	{ 13797, 6199, 4552 },
+	{ 13797, 59160, 4552 },
+	{ 13797, 59160, 2926 },
+	{ 21706, 59160, 4552 },
+	{ 29101, 59160, 4552 },
+	{ 29101, 59160, 2926 },
+	{ 29616, 6199, 2926 },
+	{ 37010, 6199, 2926 },
+	{ 29616, 6199, 4552 },
+	{ 52829, 6199, 2926 },
+	{ 52829, 59160, 2926 },
+	{ 52829, 6199, 4552 },
+	{ 53343, 6199, 4552 },
+	{ 53343, 59160, 4552 },
+	{ 53343, 59160, 2926 },
+	{ 21191, 6199, 2926 },
+	{ 21191, 59160, 2926 },
+	{ 21191, 6199, 4552 },
+	{ 21706, 6199, 4552 },
+	{ 21706, 59160, 4552 },
+	{ 21706, 59160, 2926 },
+	{ 29616, 59160, 4552 },
+	{ 37010, 59160, 4552 },
+	{ 37010, 59160, 2926 },
+	{ 37525, 6199, 2926 },
+	{ 44919, 6199, 2926 },
+	{ 37525, 6199, 4552 },
+	{ 60738, 6199, 2926 },
+	{ 60738, 59160, 2926 },
+	{ 60738, 6199, 4552 },
+	{ 5888, 6199, 2926 },
+	{ 13282, 6199, 2926 },
+	{ 5888, 6199, 4552 },
+	{ 29101, 6199, 2926 },
+	{ 29101, 59160, 2926 },
+	{ 29101, 6199, 4552 },
+	{ 29616, 6199, 4552 },
+	{ 29616, 59160, 4552 },
+	{ 29616, 59160, 2926 },
+	{ 37525, 59160, 4552 },
+	{ 44919, 59160, 4552 },
+	{ 44919, 59160, 2926 },
+	{ 45434, 6199, 2926 },
+	{ 52829, 6199, 2926 },
+	{ 45434, 6199, 4552 },
+	{ 5665, 58783, 966 },
+	{ 5665, 6622, 966 },
+	{ 1081, 958, 966 },
+	{ 54641, 6685, 577 },
+	{ 6179, 54371, 399 },
+	{ 12035, 58832, 1093 },
+	{ 54516, 6597, 2196 },
+	{ 60373, 11058, 2890 },
+	{ 6054, 54283, 2018 },
+	{ 6179, 54371, 399 },
+	{ 54641, 6685, 577 },
+	{ 6054, 54283, 2018 },
+	{ 60497, 11146, 1271 },
+	{ 12035, 58832, 1093 },
+	{ 60373, 11058, 2890 },
+	{ 54641, 6685, 577 },
+	{ 60497, 11146, 1271 },
+	{ 54516, 6597, 2196 },
+	{ 6054, 54283, 2018 },
+	{ 11910, 58744, 2712 },
+	{ 12035, 58832, 1093 },
+	{ 64882, 64967, 64975 },
+	{ 58872, 64967, 60501 },
+	{ 6710, 64967, 60501 },
+	{ 694, 64967, 65135 },
+	{ 6474, 64967, 60393 },
+	{ 6474, 64967, 5454 },
+	{ 65042, 64967, 949 },
+	{ 59262, 64967, 5691 },
+	{ 65042, 64967, 64898 },
+	{ 59262, 63008, 60630 },
+	{ 59262, 63008, 5691 },
+	{ 65042, 64967, 64898 },
+	{ 58872, 63008, 60501 },
+	{ 6710, 63008, 60501 },
+	{ 58872, 64967, 60501 },
+	{ 59045, 63008, 5399 },
+	{ 6884, 63008, 5399 },
+	{ 873, 64967, 926 },
+	{ 6884, 63008, 5399 },
+	{ 59045, 63008, 5399 },
+	{ 59045, 64967, 5399 },
+	{ 59262, 63008, 5691 },
+	{ 59262, 63008, 60630 },
+	{ 59262, 64967, 5691 },
+	{ 6710, 63008, 60501 },
+	{ 1047, 64967, 65086 },
+	{ 6710, 64967, 60501 },
+	{ 6710, 63008, 60501 },
+	{ 58872, 63008, 60501 },
+	{ 1047, 64967, 65086 },
+	{ 59262, 63008, 60630 },
+	{ 65042, 64967, 64898 },
+	{ 59262, 64967, 60630 },
+	{ 6474, 63008, 5454 },
+	{ 6474, 63008, 60393 },
+	{ 694, 64967, 65135 },
+	{ 59045, 63008, 5399 },
+	{ 64709, 64967, 815 },
+	{ 59045, 64967, 5399 },
+	{ 6474, 63008, 60393 },
+	{ 6474, 63008, 5454 },
+	{ 6474, 64967, 5454 },
+	{ 6474, 63008, 60393 },
+	{ 6474, 64967, 60393 },
+	{ 694, 64967, 65135 },
+	{ 6474, 63008, 5454 },
+	{ 694, 64967, 1186 },
+	{ 6474, 64967, 5454 },
+	{ 59262, 63008, 5691 },
+	{ 59262, 64967, 5691 },
+	{ 65042, 64967, 949 },
+	{ 58872, 63008, 60501 },
+	{ 58872, 64967, 60501 },
+	{ 64882, 64967, 64975 },
+	{ 6884, 63008, 5399 },
+	{ 6884, 64967, 5399 },
+	{ 873, 64967, 926 },
+	{ 59468, 63008, 60472 },
+	{ 59468, 63008, 53077 },
+	{ 6507, 63008, 60472 },
+	{ 59468, 63008, 52562 },
+	{ 59468, 63008, 45168 },
+	{ 6507, 63008, 52562 },
+	{ 59468, 63008, 44653 },
+	{ 59468, 63008, 37259 },
+	{ 6507, 63008, 44653 },
+	{ 59468, 63008, 36744 },
+	{ 59468, 63008, 29349 },
+	{ 6507, 63008, 36744 },
+	{ 59468, 63008, 28835 },
+	{ 59468, 63008, 21440 },
+	{ 6507, 63008, 28835 },
+	{ 59468, 63008, 20925 },
+	{ 59468, 63008, 13531 },
+	{ 6507, 63008, 20925 },
+	{ 59468, 63008, 13016 },
+	{ 59468, 63008, 5622 },
+	{ 6507, 63008, 13016 },
+	{ 59468, 61381, 60472 },
+	{ 6507, 61381, 60472 },
+	{ 6507, 61381, 53077 },
+	{ 59468, 61381, 52562 },
+	{ 6507, 61381, 52562 },
+	{ 6507, 61381, 45168 },
+	{ 59468, 61381, 44653 },
+	{ 6507, 61381, 44653 },
+	{ 6507, 61381, 37259 },
+	{ 59468, 61381, 36744 },
+	{ 6507, 61381, 36744 },
+	{ 6507, 61381, 29349 },
+	{ 59468, 61381, 28835 },
+	{ 6507, 61381, 28835 },
+	{ 6507, 61381, 21440 },
+	{ 59468, 61381, 20925 },
+	{ 6507, 61381, 20925 },
+	{ 6507, 61381, 13531 },
+	{ 59468, 61381, 13016 },
+	{ 6507, 61381, 13016 },
+	{ 6507, 61381, 5622 },
+	{ 6507, 63008, 5622 },
+	{ 6507, 61381, 5622 },
+	{ 6507, 63008, 13016 },
+	{ 59468, 63008, 20925 },
+	{ 59468, 61381, 20925 },
+	{ 59468, 61381, 13531 },
+	{ 6507, 63008, 36744 },
+	{ 6507, 61381, 36744 },
+	{ 59468, 63008, 36744 },
+	{ 59468, 63008, 37259 },
+	{ 59468, 61381, 37259 },
+	{ 6507, 61381, 37259 },
+	{ 6507, 63008, 45168 },
+	{ 6507, 61381, 45168 },
+	{ 6507, 63008, 52562 },
+	{ 59468, 63008, 60472 },
+	{ 59468, 61381, 60472 },
+	{ 59468, 61381, 53077 },
+	{ 59468, 63008, 5622 },
+	{ 59468, 61381, 5622 },
+	{ 6507, 61381, 5622 },
+	{ 6507, 63008, 13531 },
+	{ 6507, 61381, 13531 },
+	{ 6507, 63008, 20925 },
+	{ 59468, 63008, 28835 },
+	{ 59468, 61381, 28835 },
+	{ 59468, 63008, 21440 },
+	{ 6507, 63008, 44653 },
+	{ 6507, 61381, 44653 },
+	{ 59468, 63008, 44653 },
+	{ 59468, 63008, 45168 },
+	{ 59468, 61381, 45168 },
+	{ 6507, 61381, 45168 },
+	{ 6507, 63008, 53077 },
+	{ 6507, 61381, 53077 },
+	{ 6507, 63008, 60472 },
+	{ 6507, 63008, 13016 },
+	{ 6507, 61381, 13016 },
+	{ 59468, 63008, 13016 },
+	{ 59468, 63008, 13531 },
+	{ 59468, 61381, 13531 },
+	{ 6507, 61381, 13531 },
+	{ 6507, 63008, 21440 },
+	{ 6507, 61381, 21440 },
+	{ 6507, 63008, 28835 },
+	{ 59468, 63008, 36744 },
+	{ 59468, 61381, 36744 },
+	{ 59468, 61381, 29349 },
+	{ 6507, 63008, 52562 },
+	{ 6507, 61381, 52562 },
+	{ 59468, 63008, 52562 },
+	{ 59468, 63008, 53077 },
+	{ 59468, 61381, 53077 },
+	{ 6507, 61381, 53077 },
+	{ 6507, 63008, 20925 },
+	{ 6507, 61381, 20925 },
+	{ 59468, 63008, 20925 },
+	{ 59468, 63008, 21440 },
+	{ 59468, 61381, 21440 },
+	{ 6507, 61381, 21440 },
+	{ 6507, 63008, 29349 },
+	{ 6507, 61381, 29349 },
+	{ 6507, 63008, 36744 },
+	{ 59468, 63008, 44653 },
+	{ 59468, 61381, 44653 },
+	{ 59468, 61381, 37259 },
+	{ 6507, 63008, 60472 },
+	{ 6507, 61381, 60472 },
+	{ 59468, 63008, 60472 },
+	{ 59468, 63008, 13016 },
+	{ 59468, 61381, 13016 },
+	{ 59468, 61381, 5622 },
+	{ 6507, 63008, 28835 },
+	{ 6507, 61381, 28835 },
+	{ 59468, 63008, 28835 },
+	{ 59468, 63008, 29349 },
+	{ 59468, 61381, 29349 },
+	{ 6507, 61381, 29349 },
+	{ 6507, 63008, 37259 },
+	{ 6507, 61381, 37259 },
+	{ 6507, 63008, 44653 },
+	{ 59468, 63008, 52562 },
+	{ 59468, 61381, 52562 },
+	{ 59468, 61381, 45168 },
+	{ 873, 64967, 926 },
+	{ 6884, 64967, 5399 },
+	{ 64709, 64967, 815 },
+	{ 54521, 64663, 60231 },
+	{ 58982, 65357, 54375 },
+	{ 11296, 65534, 5912 },
+	{ 54609, 63043, 60106 },
+	{ 6923, 63221, 11644 },
+	{ 59070, 63737, 54250 },
+	{ 58982, 65357, 54375 },
+	{ 59070, 63737, 54250 },
+	{ 11296, 65534, 5912 },
+	{ 6835, 64841, 11769 },
+	{ 6923, 63221, 11644 },
+	{ 54521, 64663, 60231 },
+	{ 54521, 64663, 60231 },
+	{ 54609, 63043, 60106 },
+	{ 59070, 63737, 54250 },
+	{ 11296, 65534, 5912 },
+	{ 11384, 63915, 5788 },
+	{ 6835, 64841, 11769 },
+	{ 1047, 64967, 65086 },
+	{ 64882, 64967, 64975 },
+	{ 6710, 64967, 60501 },
+	{ 694, 64967, 1186 },
+	{ 694, 64967, 65135 },
+	{ 6474, 64967, 5454 },
+	{ 59262, 64967, 5691 },
+	{ 59262, 64967, 60630 },
+	{ 65042, 64967, 64898 },
+	{ 59262, 63008, 5691 },
+	{ 65042, 64967, 949 },
+	{ 65042, 64967, 64898 },
+	{ 6710, 63008, 60501 },
+	{ 6710, 64967, 60501 },
+	{ 58872, 64967, 60501 },
+	{ 64709, 64967, 815 },
+	{ 59045, 63008, 5399 },
+	{ 873, 64967, 926 },
+	{ 6884, 64967, 5399 },
+	{ 6884, 63008, 5399 },
+	{ 59045, 64967, 5399 },
+	{ 59262, 63008, 60630 },
+	{ 59262, 64967, 60630 },
+	{ 59262, 64967, 5691 },
+	{ 58872, 63008, 60501 },
+	{ 64882, 64967, 64975 },
+	{ 1047, 64967, 65086 },
+	{ 694, 64967, 1186 },
+	{ 6474, 63008, 5454 },
+	{ 694, 64967, 65135 },
+	{ 6474, 64967, 60393 },
+	{ 6474, 63008, 60393 },
+	{ 6474, 64967, 5454 },
+	{ 59468, 63008, 53077 },
+	{ 6507, 63008, 53077 },
+	{ 6507, 63008, 60472 },
+	{ 59468, 63008, 45168 },
+	{ 6507, 63008, 45168 },
+	{ 6507, 63008, 52562 },
+	{ 59468, 63008, 37259 },
+	{ 6507, 63008, 37259 },
+	{ 6507, 63008, 44653 },
+	{ 59468, 63008, 29349 },
+	{ 6507, 63008, 29349 },
+	{ 6507, 63008, 36744 },
+	{ 59468, 63008, 21440 },
+	{ 6507, 63008, 21440 },
+	{ 6507, 63008, 28835 },
+	{ 59468, 63008, 13531 },
+	{ 6507, 63008, 13531 },
+	{ 6507, 63008, 20925 },
+	{ 59468, 63008, 5622 },
+	{ 6507, 63008, 5622 },
+	{ 6507, 63008, 13016 },
+	{ 59468, 61381, 53077 },
+	{ 59468, 61381, 60472 },
+	{ 6507, 61381, 53077 },
+	{ 59468, 61381, 45168 },
+	{ 59468, 61381, 52562 },
+	{ 6507, 61381, 45168 },
+	{ 59468, 61381, 37259 },
+	{ 59468, 61381, 44653 },
+	{ 6507, 61381, 37259 },
+	{ 59468, 61381, 29349 },
+	{ 59468, 61381, 36744 },
+	{ 6507, 61381, 29349 },
+	{ 59468, 61381, 21440 },
+	{ 59468, 61381, 28835 },
+	{ 6507, 61381, 21440 },
+	{ 59468, 61381, 13531 },
+	{ 59468, 61381, 20925 },
+	{ 6507, 61381, 13531 },
+	{ 59468, 61381, 5622 },
+	{ 59468, 61381, 13016 },
+	{ 6507, 61381, 5622 },
+	{ 6507, 61381, 5622 },
+	{ 6507, 61381, 13016 },
+	{ 6507, 63008, 13016 },
+	{ 59468, 63008, 13531 },
+	{ 59468, 63008, 20925 },
+	{ 59468, 61381, 13531 },
+	{ 6507, 61381, 36744 },
+	{ 59468, 61381, 36744 },
+	{ 59468, 63008, 36744 },
+	{ 6507, 63008, 37259 },
+	{ 59468, 63008, 37259 },
+	{ 6507, 61381, 37259 },
+	{ 6507, 61381, 45168 },
+	{ 6507, 61381, 52562 },
+	{ 6507, 63008, 52562 },
+	{ 59468, 63008, 53077 },
+	{ 59468, 63008, 60472 },
+	{ 59468, 61381, 53077 },
+	{ 6507, 63008, 5622 },
+	{ 59468, 63008, 5622 },
+	{ 6507, 61381, 5622 },
+	{ 6507, 61381, 13531 },
+	{ 6507, 61381, 20925 },
+	{ 6507, 63008, 20925 },
+	{ 59468, 61381, 28835 },
+	{ 59468, 61381, 21440 },
+	{ 59468, 63008, 21440 },
+	{ 6507, 61381, 44653 },
+	{ 59468, 61381, 44653 },
+	{ 59468, 63008, 44653 },
+	{ 6507, 63008, 45168 },
+	{ 59468, 63008, 45168 },
+	{ 6507, 61381, 45168 },
+	{ 6507, 61381, 53077 },
+	{ 6507, 61381, 60472 },
+	{ 6507, 63008, 60472 },
+	{ 6507, 61381, 13016 },
+	{ 59468, 61381, 13016 },
+	{ 59468, 63008, 13016 },
+	{ 6507, 63008, 13531 },
+	{ 59468, 63008, 13531 },
+	{ 6507, 61381, 13531 },
+	{ 6507, 61381, 21440 },
+	{ 6507, 61381, 28835 },
+	{ 6507, 63008, 28835 },
+	{ 59468, 63008, 29349 },
+	{ 59468, 63008, 36744 },
+	{ 59468, 61381, 29349 },
+	{ 6507, 61381, 52562 },
+	{ 59468, 61381, 52562 },
+	{ 59468, 63008, 52562 },
+	{ 6507, 63008, 53077 },
+	{ 59468, 63008, 53077 },
+	{ 6507, 61381, 53077 },
+	{ 6507, 61381, 20925 },
+	{ 59468, 61381, 20925 },
+	{ 59468, 63008, 20925 },
+	{ 6507, 63008, 21440 },
+	{ 59468, 63008, 21440 },
+	{ 6507, 61381, 21440 },
+	{ 6507, 61381, 29349 },
+	{ 6507, 61381, 36744 },
+	{ 6507, 63008, 36744 },
+	{ 59468, 63008, 37259 },
+	{ 59468, 63008, 44653 },
+	{ 59468, 61381, 37259 },
+	{ 6507, 61381, 60472 },
+	{ 59468, 61381, 60472 },
+	{ 59468, 63008, 60472 },
+	{ 59468, 63008, 5622 },
+	{ 59468, 63008, 13016 },
+	{ 59468, 61381, 5622 },
+	{ 6507, 61381, 28835 },
+	{ 59468, 61381, 28835 },
+	{ 59468, 63008, 28835 },
+	{ 6507, 63008, 29349 },
+	{ 59468, 63008, 29349 },
+	{ 6507, 61381, 29349 },
+	{ 6507, 61381, 37259 },
+	{ 6507, 61381, 44653 },
+	{ 6507, 63008, 44653 },
+	{ 59468, 63008, 45168 },
+	{ 59468, 63008, 52562 },
+	{ 59468, 61381, 45168 },
+	{ 6884, 64967, 5399 },
+	{ 59045, 64967, 5399 },
+	{ 64709, 64967, 815 },
+	{ 6835, 64841, 11769 },
+	{ 54521, 64663, 60231 },
+	{ 11296, 65534, 5912 },
+	{ 6923, 63221, 11644 },
+	{ 11384, 63915, 5788 },
+	{ 59070, 63737, 54250 },
+	{ 59070, 63737, 54250 },
+	{ 11384, 63915, 5788 },
+	{ 11296, 65534, 5912 },
+	{ 6923, 63221, 11644 },
+	{ 54609, 63043, 60106 },
+	{ 54521, 64663, 60231 },
+	{ 58982, 65357, 54375 },
+	{ 54521, 64663, 60231 },
+	{ 59070, 63737, 54250 },
+	{ 11384, 63915, 5788 },
+	{ 6923, 63221, 11644 },
+	{ 6835, 64841, 11769 },
+	{ 700, 64680, 64975 },
+	{ 700, 58670, 60501 },
+	{ 700, 6508, 60501 },
+	{ 700, 492, 65135 },
+	{ 700, 6272, 60393 },
+	{ 700, 6272, 5454 },
+	{ 700, 64840, 949 },
+	{ 700, 59060, 5691 },
+	{ 700, 59060, 60630 },
+	{ 2659, 59060, 60630 },
+	{ 2659, 59060, 5691 },
+	{ 700, 64840, 64898 },
+	{ 2659, 58670, 60501 },
+	{ 2660, 6508, 60501 },
+	{ 700, 6508, 60501 },
+	{ 2659, 58843, 5399 },
+	{ 2659, 6682, 5399 },
+	{ 700, 64507, 815 },
+	{ 2659, 6682, 5399 },
+	{ 2659, 58843, 5399 },
+	{ 700, 58843, 5399 },
+	{ 2659, 59060, 5691 },
+	{ 2659, 59060, 60630 },
+	{ 700, 59060, 60630 },
+	{ 2660, 6508, 60501 },
+	{ 700, 845, 65086 },
+	{ 700, 6508, 60501 },
+	{ 2660, 6508, 60501 },
+	{ 2659, 58670, 60501 },
+	{ 700, 845, 65086 },
+	{ 2659, 59060, 60630 },
+	{ 700, 64840, 64898 },
+	{ 700, 59060, 60630 },
+	{ 2660, 6272, 5454 },
+	{ 2659, 6272, 60393 },
+	{ 700, 492, 1186 },
+	{ 2659, 58843, 5399 },
+	{ 700, 64507, 815 },
+	{ 700, 58843, 5399 },
+	{ 2659, 6272, 60393 },
+	{ 2660, 6272, 5454 },
+	{ 700, 6272, 5454 },
+	{ 2659, 6272, 60393 },
+	{ 700, 6272, 60393 },
+	{ 700, 492, 65135 },
+	{ 2660, 6272, 5454 },
+	{ 700, 492, 1186 },
+	{ 700, 6272, 5454 },
+	{ 2659, 59060, 5691 },
+	{ 700, 59060, 5691 },
+	{ 700, 64840, 949 },
+	{ 2659, 58670, 60501 },
+	{ 700, 58670, 60501 },
+	{ 700, 64680, 64975 },
+	{ 2659, 6682, 5399 },
+	{ 700, 6682, 5399 },
+	{ 700, 671, 926 },
+	{ 2659, 59266, 60472 },
+	{ 2659, 59266, 53077 },
+	{ 2660, 6305, 60472 },
+	{ 2659, 59266, 52562 },
+	{ 2659, 59266, 45168 },
+	{ 2660, 6305, 52562 },
+	{ 2659, 59266, 44653 },
+	{ 2659, 59266, 37259 },
+	{ 2660, 6305, 44653 },
+	{ 2659, 59266, 36744 },
+	{ 2659, 59266, 29349 },
+	{ 2660, 6305, 36744 },
+	{ 2659, 59266, 28835 },
+	{ 2659, 59266, 21440 },
+	{ 2660, 6305, 28835 },
+	{ 2659, 59266, 20925 },
+	{ 2659, 59266, 13531 },
+	{ 2660, 6305, 20925 },
+	{ 2659, 59266, 13016 },
+	{ 2659, 59266, 5622 },
+	{ 2660, 6305, 13016 },
+	{ 4286, 59266, 60472 },
+	{ 4286, 6305, 60472 },
+	{ 4286, 6305, 53077 },
+	{ 4286, 59266, 52562 },
+	{ 4286, 6305, 52562 },
+	{ 4286, 6305, 45168 },
+	{ 4286, 59266, 44653 },
+	{ 4286, 6305, 44653 },
+	{ 4286, 6305, 37259 },
+	{ 4286, 59266, 36744 },
+	{ 4286, 6305, 36744 },
+	{ 4286, 6305, 29349 },
+	{ 4286, 59266, 28835 },
+	{ 4286, 6305, 28835 },
+	{ 4286, 6305, 21440 },
+	{ 4286, 59266, 20925 },
+	{ 4286, 6305, 20925 },
+	{ 4286, 6305, 13531 },
+	{ 4286, 59266, 13016 },
+	{ 4286, 6305, 13016 },
+	{ 4286, 6305, 5622 },
+	{ 2660, 6305, 5622 },
+	{ 4286, 6305, 5622 },
+	{ 2660, 6305, 13016 },
+	{ 2659, 59266, 20925 },
+	{ 4286, 59266, 20925 },
+	{ 2659, 59266, 13531 },
+	{ 2660, 6305, 36744 },
+	{ 4286, 6305, 36744 },
+	{ 4286, 59266, 36744 },
+	{ 2659, 59266, 37259 },
+	{ 4286, 59266, 37259 },
+	{ 2660, 6305, 37259 },
+	{ 2660, 6305, 45168 },
+	{ 4286, 6305, 45168 },
+	{ 2660, 6305, 52562 },
+	{ 2659, 59266, 60472 },
+	{ 4286, 59266, 60472 },
+	{ 2659, 59266, 53077 },
+	{ 2659, 59266, 5622 },
+	{ 4286, 59266, 5622 },
+	{ 4286, 6305, 5622 },
+	{ 2660, 6305, 13531 },
+	{ 4286, 6305, 13531 },
+	{ 2660, 6305, 20925 },
+	{ 2659, 59266, 28835 },
+	{ 4286, 59266, 28835 },
+	{ 4286, 59266, 21440 },
+	{ 2660, 6305, 44653 },
+	{ 4286, 6305, 44653 },
+	{ 4286, 59266, 44653 },
+	{ 2659, 59266, 45168 },
+	{ 4286, 59266, 45168 },
+	{ 2660, 6305, 45168 },
+	{ 2660, 6305, 53077 },
+	{ 4286, 6305, 53077 },
+	{ 2660, 6305, 60472 },
+	{ 2660, 6305, 13016 },
+	{ 4286, 6305, 13016 },
+	{ 4286, 59266, 13016 },
+	{ 2659, 59266, 13531 },
+	{ 4286, 59266, 13531 },
+	{ 4286, 6305, 13531 },
+	{ 2660, 6305, 21440 },
+	{ 4286, 6305, 21440 },
+	{ 2660, 6305, 28835 },
+	{ 2659, 59266, 36744 },
+	{ 4286, 59266, 36744 },
+	{ 2659, 59266, 29349 },
+	{ 2660, 6305, 52562 },
+	{ 4286, 6305, 52562 },
+	{ 4286, 59266, 52562 },
+	{ 2659, 59266, 53077 },
+	{ 4286, 59266, 53077 },
+	{ 4286, 6305, 53077 },
+	{ 2660, 6305, 20925 },
+	{ 4286, 6305, 20925 },
+	{ 4286, 59266, 20925 },
+	{ 2659, 59266, 21440 },
+	{ 4286, 59266, 21440 },
+	{ 4286, 6305, 21440 },
+	{ 2660, 6305, 29349 },
+	{ 4286, 6305, 29349 },
+	{ 2660, 6305, 36744 },
+	{ 2659, 59266, 44653 },
+	{ 4286, 59266, 44653 },
+	{ 2659, 59266, 37259 },
+	{ 2660, 6305, 60472 },
+	{ 4286, 6305, 60472 },
+	{ 4286, 59266, 60472 },
+	{ 2659, 59266, 13016 },
+	{ 4286, 59266, 13016 },
+	{ 2659, 59266, 5622 },
+	{ 2660, 6305, 28835 },
+	{ 4286, 6305, 28835 },
+	{ 4286, 59266, 28835 },
+	{ 2659, 59266, 29349 },
+	{ 4286, 59266, 29349 },
+	{ 4286, 6305, 29349 },
+	{ 2660, 6305, 37259 },
+	{ 4286, 6305, 37259 },
+	{ 2660, 6305, 44653 },
+	{ 2659, 59266, 52562 },
+	{ 4286, 59266, 52562 },
+	{ 2659, 59266, 45168 },
+	{ 700, 671, 926 },
+	{ 700, 6682, 5399 },
+	{ 700, 58843, 5399 },
+	{ 1004, 54319, 60231 },
+	{ 311, 58780, 54375 },
+	{ 133, 11094, 5912 },
+	{ 2624, 54407, 60106 },
+	{ 2446, 6721, 11644 },
+	{ 1930, 58868, 54250 },
+	{ 311, 58780, 54375 },
+	{ 1930, 58868, 54250 },
+	{ 1752, 11182, 5788 },
+	{ 827, 6633, 11769 },
+	{ 2446, 6721, 11644 },
+	{ 2624, 54407, 60106 },
+	{ 1004, 54319, 60231 },
+	{ 2624, 54407, 60106 },
+	{ 1930, 58868, 54250 },
+	{ 133, 11094, 5912 },
+	{ 1752, 11182, 5788 },
+	{ 827, 6633, 11769 },
+	{ 700, 845, 65086 },
+	{ 700, 64680, 64975 },
+	{ 700, 6508, 60501 },
+	{ 700, 492, 1186 },
+	{ 700, 492, 65135 },
+	{ 700, 6272, 5454 },
+	{ 700, 64840, 64898 },
+	{ 700, 64840, 949 },
+	{ 700, 59060, 60630 },
+	{ 2659, 59060, 5691 },
+	{ 700, 64840, 949 },
+	{ 700, 64840, 64898 },
+	{ 700, 58670, 60501 },
+	{ 2659, 58670, 60501 },
+	{ 700, 6508, 60501 },
+	{ 2659, 6682, 5399 },
+	{ 700, 671, 926 },
+	{ 700, 64507, 815 },
+	{ 700, 6682, 5399 },
+	{ 2659, 6682, 5399 },
+	{ 700, 58843, 5399 },
+	{ 700, 59060, 5691 },
+	{ 2659, 59060, 5691 },
+	{ 700, 59060, 60630 },
+	{ 2659, 58670, 60501 },
+	{ 700, 64680, 64975 },
+	{ 700, 845, 65086 },
+	{ 2659, 6272, 60393 },
+	{ 700, 492, 65135 },
+	{ 700, 492, 1186 },
+	{ 700, 6272, 60393 },
+	{ 2659, 6272, 60393 },
+	{ 700, 6272, 5454 },
+	{ 2659, 59266, 53077 },
+	{ 2660, 6305, 53077 },
+	{ 2660, 6305, 60472 },
+	{ 2659, 59266, 45168 },
+	{ 2660, 6305, 45168 },
+	{ 2660, 6305, 52562 },
+	{ 2659, 59266, 37259 },
+	{ 2660, 6305, 37259 },
+	{ 2660, 6305, 44653 },
+	{ 2659, 59266, 29349 },
+	{ 2660, 6305, 29349 },
+	{ 2660, 6305, 36744 },
+	{ 2659, 59266, 21440 },
+	{ 2660, 6305, 21440 },
+	{ 2660, 6305, 28835 },
+	{ 2659, 59266, 13531 },
+	{ 2660, 6305, 13531 },
+	{ 2660, 6305, 20925 },
+	{ 2659, 59266, 5622 },
+	{ 2660, 6305, 5622 },
+	{ 2660, 6305, 13016 },
+	{ 4286, 59266, 53077 },
+	{ 4286, 59266, 60472 },
+	{ 4286, 6305, 53077 },
+	{ 4286, 59266, 45168 },
+	{ 4286, 59266, 52562 },
+	{ 4286, 6305, 45168 },
+	{ 4286, 59266, 37259 },
+	{ 4286, 59266, 44653 },
+	{ 4286, 6305, 37259 },
+	{ 4286, 59266, 29349 },
+	{ 4286, 59266, 36744 },
+	{ 4286, 6305, 29349 },
+	{ 4286, 59266, 21440 },
+	{ 4286, 59266, 28835 },
+	{ 4286, 6305, 21440 },
+	{ 4286, 59266, 13531 },
+	{ 4286, 59266, 20925 },
+	{ 4286, 6305, 13531 },
+	{ 4286, 59266, 5622 },
+	{ 4286, 59266, 13016 },
+	{ 4286, 6305, 5622 },
+	{ 4286, 6305, 5622 },
+	{ 4286, 6305, 13016 },
+	{ 2660, 6305, 13016 },
+	{ 4286, 59266, 20925 },
+	{ 4286, 59266, 13531 },
+	{ 2659, 59266, 13531 },
+	{ 2659, 59266, 36744 },
+	{ 2660, 6305, 36744 },
+	{ 4286, 59266, 36744 },
+	{ 4286, 59266, 37259 },
+	{ 4286, 6305, 37259 },
+	{ 2660, 6305, 37259 },
+	{ 4286, 6305, 45168 },
+	{ 4286, 6305, 52562 },
+	{ 2660, 6305, 52562 },
+	{ 4286, 59266, 60472 },
+	{ 4286, 59266, 53077 },
+	{ 2659, 59266, 53077 },
+	{ 2660, 6305, 5622 },
+	{ 2659, 59266, 5622 },
+	{ 4286, 6305, 5622 },
+	{ 4286, 6305, 13531 },
+	{ 4286, 6305, 20925 },
+	{ 2660, 6305, 20925 },
+	{ 2659, 59266, 21440 },
+	{ 2659, 59266, 28835 },
+	{ 4286, 59266, 21440 },
+	{ 2659, 59266, 44653 },
+	{ 2660, 6305, 44653 },
+	{ 4286, 59266, 44653 },
+	{ 4286, 59266, 45168 },
+	{ 4286, 6305, 45168 },
+	{ 2660, 6305, 45168 },
+	{ 4286, 6305, 53077 },
+	{ 4286, 6305, 60472 },
+	{ 2660, 6305, 60472 },
+	{ 2659, 59266, 13016 },
+	{ 2660, 6305, 13016 },
+	{ 4286, 59266, 13016 },
+	{ 2660, 6305, 13531 },
+	{ 2659, 59266, 13531 },
+	{ 4286, 6305, 13531 },
+	{ 4286, 6305, 21440 },
+	{ 4286, 6305, 28835 },
+	{ 2660, 6305, 28835 },
+	{ 4286, 59266, 36744 },
+	{ 4286, 59266, 29349 },
+	{ 2659, 59266, 29349 },
+	{ 2659, 59266, 52562 },
+	{ 2660, 6305, 52562 },
+	{ 4286, 59266, 52562 },
+	{ 2660, 6305, 53077 },
+	{ 2659, 59266, 53077 },
+	{ 4286, 6305, 53077 },
+	{ 2659, 59266, 20925 },
+	{ 2660, 6305, 20925 },
+	{ 4286, 59266, 20925 },
+	{ 2660, 6305, 21440 },
+	{ 2659, 59266, 21440 },
+	{ 4286, 6305, 21440 },
+	{ 4286, 6305, 29349 },
+	{ 4286, 6305, 36744 },
+	{ 2660, 6305, 36744 },
+	{ 4286, 59266, 44653 },
+	{ 4286, 59266, 37259 },
+	{ 2659, 59266, 37259 },
+	{ 2659, 59266, 60472 },
+	{ 2660, 6305, 60472 },
+	{ 4286, 59266, 60472 },
+	{ 4286, 59266, 13016 },
+	{ 4286, 59266, 5622 },
+	{ 2659, 59266, 5622 },
+	{ 2659, 59266, 28835 },
+	{ 2660, 6305, 28835 },
+	{ 4286, 59266, 28835 },
+	{ 2660, 6305, 29349 },
+	{ 2659, 59266, 29349 },
+	{ 4286, 6305, 29349 },
+	{ 4286, 6305, 37259 },
+	{ 4286, 6305, 44653 },
+	{ 2660, 6305, 44653 },
+	{ 4286, 59266, 52562 },
+	{ 4286, 59266, 45168 },
+	{ 2659, 59266, 45168 },
+	{ 700, 64507, 815 },
+	{ 700, 671, 926 },
+	{ 700, 58843, 5399 },
+	{ 827, 6633, 11769 },
+	{ 1004, 54319, 60231 },
+	{ 133, 11094, 5912 },
+	{ 2446, 6721, 11644 },
+	{ 1752, 11182, 5788 },
+	{ 1930, 58868, 54250 },
+	{ 133, 11094, 5912 },
+	{ 311, 58780, 54375 },
+	{ 1752, 11182, 5788 },
+	{ 1004, 54319, 60231 },
+	{ 827, 6633, 11769 },
+	{ 2624, 54407, 60106 },
+	{ 311, 58780, 54375 },
+	{ 1004, 54319, 60231 },
+	{ 1930, 58868, 54250 },
+	{ 1752, 11182, 5788 },
+	{ 2446, 6721, 11644 },
+	{ 827, 6633, 11769 },
+	{ 701, 567, 64975 },
+	{ 6711, 567, 60501 },
+	{ 64536, 567, 65086 },
+	{ 64889, 567, 65135 },
+	{ 59109, 567, 60393 },
+	{ 64889, 567, 1186 },
+	{ 541, 567, 949 },
+	{ 6321, 567, 5691 },
+	{ 6321, 567, 60630 },
+	{ 6321, 2526, 60630 },
+	{ 6321, 2526, 5691 },
+	{ 541, 567, 949 },
+	{ 6711, 2526, 60501 },
+	{ 58873, 2526, 60501 },
+	{ 58873, 567, 60501 },
+	{ 6538, 2526, 5399 },
+	{ 58699, 2526, 5399 },
+	{ 64710, 567, 926 },
+	{ 58699, 2526, 5399 },
+	{ 6538, 2526, 5399 },
+	{ 58699, 567, 5399 },
+	{ 6321, 2526, 5691 },
+	{ 6321, 2526, 60630 },
+	{ 6321, 567, 60630 },
+	{ 58873, 2526, 60501 },
+	{ 64536, 567, 65086 },
+	{ 58873, 567, 60501 },
+	{ 58873, 2526, 60501 },
+	{ 6711, 2526, 60501 },
+	{ 701, 567, 64975 },
+	{ 6321, 2526, 60630 },
+	{ 541, 567, 64898 },
+	{ 6321, 567, 60630 },
+	{ 59109, 2526, 5454 },
+	{ 59109, 2526, 60393 },
+	{ 64889, 567, 1186 },
+	{ 6538, 2526, 5399 },
+	{ 874, 567, 815 },
+	{ 6538, 567, 5399 },
+	{ 59109, 2526, 60393 },
+	{ 59109, 2526, 5454 },
+	{ 59109, 567, 60393 },
+	{ 59109, 2526, 60393 },
+	{ 59109, 567, 60393 },
+	{ 64889, 567, 65135 },
+	{ 59109, 2526, 5454 },
+	{ 64889, 567, 1186 },
+	{ 59109, 567, 5454 },
+	{ 6321, 2526, 5691 },
+	{ 6321, 567, 5691 },
+	{ 541, 567, 949 },
+	{ 6711, 2526, 60501 },
+	{ 6711, 567, 60501 },
+	{ 701, 567, 64975 },
+	{ 58699, 2526, 5399 },
+	{ 58699, 567, 5399 },
+	{ 64710, 567, 926 },
+	{ 6115, 2526, 60472 },
+	{ 6115, 2526, 53077 },
+	{ 59076, 2526, 53077 },
+	{ 6115, 2526, 52562 },
+	{ 6115, 2526, 45168 },
+	{ 59076, 2526, 45168 },
+	{ 6115, 2526, 44653 },
+	{ 6115, 2526, 37259 },
+	{ 59076, 2526, 37259 },
+	{ 6115, 2526, 36744 },
+	{ 6115, 2526, 29349 },
+	{ 59076, 2526, 29349 },
+	{ 6115, 2526, 28835 },
+	{ 6115, 2526, 21440 },
+	{ 59076, 2526, 21440 },
+	{ 6115, 2526, 20925 },
+	{ 6115, 2526, 13531 },
+	{ 59076, 2526, 13531 },
+	{ 6115, 2526, 13016 },
+	{ 6115, 2526, 5622 },
+	{ 59076, 2526, 5622 },
+	{ 6115, 4153, 60472 },
+	{ 59076, 4153, 60472 },
+	{ 6115, 4153, 53077 },
+	{ 6115, 4153, 52562 },
+	{ 59076, 4153, 52562 },
+	{ 6115, 4153, 45168 },
+	{ 6115, 4153, 44653 },
+	{ 59076, 4153, 44653 },
+	{ 6115, 4153, 37259 },
+	{ 6115, 4153, 36744 },
+	{ 59076, 4153, 36744 },
+	{ 6115, 4153, 29349 },
+	{ 6115, 4153, 28835 },
+	{ 59076, 4153, 28835 },
+	{ 6115, 4153, 21440 },
+	{ 6115, 4153, 20925 },
+	{ 59076, 4153, 20925 },
+	{ 6115, 4153, 13531 },
+	{ 6115, 4153, 13016 },
+	{ 59076, 4153, 13016 },
+	{ 6115, 4153, 5622 },
+	{ 59076, 2526, 5622 },
+	{ 59076, 4153, 5622 },
+	{ 59076, 4153, 13016 },
+	{ 6115, 2526, 20925 },
+	{ 6115, 4153, 20925 },
+	{ 6115, 2526, 13531 },
+	{ 59076, 2526, 36744 },
+	{ 59076, 4153, 36744 },
+	{ 6115, 4153, 36744 },
+	{ 6115, 2526, 37259 },
+	{ 6115, 4153, 37259 },
+	{ 59076, 2526, 37259 },
+	{ 59076, 2526, 45168 },
+	{ 59076, 4153, 45168 },
+	{ 59076, 4153, 52562 },
+	{ 6115, 2526, 60472 },
+	{ 6115, 4153, 60472 },
+	{ 6115, 2526, 53077 },
+	{ 6115, 2526, 5622 },
+	{ 6115, 4153, 5622 },
+	{ 59076, 2526, 5622 },
+	{ 59076, 2526, 13531 },
+	{ 59076, 4153, 13531 },
+	{ 59076, 4153, 20925 },
+	{ 6115, 2526, 28835 },
+	{ 6115, 4153, 28835 },
+	{ 6115, 4153, 21440 },
+	{ 59076, 2526, 44653 },
+	{ 59076, 4153, 44653 },
+	{ 6115, 4153, 44653 },
+	{ 6115, 2526, 45168 },
+	{ 6115, 4153, 45168 },
+	{ 59076, 2526, 45168 },
+	{ 59076, 2526, 53077 },
+	{ 59076, 4153, 53077 },
+	{ 59076, 4153, 60472 },
+	{ 59076, 2526, 13016 },
+	{ 59076, 4153, 13016 },
+	{ 6115, 4153, 13016 },
+	{ 6115, 2526, 13531 },
+	{ 6115, 4153, 13531 },
+	{ 59076, 2526, 13531 },
+	{ 59076, 2526, 21440 },
+	{ 59076, 4153, 21440 },
+	{ 59076, 4153, 28835 },
+	{ 6115, 2526, 36744 },
+	{ 6115, 4153, 36744 },
+	{ 6115, 2526, 29349 },
+	{ 59076, 2526, 52562 },
+	{ 59076, 4153, 52562 },
+	{ 6115, 4153, 52562 },
+	{ 6115, 2526, 53077 },
+	{ 6115, 4153, 53077 },
+	{ 59076, 2526, 53077 },
+	{ 59076, 2526, 20925 },
+	{ 59076, 4153, 20925 },
+	{ 6115, 4153, 20925 },
+	{ 6115, 2526, 21440 },
+	{ 6115, 4153, 21440 },
+	{ 59076, 2526, 21440 },
+	{ 59076, 2526, 29349 },
+	{ 59076, 4153, 29349 },
+	{ 59076, 4153, 36744 },
+	{ 6115, 2526, 44653 },
+	{ 6115, 4153, 44653 },
+	{ 6115, 2526, 37259 },
+	{ 59076, 2526, 60472 },
+	{ 59076, 4153, 60472 },
+	{ 6115, 4153, 60472 },
+	{ 6115, 2526, 13016 },
+	{ 6115, 4153, 13016 },
+	{ 6115, 2526, 5622 },
+	{ 59076, 2526, 28835 },
+	{ 59076, 4153, 28835 },
+	{ 6115, 4153, 28835 },
+	{ 6115, 2526, 29349 },
+	{ 6115, 4153, 29349 },
+	{ 59076, 2526, 29349 },
+	{ 59076, 2526, 37259 },
+	{ 59076, 4153, 37259 },
+	{ 59076, 4153, 44653 },
+	{ 6115, 2526, 52562 },
+	{ 6115, 4153, 52562 },
+	{ 6115, 2526, 45168 },
+	{ 64710, 567, 926 },
+	{ 58699, 567, 5399 },
+	{ 874, 567, 815 },
+	{ 11062, 871, 60231 },
+	{ 6601, 177, 54375 },
+	{ 58748, 693, 11769 },
+	{ 10974, 2490, 60106 },
+	{ 58660, 2313, 11644 },
+	{ 54199, 1619, 5788 },
+	{ 6601, 177, 54375 },
+	{ 6513, 1797, 54250 },
+	{ 54199, 1619, 5788 },
+	{ 58748, 693, 11769 },
+	{ 58660, 2313, 11644 },
+	{ 10974, 2490, 60106 },
+	{ 11062, 871, 60231 },
+	{ 10974, 2490, 60106 },
+	{ 6601, 177, 54375 },
+	{ 54287, 0, 5912 },
+	{ 54199, 1619, 5788 },
+	{ 58660, 2313, 11644 },
+	{ 6711, 567, 60501 },
+	{ 58873, 567, 60501 },
+	{ 64536, 567, 65086 },
+	{ 59109, 567, 60393 },
+	{ 59109, 567, 5454 },
+	{ 64889, 567, 1186 },
+	{ 541, 567, 64898 },
+	{ 541, 567, 949 },
+	{ 6321, 567, 60630 },
+	{ 541, 567, 64898 },
+	{ 6321, 2526, 60630 },
+	{ 541, 567, 949 },
+	{ 6711, 567, 60501 },
+	{ 6711, 2526, 60501 },
+	{ 58873, 567, 60501 },
+	{ 874, 567, 815 },
+	{ 6538, 2526, 5399 },
+	{ 64710, 567, 926 },
+	{ 6538, 2526, 5399 },
+	{ 6538, 567, 5399 },
+	{ 58699, 567, 5399 },
+	{ 6321, 567, 5691 },
+	{ 6321, 2526, 5691 },
+	{ 6321, 567, 60630 },
+	{ 64536, 567, 65086 },
+	{ 58873, 2526, 60501 },
+	{ 701, 567, 64975 },
+	{ 59109, 2526, 60393 },
+	{ 64889, 567, 65135 },
+	{ 64889, 567, 1186 },
+	{ 59109, 2526, 5454 },
+	{ 59109, 567, 5454 },
+	{ 59109, 567, 60393 },
+	{ 59076, 2526, 60472 },
+	{ 6115, 2526, 60472 },
+	{ 59076, 2526, 53077 },
+	{ 59076, 2526, 52562 },
+	{ 6115, 2526, 52562 },
+	{ 59076, 2526, 45168 },
+	{ 59076, 2526, 44653 },
+	{ 6115, 2526, 44653 },
+	{ 59076, 2526, 37259 },
+	{ 59076, 2526, 36744 },
+	{ 6115, 2526, 36744 },
+	{ 59076, 2526, 29349 },
+	{ 59076, 2526, 28835 },
+	{ 6115, 2526, 28835 },
+	{ 59076, 2526, 21440 },
+	{ 59076, 2526, 20925 },
+	{ 6115, 2526, 20925 },
+	{ 59076, 2526, 13531 },
+	{ 59076, 2526, 13016 },
+	{ 6115, 2526, 13016 },
+	{ 59076, 2526, 5622 },
+	{ 59076, 4153, 60472 },
+	{ 59076, 4153, 53077 },
+	{ 6115, 4153, 53077 },
+	{ 59076, 4153, 52562 },
+	{ 59076, 4153, 45168 },
+	{ 6115, 4153, 45168 },
+	{ 59076, 4153, 44653 },
+	{ 59076, 4153, 37259 },
+	{ 6115, 4153, 37259 },
+	{ 59076, 4153, 36744 },
+	{ 59076, 4153, 29349 },
+	{ 6115, 4153, 29349 },
+	{ 59076, 4153, 28835 },
+	{ 59076, 4153, 21440 },
+	{ 6115, 4153, 21440 },
+	{ 59076, 4153, 20925 },
+	{ 59076, 4153, 13531 },
+	{ 6115, 4153, 13531 },
+	{ 59076, 4153, 13016 },
+	{ 59076, 4153, 5622 },
+	{ 6115, 4153, 5622 },
+	{ 59076, 2526, 13016 },
+	{ 59076, 2526, 5622 },
+	{ 59076, 4153, 13016 },
+	{ 6115, 4153, 20925 },
+	{ 6115, 4153, 13531 },
+	{ 6115, 2526, 13531 },
+	{ 6115, 2526, 36744 },
+	{ 59076, 2526, 36744 },
+	{ 6115, 4153, 36744 },
+	{ 6115, 4153, 37259 },
+	{ 59076, 4153, 37259 },
+	{ 59076, 2526, 37259 },
+	{ 59076, 2526, 52562 },
+	{ 59076, 2526, 45168 },
+	{ 59076, 4153, 52562 },
+	{ 6115, 4153, 60472 },
+	{ 6115, 4153, 53077 },
+	{ 6115, 2526, 53077 },
+	{ 6115, 4153, 5622 },
+	{ 59076, 4153, 5622 },
+	{ 59076, 2526, 5622 },
+	{ 59076, 2526, 20925 },
+	{ 59076, 2526, 13531 },
+	{ 59076, 4153, 20925 },
+	{ 6115, 2526, 21440 },
+	{ 6115, 2526, 28835 },
+	{ 6115, 4153, 21440 },
+	{ 6115, 2526, 44653 },
+	{ 59076, 2526, 44653 },
+	{ 6115, 4153, 44653 },
+	{ 6115, 4153, 45168 },
+	{ 59076, 4153, 45168 },
+	{ 59076, 2526, 45168 },
+	{ 59076, 2526, 60472 },
+	{ 59076, 2526, 53077 },
+	{ 59076, 4153, 60472 },
+	{ 6115, 2526, 13016 },
+	{ 59076, 2526, 13016 },
+	{ 6115, 4153, 13016 },
+	{ 6115, 4153, 13531 },
+	{ 59076, 4153, 13531 },
+	{ 59076, 2526, 13531 },
+	{ 59076, 2526, 28835 },
+	{ 59076, 2526, 21440 },
+	{ 59076, 4153, 28835 },
+	{ 6115, 4153, 36744 },
+	{ 6115, 4153, 29349 },
+	{ 6115, 2526, 29349 },
+	{ 6115, 2526, 52562 },
+	{ 59076, 2526, 52562 },
+	{ 6115, 4153, 52562 },
+	{ 6115, 4153, 53077 },
+	{ 59076, 4153, 53077 },
+	{ 59076, 2526, 53077 },
+	{ 6115, 2526, 20925 },
+	{ 59076, 2526, 20925 },
+	{ 6115, 4153, 20925 },
+	{ 6115, 4153, 21440 },
+	{ 59076, 4153, 21440 },
+	{ 59076, 2526, 21440 },
+	{ 59076, 2526, 36744 },
+	{ 59076, 2526, 29349 },
+	{ 59076, 4153, 36744 },
+	{ 6115, 4153, 44653 },
+	{ 6115, 4153, 37259 },
+	{ 6115, 2526, 37259 },
+	{ 6115, 2526, 60472 },
+	{ 59076, 2526, 60472 },
+	{ 6115, 4153, 60472 },
+	{ 6115, 4153, 13016 },
+	{ 6115, 4153, 5622 },
+	{ 6115, 2526, 5622 },
+	{ 6115, 2526, 28835 },
+	{ 59076, 2526, 28835 },
+	{ 6115, 4153, 28835 },
+	{ 6115, 4153, 29349 },
+	{ 59076, 4153, 29349 },
+	{ 59076, 2526, 29349 },
+	{ 59076, 2526, 44653 },
+	{ 59076, 2526, 37259 },
+	{ 59076, 4153, 44653 },
+	{ 6115, 4153, 52562 },
+	{ 6115, 4153, 45168 },
+	{ 6115, 2526, 45168 },
+	{ 58699, 567, 5399 },
+	{ 6538, 567, 5399 },
+	{ 874, 567, 815 },
+	{ 6601, 177, 54375 },
+	{ 54287, 0, 5912 },
+	{ 58748, 693, 11769 },
+	{ 6513, 1797, 54250 },
+	{ 10974, 2490, 60106 },
+	{ 54199, 1619, 5788 },
+	{ 54287, 0, 5912 },
+	{ 6601, 177, 54375 },
+	{ 54199, 1619, 5788 },
+	{ 11062, 871, 60231 },
+	{ 58748, 693, 11769 },
+	{ 10974, 2490, 60106 },
+	{ 10974, 2490, 60106 },
+	{ 6513, 1797, 54250 },
+	{ 6601, 177, 54375 },
+	{ 58748, 693, 11769 },
+	{ 54287, 0, 5912 },
+	{ 58660, 2313, 11644 },
+	{ 64814, 785, 64975 },
+	{ 64814, 6796, 60501 },
+	{ 64814, 64621, 65086 },
+	{ 64814, 64973, 65135 },
+	{ 64814, 59193, 60393 },
+	{ 64814, 64973, 1186 },
+	{ 64814, 625, 949 },
+	{ 64814, 6405, 5691 },
+	{ 64814, 625, 64898 },
+	{ 62855, 6405, 60630 },
+	{ 62855, 6405, 5691 },
+	{ 64814, 625, 949 },
+	{ 62855, 6796, 60501 },
+	{ 62855, 58957, 60501 },
+	{ 64814, 58957, 60501 },
+	{ 62855, 6622, 5399 },
+	{ 62855, 58783, 5399 },
+	{ 64814, 64794, 926 },
+	{ 62855, 58783, 5399 },
+	{ 62855, 6622, 5399 },
+	{ 64814, 6622, 5399 },
+	{ 62855, 6405, 5691 },
+	{ 62855, 6405, 60630 },
+	{ 64814, 6405, 60630 },
+	{ 62855, 58957, 60501 },
+	{ 64814, 64621, 65086 },
+	{ 64814, 58957, 60501 },
+	{ 62855, 58957, 60501 },
+	{ 62855, 6796, 60501 },
+	{ 64814, 785, 64975 },
+	{ 62855, 6405, 60630 },
+	{ 64814, 625, 64898 },
+	{ 64814, 6405, 60630 },
+	{ 62855, 59193, 5454 },
+	{ 62855, 59193, 60393 },
+	{ 64814, 64973, 65135 },
+	{ 62855, 6622, 5399 },
+	{ 64814, 958, 815 },
+	{ 64814, 6622, 5399 },
+	{ 62855, 59193, 60393 },
+	{ 62855, 59193, 5454 },
+	{ 64814, 59193, 5454 },
+	{ 62855, 59193, 60393 },
+	{ 64814, 59193, 60393 },
+	{ 64814, 64973, 65135 },
+	{ 62855, 59193, 5454 },
+	{ 64814, 64973, 1186 },
+	{ 64814, 59193, 5454 },
+	{ 62855, 6405, 5691 },
+	{ 64814, 6405, 5691 },
+	{ 64814, 625, 949 },
+	{ 62855, 6796, 60501 },
+	{ 64814, 6796, 60501 },
+	{ 64814, 785, 64975 },
+	{ 62855, 58783, 5399 },
+	{ 64814, 58783, 5399 },
+	{ 64814, 64794, 926 },
+	{ 62855, 6199, 60472 },
+	{ 62855, 6199, 53077 },
+	{ 62855, 59160, 53077 },
+	{ 62855, 6199, 52562 },
+	{ 62855, 6199, 45168 },
+	{ 62855, 59160, 45168 },
+	{ 62855, 6199, 44653 },
+	{ 62855, 6199, 37259 },
+	{ 62855, 59160, 37259 },
+	{ 62855, 6199, 36744 },
+	{ 62855, 6199, 29349 },
+	{ 62855, 59160, 29349 },
+	{ 62855, 6199, 28835 },
+	{ 62855, 6199, 21440 },
+	{ 62855, 59160, 21440 },
+	{ 62855, 6199, 20925 },
+	{ 62855, 6199, 13531 },
+	{ 62855, 59160, 13531 },
+	{ 62855, 6199, 13016 },
+	{ 62855, 6199, 5622 },
+	{ 62855, 59160, 5622 },
+	{ 61228, 6199, 60472 },
+	{ 61228, 59160, 60472 },
+	{ 61228, 6199, 53077 },
+	{ 61228, 6199, 52562 },
+	{ 61228, 59160, 52562 },
+	{ 61228, 6199, 45168 },
+	{ 61228, 6199, 44653 },
+	{ 61228, 59160, 44653 },
+	{ 61228, 6199, 37259 },
+	{ 61228, 6199, 36744 },
+	{ 61228, 59160, 36744 },
+	{ 61228, 6199, 29349 },
+	{ 61228, 6199, 28835 },
+	{ 61228, 59160, 28835 },
+	{ 61228, 6199, 21440 },
+	{ 61228, 6199, 20925 },
+	{ 61228, 59160, 20925 },
+	{ 61228, 6199, 13531 },
+	{ 61228, 6199, 13016 },
+	{ 61228, 59160, 13016 },
+	{ 61228, 6199, 5622 },
+	{ 62855, 59160, 5622 },
+	{ 61228, 59160, 5622 },
+	{ 61228, 59160, 13016 },
+	{ 62855, 6199, 20925 },
+	{ 61228, 6199, 20925 },
+	{ 61228, 6199, 13531 },
+	{ 62855, 59160, 36744 },
+	{ 61228, 59160, 36744 },
+	{ 62855, 6199, 36744 },
+	{ 62855, 6199, 37259 },
+	{ 61228, 6199, 37259 },
+	{ 61228, 59160, 37259 },
+	{ 62855, 59160, 45168 },
+	{ 61228, 59160, 45168 },
+	{ 61228, 59160, 52562 },
+	{ 62855, 6199, 60472 },
+	{ 61228, 6199, 60472 },
+	{ 61228, 6199, 53077 },
+	{ 62855, 6199, 5622 },
+	{ 61228, 6199, 5622 },
+	{ 62855, 59160, 5622 },
+	{ 62855, 59160, 13531 },
+	{ 61228, 59160, 13531 },
+	{ 61228, 59160, 20925 },
+	{ 62855, 6199, 28835 },
+	{ 61228, 6199, 28835 },
+	{ 62855, 6199, 21440 },
+	{ 62855, 59160, 44653 },
+	{ 61228, 59160, 44653 },
+	{ 62855, 6199, 44653 },
+	{ 62855, 6199, 45168 },
+	{ 61228, 6199, 45168 },
+	{ 61228, 59160, 45168 },
+	{ 62855, 59160, 53077 },
+	{ 61228, 59160, 53077 },
+	{ 61228, 59160, 60472 },
+	{ 62855, 59160, 13016 },
+	{ 61228, 59160, 13016 },
+	{ 62855, 6199, 13016 },
+	{ 62855, 6199, 13531 },
+	{ 61228, 6199, 13531 },
+	{ 62855, 59160, 13531 },
+	{ 62855, 59160, 21440 },
+	{ 61228, 59160, 21440 },
+	{ 61228, 59160, 28835 },
+	{ 62855, 6199, 36744 },
+	{ 61228, 6199, 36744 },
+	{ 61228, 6199, 29349 },
+	{ 62855, 59160, 52562 },
+	{ 61228, 59160, 52562 },
+	{ 62855, 6199, 52562 },
+	{ 62855, 6199, 53077 },
+	{ 61228, 6199, 53077 },
+	{ 62855, 59160, 53077 },
+	{ 62855, 59160, 20925 },
+	{ 61228, 59160, 20925 },
+	{ 62855, 6199, 20925 },
+	{ 62855, 6199, 21440 },
+	{ 61228, 6199, 21440 },
+	{ 62855, 59160, 21440 },
+	{ 62855, 59160, 29349 },
+	{ 61228, 59160, 29349 },
+	{ 61228, 59160, 36744 },
+	{ 62855, 6199, 44653 },
+	{ 61228, 6199, 44653 },
+	{ 61228, 6199, 37259 },
+	{ 62855, 59160, 60472 },
+	{ 61228, 59160, 60472 },
+	{ 62855, 6199, 60472 },
+	{ 62855, 6199, 13016 },
+	{ 61228, 6199, 13016 },
+	{ 61228, 6199, 5622 },
+	{ 62855, 59160, 28835 },
+	{ 61228, 59160, 28835 },
+	{ 62855, 6199, 28835 },
+	{ 62855, 6199, 29349 },
+	{ 61228, 6199, 29349 },
+	{ 62855, 59160, 29349 },
+	{ 62855, 59160, 37259 },
+	{ 61228, 59160, 37259 },
+	{ 61228, 59160, 44653 },
+	{ 62855, 6199, 52562 },
+	{ 61228, 6199, 52562 },
+	{ 61228, 6199, 45168 },
+	{ 64814, 64794, 926 },
+	{ 64814, 58783, 5399 },
+	{ 64814, 958, 815 },
+	{ 64510, 11146, 60231 },
+	{ 65204, 6685, 54375 },
+	{ 64688, 58832, 11769 },
+	{ 62891, 11058, 60106 },
+	{ 63069, 58744, 11644 },
+	{ 63762, 54283, 5788 },
+	{ 65204, 6685, 54375 },
+	{ 63584, 6597, 54250 },
+	{ 65382, 54371, 5912 },
+	{ 64688, 58832, 11769 },
+	{ 63069, 58744, 11644 },
+	{ 64510, 11146, 60231 },
+	{ 64510, 11146, 60231 },
+	{ 62891, 11058, 60106 },
+	{ 65204, 6685, 54375 },
+	{ 65382, 54371, 5912 },
+	{ 63762, 54283, 5788 },
+	{ 63069, 58744, 11644 },
+	{ 64814, 6796, 60501 },
+	{ 64814, 58957, 60501 },
+	{ 64814, 64621, 65086 },
+	{ 64814, 59193, 60393 },
+	{ 64814, 59193, 5454 },
+	{ 64814, 64973, 1186 },
+	{ 64814, 6405, 5691 },
+	{ 64814, 6405, 60630 },
+	{ 64814, 625, 64898 },
+	{ 64814, 625, 64898 },
+	{ 62855, 6405, 60630 },
+	{ 64814, 625, 949 },
+	{ 64814, 6796, 60501 },
+	{ 62855, 6796, 60501 },
+	{ 64814, 58957, 60501 },
+	{ 64814, 958, 815 },
+	{ 62855, 6622, 5399 },
+	{ 64814, 64794, 926 },
+	{ 64814, 58783, 5399 },
+	{ 62855, 58783, 5399 },
+	{ 64814, 6622, 5399 },
+	{ 64814, 6405, 5691 },
+	{ 62855, 6405, 5691 },
+	{ 64814, 6405, 60630 },
+	{ 64814, 64621, 65086 },
+	{ 62855, 58957, 60501 },
+	{ 64814, 785, 64975 },
+	{ 64814, 64973, 1186 },
+	{ 62855, 59193, 5454 },
+	{ 64814, 64973, 65135 },
+	{ 64814, 59193, 60393 },
+	{ 62855, 59193, 60393 },
+	{ 64814, 59193, 5454 },
+	{ 62855, 59160, 60472 },
+	{ 62855, 6199, 60472 },
+	{ 62855, 59160, 53077 },
+	{ 62855, 59160, 52562 },
+	{ 62855, 6199, 52562 },
+	{ 62855, 59160, 45168 },
+	{ 62855, 59160, 44653 },
+	{ 62855, 6199, 44653 },
+	{ 62855, 59160, 37259 },
+	{ 62855, 59160, 36744 },
+	{ 62855, 6199, 36744 },
+	{ 62855, 59160, 29349 },
+	{ 62855, 59160, 28835 },
+	{ 62855, 6199, 28835 },
+	{ 62855, 59160, 21440 },
+	{ 62855, 59160, 20925 },
+	{ 62855, 6199, 20925 },
+	{ 62855, 59160, 13531 },
+	{ 62855, 59160, 13016 },
+	{ 62855, 6199, 13016 },
+	{ 62855, 59160, 5622 },
+	{ 61228, 59160, 60472 },
+	{ 61228, 59160, 53077 },
+	{ 61228, 6199, 53077 },
+	{ 61228, 59160, 52562 },
+	{ 61228, 59160, 45168 },
+	{ 61228, 6199, 45168 },
+	{ 61228, 59160, 44653 },
+	{ 61228, 59160, 37259 },
+	{ 61228, 6199, 37259 },
+	{ 61228, 59160, 36744 },
+	{ 61228, 59160, 29349 },
+	{ 61228, 6199, 29349 },
+	{ 61228, 59160, 28835 },
+	{ 61228, 59160, 21440 },
+	{ 61228, 6199, 21440 },
+	{ 61228, 59160, 20925 },
+	{ 61228, 59160, 13531 },
+	{ 61228, 6199, 13531 },
+	{ 61228, 59160, 13016 },
+	{ 61228, 59160, 5622 },
+	{ 61228, 6199, 5622 },
+	{ 62855, 59160, 13016 },
+	{ 62855, 59160, 5622 },
+	{ 61228, 59160, 13016 },
+	{ 62855, 6199, 13531 },
+	{ 62855, 6199, 20925 },
+	{ 61228, 6199, 13531 },
+	{ 61228, 59160, 36744 },
+	{ 61228, 6199, 36744 },
+	{ 62855, 6199, 36744 },
+	{ 62855, 59160, 37259 },
+	{ 62855, 6199, 37259 },
+	{ 61228, 59160, 37259 },
+	{ 62855, 59160, 52562 },
+	{ 62855, 59160, 45168 },
+	{ 61228, 59160, 52562 },
+	{ 62855, 6199, 53077 },
+	{ 62855, 6199, 60472 },
+	{ 61228, 6199, 53077 },
+	{ 61228, 6199, 5622 },
+	{ 61228, 59160, 5622 },
+	{ 62855, 59160, 5622 },
+	{ 62855, 59160, 20925 },
+	{ 62855, 59160, 13531 },
+	{ 61228, 59160, 20925 },
+	{ 61228, 6199, 28835 },
+	{ 61228, 6199, 21440 },
+	{ 62855, 6199, 21440 },
+	{ 61228, 59160, 44653 },
+	{ 61228, 6199, 44653 },
+	{ 62855, 6199, 44653 },
+	{ 62855, 59160, 45168 },
+	{ 62855, 6199, 45168 },
+	{ 61228, 59160, 45168 },
+	{ 62855, 59160, 60472 },
+	{ 62855, 59160, 53077 },
+	{ 61228, 59160, 60472 },
+	{ 61228, 59160, 13016 },
+	{ 61228, 6199, 13016 },
+	{ 62855, 6199, 13016 },
+	{ 61228, 6199, 13531 },
+	{ 61228, 59160, 13531 },
+	{ 62855, 59160, 13531 },
+	{ 62855, 59160, 28835 },
+	{ 62855, 59160, 21440 },
+	{ 61228, 59160, 28835 },
+	{ 62855, 6199, 29349 },
+	{ 62855, 6199, 36744 },
+	{ 61228, 6199, 29349 },
+	{ 61228, 59160, 52562 },
+	{ 61228, 6199, 52562 },
+	{ 62855, 6199, 52562 },
+	{ 61228, 6199, 53077 },
+	{ 61228, 59160, 53077 },
+	{ 62855, 59160, 53077 },
+	{ 61228, 59160, 20925 },
+	{ 61228, 6199, 20925 },
+	{ 62855, 6199, 20925 },
+	{ 61228, 6199, 21440 },
+	{ 61228, 59160, 21440 },
+	{ 62855, 59160, 21440 },
+	{ 62855, 59160, 36744 },
+	{ 62855, 59160, 29349 },
+	{ 61228, 59160, 36744 },
+	{ 62855, 6199, 37259 },
+	{ 62855, 6199, 44653 },
+	{ 61228, 6199, 37259 },
+	{ 61228, 59160, 60472 },
+	{ 61228, 6199, 60472 },
+	{ 62855, 6199, 60472 },
+	{ 62855, 6199, 5622 },
+	{ 62855, 6199, 13016 },
+	{ 61228, 6199, 5622 },
+	{ 61228, 59160, 28835 },
+	{ 61228, 6199, 28835 },
+	{ 62855, 6199, 28835 },
+	{ 61228, 6199, 29349 },
+	{ 61228, 59160, 29349 },
+	{ 62855, 59160, 29349 },
+	{ 62855, 59160, 44653 },
+	{ 62855, 59160, 37259 },
+	{ 61228, 59160, 44653 },
+	{ 62855, 6199, 45168 },
+	{ 62855, 6199, 52562 },
+	{ 61228, 6199, 45168 },
+	{ 64814, 58783, 5399 },
+	{ 64814, 6622, 5399 },
+	{ 64814, 958, 815 },
+	{ 65204, 6685, 54375 },
+	{ 65382, 54371, 5912 },
+	{ 64688, 58832, 11769 },
+	{ 63584, 6597, 54250 },
+	{ 62891, 11058, 60106 },
+	{ 63762, 54283, 5788 },
+	{ 63584, 6597, 54250 },
+	{ 63762, 54283, 5788 },
+	{ 65382, 54371, 5912 },
+	{ 63069, 58744, 11644 },
+	{ 62891, 11058, 60106 },
+	{ 64510, 11146, 60231 },
+	{ 62891, 11058, 60106 },
+	{ 63584, 6597, 54250 },
+	{ 65204, 6685, 54375 },
+	{ 64688, 58832, 11769 },
+	{ 65382, 54371, 5912 },
+	{ 63069, 58744, 11644 },
 };
 
-const uint16_t *indices1 = (uint16_t*)0;
\ No newline at end of file
+const vertex_attributes_t attributes1[] =
+{ // normal[xyz], uv[xy]
+	{ 127, 127, 255,  0, 0 },
+	{ 127, 127, 255,  18, 24 },
+	{ 127, 127, 255,  18, 231 },
+	{ 127, 127, 255,  0, 255 },
+	{ 127, 127, 255,  18, 232 },
+	{ 127, 127, 255,  253, 255 },
+	{ 127, 127, 255,  254, 0 },
+	{ 127, 127, 255,  235, 22 },
+	{ 127, 127, 255,  17, 22 },
+	{ 127, 86, 6,  17, 22 },
+	{ 127, 86, 6,  235, 22 },
+	{ 127, 86, 6,  0, 0 },
+	{ 255, 127, 127,  122, 25 },
+	{ 255, 127, 127,  122, 229 },
+	{ 255, 127, 127,  132, 229 },
+	{ 177, 127, 10,  236, 23 },
+	{ 177, 127, 10,  236, 230 },
+	{ 177, 127, 10,  255, 1 },
+	{ 0, 127, 127,  122, 25 },
+	{ 0, 127, 127,  122, 229 },
+	{ 0, 127, 127,  132, 25 },
+	{ 127, 255, 127,  122, 25 },
+	{ 127, 255, 127,  122, 229 },
+	{ 127, 255, 127,  132, 229 },
+	{ 226, 207, 127,  18, 231 },
+	{ 226, 207, 127,  0, 253 },
+	{ 226, 207, 127,  18, 231 },
+	{ 76, 127, 10,  18, 231 },
+	{ 76, 127, 10,  18, 24 },
+	{ 76, 127, 10,  0, 0 },
+	{ 24, 203, 127,  17, 22 },
+	{ 24, 203, 127,  0, 0 },
+	{ 24, 203, 127,  17, 22 },
+	{ 127, 168, 6,  236, 232 },
+	{ 127, 168, 6,  18, 232 },
+	{ 127, 168, 6,  0, 255 },
+	{ 28, 47, 127,  236, 23 },
+	{ 28, 47, 127,  255, 1 },
+	{ 28, 47, 127,  236, 23 },
+	{ 127, 0, 127,  122, 25 },
+	{ 127, 0, 127,  122, 229 },
+	{ 127, 0, 127,  132, 25 },
+	{ 28, 46, 127,  18, 232 },
+	{ 28, 46, 127,  18, 232 },
+	{ 28, 46, 127,  0, 255 },
+	{ 230, 51, 127,  236, 232 },
+	{ 230, 51, 127,  253, 255 },
+	{ 230, 51, 127,  236, 232 },
+	{ 226, 208, 127,  235, 22 },
+	{ 226, 208, 127,  235, 22 },
+	{ 226, 208, 127,  254, 0 },
+	{ 229, 51, 127,  18, 24 },
+	{ 229, 51, 127,  18, 24 },
+	{ 229, 51, 127,  0, 0 },
+	{ 25, 203, 127,  236, 230 },
+	{ 25, 203, 127,  236, 230 },
+	{ 25, 203, 127,  254, 254 },
+	{ 127, 127, 255,  18, 22 },
+	{ 127, 127, 255,  47, 22 },
+	{ 127, 127, 255,  47, 231 },
+	{ 127, 127, 255,  49, 22 },
+	{ 127, 127, 255,  79, 22 },
+	{ 127, 127, 255,  49, 231 },
+	{ 127, 127, 255,  81, 22 },
+	{ 127, 127, 255,  110, 22 },
+	{ 127, 127, 255,  110, 231 },
+	{ 127, 127, 255,  112, 22 },
+	{ 127, 127, 255,  141, 22 },
+	{ 127, 127, 255,  141, 231 },
+	{ 127, 127, 255,  143, 22 },
+	{ 127, 127, 255,  173, 22 },
+	{ 127, 127, 255,  173, 231 },
+	{ 127, 127, 255,  175, 22 },
+	{ 127, 127, 255,  204, 22 },
+	{ 127, 127, 255,  175, 231 },
+	{ 127, 127, 255,  206, 22 },
+	{ 127, 127, 255,  235, 22 },
+	{ 127, 127, 255,  235, 231 },
+	{ 127, 127, 0,  18, 22 },
+	{ 127, 127, 0,  18, 231 },
+	{ 127, 127, 0,  47, 22 },
+	{ 127, 127, 0,  49, 22 },
+	{ 127, 127, 0,  49, 231 },
+	{ 127, 127, 0,  79, 231 },
+	{ 127, 127, 0,  81, 22 },
+	{ 127, 127, 0,  81, 231 },
+	{ 127, 127, 0,  110, 231 },
+	{ 127, 127, 0,  112, 22 },
+	{ 127, 127, 0,  112, 231 },
+	{ 127, 127, 0,  141, 22 },
+	{ 127, 127, 0,  143, 22 },
+	{ 127, 127, 0,  143, 231 },
+	{ 127, 127, 0,  173, 22 },
+	{ 127, 127, 0,  175, 22 },
+	{ 127, 127, 0,  175, 231 },
+	{ 127, 127, 0,  204, 231 },
+	{ 127, 127, 0,  206, 22 },
+	{ 127, 127, 0,  206, 231 },
+	{ 127, 127, 0,  235, 231 },
+	{ 127, 255, 127,  235, 231 },
+	{ 127, 255, 127,  235, 231 },
+	{ 127, 255, 127,  206, 231 },
+	{ 127, 0, 127,  175, 22 },
+	{ 127, 0, 127,  175, 22 },
+	{ 127, 0, 127,  204, 22 },
+	{ 0, 127, 127,  112, 231 },
+	{ 0, 127, 127,  112, 231 },
+	{ 0, 127, 127,  112, 22 },
+	{ 255, 127, 127,  110, 22 },
+	{ 255, 127, 127,  110, 22 },
+	{ 255, 127, 127,  110, 231 },
+	{ 127, 255, 127,  79, 231 },
+	{ 127, 255, 127,  79, 231 },
+	{ 127, 255, 127,  49, 231 },
+	{ 127, 0, 127,  18, 22 },
+	{ 127, 0, 127,  18, 22 },
+	{ 127, 0, 127,  47, 22 },
+	{ 255, 127, 127,  235, 22 },
+	{ 255, 127, 127,  235, 22 },
+	{ 255, 127, 127,  235, 231 },
+	{ 127, 255, 127,  204, 231 },
+	{ 127, 255, 127,  204, 231 },
+	{ 127, 255, 127,  175, 231 },
+	{ 127, 0, 127,  143, 22 },
+	{ 127, 0, 127,  143, 22 },
+	{ 127, 0, 127,  173, 22 },
+	{ 0, 127, 127,  81, 231 },
+	{ 0, 127, 127,  81, 231 },
+	{ 0, 127, 127,  81, 22 },
+	{ 255, 127, 127,  79, 22 },
+	{ 255, 127, 127,  79, 22 },
+	{ 255, 127, 127,  79, 231 },
+	{ 127, 255, 127,  47, 231 },
+	{ 127, 255, 127,  47, 231 },
+	{ 127, 255, 127,  18, 231 },
+	{ 0, 127, 127,  206, 231 },
+	{ 0, 127, 127,  206, 231 },
+	{ 0, 127, 127,  206, 22 },
+	{ 255, 127, 127,  204, 22 },
+	{ 255, 127, 127,  204, 22 },
+	{ 255, 127, 127,  204, 231 },
+	{ 127, 255, 127,  173, 231 },
+	{ 127, 255, 127,  173, 231 },
+	{ 127, 255, 127,  143, 231 },
+	{ 127, 0, 127,  112, 22 },
+	{ 127, 0, 127,  112, 22 },
+	{ 127, 0, 127,  141, 22 },
+	{ 0, 127, 127,  49, 231 },
+	{ 0, 127, 127,  49, 231 },
+	{ 0, 127, 127,  49, 22 },
+	{ 255, 127, 127,  47, 22 },
+	{ 255, 127, 127,  47, 22 },
+	{ 255, 127, 127,  47, 231 },
+	{ 0, 127, 127,  175, 231 },
+	{ 0, 127, 127,  175, 231 },
+	{ 0, 127, 127,  175, 22 },
+	{ 255, 127, 127,  173, 22 },
+	{ 255, 127, 127,  173, 22 },
+	{ 255, 127, 127,  173, 231 },
+	{ 127, 255, 127,  141, 231 },
+	{ 127, 255, 127,  141, 231 },
+	{ 127, 255, 127,  112, 231 },
+	{ 127, 0, 127,  81, 22 },
+	{ 127, 0, 127,  81, 22 },
+	{ 127, 0, 127,  110, 22 },
+	{ 0, 127, 127,  18, 231 },
+	{ 0, 127, 127,  18, 231 },
+	{ 0, 127, 127,  18, 22 },
+	{ 127, 0, 127,  206, 22 },
+	{ 127, 0, 127,  206, 22 },
+	{ 127, 0, 127,  235, 22 },
+	{ 0, 127, 127,  143, 231 },
+	{ 0, 127, 127,  143, 231 },
+	{ 0, 127, 127,  143, 22 },
+	{ 255, 127, 127,  141, 22 },
+	{ 255, 127, 127,  141, 22 },
+	{ 255, 127, 127,  141, 231 },
+	{ 127, 255, 127,  110, 231 },
+	{ 127, 255, 127,  110, 231 },
+	{ 127, 255, 127,  81, 231 },
+	{ 127, 0, 127,  49, 22 },
+	{ 127, 0, 127,  49, 22 },
+	{ 127, 0, 127,  79, 22 },
+	{ 127, 127, 255,  254, 254 },
+	{ 127, 127, 255,  236, 230 },
+	{ 127, 127, 255,  236, 23 },
+	{ 118, 135, 254,  81, 22 },
+	{ 118, 135, 254,  110, 22 },
+	{ 118, 135, 254,  110, 231 },
+	{ 136, 119, 0,  81, 22 },
+	{ 136, 119, 0,  81, 231 },
+	{ 136, 119, 0,  110, 22 },
+	{ 216, 36, 139,  131, 27 },
+	{ 216, 36, 139,  123, 27 },
+	{ 216, 36, 139,  131, 227 },
+	{ 38, 218, 115,  131, 27 },
+	{ 38, 218, 115,  123, 27 },
+	{ 38, 218, 115,  131, 227 },
+	{ 50, 26, 127,  80, 29 },
+	{ 50, 26, 127,  81, 22 },
+	{ 50, 26, 127,  110, 29 },
+	{ 204, 228, 127,  109, 226 },
+	{ 204, 228, 127,  110, 231 },
+	{ 204, 228, 127,  81, 231 },
+	{ 127, 127, 255,  0, 253 },
+	{ 127, 127, 255,  0, 0 },
+	{ 127, 127, 255,  18, 231 },
+	{ 127, 127, 255,  18, 232 },
+	{ 127, 127, 255,  236, 232 },
+	{ 127, 127, 255,  253, 255 },
+	{ 127, 127, 255,  0, 0 },
+	{ 127, 127, 255,  254, 0 },
+	{ 127, 127, 255,  17, 22 },
+	{ 127, 86, 6,  235, 22 },
+	{ 127, 86, 6,  254, 0 },
+	{ 127, 86, 6,  0, 0 },
+	{ 255, 127, 127,  132, 25 },
+	{ 255, 127, 127,  122, 25 },
+	{ 255, 127, 127,  132, 229 },
+	{ 178, 127, 10,  236, 230 },
+	{ 178, 127, 10,  254, 254 },
+	{ 178, 127, 10,  255, 1 },
+	{ 0, 127, 127,  122, 229 },
+	{ 0, 127, 127,  132, 229 },
+	{ 0, 127, 127,  132, 25 },
+	{ 127, 255, 127,  132, 25 },
+	{ 127, 255, 127,  122, 25 },
+	{ 127, 255, 127,  132, 229 },
+	{ 77, 127, 10,  0, 253 },
+	{ 77, 127, 10,  18, 231 },
+	{ 77, 127, 10,  0, 0 },
+	{ 127, 168, 6,  253, 255 },
+	{ 127, 168, 6,  236, 232 },
+	{ 127, 168, 6,  0, 255 },
+	{ 127, 0, 127,  122, 229 },
+	{ 127, 0, 127,  132, 229 },
+	{ 127, 0, 127,  132, 25 },
+	{ 127, 127, 255,  18, 231 },
+	{ 127, 127, 255,  18, 22 },
+	{ 127, 127, 255,  47, 231 },
+	{ 127, 127, 255,  79, 22 },
+	{ 127, 127, 255,  79, 231 },
+	{ 127, 127, 255,  49, 231 },
+	{ 127, 127, 255,  81, 231 },
+	{ 127, 127, 255,  81, 22 },
+	{ 127, 127, 255,  110, 231 },
+	{ 127, 127, 255,  112, 231 },
+	{ 127, 127, 255,  112, 22 },
+	{ 127, 127, 255,  141, 231 },
+	{ 127, 127, 255,  143, 231 },
+	{ 127, 127, 255,  143, 22 },
+	{ 127, 127, 255,  173, 231 },
+	{ 127, 127, 255,  204, 22 },
+	{ 127, 127, 255,  204, 231 },
+	{ 127, 127, 255,  175, 231 },
+	{ 127, 127, 255,  206, 231 },
+	{ 127, 127, 255,  206, 22 },
+	{ 127, 127, 255,  235, 231 },
+	{ 127, 127, 0,  18, 231 },
+	{ 127, 127, 0,  47, 231 },
+	{ 127, 127, 0,  47, 22 },
+	{ 127, 127, 0,  79, 22 },
+	{ 127, 127, 0,  49, 22 },
+	{ 127, 127, 0,  79, 231 },
+	{ 127, 127, 0,  110, 22 },
+	{ 127, 127, 0,  81, 22 },
+	{ 127, 127, 0,  110, 231 },
+	{ 127, 127, 0,  112, 231 },
+	{ 127, 127, 0,  141, 231 },
+	{ 127, 127, 0,  141, 22 },
+	{ 127, 127, 0,  143, 231 },
+	{ 127, 127, 0,  173, 231 },
+	{ 127, 127, 0,  173, 22 },
+	{ 127, 127, 0,  204, 22 },
+	{ 127, 127, 0,  175, 22 },
+	{ 127, 127, 0,  204, 231 },
+	{ 127, 127, 0,  235, 22 },
+	{ 127, 127, 0,  206, 22 },
+	{ 127, 127, 0,  235, 231 },
+	{ 127, 255, 127,  206, 231 },
+	{ 127, 255, 127,  235, 231 },
+	{ 127, 255, 127,  206, 231 },
+	{ 127, 0, 127,  175, 22 },
+	{ 127, 0, 127,  204, 22 },
+	{ 127, 0, 127,  204, 22 },
+	{ 0, 127, 127,  112, 231 },
+	{ 0, 127, 127,  112, 22 },
+	{ 0, 127, 127,  112, 22 },
+	{ 255, 127, 127,  110, 231 },
+	{ 255, 127, 127,  110, 22 },
+	{ 255, 127, 127,  110, 231 },
+	{ 127, 255, 127,  49, 231 },
+	{ 127, 255, 127,  79, 231 },
+	{ 127, 255, 127,  49, 231 },
+	{ 127, 0, 127,  18, 22 },
+	{ 127, 0, 127,  47, 22 },
+	{ 127, 0, 127,  47, 22 },
+	{ 255, 127, 127,  235, 231 },
+	{ 255, 127, 127,  235, 22 },
+	{ 255, 127, 127,  235, 231 },
+	{ 127, 255, 127,  175, 231 },
+	{ 127, 255, 127,  204, 231 },
+	{ 127, 255, 127,  175, 231 },
+	{ 127, 0, 127,  143, 22 },
+	{ 127, 0, 127,  173, 22 },
+	{ 127, 0, 127,  173, 22 },
+	{ 0, 127, 127,  81, 231 },
+	{ 0, 127, 127,  81, 22 },
+	{ 0, 127, 127,  81, 22 },
+	{ 255, 127, 127,  79, 231 },
+	{ 255, 127, 127,  79, 22 },
+	{ 255, 127, 127,  79, 231 },
+	{ 127, 255, 127,  18, 231 },
+	{ 127, 255, 127,  47, 231 },
+	{ 127, 255, 127,  18, 231 },
+	{ 0, 127, 127,  206, 231 },
+	{ 0, 127, 127,  206, 22 },
+	{ 0, 127, 127,  206, 22 },
+	{ 255, 127, 127,  204, 231 },
+	{ 255, 127, 127,  204, 22 },
+	{ 255, 127, 127,  204, 231 },
+	{ 127, 255, 127,  143, 231 },
+	{ 127, 255, 127,  173, 231 },
+	{ 127, 255, 127,  143, 231 },
+	{ 127, 0, 127,  112, 22 },
+	{ 127, 0, 127,  141, 22 },
+	{ 127, 0, 127,  141, 22 },
+	{ 0, 127, 127,  49, 231 },
+	{ 0, 127, 127,  49, 22 },
+	{ 0, 127, 127,  49, 22 },
+	{ 255, 127, 127,  47, 231 },
+	{ 255, 127, 127,  47, 22 },
+	{ 255, 127, 127,  47, 231 },
+	{ 0, 127, 127,  175, 231 },
+	{ 0, 127, 127,  175, 22 },
+	{ 0, 127, 127,  175, 22 },
+	{ 255, 127, 127,  173, 231 },
+	{ 255, 127, 127,  173, 22 },
+	{ 255, 127, 127,  173, 231 },
+	{ 127, 255, 127,  112, 231 },
+	{ 127, 255, 127,  141, 231 },
+	{ 127, 255, 127,  112, 231 },
+	{ 127, 0, 127,  81, 22 },
+	{ 127, 0, 127,  110, 22 },
+	{ 127, 0, 127,  110, 22 },
+	{ 0, 127, 127,  18, 231 },
+	{ 0, 127, 127,  18, 22 },
+	{ 0, 127, 127,  18, 22 },
+	{ 127, 0, 127,  206, 22 },
+	{ 127, 0, 127,  235, 22 },
+	{ 127, 0, 127,  235, 22 },
+	{ 0, 127, 127,  143, 231 },
+	{ 0, 127, 127,  143, 22 },
+	{ 0, 127, 127,  143, 22 },
+	{ 255, 127, 127,  141, 231 },
+	{ 255, 127, 127,  141, 22 },
+	{ 255, 127, 127,  141, 231 },
+	{ 127, 255, 127,  81, 231 },
+	{ 127, 255, 127,  110, 231 },
+	{ 127, 255, 127,  81, 231 },
+	{ 127, 0, 127,  49, 22 },
+	{ 127, 0, 127,  79, 22 },
+	{ 127, 0, 127,  79, 22 },
+	{ 127, 127, 255,  255, 1 },
+	{ 127, 127, 255,  254, 254 },
+	{ 127, 127, 255,  236, 23 },
+	{ 118, 135, 254,  81, 231 },
+	{ 118, 135, 254,  81, 22 },
+	{ 118, 135, 254,  110, 231 },
+	{ 136, 119, 0,  81, 231 },
+	{ 136, 119, 0,  110, 231 },
+	{ 136, 119, 0,  110, 22 },
+	{ 216, 36, 139,  123, 27 },
+	{ 216, 36, 139,  123, 227 },
+	{ 216, 36, 139,  131, 227 },
+	{ 38, 218, 115,  123, 27 },
+	{ 38, 218, 115,  123, 227 },
+	{ 38, 218, 115,  131, 227 },
+	{ 50, 26, 127,  81, 22 },
+	{ 50, 26, 127,  110, 22 },
+	{ 50, 26, 127,  110, 29 },
+	{ 204, 228, 127,  82, 225 },
+	{ 204, 228, 127,  109, 226 },
+	{ 204, 228, 127,  81, 231 },
+	{ 127, 127, 0,  0, 0 },
+	{ 127, 127, 0,  18, 24 },
+	{ 127, 127, 0,  0, 253 },
+	{ 127, 127, 0,  0, 255 },
+	{ 127, 127, 0,  18, 232 },
+	{ 127, 127, 0,  236, 232 },
+	{ 127, 127, 0,  254, 0 },
+	{ 127, 127, 0,  235, 22 },
+	{ 127, 127, 0,  0, 0 },
+	{ 127, 86, 248,  17, 22 },
+	{ 127, 86, 248,  235, 22 },
+	{ 127, 86, 248,  254, 0 },
+	{ 0, 127, 127,  122, 25 },
+	{ 0, 127, 127,  122, 229 },
+	{ 0, 127, 127,  132, 25 },
+	{ 76, 127, 244,  236, 23 },
+	{ 76, 127, 244,  236, 230 },
+	{ 76, 127, 244,  254, 254 },
+	{ 255, 127, 127,  122, 25 },
+	{ 255, 127, 127,  122, 229 },
+	{ 255, 127, 127,  132, 229 },
+	{ 127, 255, 127,  122, 25 },
+	{ 127, 255, 127,  122, 229 },
+	{ 127, 255, 127,  132, 229 },
+	{ 28, 207, 127,  18, 231 },
+	{ 28, 207, 127,  0, 253 },
+	{ 28, 207, 127,  18, 231 },
+	{ 177, 127, 244,  18, 231 },
+	{ 177, 127, 244,  18, 24 },
+	{ 177, 127, 244,  0, 253 },
+	{ 230, 203, 127,  17, 22 },
+	{ 230, 203, 127,  0, 0 },
+	{ 230, 203, 127,  17, 22 },
+	{ 127, 168, 248,  236, 232 },
+	{ 127, 168, 248,  18, 232 },
+	{ 127, 168, 248,  253, 255 },
+	{ 226, 47, 127,  236, 23 },
+	{ 226, 47, 127,  255, 1 },
+	{ 226, 47, 127,  236, 23 },
+	{ 127, 0, 127,  122, 25 },
+	{ 127, 0, 127,  122, 229 },
+	{ 127, 0, 127,  132, 25 },
+	{ 226, 46, 127,  18, 232 },
+	{ 226, 46, 127,  18, 232 },
+	{ 226, 46, 127,  0, 255 },
+	{ 24, 51, 127,  236, 232 },
+	{ 24, 51, 127,  253, 255 },
+	{ 24, 51, 127,  236, 232 },
+	{ 28, 208, 127,  235, 22 },
+	{ 28, 208, 127,  235, 22 },
+	{ 28, 208, 127,  254, 0 },
+	{ 25, 51, 127,  18, 24 },
+	{ 25, 51, 127,  18, 24 },
+	{ 25, 51, 127,  0, 0 },
+	{ 229, 203, 127,  236, 230 },
+	{ 229, 203, 127,  236, 230 },
+	{ 229, 203, 127,  254, 254 },
+	{ 127, 127, 0,  18, 22 },
+	{ 127, 127, 0,  47, 22 },
+	{ 127, 127, 0,  47, 231 },
+	{ 127, 127, 0,  49, 22 },
+	{ 127, 127, 0,  79, 22 },
+	{ 127, 127, 0,  79, 231 },
+	{ 127, 127, 0,  81, 22 },
+	{ 127, 127, 0,  110, 22 },
+	{ 127, 127, 0,  110, 231 },
+	{ 127, 127, 0,  112, 22 },
+	{ 127, 127, 0,  141, 22 },
+	{ 127, 127, 0,  112, 231 },
+	{ 127, 127, 0,  143, 22 },
+	{ 127, 127, 0,  173, 22 },
+	{ 127, 127, 0,  143, 231 },
+	{ 127, 127, 0,  175, 22 },
+	{ 127, 127, 0,  204, 22 },
+	{ 127, 127, 0,  204, 231 },
+	{ 127, 127, 0,  206, 22 },
+	{ 127, 127, 0,  235, 22 },
+	{ 127, 127, 0,  235, 231 },
+	{ 127, 127, 255,  18, 22 },
+	{ 127, 127, 255,  18, 231 },
+	{ 127, 127, 255,  47, 22 },
+	{ 127, 127, 255,  49, 22 },
+	{ 127, 127, 255,  49, 231 },
+	{ 127, 127, 255,  79, 22 },
+	{ 127, 127, 255,  81, 22 },
+	{ 127, 127, 255,  81, 231 },
+	{ 127, 127, 255,  110, 22 },
+	{ 127, 127, 255,  112, 22 },
+	{ 127, 127, 255,  112, 231 },
+	{ 127, 127, 255,  141, 22 },
+	{ 127, 127, 255,  143, 22 },
+	{ 127, 127, 255,  143, 231 },
+	{ 127, 127, 255,  173, 231 },
+	{ 127, 127, 255,  175, 22 },
+	{ 127, 127, 255,  175, 231 },
+	{ 127, 127, 255,  204, 22 },
+	{ 127, 127, 255,  206, 22 },
+	{ 127, 127, 255,  206, 231 },
+	{ 127, 127, 255,  235, 22 },
+	{ 127, 255, 127,  235, 231 },
+	{ 127, 255, 127,  235, 231 },
+	{ 127, 255, 127,  206, 231 },
+	{ 127, 0, 127,  175, 22 },
+	{ 127, 0, 127,  175, 22 },
+	{ 127, 0, 127,  204, 22 },
+	{ 255, 127, 127,  112, 231 },
+	{ 255, 127, 127,  112, 231 },
+	{ 255, 127, 127,  112, 22 },
+	{ 0, 127, 127,  110, 22 },
+	{ 0, 127, 127,  110, 22 },
+	{ 0, 127, 127,  110, 231 },
+	{ 127, 255, 127,  79, 231 },
+	{ 127, 255, 127,  79, 231 },
+	{ 127, 255, 127,  49, 231 },
+	{ 127, 0, 127,  18, 22 },
+	{ 127, 0, 127,  18, 22 },
+	{ 127, 0, 127,  47, 22 },
+	{ 0, 127, 127,  235, 22 },
+	{ 0, 127, 127,  235, 22 },
+	{ 0, 127, 127,  235, 231 },
+	{ 127, 255, 127,  204, 231 },
+	{ 127, 255, 127,  204, 231 },
+	{ 127, 255, 127,  175, 231 },
+	{ 127, 0, 127,  143, 22 },
+	{ 127, 0, 127,  143, 22 },
+	{ 127, 0, 127,  173, 22 },
+	{ 255, 127, 127,  81, 231 },
+	{ 255, 127, 127,  81, 231 },
+	{ 255, 127, 127,  81, 22 },
+	{ 0, 127, 127,  79, 22 },
+	{ 0, 127, 127,  79, 22 },
+	{ 0, 127, 127,  79, 231 },
+	{ 127, 255, 127,  47, 231 },
+	{ 127, 255, 127,  47, 231 },
+	{ 127, 255, 127,  18, 231 },
+	{ 255, 127, 127,  206, 231 },
+	{ 255, 127, 127,  206, 231 },
+	{ 255, 127, 127,  206, 22 },
+	{ 0, 127, 127,  204, 22 },
+	{ 0, 127, 127,  204, 22 },
+	{ 0, 127, 127,  204, 231 },
+	{ 127, 255, 127,  173, 231 },
+	{ 127, 255, 127,  173, 231 },
+	{ 127, 255, 127,  143, 231 },
+	{ 127, 0, 127,  112, 22 },
+	{ 127, 0, 127,  112, 22 },
+	{ 127, 0, 127,  141, 22 },
+	{ 255, 127, 127,  49, 231 },
+	{ 255, 127, 127,  49, 231 },
+	{ 255, 127, 127,  49, 22 },
+	{ 0, 127, 127,  47, 22 },
+	{ 0, 127, 127,  47, 22 },
+	{ 0, 127, 127,  47, 231 },
+	{ 255, 127, 127,  175, 231 },
+	{ 255, 127, 127,  175, 231 },
+	{ 255, 127, 127,  175, 22 },
+	{ 0, 127, 127,  173, 22 },
+	{ 0, 127, 127,  173, 22 },
+	{ 0, 127, 127,  173, 231 },
+	{ 127, 255, 127,  141, 231 },
+	{ 127, 255, 127,  141, 231 },
+	{ 127, 255, 127,  112, 231 },
+	{ 127, 0, 127,  81, 22 },
+	{ 127, 0, 127,  81, 22 },
+	{ 127, 0, 127,  110, 22 },
+	{ 255, 127, 127,  18, 231 },
+	{ 255, 127, 127,  18, 231 },
+	{ 255, 127, 127,  18, 22 },
+	{ 127, 0, 127,  206, 22 },
+	{ 127, 0, 127,  206, 22 },
+	{ 127, 0, 127,  235, 22 },
+	{ 255, 127, 127,  143, 231 },
+	{ 255, 127, 127,  143, 231 },
+	{ 255, 127, 127,  143, 22 },
+	{ 0, 127, 127,  141, 22 },
+	{ 0, 127, 127,  141, 22 },
+	{ 0, 127, 127,  141, 231 },
+	{ 127, 255, 127,  110, 231 },
+	{ 127, 255, 127,  110, 231 },
+	{ 127, 255, 127,  81, 231 },
+	{ 127, 0, 127,  49, 22 },
+	{ 127, 0, 127,  49, 22 },
+	{ 127, 0, 127,  79, 22 },
+	{ 127, 127, 0,  254, 254 },
+	{ 127, 127, 0,  236, 230 },
+	{ 127, 127, 0,  255, 1 },
+	{ 136, 135, 0,  81, 22 },
+	{ 136, 135, 0,  110, 22 },
+	{ 136, 135, 0,  81, 231 },
+	{ 118, 119, 254,  81, 22 },
+	{ 118, 119, 254,  81, 231 },
+	{ 118, 119, 254,  110, 231 },
+	{ 38, 36, 115,  131, 27 },
+	{ 38, 36, 115,  123, 27 },
+	{ 38, 36, 115,  123, 227 },
+	{ 216, 218, 139,  131, 27 },
+	{ 216, 218, 139,  123, 27 },
+	{ 216, 218, 139,  123, 227 },
+	{ 204, 26, 127,  80, 29 },
+	{ 204, 26, 127,  81, 22 },
+	{ 204, 26, 127,  110, 22 },
+	{ 50, 228, 127,  109, 226 },
+	{ 50, 228, 127,  110, 231 },
+	{ 50, 228, 127,  82, 225 },
+	{ 127, 127, 0,  18, 24 },
+	{ 127, 127, 0,  18, 231 },
+	{ 127, 127, 0,  0, 253 },
+	{ 127, 127, 0,  253, 255 },
+	{ 127, 127, 0,  0, 255 },
+	{ 127, 127, 0,  236, 232 },
+	{ 127, 127, 0,  235, 22 },
+	{ 127, 127, 0,  17, 22 },
+	{ 127, 127, 0,  0, 0 },
+	{ 127, 86, 248,  0, 0 },
+	{ 127, 86, 248,  17, 22 },
+	{ 127, 86, 248,  254, 0 },
+	{ 0, 127, 127,  122, 229 },
+	{ 0, 127, 127,  132, 229 },
+	{ 0, 127, 127,  132, 25 },
+	{ 77, 127, 244,  255, 1 },
+	{ 77, 127, 244,  236, 23 },
+	{ 77, 127, 244,  254, 254 },
+	{ 255, 127, 127,  132, 25 },
+	{ 255, 127, 127,  122, 25 },
+	{ 255, 127, 127,  132, 229 },
+	{ 127, 255, 127,  132, 25 },
+	{ 127, 255, 127,  122, 25 },
+	{ 127, 255, 127,  132, 229 },
+	{ 178, 127, 244,  18, 24 },
+	{ 178, 127, 244,  0, 0 },
+	{ 178, 127, 244,  0, 253 },
+	{ 127, 168, 248,  18, 232 },
+	{ 127, 168, 248,  0, 255 },
+	{ 127, 168, 248,  253, 255 },
+	{ 127, 0, 127,  122, 229 },
+	{ 127, 0, 127,  132, 229 },
+	{ 127, 0, 127,  132, 25 },
+	{ 127, 127, 0,  18, 231 },
+	{ 127, 127, 0,  18, 22 },
+	{ 127, 127, 0,  47, 231 },
+	{ 127, 127, 0,  49, 231 },
+	{ 127, 127, 0,  49, 22 },
+	{ 127, 127, 0,  79, 231 },
+	{ 127, 127, 0,  81, 231 },
+	{ 127, 127, 0,  81, 22 },
+	{ 127, 127, 0,  110, 231 },
+	{ 127, 127, 0,  141, 22 },
+	{ 127, 127, 0,  141, 231 },
+	{ 127, 127, 0,  112, 231 },
+	{ 127, 127, 0,  173, 22 },
+	{ 127, 127, 0,  173, 231 },
+	{ 127, 127, 0,  143, 231 },
+	{ 127, 127, 0,  175, 231 },
+	{ 127, 127, 0,  175, 22 },
+	{ 127, 127, 0,  204, 231 },
+	{ 127, 127, 0,  206, 231 },
+	{ 127, 127, 0,  206, 22 },
+	{ 127, 127, 0,  235, 231 },
+	{ 127, 127, 255,  18, 231 },
+	{ 127, 127, 255,  47, 231 },
+	{ 127, 127, 255,  47, 22 },
+	{ 127, 127, 255,  49, 231 },
+	{ 127, 127, 255,  79, 231 },
+	{ 127, 127, 255,  79, 22 },
+	{ 127, 127, 255,  81, 231 },
+	{ 127, 127, 255,  110, 231 },
+	{ 127, 127, 255,  110, 22 },
+	{ 127, 127, 255,  112, 231 },
+	{ 127, 127, 255,  141, 231 },
+	{ 127, 127, 255,  141, 22 },
+	{ 127, 127, 255,  173, 22 },
+	{ 127, 127, 255,  143, 22 },
+	{ 127, 127, 255,  173, 231 },
+	{ 127, 127, 255,  175, 231 },
+	{ 127, 127, 255,  204, 231 },
+	{ 127, 127, 255,  204, 22 },
+	{ 127, 127, 255,  206, 231 },
+	{ 127, 127, 255,  235, 231 },
+	{ 127, 127, 255,  235, 22 },
+	{ 127, 255, 127,  235, 231 },
+	{ 127, 255, 127,  206, 231 },
+	{ 127, 255, 127,  206, 231 },
+	{ 127, 0, 127,  204, 22 },
+	{ 127, 0, 127,  175, 22 },
+	{ 127, 0, 127,  204, 22 },
+	{ 255, 127, 127,  112, 22 },
+	{ 255, 127, 127,  112, 231 },
+	{ 255, 127, 127,  112, 22 },
+	{ 0, 127, 127,  110, 22 },
+	{ 0, 127, 127,  110, 231 },
+	{ 0, 127, 127,  110, 231 },
+	{ 127, 255, 127,  79, 231 },
+	{ 127, 255, 127,  49, 231 },
+	{ 127, 255, 127,  49, 231 },
+	{ 127, 0, 127,  47, 22 },
+	{ 127, 0, 127,  18, 22 },
+	{ 127, 0, 127,  47, 22 },
+	{ 0, 127, 127,  235, 22 },
+	{ 0, 127, 127,  235, 231 },
+	{ 0, 127, 127,  235, 231 },
+	{ 127, 255, 127,  204, 231 },
+	{ 127, 255, 127,  175, 231 },
+	{ 127, 255, 127,  175, 231 },
+	{ 127, 0, 127,  173, 22 },
+	{ 127, 0, 127,  143, 22 },
+	{ 127, 0, 127,  173, 22 },
+	{ 255, 127, 127,  81, 22 },
+	{ 255, 127, 127,  81, 231 },
+	{ 255, 127, 127,  81, 22 },
+	{ 0, 127, 127,  79, 22 },
+	{ 0, 127, 127,  79, 231 },
+	{ 0, 127, 127,  79, 231 },
+	{ 127, 255, 127,  47, 231 },
+	{ 127, 255, 127,  18, 231 },
+	{ 127, 255, 127,  18, 231 },
+	{ 255, 127, 127,  206, 22 },
+	{ 255, 127, 127,  206, 231 },
+	{ 255, 127, 127,  206, 22 },
+	{ 0, 127, 127,  204, 22 },
+	{ 0, 127, 127,  204, 231 },
+	{ 0, 127, 127,  204, 231 },
+	{ 127, 255, 127,  173, 231 },
+	{ 127, 255, 127,  143, 231 },
+	{ 127, 255, 127,  143, 231 },
+	{ 127, 0, 127,  141, 22 },
+	{ 127, 0, 127,  112, 22 },
+	{ 127, 0, 127,  141, 22 },
+	{ 255, 127, 127,  49, 22 },
+	{ 255, 127, 127,  49, 231 },
+	{ 255, 127, 127,  49, 22 },
+	{ 0, 127, 127,  47, 22 },
+	{ 0, 127, 127,  47, 231 },
+	{ 0, 127, 127,  47, 231 },
+	{ 255, 127, 127,  175, 22 },
+	{ 255, 127, 127,  175, 231 },
+	{ 255, 127, 127,  175, 22 },
+	{ 0, 127, 127,  173, 22 },
+	{ 0, 127, 127,  173, 231 },
+	{ 0, 127, 127,  173, 231 },
+	{ 127, 255, 127,  141, 231 },
+	{ 127, 255, 127,  112, 231 },
+	{ 127, 255, 127,  112, 231 },
+	{ 127, 0, 127,  110, 22 },
+	{ 127, 0, 127,  81, 22 },
+	{ 127, 0, 127,  110, 22 },
+	{ 255, 127, 127,  18, 22 },
+	{ 255, 127, 127,  18, 231 },
+	{ 255, 127, 127,  18, 22 },
+	{ 127, 0, 127,  235, 22 },
+	{ 127, 0, 127,  206, 22 },
+	{ 127, 0, 127,  235, 22 },
+	{ 255, 127, 127,  143, 22 },
+	{ 255, 127, 127,  143, 231 },
+	{ 255, 127, 127,  143, 22 },
+	{ 0, 127, 127,  141, 22 },
+	{ 0, 127, 127,  141, 231 },
+	{ 0, 127, 127,  141, 231 },
+	{ 127, 255, 127,  110, 231 },
+	{ 127, 255, 127,  81, 231 },
+	{ 127, 255, 127,  81, 231 },
+	{ 127, 0, 127,  79, 22 },
+	{ 127, 0, 127,  49, 22 },
+	{ 127, 0, 127,  79, 22 },
+	{ 127, 127, 0,  236, 230 },
+	{ 127, 127, 0,  236, 23 },
+	{ 127, 127, 0,  255, 1 },
+	{ 136, 135, 0,  110, 22 },
+	{ 136, 135, 0,  110, 231 },
+	{ 136, 135, 0,  81, 231 },
+	{ 118, 119, 254,  110, 22 },
+	{ 118, 119, 254,  81, 22 },
+	{ 118, 119, 254,  110, 231 },
+	{ 38, 36, 115,  131, 227 },
+	{ 38, 36, 115,  131, 27 },
+	{ 38, 36, 115,  123, 227 },
+	{ 216, 218, 139,  131, 227 },
+	{ 216, 218, 139,  131, 27 },
+	{ 216, 218, 139,  123, 227 },
+	{ 204, 26, 127,  110, 29 },
+	{ 204, 26, 127,  80, 29 },
+	{ 204, 26, 127,  110, 22 },
+	{ 50, 228, 127,  110, 231 },
+	{ 50, 228, 127,  81, 231 },
+	{ 50, 228, 127,  82, 225 },
+	{ 127, 255, 127,  0, 0 },
+	{ 127, 255, 127,  18, 24 },
+	{ 127, 255, 127,  18, 231 },
+	{ 127, 255, 127,  0, 255 },
+	{ 127, 255, 127,  18, 232 },
+	{ 127, 255, 127,  236, 232 },
+	{ 127, 255, 127,  254, 0 },
+	{ 127, 255, 127,  235, 22 },
+	{ 127, 255, 127,  0, 0 },
+	{ 168, 6, 127,  17, 22 },
+	{ 168, 6, 127,  235, 22 },
+	{ 168, 6, 127,  0, 0 },
+	{ 127, 127, 0,  122, 25 },
+	{ 127, 127, 0,  122, 229 },
+	{ 127, 127, 0,  132, 25 },
+	{ 127, 10, 76,  236, 23 },
+	{ 127, 10, 76,  236, 230 },
+	{ 127, 10, 76,  254, 254 },
+	{ 127, 127, 255,  122, 25 },
+	{ 127, 127, 255,  122, 229 },
+	{ 127, 127, 255,  132, 229 },
+	{ 0, 127, 127,  122, 25 },
+	{ 0, 127, 127,  122, 229 },
+	{ 0, 127, 127,  132, 25 },
+	{ 47, 127, 28,  18, 231 },
+	{ 47, 127, 28,  0, 253 },
+	{ 47, 127, 28,  18, 231 },
+	{ 127, 10, 177,  18, 231 },
+	{ 127, 10, 177,  18, 24 },
+	{ 127, 10, 177,  0, 253 },
+	{ 51, 127, 230,  17, 22 },
+	{ 51, 127, 230,  0, 0 },
+	{ 51, 127, 230,  17, 22 },
+	{ 86, 6, 127,  236, 232 },
+	{ 86, 6, 127,  18, 232 },
+	{ 86, 6, 127,  0, 255 },
+	{ 207, 127, 226,  236, 23 },
+	{ 207, 127, 226,  255, 1 },
+	{ 207, 127, 226,  236, 23 },
+	{ 255, 127, 127,  122, 25 },
+	{ 255, 127, 127,  122, 229 },
+	{ 255, 127, 127,  132, 229 },
+	{ 208, 127, 226,  18, 232 },
+	{ 208, 127, 226,  18, 232 },
+	{ 208, 127, 226,  0, 255 },
+	{ 203, 127, 24,  236, 232 },
+	{ 203, 127, 24,  253, 255 },
+	{ 203, 127, 24,  236, 232 },
+	{ 46, 127, 28,  235, 22 },
+	{ 46, 127, 28,  235, 22 },
+	{ 46, 127, 28,  254, 0 },
+	{ 203, 127, 25,  18, 24 },
+	{ 203, 127, 25,  18, 24 },
+	{ 203, 127, 25,  0, 0 },
+	{ 51, 127, 229,  236, 230 },
+	{ 51, 127, 229,  236, 230 },
+	{ 51, 127, 229,  254, 254 },
+	{ 127, 255, 127,  18, 22 },
+	{ 127, 255, 127,  47, 22 },
+	{ 127, 255, 127,  18, 231 },
+	{ 127, 255, 127,  49, 22 },
+	{ 127, 255, 127,  79, 22 },
+	{ 127, 255, 127,  49, 231 },
+	{ 127, 255, 127,  81, 22 },
+	{ 127, 255, 127,  110, 22 },
+	{ 127, 255, 127,  81, 231 },
+	{ 127, 255, 127,  112, 22 },
+	{ 127, 255, 127,  141, 22 },
+	{ 127, 255, 127,  112, 231 },
+	{ 127, 255, 127,  143, 22 },
+	{ 127, 255, 127,  173, 22 },
+	{ 127, 255, 127,  143, 231 },
+	{ 127, 255, 127,  175, 22 },
+	{ 127, 255, 127,  204, 22 },
+	{ 127, 255, 127,  175, 231 },
+	{ 127, 255, 127,  206, 22 },
+	{ 127, 255, 127,  235, 22 },
+	{ 127, 255, 127,  206, 231 },
+	{ 127, 0, 127,  18, 22 },
+	{ 127, 0, 127,  18, 231 },
+	{ 127, 0, 127,  47, 231 },
+	{ 127, 0, 127,  49, 22 },
+	{ 127, 0, 127,  49, 231 },
+	{ 127, 0, 127,  79, 231 },
+	{ 127, 0, 127,  81, 22 },
+	{ 127, 0, 127,  81, 231 },
+	{ 127, 0, 127,  110, 231 },
+	{ 127, 0, 127,  112, 22 },
+	{ 127, 0, 127,  112, 231 },
+	{ 127, 0, 127,  141, 231 },
+	{ 127, 0, 127,  143, 22 },
+	{ 127, 0, 127,  143, 231 },
+	{ 127, 0, 127,  173, 231 },
+	{ 127, 0, 127,  175, 22 },
+	{ 127, 0, 127,  175, 231 },
+	{ 127, 0, 127,  204, 231 },
+	{ 127, 0, 127,  206, 22 },
+	{ 127, 0, 127,  206, 231 },
+	{ 127, 0, 127,  235, 231 },
+	{ 0, 127, 127,  235, 231 },
+	{ 0, 127, 127,  235, 231 },
+	{ 0, 127, 127,  206, 231 },
+	{ 255, 127, 127,  175, 22 },
+	{ 255, 127, 127,  175, 22 },
+	{ 255, 127, 127,  204, 22 },
+	{ 127, 127, 255,  112, 231 },
+	{ 127, 127, 255,  112, 231 },
+	{ 127, 127, 255,  112, 22 },
+	{ 127, 127, 0,  110, 22 },
+	{ 127, 127, 0,  110, 22 },
+	{ 127, 127, 0,  110, 231 },
+	{ 0, 127, 127,  79, 231 },
+	{ 0, 127, 127,  79, 231 },
+	{ 0, 127, 127,  49, 231 },
+	{ 255, 127, 127,  18, 22 },
+	{ 255, 127, 127,  18, 22 },
+	{ 255, 127, 127,  47, 22 },
+	{ 127, 127, 0,  235, 22 },
+	{ 127, 127, 0,  235, 22 },
+	{ 127, 127, 0,  235, 231 },
+	{ 0, 127, 127,  204, 231 },
+	{ 0, 127, 127,  204, 231 },
+	{ 0, 127, 127,  175, 231 },
+	{ 255, 127, 127,  143, 22 },
+	{ 255, 127, 127,  143, 22 },
+	{ 255, 127, 127,  173, 22 },
+	{ 127, 127, 255,  81, 231 },
+	{ 127, 127, 255,  81, 231 },
+	{ 127, 127, 255,  81, 22 },
+	{ 127, 127, 0,  79, 22 },
+	{ 127, 127, 0,  79, 22 },
+	{ 127, 127, 0,  79, 231 },
+	{ 0, 127, 127,  47, 231 },
+	{ 0, 127, 127,  47, 231 },
+	{ 0, 127, 127,  18, 231 },
+	{ 127, 127, 255,  206, 231 },
+	{ 127, 127, 255,  206, 231 },
+	{ 127, 127, 255,  206, 22 },
+	{ 127, 127, 0,  204, 22 },
+	{ 127, 127, 0,  204, 22 },
+	{ 127, 127, 0,  204, 231 },
+	{ 0, 127, 127,  173, 231 },
+	{ 0, 127, 127,  173, 231 },
+	{ 0, 127, 127,  143, 231 },
+	{ 255, 127, 127,  112, 22 },
+	{ 255, 127, 127,  112, 22 },
+	{ 255, 127, 127,  141, 22 },
+	{ 127, 127, 255,  49, 231 },
+	{ 127, 127, 255,  49, 231 },
+	{ 127, 127, 255,  49, 22 },
+	{ 127, 127, 0,  47, 22 },
+	{ 127, 127, 0,  47, 22 },
+	{ 127, 127, 0,  47, 231 },
+	{ 127, 127, 255,  175, 231 },
+	{ 127, 127, 255,  175, 231 },
+	{ 127, 127, 255,  175, 22 },
+	{ 127, 127, 0,  173, 22 },
+	{ 127, 127, 0,  173, 22 },
+	{ 127, 127, 0,  173, 231 },
+	{ 0, 127, 127,  141, 231 },
+	{ 0, 127, 127,  141, 231 },
+	{ 0, 127, 127,  112, 231 },
+	{ 255, 127, 127,  81, 22 },
+	{ 255, 127, 127,  81, 22 },
+	{ 255, 127, 127,  110, 22 },
+	{ 127, 127, 255,  18, 231 },
+	{ 127, 127, 255,  18, 231 },
+	{ 127, 127, 255,  18, 22 },
+	{ 255, 127, 127,  206, 22 },
+	{ 255, 127, 127,  206, 22 },
+	{ 255, 127, 127,  235, 22 },
+	{ 127, 127, 255,  143, 231 },
+	{ 127, 127, 255,  143, 231 },
+	{ 127, 127, 255,  143, 22 },
+	{ 127, 127, 0,  141, 22 },
+	{ 127, 127, 0,  141, 22 },
+	{ 127, 127, 0,  141, 231 },
+	{ 0, 127, 127,  110, 231 },
+	{ 0, 127, 127,  110, 231 },
+	{ 0, 127, 127,  81, 231 },
+	{ 255, 127, 127,  49, 22 },
+	{ 255, 127, 127,  49, 22 },
+	{ 255, 127, 127,  79, 22 },
+	{ 127, 255, 127,  254, 254 },
+	{ 127, 255, 127,  236, 230 },
+	{ 127, 255, 127,  255, 1 },
+	{ 119, 254, 136,  81, 22 },
+	{ 119, 254, 136,  110, 22 },
+	{ 119, 254, 136,  110, 231 },
+	{ 135, 0, 118,  81, 22 },
+	{ 135, 0, 118,  81, 231 },
+	{ 135, 0, 118,  110, 22 },
+	{ 218, 139, 38,  131, 27 },
+	{ 218, 139, 38,  123, 27 },
+	{ 218, 139, 38,  131, 227 },
+	{ 36, 115, 216,  131, 27 },
+	{ 36, 115, 216,  123, 27 },
+	{ 36, 115, 216,  131, 227 },
+	{ 228, 127, 204,  80, 29 },
+	{ 228, 127, 204,  81, 22 },
+	{ 228, 127, 204,  110, 22 },
+	{ 26, 127, 50,  109, 226 },
+	{ 26, 127, 50,  110, 231 },
+	{ 26, 127, 50,  82, 225 },
+	{ 127, 255, 127,  0, 253 },
+	{ 127, 255, 127,  0, 0 },
+	{ 127, 255, 127,  18, 231 },
+	{ 127, 255, 127,  253, 255 },
+	{ 127, 255, 127,  0, 255 },
+	{ 127, 255, 127,  236, 232 },
+	{ 127, 255, 127,  235, 22 },
+	{ 127, 255, 127,  17, 22 },
+	{ 127, 255, 127,  0, 0 },
+	{ 168, 6, 127,  235, 22 },
+	{ 168, 6, 127,  254, 0 },
+	{ 168, 6, 127,  0, 0 },
+	{ 127, 127, 0,  122, 229 },
+	{ 127, 127, 0,  132, 229 },
+	{ 127, 127, 0,  132, 25 },
+	{ 127, 10, 77,  255, 1 },
+	{ 127, 10, 77,  236, 23 },
+	{ 127, 10, 77,  254, 254 },
+	{ 127, 127, 255,  132, 25 },
+	{ 127, 127, 255,  122, 25 },
+	{ 127, 127, 255,  132, 229 },
+	{ 0, 127, 127,  122, 229 },
+	{ 0, 127, 127,  132, 229 },
+	{ 0, 127, 127,  132, 25 },
+	{ 127, 10, 178,  18, 24 },
+	{ 127, 10, 178,  0, 0 },
+	{ 127, 10, 178,  0, 253 },
+	{ 86, 6, 127,  253, 255 },
+	{ 86, 6, 127,  236, 232 },
+	{ 86, 6, 127,  0, 255 },
+	{ 255, 127, 127,  132, 25 },
+	{ 255, 127, 127,  122, 25 },
+	{ 255, 127, 127,  132, 229 },
+	{ 127, 255, 127,  47, 22 },
+	{ 127, 255, 127,  47, 231 },
+	{ 127, 255, 127,  18, 231 },
+	{ 127, 255, 127,  79, 22 },
+	{ 127, 255, 127,  79, 231 },
+	{ 127, 255, 127,  49, 231 },
+	{ 127, 255, 127,  110, 22 },
+	{ 127, 255, 127,  110, 231 },
+	{ 127, 255, 127,  81, 231 },
+	{ 127, 255, 127,  141, 22 },
+	{ 127, 255, 127,  141, 231 },
+	{ 127, 255, 127,  112, 231 },
+	{ 127, 255, 127,  173, 22 },
+	{ 127, 255, 127,  173, 231 },
+	{ 127, 255, 127,  143, 231 },
+	{ 127, 255, 127,  204, 22 },
+	{ 127, 255, 127,  204, 231 },
+	{ 127, 255, 127,  175, 231 },
+	{ 127, 255, 127,  235, 22 },
+	{ 127, 255, 127,  235, 231 },
+	{ 127, 255, 127,  206, 231 },
+	{ 127, 0, 127,  47, 22 },
+	{ 127, 0, 127,  18, 22 },
+	{ 127, 0, 127,  47, 231 },
+	{ 127, 0, 127,  79, 22 },
+	{ 127, 0, 127,  49, 22 },
+	{ 127, 0, 127,  79, 231 },
+	{ 127, 0, 127,  110, 22 },
+	{ 127, 0, 127,  81, 22 },
+	{ 127, 0, 127,  110, 231 },
+	{ 127, 0, 127,  141, 22 },
+	{ 127, 0, 127,  112, 22 },
+	{ 127, 0, 127,  141, 231 },
+	{ 127, 0, 127,  173, 22 },
+	{ 127, 0, 127,  143, 22 },
+	{ 127, 0, 127,  173, 231 },
+	{ 127, 0, 127,  204, 22 },
+	{ 127, 0, 127,  175, 22 },
+	{ 127, 0, 127,  204, 231 },
+	{ 127, 0, 127,  235, 22 },
+	{ 127, 0, 127,  206, 22 },
+	{ 127, 0, 127,  235, 231 },
+	{ 0, 127, 127,  235, 231 },
+	{ 0, 127, 127,  206, 231 },
+	{ 0, 127, 127,  206, 231 },
+	{ 255, 127, 127,  204, 22 },
+	{ 255, 127, 127,  175, 22 },
+	{ 255, 127, 127,  204, 22 },
+	{ 127, 127, 255,  112, 231 },
+	{ 127, 127, 255,  112, 22 },
+	{ 127, 127, 255,  112, 22 },
+	{ 127, 127, 0,  110, 231 },
+	{ 127, 127, 0,  110, 22 },
+	{ 127, 127, 0,  110, 231 },
+	{ 0, 127, 127,  79, 231 },
+	{ 0, 127, 127,  49, 231 },
+	{ 0, 127, 127,  49, 231 },
+	{ 255, 127, 127,  47, 22 },
+	{ 255, 127, 127,  18, 22 },
+	{ 255, 127, 127,  47, 22 },
+	{ 127, 127, 0,  235, 231 },
+	{ 127, 127, 0,  235, 22 },
+	{ 127, 127, 0,  235, 231 },
+	{ 0, 127, 127,  204, 231 },
+	{ 0, 127, 127,  175, 231 },
+	{ 0, 127, 127,  175, 231 },
+	{ 255, 127, 127,  143, 22 },
+	{ 255, 127, 127,  173, 22 },
+	{ 255, 127, 127,  173, 22 },
+	{ 127, 127, 255,  81, 231 },
+	{ 127, 127, 255,  81, 22 },
+	{ 127, 127, 255,  81, 22 },
+	{ 127, 127, 0,  79, 231 },
+	{ 127, 127, 0,  79, 22 },
+	{ 127, 127, 0,  79, 231 },
+	{ 0, 127, 127,  47, 231 },
+	{ 0, 127, 127,  18, 231 },
+	{ 0, 127, 127,  18, 231 },
+	{ 127, 127, 255,  206, 231 },
+	{ 127, 127, 255,  206, 22 },
+	{ 127, 127, 255,  206, 22 },
+	{ 127, 127, 0,  204, 231 },
+	{ 127, 127, 0,  204, 22 },
+	{ 127, 127, 0,  204, 231 },
+	{ 0, 127, 127,  173, 231 },
+	{ 0, 127, 127,  143, 231 },
+	{ 0, 127, 127,  143, 231 },
+	{ 255, 127, 127,  141, 22 },
+	{ 255, 127, 127,  112, 22 },
+	{ 255, 127, 127,  141, 22 },
+	{ 127, 127, 255,  49, 231 },
+	{ 127, 127, 255,  49, 22 },
+	{ 127, 127, 255,  49, 22 },
+	{ 127, 127, 0,  47, 231 },
+	{ 127, 127, 0,  47, 22 },
+	{ 127, 127, 0,  47, 231 },
+	{ 127, 127, 255,  175, 231 },
+	{ 127, 127, 255,  175, 22 },
+	{ 127, 127, 255,  175, 22 },
+	{ 127, 127, 0,  173, 231 },
+	{ 127, 127, 0,  173, 22 },
+	{ 127, 127, 0,  173, 231 },
+	{ 0, 127, 127,  141, 231 },
+	{ 0, 127, 127,  112, 231 },
+	{ 0, 127, 127,  112, 231 },
+	{ 255, 127, 127,  110, 22 },
+	{ 255, 127, 127,  81, 22 },
+	{ 255, 127, 127,  110, 22 },
+	{ 127, 127, 255,  18, 231 },
+	{ 127, 127, 255,  18, 22 },
+	{ 127, 127, 255,  18, 22 },
+	{ 255, 127, 127,  235, 22 },
+	{ 255, 127, 127,  206, 22 },
+	{ 255, 127, 127,  235, 22 },
+	{ 127, 127, 255,  143, 231 },
+	{ 127, 127, 255,  143, 22 },
+	{ 127, 127, 255,  143, 22 },
+	{ 127, 127, 0,  141, 231 },
+	{ 127, 127, 0,  141, 22 },
+	{ 127, 127, 0,  141, 231 },
+	{ 0, 127, 127,  110, 231 },
+	{ 0, 127, 127,  81, 231 },
+	{ 0, 127, 127,  81, 231 },
+	{ 255, 127, 127,  79, 22 },
+	{ 255, 127, 127,  49, 22 },
+	{ 255, 127, 127,  79, 22 },
+	{ 127, 255, 127,  236, 230 },
+	{ 127, 255, 127,  236, 23 },
+	{ 127, 255, 127,  255, 1 },
+	{ 119, 254, 136,  81, 231 },
+	{ 119, 254, 136,  81, 22 },
+	{ 119, 254, 136,  110, 231 },
+	{ 135, 0, 118,  81, 231 },
+	{ 135, 0, 118,  110, 231 },
+	{ 135, 0, 118,  110, 22 },
+	{ 218, 139, 38,  123, 27 },
+	{ 218, 139, 38,  123, 227 },
+	{ 218, 139, 38,  131, 227 },
+	{ 36, 115, 216,  123, 27 },
+	{ 36, 115, 216,  123, 227 },
+	{ 36, 115, 216,  131, 227 },
+	{ 228, 127, 204,  110, 29 },
+	{ 228, 127, 204,  80, 29 },
+	{ 228, 127, 204,  110, 22 },
+	{ 26, 127, 50,  110, 231 },
+	{ 26, 127, 50,  81, 231 },
+	{ 26, 127, 50,  82, 225 },
+	{ 0, 127, 127,  0, 0 },
+	{ 0, 127, 127,  18, 24 },
+	{ 0, 127, 127,  18, 231 },
+	{ 0, 127, 127,  0, 255 },
+	{ 0, 127, 127,  18, 232 },
+	{ 0, 127, 127,  236, 232 },
+	{ 0, 127, 127,  254, 0 },
+	{ 0, 127, 127,  235, 22 },
+	{ 0, 127, 127,  17, 22 },
+	{ 248, 168, 127,  17, 22 },
+	{ 248, 168, 127,  235, 22 },
+	{ 248, 168, 127,  0, 0 },
+	{ 127, 127, 0,  122, 25 },
+	{ 127, 127, 0,  122, 229 },
+	{ 127, 127, 0,  132, 229 },
+	{ 244, 127, 77,  236, 23 },
+	{ 244, 127, 77,  236, 230 },
+	{ 244, 127, 77,  255, 1 },
+	{ 127, 127, 255,  122, 25 },
+	{ 127, 127, 255,  122, 229 },
+	{ 127, 127, 255,  132, 229 },
+	{ 127, 0, 127,  122, 25 },
+	{ 127, 0, 127,  122, 229 },
+	{ 127, 0, 127,  132, 229 },
+	{ 127, 47, 28,  18, 231 },
+	{ 127, 47, 28,  0, 253 },
+	{ 127, 47, 28,  18, 231 },
+	{ 244, 127, 177,  18, 231 },
+	{ 244, 127, 177,  18, 24 },
+	{ 244, 127, 177,  0, 253 },
+	{ 127, 51, 230,  17, 22 },
+	{ 127, 51, 230,  0, 0 },
+	{ 127, 51, 230,  17, 22 },
+	{ 248, 86, 127,  236, 232 },
+	{ 248, 86, 127,  18, 232 },
+	{ 248, 86, 127,  253, 255 },
+	{ 127, 207, 226,  236, 23 },
+	{ 127, 207, 226,  255, 1 },
+	{ 127, 207, 226,  236, 23 },
+	{ 127, 255, 127,  122, 25 },
+	{ 127, 255, 127,  122, 229 },
+	{ 127, 255, 127,  132, 229 },
+	{ 127, 208, 226,  18, 232 },
+	{ 127, 208, 226,  18, 232 },
+	{ 127, 208, 226,  0, 255 },
+	{ 127, 203, 24,  236, 232 },
+	{ 127, 203, 24,  253, 255 },
+	{ 127, 203, 24,  236, 232 },
+	{ 127, 46, 28,  235, 22 },
+	{ 127, 46, 28,  235, 22 },
+	{ 127, 46, 28,  254, 0 },
+	{ 127, 203, 25,  18, 24 },
+	{ 127, 203, 25,  18, 24 },
+	{ 127, 203, 25,  0, 0 },
+	{ 127, 51, 229,  236, 230 },
+	{ 127, 51, 229,  236, 230 },
+	{ 127, 51, 229,  254, 254 },
+	{ 0, 127, 127,  18, 22 },
+	{ 0, 127, 127,  47, 22 },
+	{ 0, 127, 127,  18, 231 },
+	{ 0, 127, 127,  49, 22 },
+	{ 0, 127, 127,  79, 22 },
+	{ 0, 127, 127,  49, 231 },
+	{ 0, 127, 127,  81, 22 },
+	{ 0, 127, 127,  110, 22 },
+	{ 0, 127, 127,  81, 231 },
+	{ 0, 127, 127,  112, 22 },
+	{ 0, 127, 127,  141, 22 },
+	{ 0, 127, 127,  112, 231 },
+	{ 0, 127, 127,  143, 22 },
+	{ 0, 127, 127,  173, 22 },
+	{ 0, 127, 127,  143, 231 },
+	{ 0, 127, 127,  175, 22 },
+	{ 0, 127, 127,  204, 22 },
+	{ 0, 127, 127,  175, 231 },
+	{ 0, 127, 127,  206, 22 },
+	{ 0, 127, 127,  235, 22 },
+	{ 0, 127, 127,  206, 231 },
+	{ 255, 127, 127,  18, 22 },
+	{ 255, 127, 127,  18, 231 },
+	{ 255, 127, 127,  47, 231 },
+	{ 255, 127, 127,  49, 22 },
+	{ 255, 127, 127,  49, 231 },
+	{ 255, 127, 127,  79, 231 },
+	{ 255, 127, 127,  81, 22 },
+	{ 255, 127, 127,  81, 231 },
+	{ 255, 127, 127,  110, 231 },
+	{ 255, 127, 127,  112, 22 },
+	{ 255, 127, 127,  112, 231 },
+	{ 255, 127, 127,  141, 231 },
+	{ 255, 127, 127,  143, 22 },
+	{ 255, 127, 127,  143, 231 },
+	{ 255, 127, 127,  173, 231 },
+	{ 255, 127, 127,  175, 22 },
+	{ 255, 127, 127,  175, 231 },
+	{ 255, 127, 127,  204, 231 },
+	{ 255, 127, 127,  206, 22 },
+	{ 255, 127, 127,  206, 231 },
+	{ 255, 127, 127,  235, 231 },
+	{ 127, 0, 127,  235, 231 },
+	{ 127, 0, 127,  235, 231 },
+	{ 127, 0, 127,  206, 231 },
+	{ 127, 255, 127,  175, 22 },
+	{ 127, 255, 127,  175, 22 },
+	{ 127, 255, 127,  204, 22 },
+	{ 127, 127, 255,  112, 231 },
+	{ 127, 127, 255,  112, 231 },
+	{ 127, 127, 255,  112, 22 },
+	{ 127, 127, 0,  110, 22 },
+	{ 127, 127, 0,  110, 22 },
+	{ 127, 127, 0,  110, 231 },
+	{ 127, 0, 127,  79, 231 },
+	{ 127, 0, 127,  79, 231 },
+	{ 127, 0, 127,  49, 231 },
+	{ 127, 255, 127,  18, 22 },
+	{ 127, 255, 127,  18, 22 },
+	{ 127, 255, 127,  47, 22 },
+	{ 127, 127, 0,  235, 22 },
+	{ 127, 127, 0,  235, 22 },
+	{ 127, 127, 0,  235, 231 },
+	{ 127, 0, 127,  204, 231 },
+	{ 127, 0, 127,  204, 231 },
+	{ 127, 0, 127,  175, 231 },
+	{ 127, 255, 127,  143, 22 },
+	{ 127, 255, 127,  143, 22 },
+	{ 127, 255, 127,  173, 22 },
+	{ 127, 127, 255,  81, 231 },
+	{ 127, 127, 255,  81, 231 },
+	{ 127, 127, 255,  81, 22 },
+	{ 127, 127, 0,  79, 22 },
+	{ 127, 127, 0,  79, 22 },
+	{ 127, 127, 0,  79, 231 },
+	{ 127, 0, 127,  47, 231 },
+	{ 127, 0, 127,  47, 231 },
+	{ 127, 0, 127,  18, 231 },
+	{ 127, 127, 255,  206, 231 },
+	{ 127, 127, 255,  206, 231 },
+	{ 127, 127, 255,  206, 22 },
+	{ 127, 127, 0,  204, 22 },
+	{ 127, 127, 0,  204, 22 },
+	{ 127, 127, 0,  204, 231 },
+	{ 127, 0, 127,  173, 231 },
+	{ 127, 0, 127,  173, 231 },
+	{ 127, 0, 127,  143, 231 },
+	{ 127, 255, 127,  112, 22 },
+	{ 127, 255, 127,  112, 22 },
+	{ 127, 255, 127,  141, 22 },
+	{ 127, 127, 255,  49, 231 },
+	{ 127, 127, 255,  49, 231 },
+	{ 127, 127, 255,  49, 22 },
+	{ 127, 127, 0,  47, 22 },
+	{ 127, 127, 0,  47, 22 },
+	{ 127, 127, 0,  47, 231 },
+	{ 127, 127, 255,  175, 231 },
+	{ 127, 127, 255,  175, 231 },
+	{ 127, 127, 255,  175, 22 },
+	{ 127, 127, 0,  173, 22 },
+	{ 127, 127, 0,  173, 22 },
+	{ 127, 127, 0,  173, 231 },
+	{ 127, 0, 127,  141, 231 },
+	{ 127, 0, 127,  141, 231 },
+	{ 127, 0, 127,  112, 231 },
+	{ 127, 255, 127,  81, 22 },
+	{ 127, 255, 127,  81, 22 },
+	{ 127, 255, 127,  110, 22 },
+	{ 127, 127, 255,  18, 231 },
+	{ 127, 127, 255,  18, 231 },
+	{ 127, 127, 255,  18, 22 },
+	{ 127, 255, 127,  206, 22 },
+	{ 127, 255, 127,  206, 22 },
+	{ 127, 255, 127,  235, 22 },
+	{ 127, 127, 255,  143, 231 },
+	{ 127, 127, 255,  143, 231 },
+	{ 127, 127, 255,  143, 22 },
+	{ 127, 127, 0,  141, 22 },
+	{ 127, 127, 0,  141, 22 },
+	{ 127, 127, 0,  141, 231 },
+	{ 127, 0, 127,  110, 231 },
+	{ 127, 0, 127,  110, 231 },
+	{ 127, 0, 127,  81, 231 },
+	{ 127, 255, 127,  49, 22 },
+	{ 127, 255, 127,  49, 22 },
+	{ 127, 255, 127,  79, 22 },
+	{ 0, 127, 127,  254, 254 },
+	{ 0, 127, 127,  236, 230 },
+	{ 0, 127, 127,  236, 23 },
+	{ 0, 119, 136,  81, 22 },
+	{ 0, 119, 136,  110, 22 },
+	{ 0, 119, 136,  110, 231 },
+	{ 254, 135, 118,  81, 22 },
+	{ 254, 135, 118,  81, 231 },
+	{ 254, 135, 118,  110, 22 },
+	{ 115, 218, 38,  131, 27 },
+	{ 115, 218, 38,  123, 27 },
+	{ 115, 218, 38,  123, 227 },
+	{ 139, 36, 216,  131, 27 },
+	{ 139, 36, 216,  123, 27 },
+	{ 139, 36, 216,  123, 227 },
+	{ 127, 228, 204,  80, 29 },
+	{ 127, 228, 204,  81, 22 },
+	{ 127, 228, 204,  110, 22 },
+	{ 127, 26, 50,  109, 226 },
+	{ 127, 26, 50,  110, 231 },
+	{ 127, 26, 50,  82, 225 },
+	{ 0, 127, 127,  0, 253 },
+	{ 0, 127, 127,  0, 0 },
+	{ 0, 127, 127,  18, 231 },
+	{ 0, 127, 127,  253, 255 },
+	{ 0, 127, 127,  0, 255 },
+	{ 0, 127, 127,  236, 232 },
+	{ 0, 127, 127,  0, 0 },
+	{ 0, 127, 127,  254, 0 },
+	{ 0, 127, 127,  17, 22 },
+	{ 248, 168, 127,  235, 22 },
+	{ 248, 168, 127,  254, 0 },
+	{ 248, 168, 127,  0, 0 },
+	{ 127, 127, 0,  132, 25 },
+	{ 127, 127, 0,  122, 25 },
+	{ 127, 127, 0,  132, 229 },
+	{ 244, 127, 76,  236, 230 },
+	{ 244, 127, 76,  254, 254 },
+	{ 244, 127, 76,  255, 1 },
+	{ 127, 127, 255,  132, 25 },
+	{ 127, 127, 255,  122, 25 },
+	{ 127, 127, 255,  132, 229 },
+	{ 127, 0, 127,  132, 25 },
+	{ 127, 0, 127,  122, 25 },
+	{ 127, 0, 127,  132, 229 },
+	{ 244, 127, 178,  18, 24 },
+	{ 244, 127, 178,  0, 0 },
+	{ 244, 127, 178,  0, 253 },
+	{ 248, 86, 127,  18, 232 },
+	{ 248, 86, 127,  0, 255 },
+	{ 248, 86, 127,  253, 255 },
+	{ 127, 255, 127,  132, 25 },
+	{ 127, 255, 127,  122, 25 },
+	{ 127, 255, 127,  132, 229 },
+	{ 0, 127, 127,  47, 22 },
+	{ 0, 127, 127,  47, 231 },
+	{ 0, 127, 127,  18, 231 },
+	{ 0, 127, 127,  79, 22 },
+	{ 0, 127, 127,  79, 231 },
+	{ 0, 127, 127,  49, 231 },
+	{ 0, 127, 127,  110, 22 },
+	{ 0, 127, 127,  110, 231 },
+	{ 0, 127, 127,  81, 231 },
+	{ 0, 127, 127,  141, 22 },
+	{ 0, 127, 127,  141, 231 },
+	{ 0, 127, 127,  112, 231 },
+	{ 0, 127, 127,  173, 22 },
+	{ 0, 127, 127,  173, 231 },
+	{ 0, 127, 127,  143, 231 },
+	{ 0, 127, 127,  204, 22 },
+	{ 0, 127, 127,  204, 231 },
+	{ 0, 127, 127,  175, 231 },
+	{ 0, 127, 127,  235, 22 },
+	{ 0, 127, 127,  235, 231 },
+	{ 0, 127, 127,  206, 231 },
+	{ 255, 127, 127,  47, 22 },
+	{ 255, 127, 127,  18, 22 },
+	{ 255, 127, 127,  47, 231 },
+	{ 255, 127, 127,  79, 22 },
+	{ 255, 127, 127,  49, 22 },
+	{ 255, 127, 127,  79, 231 },
+	{ 255, 127, 127,  110, 22 },
+	{ 255, 127, 127,  81, 22 },
+	{ 255, 127, 127,  110, 231 },
+	{ 255, 127, 127,  141, 22 },
+	{ 255, 127, 127,  112, 22 },
+	{ 255, 127, 127,  141, 231 },
+	{ 255, 127, 127,  173, 22 },
+	{ 255, 127, 127,  143, 22 },
+	{ 255, 127, 127,  173, 231 },
+	{ 255, 127, 127,  204, 22 },
+	{ 255, 127, 127,  175, 22 },
+	{ 255, 127, 127,  204, 231 },
+	{ 255, 127, 127,  235, 22 },
+	{ 255, 127, 127,  206, 22 },
+	{ 255, 127, 127,  235, 231 },
+	{ 127, 0, 127,  235, 231 },
+	{ 127, 0, 127,  206, 231 },
+	{ 127, 0, 127,  206, 231 },
+	{ 127, 255, 127,  175, 22 },
+	{ 127, 255, 127,  204, 22 },
+	{ 127, 255, 127,  204, 22 },
+	{ 127, 127, 255,  112, 22 },
+	{ 127, 127, 255,  112, 231 },
+	{ 127, 127, 255,  112, 22 },
+	{ 127, 127, 0,  110, 22 },
+	{ 127, 127, 0,  110, 231 },
+	{ 127, 127, 0,  110, 231 },
+	{ 127, 0, 127,  79, 231 },
+	{ 127, 0, 127,  49, 231 },
+	{ 127, 0, 127,  49, 231 },
+	{ 127, 255, 127,  18, 22 },
+	{ 127, 255, 127,  47, 22 },
+	{ 127, 255, 127,  47, 22 },
+	{ 127, 127, 0,  235, 231 },
+	{ 127, 127, 0,  235, 22 },
+	{ 127, 127, 0,  235, 231 },
+	{ 127, 0, 127,  204, 231 },
+	{ 127, 0, 127,  175, 231 },
+	{ 127, 0, 127,  175, 231 },
+	{ 127, 255, 127,  173, 22 },
+	{ 127, 255, 127,  143, 22 },
+	{ 127, 255, 127,  173, 22 },
+	{ 127, 127, 255,  81, 22 },
+	{ 127, 127, 255,  81, 231 },
+	{ 127, 127, 255,  81, 22 },
+	{ 127, 127, 0,  79, 22 },
+	{ 127, 127, 0,  79, 231 },
+	{ 127, 127, 0,  79, 231 },
+	{ 127, 0, 127,  47, 231 },
+	{ 127, 0, 127,  18, 231 },
+	{ 127, 0, 127,  18, 231 },
+	{ 127, 127, 255,  206, 22 },
+	{ 127, 127, 255,  206, 231 },
+	{ 127, 127, 255,  206, 22 },
+	{ 127, 127, 0,  204, 231 },
+	{ 127, 127, 0,  204, 22 },
+	{ 127, 127, 0,  204, 231 },
+	{ 127, 0, 127,  173, 231 },
+	{ 127, 0, 127,  143, 231 },
+	{ 127, 0, 127,  143, 231 },
+	{ 127, 255, 127,  112, 22 },
+	{ 127, 255, 127,  141, 22 },
+	{ 127, 255, 127,  141, 22 },
+	{ 127, 127, 255,  49, 22 },
+	{ 127, 127, 255,  49, 231 },
+	{ 127, 127, 255,  49, 22 },
+	{ 127, 127, 0,  47, 231 },
+	{ 127, 127, 0,  47, 22 },
+	{ 127, 127, 0,  47, 231 },
+	{ 127, 127, 255,  175, 22 },
+	{ 127, 127, 255,  175, 231 },
+	{ 127, 127, 255,  175, 22 },
+	{ 127, 127, 0,  173, 231 },
+	{ 127, 127, 0,  173, 22 },
+	{ 127, 127, 0,  173, 231 },
+	{ 127, 0, 127,  141, 231 },
+	{ 127, 0, 127,  112, 231 },
+	{ 127, 0, 127,  112, 231 },
+	{ 127, 255, 127,  81, 22 },
+	{ 127, 255, 127,  110, 22 },
+	{ 127, 255, 127,  110, 22 },
+	{ 127, 127, 255,  18, 22 },
+	{ 127, 127, 255,  18, 231 },
+	{ 127, 127, 255,  18, 22 },
+	{ 127, 255, 127,  206, 22 },
+	{ 127, 255, 127,  235, 22 },
+	{ 127, 255, 127,  235, 22 },
+	{ 127, 127, 255,  143, 22 },
+	{ 127, 127, 255,  143, 231 },
+	{ 127, 127, 255,  143, 22 },
+	{ 127, 127, 0,  141, 231 },
+	{ 127, 127, 0,  141, 22 },
+	{ 127, 127, 0,  141, 231 },
+	{ 127, 0, 127,  110, 231 },
+	{ 127, 0, 127,  81, 231 },
+	{ 127, 0, 127,  81, 231 },
+	{ 127, 255, 127,  49, 22 },
+	{ 127, 255, 127,  79, 22 },
+	{ 127, 255, 127,  79, 22 },
+	{ 0, 127, 127,  255, 1 },
+	{ 0, 127, 127,  254, 254 },
+	{ 0, 127, 127,  236, 23 },
+	{ 0, 119, 136,  81, 231 },
+	{ 0, 119, 136,  81, 22 },
+	{ 0, 119, 136,  110, 231 },
+	{ 254, 135, 118,  81, 231 },
+	{ 254, 135, 118,  110, 231 },
+	{ 254, 135, 118,  110, 22 },
+	{ 115, 218, 38,  131, 227 },
+	{ 115, 218, 38,  131, 27 },
+	{ 115, 218, 38,  123, 227 },
+	{ 139, 36, 216,  131, 227 },
+	{ 139, 36, 216,  131, 27 },
+	{ 139, 36, 216,  123, 227 },
+	{ 127, 228, 204,  110, 29 },
+	{ 127, 228, 204,  80, 29 },
+	{ 127, 228, 204,  110, 22 },
+	{ 127, 26, 50,  110, 231 },
+	{ 127, 26, 50,  81, 231 },
+	{ 127, 26, 50,  82, 225 },
+	{ 127, 0, 127,  0, 0 },
+	{ 127, 0, 127,  18, 24 },
+	{ 127, 0, 127,  0, 253 },
+	{ 127, 0, 127,  0, 255 },
+	{ 127, 0, 127,  18, 232 },
+	{ 127, 0, 127,  253, 255 },
+	{ 127, 0, 127,  254, 0 },
+	{ 127, 0, 127,  235, 22 },
+	{ 127, 0, 127,  17, 22 },
+	{ 86, 248, 127,  17, 22 },
+	{ 86, 248, 127,  235, 22 },
+	{ 86, 248, 127,  254, 0 },
+	{ 127, 127, 0,  122, 25 },
+	{ 127, 127, 0,  122, 229 },
+	{ 127, 127, 0,  132, 229 },
+	{ 127, 244, 76,  236, 23 },
+	{ 127, 244, 76,  236, 230 },
+	{ 127, 244, 76,  254, 254 },
+	{ 127, 127, 255,  122, 25 },
+	{ 127, 127, 255,  122, 229 },
+	{ 127, 127, 255,  132, 25 },
+	{ 255, 127, 127,  122, 25 },
+	{ 255, 127, 127,  122, 229 },
+	{ 255, 127, 127,  132, 229 },
+	{ 207, 127, 28,  18, 231 },
+	{ 207, 127, 28,  0, 253 },
+	{ 207, 127, 28,  18, 231 },
+	{ 127, 244, 178,  18, 231 },
+	{ 127, 244, 178,  18, 24 },
+	{ 127, 244, 178,  0, 0 },
+	{ 203, 127, 230,  17, 22 },
+	{ 203, 127, 230,  0, 0 },
+	{ 203, 127, 230,  17, 22 },
+	{ 168, 248, 127,  236, 232 },
+	{ 168, 248, 127,  18, 232 },
+	{ 168, 248, 127,  253, 255 },
+	{ 47, 127, 226,  236, 23 },
+	{ 47, 127, 226,  255, 1 },
+	{ 47, 127, 226,  236, 23 },
+	{ 0, 127, 127,  122, 25 },
+	{ 0, 127, 127,  122, 229 },
+	{ 0, 127, 127,  132, 25 },
+	{ 46, 127, 226,  18, 232 },
+	{ 46, 127, 226,  18, 232 },
+	{ 46, 127, 226,  0, 255 },
+	{ 51, 127, 24,  236, 232 },
+	{ 51, 127, 24,  253, 255 },
+	{ 51, 127, 24,  236, 232 },
+	{ 208, 127, 28,  235, 22 },
+	{ 208, 127, 28,  235, 22 },
+	{ 208, 127, 28,  254, 0 },
+	{ 51, 127, 25,  18, 24 },
+	{ 51, 127, 25,  18, 24 },
+	{ 51, 127, 25,  0, 0 },
+	{ 203, 127, 229,  236, 230 },
+	{ 203, 127, 229,  236, 230 },
+	{ 203, 127, 229,  254, 254 },
+	{ 127, 0, 127,  18, 22 },
+	{ 127, 0, 127,  47, 22 },
+	{ 127, 0, 127,  47, 231 },
+	{ 127, 0, 127,  49, 22 },
+	{ 127, 0, 127,  79, 22 },
+	{ 127, 0, 127,  79, 231 },
+	{ 127, 0, 127,  81, 22 },
+	{ 127, 0, 127,  110, 22 },
+	{ 127, 0, 127,  110, 231 },
+	{ 127, 0, 127,  112, 22 },
+	{ 127, 0, 127,  141, 22 },
+	{ 127, 0, 127,  141, 231 },
+	{ 127, 0, 127,  143, 22 },
+	{ 127, 0, 127,  173, 22 },
+	{ 127, 0, 127,  173, 231 },
+	{ 127, 0, 127,  175, 22 },
+	{ 127, 0, 127,  204, 22 },
+	{ 127, 0, 127,  204, 231 },
+	{ 127, 0, 127,  206, 22 },
+	{ 127, 0, 127,  235, 22 },
+	{ 127, 0, 127,  235, 231 },
+	{ 127, 255, 127,  18, 22 },
+	{ 127, 255, 127,  18, 231 },
+	{ 127, 255, 127,  47, 22 },
+	{ 127, 255, 127,  49, 22 },
+	{ 127, 255, 127,  49, 231 },
+	{ 127, 255, 127,  79, 22 },
+	{ 127, 255, 127,  81, 22 },
+	{ 127, 255, 127,  81, 231 },
+	{ 127, 255, 127,  110, 22 },
+	{ 127, 255, 127,  112, 22 },
+	{ 127, 255, 127,  112, 231 },
+	{ 127, 255, 127,  141, 22 },
+	{ 127, 255, 127,  143, 22 },
+	{ 127, 255, 127,  143, 231 },
+	{ 127, 255, 127,  173, 22 },
+	{ 127, 255, 127,  175, 22 },
+	{ 127, 255, 127,  175, 231 },
+	{ 127, 255, 127,  204, 22 },
+	{ 127, 255, 127,  206, 22 },
+	{ 127, 255, 127,  206, 231 },
+	{ 127, 255, 127,  235, 22 },
+	{ 255, 127, 127,  235, 231 },
+	{ 255, 127, 127,  235, 231 },
+	{ 255, 127, 127,  206, 231 },
+	{ 0, 127, 127,  175, 22 },
+	{ 0, 127, 127,  175, 22 },
+	{ 0, 127, 127,  204, 22 },
+	{ 127, 127, 255,  112, 231 },
+	{ 127, 127, 255,  112, 231 },
+	{ 127, 127, 255,  112, 22 },
+	{ 127, 127, 0,  110, 22 },
+	{ 127, 127, 0,  110, 22 },
+	{ 127, 127, 0,  110, 231 },
+	{ 255, 127, 127,  79, 231 },
+	{ 255, 127, 127,  79, 231 },
+	{ 255, 127, 127,  49, 231 },
+	{ 0, 127, 127,  18, 22 },
+	{ 0, 127, 127,  18, 22 },
+	{ 0, 127, 127,  47, 22 },
+	{ 127, 127, 0,  235, 22 },
+	{ 127, 127, 0,  235, 22 },
+	{ 127, 127, 0,  235, 231 },
+	{ 255, 127, 127,  204, 231 },
+	{ 255, 127, 127,  204, 231 },
+	{ 255, 127, 127,  175, 231 },
+	{ 0, 127, 127,  143, 22 },
+	{ 0, 127, 127,  143, 22 },
+	{ 0, 127, 127,  173, 22 },
+	{ 127, 127, 255,  81, 231 },
+	{ 127, 127, 255,  81, 231 },
+	{ 127, 127, 255,  81, 22 },
+	{ 127, 127, 0,  79, 22 },
+	{ 127, 127, 0,  79, 22 },
+	{ 127, 127, 0,  79, 231 },
+	{ 255, 127, 127,  47, 231 },
+	{ 255, 127, 127,  47, 231 },
+	{ 255, 127, 127,  18, 231 },
+	{ 127, 127, 255,  206, 231 },
+	{ 127, 127, 255,  206, 231 },
+	{ 127, 127, 255,  206, 22 },
+	{ 127, 127, 0,  204, 22 },
+	{ 127, 127, 0,  204, 22 },
+	{ 127, 127, 0,  204, 231 },
+	{ 255, 127, 127,  173, 231 },
+	{ 255, 127, 127,  173, 231 },
+	{ 255, 127, 127,  143, 231 },
+	{ 0, 127, 127,  112, 22 },
+	{ 0, 127, 127,  112, 22 },
+	{ 0, 127, 127,  141, 22 },
+	{ 127, 127, 255,  49, 231 },
+	{ 127, 127, 255,  49, 231 },
+	{ 127, 127, 255,  49, 22 },
+	{ 127, 127, 0,  47, 22 },
+	{ 127, 127, 0,  47, 22 },
+	{ 127, 127, 0,  47, 231 },
+	{ 127, 127, 255,  175, 231 },
+	{ 127, 127, 255,  175, 231 },
+	{ 127, 127, 255,  175, 22 },
+	{ 127, 127, 0,  173, 22 },
+	{ 127, 127, 0,  173, 22 },
+	{ 127, 127, 0,  173, 231 },
+	{ 255, 127, 127,  141, 231 },
+	{ 255, 127, 127,  141, 231 },
+	{ 255, 127, 127,  112, 231 },
+	{ 0, 127, 127,  81, 22 },
+	{ 0, 127, 127,  81, 22 },
+	{ 0, 127, 127,  110, 22 },
+	{ 127, 127, 255,  18, 231 },
+	{ 127, 127, 255,  18, 231 },
+	{ 127, 127, 255,  18, 22 },
+	{ 0, 127, 127,  206, 22 },
+	{ 0, 127, 127,  206, 22 },
+	{ 0, 127, 127,  235, 22 },
+	{ 127, 127, 255,  143, 231 },
+	{ 127, 127, 255,  143, 231 },
+	{ 127, 127, 255,  143, 22 },
+	{ 127, 127, 0,  141, 22 },
+	{ 127, 127, 0,  141, 22 },
+	{ 127, 127, 0,  141, 231 },
+	{ 255, 127, 127,  110, 231 },
+	{ 255, 127, 127,  110, 231 },
+	{ 255, 127, 127,  81, 231 },
+	{ 0, 127, 127,  49, 22 },
+	{ 0, 127, 127,  49, 22 },
+	{ 0, 127, 127,  79, 22 },
+	{ 127, 0, 127,  254, 254 },
+	{ 127, 0, 127,  236, 230 },
+	{ 127, 0, 127,  255, 1 },
+	{ 135, 0, 136,  81, 22 },
+	{ 135, 0, 136,  110, 22 },
+	{ 135, 0, 136,  81, 231 },
+	{ 119, 254, 118,  81, 22 },
+	{ 119, 254, 118,  81, 231 },
+	{ 119, 254, 118,  110, 231 },
+	{ 36, 115, 38,  131, 27 },
+	{ 36, 115, 38,  123, 27 },
+	{ 36, 115, 38,  123, 227 },
+	{ 218, 139, 216,  131, 27 },
+	{ 218, 139, 216,  123, 27 },
+	{ 218, 139, 216,  123, 227 },
+	{ 26, 127, 204,  80, 29 },
+	{ 26, 127, 204,  81, 22 },
+	{ 26, 127, 204,  110, 29 },
+	{ 228, 127, 50,  109, 226 },
+	{ 228, 127, 50,  110, 231 },
+	{ 228, 127, 50,  81, 231 },
+	{ 127, 0, 127,  18, 24 },
+	{ 127, 0, 127,  18, 231 },
+	{ 127, 0, 127,  0, 253 },
+	{ 127, 0, 127,  18, 232 },
+	{ 127, 0, 127,  236, 232 },
+	{ 127, 0, 127,  253, 255 },
+	{ 127, 0, 127,  0, 0 },
+	{ 127, 0, 127,  254, 0 },
+	{ 127, 0, 127,  17, 22 },
+	{ 86, 248, 127,  0, 0 },
+	{ 86, 248, 127,  17, 22 },
+	{ 86, 248, 127,  254, 0 },
+	{ 127, 127, 0,  132, 25 },
+	{ 127, 127, 0,  122, 25 },
+	{ 127, 127, 0,  132, 229 },
+	{ 127, 244, 77,  255, 1 },
+	{ 127, 244, 77,  236, 23 },
+	{ 127, 244, 77,  254, 254 },
+	{ 127, 127, 255,  122, 229 },
+	{ 127, 127, 255,  132, 229 },
+	{ 127, 127, 255,  132, 25 },
+	{ 255, 127, 127,  132, 25 },
+	{ 255, 127, 127,  122, 25 },
+	{ 255, 127, 127,  132, 229 },
+	{ 127, 244, 177,  0, 253 },
+	{ 127, 244, 177,  18, 231 },
+	{ 127, 244, 177,  0, 0 },
+	{ 168, 248, 127,  18, 232 },
+	{ 168, 248, 127,  0, 255 },
+	{ 168, 248, 127,  253, 255 },
+	{ 0, 127, 127,  122, 229 },
+	{ 0, 127, 127,  132, 229 },
+	{ 0, 127, 127,  132, 25 },
+	{ 127, 0, 127,  18, 231 },
+	{ 127, 0, 127,  18, 22 },
+	{ 127, 0, 127,  47, 231 },
+	{ 127, 0, 127,  49, 231 },
+	{ 127, 0, 127,  49, 22 },
+	{ 127, 0, 127,  79, 231 },
+	{ 127, 0, 127,  81, 231 },
+	{ 127, 0, 127,  81, 22 },
+	{ 127, 0, 127,  110, 231 },
+	{ 127, 0, 127,  112, 231 },
+	{ 127, 0, 127,  112, 22 },
+	{ 127, 0, 127,  141, 231 },
+	{ 127, 0, 127,  143, 231 },
+	{ 127, 0, 127,  143, 22 },
+	{ 127, 0, 127,  173, 231 },
+	{ 127, 0, 127,  175, 231 },
+	{ 127, 0, 127,  175, 22 },
+	{ 127, 0, 127,  204, 231 },
+	{ 127, 0, 127,  206, 231 },
+	{ 127, 0, 127,  206, 22 },
+	{ 127, 0, 127,  235, 231 },
+	{ 127, 255, 127,  18, 231 },
+	{ 127, 255, 127,  47, 231 },
+	{ 127, 255, 127,  47, 22 },
+	{ 127, 255, 127,  49, 231 },
+	{ 127, 255, 127,  79, 231 },
+	{ 127, 255, 127,  79, 22 },
+	{ 127, 255, 127,  81, 231 },
+	{ 127, 255, 127,  110, 231 },
+	{ 127, 255, 127,  110, 22 },
+	{ 127, 255, 127,  112, 231 },
+	{ 127, 255, 127,  141, 231 },
+	{ 127, 255, 127,  141, 22 },
+	{ 127, 255, 127,  143, 231 },
+	{ 127, 255, 127,  173, 231 },
+	{ 127, 255, 127,  173, 22 },
+	{ 127, 255, 127,  175, 231 },
+	{ 127, 255, 127,  204, 231 },
+	{ 127, 255, 127,  204, 22 },
+	{ 127, 255, 127,  206, 231 },
+	{ 127, 255, 127,  235, 231 },
+	{ 127, 255, 127,  235, 22 },
+	{ 255, 127, 127,  206, 231 },
+	{ 255, 127, 127,  235, 231 },
+	{ 255, 127, 127,  206, 231 },
+	{ 0, 127, 127,  175, 22 },
+	{ 0, 127, 127,  204, 22 },
+	{ 0, 127, 127,  204, 22 },
+	{ 127, 127, 255,  112, 22 },
+	{ 127, 127, 255,  112, 231 },
+	{ 127, 127, 255,  112, 22 },
+	{ 127, 127, 0,  110, 22 },
+	{ 127, 127, 0,  110, 231 },
+	{ 127, 127, 0,  110, 231 },
+	{ 255, 127, 127,  49, 231 },
+	{ 255, 127, 127,  79, 231 },
+	{ 255, 127, 127,  49, 231 },
+	{ 0, 127, 127,  18, 22 },
+	{ 0, 127, 127,  47, 22 },
+	{ 0, 127, 127,  47, 22 },
+	{ 127, 127, 0,  235, 22 },
+	{ 127, 127, 0,  235, 231 },
+	{ 127, 127, 0,  235, 231 },
+	{ 255, 127, 127,  175, 231 },
+	{ 255, 127, 127,  204, 231 },
+	{ 255, 127, 127,  175, 231 },
+	{ 0, 127, 127,  173, 22 },
+	{ 0, 127, 127,  143, 22 },
+	{ 0, 127, 127,  173, 22 },
+	{ 127, 127, 255,  81, 22 },
+	{ 127, 127, 255,  81, 231 },
+	{ 127, 127, 255,  81, 22 },
+	{ 127, 127, 0,  79, 22 },
+	{ 127, 127, 0,  79, 231 },
+	{ 127, 127, 0,  79, 231 },
+	{ 255, 127, 127,  18, 231 },
+	{ 255, 127, 127,  47, 231 },
+	{ 255, 127, 127,  18, 231 },
+	{ 127, 127, 255,  206, 22 },
+	{ 127, 127, 255,  206, 231 },
+	{ 127, 127, 255,  206, 22 },
+	{ 127, 127, 0,  204, 22 },
+	{ 127, 127, 0,  204, 231 },
+	{ 127, 127, 0,  204, 231 },
+	{ 255, 127, 127,  143, 231 },
+	{ 255, 127, 127,  173, 231 },
+	{ 255, 127, 127,  143, 231 },
+	{ 0, 127, 127,  112, 22 },
+	{ 0, 127, 127,  141, 22 },
+	{ 0, 127, 127,  141, 22 },
+	{ 127, 127, 255,  49, 22 },
+	{ 127, 127, 255,  49, 231 },
+	{ 127, 127, 255,  49, 22 },
+	{ 127, 127, 0,  47, 22 },
+	{ 127, 127, 0,  47, 231 },
+	{ 127, 127, 0,  47, 231 },
+	{ 127, 127, 255,  175, 22 },
+	{ 127, 127, 255,  175, 231 },
+	{ 127, 127, 255,  175, 22 },
+	{ 127, 127, 0,  173, 22 },
+	{ 127, 127, 0,  173, 231 },
+	{ 127, 127, 0,  173, 231 },
+	{ 255, 127, 127,  112, 231 },
+	{ 255, 127, 127,  141, 231 },
+	{ 255, 127, 127,  112, 231 },
+	{ 0, 127, 127,  81, 22 },
+	{ 0, 127, 127,  110, 22 },
+	{ 0, 127, 127,  110, 22 },
+	{ 127, 127, 255,  18, 22 },
+	{ 127, 127, 255,  18, 231 },
+	{ 127, 127, 255,  18, 22 },
+	{ 0, 127, 127,  206, 22 },
+	{ 0, 127, 127,  235, 22 },
+	{ 0, 127, 127,  235, 22 },
+	{ 127, 127, 255,  143, 22 },
+	{ 127, 127, 255,  143, 231 },
+	{ 127, 127, 255,  143, 22 },
+	{ 127, 127, 0,  141, 22 },
+	{ 127, 127, 0,  141, 231 },
+	{ 127, 127, 0,  141, 231 },
+	{ 255, 127, 127,  81, 231 },
+	{ 255, 127, 127,  110, 231 },
+	{ 255, 127, 127,  81, 231 },
+	{ 0, 127, 127,  49, 22 },
+	{ 0, 127, 127,  79, 22 },
+	{ 0, 127, 127,  79, 22 },
+	{ 127, 0, 127,  236, 230 },
+	{ 127, 0, 127,  236, 23 },
+	{ 127, 0, 127,  255, 1 },
+	{ 135, 0, 136,  110, 22 },
+	{ 135, 0, 136,  110, 231 },
+	{ 135, 0, 136,  81, 231 },
+	{ 119, 254, 118,  110, 22 },
+	{ 119, 254, 118,  81, 22 },
+	{ 119, 254, 118,  110, 231 },
+	{ 36, 115, 38,  131, 227 },
+	{ 36, 115, 38,  131, 27 },
+	{ 36, 115, 38,  123, 227 },
+	{ 218, 139, 216,  131, 227 },
+	{ 218, 139, 216,  131, 27 },
+	{ 218, 139, 216,  123, 227 },
+	{ 26, 127, 204,  81, 22 },
+	{ 26, 127, 204,  110, 22 },
+	{ 26, 127, 204,  110, 29 },
+	{ 228, 127, 50,  82, 225 },
+	{ 228, 127, 50,  109, 226 },
+	{ 228, 127, 50,  81, 231 },
+	{ 255, 127, 127,  0, 0 },
+	{ 255, 127, 127,  18, 24 },
+	{ 255, 127, 127,  0, 253 },
+	{ 255, 127, 127,  0, 255 },
+	{ 255, 127, 127,  18, 232 },
+	{ 255, 127, 127,  253, 255 },
+	{ 255, 127, 127,  254, 0 },
+	{ 255, 127, 127,  235, 22 },
+	{ 255, 127, 127,  0, 0 },
+	{ 6, 86, 127,  17, 22 },
+	{ 6, 86, 127,  235, 22 },
+	{ 6, 86, 127,  254, 0 },
+	{ 127, 127, 0,  122, 25 },
+	{ 127, 127, 0,  122, 229 },
+	{ 127, 127, 0,  132, 229 },
+	{ 10, 127, 76,  236, 23 },
+	{ 10, 127, 76,  236, 230 },
+	{ 10, 127, 76,  254, 254 },
+	{ 127, 127, 255,  122, 25 },
+	{ 127, 127, 255,  122, 229 },
+	{ 127, 127, 255,  132, 229 },
+	{ 127, 255, 127,  122, 25 },
+	{ 127, 255, 127,  122, 229 },
+	{ 127, 255, 127,  132, 229 },
+	{ 127, 207, 28,  18, 231 },
+	{ 127, 207, 28,  0, 253 },
+	{ 127, 207, 28,  18, 231 },
+	{ 10, 127, 178,  18, 231 },
+	{ 10, 127, 178,  18, 24 },
+	{ 10, 127, 178,  0, 0 },
+	{ 127, 203, 230,  17, 22 },
+	{ 127, 203, 230,  0, 0 },
+	{ 127, 203, 230,  17, 22 },
+	{ 6, 168, 127,  236, 232 },
+	{ 6, 168, 127,  18, 232 },
+	{ 6, 168, 127,  0, 255 },
+	{ 127, 47, 226,  236, 23 },
+	{ 127, 47, 226,  255, 1 },
+	{ 127, 47, 226,  236, 23 },
+	{ 127, 0, 127,  122, 25 },
+	{ 127, 0, 127,  122, 229 },
+	{ 127, 0, 127,  132, 229 },
+	{ 127, 46, 226,  18, 232 },
+	{ 127, 46, 226,  18, 232 },
+	{ 127, 46, 226,  0, 255 },
+	{ 127, 51, 24,  236, 232 },
+	{ 127, 51, 24,  253, 255 },
+	{ 127, 51, 24,  236, 232 },
+	{ 127, 208, 28,  235, 22 },
+	{ 127, 208, 28,  235, 22 },
+	{ 127, 208, 28,  254, 0 },
+	{ 127, 51, 25,  18, 24 },
+	{ 127, 51, 25,  18, 24 },
+	{ 127, 51, 25,  0, 0 },
+	{ 127, 203, 229,  236, 230 },
+	{ 127, 203, 229,  236, 230 },
+	{ 127, 203, 229,  254, 254 },
+	{ 255, 127, 127,  18, 22 },
+	{ 255, 127, 127,  47, 22 },
+	{ 255, 127, 127,  47, 231 },
+	{ 255, 127, 127,  49, 22 },
+	{ 255, 127, 127,  79, 22 },
+	{ 255, 127, 127,  79, 231 },
+	{ 255, 127, 127,  81, 22 },
+	{ 255, 127, 127,  110, 22 },
+	{ 255, 127, 127,  110, 231 },
+	{ 255, 127, 127,  112, 22 },
+	{ 255, 127, 127,  141, 22 },
+	{ 255, 127, 127,  141, 231 },
+	{ 255, 127, 127,  143, 22 },
+	{ 255, 127, 127,  173, 22 },
+	{ 255, 127, 127,  173, 231 },
+	{ 255, 127, 127,  175, 22 },
+	{ 255, 127, 127,  204, 22 },
+	{ 255, 127, 127,  204, 231 },
+	{ 255, 127, 127,  206, 22 },
+	{ 255, 127, 127,  235, 22 },
+	{ 255, 127, 127,  235, 231 },
+	{ 0, 127, 127,  18, 22 },
+	{ 0, 127, 127,  18, 231 },
+	{ 0, 127, 127,  47, 22 },
+	{ 0, 127, 127,  49, 22 },
+	{ 0, 127, 127,  49, 231 },
+	{ 0, 127, 127,  79, 22 },
+	{ 0, 127, 127,  81, 22 },
+	{ 0, 127, 127,  81, 231 },
+	{ 0, 127, 127,  110, 22 },
+	{ 0, 127, 127,  112, 22 },
+	{ 0, 127, 127,  112, 231 },
+	{ 0, 127, 127,  141, 22 },
+	{ 0, 127, 127,  143, 22 },
+	{ 0, 127, 127,  143, 231 },
+	{ 0, 127, 127,  173, 22 },
+	{ 0, 127, 127,  175, 22 },
+	{ 0, 127, 127,  175, 231 },
+	{ 0, 127, 127,  204, 22 },
+	{ 0, 127, 127,  206, 22 },
+	{ 0, 127, 127,  206, 231 },
+	{ 0, 127, 127,  235, 22 },
+	{ 127, 255, 127,  235, 231 },
+	{ 127, 255, 127,  235, 231 },
+	{ 127, 255, 127,  206, 231 },
+	{ 127, 0, 127,  175, 22 },
+	{ 127, 0, 127,  175, 22 },
+	{ 127, 0, 127,  204, 22 },
+	{ 127, 127, 255,  112, 231 },
+	{ 127, 127, 255,  112, 231 },
+	{ 127, 127, 255,  112, 22 },
+	{ 127, 127, 0,  110, 22 },
+	{ 127, 127, 0,  110, 22 },
+	{ 127, 127, 0,  110, 231 },
+	{ 127, 255, 127,  79, 231 },
+	{ 127, 255, 127,  79, 231 },
+	{ 127, 255, 127,  49, 231 },
+	{ 127, 0, 127,  18, 22 },
+	{ 127, 0, 127,  18, 22 },
+	{ 127, 0, 127,  47, 22 },
+	{ 127, 127, 0,  235, 22 },
+	{ 127, 127, 0,  235, 22 },
+	{ 127, 127, 0,  235, 231 },
+	{ 127, 255, 127,  204, 231 },
+	{ 127, 255, 127,  204, 231 },
+	{ 127, 255, 127,  175, 231 },
+	{ 127, 0, 127,  143, 22 },
+	{ 127, 0, 127,  143, 22 },
+	{ 127, 0, 127,  173, 22 },
+	{ 127, 127, 255,  81, 231 },
+	{ 127, 127, 255,  81, 231 },
+	{ 127, 127, 255,  81, 22 },
+	{ 127, 127, 0,  79, 22 },
+	{ 127, 127, 0,  79, 22 },
+	{ 127, 127, 0,  79, 231 },
+	{ 127, 255, 127,  47, 231 },
+	{ 127, 255, 127,  47, 231 },
+	{ 127, 255, 127,  18, 231 },
+	{ 127, 127, 255,  206, 231 },
+	{ 127, 127, 255,  206, 231 },
+	{ 127, 127, 255,  206, 22 },
+	{ 127, 127, 0,  204, 22 },
+	{ 127, 127, 0,  204, 22 },
+	{ 127, 127, 0,  204, 231 },
+	{ 127, 255, 127,  173, 231 },
+	{ 127, 255, 127,  173, 231 },
+	{ 127, 255, 127,  143, 231 },
+	{ 127, 0, 127,  112, 22 },
+	{ 127, 0, 127,  112, 22 },
+	{ 127, 0, 127,  141, 22 },
+	{ 127, 127, 255,  49, 231 },
+	{ 127, 127, 255,  49, 231 },
+	{ 127, 127, 255,  49, 22 },
+	{ 127, 127, 0,  47, 22 },
+	{ 127, 127, 0,  47, 22 },
+	{ 127, 127, 0,  47, 231 },
+	{ 127, 127, 255,  175, 231 },
+	{ 127, 127, 255,  175, 231 },
+	{ 127, 127, 255,  175, 22 },
+	{ 127, 127, 0,  173, 22 },
+	{ 127, 127, 0,  173, 22 },
+	{ 127, 127, 0,  173, 231 },
+	{ 127, 255, 127,  141, 231 },
+	{ 127, 255, 127,  141, 231 },
+	{ 127, 255, 127,  112, 231 },
+	{ 127, 0, 127,  81, 22 },
+	{ 127, 0, 127,  81, 22 },
+	{ 127, 0, 127,  110, 22 },
+	{ 127, 127, 255,  18, 231 },
+	{ 127, 127, 255,  18, 231 },
+	{ 127, 127, 255,  18, 22 },
+	{ 127, 0, 127,  206, 22 },
+	{ 127, 0, 127,  206, 22 },
+	{ 127, 0, 127,  235, 22 },
+	{ 127, 127, 255,  143, 231 },
+	{ 127, 127, 255,  143, 231 },
+	{ 127, 127, 255,  143, 22 },
+	{ 127, 127, 0,  141, 22 },
+	{ 127, 127, 0,  141, 22 },
+	{ 127, 127, 0,  141, 231 },
+	{ 127, 255, 127,  110, 231 },
+	{ 127, 255, 127,  110, 231 },
+	{ 127, 255, 127,  81, 231 },
+	{ 127, 0, 127,  49, 22 },
+	{ 127, 0, 127,  49, 22 },
+	{ 127, 0, 127,  79, 22 },
+	{ 255, 127, 127,  254, 254 },
+	{ 255, 127, 127,  236, 230 },
+	{ 255, 127, 127,  255, 1 },
+	{ 254, 135, 136,  81, 22 },
+	{ 254, 135, 136,  110, 22 },
+	{ 254, 135, 136,  81, 231 },
+	{ 0, 119, 118,  81, 22 },
+	{ 0, 119, 118,  81, 231 },
+	{ 0, 119, 118,  110, 231 },
+	{ 139, 36, 38,  131, 27 },
+	{ 139, 36, 38,  123, 27 },
+	{ 139, 36, 38,  131, 227 },
+	{ 115, 218, 216,  131, 27 },
+	{ 115, 218, 216,  123, 27 },
+	{ 115, 218, 216,  131, 227 },
+	{ 127, 26, 204,  80, 29 },
+	{ 127, 26, 204,  81, 22 },
+	{ 127, 26, 204,  110, 29 },
+	{ 127, 228, 50,  109, 226 },
+	{ 127, 228, 50,  110, 231 },
+	{ 127, 228, 50,  81, 231 },
+	{ 255, 127, 127,  18, 24 },
+	{ 255, 127, 127,  18, 231 },
+	{ 255, 127, 127,  0, 253 },
+	{ 255, 127, 127,  18, 232 },
+	{ 255, 127, 127,  236, 232 },
+	{ 255, 127, 127,  253, 255 },
+	{ 255, 127, 127,  235, 22 },
+	{ 255, 127, 127,  17, 22 },
+	{ 255, 127, 127,  0, 0 },
+	{ 6, 86, 127,  0, 0 },
+	{ 6, 86, 127,  17, 22 },
+	{ 6, 86, 127,  254, 0 },
+	{ 127, 127, 0,  132, 25 },
+	{ 127, 127, 0,  122, 25 },
+	{ 127, 127, 0,  132, 229 },
+	{ 10, 127, 77,  255, 1 },
+	{ 10, 127, 77,  236, 23 },
+	{ 10, 127, 77,  254, 254 },
+	{ 127, 127, 255,  132, 25 },
+	{ 127, 127, 255,  122, 25 },
+	{ 127, 127, 255,  132, 229 },
+	{ 127, 255, 127,  132, 25 },
+	{ 127, 255, 127,  122, 25 },
+	{ 127, 255, 127,  132, 229 },
+	{ 10, 127, 177,  0, 253 },
+	{ 10, 127, 177,  18, 231 },
+	{ 10, 127, 177,  0, 0 },
+	{ 6, 168, 127,  253, 255 },
+	{ 6, 168, 127,  236, 232 },
+	{ 6, 168, 127,  0, 255 },
+	{ 127, 0, 127,  132, 25 },
+	{ 127, 0, 127,  122, 25 },
+	{ 127, 0, 127,  132, 229 },
+	{ 255, 127, 127,  18, 231 },
+	{ 255, 127, 127,  18, 22 },
+	{ 255, 127, 127,  47, 231 },
+	{ 255, 127, 127,  49, 231 },
+	{ 255, 127, 127,  49, 22 },
+	{ 255, 127, 127,  79, 231 },
+	{ 255, 127, 127,  81, 231 },
+	{ 255, 127, 127,  81, 22 },
+	{ 255, 127, 127,  110, 231 },
+	{ 255, 127, 127,  112, 231 },
+	{ 255, 127, 127,  112, 22 },
+	{ 255, 127, 127,  141, 231 },
+	{ 255, 127, 127,  143, 231 },
+	{ 255, 127, 127,  143, 22 },
+	{ 255, 127, 127,  173, 231 },
+	{ 255, 127, 127,  175, 231 },
+	{ 255, 127, 127,  175, 22 },
+	{ 255, 127, 127,  204, 231 },
+	{ 255, 127, 127,  206, 231 },
+	{ 255, 127, 127,  206, 22 },
+	{ 255, 127, 127,  235, 231 },
+	{ 0, 127, 127,  18, 231 },
+	{ 0, 127, 127,  47, 231 },
+	{ 0, 127, 127,  47, 22 },
+	{ 0, 127, 127,  49, 231 },
+	{ 0, 127, 127,  79, 231 },
+	{ 0, 127, 127,  79, 22 },
+	{ 0, 127, 127,  81, 231 },
+	{ 0, 127, 127,  110, 231 },
+	{ 0, 127, 127,  110, 22 },
+	{ 0, 127, 127,  112, 231 },
+	{ 0, 127, 127,  141, 231 },
+	{ 0, 127, 127,  141, 22 },
+	{ 0, 127, 127,  143, 231 },
+	{ 0, 127, 127,  173, 231 },
+	{ 0, 127, 127,  173, 22 },
+	{ 0, 127, 127,  175, 231 },
+	{ 0, 127, 127,  204, 231 },
+	{ 0, 127, 127,  204, 22 },
+	{ 0, 127, 127,  206, 231 },
+	{ 0, 127, 127,  235, 231 },
+	{ 0, 127, 127,  235, 22 },
+	{ 127, 255, 127,  206, 231 },
+	{ 127, 255, 127,  235, 231 },
+	{ 127, 255, 127,  206, 231 },
+	{ 127, 0, 127,  204, 22 },
+	{ 127, 0, 127,  175, 22 },
+	{ 127, 0, 127,  204, 22 },
+	{ 127, 127, 255,  112, 231 },
+	{ 127, 127, 255,  112, 22 },
+	{ 127, 127, 255,  112, 22 },
+	{ 127, 127, 0,  110, 231 },
+	{ 127, 127, 0,  110, 22 },
+	{ 127, 127, 0,  110, 231 },
+	{ 127, 255, 127,  49, 231 },
+	{ 127, 255, 127,  79, 231 },
+	{ 127, 255, 127,  49, 231 },
+	{ 127, 0, 127,  47, 22 },
+	{ 127, 0, 127,  18, 22 },
+	{ 127, 0, 127,  47, 22 },
+	{ 127, 127, 0,  235, 22 },
+	{ 127, 127, 0,  235, 231 },
+	{ 127, 127, 0,  235, 231 },
+	{ 127, 255, 127,  175, 231 },
+	{ 127, 255, 127,  204, 231 },
+	{ 127, 255, 127,  175, 231 },
+	{ 127, 0, 127,  143, 22 },
+	{ 127, 0, 127,  173, 22 },
+	{ 127, 0, 127,  173, 22 },
+	{ 127, 127, 255,  81, 231 },
+	{ 127, 127, 255,  81, 22 },
+	{ 127, 127, 255,  81, 22 },
+	{ 127, 127, 0,  79, 231 },
+	{ 127, 127, 0,  79, 22 },
+	{ 127, 127, 0,  79, 231 },
+	{ 127, 255, 127,  18, 231 },
+	{ 127, 255, 127,  47, 231 },
+	{ 127, 255, 127,  18, 231 },
+	{ 127, 127, 255,  206, 231 },
+	{ 127, 127, 255,  206, 22 },
+	{ 127, 127, 255,  206, 22 },
+	{ 127, 127, 0,  204, 22 },
+	{ 127, 127, 0,  204, 231 },
+	{ 127, 127, 0,  204, 231 },
+	{ 127, 255, 127,  143, 231 },
+	{ 127, 255, 127,  173, 231 },
+	{ 127, 255, 127,  143, 231 },
+	{ 127, 0, 127,  141, 22 },
+	{ 127, 0, 127,  112, 22 },
+	{ 127, 0, 127,  141, 22 },
+	{ 127, 127, 255,  49, 231 },
+	{ 127, 127, 255,  49, 22 },
+	{ 127, 127, 255,  49, 22 },
+	{ 127, 127, 0,  47, 22 },
+	{ 127, 127, 0,  47, 231 },
+	{ 127, 127, 0,  47, 231 },
+	{ 127, 127, 255,  175, 231 },
+	{ 127, 127, 255,  175, 22 },
+	{ 127, 127, 255,  175, 22 },
+	{ 127, 127, 0,  173, 22 },
+	{ 127, 127, 0,  173, 231 },
+	{ 127, 127, 0,  173, 231 },
+	{ 127, 255, 127,  112, 231 },
+	{ 127, 255, 127,  141, 231 },
+	{ 127, 255, 127,  112, 231 },
+	{ 127, 0, 127,  110, 22 },
+	{ 127, 0, 127,  81, 22 },
+	{ 127, 0, 127,  110, 22 },
+	{ 127, 127, 255,  18, 231 },
+	{ 127, 127, 255,  18, 22 },
+	{ 127, 127, 255,  18, 22 },
+	{ 127, 0, 127,  235, 22 },
+	{ 127, 0, 127,  206, 22 },
+	{ 127, 0, 127,  235, 22 },
+	{ 127, 127, 255,  143, 231 },
+	{ 127, 127, 255,  143, 22 },
+	{ 127, 127, 255,  143, 22 },
+	{ 127, 127, 0,  141, 22 },
+	{ 127, 127, 0,  141, 231 },
+	{ 127, 127, 0,  141, 231 },
+	{ 127, 255, 127,  81, 231 },
+	{ 127, 255, 127,  110, 231 },
+	{ 127, 255, 127,  81, 231 },
+	{ 127, 0, 127,  79, 22 },
+	{ 127, 0, 127,  49, 22 },
+	{ 127, 0, 127,  79, 22 },
+	{ 255, 127, 127,  236, 230 },
+	{ 255, 127, 127,  236, 23 },
+	{ 255, 127, 127,  255, 1 },
+	{ 254, 135, 136,  110, 22 },
+	{ 254, 135, 136,  110, 231 },
+	{ 254, 135, 136,  81, 231 },
+	{ 0, 119, 118,  110, 22 },
+	{ 0, 119, 118,  81, 22 },
+	{ 0, 119, 118,  110, 231 },
+	{ 139, 36, 38,  123, 27 },
+	{ 139, 36, 38,  123, 227 },
+	{ 139, 36, 38,  131, 227 },
+	{ 115, 218, 216,  123, 27 },
+	{ 115, 218, 216,  123, 227 },
+	{ 115, 218, 216,  131, 227 },
+	{ 127, 26, 204,  81, 22 },
+	{ 127, 26, 204,  110, 22 },
+	{ 127, 26, 204,  110, 29 },
+	{ 127, 228, 50,  82, 225 },
+	{ 127, 228, 50,  109, 226 },
+	{ 127, 228, 50,  81, 231 },
+};
+
+const uint16_t *indices1 = (uint16_t*)0;
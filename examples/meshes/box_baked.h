@@ -0,0 +1,2307 @@
+const vertex_baked_t baked1[] =
+{ // ambient occlusion * (ambient + diffuse)
+	{ 50 },
+	{ 139 },
+	{ 139 },
+	{ 133 },
+	{ 139 },
+	{ 70 },
+	{ 54 },
+	{ 139 },
+	{ 139 },
+	{ 4 },
+	{ 0 },
+	{ 2 },
+	{ 8 },
+	{ 13 },
+	{ 26 },
+	{ 5 },
+	{ 2 },
+	{ 37 },
+	{ 26 },
+	{ 39 },
+	{ 67 },
+	{ 0 },
+	{ 22 },
+	{ 67 },
+	{ 6 },
+	{ 0 },
+	{ 25 },
+	{ 3 },
+	{ 6 },
+	{ 2 },
+	{ 8 },
+	{ 0 },
+	{ 82 },
+	{ 5 },
+	{ 4 },
+	{ 45 },
+	{ 7 },
+	{ 15 },
+	{ 31 },
+	{ 13 },
+	{ 10 },
+	{ 26 },
+	{ 5 },
+	{ 31 },
+	{ 56 },
+	{ 2 },
+	{ 10 },
+	{ 23 },
+	{ 0 },
+	{ 26 },
+	{ 45 },
+	{ 3 },
+	{ 24 },
+	{ 12 },
+	{ 19 },
+	{ 82 },
+	{ 3 },
+	{ 0 },
+	{ 0 },
+	{ 72 },
+	{ 0 },
+	{ 0 },
+	{ 72 },
+	{ 0 },
+	{ 0 },
+	{ 72 },
+	{ 0 },
+	{ 0 },
+	{ 70 },
+	{ 0 },
+	{ 0 },
+	{ 70 },
+	{ 0 },
+	{ 0 },
+	{ 70 },
+	{ 0 },
+	{ 0 },
+	{ 33 },
+	{ 16 },
+	{ 18 },
+	{ 25 },
+	{ 25 },
+	{ 26 },
+	{ 31 },
+	{ 29 },
+	{ 31 },
+	{ 31 },
+	{ 29 },
+	{ 31 },
+	{ 29 },
+	{ 29 },
+	{ 31 },
+	{ 29 },
+	{ 29 },
+	{ 31 },
+	{ 25 },
+	{ 25 },
+	{ 24 },
+	{ 18 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 45 },
+	{ 43 },
+	{ 6 },
+	{ 4 },
+	{ 16 },
+	{ 18 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 2 },
+	{ 1 },
+	{ 1 },
+	{ 2 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 41 },
+	{ 43 },
+	{ 6 },
+	{ 4 },
+	{ 16 },
+	{ 18 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 43 },
+	{ 43 },
+	{ 6 },
+	{ 1 },
+	{ 5 },
+	{ 6 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 30 },
+	{ 15 },
+	{ 2 },
+	{ 4 },
+	{ 16 },
+	{ 18 },
+	{ 45 },
+	{ 43 },
+	{ 6 },
+	{ 4 },
+	{ 16 },
+	{ 18 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 0 },
+	{ 45 },
+	{ 43 },
+	{ 6 },
+	{ 4 },
+	{ 16 },
+	{ 18 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 61 },
+	{ 139 },
+	{ 139 },
+	{ 122 },
+	{ 151 },
+	{ 151 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 27 },
+	{ 6 },
+	{ 29 },
+	{ 55 },
+	{ 13 },
+	{ 34 },
+	{ 11 },
+	{ 4 },
+	{ 25 },
+	{ 35 },
+	{ 7 },
+	{ 4 },
+	{ 70 },
+	{ 50 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 70 },
+	{ 0 },
+	{ 54 },
+	{ 139 },
+	{ 0 },
+	{ 16 },
+	{ 2 },
+	{ 26 },
+	{ 8 },
+	{ 26 },
+	{ 2 },
+	{ 26 },
+	{ 37 },
+	{ 39 },
+	{ 76 },
+	{ 67 },
+	{ 72 },
+	{ 0 },
+	{ 67 },
+	{ 37 },
+	{ 4 },
+	{ 2 },
+	{ 34 },
+	{ 5 },
+	{ 45 },
+	{ 10 },
+	{ 24 },
+	{ 26 },
+	{ 39 },
+	{ 0 },
+	{ 72 },
+	{ 0 },
+	{ 72 },
+	{ 72 },
+	{ 72 },
+	{ 0 },
+	{ 72 },
+	{ 72 },
+	{ 0 },
+	{ 70 },
+	{ 70 },
+	{ 0 },
+	{ 70 },
+	{ 0 },
+	{ 52 },
+	{ 70 },
+	{ 48 },
+	{ 0 },
+	{ 33 },
+	{ 18 },
+	{ 26 },
+	{ 25 },
+	{ 29 },
+	{ 25 },
+	{ 31 },
+	{ 29 },
+	{ 29 },
+	{ 31 },
+	{ 31 },
+	{ 31 },
+	{ 29 },
+	{ 31 },
+	{ 31 },
+	{ 29 },
+	{ 26 },
+	{ 29 },
+	{ 25 },
+	{ 16 },
+	{ 25 },
+	{ 18 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 43 },
+	{ 45 },
+	{ 6 },
+	{ 15 },
+	{ 4 },
+	{ 18 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 1 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 43 },
+	{ 45 },
+	{ 6 },
+	{ 15 },
+	{ 4 },
+	{ 18 },
+	{ 7 },
+	{ 0 },
+	{ 2 },
+	{ 43 },
+	{ 45 },
+	{ 6 },
+	{ 4 },
+	{ 1 },
+	{ 6 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 15 },
+	{ 13 },
+	{ 2 },
+	{ 15 },
+	{ 4 },
+	{ 18 },
+	{ 43 },
+	{ 45 },
+	{ 6 },
+	{ 12 },
+	{ 4 },
+	{ 18 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 43 },
+	{ 45 },
+	{ 6 },
+	{ 14 },
+	{ 4 },
+	{ 18 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 102 },
+	{ 61 },
+	{ 139 },
+	{ 146 },
+	{ 122 },
+	{ 151 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 6 },
+	{ 9 },
+	{ 29 },
+	{ 13 },
+	{ 13 },
+	{ 34 },
+	{ 4 },
+	{ 3 },
+	{ 25 },
+	{ 23 },
+	{ 35 },
+	{ 4 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 0 },
+	{ 51 },
+	{ 51 },
+	{ 7 },
+	{ 0 },
+	{ 0 },
+	{ 22 },
+	{ 35 },
+	{ 69 },
+	{ 16 },
+	{ 21 },
+	{ 50 },
+	{ 10 },
+	{ 14 },
+	{ 28 },
+	{ 37 },
+	{ 15 },
+	{ 67 },
+	{ 22 },
+	{ 109 },
+	{ 87 },
+	{ 3 },
+	{ 2 },
+	{ 76 },
+	{ 4 },
+	{ 49 },
+	{ 25 },
+	{ 23 },
+	{ 13 },
+	{ 105 },
+	{ 6 },
+	{ 28 },
+	{ 26 },
+	{ 14 },
+	{ 11 },
+	{ 27 },
+	{ 5 },
+	{ 27 },
+	{ 49 },
+	{ 6 },
+	{ 15 },
+	{ 32 },
+	{ 11 },
+	{ 90 },
+	{ 0 },
+	{ 6 },
+	{ 34 },
+	{ 53 },
+	{ 4 },
+	{ 25 },
+	{ 24 },
+	{ 0 },
+	{ 0 },
+	{ 26 },
+	{ 0 },
+	{ 0 },
+	{ 26 },
+	{ 0 },
+	{ 0 },
+	{ 26 },
+	{ 0 },
+	{ 0 },
+	{ 26 },
+	{ 0 },
+	{ 0 },
+	{ 26 },
+	{ 0 },
+	{ 0 },
+	{ 18 },
+	{ 0 },
+	{ 0 },
+	{ 12 },
+	{ 46 },
+	{ 44 },
+	{ 63 },
+	{ 63 },
+	{ 67 },
+	{ 81 },
+	{ 81 },
+	{ 81 },
+	{ 81 },
+	{ 81 },
+	{ 81 },
+	{ 81 },
+	{ 81 },
+	{ 81 },
+	{ 81 },
+	{ 81 },
+	{ 81 },
+	{ 70 },
+	{ 70 },
+	{ 67 },
+	{ 50 },
+	{ 2 },
+	{ 4 },
+	{ 4 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 18 },
+	{ 17 },
+	{ 17 },
+	{ 11 },
+	{ 45 },
+	{ 45 },
+	{ 4 },
+	{ 4 },
+	{ 4 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 4 },
+	{ 6 },
+	{ 2 },
+	{ 4 },
+	{ 4 },
+	{ 4 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 16 },
+	{ 16 },
+	{ 17 },
+	{ 11 },
+	{ 45 },
+	{ 45 },
+	{ 4 },
+	{ 4 },
+	{ 2 },
+	{ 17 },
+	{ 17 },
+	{ 17 },
+	{ 4 },
+	{ 15 },
+	{ 13 },
+	{ 4 },
+	{ 4 },
+	{ 4 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 11 },
+	{ 5 },
+	{ 5 },
+	{ 11 },
+	{ 45 },
+	{ 45 },
+	{ 18 },
+	{ 17 },
+	{ 17 },
+	{ 11 },
+	{ 45 },
+	{ 37 },
+	{ 4 },
+	{ 4 },
+	{ 4 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 2 },
+	{ 2 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 2 },
+	{ 18 },
+	{ 17 },
+	{ 17 },
+	{ 11 },
+	{ 45 },
+	{ 43 },
+	{ 4 },
+	{ 4 },
+	{ 4 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 50 },
+	{ 51 },
+	{ 50 },
+	{ 42 },
+	{ 51 },
+	{ 49 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 29 },
+	{ 6 },
+	{ 9 },
+	{ 20 },
+	{ 5 },
+	{ 6 },
+	{ 11 },
+	{ 4 },
+	{ 3 },
+	{ 93 },
+	{ 25 },
+	{ 63 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 30 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 86 },
+	{ 7 },
+	{ 0 },
+	{ 35 },
+	{ 74 },
+	{ 69 },
+	{ 50 },
+	{ 16 },
+	{ 47 },
+	{ 26 },
+	{ 10 },
+	{ 28 },
+	{ 76 },
+	{ 37 },
+	{ 67 },
+	{ 2 },
+	{ 77 },
+	{ 75 },
+	{ 13 },
+	{ 138 },
+	{ 105 },
+	{ 11 },
+	{ 26 },
+	{ 27 },
+	{ 16 },
+	{ 0 },
+	{ 26 },
+	{ 26 },
+	{ 0 },
+	{ 26 },
+	{ 26 },
+	{ 0 },
+	{ 26 },
+	{ 0 },
+	{ 26 },
+	{ 26 },
+	{ 0 },
+	{ 26 },
+	{ 26 },
+	{ 26 },
+	{ 0 },
+	{ 18 },
+	{ 18 },
+	{ 0 },
+	{ 12 },
+	{ 44 },
+	{ 65 },
+	{ 63 },
+	{ 67 },
+	{ 81 },
+	{ 81 },
+	{ 81 },
+	{ 81 },
+	{ 81 },
+	{ 81 },
+	{ 81 },
+	{ 81 },
+	{ 81 },
+	{ 81 },
+	{ 81 },
+	{ 81 },
+	{ 67 },
+	{ 70 },
+	{ 67 },
+	{ 48 },
+	{ 50 },
+	{ 4 },
+	{ 4 },
+	{ 4 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 2 },
+	{ 18 },
+	{ 17 },
+	{ 45 },
+	{ 48 },
+	{ 45 },
+	{ 4 },
+	{ 4 },
+	{ 4 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 6 },
+	{ 9 },
+	{ 2 },
+	{ 4 },
+	{ 4 },
+	{ 4 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 2 },
+	{ 16 },
+	{ 17 },
+	{ 45 },
+	{ 48 },
+	{ 45 },
+	{ 4 },
+	{ 4 },
+	{ 2 },
+	{ 2 },
+	{ 17 },
+	{ 17 },
+	{ 15 },
+	{ 19 },
+	{ 13 },
+	{ 4 },
+	{ 4 },
+	{ 4 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 11 },
+	{ 5 },
+	{ 45 },
+	{ 48 },
+	{ 45 },
+	{ 2 },
+	{ 18 },
+	{ 17 },
+	{ 45 },
+	{ 48 },
+	{ 37 },
+	{ 4 },
+	{ 4 },
+	{ 4 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 0 },
+	{ 2 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 2 },
+	{ 2 },
+	{ 18 },
+	{ 17 },
+	{ 45 },
+	{ 48 },
+	{ 43 },
+	{ 4 },
+	{ 4 },
+	{ 4 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 49 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 31 },
+	{ 29 },
+	{ 9 },
+	{ 10 },
+	{ 20 },
+	{ 6 },
+	{ 26 },
+	{ 11 },
+	{ 3 },
+	{ 25 },
+	{ 14 },
+	{ 63 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 1 },
+	{ 0 },
+	{ 40 },
+	{ 10 },
+	{ 14 },
+	{ 26 },
+	{ 4 },
+	{ 6 },
+	{ 42 },
+	{ 24 },
+	{ 35 },
+	{ 74 },
+	{ 2 },
+	{ 17 },
+	{ 78 },
+	{ 6 },
+	{ 35 },
+	{ 26 },
+	{ 1 },
+	{ 1 },
+	{ 39 },
+	{ 8 },
+	{ 144 },
+	{ 84 },
+	{ 5 },
+	{ 1 },
+	{ 42 },
+	{ 8 },
+	{ 38 },
+	{ 32 },
+	{ 14 },
+	{ 10 },
+	{ 25 },
+	{ 4 },
+	{ 32 },
+	{ 59 },
+	{ 4 },
+	{ 44 },
+	{ 25 },
+	{ 0 },
+	{ 28 },
+	{ 49 },
+	{ 3 },
+	{ 26 },
+	{ 43 },
+	{ 14 },
+	{ 84 },
+	{ 139 },
+	{ 0 },
+	{ 2 },
+	{ 41 },
+	{ 0 },
+	{ 0 },
+	{ 70 },
+	{ 0 },
+	{ 0 },
+	{ 72 },
+	{ 0 },
+	{ 0 },
+	{ 72 },
+	{ 0 },
+	{ 0 },
+	{ 72 },
+	{ 0 },
+	{ 0 },
+	{ 70 },
+	{ 0 },
+	{ 0 },
+	{ 50 },
+	{ 15 },
+	{ 16 },
+	{ 24 },
+	{ 24 },
+	{ 25 },
+	{ 31 },
+	{ 29 },
+	{ 30 },
+	{ 31 },
+	{ 29 },
+	{ 30 },
+	{ 31 },
+	{ 29 },
+	{ 30 },
+	{ 31 },
+	{ 29 },
+	{ 30 },
+	{ 26 },
+	{ 22 },
+	{ 23 },
+	{ 18 },
+	{ 2 },
+	{ 4 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 46 },
+	{ 46 },
+	{ 11 },
+	{ 2 },
+	{ 15 },
+	{ 17 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 2 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 44 },
+	{ 46 },
+	{ 11 },
+	{ 2 },
+	{ 15 },
+	{ 17 },
+	{ 0 },
+	{ 0 },
+	{ 6 },
+	{ 41 },
+	{ 46 },
+	{ 11 },
+	{ 1 },
+	{ 5 },
+	{ 5 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 28 },
+	{ 11 },
+	{ 4 },
+	{ 2 },
+	{ 15 },
+	{ 17 },
+	{ 46 },
+	{ 46 },
+	{ 11 },
+	{ 2 },
+	{ 15 },
+	{ 17 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 46 },
+	{ 46 },
+	{ 11 },
+	{ 2 },
+	{ 15 },
+	{ 17 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 125 },
+	{ 151 },
+	{ 151 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 30 },
+	{ 5 },
+	{ 32 },
+	{ 60 },
+	{ 16 },
+	{ 31 },
+	{ 11 },
+	{ 4 },
+	{ 3 },
+	{ 37 },
+	{ 7 },
+	{ 24 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 0 },
+	{ 26 },
+	{ 40 },
+	{ 14 },
+	{ 29 },
+	{ 26 },
+	{ 38 },
+	{ 4 },
+	{ 42 },
+	{ 67 },
+	{ 24 },
+	{ 74 },
+	{ 17 },
+	{ 69 },
+	{ 78 },
+	{ 2 },
+	{ 35 },
+	{ 39 },
+	{ 42 },
+	{ 5 },
+	{ 42 },
+	{ 28 },
+	{ 14 },
+	{ 25 },
+	{ 2 },
+	{ 70 },
+	{ 41 },
+	{ 0 },
+	{ 72 },
+	{ 70 },
+	{ 0 },
+	{ 72 },
+	{ 72 },
+	{ 0 },
+	{ 72 },
+	{ 72 },
+	{ 0 },
+	{ 70 },
+	{ 72 },
+	{ 0 },
+	{ 54 },
+	{ 70 },
+	{ 0 },
+	{ 41 },
+	{ 50 },
+	{ 23 },
+	{ 15 },
+	{ 24 },
+	{ 29 },
+	{ 24 },
+	{ 31 },
+	{ 29 },
+	{ 29 },
+	{ 31 },
+	{ 29 },
+	{ 29 },
+	{ 31 },
+	{ 29 },
+	{ 29 },
+	{ 31 },
+	{ 22 },
+	{ 29 },
+	{ 26 },
+	{ 16 },
+	{ 22 },
+	{ 18 },
+	{ 4 },
+	{ 2 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 46 },
+	{ 46 },
+	{ 11 },
+	{ 14 },
+	{ 2 },
+	{ 17 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 2 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 2 },
+	{ 2 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 46 },
+	{ 46 },
+	{ 11 },
+	{ 14 },
+	{ 2 },
+	{ 17 },
+	{ 0 },
+	{ 2 },
+	{ 6 },
+	{ 46 },
+	{ 46 },
+	{ 11 },
+	{ 6 },
+	{ 1 },
+	{ 5 },
+	{ 0 },
+	{ 2 },
+	{ 2 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 11 },
+	{ 15 },
+	{ 4 },
+	{ 14 },
+	{ 2 },
+	{ 17 },
+	{ 46 },
+	{ 46 },
+	{ 11 },
+	{ 11 },
+	{ 2 },
+	{ 17 },
+	{ 0 },
+	{ 2 },
+	{ 2 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 46 },
+	{ 46 },
+	{ 11 },
+	{ 12 },
+	{ 2 },
+	{ 17 },
+	{ 0 },
+	{ 2 },
+	{ 2 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 144 },
+	{ 125 },
+	{ 151 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 5 },
+	{ 8 },
+	{ 32 },
+	{ 16 },
+	{ 16 },
+	{ 31 },
+	{ 27 },
+	{ 11 },
+	{ 3 },
+	{ 7 },
+	{ 4 },
+	{ 24 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 2 },
+	{ 0 },
+	{ 17 },
+	{ 7 },
+	{ 14 },
+	{ 27 },
+	{ 4 },
+	{ 4 },
+	{ 41 },
+	{ 22 },
+	{ 37 },
+	{ 74 },
+	{ 14 },
+	{ 6 },
+	{ 26 },
+	{ 6 },
+	{ 28 },
+	{ 26 },
+	{ 2 },
+	{ 2 },
+	{ 39 },
+	{ 2 },
+	{ 65 },
+	{ 35 },
+	{ 5 },
+	{ 2 },
+	{ 40 },
+	{ 22 },
+	{ 126 },
+	{ 91 },
+	{ 35 },
+	{ 28 },
+	{ 72 },
+	{ 14 },
+	{ 91 },
+	{ 170 },
+	{ 3 },
+	{ 26 },
+	{ 26 },
+	{ 4 },
+	{ 26 },
+	{ 48 },
+	{ 5 },
+	{ 26 },
+	{ 27 },
+	{ 5 },
+	{ 33 },
+	{ 49 },
+	{ 0 },
+	{ 0 },
+	{ 41 },
+	{ 0 },
+	{ 0 },
+	{ 69 },
+	{ 0 },
+	{ 0 },
+	{ 71 },
+	{ 0 },
+	{ 0 },
+	{ 71 },
+	{ 0 },
+	{ 0 },
+	{ 71 },
+	{ 0 },
+	{ 0 },
+	{ 69 },
+	{ 0 },
+	{ 0 },
+	{ 50 },
+	{ 17 },
+	{ 16 },
+	{ 24 },
+	{ 26 },
+	{ 25 },
+	{ 31 },
+	{ 31 },
+	{ 30 },
+	{ 31 },
+	{ 31 },
+	{ 30 },
+	{ 31 },
+	{ 31 },
+	{ 30 },
+	{ 31 },
+	{ 31 },
+	{ 30 },
+	{ 26 },
+	{ 25 },
+	{ 23 },
+	{ 18 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 4 },
+	{ 2 },
+	{ 2 },
+	{ 46 },
+	{ 50 },
+	{ 44 },
+	{ 5 },
+	{ 18 },
+	{ 17 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 2 },
+	{ 2 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 4 },
+	{ 4 },
+	{ 4 },
+	{ 46 },
+	{ 50 },
+	{ 44 },
+	{ 5 },
+	{ 18 },
+	{ 17 },
+	{ 1 },
+	{ 1 },
+	{ 2 },
+	{ 41 },
+	{ 50 },
+	{ 44 },
+	{ 2 },
+	{ 5 },
+	{ 6 },
+	{ 2 },
+	{ 2 },
+	{ 1 },
+	{ 4 },
+	{ 4 },
+	{ 2 },
+	{ 35 },
+	{ 20 },
+	{ 13 },
+	{ 5 },
+	{ 18 },
+	{ 16 },
+	{ 46 },
+	{ 50 },
+	{ 44 },
+	{ 5 },
+	{ 18 },
+	{ 16 },
+	{ 2 },
+	{ 2 },
+	{ 1 },
+	{ 4 },
+	{ 4 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 46 },
+	{ 50 },
+	{ 44 },
+	{ 5 },
+	{ 18 },
+	{ 16 },
+	{ 2 },
+	{ 2 },
+	{ 1 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 132 },
+	{ 139 },
+	{ 139 },
+	{ 115 },
+	{ 139 },
+	{ 139 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 36 },
+	{ 7 },
+	{ 9 },
+	{ 18 },
+	{ 4 },
+	{ 4 },
+	{ 38 },
+	{ 16 },
+	{ 8 },
+	{ 28 },
+	{ 6 },
+	{ 18 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 104 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 0 },
+	{ 41 },
+	{ 17 },
+	{ 26 },
+	{ 7 },
+	{ 27 },
+	{ 4 },
+	{ 44 },
+	{ 41 },
+	{ 67 },
+	{ 22 },
+	{ 74 },
+	{ 29 },
+	{ 14 },
+	{ 26 },
+	{ 2 },
+	{ 36 },
+	{ 38 },
+	{ 2 },
+	{ 41 },
+	{ 40 },
+	{ 76 },
+	{ 35 },
+	{ 72 },
+	{ 0 },
+	{ 69 },
+	{ 41 },
+	{ 0 },
+	{ 71 },
+	{ 69 },
+	{ 0 },
+	{ 71 },
+	{ 71 },
+	{ 0 },
+	{ 71 },
+	{ 71 },
+	{ 0 },
+	{ 69 },
+	{ 71 },
+	{ 0 },
+	{ 54 },
+	{ 69 },
+	{ 0 },
+	{ 41 },
+	{ 50 },
+	{ 25 },
+	{ 17 },
+	{ 24 },
+	{ 30 },
+	{ 26 },
+	{ 31 },
+	{ 30 },
+	{ 31 },
+	{ 31 },
+	{ 30 },
+	{ 31 },
+	{ 31 },
+	{ 30 },
+	{ 31 },
+	{ 31 },
+	{ 25 },
+	{ 31 },
+	{ 26 },
+	{ 18 },
+	{ 25 },
+	{ 18 },
+	{ 1 },
+	{ 1 },
+	{ 0 },
+	{ 2 },
+	{ 4 },
+	{ 2 },
+	{ 11 },
+	{ 46 },
+	{ 44 },
+	{ 18 },
+	{ 16 },
+	{ 17 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 2 },
+	{ 1 },
+	{ 2 },
+	{ 1 },
+	{ 2 },
+	{ 4 },
+	{ 4 },
+	{ 11 },
+	{ 46 },
+	{ 44 },
+	{ 18 },
+	{ 16 },
+	{ 17 },
+	{ 1 },
+	{ 1 },
+	{ 2 },
+	{ 11 },
+	{ 41 },
+	{ 44 },
+	{ 6 },
+	{ 2 },
+	{ 6 },
+	{ 2 },
+	{ 2 },
+	{ 1 },
+	{ 4 },
+	{ 4 },
+	{ 2 },
+	{ 4 },
+	{ 35 },
+	{ 13 },
+	{ 17 },
+	{ 5 },
+	{ 16 },
+	{ 11 },
+	{ 46 },
+	{ 44 },
+	{ 14 },
+	{ 5 },
+	{ 16 },
+	{ 2 },
+	{ 2 },
+	{ 1 },
+	{ 4 },
+	{ 4 },
+	{ 2 },
+	{ 2 },
+	{ 0 },
+	{ 2 },
+	{ 2 },
+	{ 4 },
+	{ 2 },
+	{ 11 },
+	{ 46 },
+	{ 44 },
+	{ 15 },
+	{ 5 },
+	{ 16 },
+	{ 2 },
+	{ 2 },
+	{ 1 },
+	{ 2 },
+	{ 4 },
+	{ 2 },
+	{ 139 },
+	{ 132 },
+	{ 139 },
+	{ 132 },
+	{ 115 },
+	{ 139 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 38 },
+	{ 36 },
+	{ 9 },
+	{ 10 },
+	{ 18 },
+	{ 4 },
+	{ 90 },
+	{ 38 },
+	{ 8 },
+	{ 6 },
+	{ 3 },
+	{ 18 },
+	{ 0 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 5 },
+	{ 0 },
+	{ 132 },
+	{ 8 },
+	{ 13 },
+	{ 27 },
+	{ 11 },
+	{ 9 },
+	{ 68 },
+	{ 26 },
+	{ 39 },
+	{ 70 },
+	{ 14 },
+	{ 6 },
+	{ 26 },
+	{ 6 },
+	{ 33 },
+	{ 26 },
+	{ 10 },
+	{ 3 },
+	{ 0 },
+	{ 2 },
+	{ 52 },
+	{ 36 },
+	{ 5 },
+	{ 7 },
+	{ 55 },
+	{ 19 },
+	{ 142 },
+	{ 87 },
+	{ 35 },
+	{ 28 },
+	{ 76 },
+	{ 14 },
+	{ 90 },
+	{ 167 },
+	{ 2 },
+	{ 29 },
+	{ 25 },
+	{ 3 },
+	{ 27 },
+	{ 47 },
+	{ 4 },
+	{ 25 },
+	{ 37 },
+	{ 9 },
+	{ 34 },
+	{ 49 },
+	{ 0 },
+	{ 0 },
+	{ 26 },
+	{ 0 },
+	{ 0 },
+	{ 26 },
+	{ 0 },
+	{ 0 },
+	{ 26 },
+	{ 0 },
+	{ 0 },
+	{ 26 },
+	{ 0 },
+	{ 0 },
+	{ 25 },
+	{ 0 },
+	{ 0 },
+	{ 18 },
+	{ 0 },
+	{ 0 },
+	{ 11 },
+	{ 44 },
+	{ 44 },
+	{ 65 },
+	{ 70 },
+	{ 67 },
+	{ 85 },
+	{ 87 },
+	{ 83 },
+	{ 85 },
+	{ 87 },
+	{ 83 },
+	{ 85 },
+	{ 87 },
+	{ 83 },
+	{ 85 },
+	{ 87 },
+	{ 83 },
+	{ 72 },
+	{ 72 },
+	{ 65 },
+	{ 48 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 4 },
+	{ 4 },
+	{ 2 },
+	{ 46 },
+	{ 44 },
+	{ 46 },
+	{ 4 },
+	{ 17 },
+	{ 16 },
+	{ 1 },
+	{ 1 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 2 },
+	{ 4 },
+	{ 4 },
+	{ 4 },
+	{ 41 },
+	{ 44 },
+	{ 46 },
+	{ 4 },
+	{ 17 },
+	{ 16 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 44 },
+	{ 44 },
+	{ 46 },
+	{ 2 },
+	{ 6 },
+	{ 4 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 4 },
+	{ 4 },
+	{ 2 },
+	{ 30 },
+	{ 13 },
+	{ 11 },
+	{ 4 },
+	{ 17 },
+	{ 16 },
+	{ 46 },
+	{ 44 },
+	{ 46 },
+	{ 4 },
+	{ 17 },
+	{ 13 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 4 },
+	{ 4 },
+	{ 2 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 2 },
+	{ 6 },
+	{ 46 },
+	{ 44 },
+	{ 46 },
+	{ 4 },
+	{ 17 },
+	{ 15 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 41 },
+	{ 51 },
+	{ 49 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 30 },
+	{ 6 },
+	{ 9 },
+	{ 19 },
+	{ 5 },
+	{ 5 },
+	{ 38 },
+	{ 11 },
+	{ 93 },
+	{ 27 },
+	{ 6 },
+	{ 4 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 49 },
+	{ 51 },
+	{ 51 },
+	{ 132 },
+	{ 5 },
+	{ 132 },
+	{ 26 },
+	{ 8 },
+	{ 27 },
+	{ 82 },
+	{ 11 },
+	{ 68 },
+	{ 39 },
+	{ 76 },
+	{ 70 },
+	{ 29 },
+	{ 14 },
+	{ 26 },
+	{ 136 },
+	{ 10 },
+	{ 0 },
+	{ 7 },
+	{ 86 },
+	{ 55 },
+	{ 28 },
+	{ 71 },
+	{ 76 },
+	{ 16 },
+	{ 0 },
+	{ 26 },
+	{ 26 },
+	{ 0 },
+	{ 26 },
+	{ 26 },
+	{ 0 },
+	{ 26 },
+	{ 26 },
+	{ 0 },
+	{ 26 },
+	{ 26 },
+	{ 0 },
+	{ 25 },
+	{ 25 },
+	{ 0 },
+	{ 18 },
+	{ 15 },
+	{ 0 },
+	{ 11 },
+	{ 44 },
+	{ 65 },
+	{ 65 },
+	{ 67 },
+	{ 85 },
+	{ 85 },
+	{ 83 },
+	{ 85 },
+	{ 85 },
+	{ 83 },
+	{ 85 },
+	{ 85 },
+	{ 83 },
+	{ 85 },
+	{ 85 },
+	{ 83 },
+	{ 72 },
+	{ 72 },
+	{ 65 },
+	{ 44 },
+	{ 48 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 4 },
+	{ 4 },
+	{ 2 },
+	{ 7 },
+	{ 46 },
+	{ 46 },
+	{ 17 },
+	{ 18 },
+	{ 16 },
+	{ 1 },
+	{ 1 },
+	{ 2 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 2 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 2 },
+	{ 2 },
+	{ 4 },
+	{ 4 },
+	{ 7 },
+	{ 41 },
+	{ 46 },
+	{ 17 },
+	{ 18 },
+	{ 16 },
+	{ 2 },
+	{ 1 },
+	{ 1 },
+	{ 7 },
+	{ 44 },
+	{ 46 },
+	{ 6 },
+	{ 6 },
+	{ 4 },
+	{ 1 },
+	{ 2 },
+	{ 2 },
+	{ 4 },
+	{ 4 },
+	{ 2 },
+	{ 0 },
+	{ 30 },
+	{ 11 },
+	{ 17 },
+	{ 18 },
+	{ 16 },
+	{ 7 },
+	{ 46 },
+	{ 46 },
+	{ 17 },
+	{ 18 },
+	{ 13 },
+	{ 1 },
+	{ 2 },
+	{ 2 },
+	{ 4 },
+	{ 4 },
+	{ 2 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 2 },
+	{ 6 },
+	{ 6 },
+	{ 7 },
+	{ 46 },
+	{ 46 },
+	{ 17 },
+	{ 18 },
+	{ 15 },
+	{ 1 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 4 },
+	{ 2 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 49 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 30 },
+	{ 30 },
+	{ 9 },
+	{ 12 },
+	{ 19 },
+	{ 5 },
+	{ 11 },
+	{ 11 },
+	{ 93 },
+	{ 18 },
+	{ 27 },
+	{ 4 },
+	{ 50 },
+	{ 51 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 26 },
+	{ 39 },
+	{ 51 },
+	{ 43 },
+	{ 7 },
+	{ 0 },
+	{ 79 },
+	{ 9 },
+	{ 14 },
+	{ 27 },
+	{ 9 },
+	{ 11 },
+	{ 63 },
+	{ 24 },
+	{ 37 },
+	{ 74 },
+	{ 2 },
+	{ 17 },
+	{ 70 },
+	{ 6 },
+	{ 26 },
+	{ 26 },
+	{ 10 },
+	{ 3 },
+	{ 115 },
+	{ 8 },
+	{ 139 },
+	{ 87 },
+	{ 8 },
+	{ 15 },
+	{ 137 },
+	{ 7 },
+	{ 19 },
+	{ 33 },
+	{ 14 },
+	{ 10 },
+	{ 24 },
+	{ 5 },
+	{ 32 },
+	{ 60 },
+	{ 5 },
+	{ 10 },
+	{ 22 },
+	{ 0 },
+	{ 25 },
+	{ 44 },
+	{ 3 },
+	{ 26 },
+	{ 24 },
+	{ 14 },
+	{ 85 },
+	{ 25 },
+	{ 0 },
+	{ 0 },
+	{ 26 },
+	{ 0 },
+	{ 0 },
+	{ 26 },
+	{ 0 },
+	{ 0 },
+	{ 26 },
+	{ 0 },
+	{ 0 },
+	{ 26 },
+	{ 0 },
+	{ 0 },
+	{ 25 },
+	{ 0 },
+	{ 0 },
+	{ 18 },
+	{ 0 },
+	{ 0 },
+	{ 11 },
+	{ 48 },
+	{ 45 },
+	{ 67 },
+	{ 71 },
+	{ 67 },
+	{ 84 },
+	{ 87 },
+	{ 82 },
+	{ 84 },
+	{ 87 },
+	{ 82 },
+	{ 84 },
+	{ 87 },
+	{ 82 },
+	{ 84 },
+	{ 87 },
+	{ 82 },
+	{ 71 },
+	{ 71 },
+	{ 69 },
+	{ 43 },
+	{ 0 },
+	{ 4 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 39 },
+	{ 46 },
+	{ 9 },
+	{ 2 },
+	{ 17 },
+	{ 17 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 0 },
+	{ 2 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 39 },
+	{ 46 },
+	{ 9 },
+	{ 2 },
+	{ 17 },
+	{ 17 },
+	{ 0 },
+	{ 2 },
+	{ 2 },
+	{ 33 },
+	{ 44 },
+	{ 9 },
+	{ 0 },
+	{ 4 },
+	{ 6 },
+	{ 0 },
+	{ 2 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 28 },
+	{ 13 },
+	{ 2 },
+	{ 2 },
+	{ 16 },
+	{ 18 },
+	{ 39 },
+	{ 46 },
+	{ 9 },
+	{ 2 },
+	{ 17 },
+	{ 15 },
+	{ 0 },
+	{ 2 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 4 },
+	{ 4 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 39 },
+	{ 46 },
+	{ 9 },
+	{ 2 },
+	{ 17 },
+	{ 16 },
+	{ 0 },
+	{ 2 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 29 },
+	{ 50 },
+	{ 38 },
+	{ 41 },
+	{ 51 },
+	{ 49 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 29 },
+	{ 6 },
+	{ 29 },
+	{ 60 },
+	{ 14 },
+	{ 32 },
+	{ 12 },
+	{ 4 },
+	{ 26 },
+	{ 34 },
+	{ 8 },
+	{ 4 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 51 },
+	{ 50 },
+	{ 26 },
+	{ 51 },
+	{ 51 },
+	{ 43 },
+	{ 17 },
+	{ 7 },
+	{ 79 },
+	{ 26 },
+	{ 9 },
+	{ 27 },
+	{ 71 },
+	{ 9 },
+	{ 64 },
+	{ 67 },
+	{ 24 },
+	{ 74 },
+	{ 76 },
+	{ 2 },
+	{ 70 },
+	{ 127 },
+	{ 10 },
+	{ 114 },
+	{ 107 },
+	{ 8 },
+	{ 137 },
+	{ 28 },
+	{ 14 },
+	{ 24 },
+	{ 16 },
+	{ 0 },
+	{ 26 },
+	{ 26 },
+	{ 0 },
+	{ 26 },
+	{ 26 },
+	{ 0 },
+	{ 26 },
+	{ 26 },
+	{ 0 },
+	{ 26 },
+	{ 26 },
+	{ 0 },
+	{ 25 },
+	{ 25 },
+	{ 0 },
+	{ 18 },
+	{ 15 },
+	{ 0 },
+	{ 11 },
+	{ 45 },
+	{ 67 },
+	{ 67 },
+	{ 67 },
+	{ 84 },
+	{ 84 },
+	{ 82 },
+	{ 84 },
+	{ 84 },
+	{ 82 },
+	{ 84 },
+	{ 84 },
+	{ 82 },
+	{ 84 },
+	{ 84 },
+	{ 82 },
+	{ 71 },
+	{ 71 },
+	{ 69 },
+	{ 45 },
+	{ 43 },
+	{ 2 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 46 },
+	{ 41 },
+	{ 9 },
+	{ 18 },
+	{ 2 },
+	{ 17 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 2 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 46 },
+	{ 41 },
+	{ 9 },
+	{ 18 },
+	{ 2 },
+	{ 17 },
+	{ 7 },
+	{ 0 },
+	{ 2 },
+	{ 44 },
+	{ 41 },
+	{ 9 },
+	{ 4 },
+	{ 6 },
+	{ 6 },
+	{ 2 },
+	{ 0 },
+	{ 2 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 13 },
+	{ 13 },
+	{ 2 },
+	{ 16 },
+	{ 17 },
+	{ 18 },
+	{ 46 },
+	{ 41 },
+	{ 9 },
+	{ 17 },
+	{ 17 },
+	{ 15 },
+	{ 2 },
+	{ 0 },
+	{ 2 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 4 },
+	{ 2 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 46 },
+	{ 41 },
+	{ 9 },
+	{ 17 },
+	{ 17 },
+	{ 16 },
+	{ 2 },
+	{ 0 },
+	{ 2 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 50 },
+	{ 50 },
+	{ 38 },
+	{ 51 },
+	{ 51 },
+	{ 49 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 6 },
+	{ 8 },
+	{ 29 },
+	{ 14 },
+	{ 14 },
+	{ 32 },
+	{ 4 },
+	{ 2 },
+	{ 26 },
+	{ 23 },
+	{ 34 },
+	{ 4 },
+};
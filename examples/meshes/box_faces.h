@@ -0,0 +1,771 @@
+const r3d_face_t faces1[] =
+{ // plane normal[xyz], distance (scaled by 127)
+	{ 0, 0, 127, 62 },
+	{ 0, 0, 127, 62 },
+	{ 0, 0, 127, 62 },
+	{ 0, -41, -120, -38 },
+	{ 127, 0, 0, -53 },
+	{ 50, 0, -117, -32 },
+	{ -127, 0, 0, -54 },
+	{ 0, 127, 0, -51 },
+	{ 99, 80, 0, -9 },
+	{ -51, 0, -116, -32 },
+	{ -102, 75, 0, 13 },
+	{ 0, 41, -120, -38 },
+	{ -99, -80, 0, -10 },
+	{ 0, -127, 0, -51 },
+	{ -98, -81, 0, 9 },
+	{ 102, -75, 0, 13 },
+	{ 98, 81, 0, 9 },
+	{ 102, -76, 0, -13 },
+	{ -102, 76, 0, -13 },
+	{ 0, 0, 127, 58 },
+	{ 0, 0, 127, 58 },
+	{ 0, 0, 127, 58 },
+	{ 0, 0, 127, 58 },
+	{ 0, 0, 127, 58 },
+	{ 0, 0, 127, 58 },
+	{ 0, 0, 127, 58 },
+	{ 0, 0, -127, -55 },
+	{ 0, 0, -127, -55 },
+	{ 0, 0, -127, -55 },
+	{ 0, 0, -127, -55 },
+	{ 0, 0, -127, -55 },
+	{ 0, 0, -127, -55 },
+	{ 0, 0, -127, -55 },
+	{ 0, 127, 0, 51 },
+	{ 0, -127, 0, 51 },
+	{ -127, 0, 0, 7 },
+	{ 127, 0, 0, -8 },
+	{ 0, 127, 0, 51 },
+	{ 0, -127, 0, 51 },
+	{ 127, 0, 0, 53 },
+	{ 0, 127, 0, 51 },
+	{ 0, -127, 0, 51 },
+	{ -127, 0, 0, 23 },
+	{ 127, 0, 0, -24 },
+	{ 0, 127, 0, 51 },
+	{ -127, 0, 0, -39 },
+	{ 127, 0, 0, 38 },
+	{ 0, 127, 0, 51 },
+	{ 0, -127, 0, 51 },
+	{ -127, 0, 0, 38 },
+	{ 127, 0, 0, -39 },
+	{ -127, 0, 0, -23 },
+	{ 127, 0, 0, 22 },
+	{ 0, 127, 0, 51 },
+	{ 0, -127, 0, 51 },
+	{ -127, 0, 0, 53 },
+	{ 0, -127, 0, 51 },
+	{ -127, 0, 0, -8 },
+	{ 127, 0, 0, 7 },
+	{ 0, 127, 0, 51 },
+	{ 0, -127, 0, 51 },
+	{ 0, 0, 127, 62 },
+	{ -9, 8, 126, 62 },
+	{ 9, -8, -126, -58 },
+	{ 89, -90, 12, 13 },
+	{ -89, 90, -12, 1 },
+	{ -77, -101, 0, 65 },
+	{ 77, 101, 0, 65 },
+	{ 0, 0, 127, 62 },
+	{ 0, 0, 127, 62 },
+	{ 0, 0, 127, 62 },
+	{ 0, -41, -120, -38 },
+	{ 127, 0, 0, -53 },
+	{ 51, 0, -116, -32 },
+	{ -127, 0, 0, -54 },
+	{ 0, 127, 0, -51 },
+	{ -50, 0, -117, -32 },
+	{ 0, 41, -120, -38 },
+	{ 0, -127, 0, -51 },
+	{ 0, 0, 127, 58 },
+	{ 0, 0, 127, 58 },
+	{ 0, 0, 127, 58 },
+	{ 0, 0, 127, 58 },
+	{ 0, 0, 127, 58 },
+	{ 0, 0, 127, 58 },
+	{ 0, 0, 127, 58 },
+	{ 0, 0, -127, -55 },
+	{ 0, 0, -127, -55 },
+	{ 0, 0, -127, -55 },
+	{ 0, 0, -127, -55 },
+	{ 0, 0, -127, -55 },
+	{ 0, 0, -127, -55 },
+	{ 0, 0, -127, -55 },
+	{ 0, 127, 0, 51 },
+	{ 0, -127, 0, 51 },
+	{ -127, 0, 0, 7 },
+	{ 127, 0, 0, -8 },
+	{ 0, 127, 0, 51 },
+	{ 0, -127, 0, 51 },
+	{ 127, 0, 0, 53 },
+	{ 0, 127, 0, 51 },
+	{ 0, -127, 0, 51 },
+	{ -127, 0, 0, 23 },
+	{ 127, 0, 0, -24 },
+	{ 0, 127, 0, 51 },
+	{ -127, 0, 0, -39 },
+	{ 127, 0, 0, 38 },
+	{ 0, 127, 0, 51 },
+	{ 0, -127, 0, 51 },
+	{ -127, 0, 0, 38 },
+	{ 127, 0, 0, -39 },
+	{ -127, 0, 0, -23 },
+	{ 127, 0, 0, 22 },
+	{ 0, 127, 0, 51 },
+	{ 0, -127, 0, 51 },
+	{ -127, 0, 0, 53 },
+	{ 0, -127, 0, 51 },
+	{ -127, 0, 0, -8 },
+	{ 127, 0, 0, 7 },
+	{ 0, 127, 0, 51 },
+	{ 0, -127, 0, 51 },
+	{ 0, 0, 127, 62 },
+	{ -9, 8, 126, 62 },
+	{ 9, -8, -126, -58 },
+	{ 89, -90, 12, 13 },
+	{ -89, 90, -12, 1 },
+	{ -77, -101, 0, 65 },
+	{ 77, 101, 0, 65 },
+	{ 0, 0, -127, 62 },
+	{ 0, 0, -127, 62 },
+	{ 0, 0, -127, 62 },
+	{ 0, -41, 120, -38 },
+	{ -127, 0, 0, -54 },
+	{ -51, 0, 116, -32 },
+	{ 127, 0, 0, -53 },
+	{ 0, 127, 0, -51 },
+	{ -99, 80, 0, -10 },
+	{ 50, 0, 117, -32 },
+	{ 102, 75, 0, 14 },
+	{ 0, 41, 120, -38 },
+	{ 99, -80, 0, -9 },
+	{ 0, -127, 0, -51 },
+	{ 98, -81, 0, 9 },
+	{ -102, -75, 0, 12 },
+	{ -98, 81, 0, 8 },
+	{ -102, -76, 0, -13 },
+	{ 102, 76, 0, -12 },
+	{ 0, 0, -127, 58 },
+	{ 0, 0, -127, 58 },
+	{ 0, 0, -127, 58 },
+	{ 0, 0, -127, 58 },
+	{ 0, 0, -127, 58 },
+	{ 0, 0, -127, 58 },
+	{ 0, 0, -127, 58 },
+	{ 0, 0, 127, -55 },
+	{ 0, 0, 127, -55 },
+	{ 0, 0, 127, -55 },
+	{ 0, 0, 127, -55 },
+	{ 0, 0, 127, -55 },
+	{ 0, 0, 127, -55 },
+	{ 0, 0, 127, -55 },
+	{ 0, 127, 0, 51 },
+	{ 0, -127, 0, 51 },
+	{ 127, 0, 0, 8 },
+	{ -127, 0, 0, -9 },
+	{ 0, 127, 0, 51 },
+	{ 0, -127, 0, 51 },
+	{ -127, 0, 0, 52 },
+	{ 0, 127, 0, 51 },
+	{ 0, -127, 0, 51 },
+	{ 127, 0, 0, 24 },
+	{ -127, 0, 0, -25 },
+	{ 0, 127, 0, 51 },
+	{ 127, 0, 0, -38 },
+	{ -127, 0, 0, 37 },
+	{ 0, 127, 0, 51 },
+	{ 0, -127, 0, 51 },
+	{ 127, 0, 0, 39 },
+	{ -127, 0, 0, -40 },
+	{ 127, 0, 0, -22 },
+	{ -127, 0, 0, 21 },
+	{ 0, 127, 0, 51 },
+	{ 0, -127, 0, 51 },
+	{ 127, 0, 0, 54 },
+	{ 0, -127, 0, 51 },
+	{ 127, 0, 0, -7 },
+	{ -127, 0, 0, 6 },
+	{ 0, 127, 0, 51 },
+	{ 0, -127, 0, 51 },
+	{ 0, 0, -127, 62 },
+	{ 9, 8, -126, 62 },
+	{ -9, -8, 126, -59 },
+	{ -89, -90, -12, 12 },
+	{ 89, 90, 12, 2 },
+	{ 77, -101, 0, 66 },
+	{ -77, 101, 0, 65 },
+	{ 0, 0, -127, 62 },
+	{ 0, 0, -127, 62 },
+	{ 0, 0, -127, 62 },
+	{ 0, -41, 120, -38 },
+	{ -127, 0, 0, -54 },
+	{ -50, 0, 117, -33 },
+	{ 127, 0, 0, -53 },
+	{ 0, 127, 0, -51 },
+	{ 51, 0, 116, -31 },
+	{ 0, 41, 120, -38 },
+	{ 0, -127, 0, -51 },
+	{ 0, 0, -127, 58 },
+	{ 0, 0, -127, 58 },
+	{ 0, 0, -127, 58 },
+	{ 0, 0, -127, 58 },
+	{ 0, 0, -127, 58 },
+	{ 0, 0, -127, 58 },
+	{ 0, 0, -127, 58 },
+	{ 0, 0, 127, -55 },
+	{ 0, 0, 127, -55 },
+	{ 0, 0, 127, -55 },
+	{ 0, 0, 127, -55 },
+	{ 0, 0, 127, -55 },
+	{ 0, 0, 127, -55 },
+	{ 0, 0, 127, -55 },
+	{ 0, 127, 0, 51 },
+	{ 0, -127, 0, 51 },
+	{ 127, 0, 0, 8 },
+	{ -127, 0, 0, -9 },
+	{ 0, 127, 0, 51 },
+	{ 0, -127, 0, 51 },
+	{ -127, 0, 0, 52 },
+	{ 0, 127, 0, 51 },
+	{ 0, -127, 0, 51 },
+	{ 127, 0, 0, 24 },
+	{ -127, 0, 0, -25 },
+	{ 0, 127, 0, 51 },
+	{ 127, 0, 0, -38 },
+	{ -127, 0, 0, 37 },
+	{ 0, 127, 0, 51 },
+	{ 0, -127, 0, 51 },
+	{ 127, 0, 0, 39 },
+	{ -127, 0, 0, -40 },
+	{ 127, 0, 0, -22 },
+	{ -127, 0, 0, 21 },
+	{ 0, 127, 0, 51 },
+	{ 0, -127, 0, 51 },
+	{ 127, 0, 0, 54 },
+	{ 0, -127, 0, 51 },
+	{ 127, 0, 0, -7 },
+	{ -127, 0, 0, 6 },
+	{ 0, 127, 0, 51 },
+	{ 0, -127, 0, 51 },
+	{ 0, 0, -127, 62 },
+	{ 9, 8, -126, 62 },
+	{ -9, -8, 126, -59 },
+	{ -89, -90, -12, 12 },
+	{ 89, 90, 12, 2 },
+	{ 77, -101, 0, 66 },
+	{ -77, 101, 0, 65 },
+	{ 0, 127, 0, 62 },
+	{ 0, 127, 0, 62 },
+	{ 0, 127, 0, 62 },
+	{ 41, -120, 0, -39 },
+	{ 0, 0, -127, -54 },
+	{ 0, -116, -51, -32 },
+	{ 0, 0, 127, -53 },
+	{ -127, 0, 0, -51 },
+	{ -80, 0, -99, -10 },
+	{ 0, -117, 50, -33 },
+	{ -75, 0, 102, 13 },
+	{ -41, -120, 0, -39 },
+	{ 80, 0, 99, -9 },
+	{ 127, 0, 0, -51 },
+	{ 81, 0, 98, 9 },
+	{ 75, 0, -102, 12 },
+	{ -81, 0, -98, 8 },
+	{ 76, 0, -102, -13 },
+	{ -76, 0, 102, -13 },
+	{ 0, 127, 0, 59 },
+	{ 0, 127, 0, 59 },
+	{ 0, 127, 0, 59 },
+	{ 0, 127, 0, 59 },
+	{ 0, 127, 0, 59 },
+	{ 0, 127, 0, 59 },
+	{ 0, 127, 0, 59 },
+	{ 0, -127, 0, -55 },
+	{ 0, -127, 0, -55 },
+	{ 0, -127, 0, -55 },
+	{ 0, -127, 0, -55 },
+	{ 0, -127, 0, -55 },
+	{ 0, -127, 0, -55 },
+	{ 0, -127, 0, -55 },
+	{ -127, 0, 0, 51 },
+	{ 127, 0, 0, 52 },
+	{ 0, 0, 127, 8 },
+	{ 0, 0, -127, -9 },
+	{ -127, 0, 0, 51 },
+	{ 127, 0, 0, 52 },
+	{ 0, 0, -127, 53 },
+	{ -127, 0, 0, 51 },
+	{ 127, 0, 0, 52 },
+	{ 0, 0, 127, 23 },
+	{ 0, 0, -127, -24 },
+	{ -127, 0, 0, 51 },
+	{ 0, 0, 127, -38 },
+	{ 0, 0, -127, 37 },
+	{ -127, 0, 0, 51 },
+	{ 127, 0, 0, 52 },
+	{ 0, 0, 127, 38 },
+	{ 0, 0, -127, -39 },
+	{ 0, 0, 127, -23 },
+	{ 0, 0, -127, 22 },
+	{ -127, 0, 0, 51 },
+	{ 127, 0, 0, 52 },
+	{ 0, 0, 127, 54 },
+	{ 127, 0, 0, 52 },
+	{ 0, 0, 127, -8 },
+	{ 0, 0, -127, 7 },
+	{ -127, 0, 0, 51 },
+	{ 127, 0, 0, 52 },
+	{ 0, 127, 0, 62 },
+	{ -8, 126, 9, 62 },
+	{ 8, -126, -9, -59 },
+	{ 90, 12, -89, 13 },
+	{ -90, -12, 89, 2 },
+	{ 101, 0, 77, 66 },
+	{ -101, 0, -77, 65 },
+	{ 0, 127, 0, 62 },
+	{ 0, 127, 0, 62 },
+	{ 0, 127, 0, 62 },
+	{ 41, -120, 0, -39 },
+	{ 0, 0, -127, -54 },
+	{ 0, -117, -50, -33 },
+	{ 0, 0, 127, -53 },
+	{ -127, 0, 0, -51 },
+	{ 0, -116, 51, -32 },
+	{ -41, -120, 0, -39 },
+	{ 127, 0, 0, -51 },
+	{ 0, 127, 0, 59 },
+	{ 0, 127, 0, 59 },
+	{ 0, 127, 0, 59 },
+	{ 0, 127, 0, 59 },
+	{ 0, 127, 0, 59 },
+	{ 0, 127, 0, 59 },
+	{ 0, 127, 0, 59 },
+	{ 0, -127, 0, -55 },
+	{ 0, -127, 0, -55 },
+	{ 0, -127, 0, -55 },
+	{ 0, -127, 0, -55 },
+	{ 0, -127, 0, -55 },
+	{ 0, -127, 0, -55 },
+	{ 0, -127, 0, -55 },
+	{ -127, 0, 0, 51 },
+	{ 127, 0, 0, 52 },
+	{ 0, 0, 127, 8 },
+	{ 0, 0, -127, -9 },
+	{ -127, 0, 0, 51 },
+	{ 127, 0, 0, 52 },
+	{ 0, 0, -127, 53 },
+	{ -127, 0, 0, 51 },
+	{ 127, 0, 0, 52 },
+	{ 0, 0, 127, 23 },
+	{ 0, 0, -127, -24 },
+	{ -127, 0, 0, 51 },
+	{ 0, 0, 127, -38 },
+	{ 0, 0, -127, 37 },
+	{ -127, 0, 0, 51 },
+	{ 127, 0, 0, 52 },
+	{ 0, 0, 127, 38 },
+	{ 0, 0, -127, -39 },
+	{ 0, 0, 127, -23 },
+	{ 0, 0, -127, 22 },
+	{ -127, 0, 0, 51 },
+	{ 127, 0, 0, 52 },
+	{ 0, 0, 127, 54 },
+	{ 127, 0, 0, 52 },
+	{ 0, 0, 127, -8 },
+	{ 0, 0, -127, 7 },
+	{ -127, 0, 0, 51 },
+	{ 127, 0, 0, 52 },
+	{ 0, 127, 0, 62 },
+	{ -8, 126, 9, 62 },
+	{ 8, -126, -9, -59 },
+	{ 90, 12, -89, 13 },
+	{ -90, -12, 89, 2 },
+	{ 101, 0, 77, 66 },
+	{ -101, 0, -77, 65 },
+	{ -127, 0, 0, 62 },
+	{ -127, 0, 0, 62 },
+	{ -127, 0, 0, 62 },
+	{ 120, 41, 0, -39 },
+	{ 0, 0, -127, -54 },
+	{ 117, 0, -50, -33 },
+	{ 0, 0, 127, -53 },
+	{ 0, -127, 0, -51 },
+	{ 0, -80, -99, -10 },
+	{ 117, 0, 50, -33 },
+	{ 0, -75, 102, 13 },
+	{ 120, -41, 0, -39 },
+	{ 0, 80, 99, -9 },
+	{ 0, 127, 0, -51 },
+	{ 0, 81, 98, 9 },
+	{ 0, 75, -102, 12 },
+	{ 0, -81, -98, 8 },
+	{ 0, 76, -102, -13 },
+	{ 0, -76, 102, -12 },
+	{ -127, 0, 0, 58 },
+	{ -127, 0, 0, 58 },
+	{ -127, 0, 0, 58 },
+	{ -127, 0, 0, 58 },
+	{ -127, 0, 0, 58 },
+	{ -127, 0, 0, 58 },
+	{ -127, 0, 0, 58 },
+	{ 127, 0, 0, -55 },
+	{ 127, 0, 0, -55 },
+	{ 127, 0, 0, -55 },
+	{ 127, 0, 0, -55 },
+	{ 127, 0, 0, -55 },
+	{ 127, 0, 0, -55 },
+	{ 127, 0, 0, -55 },
+	{ 0, -127, 0, 51 },
+	{ 0, 127, 0, 51 },
+	{ 0, 0, 127, 8 },
+	{ 0, 0, -127, -9 },
+	{ 0, -127, 0, 51 },
+	{ 0, 127, 0, 51 },
+	{ 0, 0, -127, 53 },
+	{ 0, -127, 0, 51 },
+	{ 0, 127, 0, 51 },
+	{ 0, 0, 127, 23 },
+	{ 0, 0, -127, -24 },
+	{ 0, -127, 0, 51 },
+	{ 0, 0, 127, -38 },
+	{ 0, 0, -127, 37 },
+	{ 0, -127, 0, 51 },
+	{ 0, 127, 0, 51 },
+	{ 0, 0, 127, 38 },
+	{ 0, 0, -127, -39 },
+	{ 0, 0, 127, -23 },
+	{ 0, 0, -127, 22 },
+	{ 0, -127, 0, 51 },
+	{ 0, 127, 0, 51 },
+	{ 0, 0, 127, 54 },
+	{ 0, 127, 0, 51 },
+	{ 0, 0, 127, -8 },
+	{ 0, 0, -127, 7 },
+	{ 0, -127, 0, 51 },
+	{ 0, 127, 0, 51 },
+	{ -127, 0, 0, 62 },
+	{ -126, -8, 9, 62 },
+	{ 126, 8, -9, -59 },
+	{ -12, 90, -89, 12 },
+	{ 12, -90, 89, 2 },
+	{ 0, 101, 77, 65 },
+	{ 0, -101, -77, 65 },
+	{ -127, 0, 0, 62 },
+	{ -127, 0, 0, 62 },
+	{ -127, 0, 0, 62 },
+	{ 120, 41, 0, -39 },
+	{ 0, 0, -127, -54 },
+	{ 116, 0, -51, -32 },
+	{ 0, 0, 127, -53 },
+	{ 0, -127, 0, -51 },
+	{ 116, 0, 51, -32 },
+	{ 120, -41, 0, -39 },
+	{ 0, 127, 0, -51 },
+	{ -127, 0, 0, 58 },
+	{ -127, 0, 0, 58 },
+	{ -127, 0, 0, 58 },
+	{ -127, 0, 0, 58 },
+	{ -127, 0, 0, 58 },
+	{ -127, 0, 0, 58 },
+	{ -127, 0, 0, 58 },
+	{ 127, 0, 0, -55 },
+	{ 127, 0, 0, -55 },
+	{ 127, 0, 0, -55 },
+	{ 127, 0, 0, -55 },
+	{ 127, 0, 0, -55 },
+	{ 127, 0, 0, -55 },
+	{ 127, 0, 0, -55 },
+	{ 0, -127, 0, 51 },
+	{ 0, 127, 0, 51 },
+	{ 0, 0, 127, 8 },
+	{ 0, 0, -127, -9 },
+	{ 0, -127, 0, 51 },
+	{ 0, 127, 0, 51 },
+	{ 0, 0, -127, 53 },
+	{ 0, -127, 0, 51 },
+	{ 0, 127, 0, 51 },
+	{ 0, 0, 127, 23 },
+	{ 0, 0, -127, -24 },
+	{ 0, -127, 0, 51 },
+	{ 0, 0, 127, -38 },
+	{ 0, 0, -127, 37 },
+	{ 0, -127, 0, 51 },
+	{ 0, 127, 0, 51 },
+	{ 0, 0, 127, 38 },
+	{ 0, 0, -127, -39 },
+	{ 0, 0, 127, -23 },
+	{ 0, 0, -127, 22 },
+	{ 0, -127, 0, 51 },
+	{ 0, 127, 0, 51 },
+	{ 0, 0, 127, 54 },
+	{ 0, 127, 0, 51 },
+	{ 0, 0, 127, -8 },
+	{ 0, 0, -127, 7 },
+	{ 0, -127, 0, 51 },
+	{ 0, 127, 0, 51 },
+	{ -127, 0, 0, 62 },
+	{ -126, -8, 9, 62 },
+	{ 126, 8, -9, -59 },
+	{ -12, 90, -89, 12 },
+	{ 12, -90, 89, 2 },
+	{ 0, 101, 77, 65 },
+	{ 0, -101, -77, 65 },
+	{ 0, -127, 0, 62 },
+	{ 0, -127, 0, 62 },
+	{ 0, -127, 0, 62 },
+	{ -41, 120, 0, -39 },
+	{ 0, 0, -127, -54 },
+	{ 0, 116, -51, -32 },
+	{ 0, 0, 127, -53 },
+	{ 127, 0, 0, -51 },
+	{ 80, 0, -99, -10 },
+	{ 0, 116, 51, -32 },
+	{ 75, 0, 102, 13 },
+	{ 41, 120, 0, -39 },
+	{ -80, 0, 99, -9 },
+	{ -127, 0, 0, -51 },
+	{ -81, 0, 98, 9 },
+	{ -75, 0, -102, 12 },
+	{ 81, 0, -98, 8 },
+	{ -76, 0, -102, -13 },
+	{ 76, 0, 102, -13 },
+	{ 0, -127, 0, 59 },
+	{ 0, -127, 0, 59 },
+	{ 0, -127, 0, 59 },
+	{ 0, -127, 0, 59 },
+	{ 0, -127, 0, 59 },
+	{ 0, -127, 0, 59 },
+	{ 0, -127, 0, 59 },
+	{ 0, 127, 0, -55 },
+	{ 0, 127, 0, -55 },
+	{ 0, 127, 0, -55 },
+	{ 0, 127, 0, -55 },
+	{ 0, 127, 0, -55 },
+	{ 0, 127, 0, -55 },
+	{ 0, 127, 0, -55 },
+	{ 127, 0, 0, 51 },
+	{ -127, 0, 0, 52 },
+	{ 0, 0, 127, 8 },
+	{ 0, 0, -127, -9 },
+	{ 127, 0, 0, 51 },
+	{ -127, 0, 0, 52 },
+	{ 0, 0, -127, 53 },
+	{ 127, 0, 0, 51 },
+	{ -127, 0, 0, 52 },
+	{ 0, 0, 127, 23 },
+	{ 0, 0, -127, -24 },
+	{ 127, 0, 0, 51 },
+	{ 0, 0, 127, -38 },
+	{ 0, 0, -127, 37 },
+	{ 127, 0, 0, 51 },
+	{ -127, 0, 0, 52 },
+	{ 0, 0, 127, 38 },
+	{ 0, 0, -127, -39 },
+	{ 0, 0, 127, -23 },
+	{ 0, 0, -127, 22 },
+	{ 127, 0, 0, 51 },
+	{ -127, 0, 0, 52 },
+	{ 0, 0, 127, 54 },
+	{ -127, 0, 0, 52 },
+	{ 0, 0, 127, -8 },
+	{ 0, 0, -127, 7 },
+	{ 127, 0, 0, 51 },
+	{ -127, 0, 0, 52 },
+	{ 0, -127, 0, 62 },
+	{ 8, -126, 9, 62 },
+	{ -8, 126, -9, -59 },
+	{ -90, -12, -89, 13 },
+	{ 90, 12, 89, 2 },
+	{ -101, 0, 77, 65 },
+	{ 101, 0, -77, 65 },
+	{ 0, -127, 0, 62 },
+	{ 0, -127, 0, 62 },
+	{ 0, -127, 0, 62 },
+	{ -41, 120, 0, -39 },
+	{ 0, 0, -127, -54 },
+	{ 0, 117, -50, -33 },
+	{ 0, 0, 127, -53 },
+	{ 127, 0, 0, -51 },
+	{ 0, 117, 50, -33 },
+	{ 41, 120, 0, -39 },
+	{ -127, 0, 0, -51 },
+	{ 0, -127, 0, 59 },
+	{ 0, -127, 0, 59 },
+	{ 0, -127, 0, 59 },
+	{ 0, -127, 0, 59 },
+	{ 0, -127, 0, 59 },
+	{ 0, -127, 0, 59 },
+	{ 0, -127, 0, 59 },
+	{ 0, 127, 0, -55 },
+	{ 0, 127, 0, -55 },
+	{ 0, 127, 0, -55 },
+	{ 0, 127, 0, -55 },
+	{ 0, 127, 0, -55 },
+	{ 0, 127, 0, -55 },
+	{ 0, 127, 0, -55 },
+	{ 127, 0, 0, 51 },
+	{ -127, 0, 0, 52 },
+	{ 0, 0, 127, 8 },
+	{ 0, 0, -127, -9 },
+	{ 127, 0, 0, 51 },
+	{ -127, 0, 0, 52 },
+	{ 0, 0, -127, 53 },
+	{ 127, 0, 0, 51 },
+	{ -127, 0, 0, 52 },
+	{ 0, 0, 127, 23 },
+	{ 0, 0, -127, -24 },
+	{ 127, 0, 0, 51 },
+	{ 0, 0, 127, -38 },
+	{ 0, 0, -127, 37 },
+	{ 127, 0, 0, 51 },
+	{ -127, 0, 0, 52 },
+	{ 0, 0, 127, 38 },
+	{ 0, 0, -127, -39 },
+	{ 0, 0, 127, -23 },
+	{ 0, 0, -127, 22 },
+	{ 127, 0, 0, 51 },
+	{ -127, 0, 0, 52 },
+	{ 0, 0, 127, 54 },
+	{ -127, 0, 0, 52 },
+	{ 0, 0, 127, -8 },
+	{ 0, 0, -127, 7 },
+	{ 127, 0, 0, 51 },
+	{ -127, 0, 0, 52 },
+	{ 0, -127, 0, 62 },
+	{ 8, -126, 9, 62 },
+	{ -8, 126, -9, -59 },
+	{ -90, -12, -89, 13 },
+	{ 90, 12, 89, 2 },
+	{ -101, 0, 77, 65 },
+	{ 101, 0, -77, 65 },
+	{ 127, 0, 0, 62 },
+	{ 127, 0, 0, 62 },
+	{ 127, 0, 0, 62 },
+	{ -120, -41, 0, -39 },
+	{ 0, 0, -127, -54 },
+	{ -116, 0, -51, -32 },
+	{ 0, 0, 127, -53 },
+	{ 0, 127, 0, -51 },
+	{ 0, 80, -99, -10 },
+	{ -116, 0, 51, -32 },
+	{ 0, 75, 102, 13 },
+	{ -120, 41, 0, -39 },
+	{ 0, -80, 99, -9 },
+	{ 0, -127, 0, -51 },
+	{ 0, -81, 98, 9 },
+	{ 0, -75, -102, 12 },
+	{ 0, 81, -98, 8 },
+	{ 0, -76, -102, -13 },
+	{ 0, 76, 102, -12 },
+	{ 127, 0, 0, 58 },
+	{ 127, 0, 0, 58 },
+	{ 127, 0, 0, 58 },
+	{ 127, 0, 0, 58 },
+	{ 127, 0, 0, 58 },
+	{ 127, 0, 0, 58 },
+	{ 127, 0, 0, 58 },
+	{ -127, 0, 0, -55 },
+	{ -127, 0, 0, -55 },
+	{ -127, 0, 0, -55 },
+	{ -127, 0, 0, -55 },
+	{ -127, 0, 0, -55 },
+	{ -127, 0, 0, -55 },
+	{ -127, 0, 0, -55 },
+	{ 0, 127, 0, 51 },
+	{ 0, -127, 0, 51 },
+	{ 0, 0, 127, 8 },
+	{ 0, 0, -127, -9 },
+	{ 0, 127, 0, 51 },
+	{ 0, -127, 0, 51 },
+	{ 0, 0, -127, 53 },
+	{ 0, 127, 0, 51 },
+	{ 0, -127, 0, 51 },
+	{ 0, 0, 127, 23 },
+	{ 0, 0, -127, -24 },
+	{ 0, 127, 0, 51 },
+	{ 0, 0, 127, -38 },
+	{ 0, 0, -127, 37 },
+	{ 0, 127, 0, 51 },
+	{ 0, -127, 0, 51 },
+	{ 0, 0, 127, 38 },
+	{ 0, 0, -127, -39 },
+	{ 0, 0, 127, -23 },
+	{ 0, 0, -127, 22 },
+	{ 0, 127, 0, 51 },
+	{ 0, -127, 0, 51 },
+	{ 0, 0, 127, 54 },
+	{ 0, -127, 0, 51 },
+	{ 0, 0, 127, -8 },
+	{ 0, 0, -127, 7 },
+	{ 0, 127, 0, 51 },
+	{ 0, -127, 0, 51 },
+	{ 127, 0, 0, 62 },
+	{ 126, 8, 9, 62 },
+	{ -126, -8, -9, -59 },
+	{ 12, -90, -89, 12 },
+	{ -12, 90, 89, 2 },
+	{ 0, -101, 77, 65 },
+	{ 0, 101, -77, 65 },
+	{ 127, 0, 0, 62 },
+	{ 127, 0, 0, 62 },
+	{ 127, 0, 0, 62 },
+	{ -120, -41, 0, -39 },
+	{ 0, 0, -127, -54 },
+	{ -117, 0, -50, -33 },
+	{ 0, 0, 127, -53 },
+	{ 0, 127, 0, -51 },
+	{ -117, 0, 50, -32 },
+	{ -120, 41, 0, -39 },
+	{ 0, -127, 0, -51 },
+	{ 127, 0, 0, 58 },
+	{ 127, 0, 0, 58 },
+	{ 127, 0, 0, 58 },
+	{ 127, 0, 0, 58 },
+	{ 127, 0, 0, 58 },
+	{ 127, 0, 0, 58 },
+	{ 127, 0, 0, 58 },
+	{ -127, 0, 0, -55 },
+	{ -127, 0, 0, -55 },
+	{ -127, 0, 0, -55 },
+	{ -127, 0, 0, -55 },
+	{ -127, 0, 0, -55 },
+	{ -127, 0, 0, -55 },
+	{ -127, 0, 0, -55 },
+	{ 0, 127, 0, 51 },
+	{ 0, -127, 0, 51 },
+	{ 0, 0, 127, 8 },
+	{ 0, 0, -127, -9 },
+	{ 0, 127, 0, 51 },
+	{ 0, -127, 0, 51 },
+	{ 0, 0, -127, 53 },
+	{ 0, 127, 0, 51 },
+	{ 0, -127, 0, 51 },
+	{ 0, 0, 127, 23 },
+	{ 0, 0, -127, -24 },
+	{ 0, 127, 0, 51 },
+	{ 0, 0, 127, -38 },
+	{ 0, 0, -127, 37 },
+	{ 0, 127, 0, 51 },
+	{ 0, -127, 0, 51 },
+	{ 0, 0, 127, 38 },
+	{ 0, 0, -127, -39 },
+	{ 0, 0, 127, -23 },
+	{ 0, 0, -127, 22 },
+	{ 0, 127, 0, 51 },
+	{ 0, -127, 0, 51 },
+	{ 0, 0, 127, 54 },
+	{ 0, -127, 0, 51 },
+	{ 0, 0, 127, -8 },
+	{ 0, 0, -127, 7 },
+	{ 0, 127, 0, 51 },
+	{ 0, -127, 0, 51 },
+	{ 127, 0, 0, 62 },
+	{ 126, 8, 9, 62 },
+	{ -126, -8, -9, -59 },
+	{ 12, -90, -89, 12 },
+	{ -12, 90, 89, 2 },
+	{ 0, -101, 77, 65 },
+	{ 0, 101, -77, 65 },
+};
@@ -0,0 +1,20439 @@
+const vertex_baked_t baked2[] =
+{ // ambient occlusion * (ambient + diffuse)
+	{ 0 },
+	{ 0 },
+	{ 10 },
+	{ 0 },
+	{ 0 },
+	{ 10 },
+	{ 10 },
+	{ 9 },
+	{ 14 },
+	{ 10 },
+	{ 10 },
+	{ 11 },
+	{ 7 },
+	{ 11 },
+	{ 0 },
+	{ 11 },
+	{ 14 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 4 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 5 },
+	{ 3 },
+	{ 0 },
+	{ 3 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 5 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 5 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 3 },
+	{ 5 },
+	{ 0 },
+	{ 1 },
+	{ 4 },
+	{ 0 },
+	{ 4 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 3 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 5 },
+	{ 0 },
+	{ 0 },
+	{ 5 },
+	{ 0 },
+	{ 12 },
+	{ 0 },
+	{ 4 },
+	{ 0 },
+	{ 4 },
+	{ 0 },
+	{ 9 },
+	{ 2 },
+	{ 5 },
+	{ 4 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 12 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 10 },
+	{ 12 },
+	{ 0 },
+	{ 9 },
+	{ 9 },
+	{ 9 },
+	{ 12 },
+	{ 9 },
+	{ 4 },
+	{ 12 },
+	{ 7 },
+	{ 0 },
+	{ 4 },
+	{ 0 },
+	{ 12 },
+	{ 0 },
+	{ 14 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 3 },
+	{ 0 },
+	{ 0 },
+	{ 5 },
+	{ 0 },
+	{ 0 },
+	{ 5 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 4 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 5 },
+	{ 5 },
+	{ 0 },
+	{ 0 },
+	{ 4 },
+	{ 0 },
+	{ 0 },
+	{ 5 },
+	{ 5 },
+	{ 0 },
+	{ 5 },
+	{ 0 },
+	{ 0 },
+	{ 4 },
+	{ 0 },
+	{ 0 },
+	{ 5 },
+	{ 0 },
+	{ 0 },
+	{ 3 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 5 },
+	{ 5 },
+	{ 7 },
+	{ 5 },
+	{ 3 },
+	{ 7 },
+	{ 2 },
+	{ 2 },
+	{ 7 },
+	{ 6 },
+	{ 6 },
+	{ 5 },
+	{ 6 },
+	{ 2 },
+	{ 4 },
+	{ 4 },
+	{ 4 },
+	{ 6 },
+	{ 5 },
+	{ 5 },
+	{ 4 },
+	{ 4 },
+	{ 6 },
+	{ 6 },
+	{ 4 },
+	{ 5 },
+	{ 5 },
+	{ 5 },
+	{ 5 },
+	{ 4 },
+	{ 4 },
+	{ 4 },
+	{ 5 },
+	{ 6 },
+	{ 6 },
+	{ 4 },
+	{ 6 },
+	{ 4 },
+	{ 2 },
+	{ 2 },
+	{ 3 },
+	{ 2 },
+	{ 2 },
+	{ 5 },
+	{ 5 },
+	{ 5 },
+	{ 6 },
+	{ 3 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 5 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 5 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 49 },
+	{ 26 },
+	{ 23 },
+	{ 17 },
+	{ 26 },
+	{ 33 },
+	{ 14 },
+	{ 17 },
+	{ 23 },
+	{ 0 },
+	{ 14 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 32 },
+	{ 0 },
+	{ 0 },
+	{ 85 },
+	{ 32 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 31 },
+	{ 23 },
+	{ 32 },
+	{ 60 },
+	{ 31 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 25 },
+	{ 0 },
+	{ 25 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 67 },
+	{ 94 },
+	{ 0 },
+	{ 38 },
+	{ 0 },
+	{ 38 },
+	{ 94 },
+	{ 82 },
+	{ 1 },
+	{ 2 },
+	{ 2 },
+	{ 1 },
+	{ 2 },
+	{ 1 },
+	{ 1 },
+	{ 2 },
+	{ 0 },
+	{ 2 },
+	{ 15 },
+	{ 0 },
+	{ 2 },
+	{ 22 },
+	{ 2 },
+	{ 2 },
+	{ 23 },
+	{ 2 },
+	{ 0 },
+	{ 18 },
+	{ 25 },
+	{ 25 },
+	{ 60 },
+	{ 67 },
+	{ 60 },
+	{ 85 },
+	{ 96 },
+	{ 23 },
+	{ 33 },
+	{ 105 },
+	{ 18 },
+	{ 23 },
+	{ 60 },
+	{ 49 },
+	{ 105 },
+	{ 33 },
+	{ 85 },
+	{ 105 },
+	{ 148 },
+	{ 138 },
+	{ 148 },
+	{ 169 },
+	{ 49 },
+	{ 169 },
+	{ 148 },
+	{ 67 },
+	{ 96 },
+	{ 94 },
+	{ 127 },
+	{ 161 },
+	{ 170 },
+	{ 155 },
+	{ 170 },
+	{ 136 },
+	{ 119 },
+	{ 155 },
+	{ 85 },
+	{ 85 },
+	{ 117 },
+	{ 32 },
+	{ 117 },
+	{ 136 },
+	{ 60 },
+	{ 94 },
+	{ 127 },
+	{ 155 },
+	{ 170 },
+	{ 167 },
+	{ 136 },
+	{ 161 },
+	{ 169 },
+	{ 167 },
+	{ 49 },
+	{ 133 },
+	{ 167 },
+	{ 49 },
+	{ 40 },
+	{ 80 },
+	{ 136 },
+	{ 133 },
+	{ 77 },
+	{ 96 },
+	{ 138 },
+	{ 127 },
+	{ 15 },
+	{ 14 },
+	{ 17 },
+	{ 22 },
+	{ 17 },
+	{ 15 },
+	{ 26 },
+	{ 25 },
+	{ 23 },
+	{ 23 },
+	{ 26 },
+	{ 22 },
+	{ 37 },
+	{ 40 },
+	{ 25 },
+	{ 31 },
+	{ 37 },
+	{ 23 },
+	{ 77 },
+	{ 80 },
+	{ 37 },
+	{ 60 },
+	{ 77 },
+	{ 37 },
+	{ 49 },
+	{ 23 },
+	{ 40 },
+	{ 17 },
+	{ 23 },
+	{ 15 },
+	{ 14 },
+	{ 15 },
+	{ 26 },
+	{ 49 },
+	{ 36 },
+	{ 29 },
+	{ 26 },
+	{ 36 },
+	{ 37 },
+	{ 18 },
+	{ 26 },
+	{ 23 },
+	{ 0 },
+	{ 18 },
+	{ 23 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 28 },
+	{ 0 },
+	{ 54 },
+	{ 93 },
+	{ 28 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 35 },
+	{ 29 },
+	{ 28 },
+	{ 40 },
+	{ 2 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 13 },
+	{ 20 },
+	{ 0 },
+	{ 0 },
+	{ 20 },
+	{ 20 },
+	{ 55 },
+	{ 50 },
+	{ 0 },
+	{ 50 },
+	{ 54 },
+	{ 50 },
+	{ 104 },
+	{ 149 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 2 },
+	{ 21 },
+	{ 18 },
+	{ 1 },
+	{ 22 },
+	{ 2 },
+	{ 0 },
+	{ 29 },
+	{ 1 },
+	{ 0 },
+	{ 23 },
+	{ 13 },
+	{ 13 },
+	{ 35 },
+	{ 78 },
+	{ 35 },
+	{ 67 },
+	{ 112 },
+	{ 37 },
+	{ 69 },
+	{ 128 },
+	{ 23 },
+	{ 37 },
+	{ 67 },
+	{ 49 },
+	{ 128 },
+	{ 69 },
+	{ 67 },
+	{ 128 },
+	{ 112 },
+	{ 112 },
+	{ 141 },
+	{ 146 },
+	{ 49 },
+	{ 169 },
+	{ 141 },
+	{ 55 },
+	{ 78 },
+	{ 104 },
+	{ 136 },
+	{ 146 },
+	{ 141 },
+	{ 141 },
+	{ 141 },
+	{ 70 },
+	{ 149 },
+	{ 141 },
+	{ 93 },
+	{ 93 },
+	{ 86 },
+	{ 40 },
+	{ 86 },
+	{ 70 },
+	{ 45 },
+	{ 104 },
+	{ 136 },
+	{ 141 },
+	{ 141 },
+	{ 156 },
+	{ 70 },
+	{ 146 },
+	{ 169 },
+	{ 156 },
+	{ 49 },
+	{ 116 },
+	{ 156 },
+	{ 49 },
+	{ 33 },
+	{ 116 },
+	{ 70 },
+	{ 116 },
+	{ 45 },
+	{ 78 },
+	{ 112 },
+	{ 146 },
+	{ 21 },
+	{ 26 },
+	{ 18 },
+	{ 22 },
+	{ 26 },
+	{ 26 },
+	{ 31 },
+	{ 26 },
+	{ 26 },
+	{ 29 },
+	{ 31 },
+	{ 26 },
+	{ 34 },
+	{ 33 },
+	{ 26 },
+	{ 35 },
+	{ 34 },
+	{ 31 },
+	{ 45 },
+	{ 48 },
+	{ 34 },
+	{ 40 },
+	{ 45 },
+	{ 34 },
+	{ 49 },
+	{ 26 },
+	{ 33 },
+	{ 26 },
+	{ 26 },
+	{ 29 },
+	{ 26 },
+	{ 29 },
+	{ 36 },
+	{ 45 },
+	{ 162 },
+	{ 137 },
+	{ 120 },
+	{ 137 },
+	{ 162 },
+	{ 51 },
+	{ 71 },
+	{ 100 },
+	{ 1 },
+	{ 20 },
+	{ 51 },
+	{ 1 },
+	{ 12 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 1 },
+	{ 1 },
+	{ 2 },
+	{ 1 },
+	{ 2 },
+	{ 1 },
+	{ 0 },
+	{ 22 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 2 },
+	{ 1 },
+	{ 1 },
+	{ 24 },
+	{ 2 },
+	{ 2 },
+	{ 26 },
+	{ 24 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 117 },
+	{ 0 },
+	{ 47 },
+	{ 114 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 11 },
+	{ 12 },
+	{ 11 },
+	{ 10 },
+	{ 11 },
+	{ 10 },
+	{ 11 },
+	{ 11 },
+	{ 16 },
+	{ 20 },
+	{ 11 },
+	{ 19 },
+	{ 16 },
+	{ 11 },
+	{ 12 },
+	{ 11 },
+	{ 25 },
+	{ 2 },
+	{ 19 },
+	{ 11 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 28 },
+	{ 0 },
+	{ 28 },
+	{ 49 },
+	{ 0 },
+	{ 0 },
+	{ 47 },
+	{ 49 },
+	{ 78 },
+	{ 47 },
+	{ 28 },
+	{ 51 },
+	{ 100 },
+	{ 78 },
+	{ 100 },
+	{ 114 },
+	{ 149 },
+	{ 163 },
+	{ 149 },
+	{ 100 },
+	{ 120 },
+	{ 163 },
+	{ 114 },
+	{ 149 },
+	{ 117 },
+	{ 20 },
+	{ 25 },
+	{ 71 },
+	{ 25 },
+	{ 32 },
+	{ 94 },
+	{ 11 },
+	{ 18 },
+	{ 32 },
+	{ 45 },
+	{ 94 },
+	{ 32 },
+	{ 71 },
+	{ 94 },
+	{ 120 },
+	{ 163 },
+	{ 162 },
+	{ 165 },
+	{ 163 },
+	{ 165 },
+	{ 117 },
+	{ 119 },
+	{ 117 },
+	{ 62 },
+	{ 149 },
+	{ 163 },
+	{ 119 },
+	{ 90 },
+	{ 125 },
+	{ 53 },
+	{ 22 },
+	{ 53 },
+	{ 2 },
+	{ 53 },
+	{ 62 },
+	{ 33 },
+	{ 125 },
+	{ 119 },
+	{ 62 },
+	{ 62 },
+	{ 59 },
+	{ 38 },
+	{ 45 },
+	{ 38 },
+	{ 59 },
+	{ 45 },
+	{ 20 },
+	{ 38 },
+	{ 23 },
+	{ 26 },
+	{ 20 },
+	{ 33 },
+	{ 38 },
+	{ 26 },
+	{ 117 },
+	{ 149 },
+	{ 90 },
+	{ 45 },
+	{ 117 },
+	{ 165 },
+	{ 45 },
+	{ 18 },
+	{ 20 },
+	{ 47 },
+	{ 49 },
+	{ 49 },
+	{ 68 },
+	{ 72 },
+	{ 52 },
+	{ 50 },
+	{ 81 },
+	{ 68 },
+	{ 12 },
+	{ 35 },
+	{ 50 },
+	{ 1 },
+	{ 0 },
+	{ 12 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 57 },
+	{ 97 },
+	{ 0 },
+	{ 57 },
+	{ 0 },
+	{ 0 },
+	{ 97 },
+	{ 26 },
+	{ 10 },
+	{ 39 },
+	{ 0 },
+	{ 0 },
+	{ 10 },
+	{ 57 },
+	{ 26 },
+	{ 39 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 10 },
+	{ 1 },
+	{ 31 },
+	{ 31 },
+	{ 23 },
+	{ 26 },
+	{ 23 },
+	{ 22 },
+	{ 18 },
+	{ 1 },
+	{ 1 },
+	{ 23 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 81 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 12 },
+	{ 0 },
+	{ 79 },
+	{ 81 },
+	{ 35 },
+	{ 81 },
+	{ 81 },
+	{ 81 },
+	{ 101 },
+	{ 98 },
+	{ 0 },
+	{ 79 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 15 },
+	{ 1 },
+	{ 1 },
+	{ 15 },
+	{ 15 },
+	{ 15 },
+	{ 13 },
+	{ 22 },
+	{ 15 },
+	{ 13 },
+	{ 0 },
+	{ 12 },
+	{ 18 },
+	{ 15 },
+	{ 18 },
+	{ 14 },
+	{ 14 },
+	{ 22 },
+	{ 21 },
+	{ 22 },
+	{ 47 },
+	{ 23 },
+	{ 18 },
+	{ 50 },
+	{ 47 },
+	{ 47 },
+	{ 68 },
+	{ 41 },
+	{ 47 },
+	{ 41 },
+	{ 49 },
+	{ 81 },
+	{ 98 },
+	{ 72 },
+	{ 98 },
+	{ 93 },
+	{ 72 },
+	{ 93 },
+	{ 63 },
+	{ 74 },
+	{ 51 },
+	{ 45 },
+	{ 46 },
+	{ 45 },
+	{ 37 },
+	{ 40 },
+	{ 47 },
+	{ 40 },
+	{ 26 },
+	{ 26 },
+	{ 18 },
+	{ 26 },
+	{ 47 },
+	{ 20 },
+	{ 14 },
+	{ 18 },
+	{ 13 },
+	{ 20 },
+	{ 13 },
+	{ 14 },
+	{ 14 },
+	{ 37 },
+	{ 26 },
+	{ 40 },
+	{ 47 },
+	{ 49 },
+	{ 40 },
+	{ 74 },
+	{ 51 },
+	{ 49 },
+	{ 72 },
+	{ 74 },
+	{ 49 },
+	{ 39 },
+	{ 31 },
+	{ 45 },
+	{ 63 },
+	{ 39 },
+	{ 45 },
+	{ 110 },
+	{ 57 },
+	{ 63 },
+	{ 101 },
+	{ 110 },
+	{ 98 },
+	{ 47 },
+	{ 21 },
+	{ 41 },
+	{ 48 },
+	{ 49 },
+	{ 79 },
+	{ 49 },
+	{ 86 },
+	{ 49 },
+	{ 23 },
+	{ 47 },
+	{ 29 },
+	{ 0 },
+	{ 16 },
+	{ 23 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 83 },
+	{ 0 },
+	{ 83 },
+	{ 0 },
+	{ 61 },
+	{ 113 },
+	{ 83 },
+	{ 61 },
+	{ 0 },
+	{ 83 },
+	{ 113 },
+	{ 28 },
+	{ 0 },
+	{ 36 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 61 },
+	{ 28 },
+	{ 70 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 36 },
+	{ 36 },
+	{ 29 },
+	{ 45 },
+	{ 29 },
+	{ 21 },
+	{ 29 },
+	{ 1 },
+	{ 1 },
+	{ 21 },
+	{ 0 },
+	{ 40 },
+	{ 0 },
+	{ 0 },
+	{ 40 },
+	{ 48 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 16 },
+	{ 40 },
+	{ 82 },
+	{ 83 },
+	{ 16 },
+	{ 48 },
+	{ 23 },
+	{ 48 },
+	{ 83 },
+	{ 86 },
+	{ 0 },
+	{ 82 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 0 },
+	{ 18 },
+	{ 1 },
+	{ 1 },
+	{ 18 },
+	{ 18 },
+	{ 17 },
+	{ 23 },
+	{ 21 },
+	{ 18 },
+	{ 25 },
+	{ 0 },
+	{ 0 },
+	{ 18 },
+	{ 17 },
+	{ 18 },
+	{ 26 },
+	{ 23 },
+	{ 26 },
+	{ 37 },
+	{ 26 },
+	{ 29 },
+	{ 37 },
+	{ 18 },
+	{ 23 },
+	{ 26 },
+	{ 29 },
+	{ 49 },
+	{ 42 },
+	{ 48 },
+	{ 44 },
+	{ 49 },
+	{ 47 },
+	{ 86 },
+	{ 86 },
+	{ 86 },
+	{ 99 },
+	{ 86 },
+	{ 99 },
+	{ 70 },
+	{ 102 },
+	{ 85 },
+	{ 73 },
+	{ 80 },
+	{ 73 },
+	{ 45 },
+	{ 43 },
+	{ 48 },
+	{ 43 },
+	{ 28 },
+	{ 29 },
+	{ 25 },
+	{ 25 },
+	{ 48 },
+	{ 25 },
+	{ 27 },
+	{ 25 },
+	{ 25 },
+	{ 25 },
+	{ 25 },
+	{ 23 },
+	{ 27 },
+	{ 45 },
+	{ 29 },
+	{ 43 },
+	{ 48 },
+	{ 79 },
+	{ 80 },
+	{ 102 },
+	{ 85 },
+	{ 79 },
+	{ 86 },
+	{ 102 },
+	{ 49 },
+	{ 41 },
+	{ 36 },
+	{ 73 },
+	{ 70 },
+	{ 41 },
+	{ 85 },
+	{ 100 },
+	{ 61 },
+	{ 70 },
+	{ 83 },
+	{ 100 },
+	{ 86 },
+	{ 48 },
+	{ 34 },
+	{ 44 },
+	{ 44 },
+	{ 38 },
+	{ 26 },
+	{ 44 },
+	{ 49 },
+	{ 38 },
+	{ 48 },
+	{ 48 },
+	{ 49 },
+	{ 74 },
+	{ 47 },
+	{ 48 },
+	{ 103 },
+	{ 81 },
+	{ 74 },
+	{ 85 },
+	{ 103 },
+	{ 86 },
+	{ 39 },
+	{ 85 },
+	{ 48 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 1 },
+	{ 2 },
+	{ 29 },
+	{ 2 },
+	{ 39 },
+	{ 29 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 85 },
+	{ 72 },
+	{ 0 },
+	{ 0 },
+	{ 85 },
+	{ 0 },
+	{ 72 },
+	{ 85 },
+	{ 79 },
+	{ 86 },
+	{ 69 },
+	{ 86 },
+	{ 74 },
+	{ 48 },
+	{ 69 },
+	{ 62 },
+	{ 51 },
+	{ 51 },
+	{ 69 },
+	{ 51 },
+	{ 48 },
+	{ 79 },
+	{ 69 },
+	{ 62 },
+	{ 48 },
+	{ 49 },
+	{ 44 },
+	{ 36 },
+	{ 49 },
+	{ 44 },
+	{ 49 },
+	{ 49 },
+	{ 72 },
+	{ 85 },
+	{ 103 },
+	{ 85 },
+	{ 0 },
+	{ 81 },
+	{ 81 },
+	{ 48 },
+	{ 47 },
+	{ 0 },
+	{ 0 },
+	{ 48 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 18 },
+	{ 1 },
+	{ 30 },
+	{ 1 },
+	{ 1 },
+	{ 30 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 48 },
+	{ 48 },
+	{ 18 },
+	{ 47 },
+	{ 47 },
+	{ 35 },
+	{ 48 },
+	{ 48 },
+	{ 41 },
+	{ 42 },
+	{ 41 },
+	{ 32 },
+	{ 42 },
+	{ 35 },
+	{ 30 },
+	{ 41 },
+	{ 32 },
+	{ 22 },
+	{ 38 },
+	{ 24 },
+	{ 20 },
+	{ 15 },
+	{ 20 },
+	{ 11 },
+	{ 10 },
+	{ 11 },
+	{ 12 },
+	{ 10 },
+	{ 10 },
+	{ 12 },
+	{ 15 },
+	{ 15 },
+	{ 10 },
+	{ 17 },
+	{ 22 },
+	{ 15 },
+	{ 26 },
+	{ 44 },
+	{ 17 },
+	{ 10 },
+	{ 44 },
+	{ 15 },
+	{ 36 },
+	{ 33 },
+	{ 51 },
+	{ 29 },
+	{ 12 },
+	{ 33 },
+	{ 15 },
+	{ 12 },
+	{ 29 },
+	{ 12 },
+	{ 2 },
+	{ 1 },
+	{ 11 },
+	{ 1 },
+	{ 2 },
+	{ 20 },
+	{ 1 },
+	{ 1 },
+	{ 20 },
+	{ 30 },
+	{ 24 },
+	{ 22 },
+	{ 82 },
+	{ 119 },
+	{ 0 },
+	{ 110 },
+	{ 149 },
+	{ 54 },
+	{ 0 },
+	{ 90 },
+	{ 22 },
+	{ 24 },
+	{ 23 },
+	{ 19 },
+	{ 26 },
+	{ 33 },
+	{ 24 },
+	{ 79 },
+	{ 97 },
+	{ 110 },
+	{ 82 },
+	{ 113 },
+	{ 83 },
+	{ 29 },
+	{ 48 },
+	{ 33 },
+	{ 0 },
+	{ 0 },
+	{ 5 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 32 },
+	{ 18 },
+	{ 6 },
+	{ 40 },
+	{ 39 },
+	{ 38 },
+	{ 65 },
+	{ 40 },
+	{ 62 },
+	{ 74 },
+	{ 65 },
+	{ 62 },
+	{ 55 },
+	{ 70 },
+	{ 58 },
+	{ 0 },
+	{ 0 },
+	{ 55 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 9 },
+	{ 9 },
+	{ 30 },
+	{ 10 },
+	{ 30 },
+	{ 55 },
+	{ 32 },
+	{ 0 },
+	{ 43 },
+	{ 55 },
+	{ 70 },
+	{ 71 },
+	{ 74 },
+	{ 43 },
+	{ 43 },
+	{ 70 },
+	{ 43 },
+	{ 32 },
+	{ 71 },
+	{ 43 },
+	{ 0 },
+	{ 18 },
+	{ 43 },
+	{ 0 },
+	{ 0 },
+	{ 71 },
+	{ 45 },
+	{ 65 },
+	{ 58 },
+	{ 74 },
+	{ 78 },
+	{ 70 },
+	{ 78 },
+	{ 56 },
+	{ 37 },
+	{ 70 },
+	{ 0 },
+	{ 10 },
+	{ 32 },
+	{ 2 },
+	{ 3 },
+	{ 10 },
+	{ 3 },
+	{ 3 },
+	{ 2 },
+	{ 0 },
+	{ 2 },
+	{ 37 },
+	{ 13 },
+	{ 32 },
+	{ 58 },
+	{ 37 },
+	{ 0 },
+	{ 0 },
+	{ 13 },
+	{ 0 },
+	{ 0 },
+	{ 56 },
+	{ 78 },
+	{ 62 },
+	{ 56 },
+	{ 62 },
+	{ 38 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 38 },
+	{ 32 },
+	{ 0 },
+	{ 45 },
+	{ 38 },
+	{ 40 },
+	{ 38 },
+	{ 22 },
+	{ 39 },
+	{ 18 },
+	{ 0 },
+	{ 38 },
+	{ 0 },
+	{ 0 },
+	{ 10 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 10 },
+	{ 0 },
+	{ 0 },
+	{ 5 },
+	{ 10 },
+	{ 5 },
+	{ 13 },
+	{ 22 },
+	{ 10 },
+	{ 24 },
+	{ 5 },
+	{ 2 },
+	{ 6 },
+	{ 13 },
+	{ 6 },
+	{ 6 },
+	{ 6 },
+	{ 3 },
+	{ 3 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 39 },
+	{ 24 },
+	{ 32 },
+	{ 18 },
+	{ 7 },
+	{ 6 },
+	{ 24 },
+	{ 13 },
+	{ 18 },
+	{ 32 },
+	{ 18 },
+	{ 45 },
+	{ 7 },
+	{ 6 },
+	{ 0 },
+	{ 6 },
+	{ 3 },
+	{ 0 },
+	{ 3 },
+	{ 3 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 19 },
+	{ 5 },
+	{ 1 },
+	{ 19 },
+	{ 18 },
+	{ 5 },
+	{ 24 },
+	{ 16 },
+	{ 12 },
+	{ 33 },
+	{ 29 },
+	{ 30 },
+	{ 38 },
+	{ 33 },
+	{ 37 },
+	{ 53 },
+	{ 38 },
+	{ 57 },
+	{ 0 },
+	{ 49 },
+	{ 38 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 3 },
+	{ 0 },
+	{ 0 },
+	{ 38 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 49 },
+	{ 33 },
+	{ 53 },
+	{ 0 },
+	{ 31 },
+	{ 49 },
+	{ 31 },
+	{ 34 },
+	{ 33 },
+	{ 31 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 33 },
+	{ 34 },
+	{ 38 },
+	{ 38 },
+	{ 53 },
+	{ 57 },
+	{ 34 },
+	{ 57 },
+	{ 33 },
+	{ 19 },
+	{ 34 },
+	{ 33 },
+	{ 3 },
+	{ 22 },
+	{ 5 },
+	{ 5 },
+	{ 3 },
+	{ 2 },
+	{ 2 },
+	{ 5 },
+	{ 3 },
+	{ 5 },
+	{ 19 },
+	{ 18 },
+	{ 22 },
+	{ 38 },
+	{ 19 },
+	{ 19 },
+	{ 3 },
+	{ 18 },
+	{ 19 },
+	{ 33 },
+	{ 56 },
+	{ 57 },
+	{ 37 },
+	{ 56 },
+	{ 37 },
+	{ 30 },
+	{ 25 },
+	{ 19 },
+	{ 31 },
+	{ 18 },
+	{ 30 },
+	{ 24 },
+	{ 18 },
+	{ 34 },
+	{ 29 },
+	{ 33 },
+	{ 29 },
+	{ 0 },
+	{ 29 },
+	{ 0 },
+	{ 0 },
+	{ 29 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 3 },
+	{ 0 },
+	{ 0 },
+	{ 18 },
+	{ 0 },
+	{ 0 },
+	{ 3 },
+	{ 6 },
+	{ 3 },
+	{ 4 },
+	{ 3 },
+	{ 3 },
+	{ 4 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 29 },
+	{ 18 },
+	{ 24 },
+	{ 16 },
+	{ 6 },
+	{ 12 },
+	{ 18 },
+	{ 6 },
+	{ 16 },
+	{ 34 },
+	{ 0 },
+	{ 29 },
+	{ 6 },
+	{ 4 },
+	{ 2 },
+	{ 4 },
+	{ 2 },
+	{ 1 },
+	{ 2 },
+	{ 2 },
+	{ 0 },
+	{ 19 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 10 },
+	{ 4 },
+	{ 13 },
+	{ 6 },
+	{ 10 },
+	{ 24 },
+	{ 13 },
+	{ 13 },
+	{ 0 },
+	{ 2 },
+	{ 24 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 78 },
+	{ 0 },
+	{ 0 },
+	{ 40 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 51 },
+	{ 51 },
+	{ 78 },
+	{ 60 },
+	{ 78 },
+	{ 73 },
+	{ 85 },
+	{ 0 },
+	{ 51 },
+	{ 60 },
+	{ 7 },
+	{ 31 },
+	{ 8 },
+	{ 0 },
+	{ 0 },
+	{ 31 },
+	{ 1 },
+	{ 0 },
+	{ 5 },
+	{ 5 },
+	{ 7 },
+	{ 2 },
+	{ 31 },
+	{ 60 },
+	{ 27 },
+	{ 8 },
+	{ 27 },
+	{ 9 },
+	{ 27 },
+	{ 57 },
+	{ 9 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 2 },
+	{ 1 },
+	{ 13 },
+	{ 1 },
+	{ 1 },
+	{ 4 },
+	{ 13 },
+	{ 4 },
+	{ 6 },
+	{ 6 },
+	{ 2 },
+	{ 0 },
+	{ 2 },
+	{ 8 },
+	{ 5 },
+	{ 0 },
+	{ 0 },
+	{ 5 },
+	{ 4 },
+	{ 5 },
+	{ 6 },
+	{ 0 },
+	{ 0 },
+	{ 24 },
+	{ 34 },
+	{ 0 },
+	{ 40 },
+	{ 40 },
+	{ 34 },
+	{ 45 },
+	{ 45 },
+	{ 40 },
+	{ 46 },
+	{ 43 },
+	{ 36 },
+	{ 17 },
+	{ 36 },
+	{ 24 },
+	{ 20 },
+	{ 24 },
+	{ 13 },
+	{ 20 },
+	{ 33 },
+	{ 24 },
+	{ 36 },
+	{ 0 },
+	{ 10 },
+	{ 17 },
+	{ 0 },
+	{ 17 },
+	{ 10 },
+	{ 40 },
+	{ 33 },
+	{ 43 },
+	{ 46 },
+	{ 43 },
+	{ 28 },
+	{ 51 },
+	{ 46 },
+	{ 10 },
+	{ 82 },
+	{ 51 },
+	{ 14 },
+	{ 67 },
+	{ 45 },
+	{ 51 },
+	{ 85 },
+	{ 67 },
+	{ 82 },
+	{ 73 },
+	{ 40 },
+	{ 67 },
+	{ 0 },
+	{ 22 },
+	{ 10 },
+	{ 0 },
+	{ 9 },
+	{ 29 },
+	{ 78 },
+	{ 104 },
+	{ 34 },
+	{ 101 },
+	{ 104 },
+	{ 110 },
+	{ 99 },
+	{ 101 },
+	{ 110 },
+	{ 73 },
+	{ 77 },
+	{ 99 },
+	{ 0 },
+	{ 48 },
+	{ 73 },
+	{ 0 },
+	{ 25 },
+	{ 0 },
+	{ 0 },
+	{ 6 },
+	{ 25 },
+	{ 0 },
+	{ 1 },
+	{ 6 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 19 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 13 },
+	{ 10 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 10 },
+	{ 1 },
+	{ 1 },
+	{ 10 },
+	{ 8 },
+	{ 10 },
+	{ 13 },
+	{ 7 },
+	{ 12 },
+	{ 15 },
+	{ 10 },
+	{ 10 },
+	{ 12 },
+	{ 10 },
+	{ 1 },
+	{ 8 },
+	{ 10 },
+	{ 8 },
+	{ 7 },
+	{ 6 },
+	{ 6 },
+	{ 10 },
+	{ 22 },
+	{ 10 },
+	{ 6 },
+	{ 15 },
+	{ 48 },
+	{ 36 },
+	{ 77 },
+	{ 22 },
+	{ 15 },
+	{ 48 },
+	{ 15 },
+	{ 16 },
+	{ 48 },
+	{ 6 },
+	{ 6 },
+	{ 15 },
+	{ 78 },
+	{ 6 },
+	{ 18 },
+	{ 7 },
+	{ 7 },
+	{ 6 },
+	{ 78 },
+	{ 34 },
+	{ 6 },
+	{ 36 },
+	{ 48 },
+	{ 77 },
+	{ 77 },
+	{ 84 },
+	{ 99 },
+	{ 84 },
+	{ 87 },
+	{ 104 },
+	{ 48 },
+	{ 34 },
+	{ 84 },
+	{ 25 },
+	{ 22 },
+	{ 36 },
+	{ 19 },
+	{ 73 },
+	{ 79 },
+	{ 22 },
+	{ 79 },
+	{ 84 },
+	{ 19 },
+	{ 22 },
+	{ 0 },
+	{ 22 },
+	{ 33 },
+	{ 0 },
+	{ 33 },
+	{ 84 },
+	{ 36 },
+	{ 84 },
+	{ 98 },
+	{ 44 },
+	{ 79 },
+	{ 99 },
+	{ 98 },
+	{ 98 },
+	{ 110 },
+	{ 48 },
+	{ 110 },
+	{ 113 },
+	{ 48 },
+	{ 36 },
+	{ 44 },
+	{ 27 },
+	{ 44 },
+	{ 48 },
+	{ 33 },
+	{ 18 },
+	{ 36 },
+	{ 23 },
+	{ 0 },
+	{ 18 },
+	{ 0 },
+	{ 0 },
+	{ 23 },
+	{ 0 },
+	{ 78 },
+	{ 88 },
+	{ 113 },
+	{ 78 },
+	{ 34 },
+	{ 40 },
+	{ 78 },
+	{ 18 },
+	{ 21 },
+	{ 20 },
+	{ 34 },
+	{ 21 },
+	{ 33 },
+	{ 40 },
+	{ 20 },
+	{ 48 },
+	{ 88 },
+	{ 33 },
+	{ 27 },
+	{ 33 },
+	{ 20 },
+	{ 19 },
+	{ 20 },
+	{ 12 },
+	{ 23 },
+	{ 27 },
+	{ 19 },
+	{ 13 },
+	{ 19 },
+	{ 12 },
+	{ 15 },
+	{ 21 },
+	{ 13 },
+	{ 37 },
+	{ 89 },
+	{ 22 },
+	{ 99 },
+	{ 89 },
+	{ 91 },
+	{ 93 },
+	{ 99 },
+	{ 91 },
+	{ 78 },
+	{ 59 },
+	{ 93 },
+	{ 0 },
+	{ 0 },
+	{ 78 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 5 },
+	{ 3 },
+	{ 5 },
+	{ 7 },
+	{ 2 },
+	{ 10 },
+	{ 14 },
+	{ 7 },
+	{ 0 },
+	{ 10 },
+	{ 5 },
+	{ 0 },
+	{ 3 },
+	{ 3 },
+	{ 3 },
+	{ 2 },
+	{ 2 },
+	{ 1 },
+	{ 3 },
+	{ 9 },
+	{ 3 },
+	{ 2 },
+	{ 7 },
+	{ 0 },
+	{ 25 },
+	{ 59 },
+	{ 9 },
+	{ 7 },
+	{ 21 },
+	{ 7 },
+	{ 5 },
+	{ 21 },
+	{ 2 },
+	{ 2 },
+	{ 7 },
+	{ 37 },
+	{ 2 },
+	{ 8 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 37 },
+	{ 22 },
+	{ 2 },
+	{ 25 },
+	{ 21 },
+	{ 59 },
+	{ 59 },
+	{ 57 },
+	{ 99 },
+	{ 57 },
+	{ 48 },
+	{ 89 },
+	{ 21 },
+	{ 22 },
+	{ 48 },
+	{ 0 },
+	{ 9 },
+	{ 0 },
+	{ 0 },
+	{ 78 },
+	{ 93 },
+	{ 37 },
+	{ 93 },
+	{ 75 },
+	{ 0 },
+	{ 37 },
+	{ 0 },
+	{ 37 },
+	{ 44 },
+	{ 0 },
+	{ 44 },
+	{ 75 },
+	{ 0 },
+	{ 75 },
+	{ 85 },
+	{ 45 },
+	{ 93 },
+	{ 93 },
+	{ 85 },
+	{ 85 },
+	{ 91 },
+	{ 55 },
+	{ 91 },
+	{ 101 },
+	{ 55 },
+	{ 33 },
+	{ 45 },
+	{ 24 },
+	{ 45 },
+	{ 55 },
+	{ 33 },
+	{ 0 },
+	{ 33 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 37 },
+	{ 85 },
+	{ 101 },
+	{ 37 },
+	{ 30 },
+	{ 35 },
+	{ 37 },
+	{ 8 },
+	{ 30 },
+	{ 23 },
+	{ 30 },
+	{ 14 },
+	{ 33 },
+	{ 35 },
+	{ 30 },
+	{ 55 },
+	{ 85 },
+	{ 33 },
+	{ 24 },
+	{ 33 },
+	{ 23 },
+	{ 18 },
+	{ 23 },
+	{ 14 },
+	{ 0 },
+	{ 24 },
+	{ 18 },
+	{ 0 },
+	{ 18 },
+	{ 0 },
+	{ 14 },
+	{ 19 },
+	{ 7 },
+	{ 103 },
+	{ 114 },
+	{ 132 },
+	{ 99 },
+	{ 114 },
+	{ 45 },
+	{ 113 },
+	{ 127 },
+	{ 99 },
+	{ 88 },
+	{ 113 },
+	{ 85 },
+	{ 0 },
+	{ 88 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 51 },
+	{ 76 },
+	{ 0 },
+	{ 0 },
+	{ 51 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 51 },
+	{ 52 },
+	{ 82 },
+	{ 0 },
+	{ 32 },
+	{ 51 },
+	{ 15 },
+	{ 8 },
+	{ 25 },
+	{ 0 },
+	{ 15 },
+	{ 0 },
+	{ 32 },
+	{ 25 },
+	{ 47 },
+	{ 52 },
+	{ 47 },
+	{ 82 },
+	{ 82 },
+	{ 91 },
+	{ 127 },
+	{ 91 },
+	{ 83 },
+	{ 127 },
+	{ 47 },
+	{ 49 },
+	{ 91 },
+	{ 0 },
+	{ 76 },
+	{ 88 },
+	{ 76 },
+	{ 82 },
+	{ 113 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 34 },
+	{ 0 },
+	{ 0 },
+	{ 64 },
+	{ 34 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 64 },
+	{ 85 },
+	{ 39 },
+	{ 0 },
+	{ 33 },
+	{ 0 },
+	{ 33 },
+	{ 37 },
+	{ 27 },
+	{ 39 },
+	{ 45 },
+	{ 37 },
+	{ 34 },
+	{ 39 },
+	{ 33 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 25 },
+	{ 15 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 85 },
+	{ 99 },
+	{ 45 },
+	{ 127 },
+	{ 132 },
+	{ 99 },
+	{ 103 },
+	{ 42 },
+	{ 45 },
+	{ 45 },
+	{ 45 },
+	{ 37 },
+	{ 37 },
+	{ 42 },
+	{ 27 },
+	{ 27 },
+	{ 31 },
+	{ 19 },
+	{ 103 },
+	{ 26 },
+	{ 31 },
+	{ 19 },
+	{ 26 },
+	{ 14 },
+	{ 25 },
+	{ 27 },
+	{ 15 },
+	{ 15 },
+	{ 19 },
+	{ 10 },
+	{ 10 },
+	{ 12 },
+	{ 6 },
+	{ 1 },
+	{ 10 },
+	{ 9 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 2 },
+	{ 15 },
+	{ 10 },
+	{ 0 },
+	{ 2 },
+	{ 1 },
+	{ 1 },
+	{ 9 },
+	{ 15 },
+	{ 9 },
+	{ 6 },
+	{ 8 },
+	{ 6 },
+	{ 10 },
+	{ 8 },
+	{ 12 },
+	{ 14 },
+	{ 6 },
+	{ 103 },
+	{ 10 },
+	{ 26 },
+	{ 103 },
+	{ 24 },
+	{ 10 },
+	{ 8 },
+	{ 6 },
+	{ 25 },
+	{ 25 },
+	{ 24 },
+	{ 49 },
+	{ 103 },
+	{ 83 },
+	{ 24 },
+	{ 3 },
+	{ 3 },
+	{ 3 },
+	{ 2 },
+	{ 2 },
+	{ 3 },
+	{ 2 },
+	{ 9 },
+	{ 3 },
+	{ 3 },
+	{ 5 },
+	{ 2 },
+	{ 0 },
+	{ 2 },
+	{ 3 },
+	{ 2 },
+	{ 0 },
+	{ 5 },
+	{ 57 },
+	{ 82 },
+	{ 22 },
+	{ 60 },
+	{ 85 },
+	{ 82 },
+	{ 0 },
+	{ 0 },
+	{ 40 },
+	{ 13 },
+	{ 18 },
+	{ 7 },
+	{ 7 },
+	{ 8 },
+	{ 2 },
+	{ 3 },
+	{ 5 },
+	{ 0 },
+	{ 5 },
+	{ 15 },
+	{ 8 },
+	{ 15 },
+	{ 17 },
+	{ 9 },
+	{ 17 },
+	{ 5 },
+	{ 3 },
+	{ 5 },
+	{ 10 },
+	{ 5 },
+	{ 10 },
+	{ 9 },
+	{ 5 },
+	{ 9 },
+	{ 7 },
+	{ 2 },
+	{ 7 },
+	{ 2 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 20 },
+	{ 0 },
+	{ 8 },
+	{ 72 },
+	{ 8 },
+	{ 9 },
+	{ 92 },
+	{ 9 },
+	{ 3 },
+	{ 80 },
+	{ 3 },
+	{ 5 },
+	{ 78 },
+	{ 5 },
+	{ 5 },
+	{ 76 },
+	{ 5 },
+	{ 2 },
+	{ 56 },
+	{ 2 },
+	{ 3 },
+	{ 0 },
+	{ 20 },
+	{ 72 },
+	{ 14 },
+	{ 72 },
+	{ 92 },
+	{ 33 },
+	{ 92 },
+	{ 89 },
+	{ 41 },
+	{ 89 },
+	{ 80 },
+	{ 43 },
+	{ 80 },
+	{ 78 },
+	{ 45 },
+	{ 78 },
+	{ 76 },
+	{ 48 },
+	{ 76 },
+	{ 56 },
+	{ 51 },
+	{ 56 },
+	{ 0 },
+	{ 102 },
+	{ 14 },
+	{ 33 },
+	{ 10 },
+	{ 33 },
+	{ 41 },
+	{ 29 },
+	{ 41 },
+	{ 43 },
+	{ 37 },
+	{ 43 },
+	{ 45 },
+	{ 41 },
+	{ 45 },
+	{ 48 },
+	{ 44 },
+	{ 48 },
+	{ 51 },
+	{ 45 },
+	{ 51 },
+	{ 58 },
+	{ 51 },
+	{ 58 },
+	{ 102 },
+	{ 50 },
+	{ 10 },
+	{ 29 },
+	{ 18 },
+	{ 29 },
+	{ 37 },
+	{ 31 },
+	{ 37 },
+	{ 41 },
+	{ 41 },
+	{ 41 },
+	{ 44 },
+	{ 41 },
+	{ 44 },
+	{ 45 },
+	{ 45 },
+	{ 45 },
+	{ 49 },
+	{ 48 },
+	{ 49 },
+	{ 51 },
+	{ 49 },
+	{ 51 },
+	{ 50 },
+	{ 45 },
+	{ 18 },
+	{ 31 },
+	{ 27 },
+	{ 31 },
+	{ 41 },
+	{ 40 },
+	{ 41 },
+	{ 41 },
+	{ 44 },
+	{ 41 },
+	{ 44 },
+	{ 45 },
+	{ 44 },
+	{ 45 },
+	{ 46 },
+	{ 45 },
+	{ 48 },
+	{ 48 },
+	{ 48 },
+	{ 49 },
+	{ 49 },
+	{ 49 },
+	{ 45 },
+	{ 42 },
+	{ 27 },
+	{ 40 },
+	{ 48 },
+	{ 40 },
+	{ 44 },
+	{ 47 },
+	{ 44 },
+	{ 45 },
+	{ 47 },
+	{ 45 },
+	{ 45 },
+	{ 46 },
+	{ 45 },
+	{ 46 },
+	{ 44 },
+	{ 48 },
+	{ 49 },
+	{ 49 },
+	{ 49 },
+	{ 42 },
+	{ 47 },
+	{ 36 },
+	{ 48 },
+	{ 49 },
+	{ 48 },
+	{ 47 },
+	{ 49 },
+	{ 47 },
+	{ 47 },
+	{ 49 },
+	{ 47 },
+	{ 46 },
+	{ 49 },
+	{ 46 },
+	{ 44 },
+	{ 45 },
+	{ 47 },
+	{ 49 },
+	{ 48 },
+	{ 49 },
+	{ 47 },
+	{ 49 },
+	{ 44 },
+	{ 49 },
+	{ 50 },
+	{ 49 },
+	{ 49 },
+	{ 49 },
+	{ 49 },
+	{ 49 },
+	{ 49 },
+	{ 49 },
+	{ 49 },
+	{ 50 },
+	{ 49 },
+	{ 45 },
+	{ 45 },
+	{ 47 },
+	{ 48 },
+	{ 49 },
+	{ 48 },
+	{ 49 },
+	{ 51 },
+	{ 48 },
+	{ 51 },
+	{ 41 },
+	{ 51 },
+	{ 50 },
+	{ 40 },
+	{ 50 },
+	{ 49 },
+	{ 52 },
+	{ 49 },
+	{ 49 },
+	{ 66 },
+	{ 49 },
+	{ 46 },
+	{ 85 },
+	{ 50 },
+	{ 51 },
+	{ 77 },
+	{ 51 },
+	{ 50 },
+	{ 80 },
+	{ 10 },
+	{ 3 },
+	{ 6 },
+	{ 3 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 5 },
+	{ 5 },
+	{ 5 },
+	{ 13 },
+	{ 19 },
+	{ 6 },
+	{ 9 },
+	{ 9 },
+	{ 9 },
+	{ 39 },
+	{ 29 },
+	{ 6 },
+	{ 6 },
+	{ 2 },
+	{ 6 },
+	{ 2 },
+	{ 5 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 5 },
+	{ 5 },
+	{ 5 },
+	{ 19 },
+	{ 17 },
+	{ 9 },
+	{ 9 },
+	{ 6 },
+	{ 9 },
+	{ 29 },
+	{ 14 },
+	{ 6 },
+	{ 2 },
+	{ 3 },
+	{ 2 },
+	{ 5 },
+	{ 5 },
+	{ 5 },
+	{ 2 },
+	{ 9 },
+	{ 2 },
+	{ 5 },
+	{ 11 },
+	{ 5 },
+	{ 17 },
+	{ 3 },
+	{ 6 },
+	{ 6 },
+	{ 0 },
+	{ 6 },
+	{ 14 },
+	{ 0 },
+	{ 3 },
+	{ 3 },
+	{ 1 },
+	{ 3 },
+	{ 5 },
+	{ 5 },
+	{ 5 },
+	{ 9 },
+	{ 5 },
+	{ 9 },
+	{ 11 },
+	{ 8 },
+	{ 11 },
+	{ 3 },
+	{ 5 },
+	{ 3 },
+	{ 3 },
+	{ 0 },
+	{ 3 },
+	{ 0 },
+	{ 15 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 5 },
+	{ 3 },
+	{ 5 },
+	{ 12 },
+	{ 2 },
+	{ 12 },
+	{ 8 },
+	{ 7 },
+	{ 8 },
+	{ 5 },
+	{ 6 },
+	{ 5 },
+	{ 0 },
+	{ 11 },
+	{ 0 },
+	{ 15 },
+	{ 7 },
+	{ 15 },
+	{ 0 },
+	{ 7 },
+	{ 1 },
+	{ 3 },
+	{ 1 },
+	{ 3 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 6 },
+	{ 2 },
+	{ 6 },
+	{ 7 },
+	{ 2 },
+	{ 7 },
+	{ 6 },
+	{ 3 },
+	{ 6 },
+	{ 11 },
+	{ 4 },
+	{ 11 },
+	{ 7 },
+	{ 4 },
+	{ 7 },
+	{ 7 },
+	{ 2 },
+	{ 1 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 1 },
+	{ 2 },
+	{ 2 },
+	{ 4 },
+	{ 2 },
+	{ 3 },
+	{ 3 },
+	{ 3 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 4 },
+	{ 2 },
+	{ 4 },
+	{ 2 },
+	{ 3 },
+	{ 2 },
+	{ 0 },
+	{ 2 },
+	{ 2 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 4 },
+	{ 2 },
+	{ 4 },
+	{ 3 },
+	{ 4 },
+	{ 3 },
+	{ 2 },
+	{ 4 },
+	{ 2 },
+	{ 2 },
+	{ 5 },
+	{ 2 },
+	{ 3 },
+	{ 4 },
+	{ 3 },
+	{ 2 },
+	{ 4 },
+	{ 2 },
+	{ 1 },
+	{ 3 },
+	{ 58 },
+	{ 63 },
+	{ 49 },
+	{ 43 },
+	{ 58 },
+	{ 47 },
+	{ 19 },
+	{ 43 },
+	{ 42 },
+	{ 18 },
+	{ 19 },
+	{ 45 },
+	{ 40 },
+	{ 18 },
+	{ 45 },
+	{ 0 },
+	{ 40 },
+	{ 50 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 3 },
+	{ 25 },
+	{ 21 },
+	{ 48 },
+	{ 21 },
+	{ 13 },
+	{ 36 },
+	{ 13 },
+	{ 7 },
+	{ 36 },
+	{ 7 },
+	{ 5 },
+	{ 27 },
+	{ 5 },
+	{ 1 },
+	{ 18 },
+	{ 1 },
+	{ 0 },
+	{ 14 },
+	{ 0 },
+	{ 2 },
+	{ 20 },
+	{ 2 },
+	{ 3 },
+	{ 0 },
+	{ 48 },
+	{ 50 },
+	{ 50 },
+	{ 3 },
+	{ 10 },
+	{ 13 },
+	{ 25 },
+	{ 48 },
+	{ 49 },
+	{ 50 },
+	{ 49 },
+	{ 50 },
+	{ 2 },
+	{ 3 },
+	{ 6 },
+	{ 49 },
+	{ 49 },
+	{ 50 },
+	{ 0 },
+	{ 2 },
+	{ 3 },
+	{ 49 },
+	{ 50 },
+	{ 50 },
+	{ 5 },
+	{ 0 },
+	{ 6 },
+	{ 50 },
+	{ 45 },
+	{ 43 },
+	{ 13 },
+	{ 5 },
+	{ 11 },
+	{ 45 },
+	{ 49 },
+	{ 49 },
+	{ 9 },
+	{ 6 },
+	{ 16 },
+	{ 49 },
+	{ 51 },
+	{ 50 },
+	{ 51 },
+	{ 63 },
+	{ 63 },
+	{ 39 },
+	{ 9 },
+	{ 19 },
+	{ 49 },
+	{ 50 },
+	{ 48 },
+	{ 6 },
+	{ 13 },
+	{ 19 },
+	{ 31 },
+	{ 49 },
+	{ 48 },
+	{ 50 },
+	{ 50 },
+	{ 51 },
+	{ 3 },
+	{ 6 },
+	{ 19 },
+	{ 50 },
+	{ 50 },
+	{ 50 },
+	{ 6 },
+	{ 3 },
+	{ 13 },
+	{ 50 },
+	{ 50 },
+	{ 49 },
+	{ 11 },
+	{ 6 },
+	{ 25 },
+	{ 50 },
+	{ 43 },
+	{ 46 },
+	{ 12 },
+	{ 11 },
+	{ 35 },
+	{ 47 },
+	{ 49 },
+	{ 51 },
+	{ 19 },
+	{ 16 },
+	{ 56 },
+	{ 49 },
+	{ 50 },
+	{ 50 },
+	{ 50 },
+	{ 63 },
+	{ 50 },
+	{ 40 },
+	{ 19 },
+	{ 53 },
+	{ 46 },
+	{ 48 },
+	{ 47 },
+	{ 37 },
+	{ 37 },
+	{ 47 },
+	{ 37 },
+	{ 37 },
+	{ 45 },
+	{ 40 },
+	{ 37 },
+	{ 47 },
+	{ 45 },
+	{ 40 },
+	{ 50 },
+	{ 39 },
+	{ 45 },
+	{ 77 },
+	{ 16 },
+	{ 10 },
+	{ 44 },
+	{ 6 },
+	{ 7 },
+	{ 10 },
+	{ 4 },
+	{ 7 },
+	{ 9 },
+	{ 2 },
+	{ 4 },
+	{ 6 },
+	{ 3 },
+	{ 2 },
+	{ 3 },
+	{ 37 },
+	{ 15 },
+	{ 19 },
+	{ 46 },
+	{ 19 },
+	{ 44 },
+	{ 37 },
+	{ 15 },
+	{ 37 },
+	{ 18 },
+	{ 40 },
+	{ 45 },
+	{ 15 },
+	{ 15 },
+	{ 37 },
+	{ 15 },
+	{ 37 },
+	{ 18 },
+	{ 43 },
+	{ 60 },
+	{ 46 },
+	{ 45 },
+	{ 57 },
+	{ 60 },
+	{ 45 },
+	{ 52 },
+	{ 57 },
+	{ 44 },
+	{ 33 },
+	{ 52 },
+	{ 0 },
+	{ 0 },
+	{ 19 },
+	{ 0 },
+	{ 14 },
+	{ 43 },
+	{ 14 },
+	{ 29 },
+	{ 58 },
+	{ 29 },
+	{ 39 },
+	{ 63 },
+	{ 63 },
+	{ 63 },
+	{ 40 },
+	{ 83 },
+	{ 63 },
+	{ 56 },
+	{ 80 },
+	{ 83 },
+	{ 56 },
+	{ 77 },
+	{ 80 },
+	{ 53 },
+	{ 44 },
+	{ 39 },
+	{ 56 },
+	{ 10 },
+	{ 18 },
+	{ 39 },
+	{ 7 },
+	{ 15 },
+	{ 18 },
+	{ 7 },
+	{ 4 },
+	{ 15 },
+	{ 15 },
+	{ 15 },
+	{ 2 },
+	{ 19 },
+	{ 15 },
+	{ 3 },
+	{ 33 },
+	{ 19 },
+	{ 3 },
+	{ 52 },
+	{ 33 },
+	{ 17 },
+	{ 57 },
+	{ 52 },
+	{ 13 },
+	{ 60 },
+	{ 57 },
+	{ 12 },
+	{ 91 },
+	{ 60 },
+	{ 12 },
+	{ 85 },
+	{ 91 },
+	{ 35 },
+	{ 66 },
+	{ 85 },
+	{ 35 },
+	{ 52 },
+	{ 66 },
+	{ 25 },
+	{ 40 },
+	{ 52 },
+	{ 13 },
+	{ 41 },
+	{ 40 },
+	{ 19 },
+	{ 13 },
+	{ 31 },
+	{ 19 },
+	{ 10 },
+	{ 25 },
+	{ 13 },
+	{ 10 },
+	{ 6 },
+	{ 25 },
+	{ 6 },
+	{ 6 },
+	{ 21 },
+	{ 6 },
+	{ 3 },
+	{ 13 },
+	{ 3 },
+	{ 2 },
+	{ 7 },
+	{ 2 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 1 },
+	{ 2 },
+	{ 1 },
+	{ 2 },
+	{ 3 },
+	{ 2 },
+	{ 4 },
+	{ 5 },
+	{ 4 },
+	{ 4 },
+	{ 15 },
+	{ 4 },
+	{ 6 },
+	{ 17 },
+	{ 6 },
+	{ 5 },
+	{ 5 },
+	{ 5 },
+	{ 4 },
+	{ 10 },
+	{ 4 },
+	{ 4 },
+	{ 9 },
+	{ 4 },
+	{ 3 },
+	{ 7 },
+	{ 3 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 7 },
+	{ 40 },
+	{ 7 },
+	{ 0 },
+	{ 18 },
+	{ 72 },
+	{ 100 },
+	{ 162 },
+	{ 19 },
+	{ 19 },
+	{ 37 },
+	{ 19 },
+	{ 16 },
+	{ 37 },
+	{ 38 },
+	{ 37 },
+	{ 118 },
+	{ 37 },
+	{ 38 },
+	{ 114 },
+	{ 31 },
+	{ 16 },
+	{ 37 },
+	{ 31 },
+	{ 37 },
+	{ 100 },
+	{ 26 },
+	{ 5 },
+	{ 16 },
+	{ 26 },
+	{ 31 },
+	{ 72 },
+	{ 2 },
+	{ 5 },
+	{ 26 },
+	{ 2 },
+	{ 26 },
+	{ 58 },
+	{ 1 },
+	{ 3 },
+	{ 5 },
+	{ 1 },
+	{ 2 },
+	{ 24 },
+	{ 2 },
+	{ 6 },
+	{ 3 },
+	{ 2 },
+	{ 1 },
+	{ 0 },
+	{ 5 },
+	{ 7 },
+	{ 4 },
+	{ 7 },
+	{ 6 },
+	{ 4 },
+	{ 4 },
+	{ 2 },
+	{ 0 },
+	{ 2 },
+	{ 4 },
+	{ 0 },
+	{ 3 },
+	{ 7 },
+	{ 3 },
+	{ 3 },
+	{ 6 },
+	{ 6 },
+	{ 0 },
+	{ 3 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 6 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 37 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 9 },
+	{ 31 },
+	{ 0 },
+	{ 9 },
+	{ 0 },
+	{ 3 },
+	{ 6 },
+	{ 6 },
+	{ 3 },
+	{ 6 },
+	{ 0 },
+	{ 6 },
+	{ 2 },
+	{ 1 },
+	{ 9 },
+	{ 2 },
+	{ 9 },
+	{ 5 },
+	{ 0 },
+	{ 0 },
+	{ 37 },
+	{ 0 },
+	{ 39 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 52 },
+	{ 37 },
+	{ 52 },
+	{ 65 },
+	{ 45 },
+	{ 65 },
+	{ 70 },
+	{ 53 },
+	{ 70 },
+	{ 54 },
+	{ 79 },
+	{ 81 },
+	{ 72 },
+	{ 79 },
+	{ 70 },
+	{ 84 },
+	{ 39 },
+	{ 37 },
+	{ 45 },
+	{ 39 },
+	{ 45 },
+	{ 31 },
+	{ 45 },
+	{ 45 },
+	{ 53 },
+	{ 45 },
+	{ 45 },
+	{ 37 },
+	{ 84 },
+	{ 65 },
+	{ 52 },
+	{ 77 },
+	{ 52 },
+	{ 0 },
+	{ 110 },
+	{ 77 },
+	{ 24 },
+	{ 3 },
+	{ 6 },
+	{ 5 },
+	{ 5 },
+	{ 5 },
+	{ 7 },
+	{ 5 },
+	{ 7 },
+	{ 16 },
+	{ 16 },
+	{ 6 },
+	{ 19 },
+	{ 10 },
+	{ 19 },
+	{ 19 },
+	{ 10 },
+	{ 10 },
+	{ 16 },
+	{ 19 },
+	{ 36 },
+	{ 10 },
+	{ 36 },
+	{ 162 },
+	{ 135 },
+	{ 6 },
+	{ 135 },
+	{ 154 },
+	{ 10 },
+	{ 6 },
+	{ 27 },
+	{ 14 },
+	{ 20 },
+	{ 12 },
+	{ 20 },
+	{ 119 },
+	{ 121 },
+	{ 12 },
+	{ 121 },
+	{ 162 },
+	{ 18 },
+	{ 12 },
+	{ 19 },
+	{ 21 },
+	{ 18 },
+	{ 20 },
+	{ 21 },
+	{ 18 },
+	{ 14 },
+	{ 19 },
+	{ 6 },
+	{ 5 },
+	{ 6 },
+	{ 7 },
+	{ 6 },
+	{ 5 },
+	{ 6 },
+	{ 6 },
+	{ 6 },
+	{ 6 },
+	{ 6 },
+	{ 6 },
+	{ 6 },
+	{ 7 },
+	{ 5 },
+	{ 6 },
+	{ 4 },
+	{ 58 },
+	{ 72 },
+	{ 139 },
+	{ 110 },
+	{ 139 },
+	{ 142 },
+	{ 116 },
+	{ 142 },
+	{ 125 },
+	{ 98 },
+	{ 125 },
+	{ 95 },
+	{ 95 },
+	{ 108 },
+	{ 103 },
+	{ 104 },
+	{ 103 },
+	{ 88 },
+	{ 96 },
+	{ 88 },
+	{ 69 },
+	{ 75 },
+	{ 51 },
+	{ 88 },
+	{ 75 },
+	{ 88 },
+	{ 103 },
+	{ 95 },
+	{ 104 },
+	{ 81 },
+	{ 104 },
+	{ 96 },
+	{ 89 },
+	{ 106 },
+	{ 103 },
+	{ 108 },
+	{ 109 },
+	{ 108 },
+	{ 150 },
+	{ 122 },
+	{ 133 },
+	{ 110 },
+	{ 122 },
+	{ 107 },
+	{ 106 },
+	{ 109 },
+	{ 0 },
+	{ 9 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 9 },
+	{ 0 },
+	{ 11 },
+	{ 122 },
+	{ 9 },
+	{ 44 },
+	{ 81 },
+	{ 32 },
+	{ 0 },
+	{ 32 },
+	{ 19 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 49 },
+	{ 0 },
+	{ 109 },
+	{ 173 },
+	{ 189 },
+	{ 49 },
+	{ 173 },
+	{ 49 },
+	{ 150 },
+	{ 84 },
+	{ 116 },
+	{ 79 },
+	{ 95 },
+	{ 81 },
+	{ 98 },
+	{ 150 },
+	{ 125 },
+	{ 142 },
+	{ 168 },
+	{ 142 },
+	{ 139 },
+	{ 186 },
+	{ 196 },
+	{ 189 },
+	{ 186 },
+	{ 173 },
+	{ 168 },
+	{ 121 },
+	{ 119 },
+	{ 196 },
+	{ 121 },
+	{ 186 },
+	{ 162 },
+	{ 199 },
+	{ 165 },
+	{ 156 },
+	{ 199 },
+	{ 196 },
+	{ 196 },
+	{ 113 },
+	{ 95 },
+	{ 165 },
+	{ 113 },
+	{ 199 },
+	{ 119 },
+	{ 49 },
+	{ 38 },
+	{ 43 },
+	{ 49 },
+	{ 50 },
+	{ 165 },
+	{ 45 },
+	{ 33 },
+	{ 38 },
+	{ 45 },
+	{ 49 },
+	{ 165 },
+	{ 16 },
+	{ 18 },
+	{ 38 },
+	{ 18 },
+	{ 29 },
+	{ 38 },
+	{ 38 },
+	{ 44 },
+	{ 114 },
+	{ 37 },
+	{ 38 },
+	{ 114 },
+	{ 14 },
+	{ 18 },
+	{ 10 },
+	{ 14 },
+	{ 33 },
+	{ 29 },
+	{ 10 },
+	{ 27 },
+	{ 37 },
+	{ 27 },
+	{ 154 },
+	{ 165 },
+	{ 37 },
+	{ 165 },
+	{ 163 },
+	{ 14 },
+	{ 37 },
+	{ 33 },
+	{ 114 },
+	{ 103 },
+	{ 163 },
+	{ 114 },
+	{ 165 },
+	{ 118 },
+	{ 44 },
+	{ 29 },
+	{ 33 },
+	{ 44 },
+	{ 75 },
+	{ 163 },
+	{ 114 },
+	{ 118 },
+	{ 154 },
+	{ 114 },
+	{ 135 },
+	{ 100 },
+	{ 9 },
+	{ 2 },
+	{ 4 },
+	{ 9 },
+	{ 6 },
+	{ 8 },
+	{ 6 },
+	{ 2 },
+	{ 10 },
+	{ 6 },
+	{ 2 },
+	{ 10 },
+	{ 0 },
+	{ 0 },
+	{ 6 },
+	{ 0 },
+	{ 6 },
+	{ 11 },
+	{ 10 },
+	{ 18 },
+	{ 10 },
+	{ 10 },
+	{ 27 },
+	{ 33 },
+	{ 48 },
+	{ 47 },
+	{ 27 },
+	{ 48 },
+	{ 51 },
+	{ 58 },
+	{ 41 },
+	{ 48 },
+	{ 29 },
+	{ 41 },
+	{ 51 },
+	{ 48 },
+	{ 49 },
+	{ 50 },
+	{ 23 },
+	{ 50 },
+	{ 51 },
+	{ 29 },
+	{ 29 },
+	{ 41 },
+	{ 10 },
+	{ 23 },
+	{ 29 },
+	{ 6 },
+	{ 67 },
+	{ 62 },
+	{ 49 },
+	{ 67 },
+	{ 49 },
+	{ 75 },
+	{ 107 },
+	{ 110 },
+	{ 62 },
+	{ 107 },
+	{ 67 },
+	{ 106 },
+	{ 60 },
+	{ 51 },
+	{ 50 },
+	{ 60 },
+	{ 50 },
+	{ 49 },
+	{ 107 },
+	{ 58 },
+	{ 51 },
+	{ 107 },
+	{ 60 },
+	{ 110 },
+	{ 83 },
+	{ 109 },
+	{ 58 },
+	{ 83 },
+	{ 107 },
+	{ 133 },
+	{ 90 },
+	{ 33 },
+	{ 47 },
+	{ 90 },
+	{ 47 },
+	{ 109 },
+	{ 49 },
+	{ 23 },
+	{ 20 },
+	{ 23 },
+	{ 6 },
+	{ 9 },
+	{ 20 },
+	{ 9 },
+	{ 4 },
+	{ 49 },
+	{ 20 },
+	{ 19 },
+	{ 9 },
+	{ 8 },
+	{ 10 },
+	{ 9 },
+	{ 10 },
+	{ 29 },
+	{ 10 },
+	{ 10 },
+	{ 8 },
+	{ 10 },
+	{ 9 },
+	{ 27 },
+	{ 7 },
+	{ 6 },
+	{ 2 },
+	{ 7 },
+	{ 2 },
+	{ 6 },
+	{ 10 },
+	{ 6 },
+	{ 0 },
+	{ 20 },
+	{ 21 },
+	{ 14 },
+	{ 20 },
+	{ 22 },
+	{ 18 },
+	{ 22 },
+	{ 18 },
+	{ 22 },
+	{ 22 },
+	{ 25 },
+	{ 38 },
+	{ 22 },
+	{ 25 },
+	{ 19 },
+	{ 22 },
+	{ 42 },
+	{ 43 },
+	{ 81 },
+	{ 97 },
+	{ 32 },
+	{ 97 },
+	{ 75 },
+	{ 39 },
+	{ 39 },
+	{ 50 },
+	{ 42 },
+	{ 32 },
+	{ 39 },
+	{ 19 },
+	{ 196 },
+	{ 156 },
+	{ 75 },
+	{ 196 },
+	{ 97 },
+	{ 81 },
+	{ 50 },
+	{ 43 },
+	{ 42 },
+	{ 50 },
+	{ 50 },
+	{ 75 },
+	{ 20 },
+	{ 14 },
+	{ 0 },
+	{ 20 },
+	{ 0 },
+	{ 19 },
+	{ 10 },
+	{ 14 },
+	{ 20 },
+	{ 5 },
+	{ 6 },
+	{ 7 },
+	{ 5 },
+	{ 6 },
+	{ 6 },
+	{ 6 },
+	{ 7 },
+	{ 5 },
+	{ 6 },
+	{ 5 },
+	{ 6 },
+	{ 5 },
+	{ 6 },
+	{ 6 },
+	{ 5 },
+	{ 6 },
+	{ 6 },
+	{ 6 },
+	{ 6 },
+	{ 6 },
+	{ 0 },
+	{ 0 },
+	{ 6 },
+	{ 5 },
+	{ 0 },
+	{ 0 },
+	{ 6 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 6 },
+	{ 4 },
+	{ 6 },
+	{ 7 },
+	{ 7 },
+	{ 6 },
+	{ 7 },
+	{ 6 },
+	{ 8 },
+	{ 6 },
+	{ 10 },
+	{ 9 },
+	{ 28 },
+	{ 10 },
+	{ 9 },
+	{ 26 },
+	{ 28 },
+	{ 0 },
+	{ 9 },
+	{ 3 },
+	{ 0 },
+	{ 10 },
+	{ 9 },
+	{ 6 },
+	{ 3 },
+	{ 6 },
+	{ 6 },
+	{ 8 },
+	{ 6 },
+	{ 8 },
+	{ 10 },
+	{ 8 },
+	{ 6 },
+	{ 6 },
+	{ 5 },
+	{ 5 },
+	{ 7 },
+	{ 7 },
+	{ 6 },
+	{ 6 },
+	{ 7 },
+	{ 10 },
+	{ 6 },
+	{ 8 },
+	{ 51 },
+	{ 19 },
+	{ 40 },
+	{ 19 },
+	{ 4 },
+	{ 13 },
+	{ 40 },
+	{ 13 },
+	{ 21 },
+	{ 87 },
+	{ 40 },
+	{ 77 },
+	{ 77 },
+	{ 63 },
+	{ 62 },
+	{ 63 },
+	{ 21 },
+	{ 27 },
+	{ 76 },
+	{ 27 },
+	{ 27 },
+	{ 62 },
+	{ 76 },
+	{ 50 },
+	{ 48 },
+	{ 87 },
+	{ 77 },
+	{ 48 },
+	{ 47 },
+	{ 87 },
+	{ 6 },
+	{ 6 },
+	{ 26 },
+	{ 6 },
+	{ 6 },
+	{ 28 },
+	{ 26 },
+	{ 28 },
+	{ 48 },
+	{ 30 },
+	{ 26 },
+	{ 49 },
+	{ 8 },
+	{ 27 },
+	{ 21 },
+	{ 8 },
+	{ 24 },
+	{ 27 },
+	{ 24 },
+	{ 8 },
+	{ 41 },
+	{ 8 },
+	{ 6 },
+	{ 30 },
+	{ 30 },
+	{ 30 },
+	{ 49 },
+	{ 41 },
+	{ 30 },
+	{ 51 },
+	{ 62 },
+	{ 50 },
+	{ 49 },
+	{ 62 },
+	{ 49 },
+	{ 49 },
+	{ 41 },
+	{ 27 },
+	{ 24 },
+	{ 41 },
+	{ 41 },
+	{ 51 },
+	{ 13 },
+	{ 4 },
+	{ 6 },
+	{ 13 },
+	{ 6 },
+	{ 6 },
+	{ 26 },
+	{ 28 },
+	{ 6 },
+	{ 26 },
+	{ 46 },
+	{ 47 },
+	{ 83 },
+	{ 69 },
+	{ 46 },
+	{ 26 },
+	{ 6 },
+	{ 10 },
+	{ 26 },
+	{ 28 },
+	{ 46 },
+	{ 47 },
+	{ 46 },
+	{ 69 },
+	{ 6 },
+	{ 6 },
+	{ 4 },
+	{ 15 },
+	{ 14 },
+	{ 18 },
+	{ 15 },
+	{ 22 },
+	{ 33 },
+	{ 96 },
+	{ 83 },
+	{ 81 },
+	{ 81 },
+	{ 52 },
+	{ 53 },
+	{ 53 },
+	{ 39 },
+	{ 48 },
+	{ 71 },
+	{ 53 },
+	{ 50 },
+	{ 54 },
+	{ 72 },
+	{ 71 },
+	{ 49 },
+	{ 46 },
+	{ 54 },
+	{ 49 },
+	{ 0 },
+	{ 46 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 45 },
+	{ 53 },
+	{ 46 },
+	{ 45 },
+	{ 46 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 11 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 7 },
+	{ 1 },
+	{ 7 },
+	{ 0 },
+	{ 5 },
+	{ 7 },
+	{ 2 },
+	{ 7 },
+	{ 7 },
+	{ 2 },
+	{ 2 },
+	{ 1 },
+	{ 14 },
+	{ 2 },
+	{ 2 },
+	{ 14 },
+	{ 6 },
+	{ 5 },
+	{ 6 },
+	{ 0 },
+	{ 6 },
+	{ 5 },
+	{ 0 },
+	{ 2 },
+	{ 14 },
+	{ 7 },
+	{ 0 },
+	{ 7 },
+	{ 7 },
+	{ 7 },
+	{ 6 },
+	{ 37 },
+	{ 37 },
+	{ 14 },
+	{ 37 },
+	{ 14 },
+	{ 7 },
+	{ 46 },
+	{ 48 },
+	{ 37 },
+	{ 46 },
+	{ 37 },
+	{ 0 },
+	{ 10 },
+	{ 14 },
+	{ 37 },
+	{ 49 },
+	{ 50 },
+	{ 48 },
+	{ 49 },
+	{ 46 },
+	{ 0 },
+	{ 81 },
+	{ 53 },
+	{ 71 },
+	{ 89 },
+	{ 71 },
+	{ 72 },
+	{ 26 },
+	{ 10 },
+	{ 39 },
+	{ 44 },
+	{ 26 },
+	{ 52 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 7 },
+	{ 0 },
+	{ 6 },
+	{ 6 },
+	{ 5 },
+	{ 133 },
+	{ 44 },
+	{ 48 },
+	{ 44 },
+	{ 11 },
+	{ 18 },
+	{ 48 },
+	{ 18 },
+	{ 90 },
+	{ 83 },
+	{ 48 },
+	{ 90 },
+	{ 95 },
+	{ 113 },
+	{ 45 },
+	{ 113 },
+	{ 119 },
+	{ 22 },
+	{ 22 },
+	{ 20 },
+	{ 15 },
+	{ 45 },
+	{ 22 },
+	{ 33 },
+	{ 116 },
+	{ 84 },
+	{ 77 },
+	{ 5 },
+	{ 14 },
+	{ 43 },
+	{ 115 },
+	{ 139 },
+	{ 14 },
+	{ 89 },
+	{ 115 },
+	{ 90 },
+	{ 82 },
+	{ 139 },
+	{ 89 },
+	{ 51 },
+	{ 75 },
+	{ 82 },
+	{ 51 },
+	{ 51 },
+	{ 75 },
+	{ 51 },
+	{ 51 },
+	{ 42 },
+	{ 49 },
+	{ 51 },
+	{ 43 },
+	{ 43 },
+	{ 14 },
+	{ 49 },
+	{ 43 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 42 },
+	{ 14 },
+	{ 139 },
+	{ 82 },
+	{ 51 },
+	{ 51 },
+	{ 89 },
+	{ 51 },
+	{ 82 },
+	{ 90 },
+	{ 51 },
+	{ 89 },
+	{ 90 },
+	{ 123 },
+	{ 107 },
+	{ 132 },
+	{ 123 },
+	{ 146 },
+	{ 107 },
+	{ 132 },
+	{ 158 },
+	{ 107 },
+	{ 51 },
+	{ 90 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 104 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 76 },
+	{ 159 },
+	{ 76 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 153 },
+	{ 104 },
+	{ 51 },
+	{ 153 },
+	{ 158 },
+	{ 179 },
+	{ 179 },
+	{ 158 },
+	{ 147 },
+	{ 158 },
+	{ 132 },
+	{ 151 },
+	{ 192 },
+	{ 179 },
+	{ 166 },
+	{ 192 },
+	{ 159 },
+	{ 104 },
+	{ 178 },
+	{ 140 },
+	{ 159 },
+	{ 123 },
+	{ 115 },
+	{ 152 },
+	{ 115 },
+	{ 46 },
+	{ 151 },
+	{ 46 },
+	{ 5 },
+	{ 50 },
+	{ 115 },
+	{ 5 },
+	{ 46 },
+	{ 5 },
+	{ 46 },
+	{ 49 },
+	{ 5 },
+	{ 51 },
+	{ 5 },
+	{ 51 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 46 },
+	{ 51 },
+	{ 50 },
+	{ 49 },
+	{ 51 },
+	{ 49 },
+	{ 50 },
+	{ 51 },
+	{ 46 },
+	{ 50 },
+	{ 60 },
+	{ 151 },
+	{ 171 },
+	{ 152 },
+	{ 60 },
+	{ 91 },
+	{ 151 },
+	{ 171 },
+	{ 119 },
+	{ 164 },
+	{ 91 },
+	{ 53 },
+	{ 171 },
+	{ 152 },
+	{ 164 },
+	{ 146 },
+	{ 146 },
+	{ 149 },
+	{ 144 },
+	{ 144 },
+	{ 133 },
+	{ 110 },
+	{ 151 },
+	{ 110 },
+	{ 70 },
+	{ 110 },
+	{ 38 },
+	{ 37 },
+	{ 133 },
+	{ 58 },
+	{ 38 },
+	{ 149 },
+	{ 89 },
+	{ 133 },
+	{ 89 },
+	{ 47 },
+	{ 58 },
+	{ 105 },
+	{ 47 },
+	{ 89 },
+	{ 164 },
+	{ 105 },
+	{ 149 },
+	{ 60 },
+	{ 51 },
+	{ 53 },
+	{ 53 },
+	{ 45 },
+	{ 119 },
+	{ 45 },
+	{ 51 },
+	{ 49 },
+	{ 119 },
+	{ 49 },
+	{ 105 },
+	{ 49 },
+	{ 51 },
+	{ 47 },
+	{ 51 },
+	{ 51 },
+	{ 45 },
+	{ 47 },
+	{ 51 },
+	{ 47 },
+	{ 47 },
+	{ 51 },
+	{ 48 },
+	{ 58 },
+	{ 48 },
+	{ 47 },
+	{ 38 },
+	{ 47 },
+	{ 45 },
+	{ 37 },
+	{ 45 },
+	{ 45 },
+	{ 39 },
+	{ 45 },
+	{ 1 },
+	{ 44 },
+	{ 39 },
+	{ 1 },
+	{ 147 },
+	{ 70 },
+	{ 44 },
+	{ 166 },
+	{ 179 },
+	{ 129 },
+	{ 10 },
+	{ 166 },
+	{ 4 },
+	{ 4 },
+	{ 7 },
+	{ 10 },
+	{ 129 },
+	{ 44 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 4 },
+	{ 1 },
+	{ 1 },
+	{ 7 },
+	{ 12 },
+	{ 3 },
+	{ 17 },
+	{ 46 },
+	{ 78 },
+	{ 6 },
+	{ 50 },
+	{ 51 },
+	{ 46 },
+	{ 49 },
+	{ 46 },
+	{ 3 },
+	{ 51 },
+	{ 76 },
+	{ 78 },
+	{ 17 },
+	{ 6 },
+	{ 140 },
+	{ 7 },
+	{ 2 },
+	{ 12 },
+	{ 10 },
+	{ 12 },
+	{ 9 },
+	{ 178 },
+	{ 166 },
+	{ 10 },
+	{ 9 },
+	{ 17 },
+	{ 178 },
+	{ 70 },
+	{ 37 },
+	{ 39 },
+	{ 45 },
+	{ 49 },
+	{ 2 },
+	{ 45 },
+	{ 50 },
+	{ 49 },
+	{ 47 },
+	{ 51 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 48 },
+	{ 51 },
+	{ 51 },
+	{ 140 },
+	{ 78 },
+	{ 76 },
+	{ 31 },
+	{ 41 },
+	{ 47 },
+	{ 19 },
+	{ 47 },
+	{ 31 },
+	{ 31 },
+	{ 43 },
+	{ 37 },
+	{ 37 },
+	{ 46 },
+	{ 44 },
+	{ 59 },
+	{ 41 },
+	{ 49 },
+	{ 54 },
+	{ 49 },
+	{ 42 },
+	{ 26 },
+	{ 26 },
+	{ 41 },
+	{ 106 },
+	{ 84 },
+	{ 85 },
+	{ 59 },
+	{ 7 },
+	{ 41 },
+	{ 33 },
+	{ 28 },
+	{ 38 },
+	{ 31 },
+	{ 30 },
+	{ 32 },
+	{ 33 },
+	{ 36 },
+	{ 36 },
+	{ 40 },
+	{ 41 },
+	{ 42 },
+	{ 42 },
+	{ 47 },
+	{ 33 },
+	{ 1 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 43 },
+	{ 45 },
+	{ 47 },
+	{ 36 },
+	{ 37 },
+	{ 47 },
+	{ 45 },
+	{ 50 },
+	{ 50 },
+	{ 46 },
+	{ 47 },
+	{ 42 },
+	{ 47 },
+	{ 43 },
+	{ 37 },
+	{ 42 },
+	{ 37 },
+	{ 27 },
+	{ 37 },
+	{ 33 },
+	{ 47 },
+	{ 26 },
+	{ 27 },
+	{ 49 },
+	{ 27 },
+	{ 47 },
+	{ 55 },
+	{ 41 },
+	{ 49 },
+	{ 47 },
+	{ 49 },
+	{ 55 },
+	{ 48 },
+	{ 47 },
+	{ 48 },
+	{ 43 },
+	{ 48 },
+	{ 53 },
+	{ 60 },
+	{ 43 },
+	{ 60 },
+	{ 46 },
+	{ 60 },
+	{ 60 },
+	{ 45 },
+	{ 46 },
+	{ 45 },
+	{ 46 },
+	{ 45 },
+	{ 36 },
+	{ 48 },
+	{ 44 },
+	{ 46 },
+	{ 51 },
+	{ 46 },
+	{ 48 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 46 },
+	{ 51 },
+	{ 51 },
+	{ 47 },
+	{ 46 },
+	{ 48 },
+	{ 44 },
+	{ 49 },
+	{ 50 },
+	{ 47 },
+	{ 50 },
+	{ 51 },
+	{ 50 },
+	{ 112 },
+	{ 121 },
+	{ 45 },
+	{ 113 },
+	{ 119 },
+	{ 76 },
+	{ 119 },
+	{ 152 },
+	{ 85 },
+	{ 49 },
+	{ 40 },
+	{ 53 },
+	{ 75 },
+	{ 76 },
+	{ 51 },
+	{ 76 },
+	{ 85 },
+	{ 51 },
+	{ 44 },
+	{ 51 },
+	{ 51 },
+	{ 49 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 50 },
+	{ 48 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 85 },
+	{ 152 },
+	{ 99 },
+	{ 51 },
+	{ 99 },
+	{ 56 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 1 },
+	{ 45 },
+	{ 49 },
+	{ 1 },
+	{ 0 },
+	{ 50 },
+	{ 0 },
+	{ 49 },
+	{ 50 },
+	{ 50 },
+	{ 48 },
+	{ 50 },
+	{ 39 },
+	{ 50 },
+	{ 39 },
+	{ 39 },
+	{ 33 },
+	{ 32 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 52 },
+	{ 45 },
+	{ 51 },
+	{ 0 },
+	{ 51 },
+	{ 84 },
+	{ 0 },
+	{ 97 },
+	{ 49 },
+	{ 64 },
+	{ 51 },
+	{ 43 },
+	{ 0 },
+	{ 0 },
+	{ 29 },
+	{ 30 },
+	{ 0 },
+	{ 29 },
+	{ 0 },
+	{ 32 },
+	{ 32 },
+	{ 0 },
+	{ 68 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 16 },
+	{ 16 },
+	{ 8 },
+	{ 22 },
+	{ 44 },
+	{ 46 },
+	{ 43 },
+	{ 50 },
+	{ 72 },
+	{ 33 },
+	{ 72 },
+	{ 63 },
+	{ 35 },
+	{ 63 },
+	{ 41 },
+	{ 40 },
+	{ 41 },
+	{ 51 },
+	{ 45 },
+	{ 33 },
+	{ 35 },
+	{ 54 },
+	{ 35 },
+	{ 40 },
+	{ 54 },
+	{ 40 },
+	{ 45 },
+	{ 105 },
+	{ 45 },
+	{ 60 },
+	{ 148 },
+	{ 32 },
+	{ 54 },
+	{ 0 },
+	{ 54 },
+	{ 79 },
+	{ 54 },
+	{ 79 },
+	{ 105 },
+	{ 143 },
+	{ 105 },
+	{ 148 },
+	{ 164 },
+	{ 0 },
+	{ 54 },
+	{ 52 },
+	{ 54 },
+	{ 143 },
+	{ 103 },
+	{ 143 },
+	{ 164 },
+	{ 124 },
+	{ 164 },
+	{ 180 },
+	{ 142 },
+	{ 52 },
+	{ 103 },
+	{ 45 },
+	{ 103 },
+	{ 116 },
+	{ 50 },
+	{ 116 },
+	{ 124 },
+	{ 50 },
+	{ 124 },
+	{ 142 },
+	{ 51 },
+	{ 45 },
+	{ 50 },
+	{ 51 },
+	{ 50 },
+	{ 50 },
+	{ 51 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 81 },
+	{ 52 },
+	{ 49 },
+	{ 51 },
+	{ 48 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 52 },
+	{ 51 },
+	{ 48 },
+	{ 50 },
+	{ 72 },
+	{ 50 },
+	{ 50 },
+	{ 72 },
+	{ 50 },
+	{ 51 },
+	{ 63 },
+	{ 51 },
+	{ 51 },
+	{ 41 },
+	{ 81 },
+	{ 142 },
+	{ 52 },
+	{ 52 },
+	{ 127 },
+	{ 51 },
+	{ 142 },
+	{ 180 },
+	{ 127 },
+	{ 127 },
+	{ 148 },
+	{ 60 },
+	{ 84 },
+	{ 28 },
+	{ 29 },
+	{ 1 },
+	{ 1 },
+	{ 0 },
+	{ 7 },
+	{ 2 },
+	{ 6 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 38 },
+	{ 38 },
+	{ 33 },
+	{ 32 },
+	{ 29 },
+	{ 31 },
+	{ 22 },
+	{ 20 },
+	{ 22 },
+	{ 22 },
+	{ 28 },
+	{ 45 },
+	{ 35 },
+	{ 36 },
+	{ 62 },
+	{ 68 },
+	{ 108 },
+	{ 130 },
+	{ 142 },
+	{ 152 },
+	{ 126 },
+	{ 50 },
+	{ 49 },
+	{ 68 },
+	{ 126 },
+	{ 137 },
+	{ 51 },
+	{ 40 },
+	{ 50 },
+	{ 49 },
+	{ 49 },
+	{ 49 },
+	{ 41 },
+	{ 41 },
+	{ 41 },
+	{ 27 },
+	{ 18 },
+	{ 24 },
+	{ 22 },
+	{ 27 },
+	{ 27 },
+	{ 24 },
+	{ 56 },
+	{ 36 },
+	{ 63 },
+	{ 30 },
+	{ 28 },
+	{ 55 },
+	{ 28 },
+	{ 28 },
+	{ 63 },
+	{ 28 },
+	{ 45 },
+	{ 68 },
+	{ 137 },
+	{ 152 },
+	{ 140 },
+	{ 164 },
+	{ 169 },
+	{ 142 },
+	{ 169 },
+	{ 175 },
+	{ 138 },
+	{ 175 },
+	{ 100 },
+	{ 53 },
+	{ 51 },
+	{ 137 },
+	{ 140 },
+	{ 140 },
+	{ 142 },
+	{ 51 },
+	{ 142 },
+	{ 138 },
+	{ 51 },
+	{ 138 },
+	{ 53 },
+	{ 51 },
+	{ 41 },
+	{ 49 },
+	{ 42 },
+	{ 49 },
+	{ 49 },
+	{ 44 },
+	{ 49 },
+	{ 49 },
+	{ 46 },
+	{ 49 },
+	{ 51 },
+	{ 50 },
+	{ 27 },
+	{ 41 },
+	{ 31 },
+	{ 42 },
+	{ 44 },
+	{ 33 },
+	{ 44 },
+	{ 46 },
+	{ 37 },
+	{ 46 },
+	{ 50 },
+	{ 46 },
+	{ 27 },
+	{ 31 },
+	{ 28 },
+	{ 31 },
+	{ 33 },
+	{ 31 },
+	{ 33 },
+	{ 37 },
+	{ 39 },
+	{ 37 },
+	{ 46 },
+	{ 45 },
+	{ 51 },
+	{ 45 },
+	{ 46 },
+	{ 51 },
+	{ 48 },
+	{ 48 },
+	{ 48 },
+	{ 48 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 43 },
+	{ 51 },
+	{ 50 },
+	{ 50 },
+	{ 49 },
+	{ 42 },
+	{ 33 },
+	{ 43 },
+	{ 42 },
+	{ 37 },
+	{ 39 },
+	{ 70 },
+	{ 47 },
+	{ 33 },
+	{ 67 },
+	{ 70 },
+	{ 49 },
+	{ 80 },
+	{ 55 },
+	{ 47 },
+	{ 67 },
+	{ 67 },
+	{ 74 },
+	{ 58 },
+	{ 53 },
+	{ 55 },
+	{ 57 },
+	{ 57 },
+	{ 58 },
+	{ 58 },
+	{ 60 },
+	{ 53 },
+	{ 58 },
+	{ 58 },
+	{ 74 },
+	{ 62 },
+	{ 36 },
+	{ 60 },
+	{ 62 },
+	{ 62 },
+	{ 72 },
+	{ 37 },
+	{ 36 },
+	{ 37 },
+	{ 48 },
+	{ 37 },
+	{ 39 },
+	{ 48 },
+	{ 58 },
+	{ 74 },
+	{ 52 },
+	{ 52 },
+	{ 58 },
+	{ 54 },
+	{ 54 },
+	{ 46 },
+	{ 64 },
+	{ 53 },
+	{ 56 },
+	{ 73 },
+	{ 56 },
+	{ 47 },
+	{ 50 },
+	{ 74 },
+	{ 58 },
+	{ 81 },
+	{ 81 },
+	{ 52 },
+	{ 94 },
+	{ 94 },
+	{ 54 },
+	{ 105 },
+	{ 64 },
+	{ 73 },
+	{ 114 },
+	{ 73 },
+	{ 50 },
+	{ 74 },
+	{ 72 },
+	{ 74 },
+	{ 81 },
+	{ 88 },
+	{ 81 },
+	{ 107 },
+	{ 107 },
+	{ 94 },
+	{ 129 },
+	{ 105 },
+	{ 114 },
+	{ 140 },
+	{ 114 },
+	{ 74 },
+	{ 96 },
+	{ 39 },
+	{ 72 },
+	{ 88 },
+	{ 77 },
+	{ 88 },
+	{ 107 },
+	{ 102 },
+	{ 107 },
+	{ 129 },
+	{ 129 },
+	{ 140 },
+	{ 116 },
+	{ 140 },
+	{ 96 },
+	{ 48 },
+	{ 48 },
+	{ 39 },
+	{ 49 },
+	{ 49 },
+	{ 77 },
+	{ 49 },
+	{ 49 },
+	{ 102 },
+	{ 53 },
+	{ 120 },
+	{ 116 },
+	{ 50 },
+	{ 116 },
+	{ 48 },
+	{ 51 },
+	{ 51 },
+	{ 48 },
+	{ 51 },
+	{ 51 },
+	{ 49 },
+	{ 51 },
+	{ 51 },
+	{ 49 },
+	{ 50 },
+	{ 53 },
+	{ 50 },
+	{ 51 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 49 },
+	{ 51 },
+	{ 48 },
+	{ 48 },
+	{ 51 },
+	{ 49 },
+	{ 49 },
+	{ 51 },
+	{ 50 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 45 },
+	{ 49 },
+	{ 42 },
+	{ 42 },
+	{ 48 },
+	{ 41 },
+	{ 41 },
+	{ 49 },
+	{ 46 },
+	{ 50 },
+	{ 51 },
+	{ 48 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 49 },
+	{ 39 },
+	{ 37 },
+	{ 37 },
+	{ 42 },
+	{ 41 },
+	{ 36 },
+	{ 41 },
+	{ 46 },
+	{ 46 },
+	{ 48 },
+	{ 43 },
+	{ 48 },
+	{ 51 },
+	{ 50 },
+	{ 49 },
+	{ 37 },
+	{ 48 },
+	{ 37 },
+	{ 36 },
+	{ 58 },
+	{ 36 },
+	{ 43 },
+	{ 46 },
+	{ 43 },
+	{ 45 },
+	{ 53 },
+	{ 45 },
+	{ 50 },
+	{ 47 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 50 },
+	{ 51 },
+	{ 48 },
+	{ 74 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 24 },
+	{ 25 },
+	{ 22 },
+	{ 24 },
+	{ 33 },
+	{ 25 },
+	{ 110 },
+	{ 88 },
+	{ 1 },
+	{ 110 },
+	{ 106 },
+	{ 85 },
+	{ 110 },
+	{ 100 },
+	{ 124 },
+	{ 26 },
+	{ 26 },
+	{ 22 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 14 },
+	{ 32 },
+	{ 0 },
+	{ 0 },
+	{ 36 },
+	{ 36 },
+	{ 39 },
+	{ 51 },
+	{ 51 },
+	{ 49 },
+	{ 46 },
+	{ 50 },
+	{ 51 },
+	{ 17 },
+	{ 33 },
+	{ 38 },
+	{ 4 },
+	{ 20 },
+	{ 33 },
+	{ 2 },
+	{ 5 },
+	{ 2 },
+	{ 47 },
+	{ 47 },
+	{ 64 },
+	{ 49 },
+	{ 49 },
+	{ 41 },
+	{ 49 },
+	{ 46 },
+	{ 41 },
+	{ 51 },
+	{ 51 },
+	{ 49 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 45 },
+	{ 44 },
+	{ 50 },
+	{ 43 },
+	{ 41 },
+	{ 46 },
+	{ 42 },
+	{ 26 },
+	{ 37 },
+	{ 71 },
+	{ 69 },
+	{ 45 },
+	{ 131 },
+	{ 119 },
+	{ 69 },
+	{ 47 },
+	{ 49 },
+	{ 44 },
+	{ 8 },
+	{ 0 },
+	{ 9 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 72 },
+	{ 45 },
+	{ 45 },
+	{ 46 },
+	{ 44 },
+	{ 45 },
+	{ 8 },
+	{ 16 },
+	{ 33 },
+	{ 2 },
+	{ 8 },
+	{ 37 },
+	{ 36 },
+	{ 2 },
+	{ 42 },
+	{ 46 },
+	{ 71 },
+	{ 48 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 46 },
+	{ 48 },
+	{ 51 },
+	{ 68 },
+	{ 0 },
+	{ 83 },
+	{ 41 },
+	{ 0 },
+	{ 33 },
+	{ 48 },
+	{ 45 },
+	{ 37 },
+	{ 14 },
+	{ 35 },
+	{ 62 },
+	{ 14 },
+	{ 62 },
+	{ 16 },
+	{ 62 },
+	{ 80 },
+	{ 110 },
+	{ 0 },
+	{ 48 },
+	{ 6 },
+	{ 0 },
+	{ 6 },
+	{ 2 },
+	{ 7 },
+	{ 39 },
+	{ 2 },
+	{ 49 },
+	{ 51 },
+	{ 49 },
+	{ 39 },
+	{ 49 },
+	{ 50 },
+	{ 7 },
+	{ 49 },
+	{ 39 },
+	{ 124 },
+	{ 96 },
+	{ 107 },
+	{ 44 },
+	{ 49 },
+	{ 71 },
+	{ 121 },
+	{ 131 },
+	{ 53 },
+	{ 44 },
+	{ 41 },
+	{ 38 },
+	{ 37 },
+	{ 44 },
+	{ 38 },
+	{ 28 },
+	{ 22 },
+	{ 19 },
+	{ 30 },
+	{ 26 },
+	{ 26 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 71 },
+	{ 85 },
+	{ 66 },
+	{ 52 },
+	{ 47 },
+	{ 61 },
+	{ 34 },
+	{ 35 },
+	{ 52 },
+	{ 33 },
+	{ 30 },
+	{ 32 },
+	{ 31 },
+	{ 28 },
+	{ 33 },
+	{ 25 },
+	{ 31 },
+	{ 19 },
+	{ 29 },
+	{ 26 },
+	{ 31 },
+	{ 36 },
+	{ 37 },
+	{ 29 },
+	{ 39 },
+	{ 40 },
+	{ 36 },
+	{ 33 },
+	{ 33 },
+	{ 37 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 37 },
+	{ 36 },
+	{ 33 },
+	{ 37 },
+	{ 41 },
+	{ 38 },
+	{ 47 },
+	{ 49 },
+	{ 37 },
+	{ 49 },
+	{ 51 },
+	{ 47 },
+	{ 41 },
+	{ 46 },
+	{ 49 },
+	{ 6 },
+	{ 17 },
+	{ 29 },
+	{ 2 },
+	{ 4 },
+	{ 17 },
+	{ 1 },
+	{ 2 },
+	{ 2 },
+	{ 37 },
+	{ 36 },
+	{ 19 },
+	{ 35 },
+	{ 34 },
+	{ 17 },
+	{ 108 },
+	{ 45 },
+	{ 52 },
+	{ 56 },
+	{ 152 },
+	{ 142 },
+	{ 152 },
+	{ 56 },
+	{ 164 },
+	{ 55 },
+	{ 169 },
+	{ 63 },
+	{ 63 },
+	{ 175 },
+	{ 55 },
+	{ 68 },
+	{ 100 },
+	{ 63 },
+	{ 53 },
+	{ 100 },
+	{ 51 },
+	{ 51 },
+	{ 53 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 51 },
+	{ 49 },
+	{ 50 },
+	{ 51 },
+	{ 66 },
+	{ 48 },
+	{ 48 },
+	{ 37 },
+	{ 47 },
+	{ 42 },
+	{ 33 },
+	{ 43 },
+	{ 37 },
+	{ 22 },
+	{ 44 },
+	{ 33 },
+	{ 9 },
+	{ 47 },
+	{ 22 },
+	{ 46 },
+	{ 51 },
+	{ 51 },
+	{ 6 },
+	{ 46 },
+	{ 7 },
+	{ 6 },
+	{ 7 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 43 },
+	{ 49 },
+	{ 50 },
+	{ 49 },
+	{ 46 },
+	{ 49 },
+	{ 38 },
+	{ 45 },
+	{ 47 },
+	{ 18 },
+	{ 51 },
+	{ 38 },
+	{ 45 },
+	{ 38 },
+	{ 51 },
+	{ 49 },
+	{ 51 },
+	{ 19 },
+	{ 49 },
+	{ 51 },
+	{ 50 },
+	{ 24 },
+	{ 18 },
+	{ 34 },
+	{ 108 },
+	{ 75 },
+	{ 45 },
+	{ 49 },
+	{ 19 },
+	{ 22 },
+	{ 44 },
+	{ 37 },
+	{ 45 },
+	{ 33 },
+	{ 46 },
+	{ 45 },
+	{ 20 },
+	{ 43 },
+	{ 33 },
+	{ 5 },
+	{ 16 },
+	{ 10 },
+	{ 28 },
+	{ 31 },
+	{ 26 },
+	{ 0 },
+	{ 1 },
+	{ 42 },
+	{ 88 },
+	{ 54 },
+	{ 1 },
+	{ 85 },
+	{ 59 },
+	{ 54 },
+	{ 29 },
+	{ 7 },
+	{ 59 },
+	{ 2 },
+	{ 2 },
+	{ 7 },
+	{ 1 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 8 },
+	{ 1 },
+	{ 2 },
+	{ 16 },
+	{ 2 },
+	{ 2 },
+	{ 8 },
+	{ 2 },
+	{ 50 },
+	{ 109 },
+	{ 51 },
+	{ 130 },
+	{ 142 },
+	{ 109 },
+	{ 52 },
+	{ 62 },
+	{ 130 },
+	{ 28 },
+	{ 35 },
+	{ 62 },
+	{ 24 },
+	{ 27 },
+	{ 25 },
+	{ 40 },
+	{ 41 },
+	{ 24 },
+	{ 0 },
+	{ 36 },
+	{ 27 },
+	{ 51 },
+	{ 49 },
+	{ 49 },
+	{ 27 },
+	{ 2 },
+	{ 1 },
+	{ 12 },
+	{ 18 },
+	{ 20 },
+	{ 48 },
+	{ 66 },
+	{ 48 },
+	{ 51 },
+	{ 48 },
+	{ 50 },
+	{ 49 },
+	{ 50 },
+	{ 51 },
+	{ 49 },
+	{ 49 },
+	{ 50 },
+	{ 32 },
+	{ 14 },
+	{ 17 },
+	{ 51 },
+	{ 50 },
+	{ 49 },
+	{ 49 },
+	{ 51 },
+	{ 48 },
+	{ 2 },
+	{ 2 },
+	{ 0 },
+	{ 2 },
+	{ 5 },
+	{ 2 },
+	{ 2 },
+	{ 26 },
+	{ 5 },
+	{ 66 },
+	{ 61 },
+	{ 50 },
+	{ 98 },
+	{ 61 },
+	{ 66 },
+	{ 40 },
+	{ 34 },
+	{ 32 },
+	{ 12 },
+	{ 28 },
+	{ 32 },
+	{ 41 },
+	{ 26 },
+	{ 2 },
+	{ 24 },
+	{ 24 },
+	{ 25 },
+	{ 40 },
+	{ 24 },
+	{ 24 },
+	{ 22 },
+	{ 25 },
+	{ 20 },
+	{ 41 },
+	{ 44 },
+	{ 26 },
+	{ 45 },
+	{ 49 },
+	{ 47 },
+	{ 49 },
+	{ 45 },
+	{ 48 },
+	{ 46 },
+	{ 48 },
+	{ 42 },
+	{ 46 },
+	{ 75 },
+	{ 108 },
+	{ 49 },
+	{ 75 },
+	{ 42 },
+	{ 38 },
+	{ 35 },
+	{ 16 },
+	{ 16 },
+	{ 26 },
+	{ 37 },
+	{ 18 },
+	{ 18 },
+	{ 17 },
+	{ 16 },
+	{ 18 },
+	{ 16 },
+	{ 19 },
+	{ 18 },
+	{ 17 },
+	{ 21 },
+	{ 22 },
+	{ 17 },
+	{ 25 },
+	{ 28 },
+	{ 21 },
+	{ 25 },
+	{ 35 },
+	{ 25 },
+	{ 24 },
+	{ 36 },
+	{ 25 },
+	{ 28 },
+	{ 30 },
+	{ 24 },
+	{ 31 },
+	{ 28 },
+	{ 28 },
+	{ 39 },
+	{ 28 },
+	{ 31 },
+	{ 45 },
+	{ 45 },
+	{ 39 },
+	{ 51 },
+	{ 68 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 49 },
+	{ 51 },
+	{ 51 },
+	{ 49 },
+	{ 49 },
+	{ 51 },
+	{ 49 },
+	{ 51 },
+	{ 51 },
+	{ 49 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 49 },
+	{ 50 },
+	{ 51 },
+	{ 43 },
+	{ 44 },
+	{ 37 },
+	{ 46 },
+	{ 43 },
+	{ 14 },
+	{ 43 },
+	{ 46 },
+	{ 49 },
+	{ 16 },
+	{ 17 },
+	{ 18 },
+	{ 49 },
+	{ 46 },
+	{ 44 },
+	{ 49 },
+	{ 41 },
+	{ 27 },
+	{ 49 },
+	{ 36 },
+	{ 48 },
+	{ 42 },
+	{ 37 },
+	{ 52 },
+	{ 45 },
+	{ 39 },
+	{ 37 },
+	{ 52 },
+	{ 70 },
+	{ 86 },
+	{ 67 },
+	{ 86 },
+	{ 80 },
+	{ 37 },
+	{ 37 },
+	{ 42 },
+	{ 42 },
+	{ 39 },
+	{ 45 },
+	{ 74 },
+	{ 80 },
+	{ 48 },
+	{ 58 },
+	{ 48 },
+	{ 37 },
+	{ 29 },
+	{ 20 },
+	{ 33 },
+	{ 41 },
+	{ 44 },
+	{ 35 },
+	{ 37 },
+	{ 44 },
+	{ 43 },
+	{ 10 },
+	{ 37 },
+	{ 20 },
+	{ 2 },
+	{ 10 },
+	{ 4 },
+	{ 0 },
+	{ 2 },
+	{ 4 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 1 },
+	{ 2 },
+	{ 2 },
+	{ 28 },
+	{ 0 },
+	{ 2 },
+	{ 41 },
+	{ 41 },
+	{ 40 },
+	{ 36 },
+	{ 37 },
+	{ 39 },
+	{ 38 },
+	{ 45 },
+	{ 50 },
+	{ 29 },
+	{ 38 },
+	{ 46 },
+	{ 14 },
+	{ 12 },
+	{ 17 },
+	{ 28 },
+	{ 43 },
+	{ 45 },
+	{ 17 },
+	{ 15 },
+	{ 21 },
+	{ 14 },
+	{ 43 },
+	{ 28 },
+	{ 39 },
+	{ 38 },
+	{ 39 },
+	{ 38 },
+	{ 38 },
+	{ 39 },
+	{ 29 },
+	{ 33 },
+	{ 38 },
+	{ 36 },
+	{ 32 },
+	{ 29 },
+	{ 0 },
+	{ 33 },
+	{ 29 },
+	{ 32 },
+	{ 37 },
+	{ 46 },
+	{ 19 },
+	{ 37 },
+	{ 32 },
+	{ 19 },
+	{ 18 },
+	{ 37 },
+	{ 40 },
+	{ 18 },
+	{ 35 },
+	{ 35 },
+	{ 18 },
+	{ 18 },
+	{ 38 },
+	{ 18 },
+	{ 30 },
+	{ 19 },
+	{ 20 },
+	{ 21 },
+	{ 34 },
+	{ 35 },
+	{ 21 },
+	{ 56 },
+	{ 35 },
+	{ 34 },
+	{ 99 },
+	{ 56 },
+	{ 98 },
+	{ 99 },
+	{ 98 },
+	{ 85 },
+	{ 99 },
+	{ 100 },
+	{ 89 },
+	{ 30 },
+	{ 20 },
+	{ 29 },
+	{ 19 },
+	{ 20 },
+	{ 19 },
+	{ 35 },
+	{ 37 },
+	{ 19 },
+	{ 47 },
+	{ 37 },
+	{ 56 },
+	{ 58 },
+	{ 47 },
+	{ 56 },
+	{ 64 },
+	{ 58 },
+	{ 89 },
+	{ 44 },
+	{ 26 },
+	{ 43 },
+	{ 21 },
+	{ 26 },
+	{ 24 },
+	{ 26 },
+	{ 30 },
+	{ 25 },
+	{ 30 },
+	{ 70 },
+	{ 53 },
+	{ 70 },
+	{ 148 },
+	{ 53 },
+	{ 158 },
+	{ 150 },
+	{ 170 },
+	{ 150 },
+	{ 97 },
+	{ 101 },
+	{ 26 },
+	{ 21 },
+	{ 29 },
+	{ 106 },
+	{ 129 },
+	{ 119 },
+	{ 158 },
+	{ 170 },
+	{ 164 },
+	{ 36 },
+	{ 38 },
+	{ 30 },
+	{ 31 },
+	{ 33 },
+	{ 31 },
+	{ 33 },
+	{ 30 },
+	{ 35 },
+	{ 38 },
+	{ 37 },
+	{ 41 },
+	{ 97 },
+	{ 31 },
+	{ 37 },
+	{ 1 },
+	{ 51 },
+	{ 0 },
+	{ 0 },
+	{ 31 },
+	{ 0 },
+	{ 36 },
+	{ 47 },
+	{ 47 },
+	{ 94 },
+	{ 65 },
+	{ 125 },
+	{ 48 },
+	{ 39 },
+	{ 35 },
+	{ 47 },
+	{ 35 },
+	{ 33 },
+	{ 39 },
+	{ 29 },
+	{ 35 },
+	{ 35 },
+	{ 28 },
+	{ 33 },
+	{ 29 },
+	{ 24 },
+	{ 28 },
+	{ 28 },
+	{ 22 },
+	{ 23 },
+	{ 24 },
+	{ 19 },
+	{ 23 },
+	{ 22 },
+	{ 23 },
+	{ 26 },
+	{ 19 },
+	{ 25 },
+	{ 26 },
+	{ 23 },
+	{ 26 },
+	{ 30 },
+	{ 25 },
+	{ 53 },
+	{ 56 },
+	{ 26 },
+	{ 56 },
+	{ 60 },
+	{ 53 },
+	{ 136 },
+	{ 56 },
+	{ 56 },
+	{ 133 },
+	{ 60 },
+	{ 136 },
+	{ 155 },
+	{ 138 },
+	{ 133 },
+	{ 138 },
+	{ 124 },
+	{ 155 },
+	{ 117 },
+	{ 100 },
+	{ 138 },
+	{ 100 },
+	{ 93 },
+	{ 117 },
+	{ 48 },
+	{ 47 },
+	{ 100 },
+	{ 47 },
+	{ 45 },
+	{ 48 },
+	{ 45 },
+	{ 48 },
+	{ 48 },
+	{ 47 },
+	{ 50 },
+	{ 49 },
+	{ 50 },
+	{ 51 },
+	{ 112 },
+	{ 134 },
+	{ 148 },
+	{ 113 },
+	{ 136 },
+	{ 119 },
+	{ 119 },
+	{ 153 },
+	{ 152 },
+	{ 128 },
+	{ 148 },
+	{ 134 },
+	{ 136 },
+	{ 162 },
+	{ 153 },
+	{ 153 },
+	{ 155 },
+	{ 171 },
+	{ 139 },
+	{ 124 },
+	{ 129 },
+	{ 162 },
+	{ 122 },
+	{ 155 },
+	{ 155 },
+	{ 117 },
+	{ 133 },
+	{ 85 },
+	{ 48 },
+	{ 94 },
+	{ 94 },
+	{ 48 },
+	{ 93 },
+	{ 93 },
+	{ 49 },
+	{ 72 },
+	{ 171 },
+	{ 133 },
+	{ 152 },
+	{ 133 },
+	{ 101 },
+	{ 99 },
+	{ 72 },
+	{ 51 },
+	{ 51 },
+	{ 42 },
+	{ 48 },
+	{ 49 },
+	{ 49 },
+	{ 58 },
+	{ 48 },
+	{ 48 },
+	{ 76 },
+	{ 132 },
+	{ 76 },
+	{ 157 },
+	{ 132 },
+	{ 157 },
+	{ 128 },
+	{ 129 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 42 },
+	{ 38 },
+	{ 163 },
+	{ 168 },
+	{ 108 },
+	{ 0 },
+	{ 129 },
+	{ 0 },
+	{ 134 },
+	{ 141 },
+	{ 128 },
+	{ 133 },
+	{ 108 },
+	{ 0 },
+	{ 0 },
+	{ 108 },
+	{ 122 },
+	{ 89 },
+	{ 43 },
+	{ 92 },
+	{ 76 },
+	{ 80 },
+	{ 0 },
+	{ 81 },
+	{ 117 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 12 },
+	{ 0 },
+	{ 43 },
+	{ 89 },
+	{ 60 },
+	{ 45 },
+	{ 71 },
+	{ 42 },
+	{ 46 },
+	{ 47 },
+	{ 75 },
+	{ 136 },
+	{ 129 },
+	{ 126 },
+	{ 114 },
+	{ 126 },
+	{ 118 },
+	{ 116 },
+	{ 118 },
+	{ 128 },
+	{ 118 },
+	{ 128 },
+	{ 171 },
+	{ 129 },
+	{ 125 },
+	{ 126 },
+	{ 126 },
+	{ 147 },
+	{ 137 },
+	{ 118 },
+	{ 137 },
+	{ 128 },
+	{ 128 },
+	{ 144 },
+	{ 171 },
+	{ 125 },
+	{ 0 },
+	{ 147 },
+	{ 147 },
+	{ 46 },
+	{ 53 },
+	{ 137 },
+	{ 53 },
+	{ 68 },
+	{ 144 },
+	{ 68 },
+	{ 84 },
+	{ 0 },
+	{ 38 },
+	{ 38 },
+	{ 46 },
+	{ 38 },
+	{ 41 },
+	{ 53 },
+	{ 41 },
+	{ 68 },
+	{ 68 },
+	{ 46 },
+	{ 84 },
+	{ 38 },
+	{ 47 },
+	{ 51 },
+	{ 38 },
+	{ 51 },
+	{ 51 },
+	{ 41 },
+	{ 51 },
+	{ 51 },
+	{ 46 },
+	{ 51 },
+	{ 51 },
+	{ 47 },
+	{ 49 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 62 },
+	{ 51 },
+	{ 49 },
+	{ 132 },
+	{ 168 },
+	{ 51 },
+	{ 168 },
+	{ 51 },
+	{ 51 },
+	{ 179 },
+	{ 62 },
+	{ 62 },
+	{ 182 },
+	{ 101 },
+	{ 132 },
+	{ 136 },
+	{ 168 },
+	{ 168 },
+	{ 114 },
+	{ 179 },
+	{ 179 },
+	{ 116 },
+	{ 118 },
+	{ 182 },
+	{ 118 },
+	{ 184 },
+	{ 51 },
+	{ 101 },
+	{ 166 },
+	{ 101 },
+	{ 170 },
+	{ 166 },
+	{ 50 },
+	{ 166 },
+	{ 170 },
+	{ 166 },
+	{ 184 },
+	{ 170 },
+	{ 84 },
+	{ 119 },
+	{ 111 },
+	{ 1 },
+	{ 0 },
+	{ 88 },
+	{ 149 },
+	{ 164 },
+	{ 153 },
+	{ 155 },
+	{ 127 },
+	{ 139 },
+	{ 38 },
+	{ 36 },
+	{ 33 },
+	{ 33 },
+	{ 31 },
+	{ 33 },
+	{ 22 },
+	{ 22 },
+	{ 22 },
+	{ 12 },
+	{ 15 },
+	{ 18 },
+	{ 14 },
+	{ 18 },
+	{ 18 },
+	{ 99 },
+	{ 129 },
+	{ 39 },
+	{ 56 },
+	{ 150 },
+	{ 162 },
+	{ 161 },
+	{ 129 },
+	{ 123 },
+	{ 150 },
+	{ 180 },
+	{ 187 },
+	{ 65 },
+	{ 50 },
+	{ 130 },
+	{ 121 },
+	{ 50 },
+	{ 124 },
+	{ 50 },
+	{ 27 },
+	{ 28 },
+	{ 20 },
+	{ 15 },
+	{ 24 },
+	{ 27 },
+	{ 19 },
+	{ 28 },
+	{ 18 },
+	{ 19 },
+	{ 12 },
+	{ 12 },
+	{ 19 },
+	{ 12 },
+	{ 12 },
+	{ 16 },
+	{ 10 },
+	{ 10 },
+	{ 20 },
+	{ 42 },
+	{ 162 },
+	{ 175 },
+	{ 77 },
+	{ 77 },
+	{ 175 },
+	{ 85 },
+	{ 85 },
+	{ 184 },
+	{ 83 },
+	{ 83 },
+	{ 181 },
+	{ 51 },
+	{ 187 },
+	{ 192 },
+	{ 162 },
+	{ 175 },
+	{ 192 },
+	{ 194 },
+	{ 184 },
+	{ 194 },
+	{ 181 },
+	{ 181 },
+	{ 186 },
+	{ 96 },
+	{ 50 },
+	{ 42 },
+	{ 118 },
+	{ 118 },
+	{ 42 },
+	{ 108 },
+	{ 108 },
+	{ 41 },
+	{ 88 },
+	{ 88 },
+	{ 45 },
+	{ 50 },
+	{ 28 },
+	{ 30 },
+	{ 42 },
+	{ 42 },
+	{ 30 },
+	{ 41 },
+	{ 41 },
+	{ 33 },
+	{ 45 },
+	{ 45 },
+	{ 37 },
+	{ 49 },
+	{ 28 },
+	{ 22 },
+	{ 30 },
+	{ 30 },
+	{ 21 },
+	{ 33 },
+	{ 33 },
+	{ 22 },
+	{ 37 },
+	{ 37 },
+	{ 29 },
+	{ 47 },
+	{ 51 },
+	{ 47 },
+	{ 45 },
+	{ 124 },
+	{ 116 },
+	{ 119 },
+	{ 106 },
+	{ 116 },
+	{ 129 },
+	{ 93 },
+	{ 98 },
+	{ 124 },
+	{ 116 },
+	{ 98 },
+	{ 105 },
+	{ 45 },
+	{ 68 },
+	{ 93 },
+	{ 98 },
+	{ 68 },
+	{ 87 },
+	{ 33 },
+	{ 33 },
+	{ 45 },
+	{ 96 },
+	{ 63 },
+	{ 36 },
+	{ 23 },
+	{ 19 },
+	{ 33 },
+	{ 63 },
+	{ 28 },
+	{ 36 },
+	{ 25 },
+	{ 20 },
+	{ 23 },
+	{ 19 },
+	{ 20 },
+	{ 23 },
+	{ 26 },
+	{ 22 },
+	{ 25 },
+	{ 20 },
+	{ 22 },
+	{ 22 },
+	{ 30 },
+	{ 32 },
+	{ 26 },
+	{ 22 },
+	{ 32 },
+	{ 33 },
+	{ 60 },
+	{ 52 },
+	{ 30 },
+	{ 32 },
+	{ 52 },
+	{ 77 },
+	{ 60 },
+	{ 119 },
+	{ 106 },
+	{ 52 },
+	{ 106 },
+	{ 127 },
+	{ 18 },
+	{ 16 },
+	{ 24 },
+	{ 16 },
+	{ 18 },
+	{ 22 },
+	{ 18 },
+	{ 22 },
+	{ 26 },
+	{ 26 },
+	{ 22 },
+	{ 34 },
+	{ 34 },
+	{ 27 },
+	{ 49 },
+	{ 22 },
+	{ 25 },
+	{ 16 },
+	{ 25 },
+	{ 29 },
+	{ 18 },
+	{ 29 },
+	{ 30 },
+	{ 22 },
+	{ 22 },
+	{ 30 },
+	{ 27 },
+	{ 27 },
+	{ 35 },
+	{ 46 },
+	{ 33 },
+	{ 61 },
+	{ 22 },
+	{ 61 },
+	{ 75 },
+	{ 29 },
+	{ 75 },
+	{ 76 },
+	{ 30 },
+	{ 30 },
+	{ 76 },
+	{ 35 },
+	{ 35 },
+	{ 78 },
+	{ 47 },
+	{ 77 },
+	{ 123 },
+	{ 61 },
+	{ 123 },
+	{ 133 },
+	{ 61 },
+	{ 133 },
+	{ 147 },
+	{ 75 },
+	{ 76 },
+	{ 147 },
+	{ 78 },
+	{ 78 },
+	{ 149 },
+	{ 45 },
+	{ 127 },
+	{ 165 },
+	{ 123 },
+	{ 165 },
+	{ 181 },
+	{ 133 },
+	{ 181 },
+	{ 186 },
+	{ 147 },
+	{ 147 },
+	{ 186 },
+	{ 149 },
+	{ 149 },
+	{ 186 },
+	{ 81 },
+	{ 129 },
+	{ 141 },
+	{ 165 },
+	{ 141 },
+	{ 149 },
+	{ 181 },
+	{ 149 },
+	{ 155 },
+	{ 186 },
+	{ 186 },
+	{ 155 },
+	{ 186 },
+	{ 186 },
+	{ 146 },
+	{ 106 },
+	{ 105 },
+	{ 95 },
+	{ 141 },
+	{ 95 },
+	{ 94 },
+	{ 149 },
+	{ 94 },
+	{ 99 },
+	{ 155 },
+	{ 155 },
+	{ 99 },
+	{ 146 },
+	{ 146 },
+	{ 91 },
+	{ 54 },
+	{ 87 },
+	{ 41 },
+	{ 95 },
+	{ 41 },
+	{ 41 },
+	{ 94 },
+	{ 41 },
+	{ 45 },
+	{ 99 },
+	{ 99 },
+	{ 45 },
+	{ 91 },
+	{ 91 },
+	{ 48 },
+	{ 51 },
+	{ 36 },
+	{ 36 },
+	{ 39 },
+	{ 35 },
+	{ 36 },
+	{ 41 },
+	{ 36 },
+	{ 42 },
+	{ 41 },
+	{ 45 },
+	{ 42 },
+	{ 47 },
+	{ 48 },
+	{ 47 },
+	{ 50 },
+	{ 36 },
+	{ 28 },
+	{ 36 },
+	{ 35 },
+	{ 24 },
+	{ 22 },
+	{ 36 },
+	{ 22 },
+	{ 26 },
+	{ 42 },
+	{ 26 },
+	{ 34 },
+	{ 47 },
+	{ 34 },
+	{ 50 },
+	{ 51 },
+	{ 54 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 51 },
+	{ 50 },
+	{ 49 },
+	{ 51 },
+	{ 47 },
+	{ 45 },
+	{ 51 },
+	{ 46 },
+	{ 47 },
+	{ 24 },
+	{ 23 },
+	{ 22 },
+	{ 24 },
+	{ 21 },
+	{ 30 },
+	{ 110 },
+	{ 1 },
+	{ 3 },
+	{ 110 },
+	{ 133 },
+	{ 106 },
+	{ 110 },
+	{ 124 },
+	{ 146 },
+	{ 28 },
+	{ 22 },
+	{ 23 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 6 },
+	{ 60 },
+	{ 35 },
+	{ 32 },
+	{ 32 },
+	{ 0 },
+	{ 36 },
+	{ 35 },
+	{ 36 },
+	{ 157 },
+	{ 87 },
+	{ 67 },
+	{ 171 },
+	{ 157 },
+	{ 138 },
+	{ 164 },
+	{ 157 },
+	{ 146 },
+	{ 161 },
+	{ 164 },
+	{ 142 },
+	{ 142 },
+	{ 146 },
+	{ 134 },
+	{ 47 },
+	{ 64 },
+	{ 66 },
+	{ 87 },
+	{ 40 },
+	{ 67 },
+	{ 67 },
+	{ 41 },
+	{ 39 },
+	{ 138 },
+	{ 67 },
+	{ 48 },
+	{ 167 },
+	{ 138 },
+	{ 117 },
+	{ 148 },
+	{ 167 },
+	{ 155 },
+	{ 111 },
+	{ 122 },
+	{ 68 },
+	{ 39 },
+	{ 37 },
+	{ 26 },
+	{ 126 },
+	{ 156 },
+	{ 136 },
+	{ 119 },
+	{ 126 },
+	{ 113 },
+	{ 59 },
+	{ 47 },
+	{ 81 },
+	{ 42 },
+	{ 44 },
+	{ 43 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 133 },
+	{ 107 },
+	{ 61 },
+	{ 46 },
+	{ 61 },
+	{ 45 },
+	{ 84 },
+	{ 130 },
+	{ 45 },
+	{ 133 },
+	{ 154 },
+	{ 84 },
+	{ 175 },
+	{ 176 },
+	{ 133 },
+	{ 0 },
+	{ 0 },
+	{ 42 },
+	{ 0 },
+	{ 0 },
+	{ 49 },
+	{ 0 },
+	{ 0 },
+	{ 42 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 42 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 146 },
+	{ 122 },
+	{ 136 },
+	{ 0 },
+	{ 117 },
+	{ 0 },
+	{ 110 },
+	{ 76 },
+	{ 0 },
+	{ 130 },
+	{ 89 },
+	{ 116 },
+	{ 60 },
+	{ 95 },
+	{ 80 },
+	{ 60 },
+	{ 89 },
+	{ 130 },
+	{ 95 },
+	{ 130 },
+	{ 80 },
+	{ 0 },
+	{ 121 },
+	{ 146 },
+	{ 43 },
+	{ 56 },
+	{ 94 },
+	{ 40 },
+	{ 12 },
+	{ 71 },
+	{ 131 },
+	{ 58 },
+	{ 82 },
+	{ 157 },
+	{ 76 },
+	{ 58 },
+	{ 139 },
+	{ 128 },
+	{ 131 },
+	{ 124 },
+	{ 107 },
+	{ 133 },
+	{ 141 },
+	{ 143 },
+	{ 148 },
+	{ 121 },
+	{ 148 },
+	{ 143 },
+	{ 68 },
+	{ 38 },
+	{ 36 },
+	{ 70 },
+	{ 30 },
+	{ 68 },
+	{ 30 },
+	{ 30 },
+	{ 22 },
+	{ 30 },
+	{ 31 },
+	{ 26 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 51 },
+	{ 81 },
+	{ 54 },
+	{ 50 },
+	{ 49 },
+	{ 47 },
+	{ 158 },
+	{ 142 },
+	{ 121 },
+	{ 48 },
+	{ 83 },
+	{ 46 },
+	{ 37 },
+	{ 48 },
+	{ 46 },
+	{ 36 },
+	{ 33 },
+	{ 31 },
+	{ 31 },
+	{ 33 },
+	{ 30 },
+	{ 21 },
+	{ 22 },
+	{ 26 },
+	{ 30 },
+	{ 21 },
+	{ 26 },
+	{ 35 },
+	{ 30 },
+	{ 26 },
+	{ 37 },
+	{ 35 },
+	{ 37 },
+	{ 33 },
+	{ 35 },
+	{ 31 },
+	{ 0 },
+	{ 3 },
+	{ 1 },
+	{ 37 },
+	{ 34 },
+	{ 36 },
+	{ 37 },
+	{ 35 },
+	{ 40 },
+	{ 101 },
+	{ 37 },
+	{ 40 },
+	{ 161 },
+	{ 101 },
+	{ 87 },
+	{ 170 },
+	{ 161 },
+	{ 157 },
+	{ 164 },
+	{ 170 },
+	{ 164 },
+	{ 153 },
+	{ 164 },
+	{ 161 },
+	{ 139 },
+	{ 143 },
+	{ 142 },
+	{ 37 },
+	{ 22 },
+	{ 22 },
+	{ 37 },
+	{ 18 },
+	{ 19 },
+	{ 39 },
+	{ 49 },
+	{ 15 },
+	{ 18 },
+	{ 18 },
+	{ 59 },
+	{ 59 },
+	{ 77 },
+	{ 19 },
+	{ 16 },
+	{ 19 },
+	{ 77 },
+	{ 20 },
+	{ 16 },
+	{ 85 },
+	{ 45 },
+	{ 20 },
+	{ 83 },
+	{ 96 },
+	{ 51 },
+	{ 51 },
+	{ 99 },
+	{ 51 },
+	{ 96 },
+	{ 186 },
+	{ 135 },
+	{ 99 },
+	{ 194 },
+	{ 152 },
+	{ 186 },
+	{ 192 },
+	{ 160 },
+	{ 194 },
+	{ 162 },
+	{ 160 },
+	{ 192 },
+	{ 180 },
+	{ 162 },
+	{ 162 },
+	{ 157 },
+	{ 162 },
+	{ 161 },
+	{ 123 },
+	{ 130 },
+	{ 157 },
+	{ 164 },
+	{ 167 },
+	{ 154 },
+	{ 130 },
+	{ 154 },
+	{ 167 },
+	{ 71 },
+	{ 130 },
+	{ 152 },
+	{ 44 },
+	{ 71 },
+	{ 78 },
+	{ 46 },
+	{ 44 },
+	{ 45 },
+	{ 146 },
+	{ 131 },
+	{ 122 },
+	{ 121 },
+	{ 139 },
+	{ 131 },
+	{ 56 },
+	{ 43 },
+	{ 40 },
+	{ 0 },
+	{ 12 },
+	{ 6 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 83 },
+	{ 94 },
+	{ 120 },
+	{ 104 },
+	{ 123 },
+	{ 99 },
+	{ 31 },
+	{ 37 },
+	{ 45 },
+	{ 13 },
+	{ 14 },
+	{ 26 },
+	{ 45 },
+	{ 43 },
+	{ 31 },
+	{ 18 },
+	{ 12 },
+	{ 13 },
+	{ 139 },
+	{ 120 },
+	{ 163 },
+	{ 24 },
+	{ 29 },
+	{ 49 },
+	{ 39 },
+	{ 15 },
+	{ 18 },
+	{ 18 },
+	{ 15 },
+	{ 12 },
+	{ 68 },
+	{ 122 },
+	{ 70 },
+	{ 146 },
+	{ 159 },
+	{ 122 },
+	{ 142 },
+	{ 146 },
+	{ 122 },
+	{ 130 },
+	{ 134 },
+	{ 102 },
+	{ 30 },
+	{ 22 },
+	{ 31 },
+	{ 0 },
+	{ 31 },
+	{ 3 },
+	{ 133 },
+	{ 3 },
+	{ 97 },
+	{ 129 },
+	{ 133 },
+	{ 158 },
+	{ 119 },
+	{ 129 },
+	{ 149 },
+	{ 111 },
+	{ 119 },
+	{ 140 },
+	{ 51 },
+	{ 88 },
+	{ 133 },
+	{ 31 },
+	{ 51 },
+	{ 133 },
+	{ 0 },
+	{ 31 },
+	{ 84 },
+	{ 0 },
+	{ 0 },
+	{ 45 },
+	{ 161 },
+	{ 180 },
+	{ 150 },
+	{ 49 },
+	{ 129 },
+	{ 150 },
+	{ 18 },
+	{ 49 },
+	{ 56 },
+	{ 14 },
+	{ 18 },
+	{ 14 },
+	{ 23 },
+	{ 17 },
+	{ 19 },
+	{ 65 },
+	{ 23 },
+	{ 27 },
+	{ 155 },
+	{ 149 },
+	{ 168 },
+	{ 163 },
+	{ 179 },
+	{ 139 },
+	{ 149 },
+	{ 155 },
+	{ 140 },
+	{ 14 },
+	{ 10 },
+	{ 20 },
+	{ 176 },
+	{ 179 },
+	{ 155 },
+	{ 163 },
+	{ 127 },
+	{ 179 },
+	{ 104 },
+	{ 127 },
+	{ 163 },
+	{ 104 },
+	{ 126 },
+	{ 130 },
+	{ 29 },
+	{ 14 },
+	{ 13 },
+	{ 127 },
+	{ 74 },
+	{ 155 },
+	{ 104 },
+	{ 70 },
+	{ 127 },
+	{ 127 },
+	{ 155 },
+	{ 175 },
+	{ 140 },
+	{ 139 },
+	{ 130 },
+	{ 140 },
+	{ 130 },
+	{ 106 },
+	{ 164 },
+	{ 155 },
+	{ 96 },
+	{ 83 },
+	{ 142 },
+	{ 102 },
+	{ 69 },
+	{ 89 },
+	{ 121 },
+	{ 65 },
+	{ 94 },
+	{ 29 },
+	{ 14 },
+	{ 20 },
+	{ 45 },
+	{ 133 },
+	{ 149 },
+	{ 112 },
+	{ 24 },
+	{ 19 },
+	{ 23 },
+	{ 65 },
+	{ 29 },
+	{ 23 },
+	{ 19 },
+	{ 15 },
+	{ 16 },
+	{ 133 },
+	{ 112 },
+	{ 68 },
+	{ 45 },
+	{ 46 },
+	{ 102 },
+	{ 96 },
+	{ 74 },
+	{ 43 },
+	{ 70 },
+	{ 45 },
+	{ 74 },
+	{ 70 },
+	{ 99 },
+	{ 45 },
+	{ 18 },
+	{ 26 },
+	{ 45 },
+	{ 31 },
+	{ 14 },
+	{ 18 },
+	{ 106 },
+	{ 102 },
+	{ 66 },
+	{ 18 },
+	{ 19 },
+	{ 18 },
+	{ 14 },
+	{ 19 },
+	{ 13 },
+	{ 12 },
+	{ 10 },
+	{ 14 },
+	{ 16 },
+	{ 10 },
+	{ 12 },
+	{ 17 },
+	{ 16 },
+	{ 12 },
+	{ 19 },
+	{ 17 },
+	{ 14 },
+	{ 22 },
+	{ 19 },
+	{ 14 },
+	{ 21 },
+	{ 22 },
+	{ 14 },
+	{ 22 },
+	{ 21 },
+	{ 12 },
+	{ 29 },
+	{ 22 },
+	{ 12 },
+	{ 45 },
+	{ 29 },
+	{ 10 },
+	{ 51 },
+	{ 51 },
+	{ 42 },
+	{ 51 },
+	{ 50 },
+	{ 51 },
+	{ 135 },
+	{ 88 },
+	{ 51 },
+	{ 152 },
+	{ 108 },
+	{ 135 },
+	{ 160 },
+	{ 118 },
+	{ 152 },
+	{ 124 },
+	{ 118 },
+	{ 160 },
+	{ 162 },
+	{ 121 },
+	{ 162 },
+	{ 130 },
+	{ 121 },
+	{ 157 },
+	{ 130 },
+	{ 125 },
+	{ 130 },
+	{ 120 },
+	{ 125 },
+	{ 126 },
+	{ 68 },
+	{ 41 },
+	{ 109 },
+	{ 94 },
+	{ 29 },
+	{ 83 },
+	{ 83 },
+	{ 120 },
+	{ 139 },
+	{ 14 },
+	{ 19 },
+	{ 18 },
+	{ 139 },
+	{ 133 },
+	{ 94 },
+	{ 139 },
+	{ 168 },
+	{ 133 },
+	{ 168 },
+	{ 179 },
+	{ 175 },
+	{ 68 },
+	{ 33 },
+	{ 63 },
+	{ 87 },
+	{ 68 },
+	{ 65 },
+	{ 33 },
+	{ 19 },
+	{ 63 },
+	{ 19 },
+	{ 23 },
+	{ 28 },
+	{ 35 },
+	{ 41 },
+	{ 39 },
+	{ 41 },
+	{ 87 },
+	{ 65 },
+	{ 23 },
+	{ 24 },
+	{ 28 },
+	{ 24 },
+	{ 35 },
+	{ 31 },
+	{ 31 },
+	{ 33 },
+	{ 22 },
+	{ 70 },
+	{ 36 },
+	{ 66 },
+	{ 102 },
+	{ 111 },
+	{ 70 },
+	{ 134 },
+	{ 142 },
+	{ 111 },
+	{ 146 },
+	{ 161 },
+	{ 142 },
+	{ 143 },
+	{ 153 },
+	{ 146 },
+	{ 140 },
+	{ 153 },
+	{ 143 },
+	{ 88 },
+	{ 111 },
+	{ 127 },
+	{ 28 },
+	{ 111 },
+	{ 88 },
+	{ 40 },
+	{ 37 },
+	{ 41 },
+	{ 36 },
+	{ 37 },
+	{ 37 },
+	{ 159 },
+	{ 171 },
+	{ 148 },
+	{ 157 },
+	{ 170 },
+	{ 159 },
+	{ 13 },
+	{ 10 },
+	{ 10 },
+	{ 45 },
+	{ 49 },
+	{ 83 },
+	{ 10 },
+	{ 16 },
+	{ 15 },
+	{ 13 },
+	{ 14 },
+	{ 45 },
+	{ 34 },
+	{ 37 },
+	{ 38 },
+	{ 35 },
+	{ 35 },
+	{ 37 },
+	{ 32 },
+	{ 35 },
+	{ 33 },
+	{ 36 },
+	{ 35 },
+	{ 32 },
+	{ 0 },
+	{ 32 },
+	{ 33 },
+	{ 29 },
+	{ 94 },
+	{ 109 },
+	{ 19 },
+	{ 14 },
+	{ 36 },
+	{ 19 },
+	{ 36 },
+	{ 41 },
+	{ 41 },
+	{ 66 },
+	{ 18 },
+	{ 39 },
+	{ 36 },
+	{ 18 },
+	{ 36 },
+	{ 33 },
+	{ 18 },
+	{ 21 },
+	{ 19 },
+	{ 18 },
+	{ 37 },
+	{ 19 },
+	{ 21 },
+	{ 47 },
+	{ 48 },
+	{ 36 },
+	{ 69 },
+	{ 83 },
+	{ 48 },
+	{ 33 },
+	{ 31 },
+	{ 19 },
+	{ 22 },
+	{ 21 },
+	{ 18 },
+	{ 36 },
+	{ 21 },
+	{ 22 },
+	{ 47 },
+	{ 47 },
+	{ 36 },
+	{ 66 },
+	{ 69 },
+	{ 47 },
+	{ 64 },
+	{ 89 },
+	{ 69 },
+	{ 66 },
+	{ 41 },
+	{ 112 },
+	{ 45 },
+	{ 40 },
+	{ 45 },
+	{ 110 },
+	{ 112 },
+	{ 48 },
+	{ 110 },
+	{ 130 },
+	{ 134 },
+	{ 109 },
+	{ 134 },
+	{ 130 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 51 },
+	{ 42 },
+	{ 0 },
+	{ 51 },
+	{ 51 },
+	{ 24 },
+	{ 1 },
+	{ 51 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 49 },
+	{ 0 },
+	{ 46 },
+	{ 82 },
+	{ 49 },
+	{ 49 },
+	{ 122 },
+	{ 82 },
+	{ 93 },
+	{ 136 },
+	{ 122 },
+	{ 93 },
+	{ 0 },
+	{ 17 },
+	{ 29 },
+	{ 48 },
+	{ 0 },
+	{ 32 },
+	{ 68 },
+	{ 83 },
+	{ 42 },
+	{ 37 },
+	{ 45 },
+	{ 33 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 41 },
+	{ 40 },
+	{ 0 },
+	{ 41 },
+	{ 45 },
+	{ 40 },
+	{ 92 },
+	{ 94 },
+	{ 76 },
+	{ 0 },
+	{ 155 },
+	{ 117 },
+	{ 117 },
+	{ 155 },
+	{ 122 },
+	{ 116 },
+	{ 92 },
+	{ 110 },
+	{ 110 },
+	{ 122 },
+	{ 116 },
+	{ 49 },
+	{ 0 },
+	{ 84 },
+	{ 81 },
+	{ 64 },
+	{ 97 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 84 },
+	{ 0 },
+	{ 83 },
+	{ 133 },
+	{ 129 },
+	{ 168 },
+	{ 163 },
+	{ 128 },
+	{ 133 },
+	{ 108 },
+	{ 128 },
+	{ 109 },
+	{ 0 },
+	{ 0 },
+	{ 122 },
+	{ 51 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 67 },
+	{ 51 },
+	{ 89 },
+	{ 72 },
+	{ 67 },
+	{ 121 },
+	{ 93 },
+	{ 89 },
+	{ 134 },
+	{ 94 },
+	{ 121 },
+	{ 127 },
+	{ 85 },
+	{ 134 },
+	{ 108 },
+	{ 59 },
+	{ 134 },
+	{ 49 },
+	{ 46 },
+	{ 48 },
+	{ 43 },
+	{ 46 },
+	{ 46 },
+	{ 0 },
+	{ 0 },
+	{ 43 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 9 },
+	{ 0 },
+	{ 24 },
+	{ 24 },
+	{ 51 },
+	{ 9 },
+	{ 51 },
+	{ 51 },
+	{ 47 },
+	{ 51 },
+	{ 50 },
+	{ 0 },
+	{ 49 },
+	{ 51 },
+	{ 0 },
+	{ 44 },
+	{ 49 },
+	{ 0 },
+	{ 49 },
+	{ 44 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 37 },
+	{ 0 },
+	{ 0 },
+	{ 27 },
+	{ 0 },
+	{ 0 },
+	{ 78 },
+	{ 0 },
+	{ 148 },
+	{ 91 },
+	{ 0 },
+	{ 87 },
+	{ 148 },
+	{ 0 },
+	{ 73 },
+	{ 87 },
+	{ 103 },
+	{ 0 },
+	{ 0 },
+	{ 49 },
+	{ 43 },
+	{ 0 },
+	{ 50 },
+	{ 49 },
+	{ 0 },
+	{ 50 },
+	{ 50 },
+	{ 12 },
+	{ 50 },
+	{ 50 },
+	{ 51 },
+	{ 156 },
+	{ 129 },
+	{ 162 },
+	{ 124 },
+	{ 113 },
+	{ 103 },
+	{ 49 },
+	{ 51 },
+	{ 44 },
+	{ 51 },
+	{ 51 },
+	{ 49 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 56 },
+	{ 50 },
+	{ 56 },
+	{ 101 },
+	{ 50 },
+	{ 101 },
+	{ 117 },
+	{ 49 },
+	{ 117 },
+	{ 122 },
+	{ 43 },
+	{ 122 },
+	{ 129 },
+	{ 103 },
+	{ 103 },
+	{ 127 },
+	{ 73 },
+	{ 87 },
+	{ 73 },
+	{ 134 },
+	{ 148 },
+	{ 87 },
+	{ 121 },
+	{ 91 },
+	{ 148 },
+	{ 89 },
+	{ 78 },
+	{ 91 },
+	{ 67 },
+	{ 27 },
+	{ 78 },
+	{ 51 },
+	{ 37 },
+	{ 27 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 49 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 103 },
+	{ 73 },
+	{ 0 },
+	{ 49 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 12 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 12 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 119 },
+	{ 113 },
+	{ 75 },
+	{ 45 },
+	{ 69 },
+	{ 49 },
+	{ 51 },
+	{ 45 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 44 },
+	{ 51 },
+	{ 50 },
+	{ 51 },
+	{ 48 },
+	{ 50 },
+	{ 49 },
+	{ 45 },
+	{ 48 },
+	{ 47 },
+	{ 51 },
+	{ 51 },
+	{ 49 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 131 },
+	{ 143 },
+	{ 119 },
+	{ 143 },
+	{ 141 },
+	{ 126 },
+	{ 129 },
+	{ 156 },
+	{ 139 },
+	{ 141 },
+	{ 134 },
+	{ 124 },
+	{ 134 },
+	{ 81 },
+	{ 124 },
+	{ 81 },
+	{ 46 },
+	{ 85 },
+	{ 46 },
+	{ 44 },
+	{ 45 },
+	{ 85 },
+	{ 127 },
+	{ 81 },
+	{ 43 },
+	{ 40 },
+	{ 49 },
+	{ 84 },
+	{ 83 },
+	{ 0 },
+	{ 103 },
+	{ 122 },
+	{ 136 },
+	{ 0 },
+	{ 122 },
+	{ 0 },
+	{ 84 },
+	{ 80 },
+	{ 92 },
+	{ 0 },
+	{ 80 },
+	{ 84 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 92 },
+	{ 121 },
+	{ 84 },
+	{ 92 },
+	{ 81 },
+	{ 0 },
+	{ 84 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 103 },
+	{ 129 },
+	{ 0 },
+	{ 0 },
+	{ 168 },
+	{ 129 },
+	{ 93 },
+	{ 108 },
+	{ 168 },
+	{ 93 },
+	{ 48 },
+	{ 59 },
+	{ 48 },
+	{ 45 },
+	{ 47 },
+	{ 45 },
+	{ 78 },
+	{ 75 },
+	{ 78 },
+	{ 152 },
+	{ 150 },
+	{ 158 },
+	{ 150 },
+	{ 152 },
+	{ 142 },
+	{ 158 },
+	{ 167 },
+	{ 150 },
+	{ 133 },
+	{ 75 },
+	{ 158 },
+	{ 146 },
+	{ 150 },
+	{ 69 },
+	{ 121 },
+	{ 142 },
+	{ 128 },
+	{ 71 },
+	{ 129 },
+	{ 139 },
+	{ 40 },
+	{ 128 },
+	{ 121 },
+	{ 56 },
+	{ 139 },
+	{ 0 },
+	{ 0 },
+	{ 125 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 32 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 32 },
+	{ 16 },
+	{ 37 },
+	{ 22 },
+	{ 30 },
+	{ 22 },
+	{ 37 },
+	{ 33 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 81 },
+	{ 0 },
+	{ 0 },
+	{ 49 },
+	{ 64 },
+	{ 43 },
+	{ 51 },
+	{ 64 },
+	{ 44 },
+	{ 1 },
+	{ 2 },
+	{ 0 },
+	{ 2 },
+	{ 1 },
+	{ 0 },
+	{ 17 },
+	{ 2 },
+	{ 1 },
+	{ 29 },
+	{ 17 },
+	{ 22 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 81 },
+	{ 97 },
+	{ 0 },
+	{ 49 },
+	{ 51 },
+	{ 50 },
+	{ 46 },
+	{ 49 },
+	{ 46 },
+	{ 71 },
+	{ 46 },
+	{ 72 },
+	{ 85 },
+	{ 71 },
+	{ 96 },
+	{ 45 },
+	{ 45 },
+	{ 46 },
+	{ 46 },
+	{ 45 },
+	{ 46 },
+	{ 0 },
+	{ 60 },
+	{ 0 },
+	{ 55 },
+	{ 66 },
+	{ 0 },
+	{ 55 },
+	{ 45 },
+	{ 51 },
+	{ 0 },
+	{ 46 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 46 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 49 },
+	{ 50 },
+	{ 0 },
+	{ 0 },
+	{ 49 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 49 },
+	{ 46 },
+	{ 0 },
+	{ 51 },
+	{ 49 },
+	{ 50 },
+	{ 50 },
+	{ 50 },
+	{ 49 },
+	{ 51 },
+	{ 45 },
+	{ 49 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 2 },
+	{ 3 },
+	{ 1 },
+	{ 3 },
+	{ 2 },
+	{ 0 },
+	{ 2 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 2 },
+	{ 0 },
+	{ 3 },
+	{ 6 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 43 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 45 },
+	{ 55 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 73 },
+	{ 73 },
+	{ 60 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 51 },
+	{ 54 },
+	{ 61 },
+	{ 76 },
+	{ 64 },
+	{ 64 },
+	{ 76 },
+	{ 73 },
+	{ 84 },
+	{ 65 },
+	{ 70 },
+	{ 73 },
+	{ 61 },
+	{ 65 },
+	{ 64 },
+	{ 61 },
+	{ 53 },
+	{ 49 },
+	{ 54 },
+	{ 46 },
+	{ 45 },
+	{ 61 },
+	{ 64 },
+	{ 54 },
+	{ 50 },
+	{ 46 },
+	{ 54 },
+	{ 64 },
+	{ 54 },
+	{ 54 },
+	{ 45 },
+	{ 41 },
+	{ 47 },
+	{ 40 },
+	{ 41 },
+	{ 45 },
+	{ 49 },
+	{ 45 },
+	{ 46 },
+	{ 65 },
+	{ 61 },
+	{ 57 },
+	{ 42 },
+	{ 0 },
+	{ 57 },
+	{ 40 },
+	{ 42 },
+	{ 49 },
+	{ 57 },
+	{ 57 },
+	{ 65 },
+	{ 40 },
+	{ 49 },
+	{ 47 },
+	{ 0 },
+	{ 40 },
+	{ 34 },
+	{ 34 },
+	{ 35 },
+	{ 0 },
+	{ 47 },
+	{ 41 },
+	{ 34 },
+	{ 85 },
+	{ 84 },
+	{ 84 },
+	{ 84 },
+	{ 85 },
+	{ 0 },
+	{ 84 },
+	{ 0 },
+	{ 73 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 81 },
+	{ 84 },
+	{ 84 },
+	{ 81 },
+	{ 84 },
+	{ 73 },
+	{ 81 },
+	{ 71 },
+	{ 76 },
+	{ 73 },
+	{ 66 },
+	{ 71 },
+	{ 85 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 70 },
+	{ 0 },
+	{ 84 },
+	{ 0 },
+	{ 0 },
+	{ 3 },
+	{ 0 },
+	{ 3 },
+	{ 0 },
+	{ 0 },
+	{ 76 },
+	{ 71 },
+	{ 64 },
+	{ 66 },
+	{ 55 },
+	{ 61 },
+	{ 60 },
+	{ 0 },
+	{ 66 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 57 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 4 },
+	{ 0 },
+	{ 2 },
+	{ 4 },
+	{ 3 },
+	{ 2 },
+	{ 2 },
+	{ 3 },
+	{ 2 },
+	{ 3 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 1 },
+	{ 3 },
+	{ 2 },
+	{ 0 },
+	{ 1 },
+	{ 3 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 3 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 3 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 4 },
+	{ 0 },
+	{ 3 },
+	{ 0 },
+	{ 3 },
+	{ 0 },
+	{ 3 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 22 },
+	{ 0 },
+	{ 24 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 23 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 29 },
+	{ 0 },
+	{ 23 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 24 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 42 },
+	{ 40 },
+	{ 0 },
+	{ 0 },
+	{ 42 },
+	{ 35 },
+	{ 35 },
+	{ 29 },
+	{ 37 },
+	{ 41 },
+	{ 35 },
+	{ 37 },
+	{ 33 },
+	{ 40 },
+	{ 22 },
+	{ 24 },
+	{ 35 },
+	{ 33 },
+	{ 37 },
+	{ 28 },
+	{ 40 },
+	{ 33 },
+	{ 41 },
+	{ 40 },
+	{ 45 },
+	{ 42 },
+	{ 47 },
+	{ 47 },
+	{ 49 },
+	{ 47 },
+	{ 49 },
+	{ 49 },
+	{ 49 },
+	{ 46 },
+	{ 48 },
+	{ 49 },
+	{ 49 },
+	{ 49 },
+	{ 49 },
+	{ 50 },
+	{ 49 },
+	{ 49 },
+	{ 49 },
+	{ 49 },
+	{ 45 },
+	{ 49 },
+	{ 47 },
+	{ 49 },
+	{ 49 },
+	{ 43 },
+	{ 43 },
+	{ 0 },
+	{ 49 },
+	{ 45 },
+	{ 49 },
+	{ 48 },
+	{ 30 },
+	{ 44 },
+	{ 45 },
+	{ 30 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 5 },
+	{ 3 },
+	{ 0 },
+	{ 0 },
+	{ 30 },
+	{ 0 },
+	{ 44 },
+	{ 30 },
+	{ 38 },
+	{ 0 },
+	{ 0 },
+	{ 29 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 45 },
+	{ 41 },
+	{ 0 },
+	{ 41 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 41 },
+	{ 48 },
+	{ 46 },
+	{ 45 },
+	{ 49 },
+	{ 44 },
+	{ 45 },
+	{ 44 },
+	{ 38 },
+	{ 42 },
+	{ 38 },
+	{ 35 },
+	{ 42 },
+	{ 41 },
+	{ 45 },
+	{ 35 },
+	{ 35 },
+	{ 41 },
+	{ 45 },
+	{ 45 },
+	{ 47 },
+	{ 47 },
+	{ 45 },
+	{ 47 },
+	{ 41 },
+	{ 37 },
+	{ 42 },
+	{ 35 },
+	{ 23 },
+	{ 28 },
+	{ 0 },
+	{ 0 },
+	{ 82 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 74 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 128 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 124 },
+	{ 139 },
+	{ 128 },
+	{ 0 },
+	{ 0 },
+	{ 124 },
+	{ 124 },
+	{ 128 },
+	{ 141 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 5 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 87 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 2 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 2 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 3 },
+	{ 3 },
+	{ 2 },
+	{ 3 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 4 },
+	{ 2 },
+	{ 3 },
+	{ 4 },
+	{ 3 },
+	{ 5 },
+	{ 4 },
+	{ 2 },
+	{ 2 },
+	{ 3 },
+	{ 3 },
+	{ 2 },
+	{ 0 },
+	{ 2 },
+	{ 3 },
+	{ 87 },
+	{ 0 },
+	{ 94 },
+	{ 98 },
+	{ 74 },
+	{ 87 },
+	{ 98 },
+	{ 122 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 122 },
+	{ 128 },
+	{ 139 },
+	{ 124 },
+	{ 112 },
+	{ 128 },
+	{ 122 },
+	{ 112 },
+	{ 118 },
+	{ 128 },
+	{ 118 },
+	{ 112 },
+	{ 94 },
+	{ 139 },
+	{ 128 },
+	{ 134 },
+	{ 137 },
+	{ 134 },
+	{ 127 },
+	{ 141 },
+	{ 139 },
+	{ 137 },
+	{ 143 },
+	{ 150 },
+	{ 136 },
+	{ 82 },
+	{ 0 },
+	{ 98 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 126 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 117 },
+	{ 0 },
+	{ 0 },
+	{ 139 },
+	{ 139 },
+	{ 148 },
+	{ 144 },
+	{ 148 },
+	{ 117 },
+	{ 139 },
+	{ 141 },
+	{ 150 },
+	{ 148 },
+	{ 151 },
+	{ 148 },
+	{ 148 },
+	{ 152 },
+	{ 144 },
+	{ 148 },
+	{ 124 },
+	{ 142 },
+	{ 148 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 117 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 1 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 5 },
+	{ 4 },
+	{ 3 },
+	{ 2 },
+	{ 3 },
+	{ 4 },
+	{ 3 },
+	{ 4 },
+	{ 0 },
+	{ 5 },
+	{ 0 },
+	{ 4 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 106 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 126 },
+	{ 139 },
+	{ 0 },
+	{ 139 },
+	{ 139 },
+	{ 148 },
+	{ 106 },
+	{ 139 },
+	{ 139 },
+	{ 120 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 3 },
+	{ 2 },
+	{ 0 },
+	{ 3 },
+	{ 3 },
+	{ 3 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 67 },
+	{ 0 },
+	{ 67 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 120 },
+	{ 121 },
+	{ 121 },
+	{ 112 },
+	{ 0 },
+	{ 112 },
+	{ 88 },
+	{ 0 },
+	{ 88 },
+	{ 72 },
+	{ 0 },
+	{ 117 },
+	{ 72 },
+	{ 120 },
+	{ 120 },
+	{ 88 },
+	{ 120 },
+	{ 120 },
+	{ 112 },
+	{ 121 },
+	{ 141 },
+	{ 130 },
+	{ 136 },
+	{ 136 },
+	{ 139 },
+	{ 141 },
+	{ 120 },
+	{ 139 },
+	{ 136 },
+	{ 149 },
+	{ 152 },
+	{ 144 },
+	{ 144 },
+	{ 152 },
+	{ 142 },
+	{ 126 },
+	{ 142 },
+	{ 119 },
+	{ 142 },
+	{ 126 },
+	{ 144 },
+	{ 141 },
+	{ 148 },
+	{ 135 },
+	{ 130 },
+	{ 141 },
+	{ 126 },
+	{ 117 },
+	{ 130 },
+	{ 101 },
+	{ 101 },
+	{ 126 },
+	{ 94 },
+	{ 126 },
+	{ 135 },
+	{ 114 },
+	{ 114 },
+	{ 126 },
+	{ 107 },
+	{ 96 },
+	{ 107 },
+	{ 117 },
+	{ 93 },
+	{ 96 },
+	{ 115 },
+	{ 76 },
+	{ 78 },
+	{ 96 },
+	{ 93 },
+	{ 0 },
+	{ 76 },
+	{ 119 },
+	{ 136 },
+	{ 126 },
+	{ 136 },
+	{ 141 },
+	{ 126 },
+	{ 142 },
+	{ 150 },
+	{ 136 },
+	{ 148 },
+	{ 144 },
+	{ 149 },
+	{ 148 },
+	{ 149 },
+	{ 126 },
+	{ 126 },
+	{ 0 },
+	{ 117 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 75 },
+	{ 0 },
+	{ 0 },
+	{ 75 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 76 },
+	{ 0 },
+	{ 0 },
+	{ 94 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 101 },
+	{ 94 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 93 },
+	{ 115 },
+	{ 97 },
+	{ 112 },
+	{ 96 },
+	{ 97 },
+	{ 136 },
+	{ 127 },
+	{ 124 },
+	{ 115 },
+	{ 124 },
+	{ 112 },
+	{ 106 },
+	{ 96 },
+	{ 112 },
+	{ 75 },
+	{ 0 },
+	{ 87 },
+	{ 87 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 106 },
+	{ 80 },
+	{ 96 },
+	{ 106 },
+	{ 118 },
+	{ 80 },
+	{ 0 },
+	{ 80 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 80 },
+	{ 3 },
+	{ 1 },
+	{ 0 },
+	{ 3 },
+	{ 2 },
+	{ 1 },
+	{ 3 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 3 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 3 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 4 },
+	{ 3 },
+	{ 4 },
+	{ 3 },
+	{ 4 },
+	{ 0 },
+	{ 3 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 3 },
+	{ 6 },
+	{ 6 },
+	{ 3 },
+	{ 1 },
+	{ 6 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 5 },
+	{ 0 },
+	{ 6 },
+	{ 5 },
+	{ 4 },
+	{ 0 },
+	{ 5 },
+	{ 4 },
+	{ 2 },
+	{ 4 },
+	{ 3 },
+	{ 2 },
+	{ 4 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 5 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 4 },
+	{ 3 },
+	{ 2 },
+	{ 3 },
+	{ 3 },
+	{ 0 },
+	{ 3 },
+	{ 0 },
+	{ 0 },
+	{ 4 },
+	{ 3 },
+	{ 4 },
+	{ 3 },
+	{ 4 },
+	{ 2 },
+	{ 3 },
+	{ 3 },
+	{ 3 },
+	{ 4 },
+	{ 0 },
+	{ 0 },
+	{ 5 },
+	{ 3 },
+	{ 4 },
+	{ 6 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 3 },
+	{ 3 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 118 },
+	{ 106 },
+	{ 134 },
+	{ 3 },
+	{ 2 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 4 },
+	{ 115 },
+	{ 117 },
+	{ 124 },
+	{ 143 },
+	{ 136 },
+	{ 126 },
+	{ 72 },
+	{ 0 },
+	{ 0 },
+	{ 120 },
+	{ 130 },
+	{ 117 },
+	{ 117 },
+	{ 101 },
+	{ 0 },
+	{ 5 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 4 },
+	{ 4 },
+	{ 2 },
+	{ 4 },
+	{ 3 },
+	{ 2 },
+	{ 2 },
+	{ 150 },
+	{ 151 },
+	{ 142 },
+	{ 114 },
+	{ 107 },
+	{ 78 },
+	{ 143 },
+	{ 141 },
+	{ 151 },
+	{ 50 },
+	{ 50 },
+	{ 49 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 3 },
+	{ 5 },
+	{ 0 },
+	{ 5 },
+	{ 4 },
+	{ 0 },
+	{ 4 },
+	{ 3 },
+	{ 0 },
+	{ 3 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 3 },
+	{ 0 },
+	{ 3 },
+	{ 4 },
+	{ 40 },
+	{ 4 },
+	{ 3 },
+	{ 40 },
+	{ 3 },
+	{ 4 },
+	{ 37 },
+	{ 4 },
+	{ 3 },
+	{ 10 },
+	{ 3 },
+	{ 3 },
+	{ 10 },
+	{ 3 },
+	{ 3 },
+	{ 0 },
+	{ 3 },
+	{ 3 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 45 },
+	{ 0 },
+	{ 0 },
+	{ 46 },
+	{ 0 },
+	{ 0 },
+	{ 70 },
+	{ 0 },
+	{ 0 },
+	{ 73 },
+	{ 0 },
+	{ 21 },
+	{ 73 },
+	{ 21 },
+	{ 40 },
+	{ 27 },
+	{ 40 },
+	{ 49 },
+	{ 29 },
+	{ 49 },
+	{ 37 },
+	{ 62 },
+	{ 37 },
+	{ 10 },
+	{ 71 },
+	{ 10 },
+	{ 0 },
+	{ 44 },
+	{ 0 },
+	{ 0 },
+	{ 45 },
+	{ 0 },
+	{ 0 },
+	{ 48 },
+	{ 48 },
+	{ 45 },
+	{ 49 },
+	{ 45 },
+	{ 46 },
+	{ 57 },
+	{ 46 },
+	{ 70 },
+	{ 98 },
+	{ 70 },
+	{ 73 },
+	{ 126 },
+	{ 73 },
+	{ 27 },
+	{ 126 },
+	{ 27 },
+	{ 29 },
+	{ 136 },
+	{ 29 },
+	{ 62 },
+	{ 122 },
+	{ 62 },
+	{ 71 },
+	{ 108 },
+	{ 71 },
+	{ 44 },
+	{ 87 },
+	{ 44 },
+	{ 45 },
+	{ 50 },
+	{ 45 },
+	{ 48 },
+	{ 49 },
+	{ 48 },
+	{ 48 },
+	{ 50 },
+	{ 50 },
+	{ 49 },
+	{ 51 },
+	{ 49 },
+	{ 57 },
+	{ 83 },
+	{ 57 },
+	{ 98 },
+	{ 143 },
+	{ 98 },
+	{ 126 },
+	{ 143 },
+	{ 126 },
+	{ 136 },
+	{ 184 },
+	{ 136 },
+	{ 122 },
+	{ 184 },
+	{ 122 },
+	{ 108 },
+	{ 156 },
+	{ 108 },
+	{ 87 },
+	{ 156 },
+	{ 87 },
+	{ 50 },
+	{ 111 },
+	{ 50 },
+	{ 49 },
+	{ 50 },
+	{ 49 },
+	{ 50 },
+	{ 50 },
+	{ 50 },
+	{ 50 },
+	{ 51 },
+	{ 6 },
+	{ 3 },
+	{ 3 },
+	{ 175 },
+	{ 74 },
+	{ 143 },
+	{ 175 },
+	{ 143 },
+	{ 156 },
+	{ 175 },
+	{ 184 },
+	{ 163 },
+	{ 175 },
+	{ 156 },
+	{ 95 },
+	{ 175 },
+	{ 95 },
+	{ 51 },
+	{ 175 },
+	{ 51 },
+	{ 74 },
+	{ 7 },
+	{ 4 },
+	{ 3 },
+	{ 7 },
+	{ 3 },
+	{ 3 },
+	{ 6 },
+	{ 3 },
+	{ 7 },
+	{ 3 },
+	{ 7 },
+	{ 3 },
+	{ 4 },
+	{ 7 },
+	{ 7 },
+	{ 5 },
+	{ 6 },
+	{ 7 },
+	{ 3 },
+	{ 3 },
+	{ 6 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 10 },
+	{ 10 },
+	{ 0 },
+	{ 9 },
+	{ 10 },
+	{ 11 },
+	{ 10 },
+	{ 14 },
+	{ 7 },
+	{ 10 },
+	{ 11 },
+	{ 0 },
+	{ 7 },
+	{ 0 },
+	{ 0 },
+	{ 11 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 4 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 3 },
+	{ 3 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 5 },
+	{ 0 },
+	{ 4 },
+	{ 0 },
+	{ 4 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 5 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 5 },
+	{ 0 },
+	{ 0 },
+	{ 4 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 3 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 12 },
+	{ 4 },
+	{ 9 },
+	{ 0 },
+	{ 0 },
+	{ 12 },
+	{ 9 },
+	{ 5 },
+	{ 12 },
+	{ 4 },
+	{ 2 },
+	{ 4 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 12 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 12 },
+	{ 0 },
+	{ 0 },
+	{ 9 },
+	{ 12 },
+	{ 14 },
+	{ 9 },
+	{ 12 },
+	{ 10 },
+	{ 7 },
+	{ 4 },
+	{ 7 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 14 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 5 },
+	{ 2 },
+	{ 0 },
+	{ 2 },
+	{ 3 },
+	{ 0 },
+	{ 3 },
+	{ 5 },
+	{ 0 },
+	{ 5 },
+	{ 5 },
+	{ 2 },
+	{ 0 },
+	{ 2 },
+	{ 3 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 4 },
+	{ 4 },
+	{ 0 },
+	{ 4 },
+	{ 2 },
+	{ 5 },
+	{ 5 },
+	{ 5 },
+	{ 0 },
+	{ 5 },
+	{ 4 },
+	{ 0 },
+	{ 5 },
+	{ 5 },
+	{ 0 },
+	{ 5 },
+	{ 5 },
+	{ 0 },
+	{ 4 },
+	{ 4 },
+	{ 0 },
+	{ 4 },
+	{ 5 },
+	{ 2 },
+	{ 0 },
+	{ 3 },
+	{ 4 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 5 },
+	{ 5 },
+	{ 7 },
+	{ 3 },
+	{ 2 },
+	{ 7 },
+	{ 2 },
+	{ 6 },
+	{ 7 },
+	{ 7 },
+	{ 6 },
+	{ 5 },
+	{ 6 },
+	{ 6 },
+	{ 4 },
+	{ 4 },
+	{ 5 },
+	{ 6 },
+	{ 6 },
+	{ 5 },
+	{ 4 },
+	{ 6 },
+	{ 6 },
+	{ 6 },
+	{ 5 },
+	{ 5 },
+	{ 5 },
+	{ 5 },
+	{ 5 },
+	{ 4 },
+	{ 4 },
+	{ 6 },
+	{ 5 },
+	{ 5 },
+	{ 6 },
+	{ 4 },
+	{ 3 },
+	{ 6 },
+	{ 2 },
+	{ 3 },
+	{ 2 },
+	{ 2 },
+	{ 3 },
+	{ 2 },
+	{ 5 },
+	{ 6 },
+	{ 6 },
+	{ 3 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 5 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 26 },
+	{ 15 },
+	{ 23 },
+	{ 23 },
+	{ 17 },
+	{ 33 },
+	{ 18 },
+	{ 14 },
+	{ 23 },
+	{ 14 },
+	{ 18 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 32 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 32 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 23 },
+	{ 0 },
+	{ 32 },
+	{ 31 },
+	{ 0 },
+	{ 2 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 25 },
+	{ 25 },
+	{ 67 },
+	{ 0 },
+	{ 38 },
+	{ 0 },
+	{ 0 },
+	{ 38 },
+	{ 0 },
+	{ 94 },
+	{ 38 },
+	{ 82 },
+	{ 0 },
+	{ 94 },
+	{ 119 },
+	{ 82 },
+	{ 1 },
+	{ 1 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 1 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 15 },
+	{ 14 },
+	{ 0 },
+	{ 22 },
+	{ 15 },
+	{ 2 },
+	{ 23 },
+	{ 22 },
+	{ 2 },
+	{ 18 },
+	{ 60 },
+	{ 25 },
+	{ 60 },
+	{ 96 },
+	{ 67 },
+	{ 85 },
+	{ 138 },
+	{ 96 },
+	{ 85 },
+	{ 23 },
+	{ 105 },
+	{ 23 },
+	{ 85 },
+	{ 60 },
+	{ 26 },
+	{ 49 },
+	{ 33 },
+	{ 138 },
+	{ 85 },
+	{ 148 },
+	{ 161 },
+	{ 138 },
+	{ 169 },
+	{ 105 },
+	{ 49 },
+	{ 148 },
+	{ 96 },
+	{ 127 },
+	{ 94 },
+	{ 155 },
+	{ 127 },
+	{ 170 },
+	{ 117 },
+	{ 155 },
+	{ 136 },
+	{ 155 },
+	{ 117 },
+	{ 85 },
+	{ 117 },
+	{ 60 },
+	{ 32 },
+	{ 136 },
+	{ 77 },
+	{ 60 },
+	{ 119 },
+	{ 94 },
+	{ 155 },
+	{ 167 },
+	{ 133 },
+	{ 136 },
+	{ 170 },
+	{ 161 },
+	{ 167 },
+	{ 169 },
+	{ 49 },
+	{ 167 },
+	{ 133 },
+	{ 49 },
+	{ 80 },
+	{ 133 },
+	{ 80 },
+	{ 77 },
+	{ 138 },
+	{ 161 },
+	{ 127 },
+	{ 14 },
+	{ 15 },
+	{ 17 },
+	{ 17 },
+	{ 14 },
+	{ 15 },
+	{ 17 },
+	{ 26 },
+	{ 23 },
+	{ 26 },
+	{ 17 },
+	{ 22 },
+	{ 26 },
+	{ 37 },
+	{ 25 },
+	{ 37 },
+	{ 26 },
+	{ 23 },
+	{ 80 },
+	{ 40 },
+	{ 37 },
+	{ 31 },
+	{ 60 },
+	{ 37 },
+	{ 23 },
+	{ 25 },
+	{ 40 },
+	{ 14 },
+	{ 17 },
+	{ 15 },
+	{ 17 },
+	{ 14 },
+	{ 26 },
+	{ 26 },
+	{ 49 },
+	{ 29 },
+	{ 36 },
+	{ 69 },
+	{ 37 },
+	{ 26 },
+	{ 37 },
+	{ 23 },
+	{ 0 },
+	{ 0 },
+	{ 23 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 28 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 54 },
+	{ 28 },
+	{ 54 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 29 },
+	{ 40 },
+	{ 35 },
+	{ 2 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 20 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 13 },
+	{ 0 },
+	{ 13 },
+	{ 55 },
+	{ 20 },
+	{ 50 },
+	{ 0 },
+	{ 20 },
+	{ 55 },
+	{ 104 },
+	{ 50 },
+	{ 50 },
+	{ 110 },
+	{ 54 },
+	{ 110 },
+	{ 50 },
+	{ 149 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 18 },
+	{ 22 },
+	{ 21 },
+	{ 2 },
+	{ 29 },
+	{ 22 },
+	{ 1 },
+	{ 23 },
+	{ 35 },
+	{ 13 },
+	{ 55 },
+	{ 13 },
+	{ 78 },
+	{ 78 },
+	{ 35 },
+	{ 112 },
+	{ 67 },
+	{ 37 },
+	{ 128 },
+	{ 35 },
+	{ 23 },
+	{ 67 },
+	{ 36 },
+	{ 49 },
+	{ 69 },
+	{ 128 },
+	{ 141 },
+	{ 112 },
+	{ 141 },
+	{ 169 },
+	{ 146 },
+	{ 128 },
+	{ 49 },
+	{ 141 },
+	{ 78 },
+	{ 136 },
+	{ 104 },
+	{ 141 },
+	{ 136 },
+	{ 141 },
+	{ 86 },
+	{ 141 },
+	{ 70 },
+	{ 141 },
+	{ 86 },
+	{ 93 },
+	{ 28 },
+	{ 93 },
+	{ 40 },
+	{ 40 },
+	{ 86 },
+	{ 45 },
+	{ 149 },
+	{ 104 },
+	{ 141 },
+	{ 156 },
+	{ 116 },
+	{ 70 },
+	{ 141 },
+	{ 146 },
+	{ 156 },
+	{ 169 },
+	{ 49 },
+	{ 156 },
+	{ 33 },
+	{ 48 },
+	{ 116 },
+	{ 116 },
+	{ 48 },
+	{ 45 },
+	{ 136 },
+	{ 78 },
+	{ 146 },
+	{ 26 },
+	{ 26 },
+	{ 18 },
+	{ 21 },
+	{ 22 },
+	{ 26 },
+	{ 26 },
+	{ 26 },
+	{ 26 },
+	{ 22 },
+	{ 29 },
+	{ 26 },
+	{ 31 },
+	{ 34 },
+	{ 26 },
+	{ 29 },
+	{ 35 },
+	{ 31 },
+	{ 48 },
+	{ 33 },
+	{ 34 },
+	{ 35 },
+	{ 40 },
+	{ 34 },
+	{ 26 },
+	{ 26 },
+	{ 33 },
+	{ 26 },
+	{ 26 },
+	{ 29 },
+	{ 26 },
+	{ 26 },
+	{ 36 },
+	{ 94 },
+	{ 45 },
+	{ 137 },
+	{ 163 },
+	{ 120 },
+	{ 162 },
+	{ 71 },
+	{ 120 },
+	{ 100 },
+	{ 28 },
+	{ 1 },
+	{ 51 },
+	{ 12 },
+	{ 20 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 0 },
+	{ 2 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 2 },
+	{ 1 },
+	{ 2 },
+	{ 2 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 22 },
+	{ 2 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 2 },
+	{ 0 },
+	{ 1 },
+	{ 24 },
+	{ 19 },
+	{ 2 },
+	{ 1 },
+	{ 2 },
+	{ 24 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 117 },
+	{ 90 },
+	{ 0 },
+	{ 114 },
+	{ 117 },
+	{ 0 },
+	{ 0 },
+	{ 47 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 2 },
+	{ 12 },
+	{ 12 },
+	{ 11 },
+	{ 11 },
+	{ 11 },
+	{ 18 },
+	{ 11 },
+	{ 10 },
+	{ 16 },
+	{ 11 },
+	{ 16 },
+	{ 10 },
+	{ 11 },
+	{ 20 },
+	{ 12 },
+	{ 25 },
+	{ 2 },
+	{ 2 },
+	{ 11 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 28 },
+	{ 28 },
+	{ 78 },
+	{ 49 },
+	{ 0 },
+	{ 49 },
+	{ 47 },
+	{ 78 },
+	{ 114 },
+	{ 47 },
+	{ 78 },
+	{ 28 },
+	{ 100 },
+	{ 100 },
+	{ 149 },
+	{ 114 },
+	{ 163 },
+	{ 163 },
+	{ 149 },
+	{ 149 },
+	{ 100 },
+	{ 163 },
+	{ 149 },
+	{ 149 },
+	{ 117 },
+	{ 51 },
+	{ 20 },
+	{ 71 },
+	{ 71 },
+	{ 25 },
+	{ 94 },
+	{ 25 },
+	{ 11 },
+	{ 32 },
+	{ 18 },
+	{ 45 },
+	{ 32 },
+	{ 94 },
+	{ 137 },
+	{ 120 },
+	{ 163 },
+	{ 163 },
+	{ 165 },
+	{ 119 },
+	{ 163 },
+	{ 117 },
+	{ 117 },
+	{ 59 },
+	{ 62 },
+	{ 125 },
+	{ 149 },
+	{ 119 },
+	{ 22 },
+	{ 90 },
+	{ 53 },
+	{ 53 },
+	{ 26 },
+	{ 2 },
+	{ 26 },
+	{ 53 },
+	{ 33 },
+	{ 53 },
+	{ 125 },
+	{ 62 },
+	{ 33 },
+	{ 62 },
+	{ 38 },
+	{ 117 },
+	{ 45 },
+	{ 59 },
+	{ 20 },
+	{ 26 },
+	{ 38 },
+	{ 16 },
+	{ 23 },
+	{ 20 },
+	{ 23 },
+	{ 33 },
+	{ 26 },
+	{ 149 },
+	{ 125 },
+	{ 90 },
+	{ 162 },
+	{ 45 },
+	{ 165 },
+	{ 18 },
+	{ 11 },
+	{ 20 },
+	{ 49 },
+	{ 52 },
+	{ 49 },
+	{ 72 },
+	{ 49 },
+	{ 52 },
+	{ 47 },
+	{ 50 },
+	{ 68 },
+	{ 18 },
+	{ 12 },
+	{ 50 },
+	{ 0 },
+	{ 1 },
+	{ 12 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 26 },
+	{ 57 },
+	{ 110 },
+	{ 97 },
+	{ 57 },
+	{ 79 },
+	{ 0 },
+	{ 97 },
+	{ 10 },
+	{ 31 },
+	{ 39 },
+	{ 26 },
+	{ 0 },
+	{ 10 },
+	{ 63 },
+	{ 57 },
+	{ 39 },
+	{ 10 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 23 },
+	{ 31 },
+	{ 37 },
+	{ 31 },
+	{ 26 },
+	{ 26 },
+	{ 23 },
+	{ 18 },
+	{ 1 },
+	{ 22 },
+	{ 23 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 35 },
+	{ 0 },
+	{ 81 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 35 },
+	{ 12 },
+	{ 79 },
+	{ 101 },
+	{ 81 },
+	{ 50 },
+	{ 35 },
+	{ 81 },
+	{ 81 },
+	{ 81 },
+	{ 98 },
+	{ 79 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 0 },
+	{ 15 },
+	{ 1 },
+	{ 15 },
+	{ 22 },
+	{ 1 },
+	{ 15 },
+	{ 15 },
+	{ 14 },
+	{ 13 },
+	{ 18 },
+	{ 22 },
+	{ 13 },
+	{ 15 },
+	{ 0 },
+	{ 18 },
+	{ 18 },
+	{ 22 },
+	{ 14 },
+	{ 22 },
+	{ 23 },
+	{ 21 },
+	{ 47 },
+	{ 41 },
+	{ 23 },
+	{ 22 },
+	{ 18 },
+	{ 47 },
+	{ 68 },
+	{ 52 },
+	{ 41 },
+	{ 41 },
+	{ 52 },
+	{ 49 },
+	{ 68 },
+	{ 81 },
+	{ 72 },
+	{ 93 },
+	{ 74 },
+	{ 72 },
+	{ 63 },
+	{ 51 },
+	{ 74 },
+	{ 49 },
+	{ 51 },
+	{ 46 },
+	{ 46 },
+	{ 45 },
+	{ 40 },
+	{ 20 },
+	{ 47 },
+	{ 26 },
+	{ 18 },
+	{ 20 },
+	{ 26 },
+	{ 21 },
+	{ 47 },
+	{ 14 },
+	{ 13 },
+	{ 14 },
+	{ 20 },
+	{ 14 },
+	{ 21 },
+	{ 14 },
+	{ 26 },
+	{ 26 },
+	{ 40 },
+	{ 49 },
+	{ 46 },
+	{ 40 },
+	{ 52 },
+	{ 74 },
+	{ 49 },
+	{ 74 },
+	{ 52 },
+	{ 49 },
+	{ 31 },
+	{ 37 },
+	{ 45 },
+	{ 51 },
+	{ 63 },
+	{ 45 },
+	{ 93 },
+	{ 110 },
+	{ 63 },
+	{ 110 },
+	{ 93 },
+	{ 98 },
+	{ 21 },
+	{ 23 },
+	{ 41 },
+	{ 49 },
+	{ 101 },
+	{ 79 },
+	{ 42 },
+	{ 49 },
+	{ 49 },
+	{ 47 },
+	{ 49 },
+	{ 29 },
+	{ 18 },
+	{ 0 },
+	{ 23 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 83 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 28 },
+	{ 61 },
+	{ 100 },
+	{ 113 },
+	{ 61 },
+	{ 82 },
+	{ 0 },
+	{ 113 },
+	{ 41 },
+	{ 28 },
+	{ 36 },
+	{ 28 },
+	{ 0 },
+	{ 0 },
+	{ 28 },
+	{ 41 },
+	{ 70 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 29 },
+	{ 36 },
+	{ 29 },
+	{ 29 },
+	{ 45 },
+	{ 21 },
+	{ 25 },
+	{ 29 },
+	{ 29 },
+	{ 1 },
+	{ 21 },
+	{ 40 },
+	{ 0 },
+	{ 0 },
+	{ 16 },
+	{ 0 },
+	{ 48 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 16 },
+	{ 48 },
+	{ 40 },
+	{ 83 },
+	{ 48 },
+	{ 47 },
+	{ 23 },
+	{ 47 },
+	{ 48 },
+	{ 86 },
+	{ 82 },
+	{ 40 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 17 },
+	{ 18 },
+	{ 21 },
+	{ 1 },
+	{ 18 },
+	{ 25 },
+	{ 18 },
+	{ 23 },
+	{ 18 },
+	{ 25 },
+	{ 25 },
+	{ 17 },
+	{ 0 },
+	{ 18 },
+	{ 23 },
+	{ 17 },
+	{ 26 },
+	{ 34 },
+	{ 23 },
+	{ 37 },
+	{ 29 },
+	{ 44 },
+	{ 37 },
+	{ 23 },
+	{ 29 },
+	{ 26 },
+	{ 44 },
+	{ 29 },
+	{ 42 },
+	{ 44 },
+	{ 42 },
+	{ 49 },
+	{ 49 },
+	{ 47 },
+	{ 86 },
+	{ 99 },
+	{ 102 },
+	{ 86 },
+	{ 70 },
+	{ 85 },
+	{ 102 },
+	{ 79 },
+	{ 85 },
+	{ 80 },
+	{ 80 },
+	{ 73 },
+	{ 43 },
+	{ 25 },
+	{ 48 },
+	{ 28 },
+	{ 28 },
+	{ 29 },
+	{ 25 },
+	{ 34 },
+	{ 48 },
+	{ 27 },
+	{ 25 },
+	{ 27 },
+	{ 25 },
+	{ 23 },
+	{ 34 },
+	{ 27 },
+	{ 29 },
+	{ 28 },
+	{ 43 },
+	{ 43 },
+	{ 48 },
+	{ 80 },
+	{ 101 },
+	{ 102 },
+	{ 79 },
+	{ 102 },
+	{ 101 },
+	{ 49 },
+	{ 36 },
+	{ 45 },
+	{ 73 },
+	{ 41 },
+	{ 73 },
+	{ 85 },
+	{ 99 },
+	{ 100 },
+	{ 70 },
+	{ 100 },
+	{ 99 },
+	{ 86 },
+	{ 34 },
+	{ 37 },
+	{ 44 },
+	{ 17 },
+	{ 44 },
+	{ 26 },
+	{ 49 },
+	{ 42 },
+	{ 38 },
+	{ 48 },
+	{ 49 },
+	{ 49 },
+	{ 47 },
+	{ 48 },
+	{ 48 },
+	{ 86 },
+	{ 103 },
+	{ 74 },
+	{ 79 },
+	{ 85 },
+	{ 86 },
+	{ 85 },
+	{ 79 },
+	{ 48 },
+	{ 0 },
+	{ 39 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 2 },
+	{ 12 },
+	{ 1 },
+	{ 29 },
+	{ 39 },
+	{ 48 },
+	{ 29 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 1 },
+	{ 2 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 72 },
+	{ 0 },
+	{ 0 },
+	{ 85 },
+	{ 39 },
+	{ 0 },
+	{ 85 },
+	{ 86 },
+	{ 62 },
+	{ 69 },
+	{ 62 },
+	{ 86 },
+	{ 48 },
+	{ 62 },
+	{ 49 },
+	{ 51 },
+	{ 36 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 48 },
+	{ 69 },
+	{ 48 },
+	{ 49 },
+	{ 49 },
+	{ 36 },
+	{ 51 },
+	{ 49 },
+	{ 49 },
+	{ 49 },
+	{ 49 },
+	{ 85 },
+	{ 72 },
+	{ 103 },
+	{ 103 },
+	{ 85 },
+	{ 81 },
+	{ 74 },
+	{ 81 },
+	{ 47 },
+	{ 81 },
+	{ 0 },
+	{ 48 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 0 },
+	{ 18 },
+	{ 0 },
+	{ 1 },
+	{ 35 },
+	{ 18 },
+	{ 30 },
+	{ 1 },
+	{ 24 },
+	{ 30 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 18 },
+	{ 48 },
+	{ 18 },
+	{ 35 },
+	{ 47 },
+	{ 35 },
+	{ 41 },
+	{ 48 },
+	{ 49 },
+	{ 48 },
+	{ 42 },
+	{ 32 },
+	{ 38 },
+	{ 42 },
+	{ 30 },
+	{ 32 },
+	{ 41 },
+	{ 22 },
+	{ 26 },
+	{ 38 },
+	{ 22 },
+	{ 24 },
+	{ 15 },
+	{ 15 },
+	{ 20 },
+	{ 10 },
+	{ 12 },
+	{ 12 },
+	{ 10 },
+	{ 10 },
+	{ 10 },
+	{ 15 },
+	{ 10 },
+	{ 10 },
+	{ 17 },
+	{ 15 },
+	{ 17 },
+	{ 26 },
+	{ 15 },
+	{ 44 },
+	{ 10 },
+	{ 15 },
+	{ 29 },
+	{ 36 },
+	{ 51 },
+	{ 36 },
+	{ 29 },
+	{ 33 },
+	{ 29 },
+	{ 15 },
+	{ 29 },
+	{ 33 },
+	{ 12 },
+	{ 1 },
+	{ 12 },
+	{ 11 },
+	{ 2 },
+	{ 11 },
+	{ 20 },
+	{ 24 },
+	{ 1 },
+	{ 20 },
+	{ 32 },
+	{ 30 },
+	{ 22 },
+	{ 119 },
+	{ 85 },
+	{ 0 },
+	{ 149 },
+	{ 93 },
+	{ 54 },
+	{ 0 },
+	{ 0 },
+	{ 22 },
+	{ 23 },
+	{ 16 },
+	{ 19 },
+	{ 33 },
+	{ 23 },
+	{ 24 },
+	{ 101 },
+	{ 79 },
+	{ 110 },
+	{ 113 },
+	{ 100 },
+	{ 83 },
+	{ 48 },
+	{ 51 },
+	{ 33 },
+	{ 0 },
+	{ 0 },
+	{ 5 },
+	{ 0 },
+	{ 6 },
+	{ 0 },
+	{ 0 },
+	{ 32 },
+	{ 6 },
+	{ 39 },
+	{ 32 },
+	{ 38 },
+	{ 40 },
+	{ 38 },
+	{ 62 },
+	{ 78 },
+	{ 74 },
+	{ 62 },
+	{ 70 },
+	{ 74 },
+	{ 58 },
+	{ 30 },
+	{ 0 },
+	{ 55 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 43 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 2 },
+	{ 0 },
+	{ 9 },
+	{ 2 },
+	{ 0 },
+	{ 30 },
+	{ 9 },
+	{ 30 },
+	{ 32 },
+	{ 10 },
+	{ 55 },
+	{ 58 },
+	{ 32 },
+	{ 43 },
+	{ 70 },
+	{ 55 },
+	{ 71 },
+	{ 65 },
+	{ 74 },
+	{ 43 },
+	{ 71 },
+	{ 70 },
+	{ 32 },
+	{ 45 },
+	{ 71 },
+	{ 32 },
+	{ 43 },
+	{ 18 },
+	{ 43 },
+	{ 43 },
+	{ 0 },
+	{ 45 },
+	{ 40 },
+	{ 65 },
+	{ 70 },
+	{ 58 },
+	{ 78 },
+	{ 0 },
+	{ 70 },
+	{ 56 },
+	{ 13 },
+	{ 37 },
+	{ 0 },
+	{ 32 },
+	{ 37 },
+	{ 2 },
+	{ 10 },
+	{ 2 },
+	{ 3 },
+	{ 2 },
+	{ 3 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 13 },
+	{ 58 },
+	{ 70 },
+	{ 37 },
+	{ 0 },
+	{ 0 },
+	{ 13 },
+	{ 0 },
+	{ 0 },
+	{ 56 },
+	{ 62 },
+	{ 0 },
+	{ 56 },
+	{ 0 },
+	{ 62 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 38 },
+	{ 0 },
+	{ 38 },
+	{ 39 },
+	{ 40 },
+	{ 22 },
+	{ 24 },
+	{ 39 },
+	{ 0 },
+	{ 22 },
+	{ 38 },
+	{ 22 },
+	{ 0 },
+	{ 10 },
+	{ 18 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 5 },
+	{ 10 },
+	{ 0 },
+	{ 2 },
+	{ 5 },
+	{ 5 },
+	{ 6 },
+	{ 13 },
+	{ 10 },
+	{ 13 },
+	{ 24 },
+	{ 2 },
+	{ 3 },
+	{ 6 },
+	{ 7 },
+	{ 13 },
+	{ 6 },
+	{ 6 },
+	{ 6 },
+	{ 3 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 24 },
+	{ 18 },
+	{ 32 },
+	{ 7 },
+	{ 0 },
+	{ 6 },
+	{ 13 },
+	{ 7 },
+	{ 18 },
+	{ 18 },
+	{ 38 },
+	{ 45 },
+	{ 6 },
+	{ 5 },
+	{ 0 },
+	{ 5 },
+	{ 6 },
+	{ 0 },
+	{ 0 },
+	{ 3 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 5 },
+	{ 2 },
+	{ 1 },
+	{ 18 },
+	{ 12 },
+	{ 5 },
+	{ 18 },
+	{ 24 },
+	{ 12 },
+	{ 29 },
+	{ 24 },
+	{ 30 },
+	{ 33 },
+	{ 30 },
+	{ 37 },
+	{ 38 },
+	{ 37 },
+	{ 57 },
+	{ 49 },
+	{ 53 },
+	{ 38 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 22 },
+	{ 3 },
+	{ 22 },
+	{ 0 },
+	{ 38 },
+	{ 0 },
+	{ 49 },
+	{ 0 },
+	{ 33 },
+	{ 38 },
+	{ 53 },
+	{ 31 },
+	{ 33 },
+	{ 49 },
+	{ 34 },
+	{ 34 },
+	{ 33 },
+	{ 34 },
+	{ 31 },
+	{ 0 },
+	{ 31 },
+	{ 0 },
+	{ 0 },
+	{ 34 },
+	{ 33 },
+	{ 38 },
+	{ 34 },
+	{ 38 },
+	{ 57 },
+	{ 57 },
+	{ 56 },
+	{ 33 },
+	{ 18 },
+	{ 19 },
+	{ 33 },
+	{ 22 },
+	{ 19 },
+	{ 5 },
+	{ 3 },
+	{ 5 },
+	{ 2 },
+	{ 0 },
+	{ 2 },
+	{ 3 },
+	{ 3 },
+	{ 5 },
+	{ 18 },
+	{ 38 },
+	{ 34 },
+	{ 19 },
+	{ 33 },
+	{ 19 },
+	{ 18 },
+	{ 31 },
+	{ 19 },
+	{ 56 },
+	{ 37 },
+	{ 31 },
+	{ 56 },
+	{ 31 },
+	{ 37 },
+	{ 25 },
+	{ 31 },
+	{ 25 },
+	{ 18 },
+	{ 25 },
+	{ 30 },
+	{ 18 },
+	{ 29 },
+	{ 29 },
+	{ 33 },
+	{ 0 },
+	{ 18 },
+	{ 29 },
+	{ 0 },
+	{ 0 },
+	{ 29 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 6 },
+	{ 0 },
+	{ 3 },
+	{ 0 },
+	{ 6 },
+	{ 18 },
+	{ 0 },
+	{ 3 },
+	{ 3 },
+	{ 6 },
+	{ 6 },
+	{ 4 },
+	{ 3 },
+	{ 2 },
+	{ 4 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 18 },
+	{ 16 },
+	{ 24 },
+	{ 6 },
+	{ 5 },
+	{ 12 },
+	{ 6 },
+	{ 6 },
+	{ 16 },
+	{ 34 },
+	{ 34 },
+	{ 29 },
+	{ 5 },
+	{ 6 },
+	{ 2 },
+	{ 2 },
+	{ 4 },
+	{ 1 },
+	{ 1 },
+	{ 2 },
+	{ 0 },
+	{ 3 },
+	{ 19 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 4 },
+	{ 6 },
+	{ 4 },
+	{ 10 },
+	{ 24 },
+	{ 24 },
+	{ 13 },
+	{ 2 },
+	{ 13 },
+	{ 24 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 51 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 34 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 73 },
+	{ 78 },
+	{ 73 },
+	{ 0 },
+	{ 40 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 78 },
+	{ 51 },
+	{ 78 },
+	{ 85 },
+	{ 60 },
+	{ 73 },
+	{ 67 },
+	{ 85 },
+	{ 31 },
+	{ 0 },
+	{ 60 },
+	{ 31 },
+	{ 27 },
+	{ 8 },
+	{ 7 },
+	{ 0 },
+	{ 31 },
+	{ 0 },
+	{ 7 },
+	{ 5 },
+	{ 7 },
+	{ 8 },
+	{ 2 },
+	{ 60 },
+	{ 57 },
+	{ 27 },
+	{ 5 },
+	{ 8 },
+	{ 9 },
+	{ 57 },
+	{ 29 },
+	{ 9 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 2 },
+	{ 1 },
+	{ 4 },
+	{ 13 },
+	{ 1 },
+	{ 5 },
+	{ 4 },
+	{ 13 },
+	{ 13 },
+	{ 6 },
+	{ 4 },
+	{ 6 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 5 },
+	{ 9 },
+	{ 0 },
+	{ 5 },
+	{ 5 },
+	{ 2 },
+	{ 6 },
+	{ 33 },
+	{ 0 },
+	{ 24 },
+	{ 0 },
+	{ 33 },
+	{ 40 },
+	{ 34 },
+	{ 40 },
+	{ 45 },
+	{ 40 },
+	{ 43 },
+	{ 46 },
+	{ 28 },
+	{ 43 },
+	{ 17 },
+	{ 17 },
+	{ 36 },
+	{ 20 },
+	{ 13 },
+	{ 10 },
+	{ 20 },
+	{ 24 },
+	{ 24 },
+	{ 36 },
+	{ 10 },
+	{ 28 },
+	{ 17 },
+	{ 17 },
+	{ 20 },
+	{ 10 },
+	{ 33 },
+	{ 36 },
+	{ 43 },
+	{ 10 },
+	{ 46 },
+	{ 28 },
+	{ 14 },
+	{ 51 },
+	{ 10 },
+	{ 22 },
+	{ 82 },
+	{ 14 },
+	{ 45 },
+	{ 46 },
+	{ 51 },
+	{ 67 },
+	{ 51 },
+	{ 82 },
+	{ 40 },
+	{ 45 },
+	{ 67 },
+	{ 22 },
+	{ 14 },
+	{ 10 },
+	{ 22 },
+	{ 0 },
+	{ 29 },
+	{ 104 },
+	{ 87 },
+	{ 34 },
+	{ 104 },
+	{ 113 },
+	{ 110 },
+	{ 98 },
+	{ 99 },
+	{ 110 },
+	{ 79 },
+	{ 73 },
+	{ 99 },
+	{ 19 },
+	{ 0 },
+	{ 73 },
+	{ 25 },
+	{ 48 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 25 },
+	{ 0 },
+	{ 0 },
+	{ 6 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 19 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 10 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 8 },
+	{ 8 },
+	{ 10 },
+	{ 7 },
+	{ 15 },
+	{ 13 },
+	{ 10 },
+	{ 1 },
+	{ 10 },
+	{ 10 },
+	{ 6 },
+	{ 1 },
+	{ 10 },
+	{ 10 },
+	{ 8 },
+	{ 6 },
+	{ 25 },
+	{ 6 },
+	{ 22 },
+	{ 22 },
+	{ 10 },
+	{ 15 },
+	{ 73 },
+	{ 48 },
+	{ 77 },
+	{ 36 },
+	{ 22 },
+	{ 48 },
+	{ 16 },
+	{ 34 },
+	{ 48 },
+	{ 6 },
+	{ 16 },
+	{ 15 },
+	{ 6 },
+	{ 7 },
+	{ 18 },
+	{ 7 },
+	{ 6 },
+	{ 6 },
+	{ 34 },
+	{ 16 },
+	{ 6 },
+	{ 48 },
+	{ 84 },
+	{ 77 },
+	{ 84 },
+	{ 101 },
+	{ 99 },
+	{ 101 },
+	{ 84 },
+	{ 104 },
+	{ 34 },
+	{ 87 },
+	{ 84 },
+	{ 48 },
+	{ 25 },
+	{ 36 },
+	{ 22 },
+	{ 19 },
+	{ 79 },
+	{ 33 },
+	{ 22 },
+	{ 84 },
+	{ 22 },
+	{ 0 },
+	{ 0 },
+	{ 33 },
+	{ 18 },
+	{ 0 },
+	{ 18 },
+	{ 33 },
+	{ 36 },
+	{ 36 },
+	{ 84 },
+	{ 44 },
+	{ 84 },
+	{ 79 },
+	{ 98 },
+	{ 44 },
+	{ 98 },
+	{ 48 },
+	{ 113 },
+	{ 88 },
+	{ 48 },
+	{ 23 },
+	{ 36 },
+	{ 27 },
+	{ 27 },
+	{ 44 },
+	{ 33 },
+	{ 0 },
+	{ 18 },
+	{ 23 },
+	{ 18 },
+	{ 0 },
+	{ 0 },
+	{ 23 },
+	{ 13 },
+	{ 0 },
+	{ 104 },
+	{ 78 },
+	{ 113 },
+	{ 88 },
+	{ 78 },
+	{ 40 },
+	{ 34 },
+	{ 78 },
+	{ 21 },
+	{ 15 },
+	{ 20 },
+	{ 21 },
+	{ 40 },
+	{ 34 },
+	{ 20 },
+	{ 88 },
+	{ 40 },
+	{ 33 },
+	{ 19 },
+	{ 27 },
+	{ 20 },
+	{ 20 },
+	{ 15 },
+	{ 12 },
+	{ 13 },
+	{ 23 },
+	{ 19 },
+	{ 10 },
+	{ 13 },
+	{ 12 },
+	{ 21 },
+	{ 18 },
+	{ 13 },
+	{ 89 },
+	{ 48 },
+	{ 22 },
+	{ 89 },
+	{ 101 },
+	{ 91 },
+	{ 85 },
+	{ 93 },
+	{ 91 },
+	{ 93 },
+	{ 78 },
+	{ 93 },
+	{ 0 },
+	{ 0 },
+	{ 78 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 3 },
+	{ 3 },
+	{ 5 },
+	{ 2 },
+	{ 5 },
+	{ 10 },
+	{ 7 },
+	{ 0 },
+	{ 0 },
+	{ 5 },
+	{ 1 },
+	{ 0 },
+	{ 3 },
+	{ 3 },
+	{ 3 },
+	{ 2 },
+	{ 0 },
+	{ 1 },
+	{ 9 },
+	{ 9 },
+	{ 3 },
+	{ 7 },
+	{ 78 },
+	{ 0 },
+	{ 59 },
+	{ 25 },
+	{ 9 },
+	{ 21 },
+	{ 5 },
+	{ 22 },
+	{ 21 },
+	{ 2 },
+	{ 5 },
+	{ 7 },
+	{ 2 },
+	{ 2 },
+	{ 8 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 22 },
+	{ 5 },
+	{ 2 },
+	{ 21 },
+	{ 57 },
+	{ 59 },
+	{ 93 },
+	{ 59 },
+	{ 99 },
+	{ 99 },
+	{ 57 },
+	{ 89 },
+	{ 57 },
+	{ 21 },
+	{ 48 },
+	{ 9 },
+	{ 25 },
+	{ 0 },
+	{ 37 },
+	{ 0 },
+	{ 93 },
+	{ 44 },
+	{ 37 },
+	{ 75 },
+	{ 37 },
+	{ 0 },
+	{ 0 },
+	{ 44 },
+	{ 0 },
+	{ 0 },
+	{ 75 },
+	{ 33 },
+	{ 0 },
+	{ 33 },
+	{ 75 },
+	{ 45 },
+	{ 75 },
+	{ 93 },
+	{ 85 },
+	{ 45 },
+	{ 85 },
+	{ 55 },
+	{ 101 },
+	{ 85 },
+	{ 55 },
+	{ 0 },
+	{ 33 },
+	{ 24 },
+	{ 24 },
+	{ 45 },
+	{ 33 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 89 },
+	{ 37 },
+	{ 101 },
+	{ 85 },
+	{ 37 },
+	{ 35 },
+	{ 8 },
+	{ 19 },
+	{ 30 },
+	{ 30 },
+	{ 19 },
+	{ 14 },
+	{ 23 },
+	{ 33 },
+	{ 30 },
+	{ 85 },
+	{ 35 },
+	{ 33 },
+	{ 18 },
+	{ 24 },
+	{ 23 },
+	{ 10 },
+	{ 18 },
+	{ 14 },
+	{ 0 },
+	{ 0 },
+	{ 18 },
+	{ 18 },
+	{ 10 },
+	{ 0 },
+	{ 19 },
+	{ 8 },
+	{ 7 },
+	{ 83 },
+	{ 103 },
+	{ 132 },
+	{ 114 },
+	{ 45 },
+	{ 45 },
+	{ 85 },
+	{ 113 },
+	{ 99 },
+	{ 64 },
+	{ 88 },
+	{ 85 },
+	{ 88 },
+	{ 64 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 76 },
+	{ 0 },
+	{ 0 },
+	{ 51 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 76 },
+	{ 51 },
+	{ 82 },
+	{ 32 },
+	{ 52 },
+	{ 51 },
+	{ 32 },
+	{ 15 },
+	{ 25 },
+	{ 15 },
+	{ 32 },
+	{ 0 },
+	{ 52 },
+	{ 32 },
+	{ 47 },
+	{ 47 },
+	{ 91 },
+	{ 82 },
+	{ 113 },
+	{ 82 },
+	{ 127 },
+	{ 83 },
+	{ 132 },
+	{ 127 },
+	{ 49 },
+	{ 83 },
+	{ 91 },
+	{ 0 },
+	{ 0 },
+	{ 88 },
+	{ 88 },
+	{ 76 },
+	{ 113 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 34 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 34 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 34 },
+	{ 64 },
+	{ 39 },
+	{ 33 },
+	{ 25 },
+	{ 0 },
+	{ 25 },
+	{ 33 },
+	{ 27 },
+	{ 33 },
+	{ 39 },
+	{ 37 },
+	{ 0 },
+	{ 34 },
+	{ 33 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 2 },
+	{ 0 },
+	{ 15 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 39 },
+	{ 85 },
+	{ 45 },
+	{ 132 },
+	{ 114 },
+	{ 99 },
+	{ 114 },
+	{ 103 },
+	{ 45 },
+	{ 45 },
+	{ 42 },
+	{ 37 },
+	{ 42 },
+	{ 31 },
+	{ 27 },
+	{ 31 },
+	{ 26 },
+	{ 19 },
+	{ 42 },
+	{ 103 },
+	{ 31 },
+	{ 12 },
+	{ 19 },
+	{ 14 },
+	{ 27 },
+	{ 19 },
+	{ 15 },
+	{ 19 },
+	{ 12 },
+	{ 10 },
+	{ 9 },
+	{ 10 },
+	{ 6 },
+	{ 1 },
+	{ 1 },
+	{ 9 },
+	{ 1 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 2 },
+	{ 10 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 15 },
+	{ 15 },
+	{ 9 },
+	{ 8 },
+	{ 10 },
+	{ 6 },
+	{ 8 },
+	{ 14 },
+	{ 10 },
+	{ 6 },
+	{ 10 },
+	{ 14 },
+	{ 26 },
+	{ 24 },
+	{ 6 },
+	{ 10 },
+	{ 6 },
+	{ 24 },
+	{ 25 },
+	{ 47 },
+	{ 25 },
+	{ 49 },
+	{ 83 },
+	{ 49 },
+	{ 24 },
+	{ 3 },
+	{ 3 },
+	{ 3 },
+	{ 2 },
+	{ 3 },
+	{ 3 },
+	{ 9 },
+	{ 10 },
+	{ 3 },
+	{ 5 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 5 },
+	{ 3 },
+	{ 0 },
+	{ 3 },
+	{ 5 },
+	{ 29 },
+	{ 57 },
+	{ 22 },
+	{ 57 },
+	{ 60 },
+	{ 82 },
+	{ 0 },
+	{ 34 },
+	{ 40 },
+	{ 18 },
+	{ 7 },
+	{ 7 },
+	{ 8 },
+	{ 2 },
+	{ 2 },
+	{ 0 },
+	{ 3 },
+	{ 0 },
+	{ 0 },
+	{ 5 },
+	{ 8 },
+	{ 8 },
+	{ 15 },
+	{ 9 },
+	{ 9 },
+	{ 17 },
+	{ 3 },
+	{ 3 },
+	{ 5 },
+	{ 5 },
+	{ 5 },
+	{ 10 },
+	{ 5 },
+	{ 5 },
+	{ 9 },
+	{ 2 },
+	{ 2 },
+	{ 3 },
+	{ 2 },
+	{ 0 },
+	{ 72 },
+	{ 20 },
+	{ 8 },
+	{ 92 },
+	{ 72 },
+	{ 9 },
+	{ 89 },
+	{ 92 },
+	{ 89 },
+	{ 9 },
+	{ 80 },
+	{ 80 },
+	{ 3 },
+	{ 78 },
+	{ 78 },
+	{ 5 },
+	{ 76 },
+	{ 76 },
+	{ 5 },
+	{ 56 },
+	{ 56 },
+	{ 2 },
+	{ 0 },
+	{ 72 },
+	{ 33 },
+	{ 14 },
+	{ 92 },
+	{ 41 },
+	{ 33 },
+	{ 89 },
+	{ 43 },
+	{ 41 },
+	{ 80 },
+	{ 45 },
+	{ 43 },
+	{ 78 },
+	{ 48 },
+	{ 45 },
+	{ 76 },
+	{ 51 },
+	{ 48 },
+	{ 56 },
+	{ 58 },
+	{ 51 },
+	{ 58 },
+	{ 56 },
+	{ 102 },
+	{ 33 },
+	{ 29 },
+	{ 10 },
+	{ 41 },
+	{ 37 },
+	{ 29 },
+	{ 43 },
+	{ 41 },
+	{ 37 },
+	{ 45 },
+	{ 44 },
+	{ 41 },
+	{ 48 },
+	{ 45 },
+	{ 44 },
+	{ 51 },
+	{ 49 },
+	{ 45 },
+	{ 49 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 58 },
+	{ 50 },
+	{ 29 },
+	{ 31 },
+	{ 18 },
+	{ 37 },
+	{ 41 },
+	{ 31 },
+	{ 41 },
+	{ 37 },
+	{ 41 },
+	{ 44 },
+	{ 44 },
+	{ 41 },
+	{ 44 },
+	{ 44 },
+	{ 45 },
+	{ 45 },
+	{ 45 },
+	{ 48 },
+	{ 48 },
+	{ 49 },
+	{ 49 },
+	{ 49 },
+	{ 51 },
+	{ 45 },
+	{ 31 },
+	{ 40 },
+	{ 27 },
+	{ 41 },
+	{ 44 },
+	{ 40 },
+	{ 41 },
+	{ 45 },
+	{ 44 },
+	{ 45 },
+	{ 41 },
+	{ 45 },
+	{ 45 },
+	{ 44 },
+	{ 46 },
+	{ 46 },
+	{ 45 },
+	{ 48 },
+	{ 48 },
+	{ 48 },
+	{ 49 },
+	{ 49 },
+	{ 49 },
+	{ 42 },
+	{ 36 },
+	{ 27 },
+	{ 48 },
+	{ 48 },
+	{ 40 },
+	{ 47 },
+	{ 47 },
+	{ 44 },
+	{ 47 },
+	{ 47 },
+	{ 45 },
+	{ 46 },
+	{ 46 },
+	{ 45 },
+	{ 44 },
+	{ 47 },
+	{ 48 },
+	{ 49 },
+	{ 49 },
+	{ 49 },
+	{ 47 },
+	{ 44 },
+	{ 36 },
+	{ 49 },
+	{ 49 },
+	{ 48 },
+	{ 49 },
+	{ 49 },
+	{ 47 },
+	{ 49 },
+	{ 49 },
+	{ 47 },
+	{ 49 },
+	{ 49 },
+	{ 46 },
+	{ 45 },
+	{ 47 },
+	{ 47 },
+	{ 48 },
+	{ 48 },
+	{ 49 },
+	{ 49 },
+	{ 48 },
+	{ 44 },
+	{ 50 },
+	{ 50 },
+	{ 49 },
+	{ 49 },
+	{ 49 },
+	{ 49 },
+	{ 49 },
+	{ 49 },
+	{ 49 },
+	{ 50 },
+	{ 50 },
+	{ 49 },
+	{ 45 },
+	{ 45 },
+	{ 47 },
+	{ 49 },
+	{ 49 },
+	{ 48 },
+	{ 51 },
+	{ 51 },
+	{ 40 },
+	{ 41 },
+	{ 50 },
+	{ 52 },
+	{ 40 },
+	{ 49 },
+	{ 66 },
+	{ 52 },
+	{ 49 },
+	{ 85 },
+	{ 66 },
+	{ 46 },
+	{ 91 },
+	{ 85 },
+	{ 51 },
+	{ 80 },
+	{ 77 },
+	{ 50 },
+	{ 83 },
+	{ 80 },
+	{ 6 },
+	{ 10 },
+	{ 6 },
+	{ 6 },
+	{ 3 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 0 },
+	{ 5 },
+	{ 5 },
+	{ 5 },
+	{ 19 },
+	{ 9 },
+	{ 6 },
+	{ 9 },
+	{ 9 },
+	{ 9 },
+	{ 29 },
+	{ 6 },
+	{ 6 },
+	{ 2 },
+	{ 2 },
+	{ 6 },
+	{ 5 },
+	{ 5 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 5 },
+	{ 5 },
+	{ 5 },
+	{ 17 },
+	{ 6 },
+	{ 9 },
+	{ 6 },
+	{ 6 },
+	{ 9 },
+	{ 14 },
+	{ 3 },
+	{ 6 },
+	{ 3 },
+	{ 3 },
+	{ 2 },
+	{ 5 },
+	{ 5 },
+	{ 5 },
+	{ 9 },
+	{ 9 },
+	{ 2 },
+	{ 11 },
+	{ 11 },
+	{ 5 },
+	{ 3 },
+	{ 3 },
+	{ 6 },
+	{ 0 },
+	{ 0 },
+	{ 6 },
+	{ 0 },
+	{ 2 },
+	{ 3 },
+	{ 1 },
+	{ 1 },
+	{ 3 },
+	{ 5 },
+	{ 9 },
+	{ 12 },
+	{ 5 },
+	{ 12 },
+	{ 9 },
+	{ 8 },
+	{ 8 },
+	{ 11 },
+	{ 5 },
+	{ 5 },
+	{ 3 },
+	{ 0 },
+	{ 0 },
+	{ 3 },
+	{ 15 },
+	{ 15 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 3 },
+	{ 1 },
+	{ 5 },
+	{ 2 },
+	{ 3 },
+	{ 12 },
+	{ 6 },
+	{ 2 },
+	{ 6 },
+	{ 12 },
+	{ 7 },
+	{ 7 },
+	{ 8 },
+	{ 6 },
+	{ 6 },
+	{ 5 },
+	{ 11 },
+	{ 11 },
+	{ 0 },
+	{ 7 },
+	{ 0 },
+	{ 7 },
+	{ 7 },
+	{ 3 },
+	{ 2 },
+	{ 1 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 6 },
+	{ 2 },
+	{ 2 },
+	{ 7 },
+	{ 3 },
+	{ 2 },
+	{ 6 },
+	{ 2 },
+	{ 3 },
+	{ 2 },
+	{ 6 },
+	{ 4 },
+	{ 7 },
+	{ 2 },
+	{ 4 },
+	{ 7 },
+	{ 0 },
+	{ 2 },
+	{ 2 },
+	{ 1 },
+	{ 2 },
+	{ 2 },
+	{ 4 },
+	{ 1 },
+	{ 2 },
+	{ 3 },
+	{ 4 },
+	{ 3 },
+	{ 2 },
+	{ 3 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 4 },
+	{ 3 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 3 },
+	{ 0 },
+	{ 1 },
+	{ 2 },
+	{ 1 },
+	{ 2 },
+	{ 1 },
+	{ 4 },
+	{ 4 },
+	{ 2 },
+	{ 3 },
+	{ 4 },
+	{ 4 },
+	{ 2 },
+	{ 6 },
+	{ 4 },
+	{ 6 },
+	{ 2 },
+	{ 5 },
+	{ 5 },
+	{ 2 },
+	{ 4 },
+	{ 2 },
+	{ 4 },
+	{ 4 },
+	{ 4 },
+	{ 2 },
+	{ 3 },
+	{ 63 },
+	{ 51 },
+	{ 49 },
+	{ 58 },
+	{ 49 },
+	{ 47 },
+	{ 43 },
+	{ 47 },
+	{ 42 },
+	{ 19 },
+	{ 42 },
+	{ 45 },
+	{ 50 },
+	{ 40 },
+	{ 45 },
+	{ 102 },
+	{ 0 },
+	{ 50 },
+	{ 0 },
+	{ 102 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 3 },
+	{ 21 },
+	{ 44 },
+	{ 48 },
+	{ 44 },
+	{ 21 },
+	{ 36 },
+	{ 7 },
+	{ 27 },
+	{ 36 },
+	{ 5 },
+	{ 18 },
+	{ 27 },
+	{ 1 },
+	{ 10 },
+	{ 18 },
+	{ 10 },
+	{ 1 },
+	{ 14 },
+	{ 14 },
+	{ 0 },
+	{ 20 },
+	{ 20 },
+	{ 2 },
+	{ 0 },
+	{ 49 },
+	{ 48 },
+	{ 50 },
+	{ 6 },
+	{ 3 },
+	{ 13 },
+	{ 31 },
+	{ 25 },
+	{ 49 },
+	{ 49 },
+	{ 50 },
+	{ 50 },
+	{ 3 },
+	{ 2 },
+	{ 6 },
+	{ 49 },
+	{ 50 },
+	{ 50 },
+	{ 6 },
+	{ 0 },
+	{ 3 },
+	{ 50 },
+	{ 49 },
+	{ 50 },
+	{ 11 },
+	{ 5 },
+	{ 6 },
+	{ 50 },
+	{ 50 },
+	{ 43 },
+	{ 12 },
+	{ 13 },
+	{ 11 },
+	{ 47 },
+	{ 45 },
+	{ 49 },
+	{ 19 },
+	{ 9 },
+	{ 16 },
+	{ 49 },
+	{ 49 },
+	{ 50 },
+	{ 50 },
+	{ 51 },
+	{ 63 },
+	{ 40 },
+	{ 39 },
+	{ 19 },
+	{ 50 },
+	{ 51 },
+	{ 48 },
+	{ 13 },
+	{ 19 },
+	{ 19 },
+	{ 41 },
+	{ 31 },
+	{ 48 },
+	{ 50 },
+	{ 50 },
+	{ 51 },
+	{ 13 },
+	{ 3 },
+	{ 19 },
+	{ 50 },
+	{ 49 },
+	{ 50 },
+	{ 25 },
+	{ 6 },
+	{ 13 },
+	{ 50 },
+	{ 49 },
+	{ 49 },
+	{ 35 },
+	{ 11 },
+	{ 25 },
+	{ 49 },
+	{ 50 },
+	{ 46 },
+	{ 41 },
+	{ 12 },
+	{ 35 },
+	{ 50 },
+	{ 47 },
+	{ 51 },
+	{ 53 },
+	{ 19 },
+	{ 56 },
+	{ 51 },
+	{ 49 },
+	{ 50 },
+	{ 63 },
+	{ 83 },
+	{ 50 },
+	{ 56 },
+	{ 40 },
+	{ 53 },
+	{ 37 },
+	{ 46 },
+	{ 47 },
+	{ 37 },
+	{ 47 },
+	{ 47 },
+	{ 37 },
+	{ 47 },
+	{ 45 },
+	{ 37 },
+	{ 45 },
+	{ 47 },
+	{ 40 },
+	{ 47 },
+	{ 50 },
+	{ 45 },
+	{ 50 },
+	{ 77 },
+	{ 56 },
+	{ 16 },
+	{ 44 },
+	{ 16 },
+	{ 6 },
+	{ 10 },
+	{ 7 },
+	{ 6 },
+	{ 9 },
+	{ 4 },
+	{ 9 },
+	{ 6 },
+	{ 2 },
+	{ 6 },
+	{ 3 },
+	{ 46 },
+	{ 37 },
+	{ 19 },
+	{ 19 },
+	{ 33 },
+	{ 44 },
+	{ 15 },
+	{ 15 },
+	{ 37 },
+	{ 39 },
+	{ 18 },
+	{ 45 },
+	{ 37 },
+	{ 15 },
+	{ 37 },
+	{ 37 },
+	{ 40 },
+	{ 18 },
+	{ 60 },
+	{ 91 },
+	{ 46 },
+	{ 43 },
+	{ 45 },
+	{ 60 },
+	{ 45 },
+	{ 45 },
+	{ 57 },
+	{ 45 },
+	{ 44 },
+	{ 52 },
+	{ 18 },
+	{ 0 },
+	{ 19 },
+	{ 19 },
+	{ 0 },
+	{ 43 },
+	{ 43 },
+	{ 14 },
+	{ 58 },
+	{ 58 },
+	{ 29 },
+	{ 63 },
+	{ 63 },
+	{ 39 },
+	{ 40 },
+	{ 63 },
+	{ 40 },
+	{ 56 },
+	{ 53 },
+	{ 80 },
+	{ 56 },
+	{ 56 },
+	{ 77 },
+	{ 53 },
+	{ 39 },
+	{ 77 },
+	{ 56 },
+	{ 44 },
+	{ 10 },
+	{ 39 },
+	{ 10 },
+	{ 7 },
+	{ 18 },
+	{ 4 },
+	{ 15 },
+	{ 15 },
+	{ 15 },
+	{ 4 },
+	{ 2 },
+	{ 15 },
+	{ 2 },
+	{ 3 },
+	{ 17 },
+	{ 33 },
+	{ 3 },
+	{ 19 },
+	{ 52 },
+	{ 17 },
+	{ 52 },
+	{ 19 },
+	{ 13 },
+	{ 57 },
+	{ 13 },
+	{ 12 },
+	{ 41 },
+	{ 91 },
+	{ 12 },
+	{ 91 },
+	{ 41 },
+	{ 35 },
+	{ 25 },
+	{ 66 },
+	{ 35 },
+	{ 13 },
+	{ 52 },
+	{ 25 },
+	{ 19 },
+	{ 40 },
+	{ 13 },
+	{ 19 },
+	{ 41 },
+	{ 19 },
+	{ 31 },
+	{ 41 },
+	{ 19 },
+	{ 25 },
+	{ 31 },
+	{ 13 },
+	{ 6 },
+	{ 21 },
+	{ 25 },
+	{ 6 },
+	{ 13 },
+	{ 21 },
+	{ 3 },
+	{ 7 },
+	{ 13 },
+	{ 2 },
+	{ 5 },
+	{ 7 },
+	{ 5 },
+	{ 2 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 2 },
+	{ 1 },
+	{ 3 },
+	{ 2 },
+	{ 2 },
+	{ 5 },
+	{ 3 },
+	{ 4 },
+	{ 15 },
+	{ 5 },
+	{ 4 },
+	{ 17 },
+	{ 15 },
+	{ 6 },
+	{ 5 },
+	{ 17 },
+	{ 5 },
+	{ 10 },
+	{ 5 },
+	{ 4 },
+	{ 9 },
+	{ 10 },
+	{ 4 },
+	{ 7 },
+	{ 9 },
+	{ 3 },
+	{ 2 },
+	{ 7 },
+	{ 2 },
+	{ 3 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 40 },
+	{ 40 },
+	{ 7 },
+	{ 18 },
+	{ 139 },
+	{ 72 },
+	{ 162 },
+	{ 19 },
+	{ 38 },
+	{ 37 },
+	{ 38 },
+	{ 19 },
+	{ 37 },
+	{ 114 },
+	{ 38 },
+	{ 118 },
+	{ 100 },
+	{ 37 },
+	{ 114 },
+	{ 16 },
+	{ 19 },
+	{ 37 },
+	{ 72 },
+	{ 31 },
+	{ 100 },
+	{ 31 },
+	{ 26 },
+	{ 16 },
+	{ 58 },
+	{ 26 },
+	{ 72 },
+	{ 5 },
+	{ 5 },
+	{ 26 },
+	{ 24 },
+	{ 2 },
+	{ 58 },
+	{ 2 },
+	{ 1 },
+	{ 5 },
+	{ 0 },
+	{ 1 },
+	{ 24 },
+	{ 1 },
+	{ 2 },
+	{ 3 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 2 },
+	{ 5 },
+	{ 4 },
+	{ 6 },
+	{ 2 },
+	{ 4 },
+	{ 0 },
+	{ 4 },
+	{ 0 },
+	{ 1 },
+	{ 2 },
+	{ 0 },
+	{ 7 },
+	{ 5 },
+	{ 3 },
+	{ 7 },
+	{ 3 },
+	{ 6 },
+	{ 3 },
+	{ 3 },
+	{ 0 },
+	{ 3 },
+	{ 0 },
+	{ 6 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 37 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 31 },
+	{ 37 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 3 },
+	{ 6 },
+	{ 6 },
+	{ 3 },
+	{ 0 },
+	{ 4 },
+	{ 6 },
+	{ 1 },
+	{ 31 },
+	{ 9 },
+	{ 9 },
+	{ 3 },
+	{ 5 },
+	{ 39 },
+	{ 0 },
+	{ 37 },
+	{ 39 },
+	{ 31 },
+	{ 1 },
+	{ 37 },
+	{ 0 },
+	{ 52 },
+	{ 45 },
+	{ 37 },
+	{ 65 },
+	{ 53 },
+	{ 45 },
+	{ 70 },
+	{ 70 },
+	{ 72 },
+	{ 54 },
+	{ 70 },
+	{ 79 },
+	{ 72 },
+	{ 70 },
+	{ 65 },
+	{ 84 },
+	{ 45 },
+	{ 39 },
+	{ 45 },
+	{ 45 },
+	{ 37 },
+	{ 31 },
+	{ 45 },
+	{ 45 },
+	{ 53 },
+	{ 45 },
+	{ 0 },
+	{ 37 },
+	{ 77 },
+	{ 84 },
+	{ 52 },
+	{ 24 },
+	{ 77 },
+	{ 0 },
+	{ 58 },
+	{ 110 },
+	{ 24 },
+	{ 5 },
+	{ 3 },
+	{ 5 },
+	{ 5 },
+	{ 5 },
+	{ 7 },
+	{ 7 },
+	{ 6 },
+	{ 16 },
+	{ 6 },
+	{ 19 },
+	{ 19 },
+	{ 19 },
+	{ 19 },
+	{ 19 },
+	{ 19 },
+	{ 10 },
+	{ 16 },
+	{ 36 },
+	{ 6 },
+	{ 10 },
+	{ 6 },
+	{ 36 },
+	{ 135 },
+	{ 27 },
+	{ 6 },
+	{ 154 },
+	{ 10 },
+	{ 10 },
+	{ 27 },
+	{ 18 },
+	{ 14 },
+	{ 12 },
+	{ 12 },
+	{ 20 },
+	{ 121 },
+	{ 36 },
+	{ 12 },
+	{ 162 },
+	{ 12 },
+	{ 36 },
+	{ 19 },
+	{ 18 },
+	{ 19 },
+	{ 20 },
+	{ 18 },
+	{ 21 },
+	{ 14 },
+	{ 20 },
+	{ 19 },
+	{ 5 },
+	{ 5 },
+	{ 6 },
+	{ 6 },
+	{ 10 },
+	{ 5 },
+	{ 6 },
+	{ 6 },
+	{ 6 },
+	{ 6 },
+	{ 5 },
+	{ 6 },
+	{ 7 },
+	{ 6 },
+	{ 5 },
+	{ 4 },
+	{ 110 },
+	{ 58 },
+	{ 139 },
+	{ 116 },
+	{ 110 },
+	{ 142 },
+	{ 98 },
+	{ 116 },
+	{ 125 },
+	{ 125 },
+	{ 108 },
+	{ 95 },
+	{ 104 },
+	{ 95 },
+	{ 103 },
+	{ 96 },
+	{ 104 },
+	{ 88 },
+	{ 83 },
+	{ 96 },
+	{ 69 },
+	{ 51 },
+	{ 69 },
+	{ 88 },
+	{ 106 },
+	{ 75 },
+	{ 103 },
+	{ 104 },
+	{ 89 },
+	{ 81 },
+	{ 96 },
+	{ 81 },
+	{ 89 },
+	{ 109 },
+	{ 106 },
+	{ 108 },
+	{ 108 },
+	{ 125 },
+	{ 150 },
+	{ 107 },
+	{ 122 },
+	{ 110 },
+	{ 109 },
+	{ 122 },
+	{ 106 },
+	{ 122 },
+	{ 109 },
+	{ 9 },
+	{ 9 },
+	{ 0 },
+	{ 0 },
+	{ 44 },
+	{ 9 },
+	{ 11 },
+	{ 133 },
+	{ 122 },
+	{ 44 },
+	{ 49 },
+	{ 81 },
+	{ 0 },
+	{ 0 },
+	{ 32 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 109 },
+	{ 189 },
+	{ 81 },
+	{ 49 },
+	{ 49 },
+	{ 109 },
+	{ 150 },
+	{ 116 },
+	{ 98 },
+	{ 79 },
+	{ 81 },
+	{ 79 },
+	{ 98 },
+	{ 168 },
+	{ 150 },
+	{ 142 },
+	{ 162 },
+	{ 168 },
+	{ 139 },
+	{ 173 },
+	{ 186 },
+	{ 189 },
+	{ 173 },
+	{ 150 },
+	{ 168 },
+	{ 186 },
+	{ 121 },
+	{ 196 },
+	{ 186 },
+	{ 168 },
+	{ 162 },
+	{ 196 },
+	{ 199 },
+	{ 156 },
+	{ 196 },
+	{ 189 },
+	{ 196 },
+	{ 199 },
+	{ 113 },
+	{ 165 },
+	{ 199 },
+	{ 196 },
+	{ 119 },
+	{ 50 },
+	{ 49 },
+	{ 43 },
+	{ 50 },
+	{ 156 },
+	{ 165 },
+	{ 49 },
+	{ 45 },
+	{ 38 },
+	{ 95 },
+	{ 45 },
+	{ 165 },
+	{ 37 },
+	{ 16 },
+	{ 38 },
+	{ 29 },
+	{ 44 },
+	{ 38 },
+	{ 44 },
+	{ 103 },
+	{ 114 },
+	{ 118 },
+	{ 37 },
+	{ 114 },
+	{ 18 },
+	{ 16 },
+	{ 10 },
+	{ 18 },
+	{ 14 },
+	{ 29 },
+	{ 14 },
+	{ 10 },
+	{ 37 },
+	{ 37 },
+	{ 27 },
+	{ 165 },
+	{ 75 },
+	{ 37 },
+	{ 163 },
+	{ 37 },
+	{ 75 },
+	{ 33 },
+	{ 165 },
+	{ 114 },
+	{ 163 },
+	{ 165 },
+	{ 154 },
+	{ 118 },
+	{ 75 },
+	{ 44 },
+	{ 33 },
+	{ 103 },
+	{ 44 },
+	{ 163 },
+	{ 135 },
+	{ 114 },
+	{ 154 },
+	{ 135 },
+	{ 162 },
+	{ 100 },
+	{ 2 },
+	{ 10 },
+	{ 4 },
+	{ 2 },
+	{ 9 },
+	{ 8 },
+	{ 2 },
+	{ 6 },
+	{ 10 },
+	{ 2 },
+	{ 8 },
+	{ 10 },
+	{ 0 },
+	{ 2 },
+	{ 6 },
+	{ 6 },
+	{ 10 },
+	{ 11 },
+	{ 18 },
+	{ 11 },
+	{ 10 },
+	{ 18 },
+	{ 10 },
+	{ 33 },
+	{ 29 },
+	{ 48 },
+	{ 27 },
+	{ 47 },
+	{ 48 },
+	{ 58 },
+	{ 29 },
+	{ 41 },
+	{ 29 },
+	{ 51 },
+	{ 51 },
+	{ 48 },
+	{ 50 },
+	{ 29 },
+	{ 23 },
+	{ 51 },
+	{ 41 },
+	{ 29 },
+	{ 41 },
+	{ 29 },
+	{ 10 },
+	{ 29 },
+	{ 10 },
+	{ 6 },
+	{ 62 },
+	{ 49 },
+	{ 49 },
+	{ 49 },
+	{ 51 },
+	{ 75 },
+	{ 67 },
+	{ 107 },
+	{ 62 },
+	{ 67 },
+	{ 75 },
+	{ 106 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 62 },
+	{ 60 },
+	{ 49 },
+	{ 60 },
+	{ 107 },
+	{ 51 },
+	{ 60 },
+	{ 62 },
+	{ 110 },
+	{ 107 },
+	{ 83 },
+	{ 58 },
+	{ 107 },
+	{ 110 },
+	{ 133 },
+	{ 33 },
+	{ 27 },
+	{ 47 },
+	{ 47 },
+	{ 58 },
+	{ 109 },
+	{ 49 },
+	{ 49 },
+	{ 20 },
+	{ 20 },
+	{ 23 },
+	{ 9 },
+	{ 19 },
+	{ 20 },
+	{ 4 },
+	{ 51 },
+	{ 49 },
+	{ 19 },
+	{ 8 },
+	{ 6 },
+	{ 10 },
+	{ 29 },
+	{ 9 },
+	{ 29 },
+	{ 9 },
+	{ 10 },
+	{ 8 },
+	{ 9 },
+	{ 29 },
+	{ 27 },
+	{ 6 },
+	{ 10 },
+	{ 2 },
+	{ 2 },
+	{ 0 },
+	{ 6 },
+	{ 14 },
+	{ 10 },
+	{ 0 },
+	{ 21 },
+	{ 20 },
+	{ 14 },
+	{ 21 },
+	{ 20 },
+	{ 18 },
+	{ 25 },
+	{ 22 },
+	{ 22 },
+	{ 25 },
+	{ 43 },
+	{ 38 },
+	{ 25 },
+	{ 22 },
+	{ 19 },
+	{ 25 },
+	{ 22 },
+	{ 43 },
+	{ 97 },
+	{ 39 },
+	{ 32 },
+	{ 75 },
+	{ 50 },
+	{ 39 },
+	{ 22 },
+	{ 39 },
+	{ 42 },
+	{ 39 },
+	{ 22 },
+	{ 19 },
+	{ 97 },
+	{ 196 },
+	{ 75 },
+	{ 189 },
+	{ 196 },
+	{ 81 },
+	{ 50 },
+	{ 50 },
+	{ 42 },
+	{ 156 },
+	{ 50 },
+	{ 75 },
+	{ 14 },
+	{ 0 },
+	{ 0 },
+	{ 22 },
+	{ 20 },
+	{ 19 },
+	{ 5 },
+	{ 10 },
+	{ 20 },
+	{ 6 },
+	{ 5 },
+	{ 7 },
+	{ 6 },
+	{ 10 },
+	{ 6 },
+	{ 7 },
+	{ 6 },
+	{ 5 },
+	{ 6 },
+	{ 6 },
+	{ 6 },
+	{ 6 },
+	{ 7 },
+	{ 6 },
+	{ 6 },
+	{ 5 },
+	{ 6 },
+	{ 4 },
+	{ 6 },
+	{ 6 },
+	{ 0 },
+	{ 5 },
+	{ 6 },
+	{ 6 },
+	{ 5 },
+	{ 0 },
+	{ 5 },
+	{ 6 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 4 },
+	{ 6 },
+	{ 6 },
+	{ 7 },
+	{ 8 },
+	{ 6 },
+	{ 6 },
+	{ 6 },
+	{ 3 },
+	{ 10 },
+	{ 3 },
+	{ 9 },
+	{ 10 },
+	{ 26 },
+	{ 44 },
+	{ 28 },
+	{ 6 },
+	{ 0 },
+	{ 3 },
+	{ 10 },
+	{ 26 },
+	{ 9 },
+	{ 6 },
+	{ 6 },
+	{ 6 },
+	{ 8 },
+	{ 8 },
+	{ 6 },
+	{ 10 },
+	{ 6 },
+	{ 8 },
+	{ 6 },
+	{ 7 },
+	{ 5 },
+	{ 6 },
+	{ 5 },
+	{ 7 },
+	{ 6 },
+	{ 6 },
+	{ 7 },
+	{ 4 },
+	{ 10 },
+	{ 8 },
+	{ 87 },
+	{ 51 },
+	{ 40 },
+	{ 40 },
+	{ 19 },
+	{ 13 },
+	{ 63 },
+	{ 40 },
+	{ 21 },
+	{ 40 },
+	{ 63 },
+	{ 77 },
+	{ 63 },
+	{ 76 },
+	{ 62 },
+	{ 76 },
+	{ 63 },
+	{ 27 },
+	{ 41 },
+	{ 76 },
+	{ 27 },
+	{ 76 },
+	{ 41 },
+	{ 50 },
+	{ 49 },
+	{ 48 },
+	{ 77 },
+	{ 47 },
+	{ 51 },
+	{ 87 },
+	{ 30 },
+	{ 6 },
+	{ 26 },
+	{ 26 },
+	{ 6 },
+	{ 28 },
+	{ 28 },
+	{ 47 },
+	{ 48 },
+	{ 26 },
+	{ 48 },
+	{ 49 },
+	{ 6 },
+	{ 8 },
+	{ 21 },
+	{ 24 },
+	{ 27 },
+	{ 27 },
+	{ 8 },
+	{ 30 },
+	{ 41 },
+	{ 30 },
+	{ 8 },
+	{ 30 },
+	{ 30 },
+	{ 49 },
+	{ 49 },
+	{ 30 },
+	{ 49 },
+	{ 51 },
+	{ 50 },
+	{ 51 },
+	{ 49 },
+	{ 77 },
+	{ 62 },
+	{ 49 },
+	{ 41 },
+	{ 41 },
+	{ 24 },
+	{ 50 },
+	{ 41 },
+	{ 51 },
+	{ 4 },
+	{ 6 },
+	{ 6 },
+	{ 21 },
+	{ 13 },
+	{ 6 },
+	{ 6 },
+	{ 26 },
+	{ 6 },
+	{ 28 },
+	{ 26 },
+	{ 47 },
+	{ 44 },
+	{ 83 },
+	{ 46 },
+	{ 28 },
+	{ 26 },
+	{ 10 },
+	{ 28 },
+	{ 44 },
+	{ 46 },
+	{ 51 },
+	{ 47 },
+	{ 69 },
+	{ 8 },
+	{ 6 },
+	{ 4 },
+	{ 22 },
+	{ 15 },
+	{ 18 },
+	{ 22 },
+	{ 38 },
+	{ 33 },
+	{ 83 },
+	{ 52 },
+	{ 81 },
+	{ 52 },
+	{ 39 },
+	{ 53 },
+	{ 39 },
+	{ 37 },
+	{ 48 },
+	{ 53 },
+	{ 48 },
+	{ 50 },
+	{ 50 },
+	{ 54 },
+	{ 71 },
+	{ 50 },
+	{ 49 },
+	{ 54 },
+	{ 0 },
+	{ 0 },
+	{ 46 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 53 },
+	{ 54 },
+	{ 46 },
+	{ 46 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 11 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 11 },
+	{ 7 },
+	{ 1 },
+	{ 1 },
+	{ 0 },
+	{ 7 },
+	{ 2 },
+	{ 2 },
+	{ 7 },
+	{ 1 },
+	{ 2 },
+	{ 1 },
+	{ 7 },
+	{ 14 },
+	{ 14 },
+	{ 2 },
+	{ 14 },
+	{ 5 },
+	{ 6 },
+	{ 6 },
+	{ 2 },
+	{ 0 },
+	{ 5 },
+	{ 10 },
+	{ 0 },
+	{ 14 },
+	{ 0 },
+	{ 7 },
+	{ 7 },
+	{ 7 },
+	{ 5 },
+	{ 6 },
+	{ 14 },
+	{ 37 },
+	{ 14 },
+	{ 11 },
+	{ 37 },
+	{ 7 },
+	{ 37 },
+	{ 46 },
+	{ 37 },
+	{ 37 },
+	{ 11 },
+	{ 0 },
+	{ 39 },
+	{ 10 },
+	{ 37 },
+	{ 46 },
+	{ 49 },
+	{ 48 },
+	{ 0 },
+	{ 49 },
+	{ 0 },
+	{ 89 },
+	{ 81 },
+	{ 71 },
+	{ 81 },
+	{ 89 },
+	{ 72 },
+	{ 52 },
+	{ 26 },
+	{ 39 },
+	{ 83 },
+	{ 44 },
+	{ 52 },
+	{ 7 },
+	{ 0 },
+	{ 0 },
+	{ 7 },
+	{ 6 },
+	{ 0 },
+	{ 0 },
+	{ 6 },
+	{ 5 },
+	{ 83 },
+	{ 133 },
+	{ 48 },
+	{ 48 },
+	{ 44 },
+	{ 18 },
+	{ 18 },
+	{ 33 },
+	{ 90 },
+	{ 109 },
+	{ 83 },
+	{ 90 },
+	{ 113 },
+	{ 22 },
+	{ 45 },
+	{ 119 },
+	{ 20 },
+	{ 22 },
+	{ 20 },
+	{ 14 },
+	{ 15 },
+	{ 22 },
+	{ 15 },
+	{ 33 },
+	{ 110 },
+	{ 116 },
+	{ 77 },
+	{ 51 },
+	{ 5 },
+	{ 43 },
+	{ 5 },
+	{ 115 },
+	{ 14 },
+	{ 115 },
+	{ 123 },
+	{ 90 },
+	{ 139 },
+	{ 115 },
+	{ 89 },
+	{ 75 },
+	{ 139 },
+	{ 82 },
+	{ 51 },
+	{ 42 },
+	{ 75 },
+	{ 51 },
+	{ 49 },
+	{ 42 },
+	{ 51 },
+	{ 51 },
+	{ 43 },
+	{ 14 },
+	{ 42 },
+	{ 49 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 75 },
+	{ 42 },
+	{ 139 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 82 },
+	{ 51 },
+	{ 51 },
+	{ 89 },
+	{ 123 },
+	{ 132 },
+	{ 107 },
+	{ 144 },
+	{ 132 },
+	{ 146 },
+	{ 153 },
+	{ 107 },
+	{ 158 },
+	{ 51 },
+	{ 51 },
+	{ 90 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 104 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 76 },
+	{ 104 },
+	{ 159 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 107 },
+	{ 153 },
+	{ 51 },
+	{ 192 },
+	{ 153 },
+	{ 179 },
+	{ 158 },
+	{ 151 },
+	{ 147 },
+	{ 132 },
+	{ 144 },
+	{ 151 },
+	{ 178 },
+	{ 192 },
+	{ 166 },
+	{ 153 },
+	{ 192 },
+	{ 104 },
+	{ 192 },
+	{ 178 },
+	{ 159 },
+	{ 146 },
+	{ 123 },
+	{ 152 },
+	{ 152 },
+	{ 115 },
+	{ 151 },
+	{ 5 },
+	{ 49 },
+	{ 50 },
+	{ 5 },
+	{ 5 },
+	{ 46 },
+	{ 46 },
+	{ 50 },
+	{ 49 },
+	{ 51 },
+	{ 46 },
+	{ 5 },
+	{ 50 },
+	{ 46 },
+	{ 51 },
+	{ 46 },
+	{ 51 },
+	{ 51 },
+	{ 60 },
+	{ 50 },
+	{ 51 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 151 },
+	{ 46 },
+	{ 60 },
+	{ 171 },
+	{ 164 },
+	{ 152 },
+	{ 91 },
+	{ 171 },
+	{ 151 },
+	{ 119 },
+	{ 105 },
+	{ 164 },
+	{ 53 },
+	{ 119 },
+	{ 171 },
+	{ 164 },
+	{ 149 },
+	{ 146 },
+	{ 149 },
+	{ 133 },
+	{ 144 },
+	{ 151 },
+	{ 144 },
+	{ 110 },
+	{ 147 },
+	{ 151 },
+	{ 70 },
+	{ 70 },
+	{ 110 },
+	{ 37 },
+	{ 110 },
+	{ 133 },
+	{ 38 },
+	{ 89 },
+	{ 58 },
+	{ 133 },
+	{ 47 },
+	{ 48 },
+	{ 58 },
+	{ 47 },
+	{ 47 },
+	{ 89 },
+	{ 105 },
+	{ 89 },
+	{ 149 },
+	{ 91 },
+	{ 60 },
+	{ 53 },
+	{ 45 },
+	{ 49 },
+	{ 119 },
+	{ 51 },
+	{ 51 },
+	{ 49 },
+	{ 49 },
+	{ 47 },
+	{ 105 },
+	{ 51 },
+	{ 51 },
+	{ 47 },
+	{ 53 },
+	{ 51 },
+	{ 45 },
+	{ 51 },
+	{ 51 },
+	{ 47 },
+	{ 51 },
+	{ 51 },
+	{ 48 },
+	{ 38 },
+	{ 58 },
+	{ 47 },
+	{ 37 },
+	{ 38 },
+	{ 45 },
+	{ 39 },
+	{ 37 },
+	{ 45 },
+	{ 1 },
+	{ 39 },
+	{ 1 },
+	{ 0 },
+	{ 44 },
+	{ 1 },
+	{ 129 },
+	{ 147 },
+	{ 44 },
+	{ 179 },
+	{ 147 },
+	{ 129 },
+	{ 166 },
+	{ 129 },
+	{ 4 },
+	{ 7 },
+	{ 12 },
+	{ 10 },
+	{ 4 },
+	{ 129 },
+	{ 0 },
+	{ 1 },
+	{ 7 },
+	{ 4 },
+	{ 1 },
+	{ 2 },
+	{ 7 },
+	{ 3 },
+	{ 6 },
+	{ 17 },
+	{ 3 },
+	{ 46 },
+	{ 6 },
+	{ 49 },
+	{ 50 },
+	{ 46 },
+	{ 2 },
+	{ 49 },
+	{ 3 },
+	{ 46 },
+	{ 51 },
+	{ 78 },
+	{ 6 },
+	{ 78 },
+	{ 140 },
+	{ 2 },
+	{ 3 },
+	{ 12 },
+	{ 12 },
+	{ 17 },
+	{ 9 },
+	{ 9 },
+	{ 178 },
+	{ 10 },
+	{ 17 },
+	{ 140 },
+	{ 178 },
+	{ 44 },
+	{ 70 },
+	{ 39 },
+	{ 1 },
+	{ 45 },
+	{ 2 },
+	{ 45 },
+	{ 45 },
+	{ 49 },
+	{ 45 },
+	{ 47 },
+	{ 50 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 47 },
+	{ 48 },
+	{ 51 },
+	{ 159 },
+	{ 140 },
+	{ 76 },
+	{ 19 },
+	{ 31 },
+	{ 47 },
+	{ 47 },
+	{ 43 },
+	{ 31 },
+	{ 43 },
+	{ 46 },
+	{ 37 },
+	{ 45 },
+	{ 37 },
+	{ 44 },
+	{ 54 },
+	{ 59 },
+	{ 49 },
+	{ 49 },
+	{ 47 },
+	{ 42 },
+	{ 31 },
+	{ 26 },
+	{ 41 },
+	{ 84 },
+	{ 29 },
+	{ 85 },
+	{ 7 },
+	{ 6 },
+	{ 41 },
+	{ 28 },
+	{ 31 },
+	{ 38 },
+	{ 30 },
+	{ 31 },
+	{ 32 },
+	{ 29 },
+	{ 33 },
+	{ 36 },
+	{ 37 },
+	{ 40 },
+	{ 42 },
+	{ 47 },
+	{ 37 },
+	{ 33 },
+	{ 1 },
+	{ 1 },
+	{ 2 },
+	{ 2 },
+	{ 0 },
+	{ 2 },
+	{ 45 },
+	{ 46 },
+	{ 47 },
+	{ 37 },
+	{ 47 },
+	{ 47 },
+	{ 40 },
+	{ 45 },
+	{ 50 },
+	{ 47 },
+	{ 37 },
+	{ 42 },
+	{ 43 },
+	{ 33 },
+	{ 37 },
+	{ 26 },
+	{ 42 },
+	{ 27 },
+	{ 27 },
+	{ 37 },
+	{ 47 },
+	{ 41 },
+	{ 26 },
+	{ 49 },
+	{ 49 },
+	{ 27 },
+	{ 55 },
+	{ 49 },
+	{ 48 },
+	{ 47 },
+	{ 55 },
+	{ 53 },
+	{ 48 },
+	{ 48 },
+	{ 60 },
+	{ 43 },
+	{ 53 },
+	{ 60 },
+	{ 60 },
+	{ 60 },
+	{ 45 },
+	{ 46 },
+	{ 60 },
+	{ 36 },
+	{ 45 },
+	{ 44 },
+	{ 46 },
+	{ 46 },
+	{ 46 },
+	{ 45 },
+	{ 48 },
+	{ 46 },
+	{ 51 },
+	{ 51 },
+	{ 48 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 47 },
+	{ 46 },
+	{ 51 },
+	{ 43 },
+	{ 47 },
+	{ 48 },
+	{ 45 },
+	{ 44 },
+	{ 50 },
+	{ 50 },
+	{ 47 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 121 },
+	{ 53 },
+	{ 45 },
+	{ 75 },
+	{ 113 },
+	{ 76 },
+	{ 76 },
+	{ 119 },
+	{ 85 },
+	{ 40 },
+	{ 45 },
+	{ 53 },
+	{ 49 },
+	{ 75 },
+	{ 51 },
+	{ 51 },
+	{ 76 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 49 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 46 },
+	{ 50 },
+	{ 48 },
+	{ 49 },
+	{ 51 },
+	{ 50 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 85 },
+	{ 99 },
+	{ 51 },
+	{ 51 },
+	{ 56 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 0 },
+	{ 1 },
+	{ 49 },
+	{ 49 },
+	{ 1 },
+	{ 50 },
+	{ 49 },
+	{ 48 },
+	{ 50 },
+	{ 39 },
+	{ 50 },
+	{ 50 },
+	{ 50 },
+	{ 33 },
+	{ 39 },
+	{ 2 },
+	{ 39 },
+	{ 32 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 52 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 45 },
+	{ 0 },
+	{ 49 },
+	{ 51 },
+	{ 0 },
+	{ 0 },
+	{ 97 },
+	{ 51 },
+	{ 49 },
+	{ 51 },
+	{ 40 },
+	{ 43 },
+	{ 0 },
+	{ 30 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 32 },
+	{ 0 },
+	{ 0 },
+	{ 68 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 14 },
+	{ 16 },
+	{ 33 },
+	{ 16 },
+	{ 22 },
+	{ 46 },
+	{ 45 },
+	{ 43 },
+	{ 72 },
+	{ 35 },
+	{ 33 },
+	{ 63 },
+	{ 40 },
+	{ 35 },
+	{ 41 },
+	{ 45 },
+	{ 40 },
+	{ 51 },
+	{ 60 },
+	{ 45 },
+	{ 32 },
+	{ 33 },
+	{ 54 },
+	{ 40 },
+	{ 79 },
+	{ 54 },
+	{ 79 },
+	{ 40 },
+	{ 105 },
+	{ 105 },
+	{ 45 },
+	{ 148 },
+	{ 54 },
+	{ 54 },
+	{ 0 },
+	{ 79 },
+	{ 143 },
+	{ 54 },
+	{ 105 },
+	{ 164 },
+	{ 143 },
+	{ 148 },
+	{ 180 },
+	{ 164 },
+	{ 54 },
+	{ 103 },
+	{ 52 },
+	{ 143 },
+	{ 116 },
+	{ 103 },
+	{ 116 },
+	{ 143 },
+	{ 124 },
+	{ 124 },
+	{ 164 },
+	{ 142 },
+	{ 103 },
+	{ 50 },
+	{ 45 },
+	{ 116 },
+	{ 50 },
+	{ 50 },
+	{ 124 },
+	{ 51 },
+	{ 50 },
+	{ 142 },
+	{ 81 },
+	{ 51 },
+	{ 49 },
+	{ 45 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 52 },
+	{ 51 },
+	{ 50 },
+	{ 48 },
+	{ 50 },
+	{ 51 },
+	{ 50 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 48 },
+	{ 72 },
+	{ 50 },
+	{ 63 },
+	{ 72 },
+	{ 51 },
+	{ 41 },
+	{ 63 },
+	{ 51 },
+	{ 51 },
+	{ 41 },
+	{ 142 },
+	{ 127 },
+	{ 52 },
+	{ 51 },
+	{ 52 },
+	{ 51 },
+	{ 180 },
+	{ 148 },
+	{ 127 },
+	{ 51 },
+	{ 127 },
+	{ 60 },
+	{ 28 },
+	{ 2 },
+	{ 29 },
+	{ 1 },
+	{ 1 },
+	{ 0 },
+	{ 2 },
+	{ 2 },
+	{ 6 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 38 },
+	{ 30 },
+	{ 33 },
+	{ 29 },
+	{ 33 },
+	{ 31 },
+	{ 20 },
+	{ 19 },
+	{ 22 },
+	{ 28 },
+	{ 52 },
+	{ 45 },
+	{ 36 },
+	{ 56 },
+	{ 62 },
+	{ 109 },
+	{ 68 },
+	{ 130 },
+	{ 152 },
+	{ 137 },
+	{ 126 },
+	{ 109 },
+	{ 50 },
+	{ 68 },
+	{ 137 },
+	{ 51 },
+	{ 51 },
+	{ 41 },
+	{ 40 },
+	{ 49 },
+	{ 41 },
+	{ 49 },
+	{ 41 },
+	{ 41 },
+	{ 27 },
+	{ 27 },
+	{ 20 },
+	{ 18 },
+	{ 22 },
+	{ 25 },
+	{ 27 },
+	{ 24 },
+	{ 36 },
+	{ 30 },
+	{ 63 },
+	{ 63 },
+	{ 30 },
+	{ 55 },
+	{ 55 },
+	{ 28 },
+	{ 63 },
+	{ 63 },
+	{ 28 },
+	{ 68 },
+	{ 152 },
+	{ 164 },
+	{ 140 },
+	{ 140 },
+	{ 164 },
+	{ 142 },
+	{ 142 },
+	{ 169 },
+	{ 138 },
+	{ 138 },
+	{ 175 },
+	{ 53 },
+	{ 51 },
+	{ 51 },
+	{ 140 },
+	{ 142 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 142 },
+	{ 51 },
+	{ 51 },
+	{ 138 },
+	{ 51 },
+	{ 49 },
+	{ 49 },
+	{ 42 },
+	{ 42 },
+	{ 49 },
+	{ 44 },
+	{ 44 },
+	{ 49 },
+	{ 46 },
+	{ 46 },
+	{ 49 },
+	{ 50 },
+	{ 41 },
+	{ 42 },
+	{ 31 },
+	{ 31 },
+	{ 42 },
+	{ 33 },
+	{ 33 },
+	{ 44 },
+	{ 37 },
+	{ 37 },
+	{ 46 },
+	{ 46 },
+	{ 24 },
+	{ 27 },
+	{ 28 },
+	{ 28 },
+	{ 31 },
+	{ 31 },
+	{ 31 },
+	{ 33 },
+	{ 39 },
+	{ 39 },
+	{ 37 },
+	{ 45 },
+	{ 45 },
+	{ 45 },
+	{ 46 },
+	{ 51 },
+	{ 51 },
+	{ 48 },
+	{ 48 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 49 },
+	{ 50 },
+	{ 42 },
+	{ 43 },
+	{ 50 },
+	{ 49 },
+	{ 45 },
+	{ 42 },
+	{ 52 },
+	{ 33 },
+	{ 42 },
+	{ 39 },
+	{ 49 },
+	{ 70 },
+	{ 33 },
+	{ 52 },
+	{ 67 },
+	{ 86 },
+	{ 70 },
+	{ 80 },
+	{ 57 },
+	{ 55 },
+	{ 67 },
+	{ 57 },
+	{ 67 },
+	{ 58 },
+	{ 58 },
+	{ 53 },
+	{ 57 },
+	{ 58 },
+	{ 74 },
+	{ 58 },
+	{ 62 },
+	{ 60 },
+	{ 58 },
+	{ 74 },
+	{ 72 },
+	{ 62 },
+	{ 37 },
+	{ 36 },
+	{ 62 },
+	{ 72 },
+	{ 39 },
+	{ 37 },
+	{ 37 },
+	{ 48 },
+	{ 48 },
+	{ 39 },
+	{ 48 },
+	{ 48 },
+	{ 74 },
+	{ 58 },
+	{ 52 },
+	{ 58 },
+	{ 46 },
+	{ 54 },
+	{ 46 },
+	{ 53 },
+	{ 64 },
+	{ 64 },
+	{ 53 },
+	{ 73 },
+	{ 73 },
+	{ 56 },
+	{ 50 },
+	{ 58 },
+	{ 52 },
+	{ 81 },
+	{ 52 },
+	{ 54 },
+	{ 94 },
+	{ 54 },
+	{ 64 },
+	{ 105 },
+	{ 105 },
+	{ 64 },
+	{ 114 },
+	{ 114 },
+	{ 73 },
+	{ 74 },
+	{ 88 },
+	{ 72 },
+	{ 81 },
+	{ 81 },
+	{ 94 },
+	{ 107 },
+	{ 94 },
+	{ 105 },
+	{ 129 },
+	{ 129 },
+	{ 105 },
+	{ 140 },
+	{ 140 },
+	{ 114 },
+	{ 96 },
+	{ 77 },
+	{ 39 },
+	{ 88 },
+	{ 102 },
+	{ 77 },
+	{ 107 },
+	{ 120 },
+	{ 102 },
+	{ 129 },
+	{ 120 },
+	{ 129 },
+	{ 116 },
+	{ 116 },
+	{ 140 },
+	{ 48 },
+	{ 39 },
+	{ 77 },
+	{ 49 },
+	{ 77 },
+	{ 102 },
+	{ 49 },
+	{ 102 },
+	{ 120 },
+	{ 53 },
+	{ 53 },
+	{ 120 },
+	{ 50 },
+	{ 50 },
+	{ 116 },
+	{ 51 },
+	{ 48 },
+	{ 49 },
+	{ 51 },
+	{ 49 },
+	{ 49 },
+	{ 51 },
+	{ 49 },
+	{ 53 },
+	{ 50 },
+	{ 50 },
+	{ 53 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 48 },
+	{ 51 },
+	{ 51 },
+	{ 49 },
+	{ 51 },
+	{ 50 },
+	{ 50 },
+	{ 50 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 49 },
+	{ 48 },
+	{ 42 },
+	{ 48 },
+	{ 49 },
+	{ 41 },
+	{ 49 },
+	{ 50 },
+	{ 46 },
+	{ 46 },
+	{ 50 },
+	{ 48 },
+	{ 48 },
+	{ 51 },
+	{ 51 },
+	{ 39 },
+	{ 39 },
+	{ 37 },
+	{ 36 },
+	{ 37 },
+	{ 41 },
+	{ 43 },
+	{ 36 },
+	{ 46 },
+	{ 48 },
+	{ 45 },
+	{ 43 },
+	{ 45 },
+	{ 48 },
+	{ 50 },
+	{ 80 },
+	{ 49 },
+	{ 48 },
+	{ 36 },
+	{ 46 },
+	{ 58 },
+	{ 43 },
+	{ 53 },
+	{ 46 },
+	{ 45 },
+	{ 56 },
+	{ 53 },
+	{ 56 },
+	{ 45 },
+	{ 47 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 47 },
+	{ 50 },
+	{ 48 },
+	{ 96 },
+	{ 74 },
+	{ 51 },
+	{ 74 },
+	{ 50 },
+	{ 23 },
+	{ 24 },
+	{ 22 },
+	{ 33 },
+	{ 29 },
+	{ 25 },
+	{ 88 },
+	{ 1 },
+	{ 1 },
+	{ 88 },
+	{ 110 },
+	{ 85 },
+	{ 100 },
+	{ 96 },
+	{ 124 },
+	{ 26 },
+	{ 23 },
+	{ 22 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 35 },
+	{ 14 },
+	{ 29 },
+	{ 32 },
+	{ 0 },
+	{ 36 },
+	{ 36 },
+	{ 39 },
+	{ 51 },
+	{ 49 },
+	{ 49 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 29 },
+	{ 17 },
+	{ 38 },
+	{ 17 },
+	{ 4 },
+	{ 33 },
+	{ 5 },
+	{ 10 },
+	{ 2 },
+	{ 47 },
+	{ 58 },
+	{ 64 },
+	{ 41 },
+	{ 49 },
+	{ 41 },
+	{ 46 },
+	{ 42 },
+	{ 41 },
+	{ 51 },
+	{ 46 },
+	{ 49 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 44 },
+	{ 51 },
+	{ 50 },
+	{ 41 },
+	{ 44 },
+	{ 46 },
+	{ 26 },
+	{ 26 },
+	{ 37 },
+	{ 44 },
+	{ 71 },
+	{ 45 },
+	{ 71 },
+	{ 131 },
+	{ 69 },
+	{ 49 },
+	{ 46 },
+	{ 44 },
+	{ 22 },
+	{ 8 },
+	{ 9 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 107 },
+	{ 72 },
+	{ 45 },
+	{ 44 },
+	{ 45 },
+	{ 45 },
+	{ 37 },
+	{ 8 },
+	{ 33 },
+	{ 42 },
+	{ 2 },
+	{ 37 },
+	{ 48 },
+	{ 36 },
+	{ 42 },
+	{ 47 },
+	{ 46 },
+	{ 48 },
+	{ 0 },
+	{ 8 },
+	{ 2 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 48 },
+	{ 42 },
+	{ 51 },
+	{ 0 },
+	{ 0 },
+	{ 83 },
+	{ 0 },
+	{ 0 },
+	{ 33 },
+	{ 16 },
+	{ 48 },
+	{ 37 },
+	{ 35 },
+	{ 80 },
+	{ 62 },
+	{ 62 },
+	{ 48 },
+	{ 16 },
+	{ 48 },
+	{ 62 },
+	{ 110 },
+	{ 48 },
+	{ 46 },
+	{ 6 },
+	{ 17 },
+	{ 0 },
+	{ 2 },
+	{ 1 },
+	{ 7 },
+	{ 2 },
+	{ 51 },
+	{ 1 },
+	{ 49 },
+	{ 49 },
+	{ 49 },
+	{ 50 },
+	{ 39 },
+	{ 7 },
+	{ 39 },
+	{ 96 },
+	{ 72 },
+	{ 107 },
+	{ 49 },
+	{ 53 },
+	{ 71 },
+	{ 131 },
+	{ 71 },
+	{ 53 },
+	{ 41 },
+	{ 38 },
+	{ 38 },
+	{ 31 },
+	{ 37 },
+	{ 38 },
+	{ 31 },
+	{ 28 },
+	{ 19 },
+	{ 31 },
+	{ 30 },
+	{ 26 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 48 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 46 },
+	{ 50 },
+	{ 48 },
+	{ 71 },
+	{ 66 },
+	{ 98 },
+	{ 52 },
+	{ 61 },
+	{ 35 },
+	{ 47 },
+	{ 52 },
+	{ 30 },
+	{ 29 },
+	{ 32 },
+	{ 32 },
+	{ 31 },
+	{ 33 },
+	{ 22 },
+	{ 25 },
+	{ 19 },
+	{ 25 },
+	{ 29 },
+	{ 31 },
+	{ 37 },
+	{ 26 },
+	{ 29 },
+	{ 40 },
+	{ 37 },
+	{ 36 },
+	{ 38 },
+	{ 33 },
+	{ 37 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 39 },
+	{ 37 },
+	{ 33 },
+	{ 38 },
+	{ 37 },
+	{ 38 },
+	{ 49 },
+	{ 41 },
+	{ 37 },
+	{ 51 },
+	{ 49 },
+	{ 47 },
+	{ 46 },
+	{ 51 },
+	{ 49 },
+	{ 41 },
+	{ 6 },
+	{ 29 },
+	{ 6 },
+	{ 2 },
+	{ 17 },
+	{ 0 },
+	{ 1 },
+	{ 2 },
+	{ 36 },
+	{ 22 },
+	{ 19 },
+	{ 34 },
+	{ 21 },
+	{ 17 },
+	{ 130 },
+	{ 108 },
+	{ 52 },
+	{ 62 },
+	{ 56 },
+	{ 142 },
+	{ 56 },
+	{ 63 },
+	{ 164 },
+	{ 169 },
+	{ 164 },
+	{ 63 },
+	{ 175 },
+	{ 169 },
+	{ 55 },
+	{ 100 },
+	{ 175 },
+	{ 63 },
+	{ 100 },
+	{ 68 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 48 },
+	{ 42 },
+	{ 48 },
+	{ 47 },
+	{ 48 },
+	{ 42 },
+	{ 43 },
+	{ 47 },
+	{ 37 },
+	{ 44 },
+	{ 43 },
+	{ 33 },
+	{ 47 },
+	{ 44 },
+	{ 22 },
+	{ 49 },
+	{ 46 },
+	{ 51 },
+	{ 46 },
+	{ 49 },
+	{ 7 },
+	{ 2 },
+	{ 6 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 45 },
+	{ 43 },
+	{ 50 },
+	{ 46 },
+	{ 68 },
+	{ 49 },
+	{ 35 },
+	{ 38 },
+	{ 47 },
+	{ 16 },
+	{ 18 },
+	{ 38 },
+	{ 42 },
+	{ 45 },
+	{ 51 },
+	{ 51 },
+	{ 18 },
+	{ 19 },
+	{ 49 },
+	{ 49 },
+	{ 50 },
+	{ 18 },
+	{ 32 },
+	{ 34 },
+	{ 75 },
+	{ 49 },
+	{ 45 },
+	{ 45 },
+	{ 49 },
+	{ 22 },
+	{ 46 },
+	{ 44 },
+	{ 45 },
+	{ 38 },
+	{ 33 },
+	{ 45 },
+	{ 43 },
+	{ 46 },
+	{ 33 },
+	{ 16 },
+	{ 37 },
+	{ 10 },
+	{ 22 },
+	{ 28 },
+	{ 26 },
+	{ 33 },
+	{ 0 },
+	{ 42 },
+	{ 54 },
+	{ 42 },
+	{ 1 },
+	{ 88 },
+	{ 85 },
+	{ 54 },
+	{ 85 },
+	{ 29 },
+	{ 59 },
+	{ 29 },
+	{ 2 },
+	{ 7 },
+	{ 1 },
+	{ 1 },
+	{ 2 },
+	{ 8 },
+	{ 2 },
+	{ 1 },
+	{ 16 },
+	{ 8 },
+	{ 2 },
+	{ 8 },
+	{ 16 },
+	{ 2 },
+	{ 109 },
+	{ 126 },
+	{ 51 },
+	{ 142 },
+	{ 126 },
+	{ 109 },
+	{ 62 },
+	{ 142 },
+	{ 130 },
+	{ 52 },
+	{ 28 },
+	{ 62 },
+	{ 27 },
+	{ 25 },
+	{ 25 },
+	{ 41 },
+	{ 27 },
+	{ 24 },
+	{ 36 },
+	{ 49 },
+	{ 27 },
+	{ 48 },
+	{ 51 },
+	{ 49 },
+	{ 0 },
+	{ 27 },
+	{ 1 },
+	{ 15 },
+	{ 12 },
+	{ 20 },
+	{ 66 },
+	{ 50 },
+	{ 48 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 49 },
+	{ 51 },
+	{ 50 },
+	{ 16 },
+	{ 32 },
+	{ 17 },
+	{ 48 },
+	{ 51 },
+	{ 49 },
+	{ 46 },
+	{ 49 },
+	{ 48 },
+	{ 2 },
+	{ 36 },
+	{ 0 },
+	{ 1 },
+	{ 2 },
+	{ 2 },
+	{ 26 },
+	{ 16 },
+	{ 5 },
+	{ 61 },
+	{ 49 },
+	{ 50 },
+	{ 85 },
+	{ 98 },
+	{ 66 },
+	{ 45 },
+	{ 40 },
+	{ 32 },
+	{ 18 },
+	{ 12 },
+	{ 32 },
+	{ 27 },
+	{ 41 },
+	{ 2 },
+	{ 22 },
+	{ 24 },
+	{ 25 },
+	{ 34 },
+	{ 40 },
+	{ 24 },
+	{ 25 },
+	{ 21 },
+	{ 20 },
+	{ 44 },
+	{ 43 },
+	{ 26 },
+	{ 49 },
+	{ 61 },
+	{ 47 },
+	{ 45 },
+	{ 42 },
+	{ 48 },
+	{ 75 },
+	{ 46 },
+	{ 42 },
+	{ 68 },
+	{ 46 },
+	{ 108 },
+	{ 51 },
+	{ 49 },
+	{ 42 },
+	{ 35 },
+	{ 17 },
+	{ 16 },
+	{ 26 },
+	{ 44 },
+	{ 37 },
+	{ 21 },
+	{ 18 },
+	{ 17 },
+	{ 19 },
+	{ 16 },
+	{ 16 },
+	{ 18 },
+	{ 16 },
+	{ 17 },
+	{ 22 },
+	{ 19 },
+	{ 17 },
+	{ 28 },
+	{ 22 },
+	{ 21 },
+	{ 35 },
+	{ 28 },
+	{ 25 },
+	{ 36 },
+	{ 35 },
+	{ 25 },
+	{ 30 },
+	{ 36 },
+	{ 24 },
+	{ 28 },
+	{ 30 },
+	{ 28 },
+	{ 28 },
+	{ 28 },
+	{ 31 },
+	{ 45 },
+	{ 28 },
+	{ 39 },
+	{ 68 },
+	{ 45 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 49 },
+	{ 51 },
+	{ 51 },
+	{ 49 },
+	{ 51 },
+	{ 49 },
+	{ 49 },
+	{ 51 },
+	{ 49 },
+	{ 51 },
+	{ 51 },
+	{ 49 },
+	{ 49 },
+	{ 51 },
+	{ 49 },
+	{ 49 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 50 },
+	{ 50 },
+	{ 49 },
+	{ 51 },
+	{ 40 },
+	{ 43 },
+	{ 37 },
+	{ 32 },
+	{ 46 },
+	{ 14 },
+	{ 46 },
+	{ 49 },
+	{ 49 },
+	{ 19 },
+	{ 16 },
+	{ 18 },
+	{ 41 },
+	{ 49 },
+	{ 44 },
+	{ 49 },
+	{ 49 },
+	{ 27 },
+	{ 48 },
+	{ 49 },
+	{ 48 },
+	{ 37 },
+	{ 70 },
+	{ 52 },
+	{ 42 },
+	{ 45 },
+	{ 37 },
+	{ 67 },
+	{ 52 },
+	{ 86 },
+	{ 74 },
+	{ 67 },
+	{ 80 },
+	{ 37 },
+	{ 39 },
+	{ 42 },
+	{ 39 },
+	{ 39 },
+	{ 45 },
+	{ 58 },
+	{ 74 },
+	{ 48 },
+	{ 37 },
+	{ 58 },
+	{ 37 },
+	{ 20 },
+	{ 22 },
+	{ 33 },
+	{ 38 },
+	{ 41 },
+	{ 35 },
+	{ 44 },
+	{ 41 },
+	{ 43 },
+	{ 37 },
+	{ 43 },
+	{ 20 },
+	{ 10 },
+	{ 20 },
+	{ 4 },
+	{ 2 },
+	{ 0 },
+	{ 4 },
+	{ 2 },
+	{ 0 },
+	{ 2 },
+	{ 2 },
+	{ 1 },
+	{ 2 },
+	{ 0 },
+	{ 1 },
+	{ 2 },
+	{ 38 },
+	{ 41 },
+	{ 40 },
+	{ 39 },
+	{ 36 },
+	{ 39 },
+	{ 46 },
+	{ 38 },
+	{ 50 },
+	{ 41 },
+	{ 29 },
+	{ 46 },
+	{ 12 },
+	{ 15 },
+	{ 17 },
+	{ 32 },
+	{ 28 },
+	{ 45 },
+	{ 15 },
+	{ 20 },
+	{ 21 },
+	{ 12 },
+	{ 14 },
+	{ 28 },
+	{ 38 },
+	{ 40 },
+	{ 39 },
+	{ 33 },
+	{ 38 },
+	{ 39 },
+	{ 33 },
+	{ 29 },
+	{ 38 },
+	{ 33 },
+	{ 36 },
+	{ 29 },
+	{ 33 },
+	{ 33 },
+	{ 29 },
+	{ 37 },
+	{ 44 },
+	{ 46 },
+	{ 16 },
+	{ 19 },
+	{ 32 },
+	{ 18 },
+	{ 40 },
+	{ 37 },
+	{ 44 },
+	{ 40 },
+	{ 35 },
+	{ 38 },
+	{ 35 },
+	{ 18 },
+	{ 18 },
+	{ 20 },
+	{ 30 },
+	{ 20 },
+	{ 18 },
+	{ 21 },
+	{ 35 },
+	{ 19 },
+	{ 21 },
+	{ 52 },
+	{ 56 },
+	{ 34 },
+	{ 56 },
+	{ 52 },
+	{ 98 },
+	{ 100 },
+	{ 99 },
+	{ 85 },
+	{ 100 },
+	{ 110 },
+	{ 89 },
+	{ 20 },
+	{ 20 },
+	{ 29 },
+	{ 20 },
+	{ 20 },
+	{ 19 },
+	{ 37 },
+	{ 19 },
+	{ 19 },
+	{ 37 },
+	{ 35 },
+	{ 56 },
+	{ 99 },
+	{ 58 },
+	{ 56 },
+	{ 58 },
+	{ 99 },
+	{ 89 },
+	{ 40 },
+	{ 44 },
+	{ 43 },
+	{ 26 },
+	{ 19 },
+	{ 24 },
+	{ 19 },
+	{ 26 },
+	{ 25 },
+	{ 25 },
+	{ 30 },
+	{ 53 },
+	{ 148 },
+	{ 136 },
+	{ 53 },
+	{ 150 },
+	{ 161 },
+	{ 170 },
+	{ 161 },
+	{ 150 },
+	{ 101 },
+	{ 21 },
+	{ 24 },
+	{ 29 },
+	{ 84 },
+	{ 106 },
+	{ 119 },
+	{ 149 },
+	{ 158 },
+	{ 164 },
+	{ 30 },
+	{ 36 },
+	{ 30 },
+	{ 30 },
+	{ 31 },
+	{ 31 },
+	{ 36 },
+	{ 33 },
+	{ 35 },
+	{ 37 },
+	{ 39 },
+	{ 41 },
+	{ 101 },
+	{ 97 },
+	{ 37 },
+	{ 51 },
+	{ 31 },
+	{ 0 },
+	{ 31 },
+	{ 0 },
+	{ 0 },
+	{ 37 },
+	{ 36 },
+	{ 47 },
+	{ 65 },
+	{ 130 },
+	{ 125 },
+	{ 47 },
+	{ 48 },
+	{ 35 },
+	{ 45 },
+	{ 47 },
+	{ 33 },
+	{ 29 },
+	{ 28 },
+	{ 35 },
+	{ 28 },
+	{ 23 },
+	{ 33 },
+	{ 24 },
+	{ 22 },
+	{ 28 },
+	{ 22 },
+	{ 25 },
+	{ 23 },
+	{ 22 },
+	{ 24 },
+	{ 23 },
+	{ 25 },
+	{ 22 },
+	{ 26 },
+	{ 23 },
+	{ 19 },
+	{ 26 },
+	{ 26 },
+	{ 23 },
+	{ 30 },
+	{ 26 },
+	{ 25 },
+	{ 56 },
+	{ 30 },
+	{ 26 },
+	{ 60 },
+	{ 136 },
+	{ 133 },
+	{ 56 },
+	{ 133 },
+	{ 119 },
+	{ 60 },
+	{ 133 },
+	{ 136 },
+	{ 138 },
+	{ 119 },
+	{ 133 },
+	{ 124 },
+	{ 138 },
+	{ 155 },
+	{ 100 },
+	{ 124 },
+	{ 138 },
+	{ 93 },
+	{ 100 },
+	{ 117 },
+	{ 47 },
+	{ 93 },
+	{ 100 },
+	{ 45 },
+	{ 45 },
+	{ 47 },
+	{ 48 },
+	{ 49 },
+	{ 48 },
+	{ 50 },
+	{ 51 },
+	{ 49 },
+	{ 51 },
+	{ 121 },
+	{ 112 },
+	{ 148 },
+	{ 136 },
+	{ 153 },
+	{ 119 },
+	{ 153 },
+	{ 171 },
+	{ 152 },
+	{ 109 },
+	{ 128 },
+	{ 134 },
+	{ 162 },
+	{ 155 },
+	{ 153 },
+	{ 155 },
+	{ 133 },
+	{ 171 },
+	{ 124 },
+	{ 103 },
+	{ 129 },
+	{ 122 },
+	{ 117 },
+	{ 155 },
+	{ 117 },
+	{ 101 },
+	{ 133 },
+	{ 48 },
+	{ 48 },
+	{ 94 },
+	{ 48 },
+	{ 49 },
+	{ 93 },
+	{ 49 },
+	{ 51 },
+	{ 72 },
+	{ 133 },
+	{ 99 },
+	{ 152 },
+	{ 101 },
+	{ 56 },
+	{ 99 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 47 },
+	{ 42 },
+	{ 49 },
+	{ 58 },
+	{ 76 },
+	{ 48 },
+	{ 49 },
+	{ 48 },
+	{ 132 },
+	{ 157 },
+	{ 136 },
+	{ 132 },
+	{ 136 },
+	{ 157 },
+	{ 129 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 38 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 42 },
+	{ 47 },
+	{ 38 },
+	{ 134 },
+	{ 163 },
+	{ 108 },
+	{ 129 },
+	{ 133 },
+	{ 0 },
+	{ 163 },
+	{ 134 },
+	{ 128 },
+	{ 108 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 122 },
+	{ 43 },
+	{ 94 },
+	{ 92 },
+	{ 80 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 81 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 6 },
+	{ 43 },
+	{ 60 },
+	{ 71 },
+	{ 44 },
+	{ 42 },
+	{ 61 },
+	{ 46 },
+	{ 75 },
+	{ 114 },
+	{ 136 },
+	{ 126 },
+	{ 116 },
+	{ 114 },
+	{ 118 },
+	{ 118 },
+	{ 116 },
+	{ 128 },
+	{ 184 },
+	{ 118 },
+	{ 171 },
+	{ 125 },
+	{ 147 },
+	{ 126 },
+	{ 118 },
+	{ 126 },
+	{ 137 },
+	{ 137 },
+	{ 144 },
+	{ 128 },
+	{ 144 },
+	{ 170 },
+	{ 171 },
+	{ 0 },
+	{ 46 },
+	{ 147 },
+	{ 137 },
+	{ 147 },
+	{ 53 },
+	{ 144 },
+	{ 137 },
+	{ 68 },
+	{ 170 },
+	{ 144 },
+	{ 84 },
+	{ 46 },
+	{ 0 },
+	{ 38 },
+	{ 53 },
+	{ 46 },
+	{ 41 },
+	{ 41 },
+	{ 46 },
+	{ 68 },
+	{ 46 },
+	{ 50 },
+	{ 84 },
+	{ 38 },
+	{ 38 },
+	{ 51 },
+	{ 41 },
+	{ 38 },
+	{ 51 },
+	{ 46 },
+	{ 41 },
+	{ 51 },
+	{ 50 },
+	{ 46 },
+	{ 51 },
+	{ 49 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 62 },
+	{ 51 },
+	{ 62 },
+	{ 101 },
+	{ 51 },
+	{ 51 },
+	{ 49 },
+	{ 168 },
+	{ 168 },
+	{ 179 },
+	{ 51 },
+	{ 179 },
+	{ 182 },
+	{ 62 },
+	{ 182 },
+	{ 170 },
+	{ 101 },
+	{ 136 },
+	{ 114 },
+	{ 168 },
+	{ 114 },
+	{ 116 },
+	{ 179 },
+	{ 182 },
+	{ 179 },
+	{ 118 },
+	{ 170 },
+	{ 182 },
+	{ 184 },
+	{ 50 },
+	{ 51 },
+	{ 166 },
+	{ 170 },
+	{ 184 },
+	{ 166 },
+	{ 84 },
+	{ 50 },
+	{ 170 },
+	{ 184 },
+	{ 171 },
+	{ 170 },
+	{ 28 },
+	{ 84 },
+	{ 111 },
+	{ 51 },
+	{ 1 },
+	{ 88 },
+	{ 140 },
+	{ 149 },
+	{ 153 },
+	{ 127 },
+	{ 143 },
+	{ 139 },
+	{ 36 },
+	{ 38 },
+	{ 33 },
+	{ 31 },
+	{ 33 },
+	{ 33 },
+	{ 19 },
+	{ 22 },
+	{ 22 },
+	{ 14 },
+	{ 12 },
+	{ 18 },
+	{ 14 },
+	{ 14 },
+	{ 18 },
+	{ 129 },
+	{ 49 },
+	{ 39 },
+	{ 59 },
+	{ 56 },
+	{ 162 },
+	{ 129 },
+	{ 99 },
+	{ 123 },
+	{ 162 },
+	{ 150 },
+	{ 187 },
+	{ 50 },
+	{ 121 },
+	{ 130 },
+	{ 50 },
+	{ 50 },
+	{ 124 },
+	{ 50 },
+	{ 50 },
+	{ 28 },
+	{ 15 },
+	{ 19 },
+	{ 24 },
+	{ 19 },
+	{ 22 },
+	{ 28 },
+	{ 14 },
+	{ 18 },
+	{ 12 },
+	{ 19 },
+	{ 16 },
+	{ 12 },
+	{ 16 },
+	{ 20 },
+	{ 10 },
+	{ 20 },
+	{ 45 },
+	{ 42 },
+	{ 59 },
+	{ 162 },
+	{ 77 },
+	{ 175 },
+	{ 184 },
+	{ 85 },
+	{ 184 },
+	{ 181 },
+	{ 83 },
+	{ 181 },
+	{ 96 },
+	{ 51 },
+	{ 192 },
+	{ 175 },
+	{ 162 },
+	{ 184 },
+	{ 175 },
+	{ 194 },
+	{ 194 },
+	{ 186 },
+	{ 181 },
+	{ 186 },
+	{ 99 },
+	{ 96 },
+	{ 124 },
+	{ 50 },
+	{ 118 },
+	{ 42 },
+	{ 41 },
+	{ 108 },
+	{ 41 },
+	{ 45 },
+	{ 88 },
+	{ 45 },
+	{ 49 },
+	{ 50 },
+	{ 50 },
+	{ 28 },
+	{ 42 },
+	{ 30 },
+	{ 33 },
+	{ 41 },
+	{ 33 },
+	{ 37 },
+	{ 45 },
+	{ 37 },
+	{ 47 },
+	{ 49 },
+	{ 22 },
+	{ 21 },
+	{ 30 },
+	{ 21 },
+	{ 22 },
+	{ 33 },
+	{ 22 },
+	{ 29 },
+	{ 37 },
+	{ 29 },
+	{ 45 },
+	{ 47 },
+	{ 42 },
+	{ 51 },
+	{ 45 },
+	{ 116 },
+	{ 106 },
+	{ 119 },
+	{ 127 },
+	{ 106 },
+	{ 129 },
+	{ 98 },
+	{ 116 },
+	{ 124 },
+	{ 129 },
+	{ 116 },
+	{ 105 },
+	{ 68 },
+	{ 98 },
+	{ 93 },
+	{ 105 },
+	{ 98 },
+	{ 87 },
+	{ 33 },
+	{ 68 },
+	{ 45 },
+	{ 65 },
+	{ 96 },
+	{ 36 },
+	{ 33 },
+	{ 23 },
+	{ 33 },
+	{ 28 },
+	{ 28 },
+	{ 36 },
+	{ 20 },
+	{ 19 },
+	{ 23 },
+	{ 20 },
+	{ 18 },
+	{ 23 },
+	{ 22 },
+	{ 20 },
+	{ 25 },
+	{ 18 },
+	{ 20 },
+	{ 22 },
+	{ 32 },
+	{ 22 },
+	{ 26 },
+	{ 22 },
+	{ 22 },
+	{ 33 },
+	{ 52 },
+	{ 32 },
+	{ 30 },
+	{ 33 },
+	{ 32 },
+	{ 77 },
+	{ 52 },
+	{ 60 },
+	{ 106 },
+	{ 77 },
+	{ 52 },
+	{ 127 },
+	{ 23 },
+	{ 18 },
+	{ 24 },
+	{ 24 },
+	{ 16 },
+	{ 22 },
+	{ 22 },
+	{ 18 },
+	{ 26 },
+	{ 22 },
+	{ 27 },
+	{ 34 },
+	{ 27 },
+	{ 46 },
+	{ 49 },
+	{ 18 },
+	{ 22 },
+	{ 16 },
+	{ 16 },
+	{ 25 },
+	{ 18 },
+	{ 18 },
+	{ 29 },
+	{ 22 },
+	{ 30 },
+	{ 35 },
+	{ 27 },
+	{ 35 },
+	{ 47 },
+	{ 46 },
+	{ 61 },
+	{ 25 },
+	{ 22 },
+	{ 25 },
+	{ 61 },
+	{ 29 },
+	{ 29 },
+	{ 75 },
+	{ 30 },
+	{ 76 },
+	{ 78 },
+	{ 35 },
+	{ 78 },
+	{ 45 },
+	{ 47 },
+	{ 33 },
+	{ 77 },
+	{ 61 },
+	{ 133 },
+	{ 75 },
+	{ 61 },
+	{ 147 },
+	{ 76 },
+	{ 75 },
+	{ 147 },
+	{ 149 },
+	{ 78 },
+	{ 149 },
+	{ 81 },
+	{ 45 },
+	{ 77 },
+	{ 127 },
+	{ 123 },
+	{ 123 },
+	{ 165 },
+	{ 133 },
+	{ 133 },
+	{ 181 },
+	{ 147 },
+	{ 186 },
+	{ 186 },
+	{ 149 },
+	{ 186 },
+	{ 106 },
+	{ 81 },
+	{ 127 },
+	{ 129 },
+	{ 165 },
+	{ 165 },
+	{ 141 },
+	{ 181 },
+	{ 181 },
+	{ 149 },
+	{ 186 },
+	{ 155 },
+	{ 146 },
+	{ 186 },
+	{ 146 },
+	{ 54 },
+	{ 106 },
+	{ 129 },
+	{ 105 },
+	{ 141 },
+	{ 141 },
+	{ 95 },
+	{ 149 },
+	{ 149 },
+	{ 94 },
+	{ 155 },
+	{ 99 },
+	{ 91 },
+	{ 146 },
+	{ 91 },
+	{ 51 },
+	{ 54 },
+	{ 105 },
+	{ 87 },
+	{ 95 },
+	{ 95 },
+	{ 41 },
+	{ 94 },
+	{ 94 },
+	{ 41 },
+	{ 99 },
+	{ 45 },
+	{ 48 },
+	{ 91 },
+	{ 48 },
+	{ 50 },
+	{ 51 },
+	{ 65 },
+	{ 36 },
+	{ 39 },
+	{ 36 },
+	{ 41 },
+	{ 41 },
+	{ 42 },
+	{ 45 },
+	{ 41 },
+	{ 48 },
+	{ 45 },
+	{ 47 },
+	{ 47 },
+	{ 50 },
+	{ 50 },
+	{ 28 },
+	{ 31 },
+	{ 36 },
+	{ 36 },
+	{ 35 },
+	{ 22 },
+	{ 42 },
+	{ 36 },
+	{ 26 },
+	{ 47 },
+	{ 42 },
+	{ 34 },
+	{ 34 },
+	{ 49 },
+	{ 50 },
+	{ 54 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 50 },
+	{ 46 },
+	{ 51 },
+	{ 49 },
+	{ 81 },
+	{ 51 },
+	{ 45 },
+	{ 51 },
+	{ 51 },
+	{ 47 },
+	{ 21 },
+	{ 24 },
+	{ 22 },
+	{ 33 },
+	{ 24 },
+	{ 30 },
+	{ 133 },
+	{ 110 },
+	{ 3 },
+	{ 133 },
+	{ 129 },
+	{ 106 },
+	{ 121 },
+	{ 110 },
+	{ 146 },
+	{ 26 },
+	{ 28 },
+	{ 23 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 6 },
+	{ 35 },
+	{ 32 },
+	{ 0 },
+	{ 0 },
+	{ 35 },
+	{ 37 },
+	{ 36 },
+	{ 138 },
+	{ 157 },
+	{ 67 },
+	{ 167 },
+	{ 171 },
+	{ 138 },
+	{ 157 },
+	{ 159 },
+	{ 146 },
+	{ 164 },
+	{ 146 },
+	{ 142 },
+	{ 130 },
+	{ 142 },
+	{ 134 },
+	{ 47 },
+	{ 47 },
+	{ 66 },
+	{ 40 },
+	{ 41 },
+	{ 67 },
+	{ 48 },
+	{ 67 },
+	{ 39 },
+	{ 117 },
+	{ 138 },
+	{ 48 },
+	{ 155 },
+	{ 167 },
+	{ 117 },
+	{ 136 },
+	{ 148 },
+	{ 155 },
+	{ 70 },
+	{ 111 },
+	{ 68 },
+	{ 29 },
+	{ 39 },
+	{ 26 },
+	{ 156 },
+	{ 162 },
+	{ 136 },
+	{ 126 },
+	{ 136 },
+	{ 113 },
+	{ 47 },
+	{ 46 },
+	{ 81 },
+	{ 44 },
+	{ 46 },
+	{ 43 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 107 },
+	{ 45 },
+	{ 61 },
+	{ 44 },
+	{ 46 },
+	{ 45 },
+	{ 130 },
+	{ 71 },
+	{ 45 },
+	{ 154 },
+	{ 130 },
+	{ 84 },
+	{ 176 },
+	{ 154 },
+	{ 133 },
+	{ 43 },
+	{ 0 },
+	{ 42 },
+	{ 48 },
+	{ 0 },
+	{ 49 },
+	{ 0 },
+	{ 0 },
+	{ 42 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 48 },
+	{ 42 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 155 },
+	{ 146 },
+	{ 136 },
+	{ 117 },
+	{ 122 },
+	{ 0 },
+	{ 0 },
+	{ 110 },
+	{ 0 },
+	{ 89 },
+	{ 92 },
+	{ 116 },
+	{ 35 },
+	{ 60 },
+	{ 80 },
+	{ 95 },
+	{ 60 },
+	{ 130 },
+	{ 130 },
+	{ 110 },
+	{ 80 },
+	{ 155 },
+	{ 0 },
+	{ 146 },
+	{ 56 },
+	{ 92 },
+	{ 94 },
+	{ 12 },
+	{ 0 },
+	{ 71 },
+	{ 58 },
+	{ 49 },
+	{ 82 },
+	{ 131 },
+	{ 157 },
+	{ 58 },
+	{ 128 },
+	{ 157 },
+	{ 131 },
+	{ 146 },
+	{ 124 },
+	{ 133 },
+	{ 128 },
+	{ 141 },
+	{ 148 },
+	{ 131 },
+	{ 121 },
+	{ 143 },
+	{ 70 },
+	{ 68 },
+	{ 36 },
+	{ 30 },
+	{ 38 },
+	{ 68 },
+	{ 30 },
+	{ 26 },
+	{ 22 },
+	{ 31 },
+	{ 28 },
+	{ 26 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 81 },
+	{ 106 },
+	{ 54 },
+	{ 51 },
+	{ 50 },
+	{ 47 },
+	{ 146 },
+	{ 158 },
+	{ 121 },
+	{ 83 },
+	{ 102 },
+	{ 46 },
+	{ 37 },
+	{ 37 },
+	{ 46 },
+	{ 33 },
+	{ 36 },
+	{ 31 },
+	{ 33 },
+	{ 36 },
+	{ 30 },
+	{ 21 },
+	{ 21 },
+	{ 26 },
+	{ 21 },
+	{ 21 },
+	{ 26 },
+	{ 37 },
+	{ 35 },
+	{ 26 },
+	{ 38 },
+	{ 37 },
+	{ 37 },
+	{ 35 },
+	{ 37 },
+	{ 31 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 34 },
+	{ 35 },
+	{ 36 },
+	{ 35 },
+	{ 37 },
+	{ 40 },
+	{ 87 },
+	{ 101 },
+	{ 40 },
+	{ 157 },
+	{ 161 },
+	{ 87 },
+	{ 171 },
+	{ 170 },
+	{ 157 },
+	{ 170 },
+	{ 157 },
+	{ 164 },
+	{ 164 },
+	{ 164 },
+	{ 161 },
+	{ 143 },
+	{ 146 },
+	{ 142 },
+	{ 36 },
+	{ 37 },
+	{ 22 },
+	{ 37 },
+	{ 37 },
+	{ 19 },
+	{ 49 },
+	{ 18 },
+	{ 15 },
+	{ 18 },
+	{ 56 },
+	{ 59 },
+	{ 18 },
+	{ 59 },
+	{ 19 },
+	{ 85 },
+	{ 16 },
+	{ 77 },
+	{ 83 },
+	{ 20 },
+	{ 85 },
+	{ 51 },
+	{ 45 },
+	{ 83 },
+	{ 51 },
+	{ 45 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 96 },
+	{ 135 },
+	{ 51 },
+	{ 99 },
+	{ 152 },
+	{ 135 },
+	{ 186 },
+	{ 160 },
+	{ 152 },
+	{ 194 },
+	{ 187 },
+	{ 162 },
+	{ 192 },
+	{ 187 },
+	{ 180 },
+	{ 162 },
+	{ 162 },
+	{ 180 },
+	{ 161 },
+	{ 161 },
+	{ 123 },
+	{ 157 },
+	{ 176 },
+	{ 164 },
+	{ 154 },
+	{ 152 },
+	{ 130 },
+	{ 167 },
+	{ 78 },
+	{ 71 },
+	{ 152 },
+	{ 45 },
+	{ 44 },
+	{ 78 },
+	{ 48 },
+	{ 46 },
+	{ 45 },
+	{ 131 },
+	{ 82 },
+	{ 122 },
+	{ 146 },
+	{ 121 },
+	{ 131 },
+	{ 43 },
+	{ 12 },
+	{ 40 },
+	{ 12 },
+	{ 43 },
+	{ 6 },
+	{ 0 },
+	{ 6 },
+	{ 0 },
+	{ 94 },
+	{ 125 },
+	{ 120 },
+	{ 70 },
+	{ 104 },
+	{ 99 },
+	{ 37 },
+	{ 46 },
+	{ 45 },
+	{ 14 },
+	{ 31 },
+	{ 26 },
+	{ 43 },
+	{ 26 },
+	{ 31 },
+	{ 26 },
+	{ 18 },
+	{ 13 },
+	{ 120 },
+	{ 126 },
+	{ 163 },
+	{ 20 },
+	{ 24 },
+	{ 49 },
+	{ 45 },
+	{ 39 },
+	{ 18 },
+	{ 15 },
+	{ 12 },
+	{ 12 },
+	{ 122 },
+	{ 148 },
+	{ 70 },
+	{ 159 },
+	{ 148 },
+	{ 122 },
+	{ 111 },
+	{ 142 },
+	{ 122 },
+	{ 106 },
+	{ 130 },
+	{ 102 },
+	{ 22 },
+	{ 28 },
+	{ 31 },
+	{ 31 },
+	{ 97 },
+	{ 3 },
+	{ 150 },
+	{ 133 },
+	{ 97 },
+	{ 133 },
+	{ 150 },
+	{ 158 },
+	{ 129 },
+	{ 158 },
+	{ 149 },
+	{ 119 },
+	{ 149 },
+	{ 140 },
+	{ 88 },
+	{ 127 },
+	{ 133 },
+	{ 84 },
+	{ 31 },
+	{ 133 },
+	{ 45 },
+	{ 0 },
+	{ 84 },
+	{ 42 },
+	{ 0 },
+	{ 45 },
+	{ 129 },
+	{ 161 },
+	{ 150 },
+	{ 56 },
+	{ 49 },
+	{ 150 },
+	{ 18 },
+	{ 18 },
+	{ 56 },
+	{ 18 },
+	{ 18 },
+	{ 14 },
+	{ 27 },
+	{ 23 },
+	{ 19 },
+	{ 50 },
+	{ 65 },
+	{ 27 },
+	{ 175 },
+	{ 155 },
+	{ 168 },
+	{ 179 },
+	{ 168 },
+	{ 139 },
+	{ 155 },
+	{ 139 },
+	{ 140 },
+	{ 10 },
+	{ 15 },
+	{ 20 },
+	{ 164 },
+	{ 176 },
+	{ 155 },
+	{ 127 },
+	{ 155 },
+	{ 179 },
+	{ 126 },
+	{ 104 },
+	{ 163 },
+	{ 123 },
+	{ 104 },
+	{ 130 },
+	{ 14 },
+	{ 10 },
+	{ 13 },
+	{ 74 },
+	{ 96 },
+	{ 155 },
+	{ 70 },
+	{ 74 },
+	{ 127 },
+	{ 133 },
+	{ 127 },
+	{ 175 },
+	{ 139 },
+	{ 142 },
+	{ 130 },
+	{ 112 },
+	{ 140 },
+	{ 106 },
+	{ 102 },
+	{ 164 },
+	{ 96 },
+	{ 142 },
+	{ 164 },
+	{ 102 },
+	{ 89 },
+	{ 110 },
+	{ 121 },
+	{ 94 },
+	{ 49 },
+	{ 29 },
+	{ 20 },
+	{ 49 },
+	{ 45 },
+	{ 149 },
+	{ 140 },
+	{ 112 },
+	{ 19 },
+	{ 17 },
+	{ 23 },
+	{ 29 },
+	{ 24 },
+	{ 23 },
+	{ 17 },
+	{ 19 },
+	{ 16 },
+	{ 109 },
+	{ 133 },
+	{ 68 },
+	{ 96 },
+	{ 45 },
+	{ 102 },
+	{ 45 },
+	{ 96 },
+	{ 43 },
+	{ 45 },
+	{ 43 },
+	{ 74 },
+	{ 99 },
+	{ 39 },
+	{ 45 },
+	{ 26 },
+	{ 43 },
+	{ 45 },
+	{ 37 },
+	{ 31 },
+	{ 18 },
+	{ 112 },
+	{ 106 },
+	{ 66 },
+	{ 19 },
+	{ 18 },
+	{ 18 },
+	{ 19 },
+	{ 14 },
+	{ 13 },
+	{ 13 },
+	{ 12 },
+	{ 14 },
+	{ 12 },
+	{ 16 },
+	{ 12 },
+	{ 14 },
+	{ 17 },
+	{ 12 },
+	{ 14 },
+	{ 19 },
+	{ 14 },
+	{ 14 },
+	{ 22 },
+	{ 14 },
+	{ 12 },
+	{ 21 },
+	{ 14 },
+	{ 12 },
+	{ 22 },
+	{ 12 },
+	{ 10 },
+	{ 29 },
+	{ 12 },
+	{ 42 },
+	{ 45 },
+	{ 10 },
+	{ 45 },
+	{ 51 },
+	{ 42 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 88 },
+	{ 50 },
+	{ 51 },
+	{ 108 },
+	{ 88 },
+	{ 135 },
+	{ 118 },
+	{ 108 },
+	{ 152 },
+	{ 162 },
+	{ 124 },
+	{ 160 },
+	{ 121 },
+	{ 124 },
+	{ 162 },
+	{ 121 },
+	{ 162 },
+	{ 157 },
+	{ 157 },
+	{ 130 },
+	{ 130 },
+	{ 125 },
+	{ 130 },
+	{ 126 },
+	{ 41 },
+	{ 36 },
+	{ 109 },
+	{ 29 },
+	{ 13 },
+	{ 83 },
+	{ 94 },
+	{ 83 },
+	{ 139 },
+	{ 19 },
+	{ 18 },
+	{ 18 },
+	{ 133 },
+	{ 109 },
+	{ 94 },
+	{ 168 },
+	{ 149 },
+	{ 133 },
+	{ 179 },
+	{ 176 },
+	{ 175 },
+	{ 96 },
+	{ 68 },
+	{ 63 },
+	{ 68 },
+	{ 96 },
+	{ 65 },
+	{ 19 },
+	{ 28 },
+	{ 63 },
+	{ 23 },
+	{ 28 },
+	{ 28 },
+	{ 36 },
+	{ 35 },
+	{ 39 },
+	{ 39 },
+	{ 41 },
+	{ 65 },
+	{ 24 },
+	{ 31 },
+	{ 28 },
+	{ 35 },
+	{ 36 },
+	{ 31 },
+	{ 19 },
+	{ 31 },
+	{ 22 },
+	{ 36 },
+	{ 39 },
+	{ 66 },
+	{ 66 },
+	{ 102 },
+	{ 70 },
+	{ 102 },
+	{ 134 },
+	{ 111 },
+	{ 134 },
+	{ 146 },
+	{ 142 },
+	{ 153 },
+	{ 161 },
+	{ 146 },
+	{ 127 },
+	{ 140 },
+	{ 143 },
+	{ 111 },
+	{ 140 },
+	{ 127 },
+	{ 0 },
+	{ 28 },
+	{ 88 },
+	{ 37 },
+	{ 38 },
+	{ 41 },
+	{ 37 },
+	{ 34 },
+	{ 37 },
+	{ 171 },
+	{ 167 },
+	{ 148 },
+	{ 170 },
+	{ 171 },
+	{ 159 },
+	{ 14 },
+	{ 13 },
+	{ 10 },
+	{ 49 },
+	{ 94 },
+	{ 83 },
+	{ 10 },
+	{ 10 },
+	{ 15 },
+	{ 83 },
+	{ 13 },
+	{ 45 },
+	{ 37 },
+	{ 34 },
+	{ 38 },
+	{ 35 },
+	{ 34 },
+	{ 37 },
+	{ 35 },
+	{ 35 },
+	{ 33 },
+	{ 35 },
+	{ 32 },
+	{ 32 },
+	{ 31 },
+	{ 0 },
+	{ 33 },
+	{ 36 },
+	{ 29 },
+	{ 109 },
+	{ 14 },
+	{ 29 },
+	{ 36 },
+	{ 18 },
+	{ 19 },
+	{ 41 },
+	{ 66 },
+	{ 39 },
+	{ 18 },
+	{ 36 },
+	{ 18 },
+	{ 18 },
+	{ 18 },
+	{ 36 },
+	{ 18 },
+	{ 18 },
+	{ 21 },
+	{ 18 },
+	{ 36 },
+	{ 37 },
+	{ 21 },
+	{ 48 },
+	{ 37 },
+	{ 36 },
+	{ 47 },
+	{ 69 },
+	{ 48 },
+	{ 18 },
+	{ 33 },
+	{ 19 },
+	{ 19 },
+	{ 22 },
+	{ 18 },
+	{ 37 },
+	{ 36 },
+	{ 22 },
+	{ 37 },
+	{ 47 },
+	{ 36 },
+	{ 69 },
+	{ 47 },
+	{ 47 },
+	{ 66 },
+	{ 64 },
+	{ 69 },
+	{ 41 },
+	{ 68 },
+	{ 112 },
+	{ 48 },
+	{ 45 },
+	{ 45 },
+	{ 112 },
+	{ 45 },
+	{ 48 },
+	{ 112 },
+	{ 110 },
+	{ 134 },
+	{ 116 },
+	{ 109 },
+	{ 130 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 51 },
+	{ 51 },
+	{ 0 },
+	{ 51 },
+	{ 51 },
+	{ 24 },
+	{ 51 },
+	{ 24 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 46 },
+	{ 49 },
+	{ 46 },
+	{ 49 },
+	{ 82 },
+	{ 49 },
+	{ 93 },
+	{ 0 },
+	{ 136 },
+	{ 93 },
+	{ 32 },
+	{ 0 },
+	{ 29 },
+	{ 68 },
+	{ 48 },
+	{ 32 },
+	{ 48 },
+	{ 68 },
+	{ 42 },
+	{ 45 },
+	{ 41 },
+	{ 33 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 41 },
+	{ 0 },
+	{ 40 },
+	{ 41 },
+	{ 40 },
+	{ 94 },
+	{ 80 },
+	{ 76 },
+	{ 81 },
+	{ 0 },
+	{ 117 },
+	{ 155 },
+	{ 136 },
+	{ 122 },
+	{ 92 },
+	{ 76 },
+	{ 110 },
+	{ 122 },
+	{ 109 },
+	{ 116 },
+	{ 97 },
+	{ 49 },
+	{ 84 },
+	{ 64 },
+	{ 49 },
+	{ 97 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 42 },
+	{ 83 },
+	{ 163 },
+	{ 133 },
+	{ 168 },
+	{ 128 },
+	{ 108 },
+	{ 133 },
+	{ 122 },
+	{ 108 },
+	{ 109 },
+	{ 103 },
+	{ 0 },
+	{ 122 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 72 },
+	{ 51 },
+	{ 67 },
+	{ 93 },
+	{ 72 },
+	{ 89 },
+	{ 94 },
+	{ 93 },
+	{ 121 },
+	{ 85 },
+	{ 94 },
+	{ 134 },
+	{ 59 },
+	{ 81 },
+	{ 134 },
+	{ 93 },
+	{ 49 },
+	{ 48 },
+	{ 46 },
+	{ 49 },
+	{ 46 },
+	{ 46 },
+	{ 0 },
+	{ 43 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 24 },
+	{ 51 },
+	{ 47 },
+	{ 9 },
+	{ 51 },
+	{ 49 },
+	{ 47 },
+	{ 50 },
+	{ 12 },
+	{ 0 },
+	{ 0 },
+	{ 49 },
+	{ 0 },
+	{ 0 },
+	{ 44 },
+	{ 0 },
+	{ 44 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 27 },
+	{ 37 },
+	{ 0 },
+	{ 78 },
+	{ 27 },
+	{ 0 },
+	{ 91 },
+	{ 78 },
+	{ 0 },
+	{ 0 },
+	{ 91 },
+	{ 0 },
+	{ 0 },
+	{ 148 },
+	{ 0 },
+	{ 0 },
+	{ 87 },
+	{ 43 },
+	{ 103 },
+	{ 0 },
+	{ 0 },
+	{ 49 },
+	{ 0 },
+	{ 0 },
+	{ 50 },
+	{ 0 },
+	{ 50 },
+	{ 0 },
+	{ 12 },
+	{ 51 },
+	{ 50 },
+	{ 51 },
+	{ 129 },
+	{ 122 },
+	{ 162 },
+	{ 113 },
+	{ 127 },
+	{ 103 },
+	{ 51 },
+	{ 51 },
+	{ 44 },
+	{ 44 },
+	{ 51 },
+	{ 49 },
+	{ 49 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 50 },
+	{ 56 },
+	{ 50 },
+	{ 50 },
+	{ 101 },
+	{ 49 },
+	{ 49 },
+	{ 117 },
+	{ 43 },
+	{ 43 },
+	{ 122 },
+	{ 103 },
+	{ 127 },
+	{ 134 },
+	{ 73 },
+	{ 121 },
+	{ 87 },
+	{ 134 },
+	{ 89 },
+	{ 148 },
+	{ 121 },
+	{ 67 },
+	{ 91 },
+	{ 89 },
+	{ 51 },
+	{ 78 },
+	{ 67 },
+	{ 51 },
+	{ 27 },
+	{ 51 },
+	{ 51 },
+	{ 37 },
+	{ 51 },
+	{ 37 },
+	{ 51 },
+	{ 49 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 73 },
+	{ 0 },
+	{ 0 },
+	{ 37 },
+	{ 49 },
+	{ 0 },
+	{ 12 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 69 },
+	{ 119 },
+	{ 75 },
+	{ 69 },
+	{ 75 },
+	{ 49 },
+	{ 45 },
+	{ 49 },
+	{ 51 },
+	{ 45 },
+	{ 51 },
+	{ 44 },
+	{ 50 },
+	{ 49 },
+	{ 51 },
+	{ 50 },
+	{ 51 },
+	{ 49 },
+	{ 48 },
+	{ 49 },
+	{ 47 },
+	{ 50 },
+	{ 51 },
+	{ 49 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 143 },
+	{ 126 },
+	{ 119 },
+	{ 141 },
+	{ 156 },
+	{ 126 },
+	{ 156 },
+	{ 141 },
+	{ 139 },
+	{ 139 },
+	{ 141 },
+	{ 124 },
+	{ 81 },
+	{ 113 },
+	{ 124 },
+	{ 46 },
+	{ 48 },
+	{ 85 },
+	{ 48 },
+	{ 46 },
+	{ 45 },
+	{ 127 },
+	{ 113 },
+	{ 81 },
+	{ 40 },
+	{ 40 },
+	{ 49 },
+	{ 0 },
+	{ 84 },
+	{ 0 },
+	{ 0 },
+	{ 103 },
+	{ 136 },
+	{ 122 },
+	{ 110 },
+	{ 0 },
+	{ 80 },
+	{ 94 },
+	{ 92 },
+	{ 0 },
+	{ 0 },
+	{ 84 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 92 },
+	{ 56 },
+	{ 121 },
+	{ 92 },
+	{ 0 },
+	{ 81 },
+	{ 84 },
+	{ 81 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 103 },
+	{ 0 },
+	{ 103 },
+	{ 0 },
+	{ 129 },
+	{ 0 },
+	{ 93 },
+	{ 168 },
+	{ 108 },
+	{ 93 },
+	{ 59 },
+	{ 59 },
+	{ 48 },
+	{ 47 },
+	{ 47 },
+	{ 45 },
+	{ 75 },
+	{ 75 },
+	{ 78 },
+	{ 150 },
+	{ 167 },
+	{ 158 },
+	{ 152 },
+	{ 164 },
+	{ 142 },
+	{ 167 },
+	{ 133 },
+	{ 61 },
+	{ 75 },
+	{ 146 },
+	{ 133 },
+	{ 150 },
+	{ 83 },
+	{ 69 },
+	{ 142 },
+	{ 71 },
+	{ 125 },
+	{ 129 },
+	{ 40 },
+	{ 71 },
+	{ 128 },
+	{ 56 },
+	{ 40 },
+	{ 139 },
+	{ 71 },
+	{ 0 },
+	{ 125 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 125 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 32 },
+	{ 1 },
+	{ 16 },
+	{ 22 },
+	{ 33 },
+	{ 30 },
+	{ 37 },
+	{ 30 },
+	{ 33 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 43 },
+	{ 81 },
+	{ 0 },
+	{ 64 },
+	{ 81 },
+	{ 43 },
+	{ 64 },
+	{ 49 },
+	{ 44 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 2 },
+	{ 0 },
+	{ 22 },
+	{ 17 },
+	{ 1 },
+	{ 30 },
+	{ 29 },
+	{ 22 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 81 },
+	{ 0 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 49 },
+	{ 50 },
+	{ 46 },
+	{ 96 },
+	{ 71 },
+	{ 72 },
+	{ 100 },
+	{ 85 },
+	{ 96 },
+	{ 45 },
+	{ 72 },
+	{ 46 },
+	{ 45 },
+	{ 45 },
+	{ 46 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 55 },
+	{ 0 },
+	{ 61 },
+	{ 55 },
+	{ 51 },
+	{ 46 },
+	{ 45 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 46 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 50 },
+	{ 0 },
+	{ 43 },
+	{ 49 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 50 },
+	{ 49 },
+	{ 0 },
+	{ 54 },
+	{ 51 },
+	{ 50 },
+	{ 50 },
+	{ 50 },
+	{ 49 },
+	{ 45 },
+	{ 46 },
+	{ 49 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 2 },
+	{ 1 },
+	{ 4 },
+	{ 3 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 3 },
+	{ 1 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 43 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 46 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 45 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 73 },
+	{ 0 },
+	{ 73 },
+	{ 0 },
+	{ 60 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 54 },
+	{ 64 },
+	{ 61 },
+	{ 73 },
+	{ 76 },
+	{ 64 },
+	{ 73 },
+	{ 84 },
+	{ 84 },
+	{ 70 },
+	{ 84 },
+	{ 73 },
+	{ 65 },
+	{ 73 },
+	{ 64 },
+	{ 53 },
+	{ 47 },
+	{ 49 },
+	{ 53 },
+	{ 54 },
+	{ 45 },
+	{ 53 },
+	{ 61 },
+	{ 54 },
+	{ 46 },
+	{ 54 },
+	{ 54 },
+	{ 64 },
+	{ 64 },
+	{ 54 },
+	{ 53 },
+	{ 45 },
+	{ 47 },
+	{ 45 },
+	{ 40 },
+	{ 45 },
+	{ 45 },
+	{ 45 },
+	{ 46 },
+	{ 61 },
+	{ 49 },
+	{ 57 },
+	{ 0 },
+	{ 57 },
+	{ 57 },
+	{ 42 },
+	{ 57 },
+	{ 49 },
+	{ 57 },
+	{ 70 },
+	{ 65 },
+	{ 34 },
+	{ 40 },
+	{ 47 },
+	{ 0 },
+	{ 0 },
+	{ 34 },
+	{ 35 },
+	{ 24 },
+	{ 0 },
+	{ 41 },
+	{ 35 },
+	{ 34 },
+	{ 0 },
+	{ 85 },
+	{ 84 },
+	{ 0 },
+	{ 84 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 73 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 3 },
+	{ 0 },
+	{ 0 },
+	{ 84 },
+	{ 85 },
+	{ 84 },
+	{ 73 },
+	{ 81 },
+	{ 73 },
+	{ 84 },
+	{ 81 },
+	{ 76 },
+	{ 81 },
+	{ 73 },
+	{ 71 },
+	{ 0 },
+	{ 85 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 57 },
+	{ 0 },
+	{ 70 },
+	{ 84 },
+	{ 70 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 3 },
+	{ 3 },
+	{ 0 },
+	{ 71 },
+	{ 61 },
+	{ 64 },
+	{ 71 },
+	{ 66 },
+	{ 61 },
+	{ 73 },
+	{ 60 },
+	{ 66 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 57 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 4 },
+	{ 3 },
+	{ 0 },
+	{ 4 },
+	{ 2 },
+	{ 3 },
+	{ 4 },
+	{ 2 },
+	{ 3 },
+	{ 3 },
+	{ 3 },
+	{ 2 },
+	{ 3 },
+	{ 2 },
+	{ 2 },
+	{ 3 },
+	{ 2 },
+	{ 2 },
+	{ 1 },
+	{ 2 },
+	{ 3 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 3 },
+	{ 0 },
+	{ 2 },
+	{ 4 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 2 },
+	{ 1 },
+	{ 3 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 4 },
+	{ 0 },
+	{ 4 },
+	{ 3 },
+	{ 4 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 3 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 28 },
+	{ 0 },
+	{ 22 },
+	{ 24 },
+	{ 22 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 23 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 24 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 40 },
+	{ 0 },
+	{ 0 },
+	{ 42 },
+	{ 23 },
+	{ 35 },
+	{ 29 },
+	{ 28 },
+	{ 37 },
+	{ 35 },
+	{ 42 },
+	{ 37 },
+	{ 40 },
+	{ 33 },
+	{ 22 },
+	{ 35 },
+	{ 22 },
+	{ 33 },
+	{ 28 },
+	{ 33 },
+	{ 35 },
+	{ 41 },
+	{ 45 },
+	{ 47 },
+	{ 42 },
+	{ 49 },
+	{ 47 },
+	{ 49 },
+	{ 49 },
+	{ 48 },
+	{ 49 },
+	{ 49 },
+	{ 49 },
+	{ 48 },
+	{ 49 },
+	{ 49 },
+	{ 49 },
+	{ 50 },
+	{ 50 },
+	{ 49 },
+	{ 50 },
+	{ 49 },
+	{ 49 },
+	{ 49 },
+	{ 49 },
+	{ 47 },
+	{ 49 },
+	{ 49 },
+	{ 43 },
+	{ 0 },
+	{ 46 },
+	{ 49 },
+	{ 41 },
+	{ 45 },
+	{ 48 },
+	{ 0 },
+	{ 30 },
+	{ 45 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 3 },
+	{ 2 },
+	{ 3 },
+	{ 0 },
+	{ 0 },
+	{ 30 },
+	{ 0 },
+	{ 0 },
+	{ 30 },
+	{ 0 },
+	{ 38 },
+	{ 38 },
+	{ 0 },
+	{ 29 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 41 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 41 },
+	{ 46 },
+	{ 49 },
+	{ 45 },
+	{ 44 },
+	{ 42 },
+	{ 45 },
+	{ 38 },
+	{ 38 },
+	{ 29 },
+	{ 35 },
+	{ 45 },
+	{ 42 },
+	{ 45 },
+	{ 42 },
+	{ 35 },
+	{ 41 },
+	{ 49 },
+	{ 45 },
+	{ 47 },
+	{ 45 },
+	{ 42 },
+	{ 47 },
+	{ 45 },
+	{ 41 },
+	{ 42 },
+	{ 23 },
+	{ 0 },
+	{ 28 },
+	{ 0 },
+	{ 0 },
+	{ 82 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 74 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 124 },
+	{ 0 },
+	{ 128 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 124 },
+	{ 0 },
+	{ 139 },
+	{ 141 },
+	{ 128 },
+	{ 128 },
+	{ 0 },
+	{ 124 },
+	{ 142 },
+	{ 124 },
+	{ 141 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 2 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 1 },
+	{ 5 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 87 },
+	{ 74 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 3 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 0 },
+	{ 2 },
+	{ 1 },
+	{ 2 },
+	{ 2 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 3 },
+	{ 3 },
+	{ 2 },
+	{ 2 },
+	{ 1 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 4 },
+	{ 2 },
+	{ 3 },
+	{ 4 },
+	{ 3 },
+	{ 4 },
+	{ 4 },
+	{ 5 },
+	{ 4 },
+	{ 4 },
+	{ 2 },
+	{ 3 },
+	{ 3 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 3 },
+	{ 0 },
+	{ 0 },
+	{ 94 },
+	{ 112 },
+	{ 98 },
+	{ 87 },
+	{ 82 },
+	{ 98 },
+	{ 0 },
+	{ 124 },
+	{ 0 },
+	{ 122 },
+	{ 122 },
+	{ 128 },
+	{ 124 },
+	{ 98 },
+	{ 112 },
+	{ 122 },
+	{ 118 },
+	{ 134 },
+	{ 128 },
+	{ 112 },
+	{ 87 },
+	{ 94 },
+	{ 137 },
+	{ 139 },
+	{ 134 },
+	{ 136 },
+	{ 137 },
+	{ 127 },
+	{ 150 },
+	{ 141 },
+	{ 137 },
+	{ 150 },
+	{ 137 },
+	{ 136 },
+	{ 0 },
+	{ 74 },
+	{ 98 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 126 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 139 },
+	{ 117 },
+	{ 0 },
+	{ 148 },
+	{ 139 },
+	{ 148 },
+	{ 148 },
+	{ 144 },
+	{ 144 },
+	{ 148 },
+	{ 139 },
+	{ 151 },
+	{ 141 },
+	{ 148 },
+	{ 142 },
+	{ 151 },
+	{ 148 },
+	{ 150 },
+	{ 152 },
+	{ 148 },
+	{ 0 },
+	{ 124 },
+	{ 148 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 2 },
+	{ 5 },
+	{ 3 },
+	{ 5 },
+	{ 2 },
+	{ 4 },
+	{ 5 },
+	{ 3 },
+	{ 0 },
+	{ 1 },
+	{ 5 },
+	{ 4 },
+	{ 2 },
+	{ 0 },
+	{ 2 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 2 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 106 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 139 },
+	{ 106 },
+	{ 0 },
+	{ 139 },
+	{ 149 },
+	{ 148 },
+	{ 120 },
+	{ 106 },
+	{ 139 },
+	{ 106 },
+	{ 120 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 3 },
+	{ 2 },
+	{ 3 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 67 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 67 },
+	{ 0 },
+	{ 121 },
+	{ 67 },
+	{ 121 },
+	{ 0 },
+	{ 0 },
+	{ 112 },
+	{ 0 },
+	{ 0 },
+	{ 88 },
+	{ 0 },
+	{ 72 },
+	{ 88 },
+	{ 120 },
+	{ 88 },
+	{ 112 },
+	{ 120 },
+	{ 136 },
+	{ 120 },
+	{ 121 },
+	{ 130 },
+	{ 120 },
+	{ 136 },
+	{ 139 },
+	{ 148 },
+	{ 141 },
+	{ 121 },
+	{ 120 },
+	{ 136 },
+	{ 148 },
+	{ 149 },
+	{ 144 },
+	{ 152 },
+	{ 150 },
+	{ 142 },
+	{ 142 },
+	{ 136 },
+	{ 119 },
+	{ 126 },
+	{ 135 },
+	{ 144 },
+	{ 148 },
+	{ 144 },
+	{ 135 },
+	{ 141 },
+	{ 135 },
+	{ 126 },
+	{ 130 },
+	{ 126 },
+	{ 101 },
+	{ 126 },
+	{ 114 },
+	{ 94 },
+	{ 135 },
+	{ 126 },
+	{ 114 },
+	{ 126 },
+	{ 119 },
+	{ 107 },
+	{ 107 },
+	{ 119 },
+	{ 117 },
+	{ 96 },
+	{ 117 },
+	{ 115 },
+	{ 78 },
+	{ 107 },
+	{ 96 },
+	{ 96 },
+	{ 93 },
+	{ 76 },
+	{ 117 },
+	{ 119 },
+	{ 126 },
+	{ 141 },
+	{ 143 },
+	{ 126 },
+	{ 150 },
+	{ 141 },
+	{ 136 },
+	{ 144 },
+	{ 152 },
+	{ 149 },
+	{ 149 },
+	{ 139 },
+	{ 126 },
+	{ 148 },
+	{ 126 },
+	{ 117 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 75 },
+	{ 96 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 2 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 78 },
+	{ 76 },
+	{ 78 },
+	{ 0 },
+	{ 94 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 101 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 76 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 87 },
+	{ 0 },
+	{ 0 },
+	{ 87 },
+	{ 93 },
+	{ 97 },
+	{ 96 },
+	{ 75 },
+	{ 97 },
+	{ 127 },
+	{ 112 },
+	{ 124 },
+	{ 97 },
+	{ 115 },
+	{ 112 },
+	{ 127 },
+	{ 106 },
+	{ 112 },
+	{ 97 },
+	{ 75 },
+	{ 87 },
+	{ 93 },
+	{ 87 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 80 },
+	{ 0 },
+	{ 96 },
+	{ 118 },
+	{ 94 },
+	{ 80 },
+	{ 80 },
+	{ 0 },
+	{ 0 },
+	{ 94 },
+	{ 0 },
+	{ 80 },
+	{ 1 },
+	{ 1 },
+	{ 0 },
+	{ 3 },
+	{ 3 },
+	{ 1 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 2 },
+	{ 3 },
+	{ 2 },
+	{ 2 },
+	{ 1 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 3 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 2 },
+	{ 0 },
+	{ 3 },
+	{ 3 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 3 },
+	{ 3 },
+	{ 4 },
+	{ 4 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 4 },
+	{ 0 },
+	{ 3 },
+	{ 2 },
+	{ 6 },
+	{ 3 },
+	{ 6 },
+	{ 6 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 6 },
+	{ 0 },
+	{ 5 },
+	{ 0 },
+	{ 4 },
+	{ 2 },
+	{ 2 },
+	{ 3 },
+	{ 2 },
+	{ 2 },
+	{ 3 },
+	{ 4 },
+	{ 2 },
+	{ 5 },
+	{ 6 },
+	{ 2 },
+	{ 5 },
+	{ 2 },
+	{ 4 },
+	{ 4 },
+	{ 3 },
+	{ 3 },
+	{ 4 },
+	{ 3 },
+	{ 3 },
+	{ 0 },
+	{ 3 },
+	{ 4 },
+	{ 4 },
+	{ 3 },
+	{ 3 },
+	{ 2 },
+	{ 2 },
+	{ 3 },
+	{ 3 },
+	{ 0 },
+	{ 4 },
+	{ 0 },
+	{ 4 },
+	{ 5 },
+	{ 4 },
+	{ 3 },
+	{ 6 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 3 },
+	{ 2 },
+	{ 3 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 106 },
+	{ 127 },
+	{ 134 },
+	{ 5 },
+	{ 3 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 5 },
+	{ 1 },
+	{ 4 },
+	{ 117 },
+	{ 126 },
+	{ 124 },
+	{ 136 },
+	{ 124 },
+	{ 126 },
+	{ 0 },
+	{ 72 },
+	{ 0 },
+	{ 120 },
+	{ 120 },
+	{ 117 },
+	{ 72 },
+	{ 117 },
+	{ 0 },
+	{ 3 },
+	{ 5 },
+	{ 2 },
+	{ 3 },
+	{ 2 },
+	{ 4 },
+	{ 2 },
+	{ 2 },
+	{ 4 },
+	{ 2 },
+	{ 3 },
+	{ 2 },
+	{ 141 },
+	{ 150 },
+	{ 142 },
+	{ 94 },
+	{ 114 },
+	{ 78 },
+	{ 150 },
+	{ 143 },
+	{ 151 },
+	{ 46 },
+	{ 50 },
+	{ 49 },
+	{ 4 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 3 },
+	{ 0 },
+	{ 4 },
+	{ 0 },
+	{ 0 },
+	{ 3 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 3 },
+	{ 0 },
+	{ 3 },
+	{ 21 },
+	{ 0 },
+	{ 21 },
+	{ 3 },
+	{ 40 },
+	{ 3 },
+	{ 49 },
+	{ 40 },
+	{ 49 },
+	{ 3 },
+	{ 37 },
+	{ 37 },
+	{ 4 },
+	{ 10 },
+	{ 3 },
+	{ 0 },
+	{ 10 },
+	{ 0 },
+	{ 3 },
+	{ 0 },
+	{ 3 },
+	{ 0 },
+	{ 0 },
+	{ 48 },
+	{ 0 },
+	{ 45 },
+	{ 45 },
+	{ 0 },
+	{ 46 },
+	{ 46 },
+	{ 0 },
+	{ 70 },
+	{ 70 },
+	{ 0 },
+	{ 73 },
+	{ 21 },
+	{ 27 },
+	{ 73 },
+	{ 40 },
+	{ 29 },
+	{ 27 },
+	{ 49 },
+	{ 62 },
+	{ 29 },
+	{ 37 },
+	{ 71 },
+	{ 62 },
+	{ 10 },
+	{ 44 },
+	{ 71 },
+	{ 0 },
+	{ 45 },
+	{ 44 },
+	{ 0 },
+	{ 48 },
+	{ 45 },
+	{ 0 },
+	{ 48 },
+	{ 48 },
+	{ 50 },
+	{ 48 },
+	{ 49 },
+	{ 49 },
+	{ 45 },
+	{ 57 },
+	{ 57 },
+	{ 46 },
+	{ 98 },
+	{ 98 },
+	{ 70 },
+	{ 126 },
+	{ 27 },
+	{ 136 },
+	{ 126 },
+	{ 29 },
+	{ 122 },
+	{ 136 },
+	{ 62 },
+	{ 108 },
+	{ 122 },
+	{ 71 },
+	{ 87 },
+	{ 108 },
+	{ 44 },
+	{ 50 },
+	{ 87 },
+	{ 45 },
+	{ 49 },
+	{ 50 },
+	{ 48 },
+	{ 50 },
+	{ 49 },
+	{ 48 },
+	{ 50 },
+	{ 50 },
+	{ 49 },
+	{ 74 },
+	{ 51 },
+	{ 74 },
+	{ 49 },
+	{ 83 },
+	{ 83 },
+	{ 57 },
+	{ 143 },
+	{ 126 },
+	{ 156 },
+	{ 143 },
+	{ 156 },
+	{ 126 },
+	{ 184 },
+	{ 122 },
+	{ 163 },
+	{ 184 },
+	{ 163 },
+	{ 122 },
+	{ 156 },
+	{ 87 },
+	{ 111 },
+	{ 156 },
+	{ 50 },
+	{ 95 },
+	{ 111 },
+	{ 95 },
+	{ 50 },
+	{ 50 },
+	{ 50 },
+	{ 51 },
+	{ 50 },
+	{ 51 },
+	{ 50 },
+	{ 51 },
+	{ 3 },
+	{ 6 },
+	{ 3 },
+	{ 74 },
+	{ 83 },
+	{ 143 },
+	{ 184 },
+	{ 175 },
+	{ 156 },
+	{ 156 },
+	{ 175 },
+	{ 163 },
+	{ 156 },
+	{ 111 },
+	{ 95 },
+	{ 95 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 74 },
+	{ 7 },
+	{ 7 },
+	{ 3 },
+	{ 3 },
+	{ 4 },
+	{ 3 },
+	{ 3 },
+	{ 4 },
+	{ 7 },
+	{ 1 },
+	{ 3 },
+	{ 3 },
+	{ 3 },
+	{ 4 },
+	{ 7 },
+	{ 4 },
+	{ 5 },
+	{ 7 },
+	{ 5 },
+	{ 3 },
+	{ 6 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 2 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 2 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+	{ 0 },
+};
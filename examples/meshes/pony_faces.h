@@ -0,0 +1,6815 @@
+const r3d_face_t faces2[] =
+{ // plane normal[xyz], distance (scaled by 127)
+	{ -24, 92, 84, 43 },
+	{ 26, 92, 84, 44 },
+	{ -19, 113, -54, -8 },
+	{ 16, 117, -46, -4 },
+	{ 34, 56, -109, -36 },
+	{ -35, 59, -107, -35 },
+	{ -42, 28, -117, -42 },
+	{ 40, 34, -116, -41 },
+	{ 25, -73, -101, -45 },
+	{ -26, -71, -102, -46 },
+	{ 13, -118, 44, 6 },
+	{ -10, -121, 37, 3 },
+	{ -35, -61, 106, 35 },
+	{ 36, -60, 106, 36 },
+	{ 39, -30, 117, 44 },
+	{ -40, -29, 117, 43 },
+	{ 81, 60, -77, -13 },
+	{ 48, 5, -118, -33 },
+	{ -53, -9, -115, -40 },
+	{ -16, 71, -104, -26 },
+	{ -81, 1, -97, -27 },
+	{ -59, 64, -93, -20 },
+	{ 36, 65, -103, -26 },
+	{ 11, -11, -126, -41 },
+	{ -79, 89, 43, 28 },
+	{ 81, 88, 43, 29 },
+	{ -30, 123, 10, 17 },
+	{ 36, 122, 3, 15 },
+	{ 119, 12, -42, -15 },
+	{ -121, 12, -38, -17 },
+	{ -119, -5, -43, -20 },
+	{ 119, -7, -45, -19 },
+	{ 64, -104, -35, -23 },
+	{ -70, -101, -31, -23 },
+	{ 50, -116, 14, -4 },
+	{ -55, -114, 13, -5 },
+	{ -116, -23, 47, 18 },
+	{ 114, -25, 49, 21 },
+	{ 116, 12, 50, 25 },
+	{ -117, 13, 49, 22 },
+	{ -54, 114, 17, 21 },
+	{ 52, 112, 28, 26 },
+	{ 7, 127, 3, 17 },
+	{ -3, 126, 14, 20 },
+	{ 120, 5, -42, -16 },
+	{ -121, 5, -38, -18 },
+	{ -120, 0, -42, -20 },
+	{ 121, -2, -39, -16 },
+	{ 28, -115, -47, -27 },
+	{ -31, -117, -37, -25 },
+	{ -1, -125, -25, -20 },
+	{ -8, -121, -37, -23 },
+	{ -121, -23, 31, 12 },
+	{ 122, -23, 28, 14 },
+	{ 122, 11, 33, 19 },
+	{ -121, 10, 37, 18 },
+	{ -73, 93, 46, 29 },
+	{ 78, 88, 48, 31 },
+	{ -37, 121, -12, 8 },
+	{ 45, 118, -8, 10 },
+	{ 111, 26, -55, -18 },
+	{ -113, 26, -51, -20 },
+	{ -114, 3, -57, -24 },
+	{ 114, 2, -57, -22 },
+	{ 78, -90, -45, -26 },
+	{ -84, -86, -42, -26 },
+	{ 52, -114, 23, 0 },
+	{ -56, -111, 27, 1 },
+	{ -107, -31, 61, 21 },
+	{ 108, -33, 59, 23 },
+	{ 110, 3, 63, 28 },
+	{ -111, 4, 62, 26 },
+	{ -66, 91, 58, 33 },
+	{ 66, 92, 58, 35 },
+	{ -49, 109, -42, -5 },
+	{ 49, 109, -44, -4 },
+	{ 89, 45, -79, -25 },
+	{ -89, 45, -78, -27 },
+	{ -94, 13, -84, -33 },
+	{ 93, 13, -85, -31 },
+	{ 73, -74, -73, -35 },
+	{ -78, -67, -74, -36 },
+	{ 43, -113, 39, 6 },
+	{ -46, -111, 42, 6 },
+	{ -89, -37, 82, 29 },
+	{ 85, -42, 85, 31 },
+	{ 92, -10, 87, 35 },
+	{ -92, -21, 85, 31 },
+	{ 15, 123, 30, 22 },
+	{ 26, 120, 32, 22 },
+	{ -28, 121, 29, 21 },
+	{ -14, 122, 34, 23 },
+	{ 91, 66, 59, 29 },
+	{ 28, 116, 43, 27 },
+	{ 94, -85, 8, -2 },
+	{ 117, -28, 42, 16 },
+	{ 21, -125, 6, -7 },
+	{ 49, -117, 3, -7 },
+	{ -44, -119, -9, -13 },
+	{ -21, -125, 1, -10 },
+	{ -115, -27, 47, 15 },
+	{ -91, -87, 17, -1 },
+	{ -29, 116, 42, 26 },
+	{ -91, 67, 58, 27 },
+	{ 22, 124, 16, 17 },
+	{ 25, 123, 16, 17 },
+	{ -26, 124, 10, 14 },
+	{ -21, 124, 17, 17 },
+	{ 98, 74, 34, 22 },
+	{ 26, 122, 22, 20 },
+	{ 76, -99, 23, 2 },
+	{ 109, -59, 28, 8 },
+	{ 29, -122, 20, -2 },
+	{ 65, -106, 24, 1 },
+	{ -65, -107, 21, -1 },
+	{ -30, -121, 22, -2 },
+	{ -109, -58, 31, 7 },
+	{ -76, -100, 20, -1 },
+	{ -26, 123, 16, 17 },
+	{ -99, 73, 32, 19 },
+	{ 25, 125, -1, 11 },
+	{ 16, 126, 3, 13 },
+	{ -17, 126, 0, 11 },
+	{ -24, 125, 3, 12 },
+	{ 106, 64, 26, 19 },
+	{ 41, 120, 10, 16 },
+	{ 82, -91, 35, 7 },
+	{ 101, -70, 31, 8 },
+	{ 26, -118, 38, 4 },
+	{ 70, -97, 42, 8 },
+	{ -70, -100, 34, 4 },
+	{ -27, -117, 41, 5 },
+	{ -101, -70, 32, 6 },
+	{ -82, -93, 28, 2 },
+	{ -41, 120, 8, 14 },
+	{ -106, 64, 26, 16 },
+	{ 33, 121, -20, 5 },
+	{ 6, 125, -19, 6 },
+	{ -6, 126, -17, 6 },
+	{ -33, 121, -19, 5 },
+	{ 104, 72, -3, 10 },
+	{ 51, 116, -12, 9 },
+	{ 88, -89, 20, 2 },
+	{ 97, -79, 22, 4 },
+	{ 22, -123, 20, -2 },
+	{ 91, -88, 11, 0 },
+	{ -92, -85, 22, 1 },
+	{ -22, -124, 17, -3 },
+	{ -95, -82, 21, 1 },
+	{ -89, -87, 24, 1 },
+	{ -50, 116, -14, 7 },
+	{ -106, 70, -3, 7 },
+	{ 29, 111, -53, -5 },
+	{ 13, 117, -49, -3 },
+	{ -12, 114, -55, -5 },
+	{ -30, 115, -45, -3 },
+	{ 84, 63, -71, -10 },
+	{ 49, 101, -60, -5 },
+	{ 87, -93, 0, -4 },
+	{ 103, -68, -31, -9 },
+	{ 28, -124, -3, -8 },
+	{ 70, -105, 12, -2 },
+	{ -69, -107, -7, -9 },
+	{ -27, -123, -14, -12 },
+	{ -105, -68, -19, -8 },
+	{ -87, -92, 5, -4 },
+	{ -49, 103, -56, -5 },
+	{ -87, 65, -66, -10 },
+	{ -14, 122, 34, 23 },
+	{ 12, 84, 94, 42 },
+	{ 52, 76, 87, 40 },
+	{ -5, 108, 67, 34 },
+	{ 87, -17, 91, 34 },
+	{ 36, -31, 118, 41 },
+	{ 28, -116, 43, 7 },
+	{ 68, -92, 56, 14 },
+	{ -27, -116, 43, 6 },
+	{ -37, -39, 115, 39 },
+	{ -87, -27, 88, 30 },
+	{ -73, -92, 49, 10 },
+	{ -58, 68, 91, 39 },
+	{ -14, 80, 98, 43 },
+	{ 10, 122, 34, 23 },
+	{ 5, 108, 67, 34 },
+	{ 6, 64, -109, -22 },
+	{ 24, 60, -109, -22 },
+	{ 58, 12, -112, -26 },
+	{ 26, -22, -122, -31 },
+	{ 72, -35, -99, -25 },
+	{ 69, -85, -64, -20 },
+	{ 16, -124, -23, -14 },
+	{ 23, -103, -71, -24 },
+	{ -20, -123, -22, -14 },
+	{ -47, -77, -89, -28 },
+	{ -62, -34, -106, -29 },
+	{ -34, -101, -70, -24 },
+	{ -55, 10, -114, -28 },
+	{ -33, 44, -115, -25 },
+	{ -3, 64, -110, -23 },
+	{ -29, -22, -122, -32 },
+	{ 31, 123, -7, 9 },
+	{ 32, 119, -31, 2 },
+	{ 11, 127, -4, 11 },
+	{ 15, 122, -33, 2 },
+	{ -11, 126, -7, 9 },
+	{ -16, 123, -29, 3 },
+	{ -30, 123, -5, 9 },
+	{ -32, 118, -33, 1 },
+	{ 108, 67, 9, 13 },
+	{ 98, 77, -22, 5 },
+	{ 45, 119, -1, 12 },
+	{ 50, 113, -29, 4 },
+	{ 95, -82, 19, 3 },
+	{ 87, -91, 19, 2 },
+	{ 99, -75, 24, 5 },
+	{ 106, -68, 12, 3 },
+	{ 23, -122, 29, 1 },
+	{ 28, -123, 10, -5 },
+	{ 83, -92, 28, 4 },
+	{ 70, -104, 21, 1 },
+	{ -83, -95, 19, -1 },
+	{ -70, -106, 7, -5 },
+	{ -23, -121, 30, 1 },
+	{ -29, -123, 13, -5 },
+	{ -99, -75, 25, 3 },
+	{ -107, -68, 8, -1 },
+	{ -95, -81, 23, 2 },
+	{ -87, -91, 17, -1 },
+	{ -44, 119, -5, 10 },
+	{ -50, 113, -30, 3 },
+	{ -108, 66, 11, 11 },
+	{ -98, 77, -24, 2 },
+	{ 38, 11, -121, -35 },
+	{ 35, 58, -107, -24 },
+	{ 37, 56, -108, -25 },
+	{ 11, 84, -94, -14 },
+	{ 12, 73, -103, -18 },
+	{ 71, 82, -66, -13 },
+	{ 79, -13, -99, -37 },
+	{ 108, -63, -21, -27 },
+	{ 104, -66, 32, -12 },
+	{ -23, -115, 48, -2 },
+	{ -23, -75, 100, 19 },
+	{ 38, -83, 88, 8 },
+	{ -11, -125, 21, -12 },
+	{ -28, -93, 82, 12 },
+	{ -14, -125, 17, -13 },
+	{ 104, 67, 27, 7 },
+	{ 12, 114, -55, 1 },
+	{ 21, 124, -16, 13 },
+	{ 106, 64, 27, 6 },
+	{ 10, 94, 84, 37 },
+	{ 65, 36, 103, 27 },
+	{ 0, 91, 89, 39 },
+	{ -7, -118, -47, -30 },
+	{ -1, -82, -97, -39 },
+	{ 4, 25, -124, -31 },
+	{ 13, 21, -125, -32 },
+	{ 9, -54, -115, -41 },
+	{ 1, -118, -46, -31 },
+	{ 6, 114, -56, 1 },
+	{ -6, 127, -4, 19 },
+	{ -56, 112, 21, 30 },
+	{ -48, 110, -42, 11 },
+	{ -2, 109, -64, 0 },
+	{ -29, 78, -96, -10 },
+	{ -47, 108, -47, 10 },
+	{ -89, 31, 85, 39 },
+	{ -106, 55, 42, 33 },
+	{ -31, 84, 90, 42 },
+	{ -72, 81, 65, 39 },
+	{ -71, 5, 105, 38 },
+	{ -39, -15, 120, 36 },
+	{ -31, -75, 97, 19 },
+	{ -38, -74, 96, 20 },
+	{ -31, 54, 111, 43 },
+	{ -88, -1, 91, 36 },
+	{ -96, 40, 73, 38 },
+	{ -85, -12, 93, 34 },
+	{ -34, -84, 89, 16 },
+	{ -60, -55, 98, 26 },
+	{ -65, 98, 47, 36 },
+	{ 55, 8, -114, -36 },
+	{ 62, -36, -105, -41 },
+	{ 89, -71, -56, -37 },
+	{ 54, -101, -54, -37 },
+	{ 37, -116, 36, -12 },
+	{ 20, -124, 21, -15 },
+	{ -18, -96, 81, 10 },
+	{ -20, -96, 81, 10 },
+	{ 49, -117, -12, -27 },
+	{ 87, -27, -89, -39 },
+	{ 58, 34, -107, -31 },
+	{ -18, -29, -122, -36 },
+	{ -54, 54, -102, -14 },
+	{ -23, 68, -105, -16 },
+	{ -3, 71, -105, -18 },
+	{ 11, 71, -105, -20 },
+	{ 55, 96, -62, -9 },
+	{ 99, -3, -80, -33 },
+	{ 118, -44, 18, -14 },
+	{ 120, -39, 14, -14 },
+	{ -1, -114, 56, -1 },
+	{ -17, -81, 97, 17 },
+	{ 56, -69, 91, 10 },
+	{ 21, -122, 29, -12 },
+	{ 3, -109, 65, 2 },
+	{ 22, -125, 11, -17 },
+	{ 73, 103, -13, 4 },
+	{ -12, 112, -58, 2 },
+	{ -18, 123, -28, 13 },
+	{ 81, 96, 20, 12 },
+	{ -26, 122, 21, 27 },
+	{ 51, 52, 104, 32 },
+	{ -45, 92, 75, 40 },
+	{ 29, -124, 1, -21 },
+	{ 35, -101, -68, -38 },
+	{ 21, 18, -124, -34 },
+	{ 14, 35, -121, -30 },
+	{ 41, -78, -92, -41 },
+	{ 38, -119, -25, -28 },
+	{ -21, 106, -67, -1 },
+	{ -33, 116, -39, 10 },
+	{ -49, 114, -28, 15 },
+	{ -74, 103, 3, 25 },
+	{ -39, 103, -64, 2 },
+	{ -94, 37, -78, -5 },
+	{ -80, 90, -40, 12 },
+	{ -88, 84, 37, 33 },
+	{ -100, 56, -54, 5 },
+	{ -57, 107, 40, 33 },
+	{ -58, 72, 87, 42 },
+	{ -1, -47, 118, 26 },
+	{ -43, -24, 117, 34 },
+	{ -20, -77, 99, 19 },
+	{ -1, -55, 115, 24 },
+	{ -56, 52, 102, 43 },
+	{ 24, -50, 114, 22 },
+	{ -82, 70, 67, 39 },
+	{ -90, 5, 89, 37 },
+	{ 32, -76, 97, 12 },
+	{ 21, -40, 119, 25 },
+	{ -61, 102, 45, 35 },
+	{ -4, 32, -123, -29 },
+	{ 30, -50, -113, -42 },
+	{ 65, -109, 3, -23 },
+	{ 45, -119, 1, -22 },
+	{ 77, -101, 6, -22 },
+	{ 37, -111, 50, -7 },
+	{ 55, -73, 88, 7 },
+	{ 25, -93, 83, 7 },
+	{ 80, -97, 18, -18 },
+	{ 34, -71, -100, -42 },
+	{ -25, 12, -124, -29 },
+	{ -102, 75, -12, 22 },
+	{ -101, 41, 65, 36 },
+	{ -28, 124, -5, 22 },
+	{ 16, 121, -34, 9 },
+	{ 32, 96, -77, -9 },
+	{ 29, 94, -80, -10 },
+	{ 30, 26, -121, -32 },
+	{ 15, -37, -120, -40 },
+	{ -13, -97, -82, -36 },
+	{ -16, -119, -43, -29 },
+	{ -22, -119, 38, -6 },
+	{ 42, -83, 86, 6 },
+	{ 40, -114, -38, -33 },
+	{ 12, -114, -54, -34 },
+	{ 2, -124, -28, -28 },
+	{ 112, -44, -40, -30 },
+	{ 74, -18, 102, 17 },
+	{ -29, -21, 122, 33 },
+	{ -25, 25, 122, 40 },
+	{ 78, 3, 100, 19 },
+	{ 121, 26, -28, -16 },
+	{ 43, 25, -117, -32 },
+	{ 72, 10, -104, -35 },
+	{ 90, 14, -89, -32 },
+	{ 93, -47, -72, -38 },
+	{ 73, -51, -90, -41 },
+	{ 48, 77, -89, -17 },
+	{ 38, -52, -109, -42 },
+	{ 72, 100, -31, 0 },
+	{ 24, 118, -41, 5 },
+	{ 21, 125, -10, 15 },
+	{ 59, 100, 52, 24 },
+	{ -28, 52, 113, 42 },
+	{ -7, 127, 6, 23 },
+	{ -48, 86, 80, 41 },
+	{ -87, 31, 87, 39 },
+	{ -75, 78, 66, 39 },
+	{ -60, 34, 107, 41 },
+	{ -2, 122, -34, 11 },
+	{ -42, 118, -18, 19 },
+	{ 60, 68, -89, -20 },
+	{ -21, 93, -84, -5 },
+	{ -52, 115, -14, 21 },
+	{ -98, 66, 46, 35 },
+	{ -81, -54, 82, 23 },
+	{ -70, -74, 76, 17 },
+	{ -80, -31, 94, 30 },
+	{ -58, -49, 102, 27 },
+	{ -15, -126, 6, -17 },
+	{ -47, -103, 57, 5 },
+	{ -64, -74, 81, 17 },
+	{ -25, -113, 53, -1 },
+	{ -62, -97, 54, 7 },
+	{ 36, -121, -8, -26 },
+	{ 73, -99, -32, -33 },
+	{ 21, -124, 17, -18 },
+	{ -61, -22, 109, 33 },
+	{ -117, -8, 48, 26 },
+	{ 84, -30, -90, -39 },
+	{ 91, -1, 89, 37 },
+	{ 87, 83, 39, 36 },
+	{ 55, 113, 21, 31 },
+	{ -7, 113, -57, 1 },
+	{ -7, 71, -105, -19 },
+	{ -80, -13, -98, -39 },
+	{ 7, -119, -45, -29 },
+	{ -91, -82, 32, -15 },
+	{ -47, -84, 82, 4 },
+	{ 22, -57, 112, 25 },
+	{ 19, -26, 123, 33 },
+	{ -64, 41, 102, 27 },
+	{ 25, -109, 60, 3 },
+	{ 20, -115, 51, -1 },
+	{ 32, -75, 97, 20 },
+	{ 15, -125, 17, -12 },
+	{ 12, -125, 16, -13 },
+	{ -22, -122, 27, -14 },
+	{ -56, -103, -48, -37 },
+	{ 0, -118, -46, -31 },
+	{ -106, 65, 26, 4 },
+	{ -17, 125, -17, 12 },
+	{ -68, 81, -70, -15 },
+	{ -13, 123, -27, 10 },
+	{ -13, 111, 60, 32 },
+	{ 8, 127, -4, 20 },
+	{ 25, 87, 89, 42 },
+	{ -96, 78, 28, 7 },
+	{ -116, -49, -18, -27 },
+	{ 1, -82, -97, -39 },
+	{ -6, 25, -124, -31 },
+	{ -14, 21, -125, -33 },
+	{ -10, -54, -115, -41 },
+	{ -51, 18, -115, -36 },
+	{ -64, -37, -103, -43 },
+	{ -14, 85, -93, -14 },
+	{ -33, 64, -105, -23 },
+	{ -45, 47, -109, -29 },
+	{ 30, 106, -63, 4 },
+	{ 2, 109, -66, -1 },
+	{ 83, 95, 14, 31 },
+	{ 105, 63, 33, 34 },
+	{ 66, 99, 45, 37 },
+	{ 75, 66, 78, 42 },
+	{ 66, -8, 108, 38 },
+	{ 61, -54, 98, 27 },
+	{ 28, -88, 87, 14 },
+	{ -36, -121, 10, -21 },
+	{ -81, -92, -33, -35 },
+	{ -38, 12, -121, -36 },
+	{ -88, -36, -85, -41 },
+	{ -75, 5, -102, -38 },
+	{ -28, -116, 44, -10 },
+	{ 39, -78, 93, 19 },
+	{ 86, -8, 93, 37 },
+	{ 97, 58, 58, 39 },
+	{ 18, -97, 81, 10 },
+	{ 35, -73, 98, 21 },
+	{ 38, -14, 120, 36 },
+	{ 23, 96, 80, 40 },
+	{ 24, 73, -101, -13 },
+	{ 64, -18, 108, 37 },
+	{ 90, 83, 33, 34 },
+	{ 46, 109, -46, 10 },
+	{ 21, 106, -67, 0 },
+	{ -7, 67, -107, -21 },
+	{ -100, 6, -78, -33 },
+	{ -22, -125, -1, -21 },
+	{ -117, -47, 13, -18 },
+	{ -57, -68, 91, 8 },
+	{ 23, -66, 106, 23 },
+	{ 37, -23, 119, 35 },
+	{ -49, 60, 101, 31 },
+	{ -4, -109, 66, 2 },
+	{ -1, -113, 57, -1 },
+	{ 18, -81, 96, 18 },
+	{ -25, -124, 11, -18 },
+	{ -24, -123, 23, -15 },
+	{ -40, -113, 42, -10 },
+	{ -49, -111, -38, -33 },
+	{ -37, -119, -25, -29 },
+	{ -80, 98, -11, 2 },
+	{ 13, 123, -28, 13 },
+	{ -55, 97, -62, -10 },
+	{ 10, 112, -59, 2 },
+	{ 31, 121, 21, 28 },
+	{ 30, 114, -46, 8 },
+	{ 55, 108, 39, 35 },
+	{ -81, 96, 20, 10 },
+	{ -119, -41, 19, -16 },
+	{ -28, -106, -65, -37 },
+	{ -18, 32, -121, -31 },
+	{ -19, 17, -124, -34 },
+	{ -38, -80, -91, -42 },
+	{ 5, 31, -123, -29 },
+	{ -32, -50, -112, -43 },
+	{ 4, 80, -99, -15 },
+	{ 22, 70, -104, -15 },
+	{ 43, 57, -105, -15 },
+	{ 64, 86, -69, 3 },
+	{ 37, 99, -70, 0 },
+	{ 82, 88, -41, 13 },
+	{ 118, 46, -13, 20 },
+	{ 63, 107, 26, 32 },
+	{ 51, 51, 105, 44 },
+	{ 16, -24, 124, 33 },
+	{ -23, -41, 118, 24 },
+	{ -55, -77, 85, 5 },
+	{ -81, -97, 13, -22 },
+	{ -67, -107, -9, -27 },
+	{ -20, -61, -110, -42 },
+	{ -5, -36, -122, -39 },
+	{ 38, 32, -117, -22 },
+	{ -67, -92, 56, -7 },
+	{ -21, -71, 103, 15 },
+	{ -29, -49, 113, 20 },
+	{ 71, 52, 92, 43 },
+	{ -30, -100, 72, 1 },
+	{ -10, -73, 103, 17 },
+	{ 44, -24, 117, 35 },
+	{ 58, 89, 70, 41 },
+	{ 83, 33, -91, -8 },
+	{ -25, -125, 0, -23 },
+	{ 62, -96, 54, 8 },
+	{ 93, -28, 82, 31 },
+	{ 85, -7, 94, 36 },
+	{ 59, 34, 107, 43 },
+	{ 46, 86, 82, 42 },
+	{ 5, 127, 2, 22 },
+	{ -22, 122, -30, 9 },
+	{ -70, 101, -31, -1 },
+	{ -29, 94, -80, -10 },
+	{ -35, 96, -75, -9 },
+	{ -20, 118, -43, 5 },
+	{ -123, 13, -28, -21 },
+	{ -19, -23, -123, -39 },
+	{ -28, 25, -121, -32 },
+	{ -119, -13, -43, -29 },
+	{ -66, 84, 68, 24 },
+	{ -80, 19, 97, 19 },
+	{ -16, 125, -14, 14 },
+	{ 67, 95, 51, 39 },
+	{ 86, 32, 88, 41 },
+	{ 93, 74, 44, 37 },
+	{ 47, 117, -13, 22 },
+	{ 27, 124, -5, 23 },
+	{ 104, 35, 64, 38 },
+	{ 103, 74, -9, 25 },
+	{ 116, -12, 50, 28 },
+	{ 19, 57, 112, 42 },
+	{ 23, 25, 123, 41 },
+	{ 60, -22, 110, 35 },
+	{ 29, -21, 122, 34 },
+	{ -39, -81, 90, 7 },
+	{ 22, -125, -9, -19 },
+	{ 7, -100, -78, -36 },
+	{ -79, -85, -51, -37 },
+	{ 28, -120, 31, -7 },
+	{ 14, -126, 7, -16 },
+	{ -2, -124, -28, -28 },
+	{ -73, -19, 102, 15 },
+	{ 33, -64, 105, 23 },
+	{ 57, -55, 99, 26 },
+	{ 79, -43, 90, 29 },
+	{ 70, -73, 77, 19 },
+	{ 36, -106, 60, 4 },
+	{ 13, -124, 24, -11 },
+	{ -40, -120, 0, -25 },
+	{ -37, -117, -31, -32 },
+	{ -72, -51, -91, -43 },
+	{ -70, 18, -104, -35 },
+	{ -90, 16, -89, -34 },
+	{ -94, -30, -80, -39 },
+	{ -76, -95, -36, -36 },
+	{ -84, -34, -89, -41 },
+	{ 20, 92, -85, -4 },
+	{ 19, 119, -40, 11 },
+	{ -54, 75, -87, -19 },
+	{ -46, 81, -86, -16 },
+	{ -42, 39, -113, -30 },
+	{ -39, -43, -113, -42 },
+	{ -14, -114, -54, -35 },
+	{ -31, -122, -16, -28 },
+	{ -23, -29, 122, 32 },
+	{ -38, -23, 119, 34 },
+	{ -33, -59, 107, 24 },
+	{ 41, -116, -30, -31 },
+	{ 30, -122, -16, -27 },
+	{ 0, 91, 89, 39 },
+	{ 43, 101, 65, 39 },
+	{ -3, 121, -40, 9 },
+	{ -16, 5, -126, -35 },
+	{ 97, -24, -78, -12 },
+	{ 94, -75, -41, -15 },
+	{ 83, -68, 68, 14 },
+	{ 71, -17, 104, 34 },
+	{ 48, 29, 114, 45 },
+	{ 14, 61, 110, 46 },
+	{ 13, 93, 86, 47 },
+	{ -82, 87, 43, 22 },
+	{ -106, 4, -70, -31 },
+	{ -109, -51, 41, -13 },
+	{ -99, -49, -63, -40 },
+	{ -28, 51, -113, -22 },
+	{ -21, 113, -54, 9 },
+	{ -8, 126, 12, 32 },
+	{ -31, 122, 15, 29 },
+	{ -4, 97, 81, 45 },
+	{ 26, 42, 117, 45 },
+	{ 26, 32, 120, 44 },
+	{ 30, 0, 123, 38 },
+	{ 32, -49, 113, 24 },
+	{ -47, -99, 63, -11 },
+	{ -100, -65, 44, -15 },
+	{ 43, -6, 119, 37 },
+	{ 16, 71, 104, 47 },
+	{ 5, 58, 113, 45 },
+	{ -52, 80, 84, 34 },
+	{ -62, 110, 12, 21 },
+	{ -78, 86, -52, -4 },
+	{ -104, 53, -50, -16 },
+	{ -95, 82, 19, 11 },
+	{ -26, 103, 70, 40 },
+	{ -94, 74, 42, 15 },
+	{ -4, 47, 118, 42 },
+	{ 51, 26, 113, 44 },
+	{ 85, -7, 94, 36 },
+	{ 110, -7, 63, 32 },
+	{ 111, -42, 44, 18 },
+	{ 63, -67, 87, 17 },
+	{ 55, -114, 5, -17 },
+	{ 28, -123, 13, -21 },
+	{ 2, -87, -92, -45 },
+	{ -51, -114, -24, -39 },
+	{ -11, -45, -118, -44 },
+	{ -24, -1, -125, -37 },
+	{ -9, -61, -111, -45 },
+	{ 20, -101, -74, -41 },
+	{ -31, -12, -123, -40 },
+	{ -13, -55, -114, -45 },
+	{ -44, -13, -118, -41 },
+	{ -92, -70, -54, -42 },
+	{ 70, -106, -7, -17 },
+	{ 39, -66, -102, -37 },
+	{ 25, -93, -83, -40 },
+	{ 31, -89, 85, 7 },
+	{ -6, -40, -120, -43 },
+	{ -43, -15, -118, -41 },
+	{ -77, 15, -100, -34 },
+	{ -87, 46, -81, -23 },
+	{ -4, 18, -126, -30 },
+	{ 102, 3, -76, -6 },
+	{ 110, -35, -53, -8 },
+	{ 107, -60, 33, 9 },
+	{ 90, -27, 86, 29 },
+	{ 51, 15, 115, 42 },
+	{ 26, 53, 113, 48 },
+	{ -21, 99, 77, 43 },
+	{ -105, 42, 59, 14 },
+	{ -119, -38, -24, -29 },
+	{ -85, -70, 63, -9 },
+	{ -105, -68, -21, -34 },
+	{ -64, 41, -102, -26 },
+	{ -76, 94, -39, 3 },
+	{ -63, 110, 6, 20 },
+	{ -62, 108, 24, 25 },
+	{ -27, 97, 77, 42 },
+	{ 26, 51, 113, 47 },
+	{ 68, -10, 107, 36 },
+	{ 67, -17, 107, 34 },
+	{ 81, -67, 72, 14 },
+	{ -13, -106, 69, -7 },
+	{ -90, -66, 60, -9 },
+	{ 82, -48, 84, 22 },
+	{ 0, 53, 115, 45 },
+	{ -26, 44, 116, 40 },
+	{ -83, 51, 82, 24 },
+	{ -83, 90, 35, 21 },
+	{ -99, 75, -26, -1 },
+	{ -119, 39, -20, -11 },
+	{ -111, 50, 35, 8 },
+	{ -49, 83, 82, 37 },
+	{ -112, 42, 42, 7 },
+	{ -20, 34, 121, 39 },
+	{ 52, 26, 113, 45 },
+	{ 106, -1, 70, 33 },
+	{ 121, 6, 39, 29 },
+	{ 125, -21, 5, 13 },
+	{ 88, -71, 57, 10 },
+	{ 84, -94, -12, -15 },
+	{ 64, -109, -7, -20 },
+	{ 25, -87, -89, -42 },
+	{ -26, -124, -3, -33 },
+	{ -14, -41, -120, -44 },
+	{ -42, 2, -120, -38 },
+	{ -25, -39, -118, -45 },
+	{ 25, -72, -102, -42 },
+	{ -49, -13, -117, -41 },
+	{ -2, -45, -119, -44 },
+	{ -50, -8, -116, -40 },
+	{ -104, -70, -16, -33 },
+	{ 94, -77, -36, -16 },
+	{ 72, -34, -99, -26 },
+	{ 53, -71, -91, -35 },
+	{ 76, -84, 57, 6 },
+	{ 15, -21, -124, -37 },
+	{ -46, 2, -118, -38 },
+	{ -98, 22, -78, -28 },
+	{ -98, 35, -73, -24 },
+	{ -48, 36, -112, -28 },
+	{ -45, -11, -118, -40 },
+	{ -16, -71, -104, -45 },
+	{ -2, -69, -107, -44 },
+	{ 0, -70, -106, -43 },
+	{ -105, -71, -1, -29 },
+	{ -104, -10, 72, 4 },
+	{ 12, 105, 71, 44 },
+	{ -104, -11, 72, 4 },
+	{ -103, -74, 8, -27 },
+	{ -69, -99, 39, -20 },
+	{ 14, -124, -21, -31 },
+	{ 5, -106, -70, -41 },
+	{ 13, 39, 120, 43 },
+	{ 22, -38, 119, 27 },
+	{ -65, -26, 106, 15 },
+	{ 12, 73, 103, 46 },
+	{ 15, 80, 97, 46 },
+	{ 32, 39, 116, 44 },
+	{ -1, 108, 67, 42 },
+	{ -54, 113, 23, 24 },
+	{ -20, 125, 9, 27 },
+	{ -36, 110, -53, 6 },
+	{ -78, 94, -35, 1 },
+	{ -22, 106, 67, 38 },
+	{ -79, 96, 26, 17 },
+	{ -43, 92, 76, 35 },
+	{ 11, 126, 8, 32 },
+	{ -78, 100, -9, 10 },
+	{ -117, -30, -40, -32 },
+	{ -1, 76, -102, -10 },
+	{ 2, 106, -69, 5 },
+	{ -2, -10, -127, -36 },
+	{ -24, -11, -124, -38 },
+	{ -38, 64, -103, -18 },
+	{ -56, -16, -113, -41 },
+	{ -83, 38, -89, -26 },
+	{ -95, 77, -35, -5 },
+	{ -85, 93, -11, 6 },
+	{ -80, 48, -86, -23 },
+	{ 20, -102, -73, -39 },
+	{ 43, -117, -22, -26 },
+	{ 61, -100, 49, 0 },
+	{ 82, -91, 31, 0 },
+	{ 83, -85, -45, -18 },
+	{ 47, -81, -86, -34 },
+	{ 3, -58, -113, -42 },
+	{ 21, -101, -74, -39 },
+	{ 111, -56, -27, -3 },
+	{ 50, -37, -110, -29 },
+	{ 56, -110, -29, -24 },
+	{ 103, -74, 10, 1 },
+	{ 99, -26, 75, 29 },
+	{ 51, 37, 110, 45 },
+	{ 83, -31, 91, 29 },
+	{ 47, 44, 110, 46 },
+	{ 55, -33, 109, 30 },
+	{ 82, 2, 97, 38 },
+	{ -38, 85, 86, 36 },
+	{ -27, 30, 120, 43 },
+	{ -86, -5, 93, 34 },
+	{ -71, -19, 103, 32 },
+	{ -31, 19, 122, 41 },
+	{ -21, 65, 107, 47 },
+	{ -14, 93, 86, 47 },
+	{ 6, 126, 18, 34 },
+	{ 21, 113, -54, 9 },
+	{ 29, 59, -109, -19 },
+	{ 98, -53, -62, -39 },
+	{ 111, -47, 41, -10 },
+	{ 114, 55, 5, 3 },
+	{ 103, 28, -69, -23 },
+	{ 7, -60, -112, -45 },
+	{ 93, -67, -55, -40 },
+	{ 23, -7, -125, -38 },
+	{ 46, 48, -108, -23 },
+	{ 64, 25, -107, -30 },
+	{ 44, -13, -118, -40 },
+	{ 33, -7, -123, -38 },
+	{ 48, 103, -56, 4 },
+	{ 78, 79, -62, -7 },
+	{ 33, 122, 8, 27 },
+	{ 59, 111, 19, 24 },
+	{ -10, 68, 107, 46 },
+	{ 17, 97, 81, 43 },
+	{ 51, 81, 84, 36 },
+	{ 97, 79, 19, 12 },
+	{ 84, 44, -84, -22 },
+	{ 103, 54, -51, -13 },
+	{ 80, 69, 70, 26 },
+	{ -15, 70, 105, 47 },
+	{ -47, 29, 114, 44 },
+	{ -56, 21, 112, 42 },
+	{ -2, 57, 113, 45 },
+	{ 12, 108, 66, 42 },
+	{ -25, 31, 121, 43 },
+	{ -28, -20, 122, 32 },
+	{ 95, -71, 46, -13 },
+	{ 30, -106, 64, -9 },
+	{ -31, -90, 84, 6 },
+	{ -64, -81, 74, 9 },
+	{ -51, -32, 112, 29 },
+	{ -83, -78, 56, 7 },
+	{ -109, -46, 46, 15 },
+	{ -52, -116, -4, -22 },
+	{ -55, -109, -37, -29 },
+	{ -27, -124, 5, -24 },
+	{ 61, -107, -32, -39 },
+	{ -6, -83, -96, -45 },
+	{ -118, -11, 45, 24 },
+	{ -103, -26, -70, -12 },
+	{ -24, -10, -124, -32 },
+	{ -19, -53, -114, -41 },
+	{ -39, -66, -102, -38 },
+	{ -98, -70, -41, -16 },
+	{ -9, -82, -97, -44 },
+	{ 14, -55, -114, -45 },
+	{ -16, -98, -80, -42 },
+	{ 13, -55, -114, -45 },
+	{ 45, -16, -118, -41 },
+	{ -12, 27, 124, 42 },
+	{ -106, 0, 69, 31 },
+	{ -92, -31, 82, 25 },
+	{ -52, 16, 115, 41 },
+	{ -25, 52, 113, 47 },
+	{ 23, 100, 75, 43 },
+	{ 65, 109, 8, 22 },
+	{ 76, 91, -45, 2 },
+	{ 63, 38, -104, -26 },
+	{ 101, -75, -20, -33 },
+	{ 88, -67, 62, -6 },
+	{ 121, 8, 39, 2 },
+	{ 124, -11, -25, -21 },
+	{ 15, -41, -119, -44 },
+	{ 105, -70, -16, -31 },
+	{ 39, -4, -121, -38 },
+	{ 80, 45, -88, -21 },
+	{ 88, 37, -84, -23 },
+	{ 52, -6, -116, -39 },
+	{ 52, -9, -116, -39 },
+	{ 82, 92, -32, 5 },
+	{ 99, 74, -28, 0 },
+	{ 62, 108, 25, 27 },
+	{ 88, 88, 23, 19 },
+	{ -12, 68, 107, 47 },
+	{ 60, 86, 71, 35 },
+	{ 81, 53, 82, 27 },
+	{ 112, 48, 34, 9 },
+	{ 109, 36, -55, -18 },
+	{ 119, 41, -19, -8 },
+	{ 102, 39, 64, 16 },
+	{ -1, 55, 114, 45 },
+	{ -47, 18, 116, 42 },
+	{ -32, 34, 118, 45 },
+	{ 1, 38, 121, 43 },
+	{ 26, 98, 77, 43 },
+	{ -65, -12, 109, 34 },
+	{ -78, -52, 86, 19 },
+	{ 77, -79, 63, -8 },
+	{ -20, -110, 59, -7 },
+	{ -77, -83, 57, 4 },
+	{ -89, -80, 41, 2 },
+	{ -79, -40, 91, 24 },
+	{ -107, -66, 19, 1 },
+	{ -125, -22, 6, 10 },
+	{ -79, -96, -29, -23 },
+	{ -91, -78, -42, -21 },
+	{ -65, -109, -6, -21 },
+	{ 48, -117, -7, -34 },
+	{ -24, -89, -87, -43 },
+	{ -123, 6, 30, 24 },
+	{ -103, 3, -75, -8 },
+	{ 4, 18, -126, -30 },
+	{ -17, -18, -125, -36 },
+	{ -28, -28, -121, -37 },
+	{ -111, -30, -53, -10 },
+	{ -53, -71, -91, -36 },
+	{ 0, -46, -118, -43 },
+	{ -43, -83, -87, -39 },
+	{ 23, -38, -119, -44 },
+	{ 48, -1, -118, -37 },
+	{ -102, -15, 74, 29 },
+	{ -105, -71, 9, 0 },
+	{ -85, -41, 85, 24 },
+	{ -58, -50, 102, 23 },
+	{ -20, -37, 120, 27 },
+	{ 56, -31, 109, 17 },
+	{ 99, -15, 79, 8 },
+	{ -11, 79, 99, 45 },
+	{ -12, 111, 61, 42 },
+	{ 113, 56, -17, -3 },
+	{ -2, 113, -57, 10 },
+	{ -10, 127, -2, 29 },
+	{ 112, -1, -60, -27 },
+	{ 102, -76, 3, -26 },
+	{ 104, -10, 72, 7 },
+	{ -12, 87, 92, 45 },
+	{ 0, 108, 66, 42 },
+	{ 54, 112, 23, 25 },
+	{ 21, 125, 9, 28 },
+	{ 20, 105, 69, 39 },
+	{ -9, 86, 93, 45 },
+	{ -51, 37, 110, 44 },
+	{ -50, 36, 111, 44 },
+	{ 2, 75, 102, 44 },
+	{ -13, 30, 123, 41 },
+	{ -33, 36, 117, 43 },
+	{ 101, -76, 4, -26 },
+	{ -16, -124, -23, -31 },
+	{ -21, -111, 58, -6 },
+	{ 66, -105, 26, -22 },
+	{ -59, -106, 39, -6 },
+	{ -20, -102, -73, -39 },
+	{ -18, -99, -77, -40 },
+	{ -51, -111, -35, -28 },
+	{ -42, -117, -24, -27 },
+	{ 1, -68, -107, -43 },
+	{ 4, -66, -109, -44 },
+	{ -6, -106, -70, -41 },
+	{ -79, -97, 21, -6 },
+	{ -99, -27, 75, 26 },
+	{ -109, -56, -33, -7 },
+	{ -80, -88, -44, -21 },
+	{ -49, -79, -86, -34 },
+	{ -3, -58, -113, -42 },
+	{ -55, -41, -107, -30 },
+	{ 32, -23, -121, -41 },
+	{ 16, -71, -104, -45 },
+	{ 56, -16, -113, -40 },
+	{ 79, 42, -90, -24 },
+	{ 39, 71, -98, -14 },
+	{ 0, 76, -101, -10 },
+	{ 27, -1, -124, -36 },
+	{ 2, 0, -127, -34 },
+	{ 35, 115, -42, 11 },
+	{ 80, 90, -41, 0 },
+	{ 95, 76, -36, -4 },
+	{ 84, 38, -87, -24 },
+	{ 44, 33, -114, -27 },
+	{ 85, 94, -2, 11 },
+	{ 78, 97, 27, 20 },
+	{ 28, 85, 90, 40 },
+	{ 23, 75, 100, 40 },
+	{ -68, 35, -102, -29 },
+	{ -46, 47, -108, -25 },
+	{ -49, 101, -60, 1 },
+	{ -87, 37, -85, -25 },
+	{ -72, 27, -101, -30 },
+	{ -83, 86, -44, -2 },
+	{ -3, 75, 103, 44 },
+	{ 9, 86, 93, 45 },
+	{ 22, -104, 70, -1 },
+	{ 78, 15, -99, -32 },
+	{ 96, 23, -79, -26 },
+	{ -41, -56, 106, 14 },
+	{ -34, -2, 122, 20 },
+	{ -30, 27, 120, 23 },
+	{ -23, 48, 115, 24 },
+	{ -30, 29, 120, 22 },
+	{ -22, 6, 125, 19 },
+	{ -9, -23, 125, 13 },
+	{ -22, -73, 102, -3 },
+	{ -124, -24, -14, -2 },
+	{ -126, -14, 7, 2 },
+	{ -124, -14, 21, 4 },
+	{ -124, -13, 23, 5 },
+	{ -123, -14, 28, 5 },
+	{ -122, -16, 32, 5 },
+	{ -119, -16, 40, 6 },
+	{ -123, 13, 31, 12 },
+	{ -104, -58, -44, -7 },
+	{ -107, -35, -59, -7 },
+	{ -103, -25, -70, -8 },
+	{ -98, -30, -74, -9 },
+	{ -90, -24, -87, -10 },
+	{ -85, -2, -94, -7 },
+	{ -81, 39, -90, 3 },
+	{ -72, 88, -57, 20 },
+	{ -83, -43, -86, -10 },
+	{ -71, -17, -104, -11 },
+	{ -55, -10, -114, -11 },
+	{ -47, -19, -117, -12 },
+	{ -27, -15, -123, -13 },
+	{ -3, 13, -126, -8 },
+	{ -5, 45, -119, 0 },
+	{ 1, 72, -105, 9 },
+	{ -76, -15, -101, -11 },
+	{ -65, -1, -109, -11 },
+	{ -7, 1, -127, -11 },
+	{ -10, -4, -127, -11 },
+	{ 34, -9, -122, -11 },
+	{ 34, 5, -122, -8 },
+	{ 40, 22, -119, -4 },
+	{ 47, 34, -113, 0 },
+	{ -45, 25, -116, -9 },
+	{ -33, 36, -117, -9 },
+	{ -9, 23, -125, -9 },
+	{ 58, 3, -113, -7 },
+	{ 69, -11, -106, -7 },
+	{ 56, -12, -113, -9 },
+	{ 62, 4, -111, -5 },
+	{ 71, 19, -103, -1 },
+	{ 45, 60, -103, -2 },
+	{ 69, 77, -73, 2 },
+	{ 84, 51, -81, 1 },
+	{ 85, 13, -93, -2 },
+	{ 95, -14, -83, -3 },
+	{ 72, -12, -104, -6 },
+	{ 85, 4, -94, -1 },
+	{ 106, 44, -55, 6 },
+	{ 107, 64, -22, 8 },
+	{ 111, 55, -27, 8 },
+	{ 113, 20, -54, 4 },
+	{ 114, -2, -56, 2 },
+	{ 82, -31, -92, -7 },
+	{ 95, -7, -84, -1 },
+	{ 125, 18, -14, 11 },
+	{ 119, 43, 8, 12 },
+	{ 119, 44, 3, 11 },
+	{ 125, 14, -17, 9 },
+	{ 124, 0, -29, 7 },
+	{ 93, -49, -71, -5 },
+	{ 107, -29, -63, 1 },
+	{ 74, -62, 82, 24 },
+	{ 81, -39, 90, 24 },
+	{ 62, -33, 106, 25 },
+	{ 58, -34, 108, 25 },
+	{ 64, -36, 104, 25 },
+	{ 80, -57, 81, 21 },
+	{ 76, -41, 93, 24 },
+	{ -117, -45, -20, -11 },
+	{ -118, -45, -13, -10 },
+	{ -122, -36, 3, -9 },
+	{ -124, -7, 27, -5 },
+	{ -106, 39, 57, 2 },
+	{ -86, 51, 79, 9 },
+	{ -77, 55, 85, 12 },
+	{ -109, -66, -4, -9 },
+	{ -111, -61, 2, -8 },
+	{ -116, -49, 16, -7 },
+	{ -118, -16, 45, -3 },
+	{ -94, 26, 81, 6 },
+	{ -76, 33, 96, 10 },
+	{ -61, 35, 106, 14 },
+	{ -81, -91, 35, -4 },
+	{ -90, -80, 40, -4 },
+	{ -104, -58, 44, -4 },
+	{ -103, -20, 71, 1 },
+	{ -76, 15, 100, 8 },
+	{ -61, 16, 110, 11 },
+	{ -52, 20, 114, 13 },
+	{ -2, -99, 80, 4 },
+	{ -32, -82, 91, 3 },
+	{ -7, -56, 114, 8 },
+	{ -81, -17, 97, 5 },
+	{ -48, 2, 117, 10 },
+	{ -56, -7, 114, 8 },
+	{ -40, 2, 120, 12 },
+	{ -31, 9, 123, 14 },
+	{ 74, -63, 82, 8 },
+	{ 76, -32, 96, 10 },
+	{ 55, -25, 111, 11 },
+	{ -32, -14, 122, 10 },
+	{ -42, -6, 120, 10 },
+	{ -46, -12, 118, 9 },
+	{ -18, -5, 126, 13 },
+	{ -6, 2, 127, 15 },
+	{ 93, -42, 76, 9 },
+	{ 102, -10, 75, 10 },
+	{ 106, -7, 70, 10 },
+	{ 93, -21, 84, 10 },
+	{ 61, -29, 107, 10 },
+	{ -13, -20, 125, 10 },
+	{ -6, -13, 126, 12 },
+	{ 57, -20, 111, 12 },
+	{ 115, -28, 47, 6 },
+	{ 120, -8, 40, 6 },
+	{ 122, -3, 34, 6 },
+	{ 122, -15, 32, 5 },
+	{ 118, -25, 39, 4 },
+	{ 110, -36, 52, 4 },
+	{ 103, -37, 64, 5 },
+	{ 123, -11, 31, 8 },
+	{ 119, -27, 33, 5 },
+	{ 121, -13, 36, 6 },
+	{ 119, -6, 43, 7 },
+	{ 116, -7, 50, 8 },
+	{ 104, -12, 72, 10 },
+	{ 86, -25, 90, 10 },
+	{ 80, -46, 88, 5 },
+	{ 116, -20, 48, 8 },
+	{ 111, 57, 22, 26 },
+	{ 110, 59, 23, 27 },
+	{ 115, 54, 5, 24 },
+	{ 102, 37, -66, 10 },
+	{ 91, 58, -68, 14 },
+	{ 45, 95, -71, 22 },
+	{ -6, 126, 11, 40 },
+	{ 0, 86, 94, 40 },
+	{ 26, -72, -102, -2 },
+	{ -18, -61, -110, -8 },
+	{ -39, -33, -116, -10 },
+	{ -66, -56, -93, -10 },
+	{ -63, -71, -85, -10 },
+	{ -47, -109, -44, -7 },
+	{ -56, -114, -2, -3 },
+	{ -33, -108, 57, 5 },
+	{ 127, 4, 3, 13 },
+	{ -118, -34, -33, -13 },
+	{ 31, -85, -90, 0 },
+	{ 123, 26, 20, 14 },
+	{ -119, -35, -26, -12 },
+	{ 122, 28, 19, 14 },
+	{ -123, -28, -10, -11 },
+	{ 127, 7, 2, 12 },
+	{ -126, -1, 15, -7 },
+	{ 126, -10, -7, 10 },
+	{ -110, 45, 44, 0 },
+	{ 103, -64, -39, 0 },
+	{ -98, 61, 54, 5 },
+	{ 114, -39, -41, 4 },
+	{ 114, 56, 4, 24 },
+	{ -90, 66, 61, 8 },
+	{ 127, 3, 9, 14 },
+	{ -120, -41, -14, -10 },
+	{ 40, -95, -75, 3 },
+	{ 123, 14, 30, 16 },
+	{ -121, -36, -9, -10 },
+	{ 121, 16, 34, 16 },
+	{ -123, -31, 7, -8 },
+	{ 124, -5, 26, 15 },
+	{ -124, -4, 28, -5 },
+	{ 126, -14, -1, 11 },
+	{ -113, 38, 45, 0 },
+	{ 104, -73, -9, 5 },
+	{ -92, 64, 60, 7 },
+	{ 116, -49, -17, 7 },
+	{ 114, 55, 6, 24 },
+	{ -91, 68, 56, 7 },
+	{ 68, -28, -104, -9 },
+	{ 70, -56, -90, -11 },
+	{ 73, -77, -71, -10 },
+	{ 85, -84, -42, -5 },
+	{ 94, -81, -27, -1 },
+	{ 65, -63, 89, 20 },
+	{ -108, 55, 37, 0 },
+	{ -112, 44, 40, -1 },
+	{ -109, 31, 57, 1 },
+	{ -102, 18, 74, 3 },
+	{ -82, 4, 97, 6 },
+	{ -1, -78, -100, -20 },
+	{ 113, 39, 42, 18 },
+	{ 6, -88, -91, -20 },
+	{ 21, -121, -31, -12 },
+	{ 12, -105, -70, -18 },
+	{ 10, -118, -46, -15 },
+	{ 100, 74, 27, 17 },
+	{ 95, 78, 33, 18 },
+	{ 99, 73, 32, 18 },
+	{ 109, 54, 37, 18 },
+	{ 42, 42, 113, 27 },
+	{ 35, 58, 107, 29 },
+	{ 35, 71, 99, 30 },
+	{ 30, 90, 84, 30 },
+	{ 18, 112, 56, 27 },
+	{ 14, 121, 36, 24 },
+	{ -31, 19, 122, 22 },
+	{ -37, 22, 119, 21 },
+	{ -35, 18, 121, 22 },
+	{ -120, -41, 12, -12 },
+	{ -112, -59, -3, -16 },
+	{ -112, -59, -1, -15 },
+	{ -103, -71, -19, -18 },
+	{ -50, -88, -77, -23 },
+	{ 66, 51, 96, 22 },
+	{ 5, 69, 106, 20 },
+	{ -17, 97, 80, 17 },
+	{ -31, 109, 56, 12 },
+	{ -32, 115, 44, 10 },
+	{ -71, -2, 106, 14 },
+	{ -81, -28, 94, 11 },
+	{ -82, -54, 81, 9 },
+	{ -68, -73, 79, 11 },
+	{ -52, -89, 75, 13 },
+	{ -63, -83, -73, -8 },
+	{ -62, -77, -79, -9 },
+	{ -63, -73, -82, -10 },
+	{ -74, -73, -73, -10 },
+	{ -85, -82, -46, -9 },
+	{ -47, -118, 0, -4 },
+	{ 44, -111, 44, 3 },
+	{ 59, -99, 53, 5 },
+	{ 61, -102, 46, 4 },
+	{ 52, -99, 60, 6 },
+	{ 39, -46, 112, 15 },
+	{ 72, -5, 105, 17 },
+	{ 70, 13, 105, 18 },
+	{ 51, 24, 114, 21 },
+	{ 14, 28, 123, 22 },
+	{ 3, 12, 126, 20 },
+	{ -2, -21, 125, 13 },
+	{ -6, -58, 113, 3 },
+	{ 29, 78, 96, 39 },
+	{ 57, 110, 29, 39 },
+	{ 107, 67, -9, 25 },
+	{ 93, 40, 77, 26 },
+	{ -88, 84, -38, 29 },
+	{ -20, -95, -82, -47 },
+	{ -1, -79, -99, -50 },
+	{ -86, -11, -93, -16 },
+	{ -88, -8, -91, -14 },
+	{ -29, -108, -61, -45 },
+	{ -91, -23, -85, -17 },
+	{ -53, -106, -45, -39 },
+	{ -89, -54, -72, -24 },
+	{ -72, -105, 2, -27 },
+	{ -101, -70, -32, -20 },
+	{ -80, -96, 24, -20 },
+	{ -112, -59, -11, -12 },
+	{ -59, -100, 52, -18 },
+	{ -116, -50, 15, -5 },
+	{ -33, -93, 80, -13 },
+	{ -35, -90, 82, -12 },
+	{ -119, -44, 3, -5 },
+	{ -73, -84, -61, -28 },
+	{ 25, -113, 52, -26 },
+	{ -2, -105, 72, -19 },
+	{ 51, -116, -1, -35 },
+	{ 35, -112, 49, -26 },
+	{ 38, -120, -16, -38 },
+	{ 31, -119, 32, -31 },
+	{ 1, -35, -122, -27 },
+	{ 28, -99, -75, -40 },
+	{ 34, -63, -105, -34 },
+	{ 70, -95, -48, -36 },
+	{ -2, -106, 70, -20 },
+	{ 33, -105, 63, -22 },
+	{ 44, -102, -62, -39 },
+	{ 60, -111, -15, -36 },
+	{ -71, 18, -104, -5 },
+	{ -38, -7, -121, -17 },
+	{ -88, 42, -81, 6 },
+	{ -32, 74, -98, 10 },
+	{ -14, 87, -91, 15 },
+	{ -12, 96, -82, 19 },
+	{ 21, 111, -57, 28 },
+	{ -3, 106, -70, 24 },
+	{ -24, 36, -119, -5 },
+	{ -1, -3, -127, -18 },
+	{ -18, 51, -115, 0 },
+	{ -11, 8, -126, -14 },
+	{ -41, 90, -80, 19 },
+	{ -93, 48, -72, 10 },
+	{ -91, 60, -65, 15 },
+	{ -5, -116, 51, -26 },
+	{ -2, -123, 32, -31 },
+	{ 14, -126, 6, -39 },
+	{ 39, -121, 1, -41 },
+	{ 71, -104, 16, -36 },
+	{ 100, -78, -3, -37 },
+	{ 74, 32, 98, 31 },
+	{ 56, 62, 96, 42 },
+	{ 39, 65, 102, 47 },
+	{ 90, 21, 87, 22 },
+	{ -41, -86, -84, -49 },
+	{ -93, -41, -75, -25 },
+	{ -101, -48, -61, -22 },
+	{ -77, -91, -44, -34 },
+	{ 22, -125, 3, -41 },
+	{ 61, -110, -14, -46 },
+	{ 9, -127, 6, -39 },
+	{ 8, -126, 14, -37 },
+	{ 13, -126, 11, -38 },
+	{ 25, -122, 23, -34 },
+	{ 4, -125, 19, -36 },
+	{ 27, -112, 53, -26 },
+	{ -86, 77, -54, 22 },
+	{ -58, 106, -40, 34 },
+	{ -14, 123, -30, 39 },
+	{ 31, 121, -26, 39 },
+	{ 34, 121, -20, 40 },
+	{ 42, 119, -13, 42 },
+	{ 62, 110, -10, 41 },
+	{ 84, 95, 2, 41 },
+	{ 59, 111, 20, 50 },
+	{ 13, 119, -44, 34 },
+	{ 12, 119, -43, 34 },
+	{ 40, 120, 14, 50 },
+	{ 40, 120, 15, 50 },
+	{ 41, 78, 92, 63 },
+	{ 44, 107, 53, 59 },
+	{ -106, -38, 59, 5 },
+	{ -91, 28, 84, 38 },
+	{ -118, 31, -34, -7 },
+	{ -117, 41, -29, -1 },
+	{ 119, 45, 1, 15 },
+	{ 116, -35, -37, -27 },
+	{ 93, 40, 76, 41 },
+	{ 93, -25, 83, 21 },
+	{ 41, 101, 66, 62 },
+	{ 42, 113, 39, 56 },
+	{ -6, 112, -60, 28 },
+	{ 33, 115, -42, 33 },
+	{ -26, 124, -8, 47 },
+	{ -71, 103, -23, 38 },
+	{ -62, 102, 43, 59 },
+	{ -50, 116, 18, 54 },
+	{ -102, 75, 8, 41 },
+	{ -93, 86, -5, 39 },
+	{ -72, 61, 85, 64 },
+	{ -69, 81, 69, 63 },
+	{ -107, 60, 33, 46 },
+	{ -108, 64, 21, 43 },
+	{ 0, -127, 2, -30 },
+	{ -63, -73, 83, 27 },
+	{ -31, -122, 14, -20 },
+	{ -97, -75, 31, 9 },
+	{ 14, -63, -109, -50 },
+	{ 23, -47, -116, -49 },
+	{ -68, 7, -107, -18 },
+	{ -75, -7, -103, -19 },
+	{ 108, -66, -9, -36 },
+	{ 110, -62, -11, -36 },
+	{ 87, 20, 90, 23 },
+	{ 20, 63, 109, 51 },
+	{ 4, 51, 116, 53 },
+	{ 90, 8, 89, 19 },
+	{ -114, 54, 12, 37 },
+	{ -110, 63, 8, 38 },
+	{ -5, -126, 17, -24 },
+	{ -80, -95, 27, -1 },
+	{ -101, 76, -1, 38 },
+	{ -92, 86, -16, 35 },
+	{ -65, -106, -27, -46 },
+	{ -92, -72, -50, -46 },
+	{ -67, -104, -30, -47 },
+	{ -91, -66, -60, -47 },
+	{ -64, -110, 4, -36 },
+	{ -76, -57, -84, -53 },
+	{ -52, -69, -93, -59 },
+	{ -47, -60, -102, -60 },
+	{ 9, -127, 4, -28 },
+	{ 70, -80, 70, 15 },
+	{ 21, -123, 22, -19 },
+	{ 35, -119, 28, -14 },
+	{ 93, 7, -86, -10 },
+	{ 87, 35, -86, -3 },
+	{ 25, -29, -121, -39 },
+	{ 23, -31, -121, -40 },
+	{ 104, 65, 33, 43 },
+	{ 96, 81, 19, 43 },
+	{ 86, 67, 65, 53 },
+	{ 78, 94, 34, 50 },
+	{ 112, 38, 46, 41 },
+	{ 106, 58, 38, 43 },
+	{ 85, 31, 89, 52 },
+	{ 84, 52, 79, 53 },
+	{ 50, 46, 107, 61 },
+	{ 41, 62, 103, 63 },
+	{ 19, -124, 18, -21 },
+	{ 39, -102, 65, 5 },
+	{ 98, -1, -80, -9 },
+	{ 30, -40, -117, -40 },
+	{ 61, -84, -73, -37 },
+	{ 105, -9, -71, -8 },
+	{ -92, -75, -45, -45 },
+	{ -97, -66, -49, -45 },
+	{ -89, -58, -70, -49 },
+	{ -85, -54, -77, -50 },
+	{ -29, -123, -10, -44 },
+	{ -5, -126, -15, -46 },
+	{ 9, -126, 15, -36 },
+	{ 13, -126, 2, -41 },
+	{ 38, -116, -35, -53 },
+	{ 60, -93, -62, -59 },
+	{ 66, -82, -70, -59 },
+	{ 7, -97, -81, -65 },
+	{ 12, -89, -90, -66 },
+	{ 119, 43, 4, 15 },
+	{ 117, 48, 13, 21 },
+	{ 121, -6, -39, -19 },
+	{ 110, -27, -58, -33 },
+	{ -5, 60, 112, 72 },
+	{ 11, 91, 88, 69 },
+	{ 10, -125, 22, -21 },
+	{ 8, -87, 93, 23 },
+	{ 34, -122, 11, -37 },
+	{ 23, -109, -61, -60 },
+	{ 6, -127, 8, -39 },
+	{ 9, -127, -2, -41 },
+	{ 11, -126, 5, -40 },
+	{ -6, -126, 12, -38 },
+	{ 11, -126, 13, -38 },
+	{ -11, -118, 45, -29 },
+	{ 10, -119, 44, -29 },
+	{ 20, -118, 43, -29 },
+	{ 8, -115, 53, -26 },
+	{ -14, -113, 55, -26 },
+	{ -26, -110, 58, -24 },
+	{ -50, -117, -2, -36 },
+	{ -35, -112, 50, -26 },
+	{ -26, -124, 2, -37 },
+	{ -21, -118, 42, -29 },
+	{ 2, -127, -6, -38 },
+	{ 7, -121, 38, -30 },
+	{ 22, -114, 52, -26 },
+	{ -11, -125, 23, -35 },
+	{ -7, -122, 35, -32 },
+	{ 28, -122, 23, -32 },
+	{ 90, -81, -39, -24 },
+	{ 98, -13, -80, -8 },
+	{ 101, -77, 5, -14 },
+	{ 114, -39, -39, -8 },
+	{ 39, -107, 56, -20 },
+	{ -33, -122, -8, -44 },
+	{ -20, -122, -31, -47 },
+	{ -6, -107, 67, -21 },
+	{ -2, -113, 58, -24 },
+	{ -28, -123, -9, -44 },
+	{ -59, -110, -21, -45 },
+	{ -16, 18, 125, 37 },
+	{ -40, -25, 118, 19 },
+	{ -82, -29, 92, 6 },
+	{ 13, 20, 125, 42 },
+	{ 0, -13, 126, 31 },
+	{ -62, -35, 105, 10 },
+	{ -68, -28, 104, 11 },
+	{ 4, -25, 124, 28 },
+	{ 113, 55, 17, 37 },
+	{ 111, 60, 16, 38 },
+	{ -48, 12, -117, -29 },
+	{ -27, -14, -123, -34 },
+	{ 72, 41, -96, 2 },
+	{ 70, 57, -89, 7 },
+	{ -115, -51, -20, -35 },
+	{ -120, -33, -23, -32 },
+	{ -8, 44, -119, -15 },
+	{ -42, 27, -117, -24 },
+	{ 61, 58, -95, 5 },
+	{ 33, 41, -116, -8 },
+	{ 123, 24, 20, 31 },
+	{ 119, 40, 18, 34 },
+	{ 29, -123, 13, -20 },
+	{ 53, -114, 18, -13 },
+	{ -100, -76, -18, -39 },
+	{ -115, -48, -26, -36 },
+	{ -3, -44, -119, -38 },
+	{ 79, 13, -98, -6 },
+	{ 75, 102, -2, 42 },
+	{ 13, -85, -93, -44 },
+	{ 89, 7, -90, -5 },
+	{ 98, 77, 25, 43 },
+	{ -100, -74, -26, -40 },
+	{ 92, -77, -40, -48 },
+	{ 101, -67, -39, -46 },
+	{ 20, 118, -43, 34 },
+	{ 12, 109, -65, 26 },
+	{ 30, 96, -78, 21 },
+	{ 14, 104, -72, 24 },
+	{ 6, 104, -72, 24 },
+	{ -5, 75, -102, 10 },
+	{ -25, -2, -125, -17 },
+	{ -29, -50, -113, -30 },
+	{ -29, -109, -58, -41 },
+	{ -16, -33, -122, -26 },
+	{ -5, -110, -64, -41 },
+	{ -20, 63, -109, 5 },
+	{ -20, 16, -124, -11 },
+	{ -46, -64, -100, -33 },
+	{ -56, -98, -58, -38 },
+	{ -59, -86, -72, -37 },
+	{ -61, -108, 27, -30 },
+	{ -20, -125, 2, -35 },
+	{ -32, -110, 55, -25 },
+	{ 73, -78, 69, -7 },
+	{ 39, -80, 91, -7 },
+	{ 87, -92, 10, -17 },
+	{ 115, -52, 18, -3 },
+	{ 15, -107, 66, -20 },
+	{ 88, -85, 34, -13 },
+	{ 116, -51, 8, -4 },
+	{ -7, -96, 83, -16 },
+	{ -6, -95, 84, -15 },
+	{ 89, 10, -90, -2 },
+	{ 74, -40, -96, -18 },
+	{ 39, 58, -106, 6 },
+	{ 3, -22, -125, -22 },
+	{ 98, 35, -73, 8 },
+	{ 12, 77, -100, 12 },
+	{ -22, -10, -125, -20 },
+	{ 16, 108, -65, 26 },
+	{ 9, 113, -57, 29 },
+	{ 75, 52, -88, 9 },
+	{ 46, 93, -73, 23 },
+	{ -61, -109, 22, -31 },
+	{ -35, -106, 61, -23 },
+	{ -5, -105, 71, -20 },
+	{ -72, 78, 70, 51 },
+	{ -119, 12, -44, -17 },
+	{ -119, -6, -44, -21 },
+	{ -85, 50, 80, 48 },
+	{ -57, -26, -110, -38 },
+	{ -78, -32, -95, -31 },
+	{ -20, -70, -104, -53 },
+	{ -20, -50, -115, -52 },
+	{ -41, 102, -63, 26 },
+	{ -10, -40, 120, -45 },
+	{ 12, -45, 118, -43 },
+	{ -121, 19, -35, 17 },
+	{ -122, 17, -31, 15 },
+	{ -121, 10, -36, 19 },
+	{ -5, -112, -60, 58 },
+	{ 5, -111, -61, 59 },
+	{ 121, 11, -35, 21 },
+	{ -6, -18, 126, -52 },
+	{ 122, 15, -31, 19 },
+	{ 65, 22, -107, 48 },
+	{ 66, 32, -104, 45 },
+	{ 6, -14, 126, -52 },
+	{ -65, 18, -108, 48 },
+	{ -66, 33, -104, 44 },
+	{ -68, 39, -100, 41 },
+	{ -115, 28, -46, 21 },
+	{ -126, 11, -15, 10 },
+	{ -109, 54, -36, 18 },
+	{ -62, 55, -96, 39 },
+	{ 62, 58, -94, 40 },
+	{ 115, 26, -47, 24 },
+	{ 125, 12, -21, 15 },
+	{ 126, 11, -15, 13 },
+	{ 121, 14, -37, 21 },
+	{ 109, 53, -38, 21 },
+	{ 66, 87, -65, 31 },
+	{ 108, 67, 2, 12 },
+	{ 56, 114, 0, 16 },
+	{ 68, 37, -100, 43 },
+	{ -65, 86, -66, 30 },
+	{ -108, 67, 3, 9 },
+	{ -125, 22, 7, 4 },
+	{ -125, 21, -9, 8 },
+	{ -103, 58, 46, 1 },
+	{ -56, 114, 1, 14 },
+	{ -41, 97, 71, 1 },
+	{ -125, 9, -22, 13 },
+	{ -125, 13, -18, 11 },
+	{ -5, -14, -126, 56 },
+	{ -15, 6, -126, 52 },
+	{ 4, -16, -126, 56 },
+	{ 13, 1, -126, 53 },
+	{ 126, -1, -19, 17 },
+	{ 125, 12, -19, 14 },
+	{ -13, -117, -47, 55 },
+	{ 13, -117, -47, 55 },
+	{ -126, 5, -16, 12 },
+	{ -117, 14, 48, -13 },
+	{ -120, 10, 39, -9 },
+	{ -68, 24, 105, -33 },
+	{ -62, 47, 100, -38 },
+	{ -120, 4, 42, -9 },
+	{ -123, -7, 31, -4 },
+	{ -124, -15, 23, -2 },
+	{ -124, -16, 20, -2 },
+	{ -68, -99, 43, -11 },
+	{ -72, -69, 79, -18 },
+	{ -70, -32, 101, -24 },
+	{ 70, -34, 100, -23 },
+	{ 66, -4, 109, -28 },
+	{ -66, -2, 109, -30 },
+	{ -16, -124, -21, 48 },
+	{ 62, 47, 100, -37 },
+	{ 118, 24, 41, -11 },
+	{ 67, 27, 104, -32 },
+	{ 117, 11, 48, -10 },
+	{ 16, -124, -25, 50 },
+	{ 120, -1, 40, -5 },
+	{ 123, -9, 30, -1 },
+	{ 72, -71, 77, -16 },
+	{ 67, -101, 38, -8 },
+	{ 44, -111, -44, 3 },
+	{ 39, -87, -84, 7 },
+	{ -40, -90, -81, 6 },
+	{ -122, -34, -1, 1 },
+	{ -124, 16, 22, 1 },
+	{ -126, -1, 18, 1 },
+	{ -60, -66, 91, -3 },
+	{ -117, -40, -29, 3 },
+	{ -47, -103, 57, -1 },
+	{ 48, -114, 31, 1 },
+	{ 47, -12, 117, -3 },
+	{ 108, 39, 55, 2 },
+	{ 122, 23, 26, 4 },
+	{ 123, 11, 32, 3 },
+	{ 104, 58, 45, 4 },
+	{ 21, 74, 101, -2 },
+	{ 60, -65, 91, -2 },
+	{ -52, -29, 112, -4 },
+	{ -107, 36, 58, -1 },
+	{ -18, 81, 96, -2 },
+	{ -44, -111, -44, 2 },
+	{ 118, -41, -24, 5 },
+	{ 122, -35, -6, 4 },
+	{ 125, -20, 15, 2 },
+	{ 123, 30, 6, 8 },
+	{ 125, 20, -9, 11 },
+	{ 124, -15, 23, 1 },
+	{ 41, 100, 67, 2 },
+	{ -111, -34, 51, 0 },
+	{ -102, -50, 56, 2 },
+	{ -6, -92, 88, 14 },
+	{ 39, -52, 109, 14 },
+	{ 104, 69, 25, 8 },
+	{ 86, 85, -40, 8 },
+	{ -120, -33, -23, 1 },
+	{ 18, 119, 42, 6 },
+	{ 97, 65, 50, 9 },
+	{ 78, -100, -10, 16 },
+	{ 20, -125, -11, 18 },
+	{ -9, -64, -110, 11 },
+	{ -20, -26, -123, 10 },
+	{ 53, 74, -88, 8 },
+	{ 39, 15, -120, -16 },
+	{ 35, -15, -121, -18 },
+	{ 104, -28, 68, 21 },
+	{ -4, -107, 69, 28 },
+	{ 122, 17, -33, 2 },
+	{ 44, -25, -116, 14 },
+	{ 45, -15, -118, 13 },
+	{ -54, -31, -111, 8 },
+	{ -39, -37, -115, 10 },
+	{ -117, -41, -28, 3 },
+	{ -111, -43, -45, 4 },
+	{ -105, -53, 47, 3 },
+	{ -107, -55, 40, 3 },
+	{ -84, -49, 82, 3 },
+	{ -70, -68, 81, 7 },
+	{ -58, -57, 98, 6 },
+	{ -42, -62, 102, 8 },
+	{ 55, -46, 105, 14 },
+	{ 71, -54, 91, 16 },
+	{ 117, -13, 48, 14 },
+	{ 122, -19, 29, 15 },
+	{ 127, 2, -5, 13 },
+	{ 126, 1, -19, 13 },
+	{ 118, -1, -47, 14 },
+	{ 108, 5, -67, 13 },
+	{ 26, -124, 11, -2 },
+	{ 23, -120, 33, 5 },
+	{ 22, -114, 51, 12 },
+	{ 49, -9, 117, 45 },
+	{ 40, 107, 56, 39 },
+	{ 42, 96, 72, 44 },
+	{ 105, 57, 44, 30 },
+	{ 112, 34, 50, 29 },
+	{ 113, -12, 57, 25 },
+	{ 101, 12, 77, 36 },
+	{ 106, -26, 65, 28 },
+	{ 83, -50, 82, 31 },
+	{ 81, -94, 26, 7 },
+	{ 72, -90, 53, 16 },
+	{ 63, -88, 67, 20 },
+	{ 35, -21, 120, 49 },
+	{ 46, -72, 94, 32 },
+	{ 20, -99, 77, 22 },
+	{ -33, -95, -77, -35 },
+	{ 76, -33, -96, -10 },
+	{ 60, -92, -63, -19 },
+	{ -11, 23, 124, 22 },
+	{ 118, 47, -4, 27 },
+	{ 107, 63, -25, 26 },
+	{ 6, 104, -73, 21 },
+	{ 19, 104, -71, 22 },
+	{ 19, -6, -125, -14 },
+	{ -59, 56, -97, -2 },
+	{ 114, -44, 34, 18 },
+	{ 21, 101, 74, 39 },
+	{ 91, -15, 87, 36 },
+	{ 119, 31, 32, 22 },
+	{ 95, -53, 66, 17 },
+	{ 81, -54, 81, 20 },
+	{ 51, -23, 114, 33 },
+	{ 67, 104, 28, 47 },
+	{ 72, 52, 91, 51 },
+	{ 85, -75, -57, -10 },
+	{ 72, -105, 3, -1 },
+	{ 97, 22, 80, 30 },
+	{ 81, 2, 98, 24 },
+	{ 91, -18, 86, 18 },
+	{ 99, -37, 70, 10 },
+	{ 123, 10, 31, 22 },
+	{ 114, -30, 48, 11 },
+	{ 99, -32, 73, 12 },
+	{ 49, -23, 115, 15 },
+	{ -13, 108, 66, 44 },
+	{ -19, 38, 120, 31 },
+	{ -20, 51, 114, 34 },
+	{ -36, 68, 101, 36 },
+	{ -95, 83, -12, 16 },
+	{ -114, 54, 16, 9 },
+	{ -114, 57, -1, 7 },
+	{ -113, 55, -17, 4 },
+	{ -90, 34, -82, -9 },
+	{ -84, 46, -83, -5 },
+	{ -89, 48, -77, -4 },
+	{ -81, 63, -75, 3 },
+	{ 31, -34, -118, -18 },
+	{ 29, 19, -122, -3 },
+	{ 13, 49, -117, 5 },
+	{ 18, 74, -102, 17 },
+	{ 98, -53, -60, -5 },
+	{ 111, 0, -61, 11 },
+	{ 103, 39, -63, 22 },
+	{ 70, 78, -71, 30 },
+	{ 0, 39, 121, 27 },
+	{ -12, 24, 124, 21 },
+	{ 11, -5, 126, 16 },
+	{ 45, -30, 115, 11 },
+	{ -6, 120, -40, 39 },
+	{ 92, 87, -3, 46 },
+	{ -56, 113, 12, 38 },
+	{ 72, 67, 81, 47 },
+	{ 32, 123, 6, 3 },
+	{ 44, 86, -82, -8 },
+	{ 96, 82, 15, 6 },
+	{ 113, 53, -22, 4 },
+	{ 78, -100, -5, 17 },
+	{ 20, -125, -7, 18 },
+	{ 9, -127, -3, 19 },
+	{ -122, 2, -34, -8 },
+	{ -125, 6, -21, -7 },
+	{ -31, -22, 121, 23 },
+	{ -26, 5, 124, 18 },
+	{ 49, -41, 110, 28 },
+	{ 64, 12, 109, 19 },
+	{ 115, 18, -50, 0 },
+	{ 117, 13, -47, 1 },
+	{ 56, 15, -113, -11 },
+	{ -68, 19, -106, -18 },
+	{ -76, 8, -102, -16 },
+	{ -127, -1, -6, -4 },
+	{ -127, 0, -6, -4 },
+	{ -127, 8, -6, -6 },
+	{ -127, 2, 10, -2 },
+	{ -33, 24, 120, 13 },
+	{ -22, 38, 119, 9 },
+	{ -28, 43, 116, 7 },
+	{ -22, 31, 121, 12 },
+	{ 64, 29, 106, 15 },
+	{ 69, 44, 97, 9 },
+	{ 78, 53, 85, 4 },
+	{ 85, 27, 91, 16 },
+	{ 117, 11, -48, 2 },
+	{ 110, 8, -63, 0 },
+	{ 105, 9, -71, -2 },
+	{ 106, -23, -65, 11 },
+	{ 52, 2, -116, -9 },
+	{ 33, -1, -122, -10 },
+	{ 34, -8, -122, -7 },
+	{ 28, -28, -121, 0 },
+	{ -87, 2, -93, -14 },
+	{ -86, -4, -94, -12 },
+	{ -85, -2, -95, -13 },
+	{ -81, -23, -95, -5 },
+	{ -2, -127, -1, 53 },
+	{ 123, -30, 11, 17 },
+	{ 123, -31, -2, 18 },
+	{ 123, -1, -33, 13 },
+	{ 122, 6, -33, 12 },
+	{ 94, 28, -81, 8 },
+	{ 84, 55, -78, 3 },
+	{ 17, 47, -117, 1 },
+	{ 24, 104, -68, -10 },
+	{ -76, 83, -59, -14 },
+	{ -70, 106, -6, -20 },
+	{ -123, 32, -6, -11 },
+	{ -119, 29, 33, -12 },
+	{ -115, -34, 42, -1 },
+	{ -112, -9, 60, -6 },
+	{ -76, -74, 70, 8 },
+	{ -91, -36, 82, -1 },
+	{ -27, -83, 92, 13 },
+	{ -24, -83, 93, 13 },
+	{ 70, -75, 76, 19 },
+	{ 76, -87, 53, 23 },
+	{ -126, 11, 15, -8 },
+	{ -127, 0, -6, -3 },
+	{ -127, -2, 1, -3 },
+	{ -127, -1, -8, -3 },
+	{ -126, -17, -5, 4 },
+	{ -111, -3, 62, -8 },
+	{ -107, 0, 68, -9 },
+	{ -110, 2, 63, -9 },
+	{ -117, 5, 49, -10 },
+	{ -115, -23, 50, 2 },
+	{ -84, -11, 95, -6 },
+	{ -72, -2, 104, -9 },
+	{ -65, 14, 108, -13 },
+	{ -80, 19, 96, -16 },
+	{ -88, -2, 92, -8 },
+	{ -3, -27, 124, 1 },
+	{ 6, 1, 127, -6 },
+	{ 0, 21, 125, -13 },
+	{ -25, 41, 118, -21 },
+	{ -12, 43, 119, -21 },
+	{ 75, -24, 100, 8 },
+	{ 71, 12, 105, -2 },
+	{ 60, 36, 106, -11 },
+	{ 71, 59, 87, -18 },
+	{ 75, 11, 102, 1 },
+	{ 124, -5, 25, 11 },
+	{ 124, 16, 24, 6 },
+	{ 120, 33, 24, 1 },
+	{ 118, 41, 23, -3 },
+	{ 124, 21, 15, 7 },
+	{ 121, 17, -33, 10 },
+	{ 121, 19, -33, 9 },
+	{ 119, 28, -34, 6 },
+	{ 117, 38, -33, 2 },
+	{ 122, -10, -33, 22 },
+	{ 94, 35, -78, 7 },
+	{ 85, 31, -89, 9 },
+	{ 90, 25, -87, 11 },
+	{ 92, 24, -84, 11 },
+	{ 97, -16, -80, 27 },
+	{ 39, 28, -118, 9 },
+	{ 7, 34, -122, 7 },
+	{ -12, 11, -126, 13 },
+	{ -4, -2, -127, 19 },
+	{ -2, -28, -124, 29 },
+	{ -49, 32, -113, 4 },
+	{ -106, 13, -68, 1 },
+	{ -108, -2, -66, 5 },
+	{ -99, -11, -79, 11 },
+	{ -70, -45, -96, 28 },
+	{ 1, -127, 0, 53 },
+	{ 2, -127, 0, 53 },
+	{ -1, -127, 0, 53 },
+	{ -1, -127, 2, 53 },
+	{ -1, -127, 1, 53 },
+	{ -5, -117, -50, 15 },
+	{ -3, -95, -84, 14 },
+	{ 15, 121, -35, 5 },
+	{ 19, 125, 16, 5 },
+	{ 8, -18, 125, 32 },
+	{ 14, -112, -58, 15 },
+	{ 22, 119, 40, 53 },
+	{ 25, 74, 100, 59 },
+	{ -12, 42, -119, 8 },
+	{ -40, -45, -112, 10 },
+	{ 116, 30, -41, 11 },
+	{ 121, 31, 20, 11 },
+	{ 121, 37, 10, 8 },
+	{ 122, 35, 5, 8 },
+	{ 121, 30, -24, 5 },
+	{ -14, -86, 92, 30 },
+	{ 65, 22, -107, 11 },
+	{ 67, -1, -108, 13 },
+	{ 119, 8, -42, 13 },
+	{ 126, 14, 11, 12 },
+	{ 102, 3, 76, 12 },
+	{ 116, -52, 4, 14 },
+	{ -60, -31, -108, 8 },
+	{ 101, 63, 44, 30 },
+	{ 46, 88, 80, 46 },
+	{ 77, -101, 9, 2 },
+	{ 77, -77, -65, -12 },
+	{ 20, -48, -116, -20 },
+	{ 33, -33, 118, 30 },
+	{ 26, -121, 29, 3 },
+	{ 124, -14, -21, 3 },
+	{ 126, 10, -6, 7 },
+	{ 112, 55, 25, 11 },
+	{ 84, -7, 95, 26 },
+	{ 54, -55, -101, -17 },
+	{ 36, -4, -122, -12 },
+	{ -12, 57, -113, -1 },
+	{ 23, 102, -73, 21 },
+	{ 40, 116, -33, 35 },
+	{ 22, -64, -108, -21 },
+	{ 0, 73, -104, 6 },
+	{ -5, -18, -126, -20 },
+	{ 17, 27, -123, -7 },
+	{ 123, -2, 30, 25 },
+	{ 50, 21, 115, 41 },
+	{ 110, -31, 55, 19 },
+	{ 106, -34, 61, 21 },
+	{ 16, 38, 120, 57 },
+	{ 66, 17, 107, 48 },
+	{ 20, 8, 125, 52 },
+	{ 118, 14, 45, 31 },
+	{ 118, 14, 44, 31 },
+	{ 111, 63, 1, 32 },
+	{ 124, -13, -26, 11 },
+	{ 127, -2, -1, 18 },
+	{ 125, 15, 18, 25 },
+	{ 19, -12, 125, 32 },
+	{ 100, 63, 47, 31 },
+	{ 57, 39, 107, 49 },
+	{ 94, -85, 4, 16 },
+	{ 93, -86, 12, 17 },
+	{ 29, -121, -27, 17 },
+	{ 11, -122, -34, 17 },
+	{ 88, -11, 91, 33 },
+	{ 2, -127, 5, 53 },
+	{ 0, -127, -3, 53 },
+	{ 56, -5, 114, 30 },
+	{ 0, -87, 92, 30 },
+	{ -27, -104, 67, 27 },
+	{ 55, -114, -5, 18 },
+	{ 59, -112, -11, 17 },
+	{ -62, -110, 12, 12 },
+	{ -66, -87, -65, 10 },
+	{ -57, -61, -96, 9 },
+	{ -67, -50, -95, 8 },
+	{ 15, 52, -115, 9 },
+	{ -1, 93, -87, 6 },
+	{ -47, -17, -117, 9 },
+	{ -1, 21, -125, 9 },
+	{ 68, 49, -96, 10 },
+	{ 106, 58, -39, 9 },
+	{ 109, 60, 24, 9 },
+	{ 111, 56, 26, 8 },
+	{ 111, 61, 8, 7 },
+	{ 119, 38, -21, 5 },
+	{ -16, -122, 31, 23 },
+	{ -69, -106, 14, 17 },
+	{ -109, -14, 63, 9 },
+	{ -112, 1, 60, 6 },
+	{ -112, 13, 59, 3 },
+	{ -107, 19, 66, 2 },
+	{ -101, 30, 71, 0 },
+	{ -107, 0, 68, 11 },
+	{ 1, -127, 0, 53 },
+	{ 2, -127, 0, 53 },
+	{ 127, 5, 4, 12 },
+	{ 121, 36, 14, 2 },
+	{ 121, 32, 20, 4 },
+	{ 117, 20, 45, 11 },
+	{ 113, 16, 55, 14 },
+	{ 110, 4, 64, 17 },
+	{ 106, -21, 66, 22 },
+	{ 103, 7, 74, 22 },
+	{ 117, 2, 48, 17 },
+	{ 122, -19, 30, 13 },
+	{ 86, -91, -24, -5 },
+	{ 81, -93, -28, -6 },
+	{ 126, -5, -12, 15 },
+	{ 124, 26, 7, 25 },
+	{ 115, 50, 20, 33 },
+	{ 73, 85, 60, 51 },
+	{ 25, 102, 72, 58 },
+	{ 121, 1, -37, 4 },
+	{ 51, -82, 82, 30 },
+	{ -34, -103, 66, 26 },
+	{ -125, 15, -19, -8 },
+	{ -17, -110, 62, 27 },
+	{ -123, 14, -29, -9 },
+	{ 126, -15, 11, 14 },
+	{ 53, 13, -115, -11 },
+	{ -104, -36, 63, 13 },
+	{ -123, -11, -29, -5 },
+	{ 116, -50, 13, 14 },
+	{ 126, -3, 16, 11 },
+	{ 127, -10, -3, 10 },
+	{ 125, 5, -19, 8 },
+	{ 56, -109, -35, 16 },
+	{ 28, 89, -86, 7 },
+	{ 54, 108, -39, 6 },
+	{ 64, 109, 17, 6 },
+	{ 64, 97, 52, 7 },
+	{ 76, 100, 17, 5 },
+	{ 102, 69, -32, 1 },
+	{ 95, 12, -84, -8 },
+	{ 90, -11, -89, -10 },
+	{ 59, -62, -94, -17 },
+	{ 56, -6, 114, 23 },
+	{ -27, -2, 124, 20 },
+	{ -111, -4, 62, 8 },
+	{ -125, 5, -21, -7 },
+	{ -77, 14, -100, -17 },
+	{ 62, 22, -109, -12 },
+	{ 121, 38, 10, 10 },
+	{ 126, 4, 16, 13 },
+	{ 121, 38, -8, 7 },
+	{ -86, 59, -72, -21 },
+	{ 89, 27, 86, 23 },
+	{ 99, 3, 80, 24 },
+	{ 100, -52, 59, 25 },
+	{ 100, -59, 52, 25 },
+	{ -79, 70, -70, -22 },
+	{ 58, -53, 100, 31 },
+	{ 57, -77, 83, 30 },
+	{ 111, 55, -29, 2 },
+	{ 121, 30, -25, 5 },
+	{ 125, 6, -19, 8 },
+	{ 48, -29, 114, 31 },
+	{ 32, -25, 120, 32 },
+	{ 97, 23, -79, -6 },
+	{ 43, 60, -103, -18 },
+	{ 126, 3, -11, 9 },
+	{ -79, 3, -99, -15 },
+	{ 75, 2, -102, -7 },
+	{ -97, 14, -81, -16 },
+	{ 126, -15, -4, 11 },
+	{ 21, -92, 85, 30 },
+	{ 23, -92, 84, 30 },
+	{ 15, -93, 85, 30 },
+	{ -17, -67, 107, 28 },
+	{ -77, -77, 66, 21 },
+	{ -113, -58, -2, 6 },
+	{ 123, -16, -29, 8 },
+	{ 58, -113, -1, 19 },
+	{ -103, 17, -73, -15 },
+	{ -100, 21, -75, -16 },
+	{ -103, 22, -71, -16 },
+	{ -106, 13, -69, -14 },
+	{ -111, 13, -61, -14 },
+	{ -113, 6, -58, -12 },
+	{ -117, 0, -49, -10 },
+	{ -118, -3, -47, -8 },
+	{ -121, 7, -39, -11 },
+	{ -123, 0, -30, -7 },
+	{ -1, -127, 1, 53 },
+	{ 0, -127, 1, 53 },
+	{ 121, -18, -36, 15 },
+	{ 120, 23, -36, -1 },
+	{ 123, 18, -26, 2 },
+	{ 126, 14, -5, 7 },
+	{ 126, 13, -5, 7 },
+	{ 126, 10, 13, 10 },
+	{ 126, -3, 16, 13 },
+	{ 124, -28, 3, 14 },
+	{ 109, -62, -17, 13 },
+	{ 91, 13, -87, -7 },
+	{ 122, -14, -33, 7 },
+	{ -89, -44, -78, -6 },
+	{ 122, -36, -1, 14 },
+	{ 127, 8, -2, 10 },
+	{ 107, 43, 53, 17 },
+	{ 16, 125, -17, -18 },
+	{ 92, 62, -62, 1 },
+	{ -45, 118, 10, -22 },
+	{ -114, 49, 28, -15 },
+	{ 6, 37, -121, 6 },
+	{ 80, 45, -88, 5 },
+	{ -127, 6, -2, -5 },
+	{ -46, 1, -118, 11 },
+	{ 18, -124, -20, 17 },
+	{ 100, -78, -1, 15 },
+	{ 116, -51, -4, 13 },
+	{ 126, -11, -8, 10 },
+	{ 123, 30, -12, 7 },
+	{ 117, 49, -7, 6 },
+	{ 93, 83, -27, 1 },
+	{ 89, 86, -26, 1 },
+	{ 41, 111, -46, -2 },
+	{ -19, -9, -125, 10 },
+	{ -51, -38, -110, 9 },
+	{ 103, -2, 74, 13 },
+	{ 107, 20, 66, 11 },
+	{ -82, 76, -60, -22 },
+	{ 101, 24, -73, -5 },
+	{ -96, 19, -81, -16 },
+	{ 20, 98, -79, -21 },
+	{ -60, -41, -104, 8 },
+	{ -66, -2, -109, 7 },
+	{ -40, 24, -118, 8 },
+	{ -33, 2, -123, 9 },
+	{ -9, 53, -115, 8 },
+	{ 111, -31, -53, 5 },
+	{ -21, 21, -124, -19 },
+	{ 60, -69, -88, 2 },
+	{ 85, -94, -8, 16 },
+	{ 60, -103, -44, 12 },
+	{ 72, -104, -13, 16 },
+	{ 9, -126, -8, 19 },
+	{ -46, -116, 22, 20 },
+	{ -30, -103, 67, 27 },
+	{ -31, -77, 96, 29 },
+	{ -33, -30, 119, 30 },
+	{ -9, -50, 117, 32 },
+	{ 50, -115, -18, 17 },
+	{ 11, -126, -3, 19 },
+	{ -31, -120, 27, 22 },
+	{ -17, -106, 68, 27 },
+	{ -28, -85, 90, 29 },
+	{ -16, -69, 105, 31 },
+	{ 109, -4, -64, 1 },
+	{ 115, -34, 43, 2 },
+	{ 64, -100, 45, 12 },
+	{ 24, -80, 96, 12 },
+	{ -50, -45, 108, 12 },
+	{ -105, 69, 15, 6 },
+	{ -82, 89, -39, 6 },
+	{ 121, -35, -18, 4 },
+	{ -17, 116, 49, 5 },
+	{ -99, 66, 44, 6 },
+	{ -78, -100, -3, 15 },
+	{ -20, -125, -9, 18 },
+	{ -3, -67, -108, 12 },
+	{ 20, -64, -108, 12 },
+	{ -56, 71, -89, 7 },
+	{ -32, 15, -122, -17 },
+	{ -30, -16, -122, -19 },
+	{ 19, -106, 68, 28 },
+	{ -122, 3, -34, 2 },
+	{ -44, -23, -117, 12 },
+	{ -48, -29, -114, 13 },
+	{ 60, -31, -108, 9 },
+	{ 50, -37, -111, 10 },
+	{ 117, -41, -28, 5 },
+	{ 116, -44, -29, 6 },
+	{ 109, -43, 49, 4 },
+	{ 109, -50, 42, 5 },
+	{ 80, -56, 81, 6 },
+	{ 76, -56, 84, 6 },
+	{ 50, -67, 95, 9 },
+	{ 39, -68, 100, 10 },
+	{ -39, -53, 109, 13 },
+	{ -58, -58, 97, 15 },
+	{ -117, -23, 43, 13 },
+	{ -121, -26, 26, 14 },
+	{ -126, -11, -8, 12 },
+	{ -125, -12, -21, 12 },
+	{ -116, -23, -47, 13 },
+	{ -106, -19, -67, 13 },
+	{ -23, -123, 20, 0 },
+	{ -24, -121, 31, 4 },
+	{ -21, -113, 55, 13 },
+	{ -49, -10, 117, 44 },
+	{ -37, 108, 56, 38 },
+	{ -41, 96, 72, 43 },
+	{ -94, -9, 85, 33 },
+	{ -103, 49, 55, 30 },
+	{ -105, 18, 68, 32 },
+	{ -106, -31, 62, 24 },
+	{ -106, -24, 66, 26 },
+	{ -83, -47, 83, 30 },
+	{ -70, -98, 39, 8 },
+	{ -67, -95, 50, 13 },
+	{ -60, -92, 65, 18 },
+	{ -27, -49, 114, 42 },
+	{ -49, -64, 98, 34 },
+	{ -21, -96, 81, 24 },
+	{ -10, -9, -126, -17 },
+	{ -89, -25, -87, -8 },
+	{ -71, -64, -83, -17 },
+	{ -64, -37, 103, 16 },
+	{ -110, 57, -27, 22 },
+	{ -7, 104, -73, 21 },
+	{ -19, 104, -71, 22 },
+	{ -14, -6, -126, -15 },
+	{ 63, 45, -101, -5 },
+	{ -89, -43, 80, 27 },
+	{ -41, 105, 58, 36 },
+	{ -103, 61, 43, 27 },
+	{ -69, 98, 41, 31 },
+	{ -108, 55, 37, 25 },
+	{ -109, -28, 59, 19 },
+	{ -95, -68, 49, 6 },
+	{ -51, -23, 114, 32 },
+	{ -84, 18, 93, 38 },
+	{ -14, 122, -33, 35 },
+	{ -65, 105, 29, 46 },
+	{ -75, 47, 91, 49 },
+	{ -93, -74, -43, -9 },
+	{ -60, -111, 12, -1 },
+	{ -102, 29, 70, 29 },
+	{ -71, -15, 104, 18 },
+	{ -87, -28, 88, 12 },
+	{ -99, -39, 70, 7 },
+	{ -122, 12, 34, 20 },
+	{ -117, -22, 45, 11 },
+	{ -108, -35, 56, 7 },
+	{ -97, -38, 72, 7 },
+	{ 13, 108, 66, 45 },
+	{ 19, 39, 119, 31 },
+	{ 19, 56, 113, 36 },
+	{ 36, 69, 100, 37 },
+	{ 111, 62, 2, 12 },
+	{ 110, 61, 13, 14 },
+	{ 112, 59, 6, 12 },
+	{ 111, 62, -1, 12 },
+	{ 93, 32, -80, -7 },
+	{ 89, 39, -81, -5 },
+	{ 89, 49, -77, -1 },
+	{ 82, 62, -75, 4 },
+	{ -34, -35, -117, -19 },
+	{ -56, 11, -114, -3 },
+	{ -35, 44, -114, 6 },
+	{ -18, 74, -102, 16 },
+	{ -100, -48, -62, -6 },
+	{ -113, 1, -58, 9 },
+	{ -106, 39, -58, 20 },
+	{ -89, 75, -52, 32 },
+	{ -7, 37, 121, 27 },
+	{ 12, 24, 124, 22 },
+	{ -5, -23, 125, 9 },
+	{ -39, -51, 110, 1 },
+	{ -1, 111, -62, 34 },
+	{ -68, 104, -25, 44 },
+	{ 60, 108, 29, 39 },
+	{ -78, 60, 80, 43 },
+	{ -31, 122, 13, 3 },
+	{ -42, 86, -83, -9 },
+	{ -96, 82, 15, 4 },
+	{ -110, 57, -25, 0 },
+	{ -78, -100, 1, 15 },
+	{ -20, -125, -6, 18 },
+	{ -6, -127, -3, 19 },
+	{ 122, 0, -34, -5 },
+	{ 125, 1, -21, -3 },
+	{ 27, -30, 120, 25 },
+	{ 27, 9, 124, 18 },
+	{ -64, -38, 103, 26 },
+	{ -64, 11, 109, 18 },
+	{ -115, 16, -51, -3 },
+	{ -114, 13, -54, -3 },
+	{ -57, 12, -113, -12 },
+	{ 70, 18, -104, -16 },
+	{ 77, 7, -101, -14 },
+	{ 127, 1, -1, 0 },
+	{ 127, 1, -1, 0 },
+	{ 127, 8, -6, -4 },
+	{ 127, -3, -6, 0 },
+	{ 20, 26, 123, 14 },
+	{ 20, 38, 120, 10 },
+	{ 21, 43, 117, 7 },
+	{ 28, 30, 120, 13 },
+	{ -65, 24, 107, 15 },
+	{ -70, 39, 99, 9 },
+	{ -72, 54, 89, 2 },
+	{ -84, 27, 92, 14 },
+	{ -114, 10, -54, -2 },
+	{ -114, 9, -54, -2 },
+	{ -110, 11, -63, -4 },
+	{ -103, -23, -70, 8 },
+	{ -42, 2, -120, -10 },
+	{ -42, -1, -120, -10 },
+	{ -33, -8, -122, -8 },
+	{ -32, -28, -120, 0 },
+	{ 75, 2, -102, -13 },
+	{ 86, -4, -93, -10 },
+	{ 86, -2, -94, -11 },
+	{ 83, -22, -94, -3 },
+	{ 3, -127, -1, 53 },
+	{ -122, -34, 8, 15 },
+	{ -124, -26, 2, 14 },
+	{ -122, -5, -34, 11 },
+	{ -122, 2, -35, 10 },
+	{ -94, 11, -85, 9 },
+	{ -83, 66, -70, -2 },
+	{ -18, 45, -117, 1 },
+	{ -21, 116, -47, -14 },
+	{ 58, 90, -68, -12 },
+	{ 48, 116, -18, -19 },
+	{ 124, 22, -12, -6 },
+	{ 118, 41, 22, -11 },
+	{ 113, -43, 40, 3 },
+	{ 112, -11, 59, -3 },
+	{ 79, -67, 73, 8 },
+	{ 89, -49, 76, 4 },
+	{ 27, -84, 91, 13 },
+	{ 24, -92, 84, 15 },
+	{ -69, -79, 71, 19 },
+	{ -78, -81, 59, 20 },
+	{ 126, 13, 7, -5 },
+	{ 127, 0, 1, -1 },
+	{ 127, -2, -1, 0 },
+	{ 127, -1, -1, 0 },
+	{ 126, -18, -8, 7 },
+	{ 108, -4, 67, -5 },
+	{ 110, 0, 63, -6 },
+	{ 115, 2, 54, -6 },
+	{ 115, 5, 54, -7 },
+	{ 115, -23, 49, 5 },
+	{ 83, -17, 94, -3 },
+	{ 68, -2, 107, -7 },
+	{ 75, 12, 102, -11 },
+	{ 74, 20, 102, -15 },
+	{ 82, 2, 97, -7 },
+	{ -5, -30, 123, 2 },
+	{ -6, 4, 127, -6 },
+	{ -2, 33, 123, -16 },
+	{ 17, 42, 119, -21 },
+	{ 25, 40, 118, -20 },
+	{ -76, -24, 99, 6 },
+	{ -66, 11, 108, -4 },
+	{ -69, 37, 100, -12 },
+	{ -61, 60, 94, -21 },
+	{ -79, 11, 99, 0 },
+	{ -126, -2, 17, 8 },
+	{ -124, 17, 20, 3 },
+	{ -121, 33, 18, -2 },
+	{ -119, 41, 19, -5 },
+	{ -123, 21, 24, 3 },
+	{ -121, 17, -34, 7 },
+	{ -120, 19, -37, 7 },
+	{ -119, 28, -34, 4 },
+	{ -117, 38, -32, 0 },
+	{ -122, -10, -35, 20 },
+	{ -87, 40, -83, 4 },
+	{ -89, 30, -85, 7 },
+	{ -91, 25, -85, 9 },
+	{ -91, 24, -85, 9 },
+	{ -92, -17, -86, 26 },
+	{ 0, 32, -123, 7 },
+	{ -8, 28, -124, 8 },
+	{ 12, 15, -126, 12 },
+	{ 4, 5, -127, 16 },
+	{ -3, -27, -124, 29 },
+	{ 71, 30, -101, 4 },
+	{ 106, 11, -69, 4 },
+	{ 109, 5, -65, 5 },
+	{ 100, 6, -78, 7 },
+	{ 79, -45, -88, 28 },
+	{ 0, -127, 1, 53 },
+	{ -1, -127, 0, 53 },
+	{ 2, -127, 1, 53 },
+	{ -1, -127, 8, 53 },
+	{ 1, -127, 1, 53 },
+	{ -21, -109, -62, 14 },
+	{ 2, -94, -86, 13 },
+	{ -16, 121, -34, 4 },
+	{ -18, 125, 16, 4 },
+	{ -20, -18, 124, 32 },
+	{ -18, -113, -56, 15 },
+	{ -23, 118, 40, 52 },
+	{ -19, 76, 100, 59 },
+	{ 34, 41, -115, 8 },
+	{ 11, -48, -117, 11 },
+	{ -117, 30, -41, 8 },
+	{ -123, 23, 19, 8 },
+	{ -120, 35, 23, 7 },
+	{ -122, 36, 3, 5 },
+	{ -121, 33, -23, 2 },
+	{ 23, -85, 92, 30 },
+	{ -72, 24, -102, 10 },
+	{ -67, -26, -105, 13 },
+	{ -120, 3, -42, 10 },
+	{ -127, -2, 9, 10 },
+	{ -106, -11, 70, 11 },
+	{ -117, -50, 4, 11 },
+	{ 69, -54, -92, 10 },
+	{ -101, 63, 45, 28 },
+	{ -44, 97, 69, 42 },
+	{ -66, -104, 31, 5 },
+	{ -83, -77, -57, -12 },
+	{ -24, -48, -115, -20 },
+	{ -29, -32, 119, 30 },
+	{ -18, -121, 35, 4 },
+	{ -125, -14, -16, 1 },
+	{ -127, 9, 5, 6 },
+	{ -96, 61, 56, 14 },
+	{ -63, -55, -95, -18 },
+	{ -55, -2, -115, -11 },
+	{ -28, 71, -101, 7 },
+	{ -20, 102, -73, 21 },
+	{ -20, -64, -108, -21 },
+	{ -1, 78, -101, 8 },
+	{ -11, 26, -124, -8 },
+	{ -5, 25, -124, -8 },
+	{ -124, -3, 28, 21 },
+	{ -50, 18, 115, 40 },
+	{ -116, -45, 26, 4 },
+	{ -106, -33, 61, 19 },
+	{ -17, 38, 120, 56 },
+	{ -64, 11, 109, 46 },
+	{ -22, -10, 125, 47 },
+	{ -120, 8, 41, 26 },
+	{ -107, -2, 69, 30 },
+	{ -98, 79, 14, 36 },
+	{ -124, -13, -26, 8 },
+	{ -109, -23, 61, 18 },
+	{ -122, 32, -11, 19 },
+	{ -29, -12, 123, 31 },
+	{ -99, 34, 72, 34 },
+	{ -57, 52, 101, 48 },
+	{ -95, -85, 2, 14 },
+	{ -79, -99, 11, 15 },
+	{ -68, -100, -38, 14 },
+	{ -16, -121, -34, 16 },
+	{ -95, -10, 83, 30 },
+	{ -101, 1, 76, 30 },
+	{ -1, -127, 1, 53 },
+	{ -2, -127, -4, 53 },
+	{ -24, -2, 125, 31 },
+	{ -3, -85, 95, 31 },
+	{ 31, -103, 67, 27 },
+	{ -55, -115, -2, 17 },
+	{ -60, -112, -8, 16 },
+	{ -26, -112, -54, 15 },
+	{ 66, -84, -69, 12 },
+	{ 63, -60, -93, 10 },
+	{ 58, -53, -100, 10 },
+	{ -31, 36, -118, 9 },
+	{ -8, 95, -84, 6 },
+	{ 53, -16, -114, 9 },
+	{ -13, 26, -124, 10 },
+	{ -72, 41, -96, 9 },
+	{ -106, 58, -39, 7 },
+	{ -111, 56, 24, 6 },
+	{ -106, 53, 45, 7 },
+	{ -111, 60, 11, 5 },
+	{ -114, 47, -30, 0 },
+	{ -1, -123, 31, 24 },
+	{ 10, -125, 20, 22 },
+	{ 110, -13, 63, 12 },
+	{ 112, 0, 60, 9 },
+	{ 108, 15, 65, 6 },
+	{ 107, 19, 65, 5 },
+	{ 106, 28, 65, 1 },
+	{ 104, 2, 73, 13 },
+	{ -1, -127, 0, 53 },
+	{ -5, -127, 3, 54 },
+	{ -126, 8, 14, 11 },
+	{ -120, 38, 20, -1 },
+	{ -117, 34, 35, 3 },
+	{ -120, 20, 37, 8 },
+	{ -114, 11, 55, 12 },
+	{ -110, 0, 63, 16 },
+	{ -107, -26, 64, 20 },
+	{ -112, 6, 60, 17 },
+	{ -113, 3, 58, 17 },
+	{ -119, -19, 42, 13 },
+	{ -89, -90, -8, -3 },
+	{ -82, -93, -26, -8 },
+	{ -127, -5, -4, 14 },
+	{ -125, 23, 5, 21 },
+	{ -92, 79, 38, 42 },
+	{ -75, 84, 59, 49 },
+	{ -27, 101, 72, 57 },
+	{ -121, 5, -39, 1 },
+	{ -66, -78, 76, 28 },
+	{ 23, -108, 63, 27 },
+	{ 94, -85, -8, 12 },
+	{ 45, -97, 69, 27 },
+	{ 118, -39, -27, 2 },
+	{ -125, -18, 10, 11 },
+	{ -2, 58, -113, -21 },
+	{ 100, -48, 63, 18 },
+	{ 124, 2, -29, -5 },
+	{ -116, -51, 13, 12 },
+	{ -127, -1, -3, 7 },
+	{ -127, -1, -1, 7 },
+	{ -125, -9, -18, 6 },
+	{ -56, -109, -35, 15 },
+	{ -19, 92, -86, 6 },
+	{ -48, 111, -38, 5 },
+	{ -64, 109, 14, 5 },
+	{ -65, 98, 48, 6 },
+	{ -77, 100, 11, 3 },
+	{ -103, 50, -54, -5 },
+	{ -93, 12, -85, -11 },
+	{ -87, -12, -91, -13 },
+	{ -67, -61, -89, -17 },
+	{ -66, -4, 109, 21 },
+	{ 27, -3, 124, 21 },
+	{ 111, -4, 62, 10 },
+	{ 123, 6, -31, -6 },
+	{ 77, 15, -100, -15 },
+	{ -66, 16, -107, -12 },
+	{ -121, 37, 3, 6 },
+	{ -121, 31, 23, 9 },
+	{ -122, 36, -8, 4 },
+	{ 72, 64, -82, -21 },
+	{ -79, 23, 96, 23 },
+	{ -81, -8, 97, 25 },
+	{ -104, -48, 55, 22 },
+	{ -99, -62, 50, 22 },
+	{ 64, 69, -85, -22 },
+	{ -33, -65, 104, 30 },
+	{ -49, -80, 86, 29 },
+	{ -103, 75, 3, 4 },
+	{ -119, 35, -26, 1 },
+	{ -126, 5, -18, 5 },
+	{ -28, -43, 116, 31 },
+	{ -24, -39, 119, 32 },
+	{ 9, -50, 117, 32 },
+	{ -99, 29, -74, -8 },
+	{ -37, 67, -101, -20 },
+	{ -126, 12, -15, 5 },
+	{ 65, 4, -109, -14 },
+	{ -80, -6, -99, -7 },
+	{ 99, 13, -79, -13 },
+	{ -125, -20, -2, 9 },
+	{ -24, -91, 86, 30 },
+	{ -16, -94, 84, 30 },
+	{ -9, -94, 85, 30 },
+	{ 10, -75, 102, 29 },
+	{ 55, -97, 61, 25 },
+	{ 56, -113, 9, 19 },
+	{ -116, -50, -10, 10 },
+	{ -57, -113, 6, 18 },
+	{ 88, -36, -84, -6 },
+	{ 98, 1, -81, -12 },
+	{ 100, 21, -75, -14 },
+	{ 103, 14, -73, -13 },
+	{ 106, 14, -69, -12 },
+	{ 110, 7, -62, -10 },
+	{ 112, -1, -59, -8 },
+	{ 117, -3, -50, -6 },
+	{ 118, 6, -47, -9 },
+	{ 121, -3, -39, -4 },
+	{ 1, -127, 1, 53 },
+	{ 0, -127, 0, 53 },
+	{ -120, -18, -37, 12 },
+	{ -122, 25, -26, -3 },
+	{ -125, 20, -12, 1 },
+	{ -126, 14, -12, 3 },
+	{ -126, 13, -1, 5 },
+	{ -126, 4, 12, 8 },
+	{ -126, -5, 16, 10 },
+	{ -125, -24, 4, 11 },
+	{ -107, -67, -18, 10 },
+	{ -98, 9, -81, -7 },
+	{ -122, -1, -37, 2 },
+	{ 89, -42, -80, -5 },
+	{ -125, -16, -17, 6 },
+	{ -127, 10, 0, 7 },
+	{ -104, 43, 59, 15 },
+	{ -16, 125, -17, -18 },
+	{ -92, 57, -66, 0 },
+	{ 62, 109, 19, -21 },
+	{ 119, 36, 27, -10 },
+	{ -7, 36, -122, 7 },
+	{ -91, 37, -80, 5 },
+	{ 126, 11, 4, -4 },
+	{ 106, 9, -69, 4 },
+	{ -18, -124, -19, 17 },
+	{ -96, -83, -1, 13 },
+	{ -116, -51, -3, 11 },
+	{ -126, -9, -7, 7 },
+	{ -121, 38, -10, 4 },
+	{ -114, 52, -18, 2 },
+	{ -95, 84, -7, 2 },
+	{ -90, 82, -37, -2 },
+	{ -41, 112, -44, -3 },
+	{ -3, -4, -127, 11 },
+	{ 41, -40, -114, 10 },
+	{ -115, 1, 55, 10 },
+	{ -120, 24, 34, 8 },
+	{ 83, 79, -54, -20 },
+	{ -92, 39, -78, -11 },
+	{ 100, 21, -76, -14 },
+	{ -25, 79, -96, -21 },
+	{ 69, -40, -99, 9 },
+	{ 51, 0, -116, 9 },
+	{ 41, 12, -119, 9 },
+	{ 49, 2, -117, 9 },
+	{ 34, 57, -108, 8 },
+	{ -112, -42, -43, 5 },
+	{ -31, -37, -117, -8 },
+	{ -17, -22, -124, -11 },
+	{ -65, -68, -86, 1 },
+	{ -83, -95, -10, 14 },
+	{ -72, -105, -7, 15 },
+	{ -8, -126, -17, 17 },
+	{ -13, -123, 27, 23 },
+	{ 33, -103, 67, 27 },
+	{ 31, -78, 96, 30 },
+	{ -50, -116, -14, 16 },
+	{ -11, -126, -7, 18 },
+	{ -8, -123, 29, 23 },
+	{ 17, -106, 68, 28 },
+	{ -56, -81, 80, 27 },
+	{ 21, -69, 105, 31 },
+	{ -115, -51, -19, 9 },
+	{ 116, -10, 52, 22 },
+	{ 42, -7, 120, 47 },
+	{ -42, -13, 119, 44 },
+	{ -116, -9, 51, 20 },
+	{ -102, -7, 76, 29 },
+	{ 123, -9, 30, 23 },
+	{ 116, -50, -13, 6 },
+	{ 92, -60, -64, -8 },
+	{ 50, -24, -114, -14 },
+	{ 18, -18, -124, -16 },
+	{ -17, -25, -123, -18 },
+	{ -44, -46, -110, -19 },
+	{ -98, -48, -64, -8 },
+	{ -116, -50, -13, 3 },
+	{ -118, -31, 34, 18 },
+	{ 87, -50, 78, 21 },
+	{ 72, -13, 104, 35 },
+	{ 61, 19, 110, 41 },
+	{ 113, -48, 33, 8 },
+	{ 87, 9, 93, 37 },
+	{ 98, 2, 81, 34 },
+	{ 108, -12, 66, 27 },
+	{ 109, -10, 64, 27 },
+	{ -96, -65, 52, 8 },
+	{ -66, -15, 107, 33 },
+	{ -66, 18, 107, 39 },
+	{ -105, -32, 64, 20 },
+	{ -109, -12, 64, 24 },
+	{ 72, 65, 82, 42 },
+	{ 66, 74, 80, 42 },
+	{ 75, 54, 87, 42 },
+	{ 71, 51, 92, 43 },
+	{ -66, 73, 80, 40 },
+	{ -81, 76, 61, 35 },
+	{ -107, 61, 31, 23 },
+	{ -30, 68, 103, 42 },
+	{ 78, -65, 76, 25 },
+	{ 96, -59, 58, 21 },
+	{ 75, -79, 66, 21 },
+	{ 21, -89, 88, 27 },
+	{ -20, -93, 85, 25 },
+	{ -81, -67, 70, 22 },
+	{ -99, -52, 60, 20 },
+	{ -92, -64, 61, 19 },
+	{ -75, -87, 53, 13 },
+	{ -95, -81, -23, -5 },
+	{ -85, -69, -65, -12 },
+	{ -60, -43, -103, -17 },
+	{ -22, -34, -120, -19 },
+	{ 21, -41, -118, -19 },
+	{ 51, -43, -108, -17 },
+	{ 77, -77, -65, -12 },
+	{ 96, -81, -19, -2 },
+	{ 96, -81, 19, 8 },
+	{ -3, -122, 34, 2 },
+	{ 23, -122, 29, 1 },
+	{ 50, -117, 3, -7 },
+	{ 42, -117, -25, -18 },
+	{ 6, 124, 28, 22 },
+	{ 40, 119, 21, 20 },
+	{ 13, 120, 39, 27 },
+	{ -21, 119, 37, 26 },
+	{ -33, 120, 23, 20 },
+	{ -4, 123, 30, 22 },
+	{ -43, -118, -18, -16 },
+	{ -13, -125, -20, -19 },
+	{ -7, -126, 16, -5 },
+	{ 5, -123, 31, 1 },
+	{ 97, -65, 51, 18 },
+	{ -118, 13, 46, 23 },
+	{ -77, -65, 77, 24 },
+	{ 99, -72, 34, 11 },
+	{ 92, -71, 50, 17 },
+	{ 70, -78, 72, 23 },
+	{ 28, -96, 79, 23 },
+	{ -32, -88, 85, 26 },
+	{ -65, -86, 67, 19 },
+	{ -87, -81, 44, 11 },
+	{ -99, -72, 33, 8 },
+	{ -94, -41, 75, 26 },
+	{ -111, -16, 59, 23 },
+	{ -92, -51, 72, 24 },
+	{ -19, -79, 98, 32 },
+	{ 22, -67, 106, 36 },
+	{ 87, -64, 68, 24 },
+	{ 109, -40, 52, 21 },
+	{ 98, -37, 72, 28 },
+	{ -25, -86, 90, 12 },
+	{ -28, -85, 90, 12 },
+	{ -54, -73, 89, 12 },
+	{ -85, 16, 93, 21 },
+	{ -38, 40, 114, 32 },
+	{ -16, 46, 117, 34 },
+	{ 0, 48, 117, 34 },
+	{ 36, 40, 115, 33 },
+	{ 85, 32, 88, 24 },
+	{ 51, -64, 97, 17 },
+	{ 27, -82, 93, 14 },
+	{ 24, -80, 96, 15 },
+	{ 41, 115, 33, 21 },
+	{ -44, 119, 6, 11 },
+	{ -49, -53, -105, -47 },
+	{ -97, -26, -77, -36 },
+	{ -111, -14, -60, -29 },
+	{ -111, 49, -37, -14 },
+	{ -88, 64, -65, -22 },
+	{ -86, 76, -55, -17 },
+	{ -75, 75, -70, -22 },
+	{ -17, 98, -78, -21 },
+	{ 18, 96, -81, -22 },
+	{ 73, 78, -69, -19 },
+	{ 77, 94, -37, -7 },
+	{ 78, 85, -53, -13 },
+	{ 112, 43, -43, -15 },
+	{ -43, 106, 55, 31 },
+	{ 96, -34, -76, -33 },
+	{ 49, -59, -102, -46 },
+	{ -33, -122, -9, -20 },
+	{ -54, -114, -16, -22 },
+	{ -73, -101, -24, -24 },
+	{ -118, -47, 5, -12 },
+	{ -126, 18, 2, -6 },
+	{ -120, 41, 6, -2 },
+	{ -63, 110, 11, 8 },
+	{ -20, 123, 24, 14 },
+	{ -2, 126, 13, 12 },
+	{ 63, 110, 11, 9 },
+	{ 120, 41, 4, 0 },
+	{ 124, 21, 16, 1 },
+	{ 121, -37, -10, -13 },
+	{ 69, -106, -15, -20 },
+	{ 51, -116, -8, -18 },
+	{ 34, -122, -9, -19 },
+	{ -89, -75, -52, -31 },
+	{ -120, -2, -42, -22 },
+	{ -98, 79, -15, -3 },
+	{ -104, 69, -23, -7 },
+	{ -67, 101, -36, -8 },
+	{ -18, 121, -32, -3 },
+	{ 18, 121, -35, -4 },
+	{ 67, 102, -34, -5 },
+	{ 101, 64, -43, -12 },
+	{ 98, 79, -20, -3 },
+	{ 120, -3, -40, -19 },
+	{ 86, -81, -48, -28 },
+	{ 74, -93, -44, -28 },
+	{ 33, -109, -57, -34 },
+	{ -32, -111, -53, -34 },
+	{ -78, -87, -50, -31 },
+	{ 39, 99, 70, 43 },
+	{ 101, 54, 56, 33 },
+	{ 111, -4, 61, 29 },
+	{ 97, 7, 81, 36 },
+	{ 91, -60, 65, 23 },
+	{ 76, -96, 32, 8 },
+	{ 24, -124, 16, -1 },
+	{ 101, -70, 31, 10 },
+	{ 98, -59, 55, 20 },
+	{ -51, 86, 78, 44 },
+	{ -100, 64, 45, 28 },
+	{ -104, -17, 70, 28 },
+	{ -78, -36, 93, 32 },
+	{ -76, -78, 65, 18 },
+	{ -80, -96, 25, 4 },
+	{ -26, -123, 14, -2 },
+	{ -99, -58, 55, 18 },
+	{ 109, 58, 30, 25 },
+	{ 29, 70, 102, 43 },
+	{ -58, 59, 96, 42 },
+	{ -108, -8, 66, 25 },
+	{ -95, -51, 67, 16 },
+	{ -91, -63, 62, 11 },
+	{ -100, -19, 77, 26 },
+	{ -78, 54, 84, 40 },
+	{ -113, 25, 51, 32 },
+	{ -85, -49, 81, 19 },
+	{ -80, -54, 83, 18 },
+	{ -87, -20, 90, 29 },
+	{ -89, 9, 91, 35 },
+	{ -74, 55, 87, 40 },
+	{ -26, 98, 76, 39 },
+	{ -65, 72, 82, 41 },
+	{ -117, -34, 37, 18 },
+	{ -96, -81, 21, 6 },
+	{ -77, -101, 7, -1 },
+	{ -70, -105, 13, 0 },
+	{ -96, -27, 79, 20 },
+	{ -96, -8, 82, 22 },
+	{ -84, -8, 95, 24 },
+	{ -69, -31, 102, 25 },
+	{ -53, -3, 115, 29 },
+	{ -23, -50, 114, 32 },
+	{ -99, 77, -20, 28 },
+	{ -108, 67, 3, 31 },
+	{ -115, 50, 20, 31 },
+	{ -80, 99, -5, 37 },
+	{ -58, 113, 7, 42 },
+	{ -18, 125, 9, 46 },
+	{ 18, 125, 9, 47 },
+	{ 55, 114, 8, 44 },
+	{ 84, 95, 0, 39 },
+	{ -51, 112, -33, 33 },
+	{ -39, 116, -33, 34 },
+	{ 11, 122, -33, 36 },
+	{ 52, 112, -31, 35 },
+	{ 97, -42, 70, 21 },
+	{ 96, -65, 52, 10 },
+	{ 94, -69, 51, 8 },
+	{ 101, -15, 75, 29 },
+	{ 96, -6, 83, 33 },
+	{ 86, 34, 87, 40 },
+	{ 69, 99, 40, 32 },
+	{ 74, 94, 43, 33 },
+	{ 90, -15, 88, 36 },
+	{ 98, 79, 14, 38 },
+	{ 105, 65, 29, 39 },
+	{ 108, 4, 67, 33 },
+	{ 98, -52, 62, 17 },
+	{ 101, -19, 75, 28 },
+	{ 85, 34, 88, 40 },
+	{ 40, 105, 60, 37 },
+	{ 84, -86, 41, 12 },
+	{ 72, -103, 22, 4 },
+	{ 70, -5, 106, 28 },
+	{ 54, -5, 115, 30 },
+	{ 76, -32, 97, 26 },
+	{ 53, -115, 6, -2 },
+	{ 33, -37, 117, 38 },
+	{ 53, -30, 111, 38 },
+	{ 70, -22, 103, 38 },
+	{ 72, -38, 97, 34 },
+	{ 74, -56, 87, 28 },
+	{ 74, -77, 69, 20 },
+	{ 90, -61, 65, 22 },
+	{ 83, -59, 76, 25 },
+	{ 81, -41, 88, 31 },
+	{ 89, -45, 79, 28 },
+	{ 93, -33, 80, 30 },
+	{ 99, -37, 70, 27 },
+	{ 95, -48, 69, 25 },
+	{ 87, -29, 88, 33 },
+	{ 84, -13, 95, 37 },
+	{ 91, -16, 88, 35 },
+	{ 79, -26, 96, 35 },
+	{ 93, -75, 43, 14 },
+	{ 84, -92, 23, 5 },
+	{ -31, -73, -99, -40 },
+	{ -88, 4, -92, -34 },
+	{ -89, -5, -91, -35 },
+	{ -9, -112, -59, -30 },
+	{ -40, -44, -112, -41 },
+	{ 97, -82, 7, 3 },
+	{ 71, -98, 39, 8 },
+	{ 83, -77, 56, 17 },
+	{ 57, -99, 56, 12 },
+	{ 103, -57, 47, 18 },
+	{ 109, -49, 44, 19 },
+	{ 104, -42, 59, 24 },
+	{ 100, -51, 59, 22 },
+	{ 115, -37, 40, 20 },
+	{ 117, -46, 16, 12 },
+	{ 110, -59, 22, 12 },
+	{ 102, -68, 31, 12 },
+	{ 96, -62, 55, 19 },
+	{ 62, -74, 82, 23 },
+	{ 50, -69, 95, 27 },
+	{ 27, -90, 86, 21 },
+	{ -5, -111, 62, 9 },
+	{ -27, -97, 78, 14 },
+	{ 12, -80, 98, 25 },
+	{ -75, -81, 62, 8 },
+	{ -2, -67, 108, 29 },
+	{ -100, -26, -74, -33 },
+	{ 10, -117, 48, 4 },
+	{ -92, -32, -82, -35 },
+	{ 42, -96, 71, 16 },
+	{ 37, -61, 105, 31 },
+	{ 25, -53, 112, 34 },
+	{ 43, -41, 112, 36 },
+	{ 63, -34, 105, 36 },
+	{ 53, -47, 106, 34 },
+	{ 15, -42, 119, 37 },
+	{ 8, -28, 124, 40 },
+	{ 29, -25, 121, 41 },
+	{ 63, -52, 97, 31 },
+	{ 76, -10, 101, 39 },
+	{ 71, 5, 105, 43 },
+	{ 57, 9, 113, 45 },
+	{ 60, 23, 110, 47 },
+	{ 74, 18, 102, 44 },
+	{ 84, 25, 92, 43 },
+	{ 90, 11, 89, 40 },
+	{ 83, 14, 95, 42 },
+	{ 88, -1, 92, 39 },
+	{ 80, 2, 98, 41 },
+	{ 92, 21, 85, 41 },
+	{ 98, 18, 78, 39 },
+	{ 97, 8, 82, 38 },
+	{ 75, 29, 98, 46 },
+	{ 62, 45, 101, 49 },
+	{ 75, 40, 94, 47 },
+	{ 61, 35, 105, 48 },
+	{ 84, 36, 88, 44 },
+	{ 83, 49, 83, 46 },
+	{ 92, 45, 76, 43 },
+	{ 92, 32, 81, 42 },
+	{ 35, 15, 121, 48 },
+	{ 4, 4, 127, 46 },
+	{ 4, -13, 126, 43 },
+	{ -29, -11, 123, 41 },
+	{ -31, 8, 123, 44 },
+	{ 33, 0, 123, 46 },
+	{ 30, -14, 123, 43 },
+	{ 53, -4, 115, 44 },
+	{ 48, -17, 116, 41 },
+	{ 5, 21, 125, 49 },
+	{ 9, 38, 121, 51 },
+	{ 12, 53, 115, 52 },
+	{ 41, 43, 112, 51 },
+	{ 38, 30, 117, 50 },
+	{ -29, 45, 115, 49 },
+	{ -31, 27, 120, 47 },
+	{ 67, -8, 108, 41 },
+	{ 60, -19, 110, 40 },
+	{ 44, -27, 116, 40 },
+	{ 45, 63, 101, 52 },
+	{ 42, 54, 107, 52 },
+	{ 18, 65, 108, 53 },
+	{ 25, 77, 98, 53 },
+	{ 39, 85, 86, 52 },
+	{ 54, 87, 75, 50 },
+	{ 31, 108, 59, 48 },
+	{ 13, 102, 75, 51 },
+	{ -88, 90, -18, 11 },
+	{ -96, -10, -82, -35 },
+	{ -96, -10, -83, -35 },
+	{ -95, -10, -83, -35 },
+	{ -92, -11, -87, -36 },
+	{ -91, -9, -88, -36 },
+	{ -88, -4, -91, -35 },
+	{ 48, 69, -95, -4 },
+	{ 53, 101, -56, 15 },
+	{ -82, 14, -96, -31 },
+	{ -38, 121, 0, 28 },
+	{ 49, 109, 43, 45 },
+	{ 6, 126, 17, 38 },
+	{ -89, 21, -88, -28 },
+	{ -4, 90, 89, 51 },
+	{ -16, 76, 101, 51 },
+	{ -23, 61, 109, 50 },
+	{ -119, 21, -39, -14 },
+	{ -117, 32, -37, -11 },
+	{ -114, 41, -39, -9 },
+	{ 68, 86, 63, 47 },
+	{ 81, 82, 52, 44 },
+	{ 94, 76, 39, 40 },
+	{ 94, 85, 0, 31 },
+	{ 104, 68, 28, 36 },
+	{ 107, 51, 46, 37 },
+	{ 99, 57, 56, 41 },
+	{ 105, 71, -12, 26 },
+	{ 112, 58, 16, 31 },
+	{ 114, 52, -22, 20 },
+	{ 119, 45, 5, 26 },
+	{ 81, 97, 13, 36 },
+	{ 65, 105, 28, 41 },
+	{ 42, 116, -29, 25 },
+	{ 30, 122, -18, 29 },
+	{ 89, 62, 67, 44 },
+	{ 78, 65, 76, 47 },
+	{ 67, 68, 84, 49 },
+	{ 55, 69, 91, 51 },
+	{ 73, 52, 90, 48 },
+	{ 62, 54, 97, 50 },
+	{ 118, 40, 25, 30 },
+	{ 113, 32, 49, 35 },
+	{ 106, 25, 66, 37 },
+	{ 100, 40, 67, 40 },
+	{ 107, 37, 58, 38 },
+	{ 99, 28, 74, 40 },
+	{ 104, 15, 71, 37 },
+	{ 109, 1, 65, 33 },
+	{ 116, -4, 52, 29 },
+	{ 113, -17, 55, 27 },
+	{ 106, -12, 68, 31 },
+	{ 97, -20, 80, 32 },
+	{ 100, -8, 78, 34 },
+	{ 103, 4, 75, 36 },
+	{ 103, -25, 71, 30 },
+	{ 109, -30, 58, 26 },
+	{ 123, -10, 31, 23 },
+	{ 127, -2, 1, 16 },
+	{ 123, 11, -32, 9 },
+	{ -32, -7, -123, -37 },
+	{ -40, -16, -119, -39 },
+	{ 123, -7, -31, 6 },
+	{ 126, 13, -1, 19 },
+	{ 124, 28, -1, 21 },
+	{ 120, 31, -29, 14 },
+	{ 126, -16, 4, 15 },
+	{ 123, -32, 9, 13 },
+	{ 121, -23, -29, 4 },
+	{ 118, -40, -24, 2 },
+	{ 120, -24, 35, 21 },
+	{ 124, 3, 28, 24 },
+	{ 124, 15, 25, 26 },
+	{ 123, 25, 22, 27 },
+	{ 118, 18, 43, 31 },
+	{ 117, 29, 40, 32 },
+	{ 117, 8, 48, 30 },
+	{ 111, 12, 61, 34 },
+	{ 112, 22, 56, 34 },
+	{ 113, 45, 36, 34 },
+	{ -34, -35, 117, 37 },
+	{ -43, -41, 112, 35 },
+	{ -15, -42, 119, 36 },
+	{ -7, -28, 124, 40 },
+	{ 14, -51, 116, 34 },
+	{ -26, -53, 112, 33 },
+	{ -37, -62, 105, 30 },
+	{ -50, -69, 95, 26 },
+	{ -63, -52, 97, 30 },
+	{ -72, -38, 97, 32 },
+	{ -74, -56, 87, 26 },
+	{ -81, -42, 88, 29 },
+	{ -70, -23, 104, 36 },
+	{ -63, -34, 105, 34 },
+	{ -79, -25, 96, 34 },
+	{ -52, -47, 106, 33 },
+	{ -62, -74, 82, 22 },
+	{ -74, -77, 69, 18 },
+	{ -83, -77, 56, 15 },
+	{ -57, -99, 55, 11 },
+	{ -71, -98, 39, 7 },
+	{ -42, -96, 71, 15 },
+	{ -27, -90, 86, 20 },
+	{ 14, -114, 55, 6 },
+	{ -7, -116, 52, 5 },
+	{ -12, -80, 98, 25 },
+	{ 2, -67, 108, 29 },
+	{ 121, -39, 2, -7 },
+	{ 24, -31, 121, 38 },
+	{ 125, -10, -23, -11 },
+	{ 86, -71, 60, 10 },
+	{ 92, 9, -87, -30 },
+	{ 94, 6, -85, -30 },
+	{ 34, -91, 82, 16 },
+	{ -4, -12, 126, 43 },
+	{ 31, 9, 123, 45 },
+	{ 29, -11, 123, 42 },
+	{ 121, 10, -37, -13 },
+	{ 120, 13, -38, -13 },
+	{ 94, -5, -85, -32 },
+	{ 119, 21, -40, -12 },
+	{ 118, 29, -37, -9 },
+	{ 23, 61, 109, 51 },
+	{ 16, 76, 101, 51 },
+	{ 95, -7, -84, -32 },
+	{ 92, -9, -87, -33 },
+	{ 91, -6, -88, -33 },
+	{ 120, 16, -39, -13 },
+	{ 32, 27, 120, 47 },
+	{ 29, 45, 115, 49 },
+	{ 93, -1, -86, -32 },
+	{ 92, 4, -87, -31 },
+	{ 89, 3, -90, -32 },
+	{ 90, -2, -89, -33 },
+	{ 91, 8, -88, -31 },
+	{ 123, 7, -30, -11 },
+	{ -4, 4, 127, 46 },
+	{ -30, -14, 123, 42 },
+	{ -43, -27, 117, 39 },
+	{ -53, -30, 111, 37 },
+	{ -61, -20, 110, 38 },
+	{ -48, -17, 116, 40 },
+	{ -53, -4, 115, 42 },
+	{ -32, 0, 123, 45 },
+	{ -66, -8, 108, 40 },
+	{ -71, 5, 105, 41 },
+	{ -76, -11, 101, 37 },
+	{ -81, 2, 98, 39 },
+	{ -26, -24, 122, 40 },
+	{ -104, -58, 45, 15 },
+	{ -109, -49, 44, 16 },
+	{ -114, -38, 40, 17 },
+	{ -110, -58, 23, 9 },
+	{ -102, -68, 31, 10 },
+	{ -96, -63, 54, 17 },
+	{ -95, -49, 69, 23 },
+	{ -99, -37, 70, 25 },
+	{ -93, -33, 80, 28 },
+	{ -97, -21, 79, 30 },
+	{ -103, -25, 70, 27 },
+	{ -94, -4, 85, 34 },
+	{ -91, -17, 87, 33 },
+	{ -100, -8, 78, 32 },
+	{ -86, -29, 88, 31 },
+	{ -89, -45, 79, 26 },
+	{ -83, -59, 76, 23 },
+	{ -90, -61, 65, 20 },
+	{ -100, -52, 59, 20 },
+	{ -104, -42, 59, 22 },
+	{ -93, -75, 43, 12 },
+	{ -84, -92, 23, 3 },
+	{ 13, -86, -92, -37 },
+	{ 88, 5, -91, -32 },
+	{ 88, 7, -91, -32 },
+	{ 88, 7, -91, -32 },
+	{ 39, -32, -117, -40 },
+	{ 40, -49, -110, -40 },
+	{ -14, -124, -24, -19 },
+	{ 87, 3, -93, -33 },
+	{ -26, -121, 27, -2 },
+	{ 92, -29, -83, -33 },
+	{ -97, -82, 7, 1 },
+	{ -106, -69, -6, -1 },
+	{ -113, -55, -16, -1 },
+	{ -118, -40, -23, 0 },
+	{ -123, -32, 10, 10 },
+	{ -117, -46, 16, 9 },
+	{ -120, -24, 36, 19 },
+	{ -116, -4, 52, 26 },
+	{ -123, -10, 31, 20 },
+	{ -126, -16, 4, 12 },
+	{ -122, -23, -29, 1 },
+	{ 41, -20, -118, -39 },
+	{ 39, -16, -120, -38 },
+	{ 36, -7, -122, -37 },
+	{ 19, 4, -126, -34 },
+	{ -120, 31, -29, 11 },
+	{ -123, 11, -32, 7 },
+	{ -123, -6, -31, 4 },
+	{ -127, -2, 1, 13 },
+	{ -126, 13, -1, 16 },
+	{ -124, 28, -1, 19 },
+	{ -119, 45, 6, 23 },
+	{ -118, 38, 28, 28 },
+	{ -123, 24, 18, 23 },
+	{ -124, 15, 24, 23 },
+	{ -118, 18, 43, 28 },
+	{ -117, 8, 48, 27 },
+	{ -124, 3, 27, 21 },
+	{ -109, 1, 65, 30 },
+	{ -103, 4, 75, 33 },
+	{ -98, 18, 78, 37 },
+	{ -104, 15, 71, 34 },
+	{ -111, 12, 61, 31 },
+	{ -112, 21, 56, 32 },
+	{ -112, 32, 49, 32 },
+	{ -107, 37, 58, 35 },
+	{ -106, 25, 66, 35 },
+	{ -99, 28, 74, 37 },
+	{ -92, 32, 81, 40 },
+	{ -84, 36, 88, 42 },
+	{ -92, 45, 76, 41 },
+	{ -83, 49, 83, 44 },
+	{ -92, 21, 85, 39 },
+	{ -90, 11, 89, 38 },
+	{ -97, 8, 82, 36 },
+	{ -106, -12, 68, 29 },
+	{ -113, -17, 55, 25 },
+	{ -109, -30, 58, 23 },
+	{ -41, 65, 101, 51 },
+	{ -43, 54, 107, 51 },
+	{ -41, 43, 112, 50 },
+	{ -17, 65, 108, 52 },
+	{ -26, 77, 98, 52 },
+	{ -39, 85, 86, 51 },
+	{ -67, 68, 84, 48 },
+	{ -68, 86, 63, 46 },
+	{ -54, 88, 75, 49 },
+	{ -31, 108, 59, 48 },
+	{ 56, 113, -18, 20 },
+	{ -49, 109, 44, 44 },
+	{ -15, 126, 11, 37 },
+	{ -13, 102, 75, 50 },
+	{ 97, 80, -17, 11 },
+	{ 111, 46, -39, -6 },
+	{ 4, 90, 89, 51 },
+	{ -89, 62, 66, 42 },
+	{ -99, 57, 56, 39 },
+	{ -94, 76, 40, 38 },
+	{ -107, 51, 46, 35 },
+	{ -104, 68, 28, 33 },
+	{ -82, 82, 52, 42 },
+	{ -79, 65, 75, 45 },
+	{ -53, 71, 91, 50 },
+	{ -65, 53, 96, 48 },
+	{ -75, 40, 94, 45 },
+	{ -61, 35, 105, 47 },
+	{ -74, 18, 102, 43 },
+	{ -75, 29, 98, 44 },
+	{ -60, 23, 110, 46 },
+	{ -62, 45, 101, 48 },
+	{ -74, 52, 90, 46 },
+	{ -12, 53, 115, 52 },
+	{ -38, 30, 117, 49 },
+	{ -35, 15, 121, 47 },
+	{ -9, 38, 121, 51 },
+	{ -5, 22, 125, 49 },
+	{ 83, 14, -95, -29 },
+	{ 90, -6, -89, -33 },
+	{ 91, -12, -87, -34 },
+	{ 92, -12, -87, -34 },
+	{ 92, -10, -87, -34 },
+	{ 95, -9, -84, -33 },
+	{ 96, -10, -83, -33 },
+	{ 95, -8, -84, -32 },
+	{ -51, 80, -85, 1 },
+	{ -94, 86, 0, 29 },
+	{ -68, 99, -40, 19 },
+	{ -51, 115, -19, 28 },
+	{ 89, 25, -87, -25 },
+	{ -40, 120, -9, 31 },
+	{ -65, 105, 28, 40 },
+	{ -80, 98, 13, 35 },
+	{ -105, 71, -13, 23 },
+	{ -114, 52, -22, 17 },
+	{ 5, 36, -122, -24 },
+	{ 95, -5, -84, -32 },
+	{ -14, -50, 116, 33 },
+	{ -124, -4, -25, -14 },
+	{ -92, 8, -88, -33 },
+	{ -124, -28, -4, -10 },
+	{ -93, 6, -87, -33 },
+	{ -88, 6, -91, -34 },
+	{ -39, -35, -116, -41 },
+	{ 106, -69, -6, 2 },
+	{ 113, -55, -16, 2 },
+	{ -42, -25, -117, -40 },
+	{ -42, -22, -118, -40 },
+	{ -91, -6, -88, -35 },
+	{ -93, -1, -86, -34 },
+	{ -92, 4, -87, -33 },
+	{ -89, 3, -90, -34 },
+	{ -90, -2, -89, -35 },
+	{ -91, 8, -88, -33 },
+	{ -122, 11, -35, -15 },
+	{ -124, 4, -29, -14 },
+	{ -120, 14, -38, -16 },
+	{ -94, -5, -85, -34 },
+	{ -120, 16, -39, -15 },
+	{ -41, -20, -119, -40 },
+	{ -88, 7, -92, -34 },
+	{ -24, -31, 121, 37 },
+	{ -6, 36, -122, -25 },
+	{ -16, 11, -125, -33 },
+	{ 32, -121, 19, -4 },
+	{ -93, 6, -86, -33 },
+	{ -57, 9, 113, 44 },
+	{ 91, 9, -88, -31 },
+	{ 100, -28, -73, -30 },
+	{ 42, -25, -117, -39 },
+	{ -84, 25, 92, 41 },
+	{ -83, 14, 95, 40 },
+	{ -112, 58, 16, 29 },
+	{ -118, 28, 38, 29 },
+	{ -113, 45, 37, 31 },
+	{ -92, -9, -87, -36 },
+	{ -95, -9, -84, -35 },
+	{ -95, -8, -84, -35 },
+	{ -92, -11, -87, -36 },
+	{ -84, -13, 94, 35 },
+	{ -100, 40, 67, 38 },
+	{ -88, -1, 92, 37 },
+	{ 94, -4, 85, 36 },
+	{ 42, -22, -118, -39 },
+	{ 84, 63, -72, 0 },
+	{ 37, 76, -95, -5 },
+	{ -35, 76, -95, -6 },
+	{ -83, 67, -69, 0 },
+	{ -125, 23, -9, 7 },
+	{ -125, 0, 25, 11 },
+	{ -84, -44, 85, 19 },
+	{ -35, -65, 103, 19 },
+	{ 37, -65, 103, 20 },
+	{ 84, -47, 83, 19 },
+	{ 125, -6, 23, 12 },
+	{ 125, 20, -12, 7 },
+	{ 90, 67, -59, 6 },
+	{ 35, 88, -85, 3 },
+	{ -34, 87, -86, 1 },
+	{ -90, 67, -59, 3 },
+	{ -122, 33, -14, 8 },
+	{ -121, -5, 38, 15 },
+	{ -89, -36, 83, 21 },
+	{ -35, -54, 109, 25 },
+	{ 35, -53, 110, 26 },
+	{ 89, -36, 83, 23 },
+	{ 121, -4, 39, 18 },
+	{ 122, 34, -14, 11 },
+	{ 87, 72, -57, 8 },
+	{ 31, 91, -83, 4 },
+	{ -31, 91, -83, 4 },
+	{ -87, 72, -57, 6 },
+	{ -121, 37, -10, 11 },
+	{ -119, -1, 43, 18 },
+	{ -87, -33, 86, 23 },
+	{ -31, -51, 112, 27 },
+	{ 31, -51, 112, 28 },
+	{ 87, -32, 87, 26 },
+	{ 119, -1, 43, 20 },
+	{ 121, 37, -9, 14 },
+	{ 85, 78, -52, 12 },
+	{ 30, 96, -78, 8 },
+	{ -29, 99, -75, 10 },
+	{ -85, 81, -49, 13 },
+	{ -118, 47, 0, 19 },
+	{ -116, 9, 51, 25 },
+	{ -82, -25, 94, 29 },
+	{ -29, -42, 116, 33 },
+	{ 31, -47, 114, 30 },
+	{ 82, -28, 93, 30 },
+	{ 117, 6, 48, 25 },
+	{ 120, 42, -3, 19 },
+	{ 57, -107, -36, -41 },
+	{ 0, 125, -24, 42 },
+	{ -79, 99, 13, 46 },
+	{ -84, 36, 88, 52 },
+	{ 0, 2, 127, 55 },
+	{ 83, 32, 91, 53 },
+	{ 86, 92, 17, 46 },
+	{ -8, -116, -51, -51 },
+	{ -58, -106, -40, -44 },
+	{ -1, -118, -46, -50 },
+	{ -59, -68, -89, -49 },
+	{ -1, -82, -97, -56 },
+	{ 1, -78, -100, -56 },
+	{ 59, -66, -92, -48 },
+	{ -28, 100, 73, 37 },
+	{ 27, 105, 66, 35 },
+	{ -17, 113, -56, -11 },
+	{ 17, 112, -57, -11 },
+	{ 30, 71, -101, -31 },
+	{ -31, 75, -98, -30 },
+	{ -40, 38, -114, -40 },
+	{ 37, 44, -113, -38 },
+	{ 32, -77, -96, -40 },
+	{ -33, -75, -97, -42 },
+	{ 6, -121, 37, 5 },
+	{ -1, -125, 23, 0 },
+	{ -33, -72, 99, 32 },
+	{ 33, -72, 99, 32 },
+	{ 39, -35, 116, 42 },
+	{ -38, -42, 113, 39 },
+	{ 108, 5, -67, -13 },
+	{ 75, -81, -63, -20 },
+	{ -9, -81, -97, -36 },
+	{ -7, 37, -121, -34 },
+	{ -74, -83, -62, -22 },
+	{ -43, 18, -118, -33 },
+	{ 26, 37, -119, -34 },
+	{ 47, -62, -100, -36 },
+	{ -68, 106, 16, 17 },
+	{ 71, 103, 19, 19 },
+	{ -6, 126, -12, 7 },
+	{ 18, 125, -13, 6 },
+	{ 116, 23, -45, -15 },
+	{ -118, 23, -41, -17 },
+	{ -120, -7, -42, -19 },
+	{ 120, -9, -39, -16 },
+	{ 88, -89, -21, -15 },
+	{ -90, -87, -23, -18 },
+	{ 36, -120, 22, 1 },
+	{ -40, -118, 24, 1 },
+	{ -112, -40, 44, 15 },
+	{ 112, -41, 45, 18 },
+	{ 119, -11, 44, 20 },
+	{ -119, -7, 45, 18 },
+	{ -52, 114, -20, 5 },
+	{ 66, 108, -11, 9 },
+	{ 5, 121, -38, -1 },
+	{ 5, 120, -40, -2 },
+	{ 114, 18, -53, -18 },
+	{ -115, 19, -50, -20 },
+	{ -118, -1, -48, -21 },
+	{ 119, -1, -44, -17 },
+	{ 39, -120, -16, -14 },
+	{ -43, -119, 5, -9 },
+	{ -8, -126, 11, -6 },
+	{ -1, -127, 0, -8 },
+	{ -108, -56, 35, 11 },
+	{ 111, -49, 39, 15 },
+	{ 123, -7, 32, 17 },
+	{ -124, 3, 29, 14 },
+	{ -69, 101, 35, 23 },
+	{ 70, 99, 37, 25 },
+	{ -24, 124, -14, 5 },
+	{ 41, 119, -15, 5 },
+	{ 109, 42, -51, -15 },
+	{ -109, 41, -51, -18 },
+	{ -116, -9, -51, -22 },
+	{ 113, -9, -56, -22 },
+	{ 85, -87, -37, -20 },
+	{ -83, -87, -40, -23 },
+	{ 29, -121, 25, 2 },
+	{ -40, -117, 28, 2 },
+	{ -98, -48, 65, 21 },
+	{ 96, -50, 66, 24 },
+	{ 106, -9, 69, 28 },
+	{ -110, -6, 63, 24 },
+	{ -60, 97, 56, 30 },
+	{ 66, 92, 58, 32 },
+	{ -37, 115, -38, -5 },
+	{ 46, 111, -42, -6 },
+	{ 85, 57, -75, -23 },
+	{ -88, 55, -74, -25 },
+	{ -97, 18, -80, -30 },
+	{ 95, 18, -83, -29 },
+	{ 77, -77, -64, -29 },
+	{ -78, -75, -66, -31 },
+	{ 30, -119, 34, 5 },
+	{ -32, -116, 39, 6 },
+	{ -78, -59, 81, 26 },
+	{ 78, -60, 80, 27 },
+	{ 88, -25, 88, 33 },
+	{ -89, -24, 88, 31 },
+	{ -23, 93, 83, 43 },
+	{ 26, 90, 86, 45 },
+	{ -12, 118, -46, -5 },
+	{ 15, 113, -56, -9 },
+	{ 37, 59, -106, -34 },
+	{ -39, 55, -108, -36 },
+	{ -36, 35, -117, -42 },
+	{ 36, 30, -118, -42 },
+	{ 30, -65, -105, -46 },
+	{ -31, -62, -106, -47 },
+	{ 14, -121, 37, 3 },
+	{ -16, -118, 45, 7 },
+	{ -37, -58, 107, 36 },
+	{ 36, -61, 106, 36 },
+	{ 40, -32, 116, 43 },
+	{ -39, -32, 117, 42 },
+	{ 61, 72, -85, -15 },
+	{ 76, -14, -101, -28 },
+	{ -4, 17, -126, -38 },
+	{ -37, 58, -106, -29 },
+	{ -46, -13, -118, -36 },
+	{ -79, 67, -73, -12 },
+	{ 18, 61, -110, -28 },
+	{ 48, 14, -117, -37 },
+	{ -74, 95, 40, 27 },
+	{ 79, 90, 43, 30 },
+	{ -42, 120, 1, 13 },
+	{ 49, 117, 1, 13 },
+	{ 120, 20, -36, -13 },
+	{ -118, 23, -40, -16 },
+	{ -119, -1, -45, -21 },
+	{ 119, -3, -43, -18 },
+	{ 80, -93, -35, -23 },
+	{ -84, -86, -42, -26 },
+	{ 55, -113, 14, -3 },
+	{ -60, -111, 18, -3 },
+	{ -115, -26, 48, 17 },
+	{ 115, -29, 46, 19 },
+	{ 117, 8, 48, 24 },
+	{ -116, 8, 50, 22 },
+	{ -80, 92, 34, 25 },
+	{ 84, 92, 26, 24 },
+	{ -28, 124, 4, 15 },
+	{ 33, 122, -9, 11 },
+	{ 121, 11, -37, -14 },
+	{ -120, 13, -41, -18 },
+	{ -120, -6, -40, -20 },
+	{ 119, -7, -43, -18 },
+	{ 62, -102, -44, -26 },
+	{ -64, -96, -54, -30 },
+	{ 57, -112, -17, -13 },
+	{ -59, -112, -6, -11 },
+	{ -122, -19, 30, 12 },
+	{ 122, -20, 30, 15 },
+	{ 120, 15, 37, 21 },
+	{ -121, 17, 35, 18 },
+	{ -68, 98, 42, 28 },
+	{ 74, 92, 47, 31 },
+	{ -73, 101, -23, 1 },
+	{ 68, 103, -30, 0 },
+	{ 112, 31, -51, -17 },
+	{ -111, 33, -53, -19 },
+	{ -114, 1, -56, -24 },
+	{ 113, 0, -58, -22 },
+	{ 90, -77, -45, -25 },
+	{ -92, -70, -52, -29 },
+	{ 57, -110, 28, 2 },
+	{ -62, -107, 29, 2 },
+	{ -109, -25, 59, 21 },
+	{ 107, -30, 61, 24 },
+	{ 111, 1, 63, 28 },
+	{ -110, 0, 63, 26 },
+	{ -59, 97, 56, 33 },
+	{ 69, 87, 62, 36 },
+	{ -48, 110, -41, -4 },
+	{ 47, 111, -41, -3 },
+	{ 89, 45, -79, -25 },
+	{ -89, 45, -78, -27 },
+	{ -94, 14, -84, -33 },
+	{ 94, 13, -85, -31 },
+	{ 79, -65, -75, -34 },
+	{ -80, -61, -78, -37 },
+	{ 41, -114, 37, 5 },
+	{ -40, -114, 39, 4 },
+	{ -83, -47, 84, 28 },
+	{ 86, -48, 80, 28 },
+	{ 96, -21, 80, 32 },
+	{ -97, -8, 82, 32 },
+	{ 20, 121, 33, 23 },
+	{ 22, 121, 30, 22 },
+	{ -22, 121, 33, 22 },
+	{ -20, 122, 29, 21 },
+	{ 88, 72, 57, 29 },
+	{ 26, 117, 42, 26 },
+	{ 75, -103, 6, -4 },
+	{ 108, -56, 37, 11 },
+	{ 27, -124, 1, -9 },
+	{ 60, -112, -4, -9 },
+	{ -62, -111, 4, -8 },
+	{ -28, -124, 6, -8 },
+	{ -109, -58, 31, 7 },
+	{ -73, -104, 0, -8 },
+	{ -25, 117, 42, 26 },
+	{ -88, 71, 58, 28 },
+	{ 23, 124, 17, 17 },
+	{ 15, 125, 13, 16 },
+	{ -14, 125, 18, 17 },
+	{ -23, 124, 16, 17 },
+	{ 105, 63, 34, 21 },
+	{ 42, 118, 21, 19 },
+	{ 82, -94, 21, 2 },
+	{ 101, -71, 29, 7 },
+	{ 26, -122, 22, -2 },
+	{ 70, -104, 22, 1 },
+	{ -70, -103, 25, 0 },
+	{ -27, -122, 20, -3 },
+	{ -102, -71, 26, 4 },
+	{ -82, -94, 24, 1 },
+	{ -42, 117, 25, 20 },
+	{ -104, 63, 35, 19 },
+	{ 30, 123, 2, 12 },
+	{ 10, 127, 1, 12 },
+	{ -10, 127, 4, 13 },
+	{ -30, 123, -1, 11 },
+	{ 108, 62, 26, 18 },
+	{ 47, 118, 10, 16 },
+	{ 94, -80, 30, 6 },
+	{ 99, -74, 32, 7 },
+	{ 22, -118, 41, 5 },
+	{ 82, -90, 35, 7 },
+	{ -82, -88, 41, 7 },
+	{ -23, -119, 39, 4 },
+	{ -99, -74, 31, 5 },
+	{ -93, -79, 35, 6 },
+	{ -48, 117, 12, 15 },
+	{ -108, 61, 27, 16 },
+	{ 34, 121, -21, 5 },
+	{ 8, 125, -18, 6 },
+	{ -8, 125, -18, 6 },
+	{ -35, 120, -21, 4 },
+	{ 105, 71, -3, 10 },
+	{ 54, 114, -13, 9 },
+	{ 85, -91, 23, 3 },
+	{ 100, -75, 20, 4 },
+	{ 26, -123, 17, -3 },
+	{ 84, -93, 21, 2 },
+	{ -82, -96, 13, -2 },
+	{ -25, -123, 20, -2 },
+	{ -101, -74, 23, 2 },
+	{ -87, -90, 23, 1 },
+	{ -53, 115, -12, 8 },
+	{ -106, 70, -3, 7 },
+	{ 19, 117, -46, -2 },
+	{ 22, 113, -54, -5 },
+	{ -27, 115, -45, -3 },
+	{ -17, 113, -54, -5 },
+	{ 100, 44, -65, -9 },
+	{ 61, 96, -56, -4 },
+	{ 97, -82, 1, -2 },
+	{ 116, -34, -39, -8 },
+	{ 16, -125, -15, -12 },
+	{ 48, -117, -5, -8 },
+	{ -43, -118, 20, -2 },
+	{ -16, -126, -2, -9 },
+	{ -112, -35, -49, -13 },
+	{ -95, -84, -8, -7 },
+	{ -59, 94, -62, -8 },
+	{ -97, 42, -70, -13 },
+	{ -8, 120, 40, 25 },
+	{ 12, 80, 98, 43 },
+	{ 56, 67, 92, 41 },
+	{ -10, 120, 40, 25 },
+	{ 86, -27, 90, 32 },
+	{ 34, -39, 116, 40 },
+	{ 27, -116, 45, 8 },
+	{ 68, -100, 39, 7 },
+	{ -29, -115, 45, 7 },
+	{ -35, -32, 118, 41 },
+	{ -85, -16, 93, 33 },
+	{ -64, -102, 40, 6 },
+	{ -49, 77, 88, 39 },
+	{ -11, 84, 94, 42 },
+	{ 13, 120, 40, 25 },
+	{ 10, 120, 40, 25 },
+	{ 5, 58, -113, -24 },
+	{ 36, 50, -111, -23 },
+	{ 61, -3, -111, -26 },
+	{ 27, -12, -124, -31 },
+	{ 68, -67, -83, -24 },
+	{ 51, -113, -29, -14 },
+	{ 21, -120, -35, -16 },
+	{ 33, -74, -98, -29 },
+	{ -16, -121, -36, -17 },
+	{ -63, -107, -25, -13 },
+	{ -77, -65, -78, -24 },
+	{ -23, -74, -101, -30 },
+	{ -65, -2, -109, -27 },
+	{ -29, 61, -108, -22 },
+	{ -8, 58, -113, -24 },
+	{ -25, -13, -124, -32 },
+	{ 33, 123, -5, 10 },
+	{ 34, 118, -32, 2 },
+	{ 5, 127, -7, 10 },
+	{ 9, 123, -29, 3 },
+	{ -5, 127, -4, 11 },
+	{ -8, 122, -34, 1 },
+	{ -32, 123, -7, 9 },
+	{ -35, 118, -31, 1 },
+	{ 105, 71, 9, 14 },
+	{ 102, 72, -23, 4 },
+	{ 52, 116, -4, 12 },
+	{ 51, 112, -30, 4 },
+	{ 88, -88, 24, 3 },
+	{ 85, -92, 18, 1 },
+	{ 97, -78, 25, 5 },
+	{ 100, -77, 11, 1 },
+	{ 22, -122, 29, 1 },
+	{ 25, -124, 13, -4 },
+	{ 92, -86, 19, 2 },
+	{ 82, -96, 6, -2 },
+	{ -92, -83, 27, 3 },
+	{ -82, -95, 18, -1 },
+	{ -22, -122, 29, 0 },
+	{ -25, -124, 9, -6 },
+	{ -95, -81, 23, 2 },
+	{ -101, -75, 14, 0 },
+	{ -89, -89, 19, 0 },
+	{ -87, -91, 17, -1 },
+	{ -52, 116, 0, 11 },
+	{ -51, 113, -29, 3 },
+	{ -106, 69, 9, 11 },
+	{ -104, 70, -21, 3 },
+	{ 46, 10, -118, -36 },
+	{ 36, 56, -108, -25 },
+	{ 33, 65, -104, -22 },
+	{ 18, 62, -109, -22 },
+	{ 9, 84, -95, -14 },
+	{ 64, 86, -68, -12 },
+	{ 79, -13, -98, -37 },
+	{ 113, -58, 3, -20 },
+	{ 101, -77, 6, -21 },
+	{ -22, -109, 61, 3 },
+	{ -28, -53, 112, 26 },
+	{ 51, -78, 86, 7 },
+	{ -10, -126, 17, -13 },
+	{ -19, -109, 62, 3 },
+	{ -15, -125, 16, -13 },
+	{ 106, 66, 23, 5 },
+	{ 20, 121, -33, 8 },
+	{ 17, 126, -1, 17 },
+	{ 91, 68, 57, 17 },
+	{ 6, 112, 59, 33 },
+	{ 58, 36, 107, 29 },
+	{ 0, 90, 90, 39 },
+	{ -7, -119, -45, -30 },
+	{ -6, -54, -115, -39 },
+	{ 5, 20, -125, -32 },
+	{ 14, 18, -125, -33 },
+	{ 9, -60, -111, -41 },
+	{ 0, -111, -62, -34 },
+	{ 9, 110, -62, -1 },
+	{ -11, 126, 9, 23 },
+	{ -48, 117, 9, 26 },
+	{ -35, 106, -61, 4 },
+	{ -12, 114, -54, 4 },
+	{ -30, 79, -95, -10 },
+	{ -77, 100, 13, 28 },
+	{ -93, 77, 40, 34 },
+	{ -105, 67, 24, 30 },
+	{ -16, 113, 55, 35 },
+	{ -74, 67, 79, 41 },
+	{ -68, -3, 107, 37 },
+	{ -37, 5, 121, 39 },
+	{ -31, -71, 101, 21 },
+	{ -47, -50, 107, 27 },
+	{ -27, 98, 76, 39 },
+	{ -86, -12, 93, 34 },
+	{ -98, 55, 59, 37 },
+	{ -97, 12, 82, 36 },
+	{ -53, -62, 97, 24 },
+	{ -52, -66, 95, 23 },
+	{ -69, 92, 55, 37 },
+	{ 54, 14, -114, -35 },
+	{ 64, -42, -101, -42 },
+	{ 85, -83, -45, -35 },
+	{ 52, -108, -42, -34 },
+	{ 42, -116, 31, -14 },
+	{ 18, -123, 28, -13 },
+	{ -26, -89, 87, 14 },
+	{ -22, -94, 83, 11 },
+	{ 42, -119, -12, -26 },
+	{ 87, -30, -88, -39 },
+	{ 70, 8, -106, -36 },
+	{ 32, -71, -101, -42 },
+	{ -24, 30, -121, -26 },
+	{ -19, 63, -109, -19 },
+	{ -4, 81, -98, -15 },
+	{ 2, 82, -97, -15 },
+	{ 55, 97, -61, -8 },
+	{ 105, 2, -72, -30 },
+	{ 118, -42, 22, -12 },
+	{ 120, -42, 2, -18 },
+	{ -3, -110, 63, 2 },
+	{ -29, -65, 105, 23 },
+	{ 56, -68, 91, 10 },
+	{ 24, -122, 24, -14 },
+	{ 2, -107, 68, 3 },
+	{ 21, -123, 23, -14 },
+	{ 78, 98, -22, 1 },
+	{ -8, 109, -65, -1 },
+	{ -9, 120, -42, 7 },
+	{ 81, 96, 20, 12 },
+	{ -37, 114, 42, 33 },
+	{ 42, 52, 108, 34 },
+	{ -45, 101, 63, 38 },
+	{ 28, -121, -26, -28 },
+	{ 30, -83, -92, -41 },
+	{ 22, 31, -121, -31 },
+	{ 16, 17, -125, -34 },
+	{ 36, -62, -105, -42 },
+	{ 38, -116, -37, -31 },
+	{ -21, 105, -68, -1 },
+	{ -32, 114, -46, 8 },
+	{ -48, 108, -47, 8 },
+	{ -69, 81, -69, 1 },
+	{ -38, 99, -70, 0 },
+	{ -79, 27, -95, -13 },
+	{ -86, 90, -27, 16 },
+	{ -88, 80, 45, 35 },
+	{ -115, 45, 29, 28 },
+	{ -52, 113, 27, 30 },
+	{ -48, 52, 106, 43 },
+	{ -16, -26, 123, 32 },
+	{ -40, -37, 115, 31 },
+	{ -18, -81, 97, 17 },
+	{ 14, -73, 103, 17 },
+	{ -62, 87, 68, 39 },
+	{ 11, -31, 123, 28 },
+	{ -75, 62, 81, 41 },
+	{ -59, -21, 111, 35 },
+	{ 26, -78, 97, 13 },
+	{ 7, -22, 125, 31 },
+	{ -63, 107, 25, 30 },
+	{ -7, 36, -122, -27 },
+	{ 32, -63, -105, -42 },
+	{ 70, -100, 36, -13 },
+	{ 51, -112, -33, -31 },
+	{ 60, -98, 55, -6 },
+	{ 40, -113, 43, -9 },
+	{ 57, -79, 82, 5 },
+	{ 32, -99, 73, 2 },
+	{ 86, -92, 18, -18 },
+	{ 25, -52, -113, -42 },
+	{ -36, 32, -117, -23 },
+	{ -105, 72, -7, 23 },
+	{ -96, 73, 41, 34 },
+	{ -26, 124, -7, 21 },
+	{ 18, 118, -43, 5 },
+	{ 41, 82, -88, -15 },
+	{ 29, 95, -79, -9 },
+	{ 29, 36, -118, -29 },
+	{ 22, -24, -123, -39 },
+	{ -15, -114, -55, -31 },
+	{ -33, -123, -4, -17 },
+	{ -24, -125, -2, -18 },
+	{ 31, -90, 84, 6 },
+	{ 81, -94, -27, -31 },
+	{ 9, -120, -40, -31 },
+	{ 2, -124, -28, -28 },
+	{ 123, -15, -26, -22 },
+	{ 74, -19, 101, 17 },
+	{ -29, -22, 122, 33 },
+	{ -21, 34, 120, 41 },
+	{ 74, 19, 101, 23 },
+	{ 121, 13, -35, -20 },
+	{ 44, 39, -113, -29 },
+	{ 71, 17, -104, -33 },
+	{ 92, 10, -88, -33 },
+	{ 96, -27, -78, -37 },
+	{ 74, -37, -97, -40 },
+	{ 46, 82, -86, -15 },
+	{ 41, -43, -112, -42 },
+	{ 70, 102, -28, 2 },
+	{ 25, 121, -30, 9 },
+	{ 8, 126, 12, 23 },
+	{ 80, 84, 52, 19 },
+	{ -10, 89, 90, 40 },
+	{ -5, 127, 2, 22 },
+	{ -41, 96, 73, 40 },
+	{ -85, 45, 83, 40 },
+	{ -69, 95, 49, 37 },
+	{ -58, 41, 106, 42 },
+	{ 2, 120, -40, 9 },
+	{ -22, 118, -42, 11 },
+	{ 56, 75, -86, -18 },
+	{ -19, 92, -85, -5 },
+	{ -15, 119, -41, 10 },
+	{ -102, 35, 67, 36 },
+	{ -96, -25, 79, 29 },
+	{ -74, -67, 79, 19 },
+	{ -87, -7, 92, 34 },
+	{ -56, -55, 100, 25 },
+	{ -19, -124, 20, -12 },
+	{ -8, -124, 27, -11 },
+	{ -82, -43, 87, 26 },
+	{ -39, -105, 60, 4 },
+	{ -63, -96, 54, 7 },
+	{ 27, -124, -11, -26 },
+	{ 76, -96, -34, -34 },
+	{ 43, -120, 1, -24 },
+	{ -60, -7, 112, 36 },
+	{ -115, -17, 52, 25 },
+	{ 81, -30, -93, -39 },
+	{ 97, -3, 82, 36 },
+	{ 97, 46, 68, 40 },
+	{ 51, 116, 11, 28 },
+	{ -8, 110, -64, -2 },
+	{ -13, 85, -93, -14 },
+	{ -80, -13, -98, -39 },
+	{ 7, -118, -47, -30 },
+	{ -112, -60, 10, -21 },
+	{ -45, -76, 91, 8 },
+	{ 28, -75, 99, 20 },
+	{ 21, -13, 125, 36 },
+	{ -61, 32, 107, 27 },
+	{ 24, -96, 80, 11 },
+	{ 25, -109, 60, 3 },
+	{ 33, -72, 99, 21 },
+	{ 14, -125, 16, -13 },
+	{ 12, -123, 27, -10 },
+	{ -12, -119, 41, -8 },
+	{ -48, -114, -30, -32 },
+	{ 0, -114, -57, -33 },
+	{ -104, 69, 22, 3 },
+	{ -21, 125, 0, 17 },
+	{ -69, 86, -63, -13 },
+	{ -18, 113, -54, 0 },
+	{ -2, 94, 85, 38 },
+	{ 9, 126, 8, 23 },
+	{ 23, 113, 53, 35 },
+	{ -102, 55, 52, 10 },
+	{ -106, -69, -1, -25 },
+	{ 6, -54, -115, -39 },
+	{ -4, 20, -125, -32 },
+	{ -14, 20, -125, -33 },
+	{ -8, -63, -110, -41 },
+	{ -58, 3, -113, -38 },
+	{ -63, -50, -98, -43 },
+	{ -12, 60, -111, -23 },
+	{ -44, 47, -109, -29 },
+	{ -44, 48, -109, -29 },
+	{ 45, 108, -50, 10 },
+	{ 7, 113, -57, 3 },
+	{ 36, 112, -49, 9 },
+	{ 107, 60, 32, 34 },
+	{ 67, 95, 50, 38 },
+	{ 70, 85, 63, 41 },
+	{ 67, -3, 108, 39 },
+	{ 51, -63, 98, 25 },
+	{ 26, -89, 86, 14 },
+	{ -49, -116, -16, -29 },
+	{ -84, -82, -48, -38 },
+	{ -46, -4, -118, -39 },
+	{ -88, -36, -85, -41 },
+	{ -61, 25, -109, -34 },
+	{ -31, -117, 39, -11 },
+	{ 47, -75, 91, 20 },
+	{ 77, -23, 98, 35 },
+	{ 98, 40, 71, 40 },
+	{ 22, -89, 88, 14 },
+	{ 50, -50, 105, 28 },
+	{ 40, -1, 121, 39 },
+	{ 37, 54, 109, 44 },
+	{ 27, 72, -101, -12 },
+	{ 54, -13, 114, 38 },
+	{ 86, 79, 50, 38 },
+	{ 53, 111, -31, 15 },
+	{ 21, 105, -68, 0 },
+	{ -7, 83, -96, -15 },
+	{ -106, -8, -70, -34 },
+	{ -37, -119, -25, -29 },
+	{ -122, -34, 3, -20 },
+	{ -55, -69, 91, 9 },
+	{ 22, -81, 95, 18 },
+	{ 38, -21, 119, 36 },
+	{ -47, 47, 108, 32 },
+	{ -1, -107, 68, 3 },
+	{ 5, -110, 63, 2 },
+	{ 20, -77, 99, 19 },
+	{ -18, -124, 21, -15 },
+	{ -23, -121, 31, -12 },
+	{ -40, -110, 51, -7 },
+	{ -52, -115, -13, -27 },
+	{ -43, -113, -40, -33 },
+	{ -70, 103, -23, 0 },
+	{ 14, 119, -43, 8 },
+	{ -56, 96, -61, -10 },
+	{ 10, 108, -65, -1 },
+	{ 30, 116, 42, 33 },
+	{ 35, 115, -40, 11 },
+	{ 54, 112, 27, 32 },
+	{ -81, 95, 21, 10 },
+	{ -116, -46, 23, -15 },
+	{ -36, -81, -91, -42 },
+	{ -24, 18, -123, -35 },
+	{ -11, 34, -122, -30 },
+	{ -39, -48, -111, -43 },
+	{ 7, 38, -121, -27 },
+	{ -21, -30, -122, -41 },
+	{ 2, 72, -105, -18 },
+	{ 20, 62, -109, -18 },
+	{ 33, 28, -120, -24 },
+	{ 86, 92, -15, 22 },
+	{ 40, 102, -64, 3 },
+	{ 82, 90, -35, 15 },
+	{ 104, 72, -6, 24 },
+	{ 61, 103, 42, 35 },
+	{ 53, 61, 98, 44 },
+	{ 8, -45, 118, 28 },
+	{ -7, -30, 123, 29 },
+	{ -63, -81, 75, 0 },
+	{ -80, -96, 20, -20 },
+	{ -61, -104, 40, -12 },
+	{ 20, -25, -123, -34 },
+	{ -37, -66, -102, -43 },
+	{ 29, 23, -121, -26 },
+	{ -61, -111, -12, -28 },
+	{ -42, -82, 88, 7 },
+	{ -2, -30, 123, 30 },
+	{ 73, 55, 88, 43 },
+	{ -29, -93, 81, 5 },
+	{ -3, -54, 115, 24 },
+	{ 39, -34, 116, 33 },
+	{ 63, 51, 98, 44 },
+	{ 90, 25, -86, -7 },
+	{ -44, -118, -18, -30 },
+	{ 63, -96, 54, 8 },
+	{ 86, -49, 80, 26 },
+	{ 82, -32, 92, 31 },
+	{ 59, 40, 105, 43 },
+	{ 43, 96, 72, 41 },
+	{ 7, 127, 6, 23 },
+	{ -27, 117, -41, 4 },
+	{ -74, 99, -27, -1 },
+	{ -29, 95, -79, -10 },
+	{ -37, 81, -90, -16 },
+	{ -14, 121, -35, 8 },
+	{ -119, 27, -36, -21 },
+	{ -19, -38, -120, -41 },
+	{ -32, 37, -117, -30 },
+	{ -117, -44, -23, -28 },
+	{ -64, 104, 34, 18 },
+	{ -72, 2, 105, 20 },
+	{ -14, 125, 17, 23 },
+	{ 78, 78, 63, 41 },
+	{ 86, 46, 81, 42 },
+	{ 103, 46, 58, 38 },
+	{ 26, 118, -38, 13 },
+	{ 26, 124, -7, 22 },
+	{ 91, 78, 42, 37 },
+	{ 102, 75, -9, 25 },
+	{ 115, -12, 52, 29 },
+	{ 17, 89, 89, 41 },
+	{ 23, 34, 120, 41 },
+	{ 62, -7, 111, 38 },
+	{ 29, -22, 122, 34 },
+	{ -36, -91, 81, 3 },
+	{ 24, -115, -48, -28 },
+	{ 22, -113, -55, -30 },
+	{ -57, -112, -18, -30 },
+	{ 15, -126, 6, -16 },
+	{ 21, -124, 19, -12 },
+	{ -2, -124, -28, -28 },
+	{ -74, -18, 101, 15 },
+	{ 32, -59, 108, 24 },
+	{ 57, -49, 103, 28 },
+	{ 70, -73, 78, 19 },
+	{ 73, -69, 77, 20 },
+	{ 29, -112, 53, 1 },
+	{ 39, -105, 59, 5 },
+	{ -19, -123, 24, -16 },
+	{ -56, -102, -51, -38 },
+	{ -75, -38, -95, -42 },
+	{ -72, 12, -104, -36 },
+	{ -91, 8, -88, -35 },
+	{ -95, -51, -67, -40 },
+	{ -75, -97, -32, -35 },
+	{ -82, -26, -93, -41 },
+	{ 21, 92, -85, -4 },
+	{ 41, 118, -25, 18 },
+	{ -63, 67, -88, -22 },
+	{ -49, 77, -88, -18 },
+	{ -45, 25, -116, -33 },
+	{ -39, -53, -109, -43 },
+	{ -7, -120, -40, -31 },
+	{ -23, -125, -8, -25 },
+	{ -18, -13, 125, 35 },
+	{ -38, -21, 119, 35 },
+	{ -32, -65, 105, 22 },
+	{ 52, -103, -53, -37 },
+	{ 25, -124, -8, -25 },
+	{ 0, 88, 91, 39 },
+	{ 47, 92, 74, 41 },
+	{ 3, 122, -35, 11 },
+	{ 24, -10, -124, -32 },
+	{ 95, -29, -79, -14 },
+	{ 113, -55, 17, 8 },
+	{ 84, -77, 56, 9 },
+	{ 71, -19, 103, 34 },
+	{ 49, 25, 114, 44 },
+	{ 9, 68, 107, 46 },
+	{ 12, 100, 78, 46 },
+	{ -123, 26, 17, -4 },
+	{ -87, 36, -85, -26 },
+	{ -111, -48, 38, -14 },
+	{ -99, -53, -59, -41 },
+	{ -27, 61, -108, -19 },
+	{ -21, 113, -54, 9 },
+	{ -5, 126, 18, 34 },
+	{ -34, 122, 8, 26 },
+	{ -15, 107, 67, 41 },
+	{ 17, 63, 109, 47 },
+	{ 33, 20, 121, 42 },
+	{ 19, 26, 123, 43 },
+	{ 23, -25, 122, 31 },
+	{ -6, -90, 89, 4 },
+	{ -91, -70, 54, -12 },
+	{ 55, -29, 111, 31 },
+	{ 20, 64, 108, 47 },
+	{ 21, 45, 117, 45 },
+	{ -61, 83, 73, 31 },
+	{ -58, 111, 19, 23 },
+	{ -79, 78, -61, -9 },
+	{ -98, 44, -67, -21 },
+	{ -77, 82, 60, 25 },
+	{ -15, 97, 80, 43 },
+	{ -47, 62, 100, 35 },
+	{ 56, 21, 112, 43 },
+	{ 56, 23, 112, 44 },
+	{ 77, 4, 101, 39 },
+	{ 114, 2, 57, 33 },
+	{ 93, -78, -39, -15 },
+	{ 67, -80, 73, 11 },
+	{ 54, -115, -3, -20 },
+	{ 29, -124, 5, -23 },
+	{ 14, -103, -73, -42 },
+	{ -60, -102, -46, -43 },
+	{ -11, -61, -111, -46 },
+	{ -24, -8, -125, -39 },
+	{ -11, -54, -114, -45 },
+	{ 18, -97, -80, -42 },
+	{ -32, -6, -123, -39 },
+	{ -20, -48, -116, -45 },
+	{ -43, -15, -119, -41 },
+	{ -92, -67, -57, -42 },
+	{ 58, -106, -37, -27 },
+	{ 5, -46, -118, -42 },
+	{ 12, -81, -97, -43 },
+	{ 31, -90, 84, 7 },
+	{ 23, -59, -110, -40 },
+	{ -55, -8, -114, -40 },
+	{ -81, 19, -96, -33 },
+	{ -81, 41, -89, -25 },
+	{ -1, 22, -125, -28 },
+	{ 102, 4, -76, -6 },
+	{ 121, -27, -28, 2 },
+	{ 108, -64, 19, 4 },
+	{ 93, -30, 81, 27 },
+	{ 47, 17, 117, 43 },
+	{ 10, 65, 108, 47 },
+	{ -23, 100, 75, 42 },
+	{ -113, -25, 52, -4 },
+	{ -118, 3, -48, -26 },
+	{ -88, -68, 61, -9 },
+	{ -101, -75, -16, -34 },
+	{ -63, 37, -104, -27 },
+	{ -77, 90, -45, 0 },
+	{ -60, 110, 23, 26 },
+	{ -61, 108, 25, 26 },
+	{ -32, 101, 70, 40 },
+	{ 25, 52, 113, 47 },
+	{ 49, 12, 117, 42 },
+	{ 64, -13, 109, 35 },
+	{ 74, -56, 87, 20 },
+	{ 57, -90, 69, 5 },
+	{ -68, -79, 72, -6 },
+	{ 78, -42, 92, 25 },
+	{ -14, 64, 109, 44 },
+	{ 9, 40, 120, 44 },
+	{ -94, 53, 66, 19 },
+	{ -89, 87, 24, 17 },
+	{ -100, 73, -29, -3 },
+	{ -117, 38, -31, -14 },
+	{ -104, 49, 54, 13 },
+	{ -62, 85, 71, 33 },
+	{ -85, 40, 85, 22 },
+	{ 40, 25, 118, 44 },
+	{ 37, 29, 118, 45 },
+	{ 103, 2, 74, 35 },
+	{ 121, 14, 36, 30 },
+	{ 124, -27, -11, 7 },
+	{ 92, -78, 40, 4 },
+	{ 80, -94, -29, -20 },
+	{ 65, -109, -7, -20 },
+	{ 13, -79, -99, -44 },
+	{ -53, -113, -23, -39 },
+	{ -20, -35, -120, -44 },
+	{ -40, -5, -120, -39 },
+	{ -7, -52, -116, -45 },
+	{ 41, -85, -85, -39 },
+	{ -51, -9, -116, -40 },
+	{ 0, -46, -118, -43 },
+	{ -51, -6, -116, -40 },
+	{ -105, -70, -17, -33 },
+	{ 92, -77, -42, -18 },
+	{ 42, -23, -118, -32 },
+	{ 53, -72, -91, -35 },
+	{ 77, -81, 60, 7 },
+	{ 48, -24, -115, -31 },
+	{ -72, 8, -104, -36 },
+	{ -89, 20, -88, -31 },
+	{ -116, 39, -35, -15 },
+	{ -40, 28, -117, -30 },
+	{ -30, -28, -120, -42 },
+	{ -19, -69, -105, -46 },
+	{ -3, -65, -109, -44 },
+	{ 0, -68, -108, -43 },
+	{ -104, -73, 7, -27 },
+	{ -104, -10, 72, 4 },
+	{ 9, 110, 62, 42 },
+	{ -94, -9, 85, 9 },
+	{ -98, -80, 9, -27 },
+	{ -51, -110, 37, -20 },
+	{ 17, -125, -13, -28 },
+	{ 6, -108, -67, -40 },
+	{ 16, 31, 122, 42 },
+	{ 20, -48, 116, 24 },
+	{ -47, -20, 116, 21 },
+	{ 9, 78, 100, 45 },
+	{ 10, 86, 93, 45 },
+	{ 34, 36, 117, 44 },
+	{ -3, 112, 60, 41 },
+	{ -55, 112, 22, 23 },
+	{ -19, 124, 17, 30 },
+	{ -33, 115, -42, 10 },
+	{ -80, 90, -40, -2 },
+	{ -19, 105, 69, 39 },
+	{ -82, 95, 17, 14 },
+	{ -20, 85, 92, 41 },
+	{ 8, 127, -1, 29 },
+	{ -121, 32, 22, -2 },
+	{ -88, -4, -91, -36 },
+	{ 0, 74, -104, -11 },
+	{ 6, 113, -58, 10 },
+	{ 0, 1, -127, -33 },
+	{ -26, 0, -124, -36 },
+	{ -38, 72, -98, -15 },
+	{ -56, -17, -113, -41 },
+	{ -86, 43, -83, -24 },
+	{ -95, 80, -27, -3 },
+	{ -82, 97, 11, 13 },
+	{ -80, 41, -90, -26 },
+	{ 20, -102, -73, -39 },
+	{ 43, -117, -24, -26 },
+	{ 60, -105, 38, -4 },
+	{ 80, -96, 20, -4 },
+	{ 48, -85, -81, -33 },
+	{ 67, -84, -68, -27 },
+	{ -21, -33, -121, -42 },
+	{ 19, -99, -77, -40 },
+	{ 113, -52, -28, -2 },
+	{ 47, -41, -111, -31 },
+	{ 52, -110, -36, -26 },
+	{ 108, -60, 30, 10 },
+	{ 103, -39, 63, 23 },
+	{ 59, 27, 109, 44 },
+	{ 86, -40, 84, 26 },
+	{ 52, 37, 110, 45 },
+	{ 60, -47, 101, 25 },
+	{ 95, 16, 83, 40 },
+	{ -1, 66, 109, 43 },
+	{ -46, 43, 110, 46 },
+	{ -74, 4, 103, 38 },
+	{ -71, -17, 104, 33 },
+	{ -28, 33, 119, 44 },
+	{ -23, 41, 118, 45 },
+	{ -10, 100, 78, 46 },
+	{ 7, 126, 11, 32 },
+	{ 21, 113, -54, 9 },
+	{ 27, 52, -113, -22 },
+	{ 100, -49, -60, -38 },
+	{ 110, -51, 39, -12 },
+	{ 111, 32, 52, 11 },
+	{ 97, 0, -82, -32 },
+	{ 15, -47, -117, -44 },
+	{ 91, -70, -55, -40 },
+	{ 25, -2, -125, -37 },
+	{ 46, 47, -108, -23 },
+	{ 69, 34, -101, -27 },
+	{ 43, -15, -119, -40 },
+	{ 30, -11, -123, -39 },
+	{ 48, 101, -61, 2 },
+	{ 79, 85, -51, -3 },
+	{ 32, 122, 16, 29 },
+	{ 62, 110, 12, 22 },
+	{ -13, 61, 111, 46 },
+	{ 25, 104, 69, 40 },
+	{ 60, 82, 76, 33 },
+	{ 68, 85, 66, 30 },
+	{ 86, 42, -83, -22 },
+	{ 100, 45, -64, -18 },
+	{ 63, 86, 70, 32 },
+	{ -21, 65, 107, 47 },
+	{ -50, 26, 114, 43 },
+	{ -51, 27, 113, 43 },
+	{ -26, 45, 116, 45 },
+	{ 7, 97, 82, 44 },
+	{ -26, -3, 124, 36 },
+	{ -28, -54, 111, 21 },
+	{ 98, -63, 51, -10 },
+	{ 37, -85, 87, 1 },
+	{ -31, -89, 85, 6 },
+	{ -66, -65, 87, 16 },
+	{ -47, -2, 118, 37 },
+	{ -84, -67, 68, 13 },
+	{ -106, -67, -21, -8 },
+	{ -56, -114, 4, -19 },
+	{ -72, -104, -8, -18 },
+	{ -30, -123, 14, -21 },
+	{ 45, -113, -36, -40 },
+	{ -9, -105, -71, -42 },
+	{ -94, 3, 85, 35 },
+	{ -88, -24, -88, -18 },
+	{ 16, 5, -126, -34 },
+	{ 8, -42, -120, -43 },
+	{ -5, -46, -118, -42 },
+	{ -110, -56, 29, 8 },
+	{ -28, -92, -83, -41 },
+	{ 19, -47, -116, -45 },
+	{ -21, -101, -74, -41 },
+	{ 8, -60, -112, -45 },
+	{ 52, -8, -115, -39 },
+	{ -22, 43, 117, 46 },
+	{ -103, 1, 74, 32 },
+	{ -90, -26, 85, 27 },
+	{ -65, -12, 109, 34 },
+	{ -26, 51, 113, 47 },
+	{ 22, 99, 77, 43 },
+	{ 56, 112, 22, 28 },
+	{ 77, 93, -40, 4 },
+	{ 65, 40, -102, -25 },
+	{ 105, -69, -17, -31 },
+	{ 86, -71, 61, -7 },
+	{ 99, -18, 77, 8 },
+	{ 113, -40, -42, -32 },
+	{ 18, -35, -121, -43 },
+	{ 104, -71, -17, -31 },
+	{ 44, 1, -119, -37 },
+	{ 70, 30, -102, -28 },
+	{ 87, 37, -85, -23 },
+	{ 50, -7, -116, -39 },
+	{ 48, -13, -117, -40 },
+	{ 81, 87, -44, 1 },
+	{ 100, 74, -26, 1 },
+	{ 62, 108, 24, 27 },
+	{ 84, 88, 35, 23 },
+	{ -24, 51, 114, 47 },
+	{ 51, 81, 83, 38 },
+	{ 94, 50, 70, 21 },
+	{ 98, 53, 61, 19 },
+	{ 102, 47, -59, -15 },
+	{ 118, 37, -28, -11 },
+	{ 96, 54, 63, 20 },
+	{ 15, 62, 110, 44 },
+	{ -51, 14, 116, 41 },
+	{ -51, 25, 114, 43 },
+	{ 24, 48, 115, 41 },
+	{ 33, 100, 71, 41 },
+	{ -66, -18, 107, 32 },
+	{ -77, -72, 72, 11 },
+	{ 86, -64, 69, -3 },
+	{ -1, -91, 89, 4 },
+	{ -76, -82, 60, 5 },
+	{ -90, -70, 56, 8 },
+	{ -81, -49, 84, 20 },
+	{ -108, -58, 32, 6 },
+	{ -125, -23, -4, 7 },
+	{ -86, -92, -11, -16 },
+	{ -95, -77, -36, -18 },
+	{ -64, -109, -8, -21 },
+	{ 18, -124, -20, -36 },
+	{ -16, -77, -99, -44 },
+	{ -117, 9, 49, 29 },
+	{ -101, 3, -77, -9 },
+	{ 1, 22, -125, -28 },
+	{ -55, -32, -110, -32 },
+	{ -74, -29, -99, -26 },
+	{ -121, -31, -22, 0 },
+	{ -52, -71, -91, -37 },
+	{ 2, -45, -119, -44 },
+	{ -22, -74, -101, -43 },
+	{ 10, -55, -114, -46 },
+	{ 66, 10, -108, -34 },
+	{ -57, 27, 110, 42 },
+	{ -106, -59, 38, 10 },
+	{ -84, -31, 90, 27 },
+	{ -57, -32, 109, 29 },
+	{ -23, -47, 116, 24 },
+	{ 62, -15, 110, 20 },
+	{ 101, -5, 76, 9 },
+	{ -10, 72, 104, 45 },
+	{ -10, 104, 72, 44 },
+	{ 108, 51, 43, 12 },
+	{ -4, 106, -70, 5 },
+	{ -9, 126, 8, 31 },
+	{ 105, -46, -54, -35 },
+	{ 106, -69, 3, -25 },
+	{ 104, -11, 72, 7 },
+	{ -14, 80, 98, 46 },
+	{ 4, 112, 61, 41 },
+	{ 54, 112, 23, 25 },
+	{ 18, 125, 16, 30 },
+	{ 21, 106, 67, 39 },
+	{ -12, 83, 95, 45 },
+	{ -47, 45, 109, 45 },
+	{ -63, 25, 107, 42 },
+	{ 5, 76, 101, 43 },
+	{ -15, 40, 119, 43 },
+	{ -33, 39, 116, 44 },
+	{ 100, -77, 12, -24 },
+	{ -15, -126, -12, -29 },
+	{ -25, -103, 70, 0 },
+	{ 60, -102, 46, -16 },
+	{ -62, -99, 49, -1 },
+	{ -20, -102, -73, -39 },
+	{ -22, -101, -74, -39 },
+	{ -57, -110, -29, -25 },
+	{ -43, -117, -22, -27 },
+	{ 0, -70, -106, -43 },
+	{ 1, -68, -107, -44 },
+	{ -5, -108, -67, -41 },
+	{ -84, -91, 31, -2 },
+	{ -103, -34, 66, 23 },
+	{ -114, -54, -16, -2 },
+	{ -61, -82, -75, -30 },
+	{ -67, -87, -63, -28 },
+	{ 21, -33, -121, -41 },
+	{ -42, -34, -115, -32 },
+	{ 46, -12, -118, -39 },
+	{ 18, -69, -105, -45 },
+	{ 56, -18, -113, -40 },
+	{ 81, 47, -86, -22 },
+	{ 37, 64, -103, -17 },
+	{ 1, 73, -104, -11 },
+	{ 23, -10, -124, -38 },
+	{ 0, -10, -127, -36 },
+	{ 34, 110, -53, 7 },
+	{ 79, 93, -35, 2 },
+	{ 93, 83, -25, 1 },
+	{ 86, 43, -83, -22 },
+	{ 47, 31, -114, -28 },
+	{ 80, 99, -3, 12 },
+	{ 82, 95, 19, 16 },
+	{ 41, 94, 75, 36 },
+	{ 9, 84, 95, 43 },
+	{ -65, 24, -106, -32 },
+	{ -46, 48, -108, -24 },
+	{ -48, 103, -56, 3 },
+	{ -88, 39, -83, -25 },
+	{ -77, 48, -89, -22 },
+	{ -80, 93, -33, 4 },
+	{ -6, 77, 101, 43 },
+	{ 12, 83, 96, 46 },
+	{ 25, -111, 57, -5 },
+	{ 82, 20, -95, -30 },
+	{ 87, 16, -91, -30 },
+	{ -7, -43, 119, 17 },
+	{ -27, 1, 124, 21 },
+	{ -15, 35, 121, 23 },
+	{ -11, 55, 114, 24 },
+	{ -41, 21, 118, 21 },
+	{ -49, -10, 117, 15 },
+	{ -41, -41, 113, 8 },
+	{ -18, -77, 100, -4 },
+	{ -108, -61, 29, 2 },
+	{ -120, -30, 27, 4 },
+	{ -124, -15, 23, 4 },
+	{ -124, -14, 22, 4 },
+	{ -123, -18, 24, 4 },
+	{ -123, -18, 27, 4 },
+	{ -122, -18, 31, 5 },
+	{ -112, 9, 60, 15 },
+	{ -105, -50, -51, -7 },
+	{ -103, -25, -70, -8 },
+	{ -97, -16, -80, -8 },
+	{ -90, -21, -88, -10 },
+	{ -84, -19, -94, -10 },
+	{ -80, 3, -98, -6 },
+	{ -84, 35, -88, 2 },
+	{ -71, 87, -60, 20 },
+	{ -70, -13, -105, -11 },
+	{ -52, 2, -116, -11 },
+	{ -41, 0, -120, -11 },
+	{ -23, -3, -125, -11 },
+	{ -10, -5, -126, -11 },
+	{ -9, 9, -126, -9 },
+	{ -1, 29, -124, -4 },
+	{ 1, 56, -114, 4 },
+	{ -64, 17, -108, -10 },
+	{ -23, 39, -119, -8 },
+	{ -30, 23, -121, -9 },
+	{ 30, 10, -123, -8 },
+	{ 27, 5, -124, -9 },
+	{ 37, -6, -121, -10 },
+	{ 39, 12, -120, -6 },
+	{ 46, 30, -114, -1 },
+	{ -29, 46, -115, -8 },
+	{ 35, 80, -92, -2 },
+	{ 74, 54, -89, 0 },
+	{ 47, 26, -115, -6 },
+	{ 63, 7, -110, -6 },
+	{ 57, -22, -111, -10 },
+	{ 62, -7, -111, -7 },
+	{ 70, 11, -106, -3 },
+	{ 45, 57, -105, -2 },
+	{ 66, 84, -69, 2 },
+	{ 69, 77, -73, 2 },
+	{ 76, 42, -93, -1 },
+	{ 90, 18, -88, -1 },
+	{ 72, -25, -102, -8 },
+	{ 84, -2, -95, -3 },
+	{ 106, 40, -58, 6 },
+	{ 108, 63, -23, 8 },
+	{ 108, 62, -26, 8 },
+	{ 109, 35, -54, 4 },
+	{ 111, 16, -59, 3 },
+	{ 81, -39, -90, -8 },
+	{ 92, -23, -85, -3 },
+	{ 125, 17, -14, 11 },
+	{ 121, 37, 7, 12 },
+	{ 121, 38, 4, 12 },
+	{ 125, 16, -17, 9 },
+	{ 124, -3, -28, 7 },
+	{ 91, -55, -69, -5 },
+	{ 105, -35, -62, 0 },
+	{ 77, -61, 81, 24 },
+	{ 62, -48, 100, 25 },
+	{ 58, -34, 108, 25 },
+	{ 64, -34, 104, 25 },
+	{ 68, -37, 101, 24 },
+	{ 71, -49, 93, 23 },
+	{ 64, -30, 106, 27 },
+	{ -115, -45, -30, -12 },
+	{ -117, -45, -21, -11 },
+	{ -122, -36, -4, -10 },
+	{ -124, -7, 27, -5 },
+	{ -105, 40, 59, 3 },
+	{ -93, 49, 71, 7 },
+	{ -83, 54, 80, 10 },
+	{ -109, -66, -7, -9 },
+	{ -111, -62, 7, -8 },
+	{ -114, -49, 28, -6 },
+	{ -110, -15, 61, -1 },
+	{ -91, 26, 85, 6 },
+	{ -85, 33, 89, 8 },
+	{ -74, 35, 97, 11 },
+	{ -83, -91, 32, -4 },
+	{ -66, -80, 73, 0 },
+	{ -62, -55, 96, 3 },
+	{ -75, -19, 101, 5 },
+	{ -69, 14, 106, 9 },
+	{ -69, 15, 106, 10 },
+	{ -56, 20, 112, 13 },
+	{ 9, -93, 86, 5 },
+	{ 40, -46, 112, 10 },
+	{ -45, -27, 115, 8 },
+	{ -32, -14, 122, 10 },
+	{ -61, 3, 111, 9 },
+	{ -57, -7, 113, 8 },
+	{ -43, 2, 119, 11 },
+	{ -28, 9, 124, 14 },
+	{ 68, -55, 92, 9 },
+	{ 57, -21, 111, 12 },
+	{ 26, -8, 124, 13 },
+	{ 26, -8, 124, 13 },
+	{ -27, -6, 124, 11 },
+	{ -47, -12, 118, 9 },
+	{ -39, -6, 121, 11 },
+	{ 0, -8, 127, 13 },
+	{ 92, -40, 78, 9 },
+	{ 104, -13, 72, 9 },
+	{ 100, 0, 78, 11 },
+	{ 73, -2, 104, 13 },
+	{ 24, -5, 125, 14 },
+	{ 14, -20, 125, 11 },
+	{ 37, -32, 117, 9 },
+	{ 67, -25, 105, 11 },
+	{ 115, -30, 46, 6 },
+	{ 121, -13, 37, 6 },
+	{ 123, -7, 30, 5 },
+	{ 121, -10, 37, 6 },
+	{ 115, -17, 52, 7 },
+	{ 105, -31, 64, 6 },
+	{ 116, -42, 31, 0 },
+	{ 125, -11, 20, 7 },
+	{ 121, -15, 37, 6 },
+	{ 120, -1, 41, 7 },
+	{ 118, 4, 47, 8 },
+	{ 115, 1, 55, 9 },
+	{ 114, -5, 56, 9 },
+	{ 103, -17, 72, 9 },
+	{ 72, -40, 96, 7 },
+	{ 65, -62, 90, 1 },
+	{ 115, 50, 17, 25 },
+	{ 111, 58, 21, 26 },
+	{ 109, 62, 21, 27 },
+	{ 107, 69, -3, 25 },
+	{ 60, 46, -102, 5 },
+	{ 15, 89, -89, 16 },
+	{ -4, 126, 15, 41 },
+	{ -4, 89, 90, 41 },
+	{ 13, -76, -101, -4 },
+	{ 3, -54, -115, -6 },
+	{ -58, -63, -94, -10 },
+	{ -64, -70, -84, -10 },
+	{ -47, -92, -74, -9 },
+	{ -60, -92, -63, -9 },
+	{ -68, -107, -13, -4 },
+	{ -56, -105, 45, 3 },
+	{ 127, 9, 4, 13 },
+	{ -121, -32, -23, -12 },
+	{ 38, -83, -89, 0 },
+	{ 123, 25, 17, 14 },
+	{ -122, -33, -14, -11 },
+	{ 123, 27, 15, 13 },
+	{ -124, -27, -2, -10 },
+	{ 127, 3, 3, 12 },
+	{ -126, -1, 17, -7 },
+	{ 126, -13, -6, 10 },
+	{ -115, 41, 35, -2 },
+	{ 101, -70, -34, 0 },
+	{ -92, 63, 61, 7 },
+	{ 112, -48, -35, 4 },
+	{ 114, 56, 4, 24 },
+	{ -88, 66, 63, 8 },
+	{ 124, 5, 25, 16 },
+	{ -125, -18, -17, -13 },
+	{ 38, -95, -75, 3 },
+	{ 122, 14, 33, 16 },
+	{ -122, -37, 4, -8 },
+	{ 123, 15, 30, 16 },
+	{ -123, -31, 11, -7 },
+	{ 125, -7, 20, 14 },
+	{ -125, -5, 23, -6 },
+	{ 123, -29, 15, 13 },
+	{ -122, 30, 17, -6 },
+	{ 105, -71, -13, 4 },
+	{ -95, 63, 56, 6 },
+	{ 113, -57, -8, 8 },
+	{ 114, 56, 6, 24 },
+	{ -105, 60, 39, 1 },
+	{ 68, -39, -100, -10 },
+	{ 74, -44, -93, -10 },
+	{ 78, -66, -75, -9 },
+	{ 81, -90, -38, -5 },
+	{ 88, -90, -16, 0 },
+	{ 73, -66, 80, 19 },
+	{ -92, 64, 60, 7 },
+	{ -104, 51, 52, 3 },
+	{ -103, 36, 66, 4 },
+	{ -95, 20, 81, 5 },
+	{ -82, 4, 97, 6 },
+	{ -29, -96, -78, -22 },
+	{ 110, 40, 49, 18 },
+	{ 6, -88, -91, -20 },
+	{ 15, -123, -29, -12 },
+	{ 7, -106, -70, -18 },
+	{ 21, -117, -44, -14 },
+	{ 89, 84, 34, 18 },
+	{ 99, 73, 31, 18 },
+	{ 95, 77, 35, 18 },
+	{ 102, 61, 46, 19 },
+	{ 73, 59, 85, 30 },
+	{ 30, 56, 110, 28 },
+	{ 28, 69, 103, 29 },
+	{ 27, 90, 86, 30 },
+	{ 24, 112, 56, 28 },
+	{ 13, 121, 36, 24 },
+	{ -38, 21, 119, 21 },
+	{ -36, 22, 120, 22 },
+	{ -38, 20, 120, 21 },
+	{ -114, -55, 5, -14 },
+	{ -120, -40, 10, -13 },
+	{ -108, -66, -8, -17 },
+	{ -108, -66, -7, -17 },
+	{ -86, -94, 1, -17 },
+	{ 31, 40, 117, 20 },
+	{ 5, 69, 106, 20 },
+	{ -7, 98, 80, 18 },
+	{ -22, 111, 58, 14 },
+	{ -40, 112, 45, 10 },
+	{ -56, -11, 113, 17 },
+	{ -80, -28, 95, 11 },
+	{ -70, -54, 92, 12 },
+	{ -50, -73, 91, 14 },
+	{ -24, -88, 89, 17 },
+	{ -39, -95, -75, -5 },
+	{ -65, -76, -78, -9 },
+	{ -74, -72, -74, -10 },
+	{ -88, -76, -50, -10 },
+	{ -86, -92, -20, -8 },
+	{ -37, -121, 15, -3 },
+	{ 35, -120, 24, 1 },
+	{ 52, -108, 42, 3 },
+	{ 65, -98, 48, 4 },
+	{ 17, -107, 66, 6 },
+	{ 44, -48, 109, 15 },
+	{ 62, 3, 111, 18 },
+	{ 57, 32, 109, 21 },
+	{ 33, 50, 112, 23 },
+	{ 13, 30, 123, 22 },
+	{ 9, 4, 127, 18 },
+	{ 1, -25, 125, 12 },
+	{ 12, -78, 99, -5 },
+	{ 33, 81, 92, 39 },
+	{ 43, 111, 46, 41 },
+	{ 66, 102, -36, 29 },
+	{ 106, 69, -5, 26 },
+	{ -100, 70, -36, 26 },
+	{ -17, -96, -82, -48 },
+	{ 2, -83, -96, -50 },
+	{ -87, -6, -92, -14 },
+	{ -87, -20, -90, -18 },
+	{ -33, -103, -66, -44 },
+	{ -85, -52, -78, -25 },
+	{ -44, -111, -44, -41 },
+	{ -86, -68, -65, -27 },
+	{ -77, -100, -11, -28 },
+	{ -102, -65, -39, -20 },
+	{ -82, -94, 24, -19 },
+	{ -112, -60, -9, -12 },
+	{ -88, -78, 47, -11 },
+	{ -119, -44, 3, -5 },
+	{ -32, -101, 70, -16 },
+	{ -76, -67, 77, -4 },
+	{ -118, -40, -24, -8 },
+	{ -97, -82, 6, -17 },
+	{ 40, -73, 96, -9 },
+	{ 11, -85, 94, -11 },
+	{ 66, -102, 38, -26 },
+	{ 46, -96, 70, -19 },
+	{ 45, -119, 1, -35 },
+	{ 39, -111, 48, -26 },
+	{ 1, -36, -122, -27 },
+	{ 33, -103, -67, -40 },
+	{ 19, -33, -121, -27 },
+	{ 43, -89, -80, -38 },
+	{ -9, -110, 63, -22 },
+	{ 26, -111, 56, -25 },
+	{ 32, -65, -105, -34 },
+	{ 46, -114, -33, -39 },
+	{ -63, 17, -109, -7 },
+	{ -20, -13, -125, -20 },
+	{ -93, 41, -77, 7 },
+	{ -49, 78, -87, 14 },
+	{ -28, 94, -81, 19 },
+	{ 1, 104, -72, 24 },
+	{ 1, 106, -70, 24 },
+	{ -17, 96, -81, 20 },
+	{ -40, 44, -112, 0 },
+	{ -16, 7, -126, -14 },
+	{ -27, 62, -108, 5 },
+	{ -17, 16, -125, -11 },
+	{ -28, 89, -86, 17 },
+	{ -79, 54, -83, 9 },
+	{ -70, 73, -77, 15 },
+	{ -14, -114, 53, -24 },
+	{ -10, -122, 33, -31 },
+	{ 17, -124, 19, -36 },
+	{ 39, -118, 28, -33 },
+	{ 74, -102, 11, -37 },
+	{ 100, -78, -2, -37 },
+	{ 95, 24, 80, 20 },
+	{ 52, 71, 91, 44 },
+	{ 33, 71, 100, 49 },
+	{ 89, 23, 87, 23 },
+	{ -45, -85, -84, -48 },
+	{ -93, -41, -75, -25 },
+	{ -99, -49, -62, -23 },
+	{ -90, -63, -64, -29 },
+	{ 24, -125, -5, -43 },
+	{ 66, -104, -32, -50 },
+	{ 9, -126, 8, -39 },
+	{ 6, -127, 8, -39 },
+	{ 7, -127, 5, -40 },
+	{ 12, -126, 13, -37 },
+	{ 20, -119, 40, -30 },
+	{ 18, -117, 46, -28 },
+	{ -90, 73, -52, 22 },
+	{ -55, 107, -41, 34 },
+	{ -9, 123, -32, 39 },
+	{ 38, 120, -20, 40 },
+	{ 20, 125, -9, 44 },
+	{ 34, 122, 0, 46 },
+	{ 57, 113, 11, 47 },
+	{ 83, 94, 20, 46 },
+	{ 63, 110, 6, 45 },
+	{ 12, 119, -43, 34 },
+	{ 11, 119, -42, 34 },
+	{ 40, 120, 15, 50 },
+	{ 34, 122, 8, 49 },
+	{ 51, 83, 82, 62 },
+	{ 48, 104, 54, 58 },
+	{ -79, 8, 99, 37 },
+	{ -77, 41, 92, 45 },
+	{ -115, 14, -52, -19 },
+	{ -80, 86, 50, 45 },
+	{ 123, 33, -1, 10 },
+	{ 120, -24, -35, -23 },
+	{ 75, -9, 102, 34 },
+	{ 73, 19, 102, 44 },
+	{ 29, 110, 56, 62 },
+	{ 35, 114, 44, 58 },
+	{ 2, 115, -53, 31 },
+	{ 20, 115, -51, 31 },
+	{ -32, 123, -6, 47 },
+	{ -81, 96, -20, 37 },
+	{ -63, 101, 44, 59 },
+	{ -43, 119, 14, 53 },
+	{ -101, 76, 8, 41 },
+	{ -89, 91, -8, 40 },
+	{ -80, 50, 85, 62 },
+	{ -76, 74, 69, 61 },
+	{ -115, 45, 28, 41 },
+	{ -111, 59, 21, 41 },
+	{ -11, -125, 18, -21 },
+	{ -60, -80, 78, 23 },
+	{ -2, -127, 0, -31 },
+	{ -64, -106, 28, -5 },
+	{ 15, -64, -109, -50 },
+	{ 48, -48, -107, -51 },
+	{ -83, 11, -96, -11 },
+	{ -79, 0, -99, -15 },
+	{ 108, -67, -8, -36 },
+	{ 109, -65, -9, -36 },
+	{ 91, 12, 87, 19 },
+	{ 15, 66, 107, 53 },
+	{ -2, 55, 115, 55 },
+	{ 80, 12, 98, 25 },
+	{ -116, 51, 11, 36 },
+	{ -111, 61, 7, 37 },
+	{ -15, -125, 20, -21 },
+	{ -77, -97, 27, -2 },
+	{ -106, 69, -1, 36 },
+	{ -113, 56, -10, 30 },
+	{ -75, -97, -32, -46 },
+	{ -84, -82, -48, -47 },
+	{ -74, -98, -33, -46 },
+	{ -78, -84, -54, -50 },
+	{ -49, -111, -38, -51 },
+	{ -58, -83, -76, -57 },
+	{ -65, -50, -97, -56 },
+	{ -58, -43, -104, -57 },
+	{ 23, -123, 21, -20 },
+	{ 73, -76, 71, 17 },
+	{ 37, -117, 31, -13 },
+	{ 82, -80, 55, 11 },
+	{ 98, 17, -79, -4 },
+	{ 51, -16, -115, -30 },
+	{ 48, -4, -118, -29 },
+	{ 25, -29, -121, -39 },
+	{ 106, 62, 33, 43 },
+	{ 98, 76, 29, 44 },
+	{ 87, 76, 53, 51 },
+	{ 78, 93, 39, 51 },
+	{ 103, 59, 45, 45 },
+	{ 108, 55, 38, 42 },
+	{ 86, 45, 82, 52 },
+	{ 86, 66, 66, 53 },
+	{ 48, 40, 110, 60 },
+	{ 45, 66, 99, 62 },
+	{ 13, -126, 2, -29 },
+	{ 55, -70, 90, 25 },
+	{ 99, 0, -80, -9 },
+	{ 21, -51, -114, -44 },
+	{ 82, -37, -90, -25 },
+	{ 98, -36, -72, -17 },
+	{ -95, -63, -55, -46 },
+	{ -93, -75, -42, -44 },
+	{ -76, -78, -66, -52 },
+	{ -71, -76, -73, -53 },
+	{ -60, -110, -20, -45 },
+	{ -36, -121, 17, -34 },
+	{ 16, -126, 10, -38 },
+	{ 13, -126, -3, -42 },
+	{ 38, -117, -31, -52 },
+	{ 60, -93, -62, -59 },
+	{ 65, -76, -78, -61 },
+	{ 10, -100, -78, -64 },
+	{ 8, -85, -94, -67 },
+	{ 116, 52, 9, 20 },
+	{ 121, 37, 5, 14 },
+	{ 98, -34, -74, -43 },
+	{ 100, -45, -64, -42 },
+	{ 10, 82, 96, 70 },
+	{ 23, 79, 97, 69 },
+	{ 11, -107, 67, 5 },
+	{ 4, -72, 104, 33 },
+	{ 16, -124, 24, -32 },
+	{ 9, -118, -45, -56 },
+	{ 6, -127, 7, -39 },
+	{ -1, -127, 4, -40 },
+	{ 10, -127, 5, -40 },
+	{ 14, -125, 20, -35 },
+	{ 12, -126, 13, -37 },
+	{ -3, -117, 49, -28 },
+	{ 9, -119, 44, -29 },
+	{ 23, -116, 46, -28 },
+	{ 9, -115, 54, -26 },
+	{ -10, -112, 58, -25 },
+	{ -16, -108, 65, -22 },
+	{ -37, -117, 33, -30 },
+	{ -25, -108, 61, -23 },
+	{ -25, -125, 5, -36 },
+	{ -15, -116, 50, -27 },
+	{ 6, -127, 3, -37 },
+	{ 8, -121, 39, -30 },
+	{ 28, -111, 56, -25 },
+	{ 12, -123, 31, -32 },
+	{ -1, -122, 37, -31 },
+	{ 26, -121, 30, -30 },
+	{ 83, -89, -36, -27 },
+	{ 97, 8, -81, -2 },
+	{ 82, -96, 17, -19 },
+	{ 114, -5, -56, 0 },
+	{ 31, -110, 55, -22 },
+	{ -51, -116, -12, -44 },
+	{ -58, -108, -33, -47 },
+	{ 3, -113, 57, -24 },
+	{ -19, -115, 50, -27 },
+	{ -2, -127, -1, -42 },
+	{ -67, -105, -23, -45 },
+	{ 11, 24, 124, 42 },
+	{ -84, -27, 91, 6 },
+	{ -66, -30, 104, 11 },
+	{ -9, -1, 127, 33 },
+	{ 0, -13, 126, 31 },
+	{ -63, -35, 105, 10 },
+	{ -29, -40, 117, 18 },
+	{ -11, -36, 121, 22 },
+	{ 115, 50, 17, 36 },
+	{ 110, 62, 16, 38 },
+	{ -35, 14, -121, -27 },
+	{ -29, -15, -123, -35 },
+	{ 69, 34, -101, -2 },
+	{ 64, 49, -98, 2 },
+	{ -118, -39, -25, -34 },
+	{ -121, -29, -24, -32 },
+	{ -37, 20, -120, -26 },
+	{ -40, 27, -117, -24 },
+	{ 66, 61, -89, 8 },
+	{ 60, 60, -95, 5 },
+	{ 124, 20, 19, 30 },
+	{ 118, 44, 18, 35 },
+	{ 14, -126, 12, -23 },
+	{ 57, -112, 19, -12 },
+	{ -108, -59, -30, -38 },
+	{ -112, -55, -22, -36 },
+	{ -31, -51, -112, -43 },
+	{ 82, 20, -95, -3 },
+	{ 74, 102, 9, 45 },
+	{ 22, -72, -102, -41 },
+	{ 90, 9, -90, -4 },
+	{ 95, 84, 5, 40 },
+	{ -58, -108, -33, -47 },
+	{ 91, -82, -32, -47 },
+	{ 100, -71, -33, -45 },
+	{ 21, 117, -45, 33 },
+	{ 30, 96, -78, 21 },
+	{ 49, 76, -89, 15 },
+	{ 22, 97, -79, 21 },
+	{ 6, 105, -72, 24 },
+	{ -2, 78, -100, 11 },
+	{ -17, 12, -125, -13 },
+	{ -26, -72, -102, -35 },
+	{ -27, -114, -49, -41 },
+	{ -10, -53, -115, -31 },
+	{ -2, -114, -55, -42 },
+	{ -13, 75, -101, 10 },
+	{ -19, 12, -125, -13 },
+	{ -47, -76, -91, -36 },
+	{ -50, -115, -21, -38 },
+	{ -54, -70, -91, -34 },
+	{ -73, -97, -36, -36 },
+	{ -20, -117, -46, -39 },
+	{ -36, -115, 41, -28 },
+	{ 55, -58, 99, 2 },
+	{ 40, -82, 88, -8 },
+	{ 91, -77, 45, -8 },
+	{ 118, -47, 11, -2 },
+	{ 35, -99, 71, -15 },
+	{ 69, -86, 64, -10 },
+	{ 124, -22, -13, 2 },
+	{ -28, -59, 109, -3 },
+	{ 24, -77, 98, -6 },
+	{ 94, -3, -85, -5 },
+	{ 58, -45, -103, -22 },
+	{ 47, 30, -114, -2 },
+	{ 5, -15, -126, -20 },
+	{ 80, 61, -77, 14 },
+	{ 15, 62, -110, 6 },
+	{ -16, -4, -126, -18 },
+	{ 6, 113, -57, 29 },
+	{ 10, 113, -58, 29 },
+	{ 43, 91, -78, 21 },
+	{ 33, 113, -48, 32 },
+	{ -32, -94, 79, -17 },
+	{ -14, -94, 84, -15 },
+	{ -17, -108, 65, -22 },
+	{ -88, 75, 52, 42 },
+	{ -117, 8, -50, -20 },
+	{ -125, 12, -20, -6 },
+	{ -84, 50, 80, 48 },
+	{ -72, -21, -103, -32 },
+	{ -83, -30, -91, -28 },
+	{ -21, -69, -104, -53 },
+	{ -6, -53, -115, -55 },
+	{ -37, 103, -65, 26 },
+	{ -18, -44, 118, -43 },
+	{ 19, -39, 119, -44 },
+	{ -115, 18, -50, 23 },
+	{ -121, 16, -36, 17 },
+	{ -122, 11, -33, 17 },
+	{ -6, -111, -61, 59 },
+	{ 6, -111, -61, 59 },
+	{ 122, 10, -33, 20 },
+	{ -2, -15, 126, -52 },
+	{ 121, 18, -35, 20 },
+	{ 69, 18, -105, 49 },
+	{ 65, 33, -104, 45 },
+	{ 2, -18, 126, -51 },
+	{ -69, 21, -104, 46 },
+	{ -65, 32, -104, 44 },
+	{ -66, 38, -102, 42 },
+	{ -110, 30, -55, 24 },
+	{ -126, 11, -15, 10 },
+	{ -113, 47, -33, 17 },
+	{ -68, 56, -91, 37 },
+	{ 68, 54, -92, 39 },
+	{ 111, 33, -53, 26 },
+	{ 126, 8, -17, 14 },
+	{ 126, 11, -15, 13 },
+	{ 115, 23, -48, 24 },
+	{ 113, 48, -32, 19 },
+	{ 62, 88, -67, 32 },
+	{ 111, 61, 4, 11 },
+	{ 59, 112, 1, 16 },
+	{ 66, 39, -101, 43 },
+	{ -62, 89, -66, 30 },
+	{ -111, 61, 2, 9 },
+	{ -123, 31, 8, 5 },
+	{ -125, 20, -9, 8 },
+	{ -109, 51, 40, 1 },
+	{ -59, 112, 0, 15 },
+	{ -54, 95, 65, 2 },
+	{ -126, 11, -15, 10 },
+	{ -125, 12, -21, 12 },
+	{ -2, -16, -126, 56 },
+	{ -7, 1, -127, 53 },
+	{ 2, -14, -126, 56 },
+	{ 7, 5, -127, 52 },
+	{ 125, 4, -22, 17 },
+	{ 125, 13, -20, 14 },
+	{ -14, -117, -46, 55 },
+	{ 14, -117, -46, 55 },
+	{ -124, -2, -25, 17 },
+	{ -119, 10, 43, -11 },
+	{ -113, 28, 51, -18 },
+	{ -63, 27, 107, -34 },
+	{ -63, 47, 100, -38 },
+	{ -123, -1, 33, -6 },
+	{ -124, -8, 28, -4 },
+	{ -124, -15, 23, -2 },
+	{ -122, -31, 16, -2 },
+	{ -59, -106, 38, -11 },
+	{ -68, -73, 78, -18 },
+	{ -72, -33, 100, -24 },
+	{ 72, -32, 100, -23 },
+	{ 70, -2, 106, -27 },
+	{ -70, -4, 106, -28 },
+	{ -4, -124, -28, 50 },
+	{ 63, 47, 100, -37 },
+	{ 117, 12, 48, -10 },
+	{ 63, 25, 107, -33 },
+	{ 118, 14, 44, -9 },
+	{ 9, -125, -22, 49 },
+	{ 122, 5, 35, -4 },
+	{ 124, -7, 29, -1 },
+	{ 68, -71, 81, -17 },
+	{ 59, -103, 45, -10 },
+	{ 44, -111, -44, 3 },
+	{ 28, -92, -83, 7 },
+	{ -26, -89, -87, 7 },
+	{ -118, -44, -12, 1 },
+	{ -122, 23, 28, 1 },
+	{ -122, 10, 34, 0 },
+	{ -60, -66, 91, -3 },
+	{ -123, -29, -9, 2 },
+	{ -60, -108, 29, 0 },
+	{ 63, -98, 50, 0 },
+	{ 41, -32, 116, -3 },
+	{ 122, 13, 33, 3 },
+	{ 124, 15, 23, 4 },
+	{ 125, -3, 20, 3 },
+	{ 109, 50, 42, 4 },
+	{ 43, 76, 92, -1 },
+	{ 60, -66, 91, -2 },
+	{ -40, -13, 120, -4 },
+	{ -123, 15, 28, 0 },
+	{ -43, 71, 96, -3 },
+	{ -44, -111, -44, 2 },
+	{ 124, -24, -13, 5 },
+	{ 118, -46, -7, 4 },
+	{ 121, -29, 23, 0 },
+	{ 125, 22, 9, 7 },
+	{ 125, 20, -9, 11 },
+	{ 124, -15, 22, 1 },
+	{ 54, 93, 68, 2 },
+	{ -110, -51, 39, 2 },
+	{ -41, -101, 66, 12 },
+	{ -37, -83, 89, 11 },
+	{ 42, -43, 112, 13 },
+	{ 93, 85, 16, 7 },
+	{ 83, 89, -36, 7 },
+	{ -124, -26, -11, 0 },
+	{ 28, 114, 49, 6 },
+	{ 92, 77, 43, 8 },
+	{ 71, -106, -4, 17 },
+	{ 18, -125, -10, 18 },
+	{ 3, -67, -108, 12 },
+	{ -70, -55, -91, 8 },
+	{ 54, 70, -91, 8 },
+	{ 34, 24, -120, -15 },
+	{ 31, -11, -123, -18 },
+	{ 95, -34, 77, 22 },
+	{ -19, -106, 67, 27 },
+	{ 116, 14, -51, 0 },
+	{ 46, -22, -116, 13 },
+	{ 35, -31, -118, 14 },
+	{ -65, -25, -106, 6 },
+	{ -57, -25, -110, 7 },
+	{ -117, -40, -27, 2 },
+	{ -121, -29, -23, 0 },
+	{ -112, -42, 43, 1 },
+	{ -111, -48, 38, 2 },
+	{ -77, -56, 84, 4 },
+	{ -84, -54, 78, 3 },
+	{ -39, -67, 100, 9 },
+	{ -31, -69, 102, 10 },
+	{ 44, -60, 103, 15 },
+	{ 59, -64, 92, 17 },
+	{ 122, -16, 30, 15 },
+	{ 124, -20, 16, 16 },
+	{ 125, -8, -20, 14 },
+	{ 122, -8, -35, 14 },
+	{ 105, -25, -67, 16 },
+	{ 91, -19, -87, 15 },
+	{ 24, -124, 14, -1 },
+	{ 26, -121, 31, 4 },
+	{ 15, -113, 55, 13 },
+	{ 49, -10, 117, 45 },
+	{ 38, 105, 61, 41 },
+	{ 41, 96, 73, 44 },
+	{ 116, -8, 50, 22 },
+	{ 97, 28, 77, 39 },
+	{ 86, -9, 93, 40 },
+	{ 78, -61, 79, 27 },
+	{ 104, -26, 67, 29 },
+	{ 81, -49, 85, 32 },
+	{ 82, -95, 22, 6 },
+	{ 71, -95, 47, 13 },
+	{ 61, -92, 63, 19 },
+	{ 55, -42, 107, 41 },
+	{ 41, -66, 100, 35 },
+	{ 16, -96, 82, 24 },
+	{ 10, -9, -126, -17 },
+	{ 91, -60, -66, -9 },
+	{ 89, -75, -51, -10 },
+	{ 119, 12, -42, 13 },
+	{ 103, 71, -22, 29 },
+	{ 108, 67, -5, 31 },
+	{ 7, 103, -74, 21 },
+	{ -21, 116, -46, 27 },
+	{ 15, 3, -126, -13 },
+	{ -82, 37, -90, -8 },
+	{ 112, -36, 47, 23 },
+	{ 27, 99, 75, 40 },
+	{ 97, -42, 70, 27 },
+	{ 100, 41, 67, 35 },
+	{ 88, -63, 66, 14 },
+	{ 84, -48, 83, 22 },
+	{ 51, -23, 114, 33 },
+	{ 66, 104, 31, 48 },
+	{ 76, 51, 88, 50 },
+	{ 78, -88, -47, -10 },
+	{ 64, -110, 7, 0 },
+	{ 94, 33, 78, 33 },
+	{ 90, -21, 87, 17 },
+	{ 101, -33, 70, 12 },
+	{ 101, -39, 66, 9 },
+	{ 121, 7, 38, 22 },
+	{ 113, -19, 55, 16 },
+	{ 111, -26, 56, 13 },
+	{ 102, -13, 75, 20 },
+	{ -1, 83, 96, 43 },
+	{ -22, 40, 118, 31 },
+	{ -37, 61, 105, 34 },
+	{ -38, 70, 99, 36 },
+	{ -110, 63, 12, 12 },
+	{ -111, 62, 6, 10 },
+	{ -110, 62, 6, 10 },
+	{ -107, 68, 0, 12 },
+	{ -94, 32, -79, -9 },
+	{ -93, 39, -77, -7 },
+	{ -87, 49, -78, -3 },
+	{ -85, 61, -73, 2 },
+	{ 32, -38, -117, -19 },
+	{ 46, -9, -118, -9 },
+	{ 33, 34, -118, 3 },
+	{ 18, 74, -102, 17 },
+	{ 107, -46, -50, 0 },
+	{ 113, 0, -58, 12 },
+	{ 106, 38, -58, 23 },
+	{ 92, 69, -54, 32 },
+	{ 15, 43, 118, 30 },
+	{ 14, 2, 126, 19 },
+	{ 47, -22, 116, 14 },
+	{ 88, -42, 82, 8 },
+	{ -21, 104, -69, 27 },
+	{ 62, 111, 0, 51 },
+	{ -38, 113, 44, 44 },
+	{ 81, 64, 75, 46 },
+	{ 39, 120, 13, 4 },
+	{ 43, 88, -81, -7 },
+	{ 96, 82, 15, 6 },
+	{ 109, 61, -20, 4 },
+	{ 70, -106, -1, 17 },
+	{ 18, -126, -6, 19 },
+	{ 6, -127, -4, 19 },
+	{ -123, -1, -32, -7 },
+	{ -127, 1, -6, -4 },
+	{ -21, -31, 122, 25 },
+	{ -33, 8, 122, 17 },
+	{ 61, -26, 108, 26 },
+	{ 65, 11, 108, 20 },
+	{ 114, 17, -54, -1 },
+	{ 114, 16, -54, -1 },
+	{ 51, 12, -116, -11 },
+	{ -72, 22, -102, -18 },
+	{ -77, 8, -101, -16 },
+	{ -127, 3, -1, -4 },
+	{ -127, 4, -1, -4 },
+	{ -127, 8, -6, -6 },
+	{ -124, -26, -8, 6 },
+	{ -20, 33, 121, 11 },
+	{ -20, 39, 119, 9 },
+	{ -21, 49, 115, 4 },
+	{ -29, 20, 122, 17 },
+	{ 71, 24, 102, 16 },
+	{ 76, 39, 94, 10 },
+	{ 74, 48, 92, 7 },
+	{ 84, 24, 92, 17 },
+	{ 114, 13, -54, 0 },
+	{ 115, 4, -54, 3 },
+	{ 110, 5, -64, 1 },
+	{ 104, -18, -71, 9 },
+	{ 42, 7, -119, -11 },
+	{ 42, -7, -120, -7 },
+	{ 33, -6, -122, -8 },
+	{ 31, -33, -118, 3 },
+	{ -74, -8, -103, -12 },
+	{ -86, -4, -93, -12 },
+	{ -86, 0, -94, -14 },
+	{ -83, -20, -94, -6 },
+	{ -5, -127, -3, 52 },
+	{ 124, -28, 0, 17 },
+	{ 122, -34, 11, 18 },
+	{ 121, -2, -38, 14 },
+	{ 121, 6, -39, 12 },
+	{ 83, 19, -94, 9 },
+	{ 96, 53, -65, 3 },
+	{ 16, 46, -117, 1 },
+	{ 48, 104, -55, -10 },
+	{ -41, 56, -107, -5 },
+	{ -50, 110, -39, -17 },
+	{ -126, 16, -5, -8 },
+	{ -122, 34, 14, -12 },
+	{ -109, -48, 45, 2 },
+	{ -111, -12, 61, -6 },
+	{ -85, -64, 69, 5 },
+	{ -76, -59, 83, 5 },
+	{ -24, -85, 92, 13 },
+	{ -2, -97, 82, 18 },
+	{ 80, -75, 65, 20 },
+	{ 65, -86, 68, 21 },
+	{ -126, 11, 4, -7 },
+	{ -127, 2, 2, -5 },
+	{ -127, -3, -1, -3 },
+	{ -127, 7, 0, -6 },
+	{ -124, -24, -8, 7 },
+	{ -108, -1, 67, -8 },
+	{ -111, -3, 62, -8 },
+	{ -115, -4, 53, -7 },
+	{ -114, 13, 55, -13 },
+	{ -115, -25, 49, 2 },
+	{ -74, -19, 102, -4 },
+	{ -68, 0, 107, -9 },
+	{ -76, 6, 101, -11 },
+	{ -71, 32, 101, -21 },
+	{ -80, 23, 96, -18 },
+	{ 5, -30, 123, 3 },
+	{ -3, 3, 127, -7 },
+	{ -19, 29, 122, -16 },
+	{ -16, 52, 115, -25 },
+	{ -27, 12, 124, -10 },
+	{ 76, -23, 99, 8 },
+	{ 66, 10, 108, -2 },
+	{ 68, 40, 100, -12 },
+	{ 65, 50, 97, -16 },
+	{ 78, 22, 98, -3 },
+	{ 126, 1, 18, 11 },
+	{ 124, 18, 20, 6 },
+	{ 121, 35, 18, 0 },
+	{ 117, 45, 19, -4 },
+	{ 125, 3, 24, 14 },
+	{ 121, 17, -34, 10 },
+	{ 120, 21, -36, 9 },
+	{ 119, 29, -34, 6 },
+	{ 117, 38, -32, 2 },
+	{ 122, -7, -35, 21 },
+	{ 88, 44, -81, 5 },
+	{ 90, 27, -86, 10 },
+	{ 91, 23, -85, 11 },
+	{ 91, 25, -85, 11 },
+	{ 93, 3, -86, 20 },
+	{ 2, 57, -114, 2 },
+	{ -11, 28, -123, 8 },
+	{ -4, 15, -126, 12 },
+	{ 4, 6, -127, 16 },
+	{ 2, -35, -122, 32 },
+	{ -74, 41, -95, 0 },
+	{ -109, 10, -64, 1 },
+	{ -100, 7, -78, 4 },
+	{ -87, 7, -92, 6 },
+	{ -85, -21, -92, 17 },
+	{ 0, -127, 0, 53 },
+	{ 1, -127, -1, 53 },
+	{ -3, -127, -1, 53 },
+	{ -8, -126, 17, 51 },
+	{ -1, -127, 1, 53 },
+	{ 21, -109, -62, 15 },
+	{ 3, -94, -86, 14 },
+	{ 16, 121, -35, 5 },
+	{ 18, 125, 16, 5 },
+	{ 19, -14, 125, 32 },
+	{ 18, -114, -53, 16 },
+	{ 23, 119, 38, 53 },
+	{ 19, 72, 103, 59 },
+	{ -33, 57, -109, 7 },
+	{ -10, -58, -113, 11 },
+	{ 116, 30, -41, 11 },
+	{ 124, 24, 13, 11 },
+	{ 123, 25, 22, 10 },
+	{ 121, 37, 4, 8 },
+	{ 121, 32, -21, 5 },
+	{ -23, -86, 91, 29 },
+	{ 75, 12, -102, 12 },
+	{ 45, -27, -116, 14 },
+	{ 118, 3, -47, 13 },
+	{ 127, 1, -5, 13 },
+	{ 116, -3, 52, 13 },
+	{ 116, -50, 7, 14 },
+	{ -113, -19, -55, 1 },
+	{ 100, 61, 48, 32 },
+	{ 48, 97, 67, 42 },
+	{ 79, -99, 9, 2 },
+	{ 70, -89, -58, -13 },
+	{ 23, -53, -113, -20 },
+	{ 29, -35, 119, 30 },
+	{ 15, -124, 21, 0 },
+	{ 124, -18, -18, 4 },
+	{ 127, -1, 0, 8 },
+	{ 115, 23, 48, 17 },
+	{ 96, -1, 83, 24 },
+	{ 52, -72, -91, -18 },
+	{ 43, -48, -110, -18 },
+	{ 28, 71, -101, 8 },
+	{ 21, 103, -71, 22 },
+	{ 39, 117, -31, 35 },
+	{ 21, -62, -109, -21 },
+	{ 14, 77, -100, 9 },
+	{ 41, 30, -117, -5 },
+	{ 6, 34, -122, -6 },
+	{ 124, 0, 28, 24 },
+	{ 41, 18, 119, 41 },
+	{ 119, -39, 19, 6 },
+	{ 106, -32, 62, 22 },
+	{ 17, 38, 120, 57 },
+	{ 71, 6, 105, 45 },
+	{ 41, -4, 120, 48 },
+	{ 122, 14, 31, 28 },
+	{ 110, 1, 63, 32 },
+	{ 110, 63, 8, 33 },
+	{ 91, -63, -63, -9 },
+	{ 118, -47, 3, 8 },
+	{ 117, 48, -5, 27 },
+	{ 29, -9, 123, 32 },
+	{ 105, 29, 65, 33 },
+	{ 54, 53, 102, 50 },
+	{ 96, -83, 2, 16 },
+	{ 87, -93, -2, 16 },
+	{ 70, -104, -18, 16 },
+	{ 17, -122, -30, 17 },
+	{ 97, -21, 80, 29 },
+	{ 5, -127, 0, 53 },
+	{ 1, -127, -2, 53 },
+	{ 81, 8, 97, 26 },
+	{ -9, -83, 96, 30 },
+	{ -31, -104, 67, 27 },
+	{ 49, -117, -3, 18 },
+	{ 55, -114, -8, 18 },
+	{ 26, -112, -54, 16 },
+	{ -52, -89, -75, 11 },
+	{ -62, -57, -95, 9 },
+	{ -57, -59, -97, 9 },
+	{ 10, 34, -122, 9 },
+	{ 8, 95, -84, 6 },
+	{ -53, -13, -115, 8 },
+	{ 20, 8, -125, 11 },
+	{ 67, 40, -100, 10 },
+	{ 106, 58, -39, 9 },
+	{ 112, 56, 21, 9 },
+	{ 114, 34, 46, 10 },
+	{ 113, 56, 11, 7 },
+	{ 113, 53, -23, 4 },
+	{ 1, -123, 32, 24 },
+	{ -9, -124, 26, 23 },
+	{ -110, -13, 62, 9 },
+	{ -111, 0, 63, 7 },
+	{ -108, 19, 65, 2 },
+	{ -108, 18, 65, 2 },
+	{ -106, 22, 66, 1 },
+	{ -103, 9, 73, 8 },
+	{ -1, -127, -2, 53 },
+	{ 1, -127, 3, 54 },
+	{ 126, -4, 14, 18 },
+	{ 121, 33, 20, 4 },
+	{ 119, 26, 36, 9 },
+	{ 119, 23, 37, 10 },
+	{ 118, 12, 46, 14 },
+	{ 115, 1, 55, 17 },
+	{ 111, -23, 57, 21 },
+	{ 106, 24, 65, 20 },
+	{ 114, -5, 56, 19 },
+	{ 118, -28, 38, 14 },
+	{ 74, -101, -17, -5 },
+	{ 79, -96, -27, -7 },
+	{ 126, -13, -6, 15 },
+	{ 124, 25, 1, 23 },
+	{ 115, 50, 20, 33 },
+	{ 74, 86, 57, 50 },
+	{ 27, 102, 70, 57 },
+	{ 122, 3, -34, 4 },
+	{ 62, -68, 88, 29 },
+	{ -18, -108, 65, 27 },
+	{ -82, -97, 5, 14 },
+	{ -51, -95, 67, 25 },
+	{ -115, -52, -14, 4 },
+	{ 126, -16, 6, 13 },
+	{ 61, 42, -103, -14 },
+	{ -95, -50, 68, 17 },
+	{ -122, 5, -33, -9 },
+	{ 116, -51, 12, 14 },
+	{ 127, 10, 1, 10 },
+	{ 127, -2, 9, 11 },
+	{ 122, -6, -34, 6 },
+	{ 55, -109, -35, 16 },
+	{ 22, 96, -80, 6 },
+	{ 49, 112, -35, 6 },
+	{ 60, 111, 15, 6 },
+	{ 58, 102, 48, 7 },
+	{ 69, 106, 11, 5 },
+	{ 87, 65, -65, -4 },
+	{ 94, 14, -84, -8 },
+	{ 88, -9, -91, -11 },
+	{ 60, -72, -86, -17 },
+	{ 65, 2, 109, 22 },
+	{ -26, -3, 124, 20 },
+	{ -110, -4, 63, 8 },
+	{ -123, -1, -32, -7 },
+	{ -76, 15, -100, -17 },
+	{ 56, 16, -113, -11 },
+	{ 120, 42, 3, 8 },
+	{ 114, 18, 53, 19 },
+	{ 122, 35, -10, 7 },
+	{ -47, 28, -114, -19 },
+	{ 91, 11, 87, 24 },
+	{ 94, -26, 82, 27 },
+	{ 103, -46, 58, 24 },
+	{ 103, -59, 45, 24 },
+	{ -18, 11, -125, -18 },
+	{ 58, -78, 82, 30 },
+	{ 53, -84, 79, 30 },
+	{ 117, 50, 8, 9 },
+	{ 120, 36, -19, 5 },
+	{ 125, 5, -20, 7 },
+	{ 64, -54, 95, 30 },
+	{ 55, -40, 107, 31 },
+	{ 103, 26, -70, -5 },
+	{ 42, 66, -100, -18 },
+	{ 127, 8, -1, 10 },
+	{ -51, -41, -109, -7 },
+	{ 74, -13, -102, -4 },
+	{ -99, 16, -78, -16 },
+	{ 125, -17, -16, 10 },
+	{ 19, -90, 87, 30 },
+	{ 29, -100, 73, 29 },
+	{ 17, -100, 76, 29 },
+	{ -4, -75, 102, 30 },
+	{ -44, -100, 65, 25 },
+	{ -52, -115, 16, 19 },
+	{ 115, -48, -22, 11 },
+	{ -23, -121, -30, 14 },
+	{ -92, -35, -80, -8 },
+	{ -100, 1, -78, -13 },
+	{ -99, 11, -79, -15 },
+	{ -103, 9, -74, -14 },
+	{ -105, 9, -71, -14 },
+	{ -110, 5, -63, -12 },
+	{ -112, -6, -60, -9 },
+	{ -117, -4, -49, -8 },
+	{ -118, 0, -47, -9 },
+	{ -120, -12, -39, -3 },
+	{ -1, -127, 1, 53 },
+	{ 1, -127, 0, 53 },
+	{ 120, -17, -37, 14 },
+	{ 123, 18, -26, 3 },
+	{ 126, 13, -12, 6 },
+	{ 125, 17, -12, 5 },
+	{ 126, 11, -1, 8 },
+	{ 127, 7, -1, 9 },
+	{ 126, -3, 11, 12 },
+	{ 123, -28, 11, 15 },
+	{ 104, -29, -67, 2 },
+	{ 112, -37, -47, 6 },
+	{ 124, -5, -26, 7 },
+	{ -77, -64, -78, -3 },
+	{ 126, -9, -13, 10 },
+	{ 127, 9, 4, 11 },
+	{ 108, 35, 58, 18 },
+	{ 16, 125, -17, -18 },
+	{ 87, 61, -69, 1 },
+	{ -61, 108, 29, -23 },
+	{ -119, 30, 32, -13 },
+	{ 0, 34, -122, 7 },
+	{ 89, 25, -86, 9 },
+	{ -126, 14, -3, -7 },
+	{ -105, 27, -67, -2 },
+	{ 12, -125, -19, 17 },
+	{ 95, -83, -13, 14 },
+	{ 116, -51, -3, 13 },
+	{ 127, -9, -5, 10 },
+	{ 122, 36, -1, 7 },
+	{ 109, 64, -14, 4 },
+	{ 111, 61, -15, 4 },
+	{ 77, 93, -40, -1 },
+	{ 43, 111, -43, -2 },
+	{ 8, -31, -123, 12 },
+	{ -40, -44, -112, 10 },
+	{ 108, 18, 65, 11 },
+	{ 103, 45, 59, 10 },
+	{ -81, 83, -52, -22 },
+	{ 100, 33, -71, -6 },
+	{ -100, 30, -72, -17 },
+	{ 25, 79, -96, -21 },
+	{ -70, -33, -101, 8 },
+	{ -48, -13, -117, 8 },
+	{ -53, 12, -115, 8 },
+	{ -49, 12, -116, 8 },
+	{ -27, 82, -93, 6 },
+	{ 111, -42, -45, 7 },
+	{ 24, -38, -119, -8 },
+	{ 26, -23, -122, -10 },
+	{ 101, -61, -48, 8 },
+	{ 76, -101, -9, 16 },
+	{ 47, -117, -19, 17 },
+	{ 45, -119, 0, 19 },
+	{ 14, -123, 30, 24 },
+	{ -33, -103, 67, 26 },
+	{ -19, -81, 96, 30 },
+	{ 23, -50, 114, 32 },
+	{ 6, -54, 115, 32 },
+	{ 32, -122, -18, 17 },
+	{ 30, -123, -2, 19 },
+	{ 8, -123, 31, 24 },
+	{ -20, -106, 68, 27 },
+	{ 28, -81, 94, 30 },
+	{ -21, -70, 104, 31 },
+	{ 109, -57, -33, 10 },
+	{ 106, -51, 47, 5 },
+	{ 85, -46, 82, 4 },
+	{ 22, -97, 79, 14 },
+	{ -34, -46, 113, 12 },
+	{ -92, 83, 26, 5 },
+	{ -87, 85, -37, 6 },
+	{ 123, -25, -18, 3 },
+	{ -29, 116, 41, 5 },
+	{ -90, 74, 51, 7 },
+	{ -70, -105, -10, 15 },
+	{ -18, -125, -11, 18 },
+	{ 9, -64, -110, 12 },
+	{ 55, -22, -112, 8 },
+	{ -52, 73, -90, 7 },
+	{ -41, 23, -118, -16 },
+	{ -36, -11, -121, -18 },
+	{ 4, -107, 68, 28 },
+	{ -115, 25, -49, -4 },
+	{ -47, -25, -115, 13 },
+	{ -32, -14, -122, 11 },
+	{ 59, -23, -110, 8 },
+	{ 47, -22, -116, 8 },
+	{ 117, -40, -28, 5 },
+	{ 120, -23, -36, 3 },
+	{ 108, -53, 41, 5 },
+	{ 109, -54, 37, 5 },
+	{ 80, -49, 86, 5 },
+	{ 80, -66, 74, 8 },
+	{ 45, -56, 105, 8 },
+	{ 32, -63, 106, 9 },
+	{ -57, -55, 99, 14 },
+	{ -71, -60, 86, 16 },
+	{ -122, -3, 35, 11 },
+	{ -125, -12, 20, 12 },
+	{ -126, 8, -17, 9 },
+	{ -123, 8, -29, 9 },
+	{ -108, 4, -67, 10 },
+	{ -94, 12, -84, 9 },
+	{ -27, -123, 16, -2 },
+	{ -25, -120, 33, 5 },
+	{ -15, -116, 49, 10 },
+	{ -49, -9, 117, 44 },
+	{ -41, 104, 61, 40 },
+	{ -42, 95, 73, 44 },
+	{ -108, 67, 4, 14 },
+	{ -102, 12, 75, 34 },
+	{ -85, -30, 89, 34 },
+	{ -69, -87, 61, 16 },
+	{ -104, -28, 67, 26 },
+	{ -81, -51, 84, 29 },
+	{ -83, -90, 34, 8 },
+	{ -76, -89, 49, 13 },
+	{ -67, -86, 64, 18 },
+	{ -59, -20, 111, 44 },
+	{ -39, -74, 96, 32 },
+	{ -16, -99, 77, 22 },
+	{ 33, -95, -77, -35 },
+	{ -72, -59, -86, -16 },
+	{ -67, -104, -30, -18 },
+	{ -81, 83, 50, 37 },
+	{ -111, 60, 12, 29 },
+	{ -6, 103, -74, 21 },
+	{ 21, 116, -46, 27 },
+	{ -19, 3, -125, -13 },
+	{ 82, 42, -88, -5 },
+	{ -102, -12, 74, 30 },
+	{ -47, 98, 66, 38 },
+	{ -74, -17, 102, 37 },
+	{ -71, 97, 42, 31 },
+	{ -105, 25, 68, 31 },
+	{ -88, 1, 91, 37 },
+	{ -95, -64, 55, 9 },
+	{ -51, -23, 114, 32 },
+	{ -90, 34, 83, 37 },
+	{ -11, 121, -35, 35 },
+	{ -68, 103, 30, 46 },
+	{ -72, 54, 90, 50 },
+	{ -74, -86, -58, -14 },
+	{ -40, -119, 17, 0 },
+	{ -91, 24, 85, 29 },
+	{ -98, 1, 81, 22 },
+	{ -106, -15, 68, 16 },
+	{ -101, -36, 68, 8 },
+	{ -122, 1, 35, 17 },
+	{ -110, -28, 56, 10 },
+	{ -102, -15, 75, 17 },
+	{ -65, 21, 107, 31 },
+	{ 1, 83, 96, 43 },
+	{ 22, 39, 119, 31 },
+	{ 37, 56, 108, 34 },
+	{ 38, 69, 100, 37 },
+	{ 90, 90, 2, 23 },
+	{ 116, 52, 7, 9 },
+	{ 111, 62, -1, 12 },
+	{ 106, 69, -12, 14 },
+	{ 92, 36, -80, -6 },
+	{ 89, 49, -77, -1 },
+	{ 88, 48, -78, -2 },
+	{ 82, 64, -72, 5 },
+	{ -29, -37, -118, -20 },
+	{ -19, -11, -125, -15 },
+	{ -8, 29, -123, -4 },
+	{ -18, 74, -102, 16 },
+	{ -105, -53, -48, -5 },
+	{ -111, -1, -61, 8 },
+	{ -103, 38, -64, 19 },
+	{ -69, 70, -80, 24 },
+	{ -4, 45, 119, 29 },
+	{ -14, 2, 126, 18 },
+	{ -53, 9, 115, 25 },
+	{ -105, 20, 69, 30 },
+	{ 30, 111, -53, 32 },
+	{ -92, 81, 34, 46 },
+	{ 35, 120, 20, 45 },
+	{ -71, 77, 71, 48 },
+	{ -39, 121, 6, 2 },
+	{ -45, 88, -80, -8 },
+	{ -96, 82, 15, 4 },
+	{ -111, 60, -14, 2 },
+	{ -72, -105, -7, 15 },
+	{ -18, -126, -7, 18 },
+	{ -9, -127, -3, 19 },
+	{ 123, 2, -32, -5 },
+	{ 127, 7, -7, -3 },
+	{ 23, -22, 123, 24 },
+	{ 32, 5, 123, 19 },
+	{ -41, -28, 117, 26 },
+	{ -65, 12, 108, 18 },
+	{ -113, 19, -54, -4 },
+	{ -117, 16, -47, -2 },
+	{ -51, 15, -116, -13 },
+	{ 68, 23, -105, -17 },
+	{ 76, 8, -102, -14 },
+	{ 127, 2, -7, -1 },
+	{ 127, 3, -6, -2 },
+	{ 127, 8, -6, -3 },
+	{ 125, -21, 10, 10 },
+	{ 34, 32, 118, 11 },
+	{ 22, 39, 119, 9 },
+	{ 27, 48, 115, 5 },
+	{ 22, 21, 123, 18 },
+	{ -71, 28, 101, 13 },
+	{ -75, 43, 93, 7 },
+	{ -80, 48, 87, 5 },
+	{ -85, 24, 91, 15 },
+	{ -117, 13, -47, -2 },
+	{ -110, 4, -64, -1 },
+	{ -105, 4, -71, -2 },
+	{ -107, -17, -66, 7 },
+	{ -51, 7, -116, -11 },
+	{ -33, -7, -122, -8 },
+	{ -35, -6, -122, -8 },
+	{ -27, -34, -119, 2 },
+	{ 86, -7, -93, -10 },
+	{ 86, -4, -94, -11 },
+	{ 85, 0, -95, -12 },
+	{ 81, -20, -95, -4 },
+	{ 2, -127, -3, 53 },
+	{ -125, -23, 4, 14 },
+	{ -120, -40, 8, 16 },
+	{ -122, 2, -36, 10 },
+	{ -121, 9, -37, 9 },
+	{ -85, 34, -89, 5 },
+	{ -95, 45, -71, 3 },
+	{ -16, 47, -117, 0 },
+	{ -48, 95, -69, -8 },
+	{ 75, 56, -86, -6 },
+	{ 74, 101, -21, -16 },
+	{ 125, 23, 3, -7 },
+	{ 122, 22, 27, -8 },
+	{ 110, -40, 48, 3 },
+	{ 111, -11, 61, -3 },
+	{ 83, -70, 66, 8 },
+	{ 80, -45, 88, 3 },
+	{ 24, -84, 93, 13 },
+	{ 3, -88, 92, 15 },
+	{ -81, -69, 69, 18 },
+	{ -62, -92, 62, 21 },
+	{ 126, 8, 11, -4 },
+	{ 127, 3, -3, -1 },
+	{ 127, -3, 1, 0 },
+	{ 127, 7, -7, -3 },
+	{ 125, -24, -5, 10 },
+	{ 111, 0, 62, -6 },
+	{ 108, -3, 67, -5 },
+	{ 111, -4, 62, -5 },
+	{ 117, 12, 49, -10 },
+	{ 114, -24, 49, 5 },
+	{ 73, -13, 103, -4 },
+	{ 72, 0, 104, -8 },
+	{ 67, 6, 108, -10 },
+	{ 79, 29, 95, -18 },
+	{ 88, 20, 90, -15 },
+	{ 3, -27, 124, 1 },
+	{ 3, 1, 127, -6 },
+	{ 20, 20, 124, -13 },
+	{ 24, 50, 114, -24 },
+	{ 14, 12, 126, -8 },
+	{ -75, -23, 100, 6 },
+	{ -71, 10, 105, -3 },
+	{ -59, 40, 105, -14 },
+	{ -73, 50, 91, -16 },
+	{ -74, 22, 101, -5 },
+	{ -124, -2, 27, 8 },
+	{ -123, 18, 25, 3 },
+	{ -119, 36, 25, -3 },
+	{ -116, 45, 23, -7 },
+	{ -126, 1, 16, 12 },
+	{ -121, 17, -33, 7 },
+	{ -121, 21, -33, 6 },
+	{ -119, 29, -33, 3 },
+	{ -117, 38, -33, 0 },
+	{ -122, -6, -34, 18 },
+	{ -95, 40, -74, 4 },
+	{ -85, 28, -91, 8 },
+	{ -90, 23, -87, 9 },
+	{ -92, 25, -84, 8 },
+	{ -98, 5, -80, 16 },
+	{ -43, 47, -110, 4 },
+	{ 11, 33, -122, 6 },
+	{ 4, 12, -126, 14 },
+	{ -4, 0, -127, 19 },
+	{ 2, -36, -122, 32 },
+	{ 50, 44, -108, 2 },
+	{ 109, 12, -64, 3 },
+	{ 100, 0, -79, 9 },
+	{ 87, -9, -92, 14 },
+	{ 73, -21, -102, 20 },
+	{ -1, -127, 0, 53 },
+	{ -2, -127, -2, 53 },
+	{ 1, -127, -1, 53 },
+	{ 7, -127, 4, 52 },
+	{ 1, -127, 1, 53 },
+	{ 5, -117, -50, 15 },
+	{ -3, -95, -84, 14 },
+	{ -14, 121, -35, 4 },
+	{ -19, 125, 16, 4 },
+	{ -8, -14, 126, 32 },
+	{ -13, -114, -54, 15 },
+	{ -22, 119, 38, 52 },
+	{ -25, 72, 102, 58 },
+	{ 10, 53, -115, 8 },
+	{ 38, -56, -107, 11 },
+	{ -116, 31, -41, 8 },
+	{ -122, 33, 14, 8 },
+	{ -124, 25, 6, 6 },
+	{ -121, 37, 5, 5 },
+	{ -122, 30, -21, 3 },
+	{ 14, -87, 91, 30 },
+	{ -66, 10, -108, 11 },
+	{ -42, -2, -120, 10 },
+	{ -118, 9, -47, 10 },
+	{ -126, 19, -2, 8 },
+	{ -111, 17, 59, 8 },
+	{ -116, -52, 7, 12 },
+	{ 86, 4, -93, 3 },
+	{ -103, 49, 55, 30 },
+	{ -37, 107, 58, 39 },
+	{ -78, -97, 27, 5 },
+	{ -66, -87, -65, -16 },
+	{ -19, -53, -114, -21 },
+	{ -33, -35, 118, 29 },
+	{ -26, -122, 21, 0 },
+	{ -124, -18, -22, 0 },
+	{ -127, -2, -11, 3 },
+	{ -125, 19, 9, 7 },
+	{ -45, -69, -96, -20 },
+	{ -22, -54, -113, -23 },
+	{ 12, 57, -113, 0 },
+	{ -24, 103, -71, 22 },
+	{ -23, -62, -109, -21 },
+	{ -13, 72, -103, 7 },
+	{ -38, 9, -121, -10 },
+	{ -18, 33, -121, -6 },
+	{ -123, 0, 30, 22 },
+	{ -41, 22, 118, 40 },
+	{ -112, -25, 55, 18 },
+	{ -105, -33, 63, 19 },
+	{ -16, 38, 120, 56 },
+	{ -80, 9, 99, 41 },
+	{ -40, 8, 120, 49 },
+	{ -122, 19, 31, 26 },
+	{ -104, 7, 73, 33 },
+	{ -98, 80, 14, 36 },
+	{ -91, -63, -63, -11 },
+	{ -124, -19, -21, 8 },
+	{ -119, 28, 33, 27 },
+	{ -19, -8, 125, 32 },
+	{ -104, 60, 41, 26 },
+	{ -53, 40, 108, 49 },
+	{ -96, -83, 4, 14 },
+	{ -95, -84, -1, 14 },
+	{ -31, -123, 3, 17 },
+	{ -10, -123, -29, 17 },
+	{ -101, -19, 75, 26 },
+	{ -97, 9, 81, 33 },
+	{ -9, -127, 6, 53 },
+	{ 0, -127, -2, 53 },
+	{ -55, -15, 114, 29 },
+	{ 10, -85, 94, 30 },
+	{ 28, -105, 66, 27 },
+	{ -49, -117, -6, 17 },
+	{ -55, -114, -11, 16 },
+	{ 62, -110, 12, 13 },
+	{ 53, -92, -70, 13 },
+	{ 57, -59, -97, 11 },
+	{ 66, -57, -93, 10 },
+	{ -5, 46, -118, 9 },
+	{ 1, 93, -87, 6 },
+	{ 47, -13, -117, 10 },
+	{ -1, 6, -127, 10 },
+	{ -64, 47, -99, 8 },
+	{ -106, 58, -39, 7 },
+	{ -109, 61, 21, 6 },
+	{ -125, 11, 19, 7 },
+	{ -114, 56, 7, 4 },
+	{ -115, 51, -15, 2 },
+	{ 16, -122, 31, 24 },
+	{ 65, -107, 20, 20 },
+	{ 110, -14, 62, 12 },
+	{ 111, 1, 62, 9 },
+	{ 112, 17, 58, 4 },
+	{ 107, 19, 66, 5 },
+	{ 102, 24, 72, 4 },
+	{ 107, 8, 68, 10 },
+	{ 1, -127, -2, 53 },
+	{ 0, -127, 0, 53 },
+	{ -127, -7, 4, 15 },
+	{ -122, 32, 14, 1 },
+	{ -123, 24, 21, 4 },
+	{ -117, 24, 45, 8 },
+	{ -118, 16, 45, 10 },
+	{ -114, 5, 55, 14 },
+	{ -111, -18, 59, 18 },
+	{ -90, 25, 86, 21 },
+	{ -118, -6, 46, 14 },
+	{ -121, -28, 27, 9 },
+	{ -75, -98, -29, -9 },
+	{ -79, -95, -29, -9 },
+	{ -126, -13, -13, 11 },
+	{ -124, 28, 1, 21 },
+	{ -108, 54, 38, 36 },
+	{ -72, 87, 58, 49 },
+	{ -25, 103, 70, 57 },
+	{ -122, -2, -34, 2 },
+	{ -42, -73, 95, 30 },
+	{ 32, -103, 67, 27 },
+	{ 127, -1, -10, -1 },
+	{ 30, -108, 60, 27 },
+	{ 126, -1, -18, -2 },
+	{ -126, -12, 6, 10 },
+	{ -80, 9, -98, -9 },
+	{ 100, -39, 67, 17 },
+	{ 122, -8, -34, -4 },
+	{ -116, -50, 12, 12 },
+	{ -126, 7, 17, 8 },
+	{ -126, -12, 8, 9 },
+	{ -119, 11, -42, 1 },
+	{ -55, -109, -35, 15 },
+	{ -30, 91, -83, 6 },
+	{ -54, 109, -36, 5 },
+	{ -60, 111, 17, 4 },
+	{ -57, 101, 52, 6 },
+	{ -69, 105, 17, 3 },
+	{ -90, 83, -35, -2 },
+	{ -95, 14, -83, -10 },
+	{ -90, -9, -89, -12 },
+	{ -53, -70, -91, -19 },
+	{ -54, 1, 115, 21 },
+	{ 26, -2, 124, 20 },
+	{ 110, -4, 63, 10 },
+	{ 125, -1, -21, -3 },
+	{ 77, 14, -100, -15 },
+	{ -55, 22, -112, -14 },
+	{ -119, 42, 9, 7 },
+	{ -119, -8, 44, 16 },
+	{ -121, 37, -12, 4 },
+	{ 76, 30, -97, -17 },
+	{ -96, 18, 81, 21 },
+	{ -108, -10, 67, 20 },
+	{ -100, -49, 62, 23 },
+	{ -104, -55, 47, 21 },
+	{ 38, 9, -121, -17 },
+	{ -84, -59, 74, 25 },
+	{ -63, -80, 76, 28 },
+	{ -119, 38, -24, 1 },
+	{ -123, 29, -12, 4 },
+	{ -125, 6, -20, 5 },
+	{ -80, -34, 93, 26 },
+	{ -56, -30, 110, 29 },
+	{ -6, -54, 115, 32 },
+	{ -106, 16, -69, -6 },
+	{ -49, 58, -102, -18 },
+	{ -127, -2, 1, 8 },
+	{ 80, -11, -98, -11 },
+	{ -62, 2, -111, -10 },
+	{ 98, 17, -79, -14 },
+	{ -126, -8, -15, 6 },
+	{ -18, -91, 87, 30 },
+	{ -45, -96, 71, 28 },
+	{ -28, -99, 74, 29 },
+	{ 9, -67, 107, 29 },
+	{ 65, -83, 70, 25 },
+	{ 108, -67, 6, 12 },
+	{ -117, -35, -37, 5 },
+	{ 29, -108, -60, 8 },
+	{ 104, 12, -71, -12 },
+	{ 103, 17, -73, -13 },
+	{ 103, 9, -74, -12 },
+	{ 105, 8, -71, -11 },
+	{ 110, 8, -62, -10 },
+	{ 113, 5, -59, -9 },
+	{ 117, -4, -50, -5 },
+	{ 118, -4, -47, -5 },
+	{ 121, 1, -39, -6 },
+	{ 123, -10, -31, 0 },
+	{ 1, -127, 1, 53 },
+	{ -1, -127, 1, 53 },
+	{ -121, -17, -36, 12 },
+	{ -121, 16, -36, -1 },
+	{ -124, 12, -26, 2 },
+	{ -126, 17, -5, 3 },
+	{ -126, 12, -5, 5 },
+	{ -126, 12, -1, 5 },
+	{ -126, -1, 12, 9 },
+	{ -122, -33, 10, 13 },
+	{ -109, -29, -59, 1 },
+	{ -101, -20, -75, -2 },
+	{ -124, -23, -12, 8 },
+	{ 78, -63, -77, -1 },
+	{ -121, -32, 21, 13 },
+	{ -127, 6, 4, 8 },
+	{ -110, 36, 51, 14 },
+	{ -16, 125, -18, -18 },
+	{ -82, 72, -65, -3 },
+	{ 42, 117, 27, -22 },
+	{ 116, 34, 38, -11 },
+	{ -1, 38, -121, 6 },
+	{ -52, 43, -107, 5 },
+	{ 125, 13, -19, -2 },
+	{ 50, 37, -111, 4 },
+	{ -12, -125, -21, 17 },
+	{ -102, -74, -15, 11 },
+	{ -116, -51, -3, 11 },
+	{ -126, -12, -4, 8 },
+	{ -124, 27, -3, 5 },
+	{ -111, 62, -3, 3 },
+	{ -106, 63, -31, -1 },
+	{ -78, 97, -22, -1 },
+	{ -43, 110, -45, -3 },
+	{ 20, -34, -121, 11 },
+	{ 50, -43, -109, 10 },
+	{ -99, 13, 79, 9 },
+	{ -97, 36, 73, 8 },
+	{ 79, 78, -62, -21 },
+	{ -104, 22, -69, -7 },
+	{ 96, 30, -78, -15 },
+	{ -20, 98, -79, -22 },
+	{ 61, -34, -106, 10 },
+	{ 65, -13, -108, 9 },
+	{ 54, 21, -113, 8 },
+	{ 33, 12, -122, 9 },
+	{ 1, 65, -109, 8 },
+	{ -109, -29, -58, 1 },
+	{ 28, 23, -122, -19 },
+	{ -64, -67, -86, 1 },
+	{ -96, -81, 17, 15 },
+	{ -60, -109, -25, 14 },
+	{ -47, -112, -36, 13 },
+	{ -45, -119, 2, 18 },
+	{ 46, -116, 25, 22 },
+	{ 30, -104, 67, 27 },
+	{ 18, -79, 98, 31 },
+	{ -32, -120, -25, 15 },
+	{ -30, -123, -1, 19 },
+	{ 31, -120, 30, 23 },
+	{ 20, -106, 67, 28 },
+	{ 31, -77, 96, 30 },
+	{ 17, -71, 104, 31 },
+	{ -83, 7, -96, -9 },
+	{ 115, -9, 53, 23 },
+	{ 48, -13, 117, 45 },
+	{ -49, -7, 117, 45 },
+	{ -115, -10, 54, 20 },
+	{ -96, 2, 84, 33 },
+	{ 120, -35, 25, 18 },
+	{ 116, -50, -14, 6 },
+	{ 95, -48, -69, -7 },
+	{ 49, -48, -107, -17 },
+	{ 20, -25, -123, -17 },
+	{ -21, -18, -124, -17 },
+	{ -58, -23, -111, -15 },
+	{ -88, -59, -70, -12 },
+	{ -116, -50, -14, 3 },
+	{ -125, -22, 11, 14 },
+	{ 92, -38, 79, 24 },
+	{ 66, -16, 107, 34 },
+	{ 65, 20, 107, 41 },
+	{ 106, -26, 64, 24 },
+	{ 88, 13, 90, 38 },
+	{ 101, 9, 76, 34 },
+	{ 114, -8, 55, 24 },
+	{ 112, -12, 58, 24 },
+	{ -96, -65, 52, 8 },
+	{ -72, -13, 104, 33 },
+	{ -61, 20, 109, 40 },
+	{ -116, -44, 29, 5 },
+	{ -113, -10, 58, 22 },
+	{ 63, 72, 83, 42 },
+	{ 66, 73, 80, 42 },
+	{ 75, 54, 87, 42 },
+	{ 59, 53, 99, 43 },
+	{ -66, 74, 80, 40 },
+	{ -71, 96, 44, 32 },
+	{ -107, 54, 41, 26 },
+	{ -23, 72, 102, 42 },
+	{ 88, -74, 54, 18 },
+	{ 96, -55, 63, 23 },
+	{ 77, -69, 74, 25 },
+	{ 23, -92, 84, 26 },
+	{ -24, -89, 88, 27 },
+	{ -68, -81, 70, 21 },
+	{ -92, -62, 62, 20 },
+	{ -102, -50, 57, 19 },
+	{ -94, -71, 47, 14 },
+	{ -99, -77, -18, -3 },
+	{ -75, -75, -70, -15 },
+	{ -44, -59, -103, -20 },
+	{ -18, -40, -119, -20 },
+	{ 19, -34, -121, -18 },
+	{ 50, -61, -99, -18 },
+	{ 81, -68, -70, -12 },
+	{ 99, -77, -21, -1 },
+	{ 94, -83, 20, 8 },
+	{ -6, -123, 31, 1 },
+	{ 11, -126, 15, -5 },
+	{ 24, -122, -25, -19 },
+	{ 27, -121, -27, -20 },
+	{ 8, 123, 32, 24 },
+	{ 44, 115, 32, 24 },
+	{ 19, 123, 26, 22 },
+	{ -10, 124, 26, 22 },
+	{ -50, 113, 30, 22 },
+	{ -10, 123, 32, 23 },
+	{ -36, -118, -30, -21 },
+	{ -63, -110, -2, -9 },
+	{ -27, -121, 27, 0 },
+	{ 4, -122, 34, 2 },
+	{ 90, -65, 62, 21 },
+	{ -112, -15, 58, 24 },
+	{ -96, -39, 74, 26 },
+	{ 99, -72, 32, 10 },
+	{ 94, -76, 37, 11 },
+	{ 70, -84, 65, 20 },
+	{ 26, -89, 87, 27 },
+	{ -22, -97, 79, 23 },
+	{ -75, -76, 69, 21 },
+	{ -101, -64, 43, 13 },
+	{ -99, -73, 33, 8 },
+	{ -99, -29, 74, 27 },
+	{ -101, -46, 62, 21 },
+	{ -82, -66, 71, 23 },
+	{ -28, -66, 105, 35 },
+	{ 25, -79, 96, 32 },
+	{ 89, -52, 75, 27 },
+	{ 106, -23, 67, 27 },
+	{ 93, -34, 79, 30 },
+	{ -5, -81, 98, 15 },
+	{ -36, -80, 92, 13 },
+	{ -68, -56, 92, 14 },
+	{ -112, 28, 53, 10 },
+	{ -36, 41, 114, 32 },
+	{ 0, 54, 115, 34 },
+	{ 17, 53, 114, 34 },
+	{ 38, 41, 114, 32 },
+	{ 93, 10, 86, 21 },
+	{ 60, -70, 87, 13 },
+	{ 35, -84, 89, 12 },
+	{ 4, -87, 92, 13 },
+	{ 12, 120, 40, 25 },
+	{ -26, 114, 49, 27 },
+	{ -41, -60, -104, -48 },
+	{ -92, -36, -80, -37 },
+	{ -101, -4, -77, -33 },
+	{ -102, 18, -73, -30 },
+	{ -97, 60, -56, -19 },
+	{ -91, 72, -53, -17 },
+	{ -70, 80, -70, -21 },
+	{ -24, 95, -80, -22 },
+	{ 24, 97, -78, -21 },
+	{ 70, 79, -71, -20 },
+	{ 90, 71, -55, -16 },
+	{ 94, 58, -63, -19 },
+	{ 101, -23, -73, -31 },
+	{ 108, 13, -66, -26 },
+	{ 92, -30, -82, -35 },
+	{ 41, -55, -107, -47 },
+	{ -34, -122, -9, -20 },
+	{ -34, -122, -9, -20 },
+	{ -51, -115, -16, -22 },
+	{ -124, 28, 4, -4 },
+	{ -107, 64, 21, 6 },
+	{ -118, 46, 4, -2 },
+	{ -63, 109, 11, 8 },
+	{ 2, 126, 13, 12 },
+	{ 21, 123, 24, 15 },
+	{ 63, 109, 11, 9 },
+	{ 119, 45, 6, 1 },
+	{ 109, 66, 5, 3 },
+	{ 125, 19, 16, 1 },
+	{ 49, -114, -27, -24 },
+	{ 34, -121, -17, -21 },
+	{ 35, -122, -9, -19 },
+	{ -81, -85, -49, -31 },
+	{ -119, -12, -43, -23 },
+	{ -106, 66, -24, -8 },
+	{ -114, 35, -44, -18 },
+	{ -64, 104, -34, -7 },
+	{ -22, 120, -35, -4 },
+	{ 22, 121, -33, -3 },
+	{ 64, 104, -36, -6 },
+	{ 117, 37, -31, -11 },
+	{ 107, 66, -21, -5 },
+	{ 119, -11, -44, -21 },
+	{ 81, -83, -51, -29 },
+	{ 66, -95, -52, -31 },
+	{ 42, -108, -52, -32 },
+	{ -41, -107, -55, -34 },
+	{ -65, -98, -47, -31 },
+	{ 42, 105, 58, 40 },
+	{ 104, 58, 43, 29 },
+	{ 120, 1, 43, 23 },
+	{ 120, 24, 35, 23 },
+	{ 80, -52, 84, 29 },
+	{ 76, -93, 42, 12 },
+	{ 26, -123, 21, 1 },
+	{ 78, -61, 79, 27 },
+	{ 94, -56, 64, 23 },
+	{ -44, 98, 68, 42 },
+	{ -101, 60, 48, 29 },
+	{ -112, 42, 42, 25 },
+	{ -87, 82, -42, -2 },
+	{ -108, -50, 45, 16 },
+	{ -84, -93, 23, 4 },
+	{ -25, -124, 10, -3 },
+	{ -85, -77, 55, 16 },
+	{ 106, 58, 39, 28 },
+	{ 23, 69, 104, 43 },
+	{ -71, 47, 94, 41 },
+	{ -114, -12, 55, 21 },
+	{ -93, -65, 57, 9 },
+	{ -92, -53, 69, 16 },
+	{ -101, -21, 75, 26 },
+	{ -93, 34, 80, 36 },
+	{ -115, -4, 54, 26 },
+	{ -93, -40, 76, 21 },
+	{ -85, -49, 81, 19 },
+	{ -102, -4, 76, 30 },
+	{ -86, 13, 93, 36 },
+	{ -75, 54, 87, 40 },
+	{ -21, 102, 73, 38 },
+	{ -72, 63, 83, 41 },
+	{ -111, -48, 39, 16 },
+	{ -95, -82, 18, 5 },
+	{ -78, -100, 10, 0 },
+	{ -68, -107, 1, -3 },
+	{ -103, -34, 66, 17 },
+	{ -83, 1, 96, 25 },
+	{ -55, 8, 114, 28 },
+	{ -76, -37, 95, 24 },
+	{ -70, -11, 105, 27 },
+	{ 33, -30, 119, 31 },
+	{ -116, 50, -8, 24 },
+	{ -113, 58, 6, 29 },
+	{ -115, 50, 20, 31 },
+	{ -89, 91, -1, 35 },
+	{ -53, 115, 4, 42 },
+	{ -18, 125, 9, 46 },
+	{ 18, 125, 9, 47 },
+	{ 56, 114, 3, 43 },
+	{ 84, 95, -7, 37 },
+	{ -53, 111, -32, 33 },
+	{ -41, 116, -31, 34 },
+	{ 14, 121, -35, 35 },
+	{ 52, 111, -33, 34 },
+	{ 103, -2, 75, 34 },
+	{ 96, -65, 52, 10 },
+	{ 96, -64, 53, 10 },
+	{ 97, -18, 81, 30 },
+	{ 102, 1, 76, 33 },
+	{ 93, 20, 84, 38 },
+	{ 70, 97, 42, 33 },
+	{ 78, 76, 65, 38 },
+	{ 82, 72, 65, 38 },
+	{ 98, 79, 14, 38 },
+	{ 98, 67, 46, 43 },
+	{ 104, -2, 73, 33 },
+	{ 90, -64, 62, 13 },
+	{ 99, -21, 76, 28 },
+	{ 86, 54, 76, 40 },
+	{ 49, 98, 64, 38 },
+	{ 83, -76, 59, 19 },
+	{ 72, -99, 34, 8 },
+	{ 54, -10, 114, 30 },
+	{ 24, -15, 124, 32 },
+	{ 69, -36, 100, 27 },
+	{ 47, -115, 28, 4 },
+	{ 33, -35, 118, 38 },
+	{ 53, -30, 111, 38 },
+	{ 70, -23, 103, 37 },
+	{ 72, -38, 97, 34 },
+	{ 74, -56, 87, 28 },
+	{ 74, -77, 69, 20 },
+	{ 90, -61, 65, 22 },
+	{ 83, -59, 76, 25 },
+	{ 81, -41, 88, 31 },
+	{ 89, -45, 79, 28 },
+	{ 93, -33, 80, 30 },
+	{ 99, -37, 71, 27 },
+	{ 95, -48, 69, 25 },
+	{ 86, -29, 89, 33 },
+	{ 84, -13, 94, 37 },
+	{ 91, -17, 87, 35 },
+	{ 79, -25, 96, 35 },
+	{ 93, -75, 43, 14 },
+	{ 84, -92, 23, 5 },
+	{ -12, -97, -81, -35 },
+	{ -88, 7, -92, -34 },
+	{ -88, 3, -92, -34 },
+	{ 13, -124, -24, -19 },
+	{ -32, -56, -109, -41 },
+	{ 97, -82, 6, 3 },
+	{ 71, -98, 39, 8 },
+	{ 83, -77, 56, 17 },
+	{ 57, -99, 56, 12 },
+	{ 103, -59, 46, 18 },
+	{ 109, -49, 44, 19 },
+	{ 104, -42, 59, 24 },
+	{ 99, -51, 60, 22 },
+	{ 115, -38, 40, 20 },
+	{ 117, -46, 15, 12 },
+	{ 111, -58, 23, 12 },
+	{ 102, -68, 31, 12 },
+	{ 95, -63, 55, 19 },
+	{ 62, -74, 82, 24 },
+	{ 50, -69, 95, 27 },
+	{ 27, -90, 86, 21 },
+	{ -17, -112, 58, 6 },
+	{ -54, -95, 65, 9 },
+	{ 12, -80, 98, 25 },
+	{ -103, -66, 34, -1 },
+	{ -2, -67, 108, 29 },
+	{ -100, -25, -74, -33 },
+	{ -3, -119, 43, 2 },
+	{ -91, -29, -83, -35 },
+	{ 42, -96, 71, 16 },
+	{ 37, -62, 105, 31 },
+	{ 26, -53, 113, 34 },
+	{ 43, -41, 112, 36 },
+	{ 63, -34, 105, 36 },
+	{ 53, -47, 106, 34 },
+	{ 15, -42, 119, 37 },
+	{ 8, -28, 124, 40 },
+	{ 27, -26, 121, 41 },
+	{ 63, -52, 97, 31 },
+	{ 76, -11, 101, 39 },
+	{ 71, 5, 105, 43 },
+	{ 57, 10, 113, 45 },
+	{ 60, 23, 110, 47 },
+	{ 74, 18, 102, 44 },
+	{ 84, 25, 92, 43 },
+	{ 90, 11, 89, 40 },
+	{ 83, 14, 95, 42 },
+	{ 88, -1, 92, 39 },
+	{ 81, 2, 98, 41 },
+	{ 92, 21, 85, 41 },
+	{ 98, 18, 78, 39 },
+	{ 97, 8, 82, 38 },
+	{ 75, 29, 98, 46 },
+	{ 62, 45, 101, 49 },
+	{ 75, 40, 95, 47 },
+	{ 61, 35, 106, 48 },
+	{ 84, 36, 88, 44 },
+	{ 83, 48, 83, 46 },
+	{ 92, 45, 76, 43 },
+	{ 92, 32, 81, 42 },
+	{ 35, 15, 121, 48 },
+	{ 4, 4, 127, 46 },
+	{ 5, -12, 126, 43 },
+	{ -30, -11, 123, 41 },
+	{ -32, 9, 123, 44 },
+	{ 32, 0, 123, 46 },
+	{ 30, -14, 123, 43 },
+	{ 53, -4, 115, 43 },
+	{ 48, -17, 116, 41 },
+	{ 6, 22, 125, 49 },
+	{ 8, 38, 121, 51 },
+	{ 13, 53, 115, 52 },
+	{ 41, 43, 112, 51 },
+	{ 38, 30, 117, 50 },
+	{ -28, 45, 115, 49 },
+	{ -32, 28, 120, 47 },
+	{ 66, -8, 108, 41 },
+	{ 61, -20, 110, 39 },
+	{ 43, -26, 117, 40 },
+	{ 43, 66, 100, 52 },
+	{ 43, 54, 106, 52 },
+	{ 17, 65, 107, 53 },
+	{ 25, 77, 98, 53 },
+	{ 38, 85, 86, 52 },
+	{ 54, 88, 74, 50 },
+	{ 31, 108, 59, 49 },
+	{ 12, 102, 74, 51 },
+	{ -103, 67, -33, 0 },
+	{ -96, -2, -83, -33 },
+	{ -96, -7, -83, -34 },
+	{ -95, -8, -83, -35 },
+	{ -91, -10, -88, -36 },
+	{ -92, -12, -87, -36 },
+	{ -91, -12, -87, -36 },
+	{ 28, 74, -99, -6 },
+	{ 73, 93, -47, 18 },
+	{ -81, 18, -96, -30 },
+	{ -70, 104, -19, 16 },
+	{ 49, 109, 44, 45 },
+	{ -1, 127, -4, 31 },
+	{ -91, 18, -87, -28 },
+	{ -4, 90, 89, 51 },
+	{ -16, 76, 101, 51 },
+	{ -23, 61, 109, 50 },
+	{ -119, 20, -39, -15 },
+	{ -117, 27, -40, -13 },
+	{ -111, 53, -32, -4 },
+	{ 68, 86, 63, 47 },
+	{ 82, 83, 52, 44 },
+	{ 94, 76, 39, 40 },
+	{ 93, 86, 0, 31 },
+	{ 104, 68, 28, 36 },
+	{ 107, 51, 46, 37 },
+	{ 99, 57, 56, 41 },
+	{ 105, 71, -12, 25 },
+	{ 112, 58, 16, 31 },
+	{ 114, 52, -23, 19 },
+	{ 119, 44, 6, 26 },
+	{ 81, 97, 13, 36 },
+	{ 65, 105, 28, 41 },
+	{ 54, 113, -22, 28 },
+	{ 36, 122, -6, 33 },
+	{ 89, 62, 67, 44 },
+	{ 79, 65, 75, 47 },
+	{ 67, 68, 83, 49 },
+	{ 55, 73, 89, 51 },
+	{ 74, 52, 89, 48 },
+	{ 64, 55, 95, 49 },
+	{ 119, 37, 26, 30 },
+	{ 113, 33, 49, 35 },
+	{ 106, 25, 66, 37 },
+	{ 100, 41, 67, 40 },
+	{ 107, 36, 58, 38 },
+	{ 99, 28, 74, 40 },
+	{ 104, 15, 71, 37 },
+	{ 109, 1, 65, 33 },
+	{ 116, -4, 52, 29 },
+	{ 113, -17, 56, 27 },
+	{ 106, -12, 69, 31 },
+	{ 97, -20, 79, 32 },
+	{ 100, -7, 78, 34 },
+	{ 103, 4, 75, 36 },
+	{ 103, -24, 70, 29 },
+	{ 109, -30, 58, 26 },
+	{ 123, -10, 31, 23 },
+	{ 127, -2, 1, 16 },
+	{ 123, 11, -31, 10 },
+	{ -37, -10, -121, -38 },
+	{ -38, -16, -120, -39 },
+	{ 123, -7, -31, 6 },
+	{ 126, 13, -1, 18 },
+	{ 124, 28, 0, 22 },
+	{ 120, 31, -29, 14 },
+	{ 126, -16, 4, 15 },
+	{ 123, -32, 9, 13 },
+	{ 122, -23, -28, 4 },
+	{ 118, -39, -23, 2 },
+	{ 120, -24, 36, 21 },
+	{ 124, 3, 27, 24 },
+	{ 124, 15, 24, 25 },
+	{ 123, 27, 19, 26 },
+	{ 118, 18, 43, 31 },
+	{ 118, 26, 39, 31 },
+	{ 117, 8, 48, 30 },
+	{ 111, 12, 61, 34 },
+	{ 112, 22, 56, 34 },
+	{ 113, 45, 36, 34 },
+	{ -32, -35, 118, 38 },
+	{ -43, -41, 112, 35 },
+	{ -15, -42, 119, 36 },
+	{ -8, -28, 124, 40 },
+	{ 14, -50, 116, 34 },
+	{ -25, -53, 113, 33 },
+	{ -37, -61, 105, 30 },
+	{ -50, -69, 95, 26 },
+	{ -63, -52, 97, 30 },
+	{ -73, -38, 97, 32 },
+	{ -74, -56, 87, 26 },
+	{ -81, -41, 88, 29 },
+	{ -71, -22, 103, 36 },
+	{ -63, -34, 105, 34 },
+	{ -79, -25, 96, 34 },
+	{ -53, -47, 106, 33 },
+	{ -62, -74, 82, 22 },
+	{ -74, -77, 69, 18 },
+	{ -83, -77, 56, 15 },
+	{ -57, -99, 56, 11 },
+	{ -71, -98, 40, 7 },
+	{ -42, -96, 71, 15 },
+	{ -27, -90, 86, 20 },
+	{ 8, -109, 65, 10 },
+	{ -1, -120, 40, 1 },
+	{ -12, -80, 98, 25 },
+	{ 2, -67, 108, 29 },
+	{ 121, -34, 17, -1 },
+	{ 24, -31, 121, 38 },
+	{ 126, -6, -16, -8 },
+	{ 92, -77, 40, 2 },
+	{ 92, 6, -87, -31 },
+	{ 94, 1, -85, -31 },
+	{ 43, -100, 66, 10 },
+	{ -5, -13, 126, 43 },
+	{ 32, 8, 123, 45 },
+	{ 30, -11, 123, 42 },
+	{ 121, 11, -36, -12 },
+	{ 121, 14, -38, -13 },
+	{ 94, -5, -85, -32 },
+	{ 119, 21, -38, -12 },
+	{ 117, 30, -40, -10 },
+	{ 23, 61, 109, 51 },
+	{ 15, 76, 101, 51 },
+	{ 95, -7, -84, -32 },
+	{ 92, -9, -87, -34 },
+	{ 91, -6, -88, -33 },
+	{ 120, 16, -38, -13 },
+	{ 31, 27, 120, 47 },
+	{ 28, 45, 115, 49 },
+	{ 93, 0, -86, -32 },
+	{ 92, 4, -87, -31 },
+	{ 89, 3, -90, -32 },
+	{ 90, -2, -89, -33 },
+	{ 91, 8, -88, -31 },
+	{ 123, 5, -33, -13 },
+	{ -4, 4, 127, 46 },
+	{ -30, -14, 123, 42 },
+	{ -45, -26, 116, 39 },
+	{ -53, -30, 111, 37 },
+	{ -60, -20, 110, 38 },
+	{ -48, -17, 116, 40 },
+	{ -53, -4, 115, 42 },
+	{ -33, 0, 123, 45 },
+	{ -67, -8, 108, 40 },
+	{ -71, 5, 105, 41 },
+	{ -76, -11, 101, 37 },
+	{ -80, 2, 98, 39 },
+	{ -29, -26, 121, 40 },
+	{ -103, -58, 48, 16 },
+	{ -109, -49, 44, 16 },
+	{ -115, -38, 40, 17 },
+	{ -110, -58, 23, 9 },
+	{ -102, -68, 31, 10 },
+	{ -96, -62, 56, 17 },
+	{ -95, -48, 69, 23 },
+	{ -99, -37, 71, 25 },
+	{ -93, -32, 80, 28 },
+	{ -97, -20, 80, 30 },
+	{ -103, -24, 71, 27 },
+	{ -94, -4, 85, 34 },
+	{ -91, -17, 87, 33 },
+	{ -100, -7, 78, 32 },
+	{ -87, -29, 88, 31 },
+	{ -89, -45, 79, 26 },
+	{ -83, -59, 76, 23 },
+	{ -90, -61, 65, 20 },
+	{ -100, -50, 60, 20 },
+	{ -104, -42, 59, 21 },
+	{ -93, -75, 43, 12 },
+	{ -84, -92, 23, 3 },
+	{ 30, -83, -91, -38 },
+	{ 87, 7, -92, -32 },
+	{ 87, 8, -92, -32 },
+	{ 88, 6, -91, -32 },
+	{ 42, -32, -115, -40 },
+	{ 32, -50, -112, -40 },
+	{ 9, -112, -59, -30 },
+	{ 89, -2, -90, -33 },
+	{ -12, -126, 1, -11 },
+	{ 91, -35, -81, -33 },
+	{ -97, -82, 6, 0 },
+	{ -106, -69, -7, -1 },
+	{ -113, -55, -17, -1 },
+	{ -118, -39, -24, 0 },
+	{ -123, -32, 9, 10 },
+	{ -117, -46, 15, 9 },
+	{ -120, -24, 36, 19 },
+	{ -116, -4, 52, 26 },
+	{ -123, -10, 31, 20 },
+	{ -126, -16, 4, 12 },
+	{ -122, -23, -28, 1 },
+	{ 41, -20, -118, -39 },
+	{ 40, -15, -120, -38 },
+	{ 32, -9, -122, -37 },
+	{ 26, 8, -124, -33 },
+	{ -120, 31, -29, 11 },
+	{ -123, 11, -31, 7 },
+	{ -123, -7, -31, 4 },
+	{ -127, -2, 1, 13 },
+	{ -126, 13, -1, 16 },
+	{ -124, 28, 0, 19 },
+	{ -119, 45, 5, 23 },
+	{ -119, 38, 24, 27 },
+	{ -122, 26, 22, 24 },
+	{ -124, 15, 25, 23 },
+	{ -118, 18, 44, 28 },
+	{ -117, 8, 48, 27 },
+	{ -124, 3, 28, 21 },
+	{ -109, 1, 65, 30 },
+	{ -103, 4, 75, 33 },
+	{ -98, 18, 78, 37 },
+	{ -104, 15, 71, 34 },
+	{ -111, 12, 61, 31 },
+	{ -112, 22, 56, 32 },
+	{ -113, 32, 49, 32 },
+	{ -107, 37, 58, 35 },
+	{ -106, 25, 66, 35 },
+	{ -99, 28, 74, 37 },
+	{ -92, 32, 81, 40 },
+	{ -84, 36, 88, 42 },
+	{ -92, 45, 76, 41 },
+	{ -83, 48, 83, 44 },
+	{ -92, 21, 85, 39 },
+	{ -90, 11, 89, 38 },
+	{ -97, 8, 82, 36 },
+	{ -106, -11, 69, 29 },
+	{ -113, -17, 55, 25 },
+	{ -109, -30, 58, 23 },
+	{ -46, 64, 100, 51 },
+	{ -43, 55, 106, 51 },
+	{ -41, 43, 112, 50 },
+	{ -18, 65, 107, 52 },
+	{ -25, 77, 98, 52 },
+	{ -38, 85, 86, 51 },
+	{ -68, 68, 83, 47 },
+	{ -68, 86, 63, 46 },
+	{ -54, 87, 75, 49 },
+	{ -31, 108, 59, 48 },
+	{ 52, 116, 1, 27 },
+	{ -49, 109, 43, 44 },
+	{ 15, 126, -3, 31 },
+	{ -12, 102, 75, 50 },
+	{ 96, 77, -33, 5 },
+	{ 114, 47, -31, -3 },
+	{ 4, 90, 89, 51 },
+	{ -89, 62, 66, 42 },
+	{ -99, 57, 56, 39 },
+	{ -94, 76, 39, 38 },
+	{ -107, 51, 46, 35 },
+	{ -104, 68, 28, 33 },
+	{ -81, 83, 52, 42 },
+	{ -78, 65, 76, 45 },
+	{ -57, 69, 90, 49 },
+	{ -62, 56, 96, 48 },
+	{ -75, 40, 94, 45 },
+	{ -61, 35, 105, 47 },
+	{ -74, 18, 102, 43 },
+	{ -75, 29, 98, 44 },
+	{ -60, 23, 110, 46 },
+	{ -62, 46, 101, 48 },
+	{ -73, 52, 90, 46 },
+	{ -13, 53, 115, 52 },
+	{ -38, 31, 117, 49 },
+	{ -35, 15, 121, 47 },
+	{ -8, 38, 121, 51 },
+	{ -6, 21, 125, 49 },
+	{ 78, 22, -98, -28 },
+	{ 90, -13, -89, -35 },
+	{ 91, -9, -88, -34 },
+	{ 92, -10, -87, -34 },
+	{ 92, -11, -87, -34 },
+	{ 95, -9, -84, -33 },
+	{ 95, -9, -84, -33 },
+	{ 96, -10, -82, -33 },
+	{ -23, 62, -108, -12 },
+	{ -94, 86, -1, 29 },
+	{ -53, 94, -67, 9 },
+	{ -45, 114, -32, 23 },
+	{ 90, 18, -87, -27 },
+	{ -27, 123, -14, 29 },
+	{ -66, 105, 28, 40 },
+	{ -81, 97, 13, 35 },
+	{ -105, 71, -12, 23 },
+	{ -114, 52, -23, 17 },
+	{ -10, 32, -122, -24 },
+	{ 97, -9, -81, -32 },
+	{ -14, -51, 116, 33 },
+	{ -126, -12, -13, -11 },
+	{ -91, 10, -88, -33 },
+	{ -116, -46, 24, -2 },
+	{ -91, 9, -88, -33 },
+	{ -88, 7, -91, -34 },
+	{ -42, -30, -116, -41 },
+	{ 106, -69, -7, 1 },
+	{ 113, -55, -16, 1 },
+	{ -41, -26, -117, -40 },
+	{ -42, -22, -118, -40 },
+	{ -91, -6, -88, -35 },
+	{ -93, 0, -86, -34 },
+	{ -92, 4, -87, -33 },
+	{ -89, 3, -90, -34 },
+	{ -90, -2, -89, -35 },
+	{ -92, 8, -88, -33 },
+	{ -121, 11, -37, -16 },
+	{ -122, 7, -34, -15 },
+	{ -121, 13, -38, -16 },
+	{ -94, -5, -85, -34 },
+	{ -120, 16, -38, -15 },
+	{ -41, -20, -118, -40 },
+	{ -88, 8, -92, -34 },
+	{ -24, -31, 121, 37 },
+	{ 10, 32, -122, -24 },
+	{ -28, 3, -124, -35 },
+	{ 11, -126, 14, -7 },
+	{ -96, -1, -83, -33 },
+	{ -57, 9, 113, 44 },
+	{ 91, 10, -88, -31 },
+	{ 100, -25, -75, -30 },
+	{ 41, -25, -117, -39 },
+	{ -84, 25, 92, 41 },
+	{ -83, 14, 95, 40 },
+	{ -112, 58, 16, 29 },
+	{ -117, 27, 42, 29 },
+	{ -113, 45, 36, 31 },
+	{ -92, -9, -87, -36 },
+	{ -95, -9, -84, -35 },
+	{ -95, -7, -84, -35 },
+	{ -92, -10, -87, -36 },
+	{ -84, -13, 95, 35 },
+	{ -100, 41, 67, 38 },
+	{ -88, -1, 92, 37 },
+	{ 94, -4, 85, 37 },
+	{ 42, -22, -118, -39 },
+	{ 91, 63, -63, 3 },
+	{ 35, 77, -95, -5 },
+	{ -34, 76, -96, -6 },
+	{ -91, 59, -66, -1 },
+	{ -123, 25, -20, 3 },
+	{ -122, -13, 32, 10 },
+	{ -90, -43, 78, 17 },
+	{ -35, -65, 103, 19 },
+	{ 36, -65, 103, 20 },
+	{ 90, -40, 80, 21 },
+	{ 122, -8, 36, 16 },
+	{ 122, 29, -17, 9 },
+	{ 88, 68, -61, 5 },
+	{ 31, 88, -86, 2 },
+	{ -31, 89, -86, 2 },
+	{ -88, 69, -60, 4 },
+	{ -122, 33, -13, 9 },
+	{ -120, -5, 40, 15 },
+	{ -88, -37, 84, 21 },
+	{ -31, -54, 111, 26 },
+	{ 32, -55, 110, 26 },
+	{ 88, -37, 84, 23 },
+	{ 120, -6, 40, 18 },
+	{ 122, 33, -13, 11 },
+	{ 87, 73, -58, 8 },
+	{ 31, 91, -83, 4 },
+	{ -30, 91, -83, 4 },
+	{ -87, 73, -58, 6 },
+	{ -121, 37, -8, 12 },
+	{ -120, -1, 43, 18 },
+	{ -84, -34, 89, 24 },
+	{ -31, -51, 112, 27 },
+	{ 31, -51, 112, 28 },
+	{ 84, -35, 89, 25 },
+	{ 120, -1, 43, 20 },
+	{ 121, 36, -8, 14 },
+	{ 75, 86, -56, 14 },
+	{ 44, 97, -70, 12 },
+	{ -48, 91, -75, 7 },
+	{ -73, 83, -62, 9 },
+	{ -123, 28, 13, 17 },
+	{ -121, 14, 35, 20 },
+	{ -73, -33, 99, 28 },
+	{ -51, -44, 108, 28 },
+	{ 47, -37, 112, 33 },
+	{ 74, -28, 99, 32 },
+	{ 119, 17, 41, 27 },
+	{ 121, 37, 15, 24 },
+	{ 63, -103, -39, -41 },
+	{ 0, 124, -27, 41 },
+	{ -89, 87, 27, 47 },
+	{ -80, 31, 94, 52 },
+	{ 0, 18, 126, 61 },
+	{ 79, 37, 92, 56 },
+	{ 76, 97, 29, 54 },
+	{ 1, -118, -46, -50 },
+	{ -67, -103, -32, -40 },
+	{ 9, -116, -51, -51 },
+	{ -67, -61, -89, -47 },
+	{ -10, -78, -100, -56 },
+	{ 9, -82, -97, -56 },
+	{ 63, -67, -87, -47 },
+	{ -20, 107, 65, 34 },
+	{ 26, 98, 77, 38 },
+	{ -18, 112, -57, -12 },
+	{ 17, 112, -57, -11 },
+	{ 32, 74, -98, -30 },
+	{ -34, 70, -100, -32 },
+	{ -34, 45, -114, -39 },
+	{ 34, 40, -115, -39 },
+	{ 30, -82, -93, -40 },
+	{ -31, -79, -95, -41 },
+	{ 7, -125, 23, 0 },
+	{ -12, -121, 38, 5 },
+	{ -34, -71, 99, 32 },
+	{ 33, -72, 99, 32 },
+	{ 43, -42, 112, 40 },
+	{ -43, -36, 114, 40 },
+	{ 64, 34, -104, -25 },
+	{ 81, -84, -51, -17 },
+	{ -44, -40, -112, -39 },
+	{ -25, 29, -121, -36 },
+	{ -65, -87, -66, -24 },
+	{ -96, 33, -77, -17 },
+	{ 9, 31, -123, -35 },
+	{ -3, -48, -117, -39 },
+	{ -74, 102, 20, 18 },
+	{ 77, 99, 20, 19 },
+	{ -23, 124, -15, 5 },
+	{ 36, 120, -22, 2 },
+	{ 115, 36, -41, -13 },
+	{ -113, 37, -45, -17 },
+	{ -120, -15, -39, -19 },
+	{ 119, -16, -41, -17 },
+	{ 92, -84, -24, -16 },
+	{ -94, -83, -23, -18 },
+	{ 42, -118, 23, 2 },
+	{ -50, -114, 25, 2 },
+	{ -111, -42, 45, 15 },
+	{ 111, -44, 44, 17 },
+	{ 119, -7, 45, 21 },
+	{ -119, -4, 44, 18 },
+	{ -67, 107, -9, 8 },
+	{ 73, 103, -10, 10 },
+	{ 6, 121, -38, -1 },
+	{ 2, 121, -40, -2 },
+	{ 114, 25, -51, -17 },
+	{ -111, 28, -56, -21 },
+	{ -119, -7, -43, -20 },
+	{ 118, -8, -45, -18 },
+	{ 89, -88, -18, -14 },
+	{ -84, -89, -34, -21 },
+	{ 41, -119, 17, 0 },
+	{ -40, -118, 23, 1 },
+	{ -114, -40, 41, 14 },
+	{ 115, -41, 34, 14 },
+	{ 123, -10, 31, 16 },
+	{ -122, -6, 35, 15 },
+	{ -73, 96, 40, 24 },
+	{ 77, 91, 44, 27 },
+	{ -60, 109, -24, -1 },
+	{ 60, 107, -32, -3 },
+	{ 109, 40, -52, -16 },
+	{ -111, 36, -50, -18 },
+	{ -114, 3, -56, -23 },
+	{ 116, -1, -52, -20 },
+	{ 92, -75, -46, -22 },
+	{ -96, -71, -42, -23 },
+	{ 53, -110, 35, 7 },
+	{ -52, -109, 39, 7 },
+	{ -96, -51, 65, 21 },
+	{ 96, -52, 64, 23 },
+	{ 108, -20, 64, 26 },
+	{ -106, -19, 68, 25 },
+	{ -61, 96, 57, 30 },
+	{ 66, 92, 58, 32 },
+	{ -57, 103, -48, -10 },
+	{ 49, 106, -50, -9 },
+	{ 85, 56, -76, -23 },
+	{ -87, 55, -74, -25 },
+	{ -95, 21, -81, -30 },
+	{ 95, 19, -82, -28 },
+	{ 77, -77, -65, -29 },
+	{ -80, -74, -66, -31 },
+	{ 34, -116, 40, 7 },
+	{ -35, -115, 41, 7 },
+	{ -78, -59, 81, 26 },
+	{ 78, -60, 81, 27 },
+	{ 88, -27, 87, 33 },
+	{ -86, -28, 89, 31 },
+};
@@ -1,3077 +1,6153 @@
-const vertex_t vertices0[] =
-{ // position[xyz], normal[xyz], uv[xy]
-	{ 43568, 41931, 38291,  13, 160, 80,  212, 56 },
-	{ 43752, 41178, 38369,  13, 94, 80,  213, 62 },
-	{ 44858, 41178, 32767,  4, 94, 127,  222, 62 },
-	{ 44858, 41178, 32767,  4, 94, 127,  222, 62 },
-	{ 44659, 41931, 32767,  4, 160, 127,  220, 56 },
-	{ 43568, 41931, 38291,  13, 160, 80,  212, 56 },
-	{ 43781, 42181, 38382,  116, 254, 122,  214, 54 },
-	{ 43568, 41931, 38291,  13, 160, 80,  212, 56 },
-	{ 44659, 41931, 32767,  4, 160, 127,  220, 56 },
-	{ 44659, 41931, 32767,  4, 160, 127,  220, 56 },
-	{ 44890, 42181, 32767,  115, 254, 127,  222, 54 },
-	{ 43781, 42181, 38382,  116, 254, 122,  214, 54 },
-	{ 44214, 41931, 38566,  207, 220, 160,  217, 56 },
-	{ 43781, 42181, 38382,  116, 254, 122,  214, 54 },
-	{ 44890, 42181, 32767,  115, 254, 127,  222, 54 },
-	{ 44890, 42181, 32767,  115, 254, 127,  222, 54 },
-	{ 45359, 41931, 32767,  214, 220, 127,  226, 56 },
-	{ 44214, 41931, 38566,  207, 220, 160,  217, 56 },
-	{ 44692, 41178, 38769,  229, 190, 169,  221, 62 },
-	{ 44214, 41931, 38566,  207, 220, 160,  217, 56 },
-	{ 45359, 41931, 32767,  214, 220, 127,  226, 56 },
-	{ 45359, 41931, 32767,  214, 220, 127,  226, 56 },
-	{ 45877, 41178, 32767,  238, 190, 127,  230, 62 },
-	{ 44692, 41178, 38769,  229, 190, 169,  221, 62 },
-	{ 40577, 41931, 42760,  40, 160, 40,  189, 56 },
-	{ 40719, 41178, 42901,  40, 94, 40,  190, 62 },
-	{ 43752, 41178, 38369,  13, 94, 80,  213, 62 },
-	{ 43752, 41178, 38369,  13, 94, 80,  213, 62 },
-	{ 43568, 41931, 38291,  13, 160, 80,  212, 56 },
-	{ 40577, 41931, 42760,  40, 160, 40,  189, 56 },
-	{ 40741, 42181, 42923,  119, 254, 119,  190, 54 },
-	{ 40577, 41931, 42760,  40, 160, 40,  189, 56 },
-	{ 43568, 41931, 38291,  13, 160, 80,  212, 56 },
-	{ 43568, 41931, 38291,  13, 160, 80,  212, 56 },
-	{ 43781, 42181, 38382,  116, 254, 122,  214, 54 },
-	{ 40741, 42181, 42923,  119, 254, 119,  190, 54 },
-	{ 41075, 41931, 43257,  188, 220, 188,  192, 56 },
-	{ 40741, 42181, 42923,  119, 254, 119,  190, 54 },
-	{ 43781, 42181, 38382,  116, 254, 122,  214, 54 },
-	{ 43781, 42181, 38382,  116, 254, 122,  214, 54 },
-	{ 44214, 41931, 38566,  207, 220, 160,  217, 56 },
-	{ 41075, 41931, 43257,  188, 220, 188,  192, 56 },
-	{ 41442, 41178, 43625,  205, 190, 205,  195, 62 },
-	{ 41075, 41931, 43257,  188, 220, 188,  192, 56 },
-	{ 44214, 41931, 38566,  207, 220, 160,  217, 56 },
-	{ 44214, 41931, 38566,  207, 220, 160,  217, 56 },
-	{ 44692, 41178, 38769,  229, 190, 169,  221, 62 },
-	{ 41442, 41178, 43625,  205, 190, 205,  195, 62 },
-	{ 36109, 41931, 45750,  80, 160, 13,  154, 56 },
-	{ 36187, 41178, 45934,  80, 94, 13,  154, 62 },
-	{ 40719, 41178, 42901,  40, 94, 40,  190, 62 },
-	{ 40719, 41178, 42901,  40, 94, 40,  190, 62 },
-	{ 40577, 41931, 42760,  40, 160, 40,  189, 56 },
-	{ 36109, 41931, 45750,  80, 160, 13,  154, 56 },
-	{ 36199, 42181, 45963,  122, 254, 116,  154, 54 },
-	{ 36109, 41931, 45750,  80, 160, 13,  154, 56 },
-	{ 40577, 41931, 42760,  40, 160, 40,  189, 56 },
-	{ 40577, 41931, 42760,  40, 160, 40,  189, 56 },
-	{ 40741, 42181, 42923,  119, 254, 119,  190, 54 },
-	{ 36199, 42181, 45963,  122, 254, 116,  154, 54 },
-	{ 36384, 41931, 46397,  160, 220, 207,  156, 56 },
-	{ 36199, 42181, 45963,  122, 254, 116,  154, 54 },
-	{ 40741, 42181, 42923,  119, 254, 119,  190, 54 },
-	{ 40741, 42181, 42923,  119, 254, 119,  190, 54 },
-	{ 41075, 41931, 43257,  188, 220, 188,  192, 56 },
-	{ 36384, 41931, 46397,  160, 220, 207,  156, 56 },
-	{ 36587, 41178, 46874,  169, 190, 229,  157, 62 },
-	{ 36384, 41931, 46397,  160, 220, 207,  156, 56 },
-	{ 41075, 41931, 43257,  188, 220, 188,  192, 56 },
-	{ 41075, 41931, 43257,  188, 220, 188,  192, 56 },
-	{ 41442, 41178, 43625,  205, 190, 205,  195, 62 },
-	{ 36587, 41178, 46874,  169, 190, 229,  157, 62 },
-	{ 30585, 41931, 46841,  127, 159, 4,  110, 56 },
-	{ 30585, 41178, 47040,  127, 94, 4,  110, 62 },
-	{ 36187, 41178, 45934,  80, 94, 13,  154, 62 },
-	{ 36187, 41178, 45934,  80, 94, 13,  154, 62 },
-	{ 36109, 41931, 45750,  80, 160, 13,  154, 56 },
-	{ 30585, 41931, 46841,  127, 159, 4,  110, 56 },
-	{ 30585, 42181, 47072,  127, 254, 115,  110, 54 },
-	{ 30585, 41931, 46841,  127, 159, 4,  110, 56 },
-	{ 36109, 41931, 45750,  80, 160, 13,  154, 56 },
-	{ 36109, 41931, 45750,  80, 160, 13,  154, 56 },
-	{ 36199, 42181, 45963,  122, 254, 116,  154, 54 },
-	{ 30585, 42181, 47072,  127, 254, 115,  110, 54 },
-	{ 30585, 41931, 47542,  127, 220, 214,  110, 56 },
-	{ 30585, 42181, 47072,  127, 254, 115,  110, 54 },
-	{ 36199, 42181, 45963,  122, 254, 116,  154, 54 },
-	{ 36199, 42181, 45963,  122, 254, 116,  154, 54 },
-	{ 36384, 41931, 46397,  160, 220, 207,  156, 56 },
-	{ 30585, 41931, 47542,  127, 220, 214,  110, 56 },
-	{ 30585, 41178, 48060,  127, 190, 238,  110, 62 },
-	{ 30585, 41931, 47542,  127, 220, 214,  110, 56 },
-	{ 36384, 41931, 46397,  160, 220, 207,  156, 56 },
-	{ 36384, 41931, 46397,  160, 220, 207,  156, 56 },
-	{ 36587, 41178, 46874,  169, 190, 229,  157, 62 },
-	{ 30585, 41178, 48060,  127, 190, 238,  110, 62 },
-	{ 24897, 41931, 45750,  175, 146, 10,  66, 56 },
-	{ 24595, 41178, 45934,  175, 81, 18,  64, 62 },
-	{ 30585, 41178, 47040,  127, 94, 4,  110, 62 },
-	{ 30585, 41178, 47040,  127, 94, 4,  110, 62 },
-	{ 30585, 41931, 46841,  127, 159, 4,  110, 56 },
-	{ 24897, 41931, 45750,  175, 146, 10,  66, 56 },
-	{ 24922, 42181, 45963,  131, 253, 111,  66, 54 },
-	{ 24897, 41931, 45750,  175, 146, 10,  66, 56 },
-	{ 30585, 41931, 46841,  127, 159, 4,  110, 56 },
-	{ 30585, 41931, 46841,  127, 159, 4,  110, 56 },
-	{ 30585, 42181, 47072,  127, 254, 115,  110, 54 },
-	{ 24922, 42181, 45963,  131, 253, 111,  66, 54 },
-	{ 24779, 41931, 46397,  94, 220, 208,  65, 56 },
-	{ 24922, 42181, 45963,  131, 253, 111,  66, 54 },
-	{ 30585, 42181, 47072,  127, 254, 115,  110, 54 },
-	{ 30585, 42181, 47072,  127, 254, 115,  110, 54 },
-	{ 30585, 41931, 47542,  127, 220, 214,  110, 56 },
-	{ 24779, 41931, 46397,  94, 220, 208,  65, 56 },
-	{ 24582, 41178, 46874,  85, 190, 230,  64, 62 },
-	{ 24779, 41931, 46397,  94, 220, 208,  65, 56 },
-	{ 30585, 41931, 47542,  127, 220, 214,  110, 56 },
-	{ 30585, 41931, 47542,  127, 220, 214,  110, 56 },
-	{ 30585, 41178, 48060,  127, 190, 238,  110, 62 },
-	{ 24582, 41178, 46874,  85, 190, 230,  64, 62 },
-	{ 20447, 41931, 42760,  218, 136, 38,  31, 56 },
-	{ 20107, 41178, 42901,  212, 75, 47,  29, 62 },
-	{ 24595, 41178, 45934,  175, 81, 18,  64, 62 },
-	{ 24595, 41178, 45934,  175, 81, 18,  64, 62 },
-	{ 24897, 41931, 45750,  175, 146, 10,  66, 56 },
-	{ 20447, 41931, 42760,  218, 136, 38,  31, 56 },
-	{ 20385, 42181, 42923,  140, 253, 111,  31, 54 },
-	{ 20447, 41931, 42760,  218, 136, 38,  31, 56 },
-	{ 24897, 41931, 45750,  175, 146, 10,  66, 56 },
-	{ 24897, 41931, 45750,  175, 146, 10,  66, 56 },
-	{ 24922, 42181, 45963,  131, 253, 111,  66, 54 },
-	{ 20385, 42181, 42923,  140, 253, 111,  31, 54 },
-	{ 20089, 41931, 43257,  65, 219, 189,  28, 56 },
-	{ 20385, 42181, 42923,  140, 253, 111,  31, 54 },
-	{ 24922, 42181, 45963,  131, 253, 111,  66, 54 },
-	{ 24922, 42181, 45963,  131, 253, 111,  66, 54 },
-	{ 24779, 41931, 46397,  94, 220, 208,  65, 56 },
-	{ 20089, 41931, 43257,  65, 219, 189,  28, 56 },
-	{ 19727, 41178, 43625,  49, 190, 205,  26, 62 },
-	{ 20089, 41931, 43257,  65, 219, 189,  28, 56 },
-	{ 24779, 41931, 46397,  94, 220, 208,  65, 56 },
-	{ 24779, 41931, 46397,  94, 220, 208,  65, 56 },
-	{ 24582, 41178, 46874,  85, 190, 230,  64, 62 },
-	{ 19727, 41178, 43625,  49, 190, 205,  26, 62 },
-	{ 17547, 41931, 38291,  244, 148, 81,  9, 56 },
-	{ 17289, 41178, 38369,  239, 85, 84,  7, 62 },
-	{ 20107, 41178, 42901,  212, 75, 47,  29, 62 },
-	{ 20107, 41178, 42901,  212, 75, 47,  29, 62 },
-	{ 20447, 41931, 42760,  218, 136, 38,  31, 56 },
-	{ 17547, 41931, 38291,  244, 148, 81,  9, 56 },
-	{ 17372, 42181, 38382,  141, 254, 121,  7, 54 },
-	{ 17547, 41931, 38291,  244, 148, 81,  9, 56 },
-	{ 20447, 41931, 42760,  218, 136, 38,  31, 56 },
-	{ 20447, 41931, 42760,  218, 136, 38,  31, 56 },
-	{ 20385, 42181, 42923,  140, 253, 111,  31, 54 },
-	{ 17372, 42181, 38382,  141, 254, 121,  7, 54 },
-	{ 16953, 41931, 38566,  46, 220, 160,  4, 56 },
-	{ 17372, 42181, 38382,  141, 254, 121,  7, 54 },
-	{ 20385, 42181, 42923,  140, 253, 111,  31, 54 },
-	{ 20385, 42181, 42923,  140, 253, 111,  31, 54 },
-	{ 20089, 41931, 43257,  65, 219, 189,  28, 56 },
-	{ 16953, 41931, 38566,  46, 220, 160,  4, 56 },
-	{ 16477, 41178, 38769,  24, 190, 169,  0, 62 },
-	{ 16953, 41931, 38566,  46, 220, 160,  4, 56 },
-	{ 20089, 41931, 43257,  65, 219, 189,  28, 56 },
-	{ 20089, 41931, 43257,  65, 219, 189,  28, 56 },
-	{ 19727, 41178, 43625,  49, 190, 205,  26, 62 },
-	{ 16477, 41178, 38769,  24, 190, 169,  0, 62 },
-	{ 16511, 41931, 32767,  250, 159, 128,  0, 56 },
-	{ 16312, 41178, 32767,  250, 94, 128,  0, 62 },
-	{ 17289, 41178, 38369,  239, 85, 84,  7, 62 },
-	{ 17289, 41178, 38369,  239, 85, 84,  7, 62 },
-	{ 17547, 41931, 38291,  244, 148, 81,  9, 56 },
-	{ 16511, 41931, 32767,  250, 159, 128,  0, 56 },
-	{ 16280, 42181, 32767,  139, 254, 127,  0, 54 },
-	{ 16511, 41931, 32767,  250, 159, 128,  0, 56 },
-	{ 17547, 41931, 38291,  244, 148, 81,  9, 56 },
-	{ 17547, 41931, 38291,  244, 148, 81,  9, 56 },
-	{ 17372, 42181, 38382,  141, 254, 121,  7, 54 },
-	{ 16280, 42181, 32767,  139, 254, 127,  0, 54 },
-	{ 15810, 41931, 32767,  40, 220, 127,  252, 56 },
-	{ 16280, 42181, 32767,  139, 254, 127,  0, 54 },
-	{ 17372, 42181, 38382,  141, 254, 121,  7, 54 },
-	{ 17372, 42181, 38382,  141, 254, 121,  7, 54 },
-	{ 16953, 41931, 38566,  46, 220, 160,  4, 56 },
-	{ 15810, 41931, 32767,  40, 220, 127,  252, 56 },
-	{ 15292, 41178, 32767,  16, 190, 127,  248, 62 },
-	{ 15810, 41931, 32767,  40, 220, 127,  252, 56 },
-	{ 16953, 41931, 38566,  46, 220, 160,  4, 56 },
-	{ 16953, 41931, 38566,  46, 220, 160,  4, 56 },
-	{ 16477, 41178, 38769,  24, 190, 169,  0, 62 },
-	{ 15292, 41178, 32767,  16, 190, 127,  248, 62 },
-	{ 17601, 41931, 27243,  241, 160, 174,  9, 56 },
-	{ 17418, 41178, 27165,  241, 94, 174,  8, 62 },
-	{ 16312, 41178, 32767,  250, 94, 128,  0, 62 },
-	{ 16312, 41178, 32767,  250, 94, 128,  0, 62 },
-	{ 16511, 41931, 32767,  250, 159, 128,  0, 56 },
-	{ 17601, 41931, 27243,  241, 160, 174,  9, 56 },
-	{ 17388, 42181, 27152,  138, 254, 132,  7, 54 },
-	{ 17601, 41931, 27243,  241, 160, 174,  9, 56 },
-	{ 16511, 41931, 32767,  250, 159, 128,  0, 56 },
-	{ 16511, 41931, 32767,  250, 159, 128,  0, 56 },
-	{ 16280, 42181, 32767,  139, 254, 127,  0, 54 },
-	{ 17388, 42181, 27152,  138, 254, 132,  7, 54 },
-	{ 16955, 41931, 26968,  47, 220, 94,  4, 56 },
-	{ 17388, 42181, 27152,  138, 254, 132,  7, 54 },
-	{ 16280, 42181, 32767,  139, 254, 127,  0, 54 },
-	{ 16280, 42181, 32767,  139, 254, 127,  0, 54 },
-	{ 15810, 41931, 32767,  40, 220, 127,  252, 56 },
-	{ 16955, 41931, 26968,  47, 220, 94,  4, 56 },
-	{ 16477, 41178, 26765,  25, 190, 85,  0, 62 },
-	{ 16955, 41931, 26968,  47, 220, 94,  4, 56 },
-	{ 15810, 41931, 32767,  40, 220, 127,  252, 56 },
-	{ 15810, 41931, 32767,  40, 220, 127,  252, 56 },
-	{ 15292, 41178, 32767,  16, 190, 127,  248, 62 },
-	{ 16477, 41178, 26765,  25, 190, 85,  0, 62 },
-	{ 20592, 41931, 22775,  214, 160, 214,  32, 56 },
-	{ 20451, 41178, 22633,  214, 94, 214,  31, 62 },
-	{ 17418, 41178, 27165,  241, 94, 174,  8, 62 },
-	{ 17418, 41178, 27165,  241, 94, 174,  8, 62 },
-	{ 17601, 41931, 27243,  241, 160, 174,  9, 56 },
-	{ 20592, 41931, 22775,  214, 160, 214,  32, 56 },
-	{ 20428, 42181, 22611,  135, 254, 135,  31, 54 },
-	{ 20592, 41931, 22775,  214, 160, 214,  32, 56 },
-	{ 17601, 41931, 27243,  241, 160, 174,  9, 56 },
-	{ 17601, 41931, 27243,  241, 160, 174,  9, 56 },
-	{ 17388, 42181, 27152,  138, 254, 132,  7, 54 },
-	{ 20428, 42181, 22611,  135, 254, 135,  31, 54 },
-	{ 20094, 41931, 22277,  66, 220, 66,  28, 56 },
-	{ 20428, 42181, 22611,  135, 254, 135,  31, 54 },
-	{ 17388, 42181, 27152,  138, 254, 132,  7, 54 },
-	{ 17388, 42181, 27152,  138, 254, 132,  7, 54 },
-	{ 16955, 41931, 26968,  47, 220, 94,  4, 56 },
-	{ 20094, 41931, 22277,  66, 220, 66,  28, 56 },
-	{ 19727, 41178, 21909,  49, 190, 49,  26, 62 },
-	{ 20094, 41931, 22277,  66, 220, 66,  28, 56 },
-	{ 16955, 41931, 26968,  47, 220, 94,  4, 56 },
-	{ 16955, 41931, 26968,  47, 220, 94,  4, 56 },
-	{ 16477, 41178, 26765,  25, 190, 85,  0, 62 },
-	{ 19727, 41178, 21909,  49, 190, 49,  26, 62 },
-	{ 25061, 41931, 19784,  174, 160, 241,  67, 56 },
-	{ 24982, 41178, 19600,  174, 94, 241,  67, 62 },
-	{ 20451, 41178, 22633,  214, 94, 214,  31, 62 },
-	{ 20451, 41178, 22633,  214, 94, 214,  31, 62 },
-	{ 20592, 41931, 22775,  214, 160, 214,  32, 56 },
-	{ 25061, 41931, 19784,  174, 160, 241,  67, 56 },
-	{ 24970, 42181, 19571,  132, 254, 138,  67, 54 },
-	{ 25061, 41931, 19784,  174, 160, 241,  67, 56 },
-	{ 20592, 41931, 22775,  214, 160, 214,  32, 56 },
-	{ 20592, 41931, 22775,  214, 160, 214,  32, 56 },
-	{ 20428, 42181, 22611,  135, 254, 135,  31, 54 },
-	{ 24970, 42181, 19571,  132, 254, 138,  67, 54 },
-	{ 24786, 41931, 19137,  94, 220, 47,  65, 56 },
-	{ 24970, 42181, 19571,  132, 254, 138,  67, 54 },
-	{ 20428, 42181, 22611,  135, 254, 135,  31, 54 },
-	{ 20428, 42181, 22611,  135, 254, 135,  31, 54 },
-	{ 20094, 41931, 22277,  66, 220, 66,  28, 56 },
-	{ 24786, 41931, 19137,  94, 220, 47,  65, 56 },
-	{ 24582, 41178, 18660,  85, 190, 25,  64, 62 },
-	{ 24786, 41931, 19137,  94, 220, 47,  65, 56 },
-	{ 20094, 41931, 22277,  66, 220, 66,  28, 56 },
-	{ 20094, 41931, 22277,  66, 220, 66,  28, 56 },
-	{ 19727, 41178, 21909,  49, 190, 49,  26, 62 },
-	{ 24582, 41178, 18660,  85, 190, 25,  64, 62 },
-	{ 30585, 41931, 18693,  127, 160, 250,  110, 56 },
-	{ 30585, 41178, 18494,  127, 94, 250,  110, 62 },
-	{ 24982, 41178, 19600,  174, 94, 241,  67, 62 },
-	{ 24982, 41178, 19600,  174, 94, 241,  67, 62 },
-	{ 25061, 41931, 19784,  174, 160, 241,  67, 56 },
-	{ 30585, 41931, 18693,  127, 160, 250,  110, 56 },
-	{ 30585, 42181, 18462,  127, 254, 139,  110, 54 },
-	{ 30585, 41931, 18693,  127, 160, 250,  110, 56 },
-	{ 25061, 41931, 19784,  174, 160, 241,  67, 56 },
-	{ 25061, 41931, 19784,  174, 160, 241,  67, 56 },
-	{ 24970, 42181, 19571,  132, 254, 138,  67, 54 },
-	{ 30585, 42181, 18462,  127, 254, 139,  110, 54 },
-	{ 30585, 41931, 17992,  127, 220, 40,  110, 56 },
-	{ 30585, 42181, 18462,  127, 254, 139,  110, 54 },
-	{ 24970, 42181, 19571,  132, 254, 138,  67, 54 },
-	{ 24970, 42181, 19571,  132, 254, 138,  67, 54 },
-	{ 24786, 41931, 19137,  94, 220, 47,  65, 56 },
-	{ 30585, 41931, 17992,  127, 220, 40,  110, 56 },
-	{ 30585, 41178, 17474,  127, 190, 16,  110, 62 },
-	{ 30585, 41931, 17992,  127, 220, 40,  110, 56 },
-	{ 24786, 41931, 19137,  94, 220, 47,  65, 56 },
-	{ 24786, 41931, 19137,  94, 220, 47,  65, 56 },
-	{ 24582, 41178, 18660,  85, 190, 25,  64, 62 },
-	{ 30585, 41178, 17474,  127, 190, 16,  110, 62 },
-	{ 36109, 41931, 19784,  80, 160, 241,  154, 56 },
-	{ 36187, 41178, 19600,  80, 94, 241,  154, 62 },
-	{ 30585, 41178, 18494,  127, 94, 250,  110, 62 },
-	{ 30585, 41178, 18494,  127, 94, 250,  110, 62 },
-	{ 30585, 41931, 18693,  127, 160, 250,  110, 56 },
-	{ 36109, 41931, 19784,  80, 160, 241,  154, 56 },
-	{ 36199, 42181, 19571,  122, 254, 138,  154, 54 },
-	{ 36109, 41931, 19784,  80, 160, 241,  154, 56 },
-	{ 30585, 41931, 18693,  127, 160, 250,  110, 56 },
-	{ 30585, 41931, 18693,  127, 160, 250,  110, 56 },
-	{ 30585, 42181, 18462,  127, 254, 139,  110, 54 },
-	{ 36199, 42181, 19571,  122, 254, 138,  154, 54 },
-	{ 36384, 41931, 19137,  160, 220, 47,  156, 56 },
-	{ 36199, 42181, 19571,  122, 254, 138,  154, 54 },
-	{ 30585, 42181, 18462,  127, 254, 139,  110, 54 },
-	{ 30585, 42181, 18462,  127, 254, 139,  110, 54 },
-	{ 30585, 41931, 17992,  127, 220, 40,  110, 56 },
-	{ 36384, 41931, 19137,  160, 220, 47,  156, 56 },
-	{ 36587, 41178, 18660,  169, 190, 25,  157, 62 },
-	{ 36384, 41931, 19137,  160, 220, 47,  156, 56 },
-	{ 30585, 41931, 17992,  127, 220, 40,  110, 56 },
-	{ 30585, 41931, 17992,  127, 220, 40,  110, 56 },
-	{ 30585, 41178, 17474,  127, 190, 16,  110, 62 },
-	{ 36587, 41178, 18660,  169, 190, 25,  157, 62 },
-	{ 40577, 41931, 22775,  40, 160, 214,  189, 56 },
-	{ 40719, 41178, 22633,  40, 94, 214,  190, 62 },
-	{ 36187, 41178, 19600,  80, 94, 241,  154, 62 },
-	{ 36187, 41178, 19600,  80, 94, 241,  154, 62 },
-	{ 36109, 41931, 19784,  80, 160, 241,  154, 56 },
-	{ 40577, 41931, 22775,  40, 160, 214,  189, 56 },
-	{ 40741, 42181, 22611,  119, 254, 135,  190, 54 },
-	{ 40577, 41931, 22775,  40, 160, 214,  189, 56 },
-	{ 36109, 41931, 19784,  80, 160, 241,  154, 56 },
-	{ 36109, 41931, 19784,  80, 160, 241,  154, 56 },
-	{ 36199, 42181, 19571,  122, 254, 138,  154, 54 },
-	{ 40741, 42181, 22611,  119, 254, 135,  190, 54 },
-	{ 41075, 41931, 22277,  188, 220, 66,  192, 56 },
-	{ 40741, 42181, 22611,  119, 254, 135,  190, 54 },
-	{ 36199, 42181, 19571,  122, 254, 138,  154, 54 },
-	{ 36199, 42181, 19571,  122, 254, 138,  154, 54 },
-	{ 36384, 41931, 19137,  160, 220, 47,  156, 56 },
-	{ 41075, 41931, 22277,  188, 220, 66,  192, 56 },
-	{ 41442, 41178, 21909,  205, 190, 49,  195, 62 },
-	{ 41075, 41931, 22277,  188, 220, 66,  192, 56 },
-	{ 36384, 41931, 19137,  160, 220, 47,  156, 56 },
-	{ 36384, 41931, 19137,  160, 220, 47,  156, 56 },
-	{ 36587, 41178, 18660,  169, 190, 25,  157, 62 },
-	{ 41442, 41178, 21909,  205, 190, 49,  195, 62 },
-	{ 43568, 41931, 27243,  13, 160, 174,  212, 56 },
-	{ 43752, 41178, 27165,  13, 94, 174,  213, 62 },
-	{ 40719, 41178, 22633,  40, 94, 214,  190, 62 },
-	{ 40719, 41178, 22633,  40, 94, 214,  190, 62 },
-	{ 40577, 41931, 22775,  40, 160, 214,  189, 56 },
-	{ 43568, 41931, 27243,  13, 160, 174,  212, 56 },
-	{ 43781, 42181, 27152,  116, 254, 132,  214, 54 },
-	{ 43568, 41931, 27243,  13, 160, 174,  212, 56 },
-	{ 40577, 41931, 22775,  40, 160, 214,  189, 56 },
-	{ 40577, 41931, 22775,  40, 160, 214,  189, 56 },
-	{ 40741, 42181, 22611,  119, 254, 135,  190, 54 },
-	{ 43781, 42181, 27152,  116, 254, 132,  214, 54 },
-	{ 44214, 41931, 26968,  207, 220, 94,  217, 56 },
-	{ 43781, 42181, 27152,  116, 254, 132,  214, 54 },
-	{ 40741, 42181, 22611,  119, 254, 135,  190, 54 },
-	{ 40741, 42181, 22611,  119, 254, 135,  190, 54 },
-	{ 41075, 41931, 22277,  188, 220, 66,  192, 56 },
-	{ 44214, 41931, 26968,  207, 220, 94,  217, 56 },
-	{ 44692, 41178, 26765,  229, 190, 85,  221, 62 },
-	{ 44214, 41931, 26968,  207, 220, 94,  217, 56 },
-	{ 41075, 41931, 22277,  188, 220, 66,  192, 56 },
-	{ 41075, 41931, 22277,  188, 220, 66,  192, 56 },
-	{ 41442, 41178, 21909,  205, 190, 49,  195, 62 },
-	{ 44692, 41178, 26765,  229, 190, 85,  221, 62 },
-	{ 44659, 41931, 32767,  4, 160, 127,  220, 56 },
-	{ 44858, 41178, 32767,  4, 94, 127,  222, 62 },
-	{ 43752, 41178, 27165,  13, 94, 174,  213, 62 },
-	{ 43752, 41178, 27165,  13, 94, 174,  213, 62 },
-	{ 43568, 41931, 27243,  13, 160, 174,  212, 56 },
-	{ 44659, 41931, 32767,  4, 160, 127,  220, 56 },
-	{ 44890, 42181, 32767,  115, 254, 127,  222, 54 },
-	{ 44659, 41931, 32767,  4, 160, 127,  220, 56 },
-	{ 43568, 41931, 27243,  13, 160, 174,  212, 56 },
-	{ 43568, 41931, 27243,  13, 160, 174,  212, 56 },
-	{ 43781, 42181, 27152,  116, 254, 132,  214, 54 },
-	{ 44890, 42181, 32767,  115, 254, 127,  222, 54 },
-	{ 45359, 41931, 32767,  214, 220, 127,  226, 56 },
-	{ 44890, 42181, 32767,  115, 254, 127,  222, 54 },
-	{ 43781, 42181, 27152,  116, 254, 132,  214, 54 },
-	{ 43781, 42181, 27152,  116, 254, 132,  214, 54 },
-	{ 44214, 41931, 26968,  207, 220, 94,  217, 56 },
-	{ 45359, 41931, 32767,  214, 220, 127,  226, 56 },
-	{ 45877, 41178, 32767,  238, 190, 127,  230, 62 },
-	{ 45359, 41931, 32767,  214, 220, 127,  226, 56 },
-	{ 44214, 41931, 26968,  207, 220, 94,  217, 56 },
-	{ 44214, 41931, 26968,  207, 220, 94,  217, 56 },
-	{ 44692, 41178, 26765,  229, 190, 85,  221, 62 },
-	{ 45877, 41178, 32767,  238, 190, 127,  230, 62 },
-	{ 46419, 37176, 39504,  235, 178, 172,  234, 93 },
-	{ 44692, 41178, 38769,  229, 190, 169,  221, 62 },
-	{ 45877, 41178, 32767,  238, 190, 127,  230, 62 },
-	{ 45877, 41178, 32767,  238, 190, 127,  230, 62 },
-	{ 47749, 37176, 32767,  244, 178, 127,  245, 93 },
-	{ 46419, 37176, 39504,  235, 178, 172,  234, 93 },
-	{ 47925, 33245, 40145,  238, 170, 173,  246, 124 },
-	{ 46419, 37176, 39504,  235, 178, 172,  234, 93 },
-	{ 47749, 37176, 32767,  244, 178, 127,  245, 93 },
-	{ 47749, 37176, 32767,  244, 178, 127,  245, 93 },
-	{ 49382, 33245, 32767,  247, 170, 127,  1, 124 },
-	{ 47925, 33245, 40145,  238, 170, 173,  246, 124 },
-	{ 48990, 29458, 40598,  242, 153, 175,  254, 153 },
-	{ 47925, 33245, 40145,  238, 170, 173,  246, 124 },
-	{ 49382, 33245, 32767,  247, 170, 127,  1, 124 },
-	{ 49382, 33245, 32767,  247, 170, 127,  1, 124 },
-	{ 50537, 29458, 32767,  252, 153, 127,  10, 153 },
-	{ 48990, 29458, 40598,  242, 153, 175,  254, 153 },
-	{ 49394, 25885, 40770,  245, 119, 176,  1, 181 },
-	{ 48990, 29458, 40598,  242, 153, 175,  254, 153 },
-	{ 50537, 29458, 32767,  252, 153, 127,  10, 153 },
-	{ 50537, 29458, 32767,  252, 153, 127,  10, 153 },
-	{ 50975, 25885, 32767,  254, 119, 127,  14, 181 },
-	{ 49394, 25885, 40770,  245, 119, 176,  1, 181 },
-	{ 42771, 37176, 44954,  209, 179, 209,  206, 93 },
-	{ 41442, 41178, 43625,  205, 190, 205,  195, 62 },
-	{ 44692, 41178, 38769,  229, 190, 169,  221, 62 },
-	{ 44692, 41178, 38769,  229, 190, 169,  221, 62 },
-	{ 46419, 37176, 39504,  235, 178, 172,  234, 93 },
-	{ 42771, 37176, 44954,  209, 179, 209,  206, 93 },
-	{ 43931, 33245, 46113,  212, 170, 212,  215, 124 },
-	{ 42771, 37176, 44954,  209, 179, 209,  206, 93 },
-	{ 46419, 37176, 39504,  235, 178, 172,  234, 93 },
-	{ 46419, 37176, 39504,  235, 178, 172,  234, 93 },
-	{ 47925, 33245, 40145,  238, 170, 173,  246, 124 },
-	{ 43931, 33245, 46113,  212, 170, 212,  215, 124 },
-	{ 44751, 29458, 46933,  215, 153, 215,  221, 153 },
-	{ 43931, 33245, 46113,  212, 170, 212,  215, 124 },
-	{ 47925, 33245, 40145,  238, 170, 173,  246, 124 },
-	{ 47925, 33245, 40145,  238, 170, 173,  246, 124 },
-	{ 48990, 29458, 40598,  242, 153, 175,  254, 153 },
-	{ 44751, 29458, 46933,  215, 153, 215,  221, 153 },
-	{ 45062, 25885, 47244,  217, 119, 217,  224, 181 },
-	{ 44751, 29458, 46933,  215, 153, 215,  221, 153 },
-	{ 48990, 29458, 40598,  242, 153, 175,  254, 153 },
-	{ 48990, 29458, 40598,  242, 153, 175,  254, 153 },
-	{ 49394, 25885, 40770,  245, 119, 176,  1, 181 },
-	{ 45062, 25885, 47244,  217, 119, 217,  224, 181 },
-	{ 37322, 37176, 48601,  172, 178, 235,  163, 93 },
-	{ 36587, 41178, 46874,  169, 190, 229,  157, 62 },
-	{ 41442, 41178, 43625,  205, 190, 205,  195, 62 },
-	{ 41442, 41178, 43625,  205, 190, 205,  195, 62 },
-	{ 42771, 37176, 44954,  209, 179, 209,  206, 93 },
-	{ 37322, 37176, 48601,  172, 178, 235,  163, 93 },
-	{ 37963, 33245, 50107,  173, 170, 238,  168, 124 },
-	{ 37322, 37176, 48601,  172, 178, 235,  163, 93 },
-	{ 42771, 37176, 44954,  209, 179, 209,  206, 93 },
-	{ 42771, 37176, 44954,  209, 179, 209,  206, 93 },
-	{ 43931, 33245, 46113,  212, 170, 212,  215, 124 },
-	{ 37963, 33245, 50107,  173, 170, 238,  168, 124 },
-	{ 38416, 29458, 51173,  175, 153, 242,  172, 153 },
-	{ 37963, 33245, 50107,  173, 170, 238,  168, 124 },
-	{ 43931, 33245, 46113,  212, 170, 212,  215, 124 },
-	{ 43931, 33245, 46113,  212, 170, 212,  215, 124 },
-	{ 44751, 29458, 46933,  215, 153, 215,  221, 153 },
-	{ 38416, 29458, 51173,  175, 153, 242,  172, 153 },
-	{ 38588, 25885, 51577,  176, 119, 245,  173, 181 },
-	{ 38416, 29458, 51173,  175, 153, 242,  172, 153 },
-	{ 44751, 29458, 46933,  215, 153, 215,  221, 153 },
-	{ 44751, 29458, 46933,  215, 153, 215,  221, 153 },
-	{ 45062, 25885, 47244,  217, 119, 217,  224, 181 },
-	{ 38588, 25885, 51577,  176, 119, 245,  173, 181 },
-	{ 30585, 37176, 49931,  127, 178, 244,  110, 93 },
-	{ 30585, 41178, 48060,  127, 190, 238,  110, 62 },
-	{ 36587, 41178, 46874,  169, 190, 229,  157, 62 },
-	{ 36587, 41178, 46874,  169, 190, 229,  157, 62 },
-	{ 37322, 37176, 48601,  172, 178, 235,  163, 93 },
-	{ 30585, 37176, 49931,  127, 178, 244,  110, 93 },
-	{ 30585, 33245, 51564,  127, 170, 247,  110, 124 },
-	{ 30585, 37176, 49931,  127, 178, 244,  110, 93 },
-	{ 37322, 37176, 48601,  172, 178, 235,  163, 93 },
-	{ 37322, 37176, 48601,  172, 178, 235,  163, 93 },
-	{ 37963, 33245, 50107,  173, 170, 238,  168, 124 },
-	{ 30585, 33245, 51564,  127, 170, 247,  110, 124 },
-	{ 30585, 29458, 52719,  127, 153, 252,  110, 153 },
-	{ 30585, 33245, 51564,  127, 170, 247,  110, 124 },
-	{ 37963, 33245, 50107,  173, 170, 238,  168, 124 },
-	{ 37963, 33245, 50107,  173, 170, 238,  168, 124 },
-	{ 38416, 29458, 51173,  175, 153, 242,  172, 153 },
-	{ 30585, 29458, 52719,  127, 153, 252,  110, 153 },
-	{ 30585, 25885, 53157,  127, 119, 254,  110, 181 },
-	{ 30585, 29458, 52719,  127, 153, 252,  110, 153 },
-	{ 38416, 29458, 51173,  175, 153, 242,  172, 153 },
-	{ 38416, 29458, 51173,  175, 153, 242,  172, 153 },
-	{ 38588, 25885, 51577,  176, 119, 245,  173, 181 },
-	{ 30585, 25885, 53157,  127, 119, 254,  110, 181 },
-	{ 23848, 37176, 48601,  82, 178, 235,  58, 93 },
-	{ 24582, 41178, 46874,  85, 190, 230,  64, 62 },
-	{ 30585, 41178, 48060,  127, 190, 238,  110, 62 },
-	{ 30585, 41178, 48060,  127, 190, 238,  110, 62 },
-	{ 30585, 37176, 49931,  127, 178, 244,  110, 93 },
-	{ 23848, 37176, 48601,  82, 178, 235,  58, 93 },
-	{ 23207, 33245, 50107,  81, 170, 238,  53, 124 },
-	{ 23848, 37176, 48601,  82, 178, 235,  58, 93 },
-	{ 30585, 37176, 49931,  127, 178, 244,  110, 93 },
-	{ 30585, 37176, 49931,  127, 178, 244,  110, 93 },
-	{ 30585, 33245, 51564,  127, 170, 247,  110, 124 },
-	{ 23207, 33245, 50107,  81, 170, 238,  53, 124 },
-	{ 22753, 29458, 51173,  79, 153, 242,  49, 153 },
-	{ 23207, 33245, 50107,  81, 170, 238,  53, 124 },
-	{ 30585, 33245, 51564,  127, 170, 247,  110, 124 },
-	{ 30585, 33245, 51564,  127, 170, 247,  110, 124 },
-	{ 30585, 29458, 52719,  127, 153, 252,  110, 153 },
-	{ 22753, 29458, 51173,  79, 153, 242,  49, 153 },
-	{ 22582, 25885, 51577,  78, 119, 245,  48, 181 },
-	{ 22753, 29458, 51173,  79, 153, 242,  49, 153 },
-	{ 30585, 29458, 52719,  127, 153, 252,  110, 153 },
-	{ 30585, 29458, 52719,  127, 153, 252,  110, 153 },
-	{ 30585, 25885, 53157,  127, 119, 254,  110, 181 },
-	{ 22582, 25885, 51577,  78, 119, 245,  48, 181 },
-	{ 18398, 37176, 44954,  45, 179, 209,  15, 93 },
-	{ 19727, 41178, 43625,  49, 190, 205,  26, 62 },
-	{ 24582, 41178, 46874,  85, 190, 230,  64, 62 },
-	{ 24582, 41178, 46874,  85, 190, 230,  64, 62 },
-	{ 23848, 37176, 48601,  82, 178, 235,  58, 93 },
-	{ 18398, 37176, 44954,  45, 179, 209,  15, 93 },
-	{ 17239, 33245, 46113,  42, 170, 212,  6, 124 },
-	{ 18398, 37176, 44954,  45, 179, 209,  15, 93 },
-	{ 23848, 37176, 48601,  82, 178, 235,  58, 93 },
-	{ 23848, 37176, 48601,  82, 178, 235,  58, 93 },
-	{ 23207, 33245, 50107,  81, 170, 238,  53, 124 },
-	{ 17239, 33245, 46113,  42, 170, 212,  6, 124 },
-	{ 16419, 29458, 46933,  39, 153, 215,  0, 153 },
-	{ 17239, 33245, 46113,  42, 170, 212,  6, 124 },
-	{ 23207, 33245, 50107,  81, 170, 238,  53, 124 },
-	{ 23207, 33245, 50107,  81, 170, 238,  53, 124 },
-	{ 22753, 29458, 51173,  79, 153, 242,  49, 153 },
-	{ 16419, 29458, 46933,  39, 153, 215,  0, 153 },
-	{ 16108, 25885, 47244,  37, 119, 217,  254, 181 },
-	{ 16419, 29458, 46933,  39, 153, 215,  0, 153 },
-	{ 22753, 29458, 51173,  79, 153, 242,  49, 153 },
-	{ 22753, 29458, 51173,  79, 153, 242,  49, 153 },
-	{ 22582, 25885, 51577,  78, 119, 245,  48, 181 },
-	{ 16108, 25885, 47244,  37, 119, 217,  254, 181 },
-	{ 14751, 37176, 39504,  19, 178, 172,  244, 93 },
-	{ 16477, 41178, 38769,  24, 190, 169,  0, 62 },
-	{ 19727, 41178, 43625,  49, 190, 205,  26, 62 },
-	{ 19727, 41178, 43625,  49, 190, 205,  26, 62 },
-	{ 18398, 37176, 44954,  45, 179, 209,  15, 93 },
-	{ 14751, 37176, 39504,  19, 178, 172,  244, 93 },
-	{ 13244, 33245, 40145,  16, 170, 173,  232, 124 },
-	{ 14751, 37176, 39504,  19, 178, 172,  244, 93 },
-	{ 18398, 37176, 44954,  45, 179, 209,  15, 93 },
-	{ 18398, 37176, 44954,  45, 179, 209,  15, 93 },
-	{ 17239, 33245, 46113,  42, 170, 212,  6, 124 },
-	{ 13244, 33245, 40145,  16, 170, 173,  232, 124 },
-	{ 12179, 29458, 40598,  12, 153, 175,  224, 153 },
-	{ 13244, 33245, 40145,  16, 170, 173,  232, 124 },
-	{ 17239, 33245, 46113,  42, 170, 212,  6, 124 },
-	{ 17239, 33245, 46113,  42, 170, 212,  6, 124 },
-	{ 16419, 29458, 46933,  39, 153, 215,  0, 153 },
-	{ 12179, 29458, 40598,  12, 153, 175,  224, 153 },
-	{ 11775, 25885, 40770,  9, 119, 176,  220, 181 },
-	{ 12179, 29458, 40598,  12, 153, 175,  224, 153 },
-	{ 16419, 29458, 46933,  39, 153, 215,  0, 153 },
-	{ 16419, 29458, 46933,  39, 153, 215,  0, 153 },
-	{ 16108, 25885, 47244,  37, 119, 217,  254, 181 },
-	{ 11775, 25885, 40770,  9, 119, 176,  220, 181 },
-	{ 13420, 37176, 32767,  10, 178, 127,  233, 93 },
-	{ 15292, 41178, 32767,  16, 190, 127,  248, 62 },
-	{ 16477, 41178, 38769,  24, 190, 169,  0, 62 },
-	{ 16477, 41178, 38769,  24, 190, 169,  0, 62 },
-	{ 14751, 37176, 39504,  19, 178, 172,  244, 93 },
-	{ 13420, 37176, 32767,  10, 178, 127,  233, 93 },
-	{ 11788, 33245, 32767,  7, 170, 127,  221, 124 },
-	{ 13420, 37176, 32767,  10, 178, 127,  233, 93 },
-	{ 14751, 37176, 39504,  19, 178, 172,  244, 93 },
-	{ 14751, 37176, 39504,  19, 178, 172,  244, 93 },
-	{ 13244, 33245, 40145,  16, 170, 173,  232, 124 },
-	{ 11788, 33245, 32767,  7, 170, 127,  221, 124 },
-	{ 10633, 29458, 32767,  2, 153, 127,  212, 153 },
-	{ 11788, 33245, 32767,  7, 170, 127,  221, 124 },
-	{ 13244, 33245, 40145,  16, 170, 173,  232, 124 },
-	{ 13244, 33245, 40145,  16, 170, 173,  232, 124 },
-	{ 12179, 29458, 40598,  12, 153, 175,  224, 153 },
-	{ 10633, 29458, 32767,  2, 153, 127,  212, 153 },
-	{ 10195, 25885, 32767,  0, 119, 127,  208, 181 },
-	{ 10633, 29458, 32767,  2, 153, 127,  212, 153 },
-	{ 12179, 29458, 40598,  12, 153, 175,  224, 153 },
-	{ 12179, 29458, 40598,  12, 153, 175,  224, 153 },
-	{ 11775, 25885, 40770,  9, 119, 176,  220, 181 },
-	{ 10195, 25885, 32767,  0, 119, 127,  208, 181 },
-	{ 14751, 37176, 26030,  19, 178, 82,  244, 93 },
-	{ 16477, 41178, 26765,  25, 190, 85,  0, 62 },
-	{ 15292, 41178, 32767,  16, 190, 127,  248, 62 },
-	{ 15292, 41178, 32767,  16, 190, 127,  248, 62 },
-	{ 13420, 37176, 32767,  10, 178, 127,  233, 93 },
-	{ 14751, 37176, 26030,  19, 178, 82,  244, 93 },
-	{ 13244, 33245, 25389,  16, 170, 81,  232, 124 },
-	{ 14751, 37176, 26030,  19, 178, 82,  244, 93 },
-	{ 13420, 37176, 32767,  10, 178, 127,  233, 93 },
-	{ 13420, 37176, 32767,  10, 178, 127,  233, 93 },
-	{ 11788, 33245, 32767,  7, 170, 127,  221, 124 },
-	{ 13244, 33245, 25389,  16, 170, 81,  232, 124 },
-	{ 12179, 29458, 24936,  12, 153, 79,  224, 153 },
-	{ 13244, 33245, 25389,  16, 170, 81,  232, 124 },
-	{ 11788, 33245, 32767,  7, 170, 127,  221, 124 },
-	{ 11788, 33245, 32767,  7, 170, 127,  221, 124 },
-	{ 10633, 29458, 32767,  2, 153, 127,  212, 153 },
-	{ 12179, 29458, 24936,  12, 153, 79,  224, 153 },
-	{ 11775, 25885, 24764,  9, 119, 78,  220, 181 },
-	{ 12179, 29458, 24936,  12, 153, 79,  224, 153 },
-	{ 10633, 29458, 32767,  2, 153, 127,  212, 153 },
-	{ 10633, 29458, 32767,  2, 153, 127,  212, 153 },
-	{ 10195, 25885, 32767,  0, 119, 127,  208, 181 },
-	{ 11775, 25885, 24764,  9, 119, 78,  220, 181 },
-	{ 18398, 37176, 20580,  45, 179, 45,  15, 93 },
-	{ 19727, 41178, 21909,  49, 190, 49,  26, 62 },
-	{ 16477, 41178, 26765,  25, 190, 85,  0, 62 },
-	{ 16477, 41178, 26765,  25, 190, 85,  0, 62 },
-	{ 14751, 37176, 26030,  19, 178, 82,  244, 93 },
-	{ 18398, 37176, 20580,  45, 179, 45,  15, 93 },
-	{ 17239, 33245, 19421,  42, 170, 42,  6, 124 },
-	{ 18398, 37176, 20580,  45, 179, 45,  15, 93 },
-	{ 14751, 37176, 26030,  19, 178, 82,  244, 93 },
-	{ 14751, 37176, 26030,  19, 178, 82,  244, 93 },
-	{ 13244, 33245, 25389,  16, 170, 81,  232, 124 },
-	{ 17239, 33245, 19421,  42, 170, 42,  6, 124 },
-	{ 16419, 29458, 18601,  39, 153, 39,  0, 153 },
-	{ 17239, 33245, 19421,  42, 170, 42,  6, 124 },
-	{ 13244, 33245, 25389,  16, 170, 81,  232, 124 },
-	{ 13244, 33245, 25389,  16, 170, 81,  232, 124 },
-	{ 12179, 29458, 24936,  12, 153, 79,  224, 153 },
-	{ 16419, 29458, 18601,  39, 153, 39,  0, 153 },
-	{ 16108, 25885, 18290,  37, 119, 37,  254, 181 },
-	{ 16419, 29458, 18601,  39, 153, 39,  0, 153 },
-	{ 12179, 29458, 24936,  12, 153, 79,  224, 153 },
-	{ 12179, 29458, 24936,  12, 153, 79,  224, 153 },
-	{ 11775, 25885, 24764,  9, 119, 78,  220, 181 },
-	{ 16108, 25885, 18290,  37, 119, 37,  254, 181 },
-	{ 23848, 37176, 16933,  82, 178, 19,  58, 93 },
-	{ 24582, 41178, 18660,  85, 190, 25,  64, 62 },
-	{ 19727, 41178, 21909,  49, 190, 49,  26, 62 },
-	{ 19727, 41178, 21909,  49, 190, 49,  26, 62 },
-	{ 18398, 37176, 20580,  45, 179, 45,  15, 93 },
-	{ 23848, 37176, 16933,  82, 178, 19,  58, 93 },
-	{ 23207, 33245, 15427,  81, 170, 16,  53, 124 },
-	{ 23848, 37176, 16933,  82, 178, 19,  58, 93 },
-	{ 18398, 37176, 20580,  45, 179, 45,  15, 93 },
-	{ 18398, 37176, 20580,  45, 179, 45,  15, 93 },
-	{ 17239, 33245, 19421,  42, 170, 42,  6, 124 },
-	{ 23207, 33245, 15427,  81, 170, 16,  53, 124 },
-	{ 22753, 29458, 14361,  79, 153, 12,  49, 153 },
-	{ 23207, 33245, 15427,  81, 170, 16,  53, 124 },
-	{ 17239, 33245, 19421,  42, 170, 42,  6, 124 },
-	{ 17239, 33245, 19421,  42, 170, 42,  6, 124 },
-	{ 16419, 29458, 18601,  39, 153, 39,  0, 153 },
-	{ 22753, 29458, 14361,  79, 153, 12,  49, 153 },
-	{ 22582, 25885, 13957,  78, 119, 9,  48, 181 },
-	{ 22753, 29458, 14361,  79, 153, 12,  49, 153 },
-	{ 16419, 29458, 18601,  39, 153, 39,  0, 153 },
-	{ 16419, 29458, 18601,  39, 153, 39,  0, 153 },
-	{ 16108, 25885, 18290,  37, 119, 37,  254, 181 },
-	{ 22582, 25885, 13957,  78, 119, 9,  48, 181 },
-	{ 30585, 37176, 15603,  127, 178, 10,  110, 93 },
-	{ 30585, 41178, 17474,  127, 190, 16,  110, 62 },
-	{ 24582, 41178, 18660,  85, 190, 25,  64, 62 },
-	{ 24582, 41178, 18660,  85, 190, 25,  64, 62 },
-	{ 23848, 37176, 16933,  82, 178, 19,  58, 93 },
-	{ 30585, 37176, 15603,  127, 178, 10,  110, 93 },
-	{ 30585, 33245, 13970,  127, 170, 7,  110, 124 },
-	{ 30585, 37176, 15603,  127, 178, 10,  110, 93 },
-	{ 23848, 37176, 16933,  82, 178, 19,  58, 93 },
-	{ 23848, 37176, 16933,  82, 178, 19,  58, 93 },
-	{ 23207, 33245, 15427,  81, 170, 16,  53, 124 },
-	{ 30585, 33245, 13970,  127, 170, 7,  110, 124 },
-	{ 30585, 29458, 12815,  127, 153, 2,  110, 153 },
-	{ 30585, 33245, 13970,  127, 170, 7,  110, 124 },
-	{ 23207, 33245, 15427,  81, 170, 16,  53, 124 },
-	{ 23207, 33245, 15427,  81, 170, 16,  53, 124 },
-	{ 22753, 29458, 14361,  79, 153, 12,  49, 153 },
-	{ 30585, 29458, 12815,  127, 153, 2,  110, 153 },
-	{ 30585, 25885, 12377,  127, 119, 0,  110, 181 },
-	{ 30585, 29458, 12815,  127, 153, 2,  110, 153 },
-	{ 22753, 29458, 14361,  79, 153, 12,  49, 153 },
-	{ 22753, 29458, 14361,  79, 153, 12,  49, 153 },
-	{ 22582, 25885, 13957,  78, 119, 9,  48, 181 },
-	{ 30585, 25885, 12377,  127, 119, 0,  110, 181 },
-	{ 37322, 37176, 16933,  172, 178, 19,  163, 93 },
-	{ 36587, 41178, 18660,  169, 190, 25,  157, 62 },
-	{ 30585, 41178, 17474,  127, 190, 16,  110, 62 },
-	{ 30585, 41178, 17474,  127, 190, 16,  110, 62 },
-	{ 30585, 37176, 15603,  127, 178, 10,  110, 93 },
-	{ 37322, 37176, 16933,  172, 178, 19,  163, 93 },
-	{ 37963, 33245, 15427,  173, 170, 16,  168, 124 },
-	{ 37322, 37176, 16933,  172, 178, 19,  163, 93 },
-	{ 30585, 37176, 15603,  127, 178, 10,  110, 93 },
-	{ 30585, 37176, 15603,  127, 178, 10,  110, 93 },
-	{ 30585, 33245, 13970,  127, 170, 7,  110, 124 },
-	{ 37963, 33245, 15427,  173, 170, 16,  168, 124 },
-	{ 38416, 29458, 14361,  175, 153, 12,  172, 153 },
-	{ 37963, 33245, 15427,  173, 170, 16,  168, 124 },
-	{ 30585, 33245, 13970,  127, 170, 7,  110, 124 },
-	{ 30585, 33245, 13970,  127, 170, 7,  110, 124 },
-	{ 30585, 29458, 12815,  127, 153, 2,  110, 153 },
-	{ 38416, 29458, 14361,  175, 153, 12,  172, 153 },
-	{ 38588, 25885, 13957,  176, 119, 9,  173, 181 },
-	{ 38416, 29458, 14361,  175, 153, 12,  172, 153 },
-	{ 30585, 29458, 12815,  127, 153, 2,  110, 153 },
-	{ 30585, 29458, 12815,  127, 153, 2,  110, 153 },
-	{ 30585, 25885, 12377,  127, 119, 0,  110, 181 },
-	{ 38588, 25885, 13957,  176, 119, 9,  173, 181 },
-	{ 42771, 37176, 20580,  209, 179, 45,  206, 93 },
-	{ 41442, 41178, 21909,  205, 190, 49,  195, 62 },
-	{ 36587, 41178, 18660,  169, 190, 25,  157, 62 },
-	{ 36587, 41178, 18660,  169, 190, 25,  157, 62 },
-	{ 37322, 37176, 16933,  172, 178, 19,  163, 93 },
-	{ 42771, 37176, 20580,  209, 179, 45,  206, 93 },
-	{ 43931, 33245, 19421,  212, 170, 42,  215, 124 },
-	{ 42771, 37176, 20580,  209, 179, 45,  206, 93 },
-	{ 37322, 37176, 16933,  172, 178, 19,  163, 93 },
-	{ 37322, 37176, 16933,  172, 178, 19,  163, 93 },
-	{ 37963, 33245, 15427,  173, 170, 16,  168, 124 },
-	{ 43931, 33245, 19421,  212, 170, 42,  215, 124 },
-	{ 44751, 29458, 18601,  215, 153, 39,  221, 153 },
-	{ 43931, 33245, 19421,  212, 170, 42,  215, 124 },
-	{ 37963, 33245, 15427,  173, 170, 16,  168, 124 },
-	{ 37963, 33245, 15427,  173, 170, 16,  168, 124 },
-	{ 38416, 29458, 14361,  175, 153, 12,  172, 153 },
-	{ 44751, 29458, 18601,  215, 153, 39,  221, 153 },
-	{ 45062, 25885, 18290,  217, 119, 37,  224, 181 },
-	{ 44751, 29458, 18601,  215, 153, 39,  221, 153 },
-	{ 38416, 29458, 14361,  175, 153, 12,  172, 153 },
-	{ 38416, 29458, 14361,  175, 153, 12,  172, 153 },
-	{ 38588, 25885, 13957,  176, 119, 9,  173, 181 },
-	{ 45062, 25885, 18290,  217, 119, 37,  224, 181 },
-	{ 46419, 37176, 26030,  235, 178, 82,  234, 93 },
-	{ 44692, 41178, 26765,  229, 190, 85,  221, 62 },
-	{ 41442, 41178, 21909,  205, 190, 49,  195, 62 },
-	{ 41442, 41178, 21909,  205, 190, 49,  195, 62 },
-	{ 42771, 37176, 20580,  209, 179, 45,  206, 93 },
-	{ 46419, 37176, 26030,  235, 178, 82,  234, 93 },
-	{ 47925, 33245, 25389,  238, 170, 81,  246, 124 },
-	{ 46419, 37176, 26030,  235, 178, 82,  234, 93 },
-	{ 42771, 37176, 20580,  209, 179, 45,  206, 93 },
-	{ 42771, 37176, 20580,  209, 179, 45,  206, 93 },
-	{ 43931, 33245, 19421,  212, 170, 42,  215, 124 },
-	{ 47925, 33245, 25389,  238, 170, 81,  246, 124 },
-	{ 48990, 29458, 24936,  242, 153, 79,  254, 153 },
-	{ 47925, 33245, 25389,  238, 170, 81,  246, 124 },
-	{ 43931, 33245, 19421,  212, 170, 42,  215, 124 },
-	{ 43931, 33245, 19421,  212, 170, 42,  215, 124 },
-	{ 44751, 29458, 18601,  215, 153, 39,  221, 153 },
-	{ 48990, 29458, 24936,  242, 153, 79,  254, 153 },
-	{ 49394, 25885, 24764,  245, 119, 78,  1, 181 },
-	{ 48990, 29458, 24936,  242, 153, 79,  254, 153 },
-	{ 44751, 29458, 18601,  215, 153, 39,  221, 153 },
-	{ 44751, 29458, 18601,  215, 153, 39,  221, 153 },
-	{ 45062, 25885, 18290,  217, 119, 37,  224, 181 },
-	{ 49394, 25885, 24764,  245, 119, 78,  1, 181 },
-	{ 47749, 37176, 32767,  244, 178, 127,  245, 93 },
-	{ 45877, 41178, 32767,  238, 190, 127,  230, 62 },
-	{ 44692, 41178, 26765,  229, 190, 85,  221, 62 },
-	{ 44692, 41178, 26765,  229, 190, 85,  221, 62 },
-	{ 46419, 37176, 26030,  235, 178, 82,  234, 93 },
-	{ 47749, 37176, 32767,  244, 178, 127,  245, 93 },
-	{ 49382, 33245, 32767,  247, 170, 127,  1, 124 },
-	{ 47749, 37176, 32767,  244, 178, 127,  245, 93 },
-	{ 46419, 37176, 26030,  235, 178, 82,  234, 93 },
-	{ 46419, 37176, 26030,  235, 178, 82,  234, 93 },
-	{ 47925, 33245, 25389,  238, 170, 81,  246, 124 },
-	{ 49382, 33245, 32767,  247, 170, 127,  1, 124 },
-	{ 50537, 29458, 32767,  252, 153, 127,  10, 153 },
-	{ 49382, 33245, 32767,  247, 170, 127,  1, 124 },
-	{ 47925, 33245, 25389,  238, 170, 81,  246, 124 },
-	{ 47925, 33245, 25389,  238, 170, 81,  246, 124 },
-	{ 48990, 29458, 24936,  242, 153, 79,  254, 153 },
-	{ 50537, 29458, 32767,  252, 153, 127,  10, 153 },
-	{ 50975, 25885, 32767,  254, 119, 127,  14, 181 },
-	{ 50537, 29458, 32767,  252, 153, 127,  10, 153 },
-	{ 48990, 29458, 24936,  242, 153, 79,  254, 153 },
-	{ 48990, 29458, 24936,  242, 153, 79,  254, 153 },
-	{ 49394, 25885, 24764,  245, 119, 78,  1, 181 },
-	{ 50975, 25885, 32767,  254, 119, 127,  14, 181 },
-	{ 48660, 22863, 40457,  233, 71, 171,  252, 205 },
-	{ 49394, 25885, 40770,  245, 119, 176,  1, 181 },
-	{ 50975, 25885, 32767,  254, 119, 127,  14, 181 },
-	{ 50975, 25885, 32767,  254, 119, 127,  14, 181 },
-	{ 50178, 22863, 32767,  242, 71, 127,  8, 205 },
-	{ 48660, 22863, 40457,  233, 71, 171,  252, 205 },
-	{ 47043, 20629, 39770,  213, 40, 163,  239, 222 },
-	{ 48660, 22863, 40457,  233, 71, 171,  252, 205 },
-	{ 50178, 22863, 32767,  242, 71, 127,  8, 205 },
-	{ 50178, 22863, 32767,  242, 71, 127,  8, 205 },
-	{ 48426, 20629, 32767,  220, 40, 127,  250, 222 },
-	{ 47043, 20629, 39770,  213, 40, 163,  239, 222 },
-	{ 45427, 19111, 39082,  209, 35, 161,  226, 234 },
-	{ 47043, 20629, 39770,  213, 40, 163,  239, 222 },
-	{ 48426, 20629, 32767,  220, 40, 127,  250, 222 },
-	{ 48426, 20629, 32767,  220, 40, 127,  250, 222 },
-	{ 46674, 19111, 32767,  215, 35, 127,  236, 234 },
-	{ 45427, 19111, 39082,  209, 35, 161,  226, 234 },
-	{ 44692, 18239, 38769,  220, 49, 166,  221, 241 },
-	{ 45427, 19111, 39082,  209, 35, 161,  226, 234 },
-	{ 46674, 19111, 32767,  215, 35, 127,  236, 234 },
-	{ 46674, 19111, 32767,  215, 35, 127,  236, 234 },
-	{ 45877, 18239, 32767,  228, 49, 127,  230, 241 },
-	{ 44692, 18239, 38769,  220, 49, 166,  221, 241 },
-	{ 44496, 22863, 46678,  208, 71, 208,  219, 205 },
-	{ 45062, 25885, 47244,  217, 119, 217,  224, 181 },
-	{ 49394, 25885, 40770,  245, 119, 176,  1, 181 },
-	{ 49394, 25885, 40770,  245, 119, 176,  1, 181 },
-	{ 48660, 22863, 40457,  233, 71, 171,  252, 205 },
-	{ 44496, 22863, 46678,  208, 71, 208,  219, 205 },
-	{ 43252, 20629, 45434,  193, 40, 193,  209, 222 },
-	{ 44496, 22863, 46678,  208, 71, 208,  219, 205 },
-	{ 48660, 22863, 40457,  233, 71, 171,  252, 205 },
-	{ 48660, 22863, 40457,  233, 71, 171,  252, 205 },
-	{ 47043, 20629, 39770,  213, 40, 163,  239, 222 },
-	{ 43252, 20629, 45434,  193, 40, 193,  209, 222 },
-	{ 42008, 19111, 44190,  189, 35, 189,  200, 234 },
-	{ 43252, 20629, 45434,  193, 40, 193,  209, 222 },
-	{ 47043, 20629, 39770,  213, 40, 163,  239, 222 },
-	{ 47043, 20629, 39770,  213, 40, 163,  239, 222 },
-	{ 45427, 19111, 39082,  209, 35, 161,  226, 234 },
-	{ 42008, 19111, 44190,  189, 35, 189,  200, 234 },
-	{ 41442, 18239, 43625,  198, 49, 198,  195, 241 },
-	{ 42008, 19111, 44190,  189, 35, 189,  200, 234 },
-	{ 45427, 19111, 39082,  209, 35, 161,  226, 234 },
-	{ 45427, 19111, 39082,  209, 35, 161,  226, 234 },
-	{ 44692, 18239, 38769,  220, 49, 166,  221, 241 },
-	{ 41442, 18239, 43625,  198, 49, 198,  195, 241 },
-	{ 38275, 22863, 50842,  171, 71, 233,  171, 205 },
-	{ 38588, 25885, 51577,  176, 119, 245,  173, 181 },
-	{ 45062, 25885, 47244,  217, 119, 217,  224, 181 },
-	{ 45062, 25885, 47244,  217, 119, 217,  224, 181 },
-	{ 44496, 22863, 46678,  208, 71, 208,  219, 205 },
-	{ 38275, 22863, 50842,  171, 71, 233,  171, 205 },
-	{ 37587, 20629, 49226,  163, 40, 213,  165, 222 },
-	{ 38275, 22863, 50842,  171, 71, 233,  171, 205 },
-	{ 44496, 22863, 46678,  208, 71, 208,  219, 205 },
-	{ 44496, 22863, 46678,  208, 71, 208,  219, 205 },
-	{ 43252, 20629, 45434,  193, 40, 193,  209, 222 },
-	{ 37587, 20629, 49226,  163, 40, 213,  165, 222 },
-	{ 36900, 19111, 47609,  161, 35, 209,  160, 234 },
-	{ 37587, 20629, 49226,  163, 40, 213,  165, 222 },
-	{ 43252, 20629, 45434,  193, 40, 193,  209, 222 },
-	{ 43252, 20629, 45434,  193, 40, 193,  209, 222 },
-	{ 42008, 19111, 44190,  189, 35, 189,  200, 234 },
-	{ 36900, 19111, 47609,  161, 35, 209,  160, 234 },
-	{ 36587, 18239, 46874,  166, 49, 220,  157, 241 },
-	{ 36900, 19111, 47609,  161, 35, 209,  160, 234 },
-	{ 42008, 19111, 44190,  189, 35, 189,  200, 234 },
-	{ 42008, 19111, 44190,  189, 35, 189,  200, 234 },
-	{ 41442, 18239, 43625,  198, 49, 198,  195, 241 },
-	{ 36587, 18239, 46874,  166, 49, 220,  157, 241 },
-	{ 30585, 22863, 52361,  127, 71, 242,  110, 205 },
-	{ 30585, 25885, 53157,  127, 119, 254,  110, 181 },
-	{ 38588, 25885, 51577,  176, 119, 245,  173, 181 },
-	{ 38588, 25885, 51577,  176, 119, 245,  173, 181 },
-	{ 38275, 22863, 50842,  171, 71, 233,  171, 205 },
-	{ 30585, 22863, 52361,  127, 71, 242,  110, 205 },
-	{ 30585, 20629, 50608,  127, 40, 220,  110, 222 },
-	{ 30585, 22863, 52361,  127, 71, 242,  110, 205 },
-	{ 38275, 22863, 50842,  171, 71, 233,  171, 205 },
-	{ 38275, 22863, 50842,  171, 71, 233,  171, 205 },
-	{ 37587, 20629, 49226,  163, 40, 213,  165, 222 },
-	{ 30585, 20629, 50608,  127, 40, 220,  110, 222 },
-	{ 30585, 19111, 48856,  127, 35, 215,  110, 234 },
-	{ 30585, 20629, 50608,  127, 40, 220,  110, 222 },
-	{ 37587, 20629, 49226,  163, 40, 213,  165, 222 },
-	{ 37587, 20629, 49226,  163, 40, 213,  165, 222 },
-	{ 36900, 19111, 47609,  161, 35, 209,  160, 234 },
-	{ 30585, 19111, 48856,  127, 35, 215,  110, 234 },
-	{ 30585, 18239, 48060,  127, 49, 228,  110, 241 },
-	{ 30585, 19111, 48856,  127, 35, 215,  110, 234 },
-	{ 36900, 19111, 47609,  161, 35, 209,  160, 234 },
-	{ 36900, 19111, 47609,  161, 35, 209,  160, 234 },
-	{ 36587, 18239, 46874,  166, 49, 220,  157, 241 },
-	{ 30585, 18239, 48060,  127, 49, 228,  110, 241 },
-	{ 22894, 22863, 50842,  83, 71, 233,  50, 205 },
-	{ 22582, 25885, 51577,  78, 119, 245,  48, 181 },
-	{ 30585, 25885, 53157,  127, 119, 254,  110, 181 },
-	{ 30585, 25885, 53157,  127, 119, 254,  110, 181 },
-	{ 30585, 22863, 52361,  127, 71, 242,  110, 205 },
-	{ 22894, 22863, 50842,  83, 71, 233,  50, 205 },
-	{ 23582, 20629, 49226,  91, 40, 213,  56, 222 },
-	{ 22894, 22863, 50842,  83, 71, 233,  50, 205 },
-	{ 30585, 22863, 52361,  127, 71, 242,  110, 205 },
-	{ 30585, 22863, 52361,  127, 71, 242,  110, 205 },
-	{ 30585, 20629, 50608,  127, 40, 220,  110, 222 },
-	{ 23582, 20629, 49226,  91, 40, 213,  56, 222 },
-	{ 24270, 19111, 47609,  93, 35, 209,  61, 234 },
-	{ 23582, 20629, 49226,  91, 40, 213,  56, 222 },
-	{ 30585, 20629, 50608,  127, 40, 220,  110, 222 },
-	{ 30585, 20629, 50608,  127, 40, 220,  110, 222 },
-	{ 30585, 19111, 48856,  127, 35, 215,  110, 234 },
-	{ 24270, 19111, 47609,  93, 35, 209,  61, 234 },
-	{ 24582, 18239, 46874,  88, 49, 220,  64, 241 },
-	{ 24270, 19111, 47609,  93, 35, 209,  61, 234 },
-	{ 30585, 19111, 48856,  127, 35, 215,  110, 234 },
-	{ 30585, 19111, 48856,  127, 35, 215,  110, 234 },
-	{ 30585, 18239, 48060,  127, 49, 228,  110, 241 },
-	{ 24582, 18239, 46874,  88, 49, 220,  64, 241 },
-	{ 16673, 22863, 46678,  46, 71, 208,  2, 205 },
-	{ 16108, 25885, 47244,  37, 119, 217,  254, 181 },
-	{ 22582, 25885, 51577,  78, 119, 245,  48, 181 },
-	{ 22582, 25885, 51577,  78, 119, 245,  48, 181 },
-	{ 22894, 22863, 50842,  83, 71, 233,  50, 205 },
-	{ 16673, 22863, 46678,  46, 71, 208,  2, 205 },
-	{ 17917, 20629, 45434,  61, 40, 193,  11, 222 },
-	{ 16673, 22863, 46678,  46, 71, 208,  2, 205 },
-	{ 22894, 22863, 50842,  83, 71, 233,  50, 205 },
-	{ 22894, 22863, 50842,  83, 71, 233,  50, 205 },
-	{ 23582, 20629, 49226,  91, 40, 213,  56, 222 },
-	{ 17917, 20629, 45434,  61, 40, 193,  11, 222 },
-	{ 19161, 19111, 44190,  65, 35, 189,  21, 234 },
-	{ 17917, 20629, 45434,  61, 40, 193,  11, 222 },
-	{ 23582, 20629, 49226,  91, 40, 213,  56, 222 },
-	{ 23582, 20629, 49226,  91, 40, 213,  56, 222 },
-	{ 24270, 19111, 47609,  93, 35, 209,  61, 234 },
-	{ 19161, 19111, 44190,  65, 35, 189,  21, 234 },
-	{ 19727, 18239, 43625,  56, 49, 198,  26, 241 },
-	{ 19161, 19111, 44190,  65, 35, 189,  21, 234 },
-	{ 24270, 19111, 47609,  93, 35, 209,  61, 234 },
-	{ 24270, 19111, 47609,  93, 35, 209,  61, 234 },
-	{ 24582, 18239, 46874,  88, 49, 220,  64, 241 },
-	{ 19727, 18239, 43625,  56, 49, 198,  26, 241 },
-	{ 12510, 22863, 40457,  21, 71, 171,  226, 205 },
-	{ 11775, 25885, 40770,  9, 119, 176,  220, 181 },
-	{ 16108, 25885, 47244,  37, 119, 217,  254, 181 },
-	{ 16108, 25885, 47244,  37, 119, 217,  254, 181 },
-	{ 16673, 22863, 46678,  46, 71, 208,  2, 205 },
-	{ 12510, 22863, 40457,  21, 71, 171,  226, 205 },
-	{ 14126, 20629, 39770,  41, 40, 163,  239, 222 },
-	{ 12510, 22863, 40457,  21, 71, 171,  226, 205 },
-	{ 16673, 22863, 46678,  46, 71, 208,  2, 205 },
-	{ 16673, 22863, 46678,  46, 71, 208,  2, 205 },
-	{ 17917, 20629, 45434,  61, 40, 193,  11, 222 },
-	{ 14126, 20629, 39770,  41, 40, 163,  239, 222 },
-	{ 15742, 19111, 39082,  45, 35, 161,  251, 234 },
-	{ 14126, 20629, 39770,  41, 40, 163,  239, 222 },
-	{ 17917, 20629, 45434,  61, 40, 193,  11, 222 },
-	{ 17917, 20629, 45434,  61, 40, 193,  11, 222 },
-	{ 19161, 19111, 44190,  65, 35, 189,  21, 234 },
-	{ 15742, 19111, 39082,  45, 35, 161,  251, 234 },
-	{ 16477, 18239, 38769,  34, 49, 166,  0, 241 },
-	{ 15742, 19111, 39082,  45, 35, 161,  251, 234 },
-	{ 19161, 19111, 44190,  65, 35, 189,  21, 234 },
-	{ 19161, 19111, 44190,  65, 35, 189,  21, 234 },
-	{ 19727, 18239, 43625,  56, 49, 198,  26, 241 },
-	{ 16477, 18239, 38769,  34, 49, 166,  0, 241 },
-	{ 10991, 22863, 32767,  12, 71, 127,  214, 205 },
-	{ 10195, 25885, 32767,  0, 119, 127,  208, 181 },
-	{ 11775, 25885, 40770,  9, 119, 176,  220, 181 },
-	{ 11775, 25885, 40770,  9, 119, 176,  220, 181 },
-	{ 12510, 22863, 40457,  21, 71, 171,  226, 205 },
-	{ 10991, 22863, 32767,  12, 71, 127,  214, 205 },
-	{ 12743, 20629, 32767,  34, 40, 127,  228, 222 },
-	{ 10991, 22863, 32767,  12, 71, 127,  214, 205 },
-	{ 12510, 22863, 40457,  21, 71, 171,  226, 205 },
-	{ 12510, 22863, 40457,  21, 71, 171,  226, 205 },
-	{ 14126, 20629, 39770,  41, 40, 163,  239, 222 },
-	{ 12743, 20629, 32767,  34, 40, 127,  228, 222 },
-	{ 14496, 19111, 32767,  39, 35, 127,  242, 234 },
-	{ 12743, 20629, 32767,  34, 40, 127,  228, 222 },
-	{ 14126, 20629, 39770,  41, 40, 163,  239, 222 },
-	{ 14126, 20629, 39770,  41, 40, 163,  239, 222 },
-	{ 15742, 19111, 39082,  45, 35, 161,  251, 234 },
-	{ 14496, 19111, 32767,  39, 35, 127,  242, 234 },
-	{ 15292, 18239, 32767,  26, 49, 127,  248, 241 },
-	{ 14496, 19111, 32767,  39, 35, 127,  242, 234 },
-	{ 15742, 19111, 39082,  45, 35, 161,  251, 234 },
-	{ 15742, 19111, 39082,  45, 35, 161,  251, 234 },
-	{ 16477, 18239, 38769,  34, 49, 166,  0, 241 },
-	{ 15292, 18239, 32767,  26, 49, 127,  248, 241 },
-	{ 12510, 22863, 25077,  21, 71, 83,  226, 205 },
-	{ 11775, 25885, 24764,  9, 119, 78,  220, 181 },
-	{ 10195, 25885, 32767,  0, 119, 127,  208, 181 },
-	{ 10195, 25885, 32767,  0, 119, 127,  208, 181 },
-	{ 10991, 22863, 32767,  12, 71, 127,  214, 205 },
-	{ 12510, 22863, 25077,  21, 71, 83,  226, 205 },
-	{ 14126, 20629, 25764,  41, 40, 91,  239, 222 },
-	{ 12510, 22863, 25077,  21, 71, 83,  226, 205 },
-	{ 10991, 22863, 32767,  12, 71, 127,  214, 205 },
-	{ 10991, 22863, 32767,  12, 71, 127,  214, 205 },
-	{ 12743, 20629, 32767,  34, 40, 127,  228, 222 },
-	{ 14126, 20629, 25764,  41, 40, 91,  239, 222 },
-	{ 15742, 19111, 26452,  45, 35, 93,  251, 234 },
-	{ 14126, 20629, 25764,  41, 40, 91,  239, 222 },
-	{ 12743, 20629, 32767,  34, 40, 127,  228, 222 },
-	{ 12743, 20629, 32767,  34, 40, 127,  228, 222 },
-	{ 14496, 19111, 32767,  39, 35, 127,  242, 234 },
-	{ 15742, 19111, 26452,  45, 35, 93,  251, 234 },
-	{ 16477, 18239, 26765,  34, 49, 88,  0, 241 },
-	{ 15742, 19111, 26452,  45, 35, 93,  251, 234 },
-	{ 14496, 19111, 32767,  39, 35, 127,  242, 234 },
-	{ 14496, 19111, 32767,  39, 35, 127,  242, 234 },
-	{ 15292, 18239, 32767,  26, 49, 127,  248, 241 },
-	{ 16477, 18239, 26765,  34, 49, 88,  0, 241 },
-	{ 16673, 22863, 18856,  46, 71, 46,  2, 205 },
-	{ 16108, 25885, 18290,  37, 119, 37,  254, 181 },
-	{ 11775, 25885, 24764,  9, 119, 78,  220, 181 },
-	{ 11775, 25885, 24764,  9, 119, 78,  220, 181 },
-	{ 12510, 22863, 25077,  21, 71, 83,  226, 205 },
-	{ 16673, 22863, 18856,  46, 71, 46,  2, 205 },
-	{ 17917, 20629, 20100,  61, 40, 61,  11, 222 },
-	{ 16673, 22863, 18856,  46, 71, 46,  2, 205 },
-	{ 12510, 22863, 25077,  21, 71, 83,  226, 205 },
-	{ 12510, 22863, 25077,  21, 71, 83,  226, 205 },
-	{ 14126, 20629, 25764,  41, 40, 91,  239, 222 },
-	{ 17917, 20629, 20100,  61, 40, 61,  11, 222 },
-	{ 19161, 19111, 21344,  65, 35, 65,  21, 234 },
-	{ 17917, 20629, 20100,  61, 40, 61,  11, 222 },
-	{ 14126, 20629, 25764,  41, 40, 91,  239, 222 },
-	{ 14126, 20629, 25764,  41, 40, 91,  239, 222 },
-	{ 15742, 19111, 26452,  45, 35, 93,  251, 234 },
-	{ 19161, 19111, 21344,  65, 35, 65,  21, 234 },
-	{ 19727, 18239, 21909,  56, 49, 56,  26, 241 },
-	{ 19161, 19111, 21344,  65, 35, 65,  21, 234 },
-	{ 15742, 19111, 26452,  45, 35, 93,  251, 234 },
-	{ 15742, 19111, 26452,  45, 35, 93,  251, 234 },
-	{ 16477, 18239, 26765,  34, 49, 88,  0, 241 },
-	{ 19727, 18239, 21909,  56, 49, 56,  26, 241 },
-	{ 22894, 22863, 14692,  83, 71, 21,  50, 205 },
-	{ 22582, 25885, 13957,  78, 119, 9,  48, 181 },
-	{ 16108, 25885, 18290,  37, 119, 37,  254, 181 },
-	{ 16108, 25885, 18290,  37, 119, 37,  254, 181 },
-	{ 16673, 22863, 18856,  46, 71, 46,  2, 205 },
-	{ 22894, 22863, 14692,  83, 71, 21,  50, 205 },
-	{ 23582, 20629, 16308,  91, 40, 41,  56, 222 },
-	{ 22894, 22863, 14692,  83, 71, 21,  50, 205 },
-	{ 16673, 22863, 18856,  46, 71, 46,  2, 205 },
-	{ 16673, 22863, 18856,  46, 71, 46,  2, 205 },
-	{ 17917, 20629, 20100,  61, 40, 61,  11, 222 },
-	{ 23582, 20629, 16308,  91, 40, 41,  56, 222 },
-	{ 24270, 19111, 17925,  93, 35, 45,  61, 234 },
-	{ 23582, 20629, 16308,  91, 40, 41,  56, 222 },
-	{ 17917, 20629, 20100,  61, 40, 61,  11, 222 },
-	{ 17917, 20629, 20100,  61, 40, 61,  11, 222 },
-	{ 19161, 19111, 21344,  65, 35, 65,  21, 234 },
-	{ 24270, 19111, 17925,  93, 35, 45,  61, 234 },
-	{ 24582, 18239, 18660,  88, 49, 34,  64, 241 },
-	{ 24270, 19111, 17925,  93, 35, 45,  61, 234 },
-	{ 19161, 19111, 21344,  65, 35, 65,  21, 234 },
-	{ 19161, 19111, 21344,  65, 35, 65,  21, 234 },
-	{ 19727, 18239, 21909,  56, 49, 56,  26, 241 },
-	{ 24582, 18239, 18660,  88, 49, 34,  64, 241 },
-	{ 30585, 22863, 13173,  127, 71, 12,  110, 205 },
-	{ 30585, 25885, 12377,  127, 119, 0,  110, 181 },
-	{ 22582, 25885, 13957,  78, 119, 9,  48, 181 },
-	{ 22582, 25885, 13957,  78, 119, 9,  48, 181 },
-	{ 22894, 22863, 14692,  83, 71, 21,  50, 205 },
-	{ 30585, 22863, 13173,  127, 71, 12,  110, 205 },
-	{ 30585, 20629, 14926,  127, 40, 34,  110, 222 },
-	{ 30585, 22863, 13173,  127, 71, 12,  110, 205 },
-	{ 22894, 22863, 14692,  83, 71, 21,  50, 205 },
-	{ 22894, 22863, 14692,  83, 71, 21,  50, 205 },
-	{ 23582, 20629, 16308,  91, 40, 41,  56, 222 },
-	{ 30585, 20629, 14926,  127, 40, 34,  110, 222 },
-	{ 30585, 19111, 16678,  127, 35, 39,  110, 234 },
-	{ 30585, 20629, 14926,  127, 40, 34,  110, 222 },
-	{ 23582, 20629, 16308,  91, 40, 41,  56, 222 },
-	{ 23582, 20629, 16308,  91, 40, 41,  56, 222 },
-	{ 24270, 19111, 17925,  93, 35, 45,  61, 234 },
-	{ 30585, 19111, 16678,  127, 35, 39,  110, 234 },
-	{ 30585, 18239, 17474,  127, 49, 26,  110, 241 },
-	{ 30585, 19111, 16678,  127, 35, 39,  110, 234 },
-	{ 24270, 19111, 17925,  93, 35, 45,  61, 234 },
-	{ 24270, 19111, 17925,  93, 35, 45,  61, 234 },
-	{ 24582, 18239, 18660,  88, 49, 34,  64, 241 },
-	{ 30585, 18239, 17474,  127, 49, 26,  110, 241 },
-	{ 38275, 22863, 14692,  171, 71, 21,  171, 205 },
-	{ 38588, 25885, 13957,  176, 119, 9,  173, 181 },
-	{ 30585, 25885, 12377,  127, 119, 0,  110, 181 },
-	{ 30585, 25885, 12377,  127, 119, 0,  110, 181 },
-	{ 30585, 22863, 13173,  127, 71, 12,  110, 205 },
-	{ 38275, 22863, 14692,  171, 71, 21,  171, 205 },
-	{ 37587, 20629, 16308,  163, 40, 41,  165, 222 },
-	{ 38275, 22863, 14692,  171, 71, 21,  171, 205 },
-	{ 30585, 22863, 13173,  127, 71, 12,  110, 205 },
-	{ 30585, 22863, 13173,  127, 71, 12,  110, 205 },
-	{ 30585, 20629, 14926,  127, 40, 34,  110, 222 },
-	{ 37587, 20629, 16308,  163, 40, 41,  165, 222 },
-	{ 36900, 19111, 17925,  161, 35, 45,  160, 234 },
-	{ 37587, 20629, 16308,  163, 40, 41,  165, 222 },
-	{ 30585, 20629, 14926,  127, 40, 34,  110, 222 },
-	{ 30585, 20629, 14926,  127, 40, 34,  110, 222 },
-	{ 30585, 19111, 16678,  127, 35, 39,  110, 234 },
-	{ 36900, 19111, 17925,  161, 35, 45,  160, 234 },
-	{ 36587, 18239, 18660,  166, 49, 34,  157, 241 },
-	{ 36900, 19111, 17925,  161, 35, 45,  160, 234 },
-	{ 30585, 19111, 16678,  127, 35, 39,  110, 234 },
-	{ 30585, 19111, 16678,  127, 35, 39,  110, 234 },
-	{ 30585, 18239, 17474,  127, 49, 26,  110, 241 },
-	{ 36587, 18239, 18660,  166, 49, 34,  157, 241 },
-	{ 44496, 22863, 18856,  208, 71, 46,  219, 205 },
-	{ 45062, 25885, 18290,  217, 119, 37,  224, 181 },
-	{ 38588, 25885, 13957,  176, 119, 9,  173, 181 },
-	{ 38588, 25885, 13957,  176, 119, 9,  173, 181 },
-	{ 38275, 22863, 14692,  171, 71, 21,  171, 205 },
-	{ 44496, 22863, 18856,  208, 71, 46,  219, 205 },
-	{ 43252, 20629, 20100,  193, 40, 61,  209, 222 },
-	{ 44496, 22863, 18856,  208, 71, 46,  219, 205 },
-	{ 38275, 22863, 14692,  171, 71, 21,  171, 205 },
-	{ 38275, 22863, 14692,  171, 71, 21,  171, 205 },
-	{ 37587, 20629, 16308,  163, 40, 41,  165, 222 },
-	{ 43252, 20629, 20100,  193, 40, 61,  209, 222 },
-	{ 42008, 19111, 21344,  189, 35, 65,  200, 234 },
-	{ 43252, 20629, 20100,  193, 40, 61,  209, 222 },
-	{ 37587, 20629, 16308,  163, 40, 41,  165, 222 },
-	{ 37587, 20629, 16308,  163, 40, 41,  165, 222 },
-	{ 36900, 19111, 17925,  161, 35, 45,  160, 234 },
-	{ 42008, 19111, 21344,  189, 35, 65,  200, 234 },
-	{ 41442, 18239, 21909,  198, 49, 56,  195, 241 },
-	{ 42008, 19111, 21344,  189, 35, 65,  200, 234 },
-	{ 36900, 19111, 17925,  161, 35, 45,  160, 234 },
-	{ 36900, 19111, 17925,  161, 35, 45,  160, 234 },
-	{ 36587, 18239, 18660,  166, 49, 34,  157, 241 },
-	{ 41442, 18239, 21909,  198, 49, 56,  195, 241 },
-	{ 48660, 22863, 25077,  233, 71, 83,  252, 205 },
-	{ 49394, 25885, 24764,  245, 119, 78,  1, 181 },
-	{ 45062, 25885, 18290,  217, 119, 37,  224, 181 },
-	{ 45062, 25885, 18290,  217, 119, 37,  224, 181 },
-	{ 44496, 22863, 18856,  208, 71, 46,  219, 205 },
-	{ 48660, 22863, 25077,  233, 71, 83,  252, 205 },
-	{ 47043, 20629, 25764,  213, 40, 91,  239, 222 },
-	{ 48660, 22863, 25077,  233, 71, 83,  252, 205 },
-	{ 44496, 22863, 18856,  208, 71, 46,  219, 205 },
-	{ 44496, 22863, 18856,  208, 71, 46,  219, 205 },
-	{ 43252, 20629, 20100,  193, 40, 61,  209, 222 },
-	{ 47043, 20629, 25764,  213, 40, 91,  239, 222 },
-	{ 45427, 19111, 26452,  209, 35, 93,  226, 234 },
-	{ 47043, 20629, 25764,  213, 40, 91,  239, 222 },
-	{ 43252, 20629, 20100,  193, 40, 61,  209, 222 },
-	{ 43252, 20629, 20100,  193, 40, 61,  209, 222 },
-	{ 42008, 19111, 21344,  189, 35, 65,  200, 234 },
-	{ 45427, 19111, 26452,  209, 35, 93,  226, 234 },
-	{ 44692, 18239, 26765,  220, 49, 88,  221, 241 },
-	{ 45427, 19111, 26452,  209, 35, 93,  226, 234 },
-	{ 42008, 19111, 21344,  189, 35, 65,  200, 234 },
-	{ 42008, 19111, 21344,  189, 35, 65,  200, 234 },
-	{ 41442, 18239, 21909,  198, 49, 56,  195, 241 },
-	{ 44692, 18239, 26765,  220, 49, 88,  221, 241 },
-	{ 50178, 22863, 32767,  242, 71, 127,  8, 205 },
-	{ 50975, 25885, 32767,  254, 119, 127,  14, 181 },
-	{ 49394, 25885, 24764,  245, 119, 78,  1, 181 },
-	{ 49394, 25885, 24764,  245, 119, 78,  1, 181 },
-	{ 48660, 22863, 25077,  233, 71, 83,  252, 205 },
-	{ 50178, 22863, 32767,  242, 71, 127,  8, 205 },
-	{ 48426, 20629, 32767,  220, 40, 127,  250, 222 },
-	{ 50178, 22863, 32767,  242, 71, 127,  8, 205 },
-	{ 48660, 22863, 25077,  233, 71, 83,  252, 205 },
-	{ 48660, 22863, 25077,  233, 71, 83,  252, 205 },
-	{ 47043, 20629, 25764,  213, 40, 91,  239, 222 },
-	{ 48426, 20629, 32767,  220, 40, 127,  250, 222 },
-	{ 46674, 19111, 32767,  215, 35, 127,  236, 234 },
-	{ 48426, 20629, 32767,  220, 40, 127,  250, 222 },
-	{ 47043, 20629, 25764,  213, 40, 91,  239, 222 },
-	{ 47043, 20629, 25764,  213, 40, 91,  239, 222 },
-	{ 45427, 19111, 26452,  209, 35, 93,  226, 234 },
-	{ 46674, 19111, 32767,  215, 35, 127,  236, 234 },
-	{ 45877, 18239, 32767,  228, 49, 127,  230, 241 },
-	{ 46674, 19111, 32767,  215, 35, 127,  236, 234 },
-	{ 45427, 19111, 26452,  209, 35, 93,  226, 234 },
-	{ 45427, 19111, 26452,  209, 35, 93,  226, 234 },
-	{ 44692, 18239, 26765,  220, 49, 88,  221, 241 },
-	{ 45877, 18239, 32767,  228, 49, 127,  230, 241 },
-	{ 44372, 17678, 38633,  200, 27, 157,  218, 245 },
-	{ 44692, 18239, 38769,  220, 49, 166,  221, 241 },
-	{ 45877, 18239, 32767,  228, 49, 127,  230, 241 },
-	{ 45877, 18239, 32767,  228, 49, 127,  230, 241 },
-	{ 45531, 17678, 32767,  207, 27, 127,  227, 245 },
-	{ 44372, 17678, 38633,  200, 27, 157,  218, 245 },
-	{ 42664, 17188, 37906,  148, 2, 136,  205, 249 },
-	{ 44372, 17678, 38633,  200, 27, 157,  218, 245 },
-	{ 45531, 17678, 32767,  207, 27, 127,  227, 245 },
-	{ 45531, 17678, 32767,  207, 27, 127,  227, 245 },
-	{ 43679, 17188, 32767,  150, 2, 127,  213, 249 },
-	{ 42664, 17188, 37906,  148, 2, 136,  205, 249 },
-	{ 38443, 16841, 36110,  133, 0, 129,  172, 252 },
-	{ 42664, 17188, 37906,  148, 2, 136,  205, 249 },
-	{ 43679, 17188, 32767,  150, 2, 127,  213, 249 },
-	{ 43679, 17188, 32767,  150, 2, 127,  213, 249 },
-	{ 39103, 16841, 32767,  133, 0, 127,  177, 252 },
-	{ 38443, 16841, 36110,  133, 0, 129,  172, 252 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 38443, 16841, 36110,  133, 0, 129,  172, 252 },
-	{ 39103, 16841, 32767,  133, 0, 127,  177, 252 },
-	{ 39103, 16841, 32767,  133, 0, 127,  177, 252 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 41196, 17678, 43379,  183, 27, 183,  193, 245 },
-	{ 41442, 18239, 43625,  198, 49, 198,  195, 241 },
-	{ 44692, 18239, 38769,  220, 49, 166,  221, 241 },
-	{ 44692, 18239, 38769,  220, 49, 166,  221, 241 },
-	{ 44372, 17678, 38633,  200, 27, 157,  218, 245 },
-	{ 41196, 17678, 43379,  183, 27, 183,  193, 245 },
-	{ 39882, 17188, 42064,  143, 2, 143,  183, 249 },
-	{ 41196, 17678, 43379,  183, 27, 183,  193, 245 },
-	{ 44372, 17678, 38633,  200, 27, 157,  218, 245 },
-	{ 44372, 17678, 38633,  200, 27, 157,  218, 245 },
-	{ 42664, 17188, 37906,  148, 2, 136,  205, 249 },
-	{ 39882, 17188, 42064,  143, 2, 143,  183, 249 },
-	{ 36633, 16841, 38815,  131, 0, 131,  158, 252 },
-	{ 39882, 17188, 42064,  143, 2, 143,  183, 249 },
-	{ 42664, 17188, 37906,  148, 2, 136,  205, 249 },
-	{ 42664, 17188, 37906,  148, 2, 136,  205, 249 },
-	{ 38443, 16841, 36110,  133, 0, 129,  172, 252 },
-	{ 36633, 16841, 38815,  131, 0, 131,  158, 252 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 36633, 16841, 38815,  131, 0, 131,  158, 252 },
-	{ 38443, 16841, 36110,  133, 0, 129,  172, 252 },
-	{ 38443, 16841, 36110,  133, 0, 129,  172, 252 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 36451, 17678, 46555,  157, 27, 200,  156, 245 },
-	{ 36587, 18239, 46874,  166, 49, 220,  157, 241 },
-	{ 41442, 18239, 43625,  198, 49, 198,  195, 241 },
-	{ 41442, 18239, 43625,  198, 49, 198,  195, 241 },
-	{ 41196, 17678, 43379,  183, 27, 183,  193, 245 },
-	{ 36451, 17678, 46555,  157, 27, 200,  156, 245 },
-	{ 35724, 17188, 44846,  136, 2, 148,  151, 249 },
-	{ 36451, 17678, 46555,  157, 27, 200,  156, 245 },
-	{ 41196, 17678, 43379,  183, 27, 183,  193, 245 },
-	{ 41196, 17678, 43379,  183, 27, 183,  193, 245 },
-	{ 39882, 17188, 42064,  143, 2, 143,  183, 249 },
-	{ 35724, 17188, 44846,  136, 2, 148,  151, 249 },
-	{ 33928, 16841, 40625,  129, 0, 133,  137, 252 },
-	{ 35724, 17188, 44846,  136, 2, 148,  151, 249 },
-	{ 39882, 17188, 42064,  143, 2, 143,  183, 249 },
-	{ 39882, 17188, 42064,  143, 2, 143,  183, 249 },
-	{ 36633, 16841, 38815,  131, 0, 131,  158, 252 },
-	{ 33928, 16841, 40625,  129, 0, 133,  137, 252 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 33928, 16841, 40625,  129, 0, 133,  137, 252 },
-	{ 36633, 16841, 38815,  131, 0, 131,  158, 252 },
-	{ 36633, 16841, 38815,  131, 0, 131,  158, 252 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 30585, 17678, 47713,  127, 27, 207,  110, 245 },
-	{ 30585, 18239, 48060,  127, 49, 228,  110, 241 },
-	{ 36587, 18239, 46874,  166, 49, 220,  157, 241 },
-	{ 36587, 18239, 46874,  166, 49, 220,  157, 241 },
-	{ 36451, 17678, 46555,  157, 27, 200,  156, 245 },
-	{ 30585, 17678, 47713,  127, 27, 207,  110, 245 },
-	{ 30585, 17188, 45861,  127, 2, 150,  110, 249 },
-	{ 30585, 17678, 47713,  127, 27, 207,  110, 245 },
-	{ 36451, 17678, 46555,  157, 27, 200,  156, 245 },
-	{ 36451, 17678, 46555,  157, 27, 200,  156, 245 },
-	{ 35724, 17188, 44846,  136, 2, 148,  151, 249 },
-	{ 30585, 17188, 45861,  127, 2, 150,  110, 249 },
-	{ 30585, 16841, 41285,  127, 0, 133,  110, 252 },
-	{ 30585, 17188, 45861,  127, 2, 150,  110, 249 },
-	{ 35724, 17188, 44846,  136, 2, 148,  151, 249 },
-	{ 35724, 17188, 44846,  136, 2, 148,  151, 249 },
-	{ 33928, 16841, 40625,  129, 0, 133,  137, 252 },
-	{ 30585, 16841, 41285,  127, 0, 133,  110, 252 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 30585, 16841, 41285,  127, 0, 133,  110, 252 },
-	{ 33928, 16841, 40625,  129, 0, 133,  137, 252 },
-	{ 33928, 16841, 40625,  129, 0, 133,  137, 252 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 24718, 17678, 46555,  97, 27, 200,  65, 245 },
-	{ 24582, 18239, 46874,  88, 49, 220,  64, 241 },
-	{ 30585, 18239, 48060,  127, 49, 228,  110, 241 },
-	{ 30585, 18239, 48060,  127, 49, 228,  110, 241 },
-	{ 30585, 17678, 47713,  127, 27, 207,  110, 245 },
-	{ 24718, 17678, 46555,  97, 27, 200,  65, 245 },
-	{ 25445, 17188, 44846,  118, 2, 148,  70, 249 },
-	{ 24718, 17678, 46555,  97, 27, 200,  65, 245 },
-	{ 30585, 17678, 47713,  127, 27, 207,  110, 245 },
-	{ 30585, 17678, 47713,  127, 27, 207,  110, 245 },
-	{ 30585, 17188, 45861,  127, 2, 150,  110, 249 },
-	{ 25445, 17188, 44846,  118, 2, 148,  70, 249 },
-	{ 27241, 16841, 40625,  125, 0, 133,  84, 252 },
-	{ 25445, 17188, 44846,  118, 2, 148,  70, 249 },
-	{ 30585, 17188, 45861,  127, 2, 150,  110, 249 },
-	{ 30585, 17188, 45861,  127, 2, 150,  110, 249 },
-	{ 30585, 16841, 41285,  127, 0, 133,  110, 252 },
-	{ 27241, 16841, 40625,  125, 0, 133,  84, 252 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 27241, 16841, 40625,  125, 0, 133,  84, 252 },
-	{ 30585, 16841, 41285,  127, 0, 133,  110, 252 },
-	{ 30585, 16841, 41285,  127, 0, 133,  110, 252 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 19973, 17678, 43379,  71, 27, 183,  28, 245 },
-	{ 19727, 18239, 43625,  56, 49, 198,  26, 241 },
-	{ 24582, 18239, 46874,  88, 49, 220,  64, 241 },
-	{ 24582, 18239, 46874,  88, 49, 220,  64, 241 },
-	{ 24718, 17678, 46555,  97, 27, 200,  65, 245 },
-	{ 19973, 17678, 43379,  71, 27, 183,  28, 245 },
-	{ 21288, 17188, 42064,  111, 2, 143,  38, 249 },
-	{ 19973, 17678, 43379,  71, 27, 183,  28, 245 },
-	{ 24718, 17678, 46555,  97, 27, 200,  65, 245 },
-	{ 24718, 17678, 46555,  97, 27, 200,  65, 245 },
-	{ 25445, 17188, 44846,  118, 2, 148,  70, 249 },
-	{ 21288, 17188, 42064,  111, 2, 143,  38, 249 },
-	{ 24537, 16841, 38815,  123, 0, 131,  63, 252 },
-	{ 21288, 17188, 42064,  111, 2, 143,  38, 249 },
-	{ 25445, 17188, 44846,  118, 2, 148,  70, 249 },
-	{ 25445, 17188, 44846,  118, 2, 148,  70, 249 },
-	{ 27241, 16841, 40625,  125, 0, 133,  84, 252 },
-	{ 24537, 16841, 38815,  123, 0, 131,  63, 252 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 24537, 16841, 38815,  123, 0, 131,  63, 252 },
-	{ 27241, 16841, 40625,  125, 0, 133,  84, 252 },
-	{ 27241, 16841, 40625,  125, 0, 133,  84, 252 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 16797, 17678, 38633,  54, 27, 157,  3, 245 },
-	{ 16477, 18239, 38769,  34, 49, 166,  0, 241 },
-	{ 19727, 18239, 43625,  56, 49, 198,  26, 241 },
-	{ 19727, 18239, 43625,  56, 49, 198,  26, 241 },
-	{ 19973, 17678, 43379,  71, 27, 183,  28, 245 },
-	{ 16797, 17678, 38633,  54, 27, 157,  3, 245 },
-	{ 18505, 17188, 37906,  106, 2, 136,  16, 249 },
-	{ 16797, 17678, 38633,  54, 27, 157,  3, 245 },
-	{ 19973, 17678, 43379,  71, 27, 183,  28, 245 },
-	{ 19973, 17678, 43379,  71, 27, 183,  28, 245 },
-	{ 21288, 17188, 42064,  111, 2, 143,  38, 249 },
-	{ 18505, 17188, 37906,  106, 2, 136,  16, 249 },
-	{ 22726, 16841, 36110,  121, 0, 129,  49, 252 },
-	{ 18505, 17188, 37906,  106, 2, 136,  16, 249 },
-	{ 21288, 17188, 42064,  111, 2, 143,  38, 249 },
-	{ 21288, 17188, 42064,  111, 2, 143,  38, 249 },
-	{ 24537, 16841, 38815,  123, 0, 131,  63, 252 },
-	{ 22726, 16841, 36110,  121, 0, 129,  49, 252 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 22726, 16841, 36110,  121, 0, 129,  49, 252 },
-	{ 24537, 16841, 38815,  123, 0, 131,  63, 252 },
-	{ 24537, 16841, 38815,  123, 0, 131,  63, 252 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 15639, 17678, 32767,  47, 27, 127,  251, 245 },
-	{ 15292, 18239, 32767,  26, 49, 127,  248, 241 },
-	{ 16477, 18239, 38769,  34, 49, 166,  0, 241 },
-	{ 16477, 18239, 38769,  34, 49, 166,  0, 241 },
-	{ 16797, 17678, 38633,  54, 27, 157,  3, 245 },
-	{ 15639, 17678, 32767,  47, 27, 127,  251, 245 },
-	{ 17490, 17188, 32767,  104, 2, 127,  8, 249 },
-	{ 15639, 17678, 32767,  47, 27, 127,  251, 245 },
-	{ 16797, 17678, 38633,  54, 27, 157,  3, 245 },
-	{ 16797, 17678, 38633,  54, 27, 157,  3, 245 },
-	{ 18505, 17188, 37906,  106, 2, 136,  16, 249 },
-	{ 17490, 17188, 32767,  104, 2, 127,  8, 249 },
-	{ 22066, 16841, 32767,  121, 0, 127,  44, 252 },
-	{ 17490, 17188, 32767,  104, 2, 127,  8, 249 },
-	{ 18505, 17188, 37906,  106, 2, 136,  16, 249 },
-	{ 18505, 17188, 37906,  106, 2, 136,  16, 249 },
-	{ 22726, 16841, 36110,  121, 0, 129,  49, 252 },
-	{ 22066, 16841, 32767,  121, 0, 127,  44, 252 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 22066, 16841, 32767,  121, 0, 127,  44, 252 },
-	{ 22726, 16841, 36110,  121, 0, 129,  49, 252 },
-	{ 22726, 16841, 36110,  121, 0, 129,  49, 252 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 16797, 17678, 26901,  54, 27, 97,  3, 245 },
-	{ 16477, 18239, 26765,  34, 49, 88,  0, 241 },
-	{ 15292, 18239, 32767,  26, 49, 127,  248, 241 },
-	{ 15292, 18239, 32767,  26, 49, 127,  248, 241 },
-	{ 15639, 17678, 32767,  47, 27, 127,  251, 245 },
-	{ 16797, 17678, 26901,  54, 27, 97,  3, 245 },
-	{ 18505, 17188, 27628,  106, 2, 118,  16, 249 },
-	{ 16797, 17678, 26901,  54, 27, 97,  3, 245 },
-	{ 15639, 17678, 32767,  47, 27, 127,  251, 245 },
-	{ 15639, 17678, 32767,  47, 27, 127,  251, 245 },
-	{ 17490, 17188, 32767,  104, 2, 127,  8, 249 },
-	{ 18505, 17188, 27628,  106, 2, 118,  16, 249 },
-	{ 22726, 16841, 29424,  121, 0, 125,  49, 252 },
-	{ 18505, 17188, 27628,  106, 2, 118,  16, 249 },
-	{ 17490, 17188, 32767,  104, 2, 127,  8, 249 },
-	{ 17490, 17188, 32767,  104, 2, 127,  8, 249 },
-	{ 22066, 16841, 32767,  121, 0, 127,  44, 252 },
-	{ 22726, 16841, 29424,  121, 0, 125,  49, 252 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 22726, 16841, 29424,  121, 0, 125,  49, 252 },
-	{ 22066, 16841, 32767,  121, 0, 127,  44, 252 },
-	{ 22066, 16841, 32767,  121, 0, 127,  44, 252 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 19973, 17678, 22155,  71, 27, 71,  28, 245 },
-	{ 19727, 18239, 21909,  56, 49, 56,  26, 241 },
-	{ 16477, 18239, 26765,  34, 49, 88,  0, 241 },
-	{ 16477, 18239, 26765,  34, 49, 88,  0, 241 },
-	{ 16797, 17678, 26901,  54, 27, 97,  3, 245 },
-	{ 19973, 17678, 22155,  71, 27, 71,  28, 245 },
-	{ 21288, 17188, 23470,  111, 2, 111,  38, 249 },
-	{ 19973, 17678, 22155,  71, 27, 71,  28, 245 },
-	{ 16797, 17678, 26901,  54, 27, 97,  3, 245 },
-	{ 16797, 17678, 26901,  54, 27, 97,  3, 245 },
-	{ 18505, 17188, 27628,  106, 2, 118,  16, 249 },
-	{ 21288, 17188, 23470,  111, 2, 111,  38, 249 },
-	{ 24537, 16841, 26719,  123, 0, 123,  63, 252 },
-	{ 21288, 17188, 23470,  111, 2, 111,  38, 249 },
-	{ 18505, 17188, 27628,  106, 2, 118,  16, 249 },
-	{ 18505, 17188, 27628,  106, 2, 118,  16, 249 },
-	{ 22726, 16841, 29424,  121, 0, 125,  49, 252 },
-	{ 24537, 16841, 26719,  123, 0, 123,  63, 252 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 24537, 16841, 26719,  123, 0, 123,  63, 252 },
-	{ 22726, 16841, 29424,  121, 0, 125,  49, 252 },
-	{ 22726, 16841, 29424,  121, 0, 125,  49, 252 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 24718, 17678, 18979,  97, 27, 54,  65, 245 },
-	{ 24582, 18239, 18660,  88, 49, 34,  64, 241 },
-	{ 19727, 18239, 21909,  56, 49, 56,  26, 241 },
-	{ 19727, 18239, 21909,  56, 49, 56,  26, 241 },
-	{ 19973, 17678, 22155,  71, 27, 71,  28, 245 },
-	{ 24718, 17678, 18979,  97, 27, 54,  65, 245 },
-	{ 25445, 17188, 20688,  118, 2, 106,  70, 249 },
-	{ 24718, 17678, 18979,  97, 27, 54,  65, 245 },
-	{ 19973, 17678, 22155,  71, 27, 71,  28, 245 },
-	{ 19973, 17678, 22155,  71, 27, 71,  28, 245 },
-	{ 21288, 17188, 23470,  111, 2, 111,  38, 249 },
-	{ 25445, 17188, 20688,  118, 2, 106,  70, 249 },
-	{ 27241, 16841, 24909,  125, 0, 121,  84, 252 },
-	{ 25445, 17188, 20688,  118, 2, 106,  70, 249 },
-	{ 21288, 17188, 23470,  111, 2, 111,  38, 249 },
-	{ 21288, 17188, 23470,  111, 2, 111,  38, 249 },
-	{ 24537, 16841, 26719,  123, 0, 123,  63, 252 },
-	{ 27241, 16841, 24909,  125, 0, 121,  84, 252 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 27241, 16841, 24909,  125, 0, 121,  84, 252 },
-	{ 24537, 16841, 26719,  123, 0, 123,  63, 252 },
-	{ 24537, 16841, 26719,  123, 0, 123,  63, 252 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 30585, 17678, 17821,  127, 27, 47,  110, 245 },
-	{ 30585, 18239, 17474,  127, 49, 26,  110, 241 },
-	{ 24582, 18239, 18660,  88, 49, 34,  64, 241 },
-	{ 24582, 18239, 18660,  88, 49, 34,  64, 241 },
-	{ 24718, 17678, 18979,  97, 27, 54,  65, 245 },
-	{ 30585, 17678, 17821,  127, 27, 47,  110, 245 },
-	{ 30585, 17188, 19673,  127, 2, 104,  110, 249 },
-	{ 30585, 17678, 17821,  127, 27, 47,  110, 245 },
-	{ 24718, 17678, 18979,  97, 27, 54,  65, 245 },
-	{ 24718, 17678, 18979,  97, 27, 54,  65, 245 },
-	{ 25445, 17188, 20688,  118, 2, 106,  70, 249 },
-	{ 30585, 17188, 19673,  127, 2, 104,  110, 249 },
-	{ 30585, 16841, 24249,  127, 0, 121,  110, 252 },
-	{ 30585, 17188, 19673,  127, 2, 104,  110, 249 },
-	{ 25445, 17188, 20688,  118, 2, 106,  70, 249 },
-	{ 25445, 17188, 20688,  118, 2, 106,  70, 249 },
-	{ 27241, 16841, 24909,  125, 0, 121,  84, 252 },
-	{ 30585, 16841, 24249,  127, 0, 121,  110, 252 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 30585, 16841, 24249,  127, 0, 121,  110, 252 },
-	{ 27241, 16841, 24909,  125, 0, 121,  84, 252 },
-	{ 27241, 16841, 24909,  125, 0, 121,  84, 252 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 36451, 17678, 18979,  157, 27, 54,  156, 245 },
-	{ 36587, 18239, 18660,  166, 49, 34,  157, 241 },
-	{ 30585, 18239, 17474,  127, 49, 26,  110, 241 },
-	{ 30585, 18239, 17474,  127, 49, 26,  110, 241 },
-	{ 30585, 17678, 17821,  127, 27, 47,  110, 245 },
-	{ 36451, 17678, 18979,  157, 27, 54,  156, 245 },
-	{ 35724, 17188, 20688,  136, 2, 106,  151, 249 },
-	{ 36451, 17678, 18979,  157, 27, 54,  156, 245 },
-	{ 30585, 17678, 17821,  127, 27, 47,  110, 245 },
-	{ 30585, 17678, 17821,  127, 27, 47,  110, 245 },
-	{ 30585, 17188, 19673,  127, 2, 104,  110, 249 },
-	{ 35724, 17188, 20688,  136, 2, 106,  151, 249 },
-	{ 33928, 16841, 24909,  129, 0, 121,  137, 252 },
-	{ 35724, 17188, 20688,  136, 2, 106,  151, 249 },
-	{ 30585, 17188, 19673,  127, 2, 104,  110, 249 },
-	{ 30585, 17188, 19673,  127, 2, 104,  110, 249 },
-	{ 30585, 16841, 24249,  127, 0, 121,  110, 252 },
-	{ 33928, 16841, 24909,  129, 0, 121,  137, 252 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 33928, 16841, 24909,  129, 0, 121,  137, 252 },
-	{ 30585, 16841, 24249,  127, 0, 121,  110, 252 },
-	{ 30585, 16841, 24249,  127, 0, 121,  110, 252 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 41196, 17678, 22155,  183, 27, 71,  193, 245 },
-	{ 41442, 18239, 21909,  198, 49, 56,  195, 241 },
-	{ 36587, 18239, 18660,  166, 49, 34,  157, 241 },
-	{ 36587, 18239, 18660,  166, 49, 34,  157, 241 },
-	{ 36451, 17678, 18979,  157, 27, 54,  156, 245 },
-	{ 41196, 17678, 22155,  183, 27, 71,  193, 245 },
-	{ 39882, 17188, 23470,  143, 2, 111,  183, 249 },
-	{ 41196, 17678, 22155,  183, 27, 71,  193, 245 },
-	{ 36451, 17678, 18979,  157, 27, 54,  156, 245 },
-	{ 36451, 17678, 18979,  157, 27, 54,  156, 245 },
-	{ 35724, 17188, 20688,  136, 2, 106,  151, 249 },
-	{ 39882, 17188, 23470,  143, 2, 111,  183, 249 },
-	{ 36633, 16841, 26719,  131, 0, 123,  158, 252 },
-	{ 39882, 17188, 23470,  143, 2, 111,  183, 249 },
-	{ 35724, 17188, 20688,  136, 2, 106,  151, 249 },
-	{ 35724, 17188, 20688,  136, 2, 106,  151, 249 },
-	{ 33928, 16841, 24909,  129, 0, 121,  137, 252 },
-	{ 36633, 16841, 26719,  131, 0, 123,  158, 252 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 36633, 16841, 26719,  131, 0, 123,  158, 252 },
-	{ 33928, 16841, 24909,  129, 0, 121,  137, 252 },
-	{ 33928, 16841, 24909,  129, 0, 121,  137, 252 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 44372, 17678, 26901,  200, 27, 97,  218, 245 },
-	{ 44692, 18239, 26765,  220, 49, 88,  221, 241 },
-	{ 41442, 18239, 21909,  198, 49, 56,  195, 241 },
-	{ 41442, 18239, 21909,  198, 49, 56,  195, 241 },
-	{ 41196, 17678, 22155,  183, 27, 71,  193, 245 },
-	{ 44372, 17678, 26901,  200, 27, 97,  218, 245 },
-	{ 42664, 17188, 27628,  148, 2, 118,  205, 249 },
-	{ 44372, 17678, 26901,  200, 27, 97,  218, 245 },
-	{ 41196, 17678, 22155,  183, 27, 71,  193, 245 },
-	{ 41196, 17678, 22155,  183, 27, 71,  193, 245 },
-	{ 39882, 17188, 23470,  143, 2, 111,  183, 249 },
-	{ 42664, 17188, 27628,  148, 2, 118,  205, 249 },
-	{ 38443, 16841, 29424,  133, 0, 125,  172, 252 },
-	{ 42664, 17188, 27628,  148, 2, 118,  205, 249 },
-	{ 39882, 17188, 23470,  143, 2, 111,  183, 249 },
-	{ 39882, 17188, 23470,  143, 2, 111,  183, 249 },
-	{ 36633, 16841, 26719,  131, 0, 123,  158, 252 },
-	{ 38443, 16841, 29424,  133, 0, 125,  172, 252 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 38443, 16841, 29424,  133, 0, 125,  172, 252 },
-	{ 36633, 16841, 26719,  131, 0, 123,  158, 252 },
-	{ 36633, 16841, 26719,  131, 0, 123,  158, 252 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 45531, 17678, 32767,  207, 27, 127,  227, 245 },
-	{ 45877, 18239, 32767,  228, 49, 127,  230, 241 },
-	{ 44692, 18239, 26765,  220, 49, 88,  221, 241 },
-	{ 44692, 18239, 26765,  220, 49, 88,  221, 241 },
-	{ 44372, 17678, 26901,  200, 27, 97,  218, 245 },
-	{ 45531, 17678, 32767,  207, 27, 127,  227, 245 },
-	{ 43679, 17188, 32767,  150, 2, 127,  213, 249 },
-	{ 45531, 17678, 32767,  207, 27, 127,  227, 245 },
-	{ 44372, 17678, 26901,  200, 27, 97,  218, 245 },
-	{ 44372, 17678, 26901,  200, 27, 97,  218, 245 },
-	{ 42664, 17188, 27628,  148, 2, 118,  205, 249 },
-	{ 43679, 17188, 32767,  150, 2, 127,  213, 249 },
-	{ 39103, 16841, 32767,  133, 0, 127,  177, 252 },
-	{ 43679, 17188, 32767,  150, 2, 127,  213, 249 },
-	{ 42664, 17188, 27628,  148, 2, 118,  205, 249 },
-	{ 42664, 17188, 27628,  148, 2, 118,  205, 249 },
-	{ 38443, 16841, 29424,  133, 0, 125,  172, 252 },
-	{ 39103, 16841, 32767,  133, 0, 127,  177, 252 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 39103, 16841, 32767,  133, 0, 127,  177, 252 },
-	{ 38443, 16841, 29424,  133, 0, 125,  172, 252 },
-	{ 38443, 16841, 29424,  133, 0, 125,  172, 252 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 30585, 16710, 32767,  127, 0, 127,  110, 253 },
-	{ 9368, 37672, 34487,  132, 20, 197,  202, 89 },
-	{ 14432, 37713, 34487,  128, 23, 201,  241, 89 },
-	{ 14273, 37355, 32767,  128, 0, 127,  240, 92 },
-	{ 14273, 37355, 32767,  128, 0, 127,  240, 92 },
-	{ 9510, 37319, 32767,  132, 0, 127,  203, 92 },
-	{ 9368, 37672, 34487,  132, 20, 197,  202, 89 },
-	{ 5651, 37382, 34487,  148, 24, 199,  173, 91 },
-	{ 9368, 37672, 34487,  132, 20, 197,  202, 89 },
-	{ 9510, 37319, 32767,  132, 0, 127,  203, 92 },
-	{ 9510, 37319, 32767,  132, 0, 127,  203, 92 },
-	{ 5989, 37068, 32767,  150, 2, 126,  175, 94 },
-	{ 5651, 37382, 34487,  148, 24, 199,  173, 91 },
-	{ 3361, 36594, 34487,  189, 51, 209,  155, 98 },
-	{ 5651, 37382, 34487,  148, 24, 199,  173, 91 },
-	{ 5989, 37068, 32767,  150, 2, 126,  175, 94 },
-	{ 5989, 37068, 32767,  150, 2, 126,  175, 94 },
-	{ 3807, 36387, 32767,  205, 26, 126,  158, 99 },
-	{ 3361, 36594, 34487,  189, 51, 209,  155, 98 },
-	{ 2580, 35061, 34487,  221, 112, 212,  149, 110 },
-	{ 3361, 36594, 34487,  189, 51, 209,  155, 98 },
-	{ 3807, 36387, 32767,  205, 26, 126,  158, 99 },
-	{ 3807, 36387, 32767,  205, 26, 126,  158, 99 },
-	{ 3058, 35061, 32767,  253, 106, 126,  152, 110 },
-	{ 2580, 35061, 34487,  221, 112, 212,  149, 110 },
-	{ 9056, 38448, 35061,  127, 129, 254,  199, 83 },
-	{ 14782, 38502, 35061,  127, 148, 253,  244, 83 },
-	{ 14432, 37713, 34487,  128, 23, 201,  241, 89 },
-	{ 14432, 37713, 34487,  128, 23, 201,  241, 89 },
-	{ 9368, 37672, 34487,  132, 20, 197,  202, 89 },
-	{ 9056, 38448, 35061,  127, 129, 254,  199, 83 },
-	{ 4906, 38072, 35061,  128, 136, 254,  167, 86 },
-	{ 9056, 38448, 35061,  127, 129, 254,  199, 83 },
-	{ 9368, 37672, 34487,  132, 20, 197,  202, 89 },
-	{ 9368, 37672, 34487,  132, 20, 197,  202, 89 },
-	{ 5651, 37382, 34487,  148, 24, 199,  173, 91 },
-	{ 4906, 38072, 35061,  128, 136, 254,  167, 86 },
-	{ 2381, 37050, 35061,  119, 144, 253,  147, 94 },
-	{ 4906, 38072, 35061,  128, 136, 254,  167, 86 },
-	{ 5651, 37382, 34487,  148, 24, 199,  173, 91 },
-	{ 5651, 37382, 34487,  148, 24, 199,  173, 91 },
-	{ 3361, 36594, 34487,  189, 51, 209,  155, 98 },
-	{ 2381, 37050, 35061,  119, 144, 253,  147, 94 },
-	{ 1529, 35061, 35061,  115, 129, 254,  140, 110 },
-	{ 2381, 37050, 35061,  119, 144, 253,  147, 94 },
-	{ 3361, 36594, 34487,  189, 51, 209,  155, 98 },
-	{ 3361, 36594, 34487,  189, 51, 209,  155, 98 },
-	{ 2580, 35061, 34487,  221, 112, 212,  149, 110 },
-	{ 1529, 35061, 35061,  115, 129, 254,  140, 110 },
-	{ 8743, 39224, 34487,  121, 234, 196,  197, 77 },
-	{ 15133, 39290, 34487,  126, 238, 190,  247, 77 },
-	{ 14782, 38502, 35061,  127, 148, 253,  244, 83 },
-	{ 14782, 38502, 35061,  127, 148, 253,  244, 83 },
-	{ 9056, 38448, 35061,  127, 129, 254,  199, 83 },
-	{ 8743, 39224, 34487,  121, 234, 196,  197, 77 },
-	{ 4161, 38762, 34487,  99, 229, 197,  161, 81 },
-	{ 8743, 39224, 34487,  121, 234, 196,  197, 77 },
-	{ 9056, 38448, 35061,  127, 129, 254,  199, 83 },
-	{ 9056, 38448, 35061,  127, 129, 254,  199, 83 },
-	{ 4906, 38072, 35061,  128, 136, 254,  167, 86 },
-	{ 4161, 38762, 34487,  99, 229, 197,  161, 81 },
-	{ 1401, 37506, 34487,  51, 198, 200,  139, 90 },
-	{ 4161, 38762, 34487,  99, 229, 197,  161, 81 },
-	{ 4906, 38072, 35061,  128, 136, 254,  167, 86 },
-	{ 4906, 38072, 35061,  128, 136, 254,  167, 86 },
-	{ 2381, 37050, 35061,  119, 144, 253,  147, 94 },
-	{ 1401, 37506, 34487,  51, 198, 200,  139, 90 },
-	{ 477, 35061, 34487,  25, 136, 202,  132, 110 },
-	{ 1401, 37506, 34487,  51, 198, 200,  139, 90 },
-	{ 2381, 37050, 35061,  119, 144, 253,  147, 94 },
-	{ 2381, 37050, 35061,  119, 144, 253,  147, 94 },
-	{ 1529, 35061, 35061,  115, 129, 254,  140, 110 },
-	{ 477, 35061, 34487,  25, 136, 202,  132, 110 },
-	{ 8602, 39577, 32767,  120, 254, 127,  196, 74 },
-	{ 15292, 39649, 32767,  126, 254, 127,  248, 74 },
-	{ 15133, 39290, 34487,  126, 238, 190,  247, 77 },
-	{ 15133, 39290, 34487,  126, 238, 190,  247, 77 },
-	{ 8743, 39224, 34487,  121, 234, 196,  197, 77 },
-	{ 8602, 39577, 32767,  120, 254, 127,  196, 74 },
-	{ 3823, 39075, 32767,  91, 249, 127,  158, 78 },
-	{ 8602, 39577, 32767,  120, 254, 127,  196, 74 },
-	{ 8743, 39224, 34487,  121, 234, 196,  197, 77 },
-	{ 8743, 39224, 34487,  121, 234, 196,  197, 77 },
-	{ 4161, 38762, 34487,  99, 229, 197,  161, 81 },
-	{ 3823, 39075, 32767,  91, 249, 127,  158, 78 },
-	{ 955, 37713, 32767,  31, 211, 128,  136, 89 },
-	{ 3823, 39075, 32767,  91, 249, 127,  158, 78 },
-	{ 4161, 38762, 34487,  99, 229, 197,  161, 81 },
-	{ 4161, 38762, 34487,  99, 229, 197,  161, 81 },
-	{ 1401, 37506, 34487,  51, 198, 200,  139, 90 },
-	{ 955, 37713, 32767,  31, 211, 128,  136, 89 },
-	{ 0, 35061, 32767,  0, 136, 127,  128, 110 },
-	{ 955, 37713, 32767,  31, 211, 128,  136, 89 },
-	{ 1401, 37506, 34487,  51, 198, 200,  139, 90 },
-	{ 1401, 37506, 34487,  51, 198, 200,  139, 90 },
-	{ 477, 35061, 34487,  25, 136, 202,  132, 110 },
-	{ 0, 35061, 32767,  0, 136, 127,  128, 110 },
-	{ 8743, 39224, 31047,  121, 234, 58,  197, 77 },
-	{ 15133, 39290, 31047,  126, 238, 64,  247, 77 },
-	{ 15292, 39649, 32767,  126, 254, 127,  248, 74 },
-	{ 15292, 39649, 32767,  126, 254, 127,  248, 74 },
-	{ 8602, 39577, 32767,  120, 254, 127,  196, 74 },
-	{ 8743, 39224, 31047,  121, 234, 58,  197, 77 },
-	{ 4161, 38762, 31047,  99, 230, 57,  161, 81 },
-	{ 8743, 39224, 31047,  121, 234, 58,  197, 77 },
-	{ 8602, 39577, 32767,  120, 254, 127,  196, 74 },
-	{ 8602, 39577, 32767,  120, 254, 127,  196, 74 },
-	{ 3823, 39075, 32767,  91, 249, 127,  158, 78 },
-	{ 4161, 38762, 31047,  99, 230, 57,  161, 81 },
-	{ 1401, 37506, 31047,  51, 198, 54,  139, 90 },
-	{ 4161, 38762, 31047,  99, 230, 57,  161, 81 },
-	{ 3823, 39075, 32767,  91, 249, 127,  158, 78 },
-	{ 3823, 39075, 32767,  91, 249, 127,  158, 78 },
-	{ 955, 37713, 32767,  31, 211, 128,  136, 89 },
-	{ 1401, 37506, 31047,  51, 198, 54,  139, 90 },
-	{ 477, 35061, 31047,  24, 135, 52,  132, 110 },
-	{ 1401, 37506, 31047,  51, 198, 54,  139, 90 },
-	{ 955, 37713, 32767,  31, 211, 128,  136, 89 },
-	{ 955, 37713, 32767,  31, 211, 128,  136, 89 },
-	{ 0, 35061, 32767,  0, 136, 127,  128, 110 },
-	{ 477, 35061, 31047,  24, 135, 52,  132, 110 },
-	{ 9056, 38448, 30473,  127, 129, 0,  199, 83 },
-	{ 14782, 38502, 30473,  127, 148, 1,  244, 83 },
-	{ 15133, 39290, 31047,  126, 238, 64,  247, 77 },
-	{ 15133, 39290, 31047,  126, 238, 64,  247, 77 },
-	{ 8743, 39224, 31047,  121, 234, 58,  197, 77 },
-	{ 9056, 38448, 30473,  127, 129, 0,  199, 83 },
-	{ 4906, 38072, 30473,  128, 135, 0,  167, 86 },
-	{ 9056, 38448, 30473,  127, 129, 0,  199, 83 },
-	{ 8743, 39224, 31047,  121, 234, 58,  197, 77 },
-	{ 8743, 39224, 31047,  121, 234, 58,  197, 77 },
-	{ 4161, 38762, 31047,  99, 230, 57,  161, 81 },
-	{ 4906, 38072, 30473,  128, 135, 0,  167, 86 },
-	{ 2381, 37050, 30473,  119, 142, 1,  147, 94 },
-	{ 4906, 38072, 30473,  128, 135, 0,  167, 86 },
-	{ 4161, 38762, 31047,  99, 230, 57,  161, 81 },
-	{ 4161, 38762, 31047,  99, 230, 57,  161, 81 },
-	{ 1401, 37506, 31047,  51, 198, 54,  139, 90 },
-	{ 2381, 37050, 30473,  119, 142, 1,  147, 94 },
-	{ 1529, 35061, 30473,  116, 129, 0,  140, 110 },
-	{ 2381, 37050, 30473,  119, 142, 1,  147, 94 },
-	{ 1401, 37506, 31047,  51, 198, 54,  139, 90 },
-	{ 1401, 37506, 31047,  51, 198, 54,  139, 90 },
-	{ 477, 35061, 31047,  24, 135, 52,  132, 110 },
-	{ 1529, 35061, 30473,  116, 129, 0,  140, 110 },
-	{ 9368, 37672, 31047,  131, 20, 57,  202, 89 },
-	{ 14432, 37713, 31047,  128, 23, 53,  241, 89 },
-	{ 14782, 38502, 30473,  127, 148, 1,  244, 83 },
-	{ 14782, 38502, 30473,  127, 148, 1,  244, 83 },
-	{ 9056, 38448, 30473,  127, 129, 0,  199, 83 },
-	{ 9368, 37672, 31047,  131, 20, 57,  202, 89 },
-	{ 5651, 37382, 31047,  147, 23, 55,  173, 91 },
-	{ 9368, 37672, 31047,  131, 20, 57,  202, 89 },
-	{ 9056, 38448, 30473,  127, 129, 0,  199, 83 },
-	{ 9056, 38448, 30473,  127, 129, 0,  199, 83 },
-	{ 4906, 38072, 30473,  128, 135, 0,  167, 86 },
-	{ 5651, 37382, 31047,  147, 23, 55,  173, 91 },
-	{ 3361, 36594, 31047,  189, 52, 45,  155, 98 },
-	{ 5651, 37382, 31047,  147, 23, 55,  173, 91 },
-	{ 4906, 38072, 30473,  128, 135, 0,  167, 86 },
-	{ 4906, 38072, 30473,  128, 135, 0,  167, 86 },
-	{ 2381, 37050, 30473,  119, 142, 1,  147, 94 },
-	{ 3361, 36594, 31047,  189, 52, 45,  155, 98 },
-	{ 2580, 35061, 31047,  221, 114, 42,  149, 110 },
-	{ 3361, 36594, 31047,  189, 52, 45,  155, 98 },
-	{ 2381, 37050, 30473,  119, 142, 1,  147, 94 },
-	{ 2381, 37050, 30473,  119, 142, 1,  147, 94 },
-	{ 1529, 35061, 30473,  116, 129, 0,  140, 110 },
-	{ 2580, 35061, 31047,  221, 114, 42,  149, 110 },
-	{ 9510, 37319, 32767,  132, 0, 127,  203, 92 },
-	{ 14273, 37355, 32767,  128, 0, 127,  240, 92 },
-	{ 14432, 37713, 31047,  128, 23, 53,  241, 89 },
-	{ 14432, 37713, 31047,  128, 23, 53,  241, 89 },
-	{ 9368, 37672, 31047,  131, 20, 57,  202, 89 },
-	{ 9510, 37319, 32767,  132, 0, 127,  203, 92 },
-	{ 5989, 37068, 32767,  150, 2, 126,  175, 94 },
-	{ 9510, 37319, 32767,  132, 0, 127,  203, 92 },
-	{ 9368, 37672, 31047,  131, 20, 57,  202, 89 },
-	{ 9368, 37672, 31047,  131, 20, 57,  202, 89 },
-	{ 5651, 37382, 31047,  147, 23, 55,  173, 91 },
-	{ 5989, 37068, 32767,  150, 2, 126,  175, 94 },
-	{ 3807, 36387, 32767,  205, 26, 126,  158, 99 },
-	{ 5989, 37068, 32767,  150, 2, 126,  175, 94 },
-	{ 5651, 37382, 31047,  147, 23, 55,  173, 91 },
-	{ 5651, 37382, 31047,  147, 23, 55,  173, 91 },
-	{ 3361, 36594, 31047,  189, 52, 45,  155, 98 },
-	{ 3807, 36387, 32767,  205, 26, 126,  158, 99 },
-	{ 3058, 35061, 32767,  253, 106, 126,  152, 110 },
-	{ 3807, 36387, 32767,  205, 26, 126,  158, 99 },
-	{ 3361, 36594, 31047,  189, 52, 45,  155, 98 },
-	{ 3361, 36594, 31047,  189, 52, 45,  155, 98 },
-	{ 2580, 35061, 31047,  221, 114, 42,  149, 110 },
-	{ 3058, 35061, 32767,  253, 106, 126,  152, 110 },
-	{ 3022, 32781, 34487,  220, 160, 208,  152, 127 },
-	{ 2580, 35061, 34487,  221, 112, 212,  149, 110 },
-	{ 3058, 35061, 32767,  253, 106, 126,  152, 110 },
-	{ 3058, 35061, 32767,  253, 106, 126,  152, 110 },
-	{ 3456, 32982, 32767,  248, 168, 127,  156, 126 },
-	{ 3022, 32781, 34487,  220, 160, 208,  152, 127 },
-	{ 4406, 30167, 34487,  209, 186, 204,  163, 148 },
-	{ 3022, 32781, 34487,  220, 160, 208,  152, 127 },
-	{ 3456, 32982, 32767,  248, 168, 127,  156, 126 },
-	{ 3456, 32982, 32767,  248, 168, 127,  156, 126 },
-	{ 4715, 30473, 32767,  232, 199, 126,  165, 145 },
-	{ 4406, 30167, 34487,  209, 186, 204,  163, 148 },
-	{ 6821, 27586, 34487,  195, 208, 198,  182, 168 },
-	{ 4406, 30167, 34487,  209, 186, 204,  163, 148 },
-	{ 4715, 30473, 32767,  232, 199, 126,  165, 145 },
-	{ 4715, 30473, 32767,  232, 199, 126,  165, 145 },
-	{ 6929, 27964, 32767,  210, 224, 126,  183, 165 },
-	{ 6821, 27586, 34487,  195, 208, 198,  182, 168 },
-	{ 10354, 25407, 34487,  181, 214, 203,  209, 185 },
-	{ 6821, 27586, 34487,  195, 208, 198,  182, 168 },
-	{ 6929, 27964, 32767,  210, 224, 126,  183, 165 },
-	{ 6929, 27964, 32767,  210, 224, 126,  183, 165 },
-	{ 10195, 25885, 32767,  195, 235, 126,  208, 181 },
-	{ 10354, 25407, 34487,  181, 214, 203,  209, 185 },
-	{ 2066, 32340, 35061,  121, 124, 254,  145, 131 },
-	{ 1529, 35061, 35061,  115, 129, 254,  140, 110 },
-	{ 2580, 35061, 34487,  221, 112, 212,  149, 110 },
-	{ 2580, 35061, 34487,  221, 112, 212,  149, 110 },
-	{ 3022, 32781, 34487,  220, 160, 208,  152, 127 },
-	{ 2066, 32340, 35061,  121, 124, 254,  145, 131 },
-	{ 3727, 29493, 35061,  122, 122, 254,  158, 153 },
-	{ 2066, 32340, 35061,  121, 124, 254,  145, 131 },
-	{ 3022, 32781, 34487,  220, 160, 208,  152, 127 },
-	{ 3022, 32781, 34487,  220, 160, 208,  152, 127 },
-	{ 4406, 30167, 34487,  209, 186, 204,  163, 148 },
-	{ 3727, 29493, 35061,  122, 122, 254,  158, 153 },
-	{ 6582, 26755, 35061,  122, 122, 254,  180, 174 },
-	{ 3727, 29493, 35061,  122, 122, 254,  158, 153 },
-	{ 4406, 30167, 34487,  209, 186, 204,  163, 148 },
-	{ 4406, 30167, 34487,  209, 186, 204,  163, 148 },
-	{ 6821, 27586, 34487,  195, 208, 198,  182, 168 },
-	{ 6582, 26755, 35061,  122, 122, 254,  180, 174 },
-	{ 10704, 24356, 35061,  105, 89, 247,  212, 193 },
-	{ 6582, 26755, 35061,  122, 122, 254,  180, 174 },
-	{ 6821, 27586, 34487,  195, 208, 198,  182, 168 },
-	{ 6821, 27586, 34487,  195, 208, 198,  182, 168 },
-	{ 10354, 25407, 34487,  181, 214, 203,  209, 185 },
-	{ 10704, 24356, 35061,  105, 89, 247,  212, 193 },
-	{ 1111, 31898, 34487,  32, 89, 203,  137, 134 },
-	{ 477, 35061, 34487,  25, 136, 202,  132, 110 },
-	{ 1529, 35061, 35061,  115, 129, 254,  140, 110 },
-	{ 1529, 35061, 35061,  115, 129, 254,  140, 110 },
-	{ 2066, 32340, 35061,  121, 124, 254,  145, 131 },
-	{ 1111, 31898, 34487,  32, 89, 203,  137, 134 },
-	{ 3048, 28820, 34487,  48, 60, 201,  152, 158 },
-	{ 1111, 31898, 34487,  32, 89, 203,  137, 134 },
-	{ 2066, 32340, 35061,  121, 124, 254,  145, 131 },
-	{ 2066, 32340, 35061,  121, 124, 254,  145, 131 },
-	{ 3727, 29493, 35061,  122, 122, 254,  158, 153 },
-	{ 3048, 28820, 34487,  48, 60, 201,  152, 158 },
-	{ 6344, 25923, 34487,  65, 40, 196,  178, 181 },
-	{ 3048, 28820, 34487,  48, 60, 201,  152, 158 },
-	{ 3727, 29493, 35061,  122, 122, 254,  158, 153 },
-	{ 3727, 29493, 35061,  122, 122, 254,  158, 153 },
-	{ 6582, 26755, 35061,  122, 122, 254,  180, 174 },
-	{ 6344, 25923, 34487,  65, 40, 196,  178, 181 },
-	{ 11055, 23305, 34487,  70, 26, 180,  215, 201 },
-	{ 6344, 25923, 34487,  65, 40, 196,  178, 181 },
-	{ 6582, 26755, 35061,  122, 122, 254,  180, 174 },
-	{ 6582, 26755, 35061,  122, 122, 254,  180, 174 },
-	{ 10704, 24356, 35061,  105, 89, 247,  212, 193 },
-	{ 11055, 23305, 34487,  70, 26, 180,  215, 201 },
-	{ 677, 31698, 32767,  9, 79, 127,  134, 136 },
-	{ 0, 35061, 32767,  0, 136, 127,  128, 110 },
-	{ 477, 35061, 34487,  25, 136, 202,  132, 110 },
-	{ 477, 35061, 34487,  25, 136, 202,  132, 110 },
-	{ 1111, 31898, 34487,  32, 89, 203,  137, 134 },
-	{ 677, 31698, 32767,  9, 79, 127,  134, 136 },
-	{ 2739, 28514, 32767,  31, 43, 128,  150, 161 },
-	{ 677, 31698, 32767,  9, 79, 127,  134, 136 },
-	{ 1111, 31898, 34487,  32, 89, 203,  137, 134 },
-	{ 1111, 31898, 34487,  32, 89, 203,  137, 134 },
-	{ 3048, 28820, 34487,  48, 60, 201,  152, 158 },
-	{ 2739, 28514, 32767,  31, 43, 128,  150, 161 },
-	{ 6236, 25545, 32767,  55, 22, 127,  177, 184 },
-	{ 2739, 28514, 32767,  31, 43, 128,  150, 161 },
-	{ 3048, 28820, 34487,  48, 60, 201,  152, 158 },
-	{ 3048, 28820, 34487,  48, 60, 201,  152, 158 },
-	{ 6344, 25923, 34487,  65, 40, 196,  178, 181 },
-	{ 6236, 25545, 32767,  55, 22, 127,  177, 184 },
-	{ 11214, 22827, 32767,  66, 15, 127,  216, 205 },
-	{ 6236, 25545, 32767,  55, 22, 127,  177, 184 },
-	{ 6344, 25923, 34487,  65, 40, 196,  178, 181 },
-	{ 6344, 25923, 34487,  65, 40, 196,  178, 181 },
-	{ 11055, 23305, 34487,  70, 26, 180,  215, 201 },
-	{ 11214, 22827, 32767,  66, 15, 127,  216, 205 },
-	{ 1111, 31898, 31047,  32, 89, 51,  137, 134 },
-	{ 477, 35061, 31047,  24, 135, 52,  132, 110 },
-	{ 0, 35061, 32767,  0, 136, 127,  128, 110 },
-	{ 0, 35061, 32767,  0, 136, 127,  128, 110 },
-	{ 677, 31698, 32767,  9, 79, 127,  134, 136 },
-	{ 1111, 31898, 31047,  32, 89, 51,  137, 134 },
-	{ 3048, 28820, 31047,  48, 60, 53,  152, 158 },
-	{ 1111, 31898, 31047,  32, 89, 51,  137, 134 },
-	{ 677, 31698, 32767,  9, 79, 127,  134, 136 },
-	{ 677, 31698, 32767,  9, 79, 127,  134, 136 },
-	{ 2739, 28514, 32767,  31, 43, 128,  150, 161 },
-	{ 3048, 28820, 31047,  48, 60, 53,  152, 158 },
-	{ 6344, 25923, 31047,  66, 39, 58,  178, 181 },
-	{ 3048, 28820, 31047,  48, 60, 53,  152, 158 },
-	{ 2739, 28514, 32767,  31, 43, 128,  150, 161 },
-	{ 2739, 28514, 32767,  31, 43, 128,  150, 161 },
-	{ 6236, 25545, 32767,  55, 22, 127,  177, 184 },
-	{ 6344, 25923, 31047,  66, 39, 58,  178, 181 },
-	{ 11055, 23305, 31047,  71, 25, 74,  215, 201 },
-	{ 6344, 25923, 31047,  66, 39, 58,  178, 181 },
-	{ 6236, 25545, 32767,  55, 22, 127,  177, 184 },
-	{ 6236, 25545, 32767,  55, 22, 127,  177, 184 },
-	{ 11214, 22827, 32767,  66, 15, 127,  216, 205 },
-	{ 11055, 23305, 31047,  71, 25, 74,  215, 201 },
-	{ 2066, 32340, 30473,  121, 125, 0,  145, 131 },
-	{ 1529, 35061, 30473,  116, 129, 0,  140, 110 },
-	{ 477, 35061, 31047,  24, 135, 52,  132, 110 },
-	{ 477, 35061, 31047,  24, 135, 52,  132, 110 },
-	{ 1111, 31898, 31047,  32, 89, 51,  137, 134 },
-	{ 2066, 32340, 30473,  121, 125, 0,  145, 131 },
-	{ 3727, 29493, 30473,  124, 123, 0,  158, 153 },
-	{ 2066, 32340, 30473,  121, 125, 0,  145, 131 },
-	{ 1111, 31898, 31047,  32, 89, 51,  137, 134 },
-	{ 1111, 31898, 31047,  32, 89, 51,  137, 134 },
-	{ 3048, 28820, 31047,  48, 60, 53,  152, 158 },
-	{ 3727, 29493, 30473,  124, 123, 0,  158, 153 },
-	{ 6582, 26755, 30473,  124, 123, 0,  180, 174 },
-	{ 3727, 29493, 30473,  124, 123, 0,  158, 153 },
-	{ 3048, 28820, 31047,  48, 60, 53,  152, 158 },
-	{ 3048, 28820, 31047,  48, 60, 53,  152, 158 },
-	{ 6344, 25923, 31047,  66, 39, 58,  178, 181 },
-	{ 6582, 26755, 30473,  124, 123, 0,  180, 174 },
-	{ 10704, 24356, 30473,  107, 90, 7,  212, 193 },
-	{ 6582, 26755, 30473,  124, 123, 0,  180, 174 },
-	{ 6344, 25923, 31047,  66, 39, 58,  178, 181 },
-	{ 6344, 25923, 31047,  66, 39, 58,  178, 181 },
-	{ 11055, 23305, 31047,  71, 25, 74,  215, 201 },
-	{ 10704, 24356, 30473,  107, 90, 7,  212, 193 },
-	{ 3022, 32781, 31047,  220, 159, 46,  152, 127 },
-	{ 2580, 35061, 31047,  221, 114, 42,  149, 110 },
-	{ 1529, 35061, 30473,  116, 129, 0,  140, 110 },
-	{ 1529, 35061, 30473,  116, 129, 0,  140, 110 },
-	{ 2066, 32340, 30473,  121, 125, 0,  145, 131 },
-	{ 3022, 32781, 31047,  220, 159, 46,  152, 127 },
-	{ 4406, 30167, 31047,  209, 186, 49,  163, 148 },
-	{ 3022, 32781, 31047,  220, 159, 46,  152, 127 },
-	{ 2066, 32340, 30473,  121, 125, 0,  145, 131 },
-	{ 2066, 32340, 30473,  121, 125, 0,  145, 131 },
-	{ 3727, 29493, 30473,  124, 123, 0,  158, 153 },
-	{ 4406, 30167, 31047,  209, 186, 49,  163, 148 },
-	{ 6821, 27586, 31047,  194, 209, 55,  182, 168 },
-	{ 4406, 30167, 31047,  209, 186, 49,  163, 148 },
-	{ 3727, 29493, 30473,  124, 123, 0,  158, 153 },
-	{ 3727, 29493, 30473,  124, 123, 0,  158, 153 },
-	{ 6582, 26755, 30473,  124, 123, 0,  180, 174 },
-	{ 6821, 27586, 31047,  194, 209, 55,  182, 168 },
-	{ 10354, 25407, 31047,  179, 214, 50,  209, 185 },
-	{ 6821, 27586, 31047,  194, 209, 55,  182, 168 },
-	{ 6582, 26755, 30473,  124, 123, 0,  180, 174 },
-	{ 6582, 26755, 30473,  124, 123, 0,  180, 174 },
-	{ 10704, 24356, 30473,  107, 90, 7,  212, 193 },
-	{ 10354, 25407, 31047,  179, 214, 50,  209, 185 },
-	{ 3456, 32982, 32767,  248, 168, 127,  156, 126 },
-	{ 3058, 35061, 32767,  253, 106, 126,  152, 110 },
-	{ 2580, 35061, 31047,  221, 114, 42,  149, 110 },
-	{ 2580, 35061, 31047,  221, 114, 42,  149, 110 },
-	{ 3022, 32781, 31047,  220, 159, 46,  152, 127 },
-	{ 3456, 32982, 32767,  248, 168, 127,  156, 126 },
-	{ 4715, 30473, 32767,  232, 199, 126,  165, 145 },
-	{ 3456, 32982, 32767,  248, 168, 127,  156, 126 },
-	{ 3022, 32781, 31047,  220, 159, 46,  152, 127 },
-	{ 3022, 32781, 31047,  220, 159, 46,  152, 127 },
-	{ 4406, 30167, 31047,  209, 186, 49,  163, 148 },
-	{ 4715, 30473, 32767,  232, 199, 126,  165, 145 },
-	{ 6929, 27964, 32767,  210, 224, 126,  183, 165 },
-	{ 4715, 30473, 32767,  232, 199, 126,  165, 145 },
-	{ 4406, 30167, 31047,  209, 186, 49,  163, 148 },
-	{ 4406, 30167, 31047,  209, 186, 49,  163, 148 },
-	{ 6821, 27586, 31047,  194, 209, 55,  182, 168 },
-	{ 6929, 27964, 32767,  210, 224, 126,  183, 165 },
-	{ 10195, 25885, 32767,  195, 235, 126,  208, 181 },
-	{ 6929, 27964, 32767,  210, 224, 126,  183, 165 },
-	{ 6821, 27586, 31047,  194, 209, 55,  182, 168 },
-	{ 6821, 27586, 31047,  194, 209, 55,  182, 168 },
-	{ 10354, 25407, 31047,  179, 214, 50,  209, 185 },
-	{ 10195, 25885, 32767,  195, 235, 126,  208, 181 },
-	{ 53180, 31386, 36185,  87, 208, 217,  31, 138 },
-	{ 47916, 29924, 36552,  108, 215, 218,  246, 150 },
-	{ 47916, 31238, 32767,  98, 251, 126,  246, 139 },
-	{ 47916, 31238, 32767,  98, 251, 126,  246, 139 },
-	{ 52807, 32361, 32767,  57, 234, 127,  28, 131 },
-	{ 53180, 31386, 36185,  87, 208, 217,  31, 138 },
-	{ 55403, 34493, 35376,  50, 187, 209,  48, 114 },
-	{ 53180, 31386, 36185,  87, 208, 217,  31, 138 },
-	{ 52807, 32361, 32767,  57, 234, 127,  28, 131 },
-	{ 52807, 32361, 32767,  57, 234, 127,  28, 131 },
-	{ 54925, 35061, 32767,  15, 189, 128,  45, 110 },
-	{ 55403, 34493, 35376,  50, 187, 209,  48, 114 },
-	{ 56671, 38129, 34568,  46, 184, 207,  58, 86 },
-	{ 55403, 34493, 35376,  50, 187, 209,  48, 114 },
-	{ 54925, 35061, 32767,  15, 189, 128,  45, 110 },
-	{ 54925, 35061, 32767,  15, 189, 128,  45, 110 },
-	{ 56088, 38334, 32767,  15, 188, 129,  54, 84 },
-	{ 56671, 38129, 34568,  46, 184, 207,  58, 86 },
-	{ 59067, 41178, 34201,  71, 204, 212,  77, 62 },
-	{ 56671, 38129, 34568,  46, 184, 207,  58, 86 },
-	{ 56088, 38334, 32767,  15, 188, 129,  54, 84 },
-	{ 56088, 38334, 32767,  15, 188, 129,  54, 84 },
-	{ 58111, 41178, 32767,  38, 218, 130,  69, 62 },
-	{ 59067, 41178, 34201,  71, 204, 212,  77, 62 },
-	{ 54001, 29243, 37324,  155, 128, 251,  37, 155 },
-	{ 47916, 27032, 37814,  141, 116, 253,  246, 172 },
-	{ 47916, 29924, 36552,  108, 215, 218,  246, 150 },
-	{ 47916, 29924, 36552,  108, 215, 218,  246, 150 },
-	{ 53180, 31386, 36185,  87, 208, 217,  31, 138 },
-	{ 54001, 29243, 37324,  155, 128, 251,  37, 155 },
-	{ 56455, 33245, 36246,  151, 147, 251,  57, 124 },
-	{ 54001, 29243, 37324,  155, 128, 251,  37, 155 },
-	{ 53180, 31386, 36185,  87, 208, 217,  31, 138 },
-	{ 53180, 31386, 36185,  87, 208, 217,  31, 138 },
-	{ 55403, 34493, 35376,  50, 187, 209,  48, 114 },
-	{ 56455, 33245, 36246,  151, 147, 251,  57, 124 },
-	{ 57952, 37677, 35168,  128, 151, 252,  68, 89 },
-	{ 56455, 33245, 36246,  151, 147, 251,  57, 124 },
-	{ 55403, 34493, 35376,  50, 187, 209,  48, 114 },
-	{ 55403, 34493, 35376,  50, 187, 209,  48, 114 },
-	{ 56671, 38129, 34568,  46, 184, 207,  58, 86 },
-	{ 57952, 37677, 35168,  128, 151, 252,  68, 89 },
-	{ 61170, 41178, 34679,  126, 158, 251,  93, 62 },
-	{ 57952, 37677, 35168,  128, 151, 252,  68, 89 },
-	{ 56671, 38129, 34568,  46, 184, 207,  58, 86 },
-	{ 56671, 38129, 34568,  46, 184, 207,  58, 86 },
-	{ 59067, 41178, 34201,  71, 204, 212,  77, 62 },
-	{ 61170, 41178, 34679,  126, 158, 251,  93, 62 },
-	{ 54823, 27099, 36185,  200, 55, 202,  44, 172 },
-	{ 47916, 24141, 36552,  171, 35, 203,  246, 195 },
-	{ 47916, 27032, 37814,  141, 116, 253,  246, 172 },
-	{ 47916, 27032, 37814,  141, 116, 253,  246, 172 },
-	{ 54001, 29243, 37324,  155, 128, 251,  37, 155 },
-	{ 54823, 27099, 36185,  200, 55, 202,  44, 172 },
-	{ 57506, 31996, 35376,  227, 94, 198,  65, 134 },
-	{ 54823, 27099, 36185,  200, 55, 202,  44, 172 },
-	{ 54001, 29243, 37324,  155, 128, 251,  37, 155 },
-	{ 54001, 29243, 37324,  155, 128, 251,  37, 155 },
-	{ 56455, 33245, 36246,  151, 147, 251,  57, 124 },
-	{ 57506, 31996, 35376,  227, 94, 198,  65, 134 },
-	{ 59233, 37226, 34568,  210, 88, 216,  78, 93 },
-	{ 57506, 31996, 35376,  227, 94, 198,  65, 134 },
-	{ 56455, 33245, 36246,  151, 147, 251,  57, 124 },
-	{ 56455, 33245, 36246,  151, 147, 251,  57, 124 },
-	{ 57952, 37677, 35168,  128, 151, 252,  68, 89 },
-	{ 59233, 37226, 34568,  210, 88, 216,  78, 93 },
-	{ 63272, 41178, 34201,  182, 63, 223,  110, 62 },
-	{ 59233, 37226, 34568,  210, 88, 216,  78, 93 },
-	{ 57952, 37677, 35168,  128, 151, 252,  68, 89 },
-	{ 57952, 37677, 35168,  128, 151, 252,  68, 89 },
-	{ 61170, 41178, 34679,  126, 158, 251,  93, 62 },
-	{ 63272, 41178, 34201,  182, 63, 223,  110, 62 },
-	{ 55196, 26124, 32767,  213, 33, 127,  47, 179 },
-	{ 47916, 22827, 32767,  179, 11, 127,  246, 205 },
-	{ 47916, 24141, 36552,  171, 35, 203,  246, 195 },
-	{ 47916, 24141, 36552,  171, 35, 203,  246, 195 },
-	{ 54823, 27099, 36185,  200, 55, 202,  44, 172 },
-	{ 55196, 26124, 32767,  213, 33, 127,  47, 179 },
-	{ 57984, 31429, 32767,  245, 78, 126,  69, 138 },
-	{ 55196, 26124, 32767,  213, 33, 127,  47, 179 },
-	{ 54823, 27099, 36185,  200, 55, 202,  44, 172 },
-	{ 54823, 27099, 36185,  200, 55, 202,  44, 172 },
-	{ 57506, 31996, 35376,  227, 94, 198,  65, 134 },
-	{ 57984, 31429, 32767,  245, 78, 126,  69, 138 },
-	{ 59816, 37020, 32767,  235, 59, 125,  83, 94 },
-	{ 57984, 31429, 32767,  245, 78, 126,  69, 138 },
-	{ 57506, 31996, 35376,  227, 94, 198,  65, 134 },
-	{ 57506, 31996, 35376,  227, 94, 198,  65, 134 },
-	{ 59233, 37226, 34568,  210, 88, 216,  78, 93 },
-	{ 59816, 37020, 32767,  235, 59, 125,  83, 94 },
-	{ 64228, 41178, 32767,  195, 19, 126,  117, 62 },
-	{ 59816, 37020, 32767,  235, 59, 125,  83, 94 },
-	{ 59233, 37226, 34568,  210, 88, 216,  78, 93 },
-	{ 59233, 37226, 34568,  210, 88, 216,  78, 93 },
-	{ 63272, 41178, 34201,  182, 63, 223,  110, 62 },
-	{ 64228, 41178, 32767,  195, 19, 126,  117, 62 },
-	{ 54823, 27099, 29349,  201, 55, 52,  44, 172 },
-	{ 47916, 24141, 28982,  171, 35, 50,  246, 195 },
-	{ 47916, 22827, 32767,  179, 11, 127,  246, 205 },
-	{ 47916, 22827, 32767,  179, 11, 127,  246, 205 },
-	{ 55196, 26124, 32767,  213, 33, 127,  47, 179 },
-	{ 54823, 27099, 29349,  201, 55, 52,  44, 172 },
-	{ 57506, 31996, 30158,  227, 95, 55,  65, 134 },
-	{ 54823, 27099, 29349,  201, 55, 52,  44, 172 },
-	{ 55196, 26124, 32767,  213, 33, 127,  47, 179 },
-	{ 55196, 26124, 32767,  213, 33, 127,  47, 179 },
-	{ 57984, 31429, 32767,  245, 78, 126,  69, 138 },
-	{ 57506, 31996, 30158,  227, 95, 55,  65, 134 },
-	{ 59233, 37226, 30966,  209, 88, 37,  78, 93 },
-	{ 57506, 31996, 30158,  227, 95, 55,  65, 134 },
-	{ 57984, 31429, 32767,  245, 78, 126,  69, 138 },
-	{ 57984, 31429, 32767,  245, 78, 126,  69, 138 },
-	{ 59816, 37020, 32767,  235, 59, 125,  83, 94 },
-	{ 59233, 37226, 30966,  209, 88, 37,  78, 93 },
-	{ 63272, 41178, 31333,  180, 63, 30,  110, 62 },
-	{ 59233, 37226, 30966,  209, 88, 37,  78, 93 },
-	{ 59816, 37020, 32767,  235, 59, 125,  83, 94 },
-	{ 59816, 37020, 32767,  235, 59, 125,  83, 94 },
-	{ 64228, 41178, 32767,  195, 19, 126,  117, 62 },
-	{ 63272, 41178, 31333,  180, 63, 30,  110, 62 },
-	{ 54001, 29243, 28210,  157, 129, 3,  37, 155 },
-	{ 47916, 27032, 27720,  142, 117, 1,  246, 172 },
-	{ 47916, 24141, 28982,  171, 35, 50,  246, 195 },
-	{ 47916, 24141, 28982,  171, 35, 50,  246, 195 },
-	{ 54823, 27099, 29349,  201, 55, 52,  44, 172 },
-	{ 54001, 29243, 28210,  157, 129, 3,  37, 155 },
-	{ 56455, 33245, 29288,  153, 147, 4,  57, 124 },
-	{ 54001, 29243, 28210,  157, 129, 3,  37, 155 },
-	{ 54823, 27099, 29349,  201, 55, 52,  44, 172 },
-	{ 54823, 27099, 29349,  201, 55, 52,  44, 172 },
-	{ 57506, 31996, 30158,  227, 95, 55,  65, 134 },
-	{ 56455, 33245, 29288,  153, 147, 4,  57, 124 },
-	{ 57952, 37677, 30366,  130, 148, 1,  68, 89 },
-	{ 56455, 33245, 29288,  153, 147, 4,  57, 124 },
-	{ 57506, 31996, 30158,  227, 95, 55,  65, 134 },
-	{ 57506, 31996, 30158,  227, 95, 55,  65, 134 },
-	{ 59233, 37226, 30966,  209, 88, 37,  78, 93 },
-	{ 57952, 37677, 30366,  130, 148, 1,  68, 89 },
-	{ 61170, 41178, 30855,  127, 154, 2,  93, 62 },
-	{ 57952, 37677, 30366,  130, 148, 1,  68, 89 },
-	{ 59233, 37226, 30966,  209, 88, 37,  78, 93 },
-	{ 59233, 37226, 30966,  209, 88, 37,  78, 93 },
-	{ 63272, 41178, 31333,  180, 63, 30,  110, 62 },
-	{ 61170, 41178, 30855,  127, 154, 2,  93, 62 },
-	{ 53180, 31386, 29349,  86, 208, 37,  31, 138 },
-	{ 47916, 29924, 28982,  110, 215, 36,  246, 150 },
-	{ 47916, 27032, 27720,  142, 117, 1,  246, 172 },
-	{ 47916, 27032, 27720,  142, 117, 1,  246, 172 },
-	{ 54001, 29243, 28210,  157, 129, 3,  37, 155 },
-	{ 53180, 31386, 29349,  86, 208, 37,  31, 138 },
-	{ 55403, 34493, 30158,  50, 186, 44,  48, 114 },
-	{ 53180, 31386, 29349,  86, 208, 37,  31, 138 },
-	{ 54001, 29243, 28210,  157, 129, 3,  37, 155 },
-	{ 54001, 29243, 28210,  157, 129, 3,  37, 155 },
-	{ 56455, 33245, 29288,  153, 147, 4,  57, 124 },
-	{ 55403, 34493, 30158,  50, 186, 44,  48, 114 },
-	{ 56671, 38129, 30966,  46, 183, 45,  58, 86 },
-	{ 55403, 34493, 30158,  50, 186, 44,  48, 114 },
-	{ 56455, 33245, 29288,  153, 147, 4,  57, 124 },
-	{ 56455, 33245, 29288,  153, 147, 4,  57, 124 },
-	{ 57952, 37677, 30366,  130, 148, 1,  68, 89 },
-	{ 56671, 38129, 30966,  46, 183, 45,  58, 86 },
-	{ 59067, 41178, 31333,  73, 205, 42,  77, 62 },
-	{ 56671, 38129, 30966,  46, 183, 45,  58, 86 },
-	{ 57952, 37677, 30366,  130, 148, 1,  68, 89 },
-	{ 57952, 37677, 30366,  130, 148, 1,  68, 89 },
-	{ 61170, 41178, 30855,  127, 154, 2,  93, 62 },
-	{ 59067, 41178, 31333,  73, 205, 42,  77, 62 },
-	{ 52807, 32361, 32767,  57, 234, 127,  28, 131 },
-	{ 47916, 31238, 32767,  98, 251, 126,  246, 139 },
-	{ 47916, 29924, 28982,  110, 215, 36,  246, 150 },
-	{ 47916, 29924, 28982,  110, 215, 36,  246, 150 },
-	{ 53180, 31386, 29349,  86, 208, 37,  31, 138 },
-	{ 52807, 32361, 32767,  57, 234, 127,  28, 131 },
-	{ 54925, 35061, 32767,  15, 189, 128,  45, 110 },
-	{ 52807, 32361, 32767,  57, 234, 127,  28, 131 },
-	{ 53180, 31386, 29349,  86, 208, 37,  31, 138 },
-	{ 53180, 31386, 29349,  86, 208, 37,  31, 138 },
-	{ 55403, 34493, 30158,  50, 186, 44,  48, 114 },
-	{ 54925, 35061, 32767,  15, 189, 128,  45, 110 },
-	{ 56088, 38334, 32767,  15, 188, 129,  54, 84 },
-	{ 54925, 35061, 32767,  15, 189, 128,  45, 110 },
-	{ 55403, 34493, 30158,  50, 186, 44,  48, 114 },
-	{ 55403, 34493, 30158,  50, 186, 44,  48, 114 },
-	{ 56671, 38129, 30966,  46, 183, 45,  58, 86 },
-	{ 56088, 38334, 32767,  15, 188, 129,  54, 84 },
-	{ 58111, 41178, 32767,  38, 218, 130,  69, 62 },
-	{ 56088, 38334, 32767,  15, 188, 129,  54, 84 },
-	{ 56671, 38129, 30966,  46, 183, 45,  58, 86 },
-	{ 56671, 38129, 30966,  46, 183, 45,  58, 86 },
-	{ 59067, 41178, 31333,  73, 205, 42,  77, 62 },
-	{ 58111, 41178, 32767,  38, 218, 130,  69, 62 },
-	{ 59868, 41629, 34111,  94, 228, 197,  83, 58 },
-	{ 59067, 41178, 34201,  71, 204, 212,  77, 62 },
-	{ 58111, 41178, 32767,  38, 218, 130,  69, 62 },
-	{ 58111, 41178, 32767,  38, 218, 130,  69, 62 },
-	{ 58844, 41608, 32767,  73, 242, 128,  75, 58 },
-	{ 59868, 41629, 34111,  94, 228, 197,  83, 58 },
-	{ 60346, 41785, 33914,  128, 254, 124,  87, 57 },
-	{ 59868, 41629, 34111,  94, 228, 197,  83, 58 },
-	{ 58844, 41608, 32767,  73, 242, 128,  75, 58 },
-	{ 58844, 41608, 32767,  73, 242, 128,  75, 58 },
-	{ 59386, 41751, 32767,  130, 254, 127,  79, 57 },
-	{ 60346, 41785, 33914,  128, 254, 124,  87, 57 },
-	{ 60361, 41637, 33717,  179, 169, 19,  87, 58 },
-	{ 60346, 41785, 33914,  128, 254, 124,  87, 57 },
-	{ 59386, 41751, 32767,  130, 254, 127,  79, 57 },
-	{ 59386, 41751, 32767,  130, 254, 127,  79, 57 },
-	{ 59545, 41608, 32767,  254, 130, 128,  81, 58 },
-	{ 60361, 41637, 33717,  179, 169, 19,  87, 58 },
-	{ 59768, 41178, 33627,  196, 57, 46,  82, 62 },
-	{ 60361, 41637, 33717,  179, 169, 19,  87, 58 },
-	{ 59545, 41608, 32767,  254, 130, 128,  81, 58 },
-	{ 59545, 41608, 32767,  254, 130, 128,  81, 58 },
-	{ 59131, 41178, 32767,  217, 37, 128,  77, 62 },
-	{ 59768, 41178, 33627,  196, 57, 46,  82, 62 },
-	{ 62120, 41675, 34559,  133, 185, 240,  101, 58 },
-	{ 61170, 41178, 34679,  126, 158, 251,  93, 62 },
-	{ 59067, 41178, 34201,  71, 204, 212,  77, 62 },
-	{ 59067, 41178, 34201,  71, 204, 212,  77, 62 },
-	{ 59868, 41629, 34111,  94, 228, 197,  83, 58 },
-	{ 62120, 41675, 34559,  133, 185, 240,  101, 58 },
-	{ 62460, 41859, 34296,  126, 253, 146,  103, 56 },
-	{ 62120, 41675, 34559,  133, 185, 240,  101, 58 },
-	{ 59868, 41629, 34111,  94, 228, 197,  83, 58 },
-	{ 59868, 41629, 34111,  94, 228, 197,  83, 58 },
-	{ 60346, 41785, 33914,  128, 254, 124,  87, 57 },
-	{ 62460, 41859, 34296,  126, 253, 146,  103, 56 },
-	{ 62155, 41702, 34033,  121, 214, 34,  101, 58 },
-	{ 62460, 41859, 34296,  126, 253, 146,  103, 56 },
-	{ 60346, 41785, 33914,  128, 254, 124,  87, 57 },
-	{ 60346, 41785, 33914,  128, 254, 124,  87, 57 },
-	{ 60361, 41637, 33717,  179, 169, 19,  87, 58 },
-	{ 62155, 41702, 34033,  121, 214, 34,  101, 58 },
-	{ 61170, 41178, 33914,  143, 128, 0,  93, 62 },
-	{ 62155, 41702, 34033,  121, 214, 34,  101, 58 },
-	{ 60361, 41637, 33717,  179, 169, 19,  87, 58 },
-	{ 60361, 41637, 33717,  179, 169, 19,  87, 58 },
-	{ 59768, 41178, 33627,  196, 57, 46,  82, 62 },
-	{ 61170, 41178, 33914,  143, 128, 0,  93, 62 },
-	{ 64372, 41721, 34111,  188, 104, 236,  118, 58 },
-	{ 63272, 41178, 34201,  182, 63, 223,  110, 62 },
-	{ 61170, 41178, 34679,  126, 158, 251,  93, 62 },
-	{ 61170, 41178, 34679,  126, 158, 251,  93, 62 },
-	{ 62120, 41675, 34559,  133, 185, 240,  101, 58 },
-	{ 64372, 41721, 34111,  188, 104, 236,  118, 58 },
-	{ 64574, 41933, 33914,  185, 221, 191,  120, 56 },
-	{ 64372, 41721, 34111,  188, 104, 236,  118, 58 },
-	{ 62120, 41675, 34559,  133, 185, 240,  101, 58 },
-	{ 62120, 41675, 34559,  133, 185, 240,  101, 58 },
-	{ 62460, 41859, 34296,  126, 253, 146,  103, 56 },
-	{ 64574, 41933, 33914,  185, 221, 191,  120, 56 },
-	{ 63950, 41767, 33717,  99, 243, 81,  115, 57 },
-	{ 64574, 41933, 33914,  185, 221, 191,  120, 56 },
-	{ 62460, 41859, 34296,  126, 253, 146,  103, 56 },
-	{ 62460, 41859, 34296,  126, 253, 146,  103, 56 },
-	{ 62155, 41702, 34033,  121, 214, 34,  101, 58 },
-	{ 63950, 41767, 33717,  99, 243, 81,  115, 57 },
-	{ 62572, 41178, 33627,  97, 211, 36,  104, 62 },
-	{ 63950, 41767, 33717,  99, 243, 81,  115, 57 },
-	{ 62155, 41702, 34033,  121, 214, 34,  101, 58 },
-	{ 62155, 41702, 34033,  121, 214, 34,  101, 58 },
-	{ 61170, 41178, 33914,  143, 128, 0,  93, 62 },
-	{ 62572, 41178, 33627,  97, 211, 36,  104, 62 },
-	{ 65395, 41742, 32767,  220, 40, 125,  126, 57 },
-	{ 64228, 41178, 32767,  195, 19, 126,  117, 62 },
-	{ 63272, 41178, 34201,  182, 63, 223,  110, 62 },
-	{ 63272, 41178, 34201,  182, 63, 223,  110, 62 },
-	{ 64372, 41721, 34111,  188, 104, 236,  118, 58 },
-	{ 65395, 41742, 32767,  220, 40, 125,  126, 57 },
-	{ 65535, 41966, 32767,  240, 185, 125,  127, 56 },
-	{ 65395, 41742, 32767,  220, 40, 125,  126, 57 },
-	{ 64372, 41721, 34111,  188, 104, 236,  118, 58 },
-	{ 64372, 41721, 34111,  188, 104, 236,  118, 58 },
-	{ 64574, 41933, 33914,  185, 221, 191,  120, 56 },
-	{ 65535, 41966, 32767,  240, 185, 125,  127, 56 },
-	{ 64766, 41796, 32767,  94, 250, 127,  121, 57 },
-	{ 65535, 41966, 32767,  240, 185, 125,  127, 56 },
-	{ 64574, 41933, 33914,  185, 221, 191,  120, 56 },
-	{ 64574, 41933, 33914,  185, 221, 191,  120, 56 },
-	{ 63950, 41767, 33717,  99, 243, 81,  115, 57 },
-	{ 64766, 41796, 32767,  94, 250, 127,  121, 57 },
-	{ 63209, 41178, 32767,  80, 245, 126,  109, 62 },
-	{ 64766, 41796, 32767,  94, 250, 127,  121, 57 },
-	{ 63950, 41767, 33717,  99, 243, 81,  115, 57 },
-	{ 63950, 41767, 33717,  99, 243, 81,  115, 57 },
-	{ 62572, 41178, 33627,  97, 211, 36,  104, 62 },
-	{ 63209, 41178, 32767,  80, 245, 126,  109, 62 },
-	{ 64372, 41721, 31423,  188, 104, 17,  118, 58 },
-	{ 63272, 41178, 31333,  180, 63, 30,  110, 62 },
-	{ 64228, 41178, 32767,  195, 19, 126,  117, 62 },
-	{ 64228, 41178, 32767,  195, 19, 126,  117, 62 },
-	{ 65395, 41742, 32767,  220, 40, 125,  126, 57 },
-	{ 64372, 41721, 31423,  188, 104, 17,  118, 58 },
-	{ 64574, 41933, 31620,  189, 218, 64,  120, 56 },
-	{ 64372, 41721, 31423,  188, 104, 17,  118, 58 },
-	{ 65395, 41742, 32767,  220, 40, 125,  126, 57 },
-	{ 65395, 41742, 32767,  220, 40, 125,  126, 57 },
-	{ 65535, 41966, 32767,  240, 185, 125,  127, 56 },
-	{ 64574, 41933, 31620,  189, 218, 64,  120, 56 },
-	{ 63950, 41767, 31817,  99, 242, 173,  115, 57 },
-	{ 64574, 41933, 31620,  189, 218, 64,  120, 56 },
-	{ 65535, 41966, 32767,  240, 185, 125,  127, 56 },
-	{ 65535, 41966, 32767,  240, 185, 125,  127, 56 },
-	{ 64766, 41796, 32767,  94, 250, 127,  121, 57 },
-	{ 63950, 41767, 31817,  99, 242, 173,  115, 57 },
-	{ 62572, 41178, 31907,  97, 212, 218,  104, 62 },
-	{ 63950, 41767, 31817,  99, 242, 173,  115, 57 },
-	{ 64766, 41796, 32767,  94, 250, 127,  121, 57 },
-	{ 64766, 41796, 32767,  94, 250, 127,  121, 57 },
-	{ 63209, 41178, 32767,  80, 245, 126,  109, 62 },
-	{ 62572, 41178, 31907,  97, 212, 218,  104, 62 },
-	{ 62120, 41675, 30975,  134, 183, 13,  101, 58 },
-	{ 61170, 41178, 30855,  127, 154, 2,  93, 62 },
-	{ 63272, 41178, 31333,  180, 63, 30,  110, 62 },
-	{ 63272, 41178, 31333,  180, 63, 30,  110, 62 },
-	{ 64372, 41721, 31423,  188, 104, 17,  118, 58 },
-	{ 62120, 41675, 30975,  134, 183, 13,  101, 58 },
-	{ 62460, 41859, 31238,  127, 253, 106,  103, 56 },
-	{ 62120, 41675, 30975,  134, 183, 13,  101, 58 },
-	{ 64372, 41721, 31423,  188, 104, 17,  118, 58 },
-	{ 64372, 41721, 31423,  188, 104, 17,  118, 58 },
-	{ 64574, 41933, 31620,  189, 218, 64,  120, 56 },
-	{ 62460, 41859, 31238,  127, 253, 106,  103, 56 },
-	{ 62155, 41702, 31501,  121, 214, 220,  101, 58 },
-	{ 62460, 41859, 31238,  127, 253, 106,  103, 56 },
-	{ 64574, 41933, 31620,  189, 218, 64,  120, 56 },
-	{ 64574, 41933, 31620,  189, 218, 64,  120, 56 },
-	{ 63950, 41767, 31817,  99, 242, 173,  115, 57 },
-	{ 62155, 41702, 31501,  121, 214, 220,  101, 58 },
-	{ 61170, 41178, 31620,  145, 123, 253,  93, 62 },
-	{ 62155, 41702, 31501,  121, 214, 220,  101, 58 },
-	{ 63950, 41767, 31817,  99, 242, 173,  115, 57 },
-	{ 63950, 41767, 31817,  99, 242, 173,  115, 57 },
-	{ 62572, 41178, 31907,  97, 212, 218,  104, 62 },
-	{ 61170, 41178, 31620,  145, 123, 253,  93, 62 },
-	{ 59868, 41629, 31423,  94, 229, 57,  83, 58 },
-	{ 59067, 41178, 31333,  73, 205, 42,  77, 62 },
-	{ 61170, 41178, 30855,  127, 154, 2,  93, 62 },
-	{ 61170, 41178, 30855,  127, 154, 2,  93, 62 },
-	{ 62120, 41675, 30975,  134, 183, 13,  101, 58 },
-	{ 59868, 41629, 31423,  94, 229, 57,  83, 58 },
-	{ 60346, 41785, 31620,  129, 254, 129,  87, 57 },
-	{ 59868, 41629, 31423,  94, 229, 57,  83, 58 },
-	{ 62120, 41675, 30975,  134, 183, 13,  101, 58 },
-	{ 62120, 41675, 30975,  134, 183, 13,  101, 58 },
-	{ 62460, 41859, 31238,  127, 253, 106,  103, 56 },
-	{ 60346, 41785, 31620,  129, 254, 129,  87, 57 },
-	{ 60361, 41637, 31817,  178, 172, 235,  87, 58 },
-	{ 60346, 41785, 31620,  129, 254, 129,  87, 57 },
-	{ 62460, 41859, 31238,  127, 253, 106,  103, 56 },
-	{ 62460, 41859, 31238,  127, 253, 106,  103, 56 },
-	{ 62155, 41702, 31501,  121, 214, 220,  101, 58 },
-	{ 60361, 41637, 31817,  178, 172, 235,  87, 58 },
-	{ 59768, 41178, 31907,  196, 53, 205,  82, 62 },
-	{ 60361, 41637, 31817,  178, 172, 235,  87, 58 },
-	{ 62155, 41702, 31501,  121, 214, 220,  101, 58 },
-	{ 62155, 41702, 31501,  121, 214, 220,  101, 58 },
-	{ 61170, 41178, 31620,  145, 123, 253,  93, 62 },
-	{ 59768, 41178, 31907,  196, 53, 205,  82, 62 },
-	{ 58844, 41608, 32767,  73, 242, 128,  75, 58 },
-	{ 58111, 41178, 32767,  38, 218, 130,  69, 62 },
-	{ 59067, 41178, 31333,  73, 205, 42,  77, 62 },
-	{ 59067, 41178, 31333,  73, 205, 42,  77, 62 },
-	{ 59868, 41629, 31423,  94, 229, 57,  83, 58 },
-	{ 58844, 41608, 32767,  73, 242, 128,  75, 58 },
-	{ 59386, 41751, 32767,  130, 254, 127,  79, 57 },
-	{ 58844, 41608, 32767,  73, 242, 128,  75, 58 },
-	{ 59868, 41629, 31423,  94, 229, 57,  83, 58 },
-	{ 59868, 41629, 31423,  94, 229, 57,  83, 58 },
-	{ 60346, 41785, 31620,  129, 254, 129,  87, 57 },
-	{ 59386, 41751, 32767,  130, 254, 127,  79, 57 },
-	{ 59545, 41608, 32767,  254, 130, 128,  81, 58 },
-	{ 59386, 41751, 32767,  130, 254, 127,  79, 57 },
-	{ 60346, 41785, 31620,  129, 254, 129,  87, 57 },
-	{ 60346, 41785, 31620,  129, 254, 129,  87, 57 },
-	{ 60361, 41637, 31817,  178, 172, 235,  87, 58 },
-	{ 59545, 41608, 32767,  254, 130, 128,  81, 58 },
-	{ 59131, 41178, 32767,  217, 37, 128,  77, 62 },
-	{ 59545, 41608, 32767,  254, 130, 128,  81, 58 },
-	{ 60361, 41637, 31817,  178, 172, 235,  87, 58 },
-	{ 60361, 41637, 31817,  178, 172, 235,  87, 58 },
-	{ 59768, 41178, 31907,  196, 53, 205,  82, 62 },
-	{ 59131, 41178, 32767,  217, 37, 128,  77, 62 },
-	{ 33789, 48322, 34134,  224, 199, 167,  135, 6 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 34057, 48322, 32767,  232, 199, 127,  138, 6 },
-	{ 33789, 48322, 34134,  224, 199, 167,  135, 6 },
-	{ 33642, 47104, 34071,  235, 76, 172,  134, 15 },
-	{ 33789, 48322, 34134,  224, 199, 167,  135, 6 },
-	{ 34057, 48322, 32767,  232, 199, 127,  138, 6 },
-	{ 34057, 48322, 32767,  232, 199, 127,  138, 6 },
-	{ 33898, 47104, 32767,  244, 76, 127,  136, 15 },
-	{ 33642, 47104, 34071,  235, 76, 172,  134, 15 },
-	{ 32437, 45598, 33556,  237, 82, 172,  125, 27 },
-	{ 33642, 47104, 34071,  235, 76, 172,  134, 15 },
-	{ 33898, 47104, 32767,  244, 76, 127,  136, 15 },
-	{ 33898, 47104, 32767,  244, 76, 127,  136, 15 },
-	{ 32592, 45598, 32767,  246, 82, 127,  126, 27 },
-	{ 32437, 45598, 33556,  237, 82, 172,  125, 27 },
-	{ 32466, 44236, 33567,  219, 207, 165,  125, 38 },
-	{ 32437, 45598, 33556,  237, 82, 172,  125, 27 },
-	{ 32592, 45598, 32767,  246, 82, 127,  126, 27 },
-	{ 32592, 45598, 32767,  246, 82, 127,  126, 27 },
-	{ 32624, 44236, 32767,  227, 207, 127,  126, 38 },
-	{ 32466, 44236, 33567,  219, 207, 165,  125, 38 },
-	{ 33053, 48322, 35236,  201, 199, 201,  130, 6 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 33789, 48322, 34134,  224, 199, 167,  135, 6 },
-	{ 33053, 48322, 35236,  201, 199, 201,  130, 6 },
-	{ 32940, 47104, 35122,  210, 76, 210,  129, 15 },
-	{ 33053, 48322, 35236,  201, 199, 201,  130, 6 },
-	{ 33789, 48322, 34134,  224, 199, 167,  135, 6 },
-	{ 33789, 48322, 34134,  224, 199, 167,  135, 6 },
-	{ 33642, 47104, 34071,  235, 76, 172,  134, 15 },
-	{ 32940, 47104, 35122,  210, 76, 210,  129, 15 },
-	{ 32011, 45598, 34193,  211, 82, 211,  122, 27 },
-	{ 32940, 47104, 35122,  210, 76, 210,  129, 15 },
-	{ 33642, 47104, 34071,  235, 76, 172,  134, 15 },
-	{ 33642, 47104, 34071,  235, 76, 172,  134, 15 },
-	{ 32437, 45598, 33556,  237, 82, 172,  125, 27 },
-	{ 32011, 45598, 34193,  211, 82, 211,  122, 27 },
-	{ 32032, 44236, 34215,  197, 207, 197,  122, 38 },
-	{ 32011, 45598, 34193,  211, 82, 211,  122, 27 },
-	{ 32437, 45598, 33556,  237, 82, 172,  125, 27 },
-	{ 32437, 45598, 33556,  237, 82, 172,  125, 27 },
-	{ 32466, 44236, 33567,  219, 207, 165,  125, 38 },
-	{ 32032, 44236, 34215,  197, 207, 197,  122, 38 },
-	{ 31951, 48322, 35972,  167, 199, 224,  121, 6 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 33053, 48322, 35236,  201, 199, 201,  130, 6 },
-	{ 31951, 48322, 35972,  167, 199, 224,  121, 6 },
-	{ 31888, 47104, 35825,  172, 76, 235,  121, 15 },
-	{ 31951, 48322, 35972,  167, 199, 224,  121, 6 },
-	{ 33053, 48322, 35236,  201, 199, 201,  130, 6 },
-	{ 33053, 48322, 35236,  201, 199, 201,  130, 6 },
-	{ 32940, 47104, 35122,  210, 76, 210,  129, 15 },
-	{ 31888, 47104, 35825,  172, 76, 235,  121, 15 },
-	{ 31374, 45598, 34619,  172, 82, 237,  117, 27 },
-	{ 31888, 47104, 35825,  172, 76, 235,  121, 15 },
-	{ 32940, 47104, 35122,  210, 76, 210,  129, 15 },
-	{ 32940, 47104, 35122,  210, 76, 210,  129, 15 },
-	{ 32011, 45598, 34193,  211, 82, 211,  122, 27 },
-	{ 31374, 45598, 34619,  172, 82, 237,  117, 27 },
-	{ 31385, 44236, 34648,  165, 207, 219,  117, 38 },
-	{ 31374, 45598, 34619,  172, 82, 237,  117, 27 },
-	{ 32011, 45598, 34193,  211, 82, 211,  122, 27 },
-	{ 32011, 45598, 34193,  211, 82, 211,  122, 27 },
-	{ 32032, 44236, 34215,  197, 207, 197,  122, 38 },
-	{ 31385, 44236, 34648,  165, 207, 219,  117, 38 },
-	{ 30585, 48322, 36240,  127, 199, 232,  110, 6 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 31951, 48322, 35972,  167, 199, 224,  121, 6 },
-	{ 30585, 48322, 36240,  127, 199, 232,  110, 6 },
-	{ 30585, 47104, 36080,  127, 76, 244,  110, 15 },
-	{ 30585, 48322, 36240,  127, 199, 232,  110, 6 },
-	{ 31951, 48322, 35972,  167, 199, 224,  121, 6 },
-	{ 31951, 48322, 35972,  167, 199, 224,  121, 6 },
-	{ 31888, 47104, 35825,  172, 76, 235,  121, 15 },
-	{ 30585, 47104, 36080,  127, 76, 244,  110, 15 },
-	{ 30585, 45598, 34774,  127, 82, 246,  110, 27 },
-	{ 30585, 47104, 36080,  127, 76, 244,  110, 15 },
-	{ 31888, 47104, 35825,  172, 76, 235,  121, 15 },
-	{ 31888, 47104, 35825,  172, 76, 235,  121, 15 },
-	{ 31374, 45598, 34619,  172, 82, 237,  117, 27 },
-	{ 30585, 45598, 34774,  127, 82, 246,  110, 27 },
-	{ 30585, 44236, 34806,  127, 207, 227,  110, 38 },
-	{ 30585, 45598, 34774,  127, 82, 246,  110, 27 },
-	{ 31374, 45598, 34619,  172, 82, 237,  117, 27 },
-	{ 31374, 45598, 34619,  172, 82, 237,  117, 27 },
-	{ 31385, 44236, 34648,  165, 207, 219,  117, 38 },
-	{ 30585, 44236, 34806,  127, 207, 227,  110, 38 },
-	{ 29218, 48322, 35972,  87, 199, 224,  100, 6 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 30585, 48322, 36240,  127, 199, 232,  110, 6 },
-	{ 29218, 48322, 35972,  87, 199, 224,  100, 6 },
-	{ 29281, 47104, 35825,  82, 76, 235,  100, 15 },
-	{ 29218, 48322, 35972,  87, 199, 224,  100, 6 },
-	{ 30585, 48322, 36240,  127, 199, 232,  110, 6 },
-	{ 30585, 48322, 36240,  127, 199, 232,  110, 6 },
-	{ 30585, 47104, 36080,  127, 76, 244,  110, 15 },
-	{ 29281, 47104, 35825,  82, 76, 235,  100, 15 },
-	{ 29796, 45598, 34619,  82, 82, 237,  104, 27 },
-	{ 29281, 47104, 35825,  82, 76, 235,  100, 15 },
-	{ 30585, 47104, 36080,  127, 76, 244,  110, 15 },
-	{ 30585, 47104, 36080,  127, 76, 244,  110, 15 },
-	{ 30585, 45598, 34774,  127, 82, 246,  110, 27 },
-	{ 29796, 45598, 34619,  82, 82, 237,  104, 27 },
-	{ 29784, 44236, 34648,  89, 207, 219,  104, 38 },
-	{ 29796, 45598, 34619,  82, 82, 237,  104, 27 },
-	{ 30585, 45598, 34774,  127, 82, 246,  110, 27 },
-	{ 30585, 45598, 34774,  127, 82, 246,  110, 27 },
-	{ 30585, 44236, 34806,  127, 207, 227,  110, 38 },
-	{ 29784, 44236, 34648,  89, 207, 219,  104, 38 },
-	{ 28116, 48322, 35236,  53, 199, 201,  91, 6 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 29218, 48322, 35972,  87, 199, 224,  100, 6 },
-	{ 28116, 48322, 35236,  53, 199, 201,  91, 6 },
-	{ 28229, 47104, 35122,  44, 76, 210,  92, 15 },
-	{ 28116, 48322, 35236,  53, 199, 201,  91, 6 },
-	{ 29218, 48322, 35972,  87, 199, 224,  100, 6 },
-	{ 29218, 48322, 35972,  87, 199, 224,  100, 6 },
-	{ 29281, 47104, 35825,  82, 76, 235,  100, 15 },
-	{ 28229, 47104, 35122,  44, 76, 210,  92, 15 },
-	{ 29158, 45598, 34193,  43, 82, 211,  99, 27 },
-	{ 28229, 47104, 35122,  44, 76, 210,  92, 15 },
-	{ 29281, 47104, 35825,  82, 76, 235,  100, 15 },
-	{ 29281, 47104, 35825,  82, 76, 235,  100, 15 },
-	{ 29796, 45598, 34619,  82, 82, 237,  104, 27 },
-	{ 29158, 45598, 34193,  43, 82, 211,  99, 27 },
-	{ 29137, 44236, 34215,  57, 207, 197,  99, 38 },
-	{ 29158, 45598, 34193,  43, 82, 211,  99, 27 },
-	{ 29796, 45598, 34619,  82, 82, 237,  104, 27 },
-	{ 29796, 45598, 34619,  82, 82, 237,  104, 27 },
-	{ 29784, 44236, 34648,  89, 207, 219,  104, 38 },
-	{ 29137, 44236, 34215,  57, 207, 197,  99, 38 },
-	{ 27380, 48322, 34134,  30, 199, 167,  85, 6 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 28116, 48322, 35236,  53, 199, 201,  91, 6 },
-	{ 27380, 48322, 34134,  30, 199, 167,  85, 6 },
-	{ 27527, 47104, 34071,  19, 76, 172,  87, 15 },
-	{ 27380, 48322, 34134,  30, 199, 167,  85, 6 },
-	{ 28116, 48322, 35236,  53, 199, 201,  91, 6 },
-	{ 28116, 48322, 35236,  53, 199, 201,  91, 6 },
-	{ 28229, 47104, 35122,  44, 76, 210,  92, 15 },
-	{ 27527, 47104, 34071,  19, 76, 172,  87, 15 },
-	{ 28733, 45598, 33556,  17, 82, 172,  96, 27 },
-	{ 27527, 47104, 34071,  19, 76, 172,  87, 15 },
-	{ 28229, 47104, 35122,  44, 76, 210,  92, 15 },
-	{ 28229, 47104, 35122,  44, 76, 210,  92, 15 },
-	{ 29158, 45598, 34193,  43, 82, 211,  99, 27 },
-	{ 28733, 45598, 33556,  17, 82, 172,  96, 27 },
-	{ 28704, 44236, 33567,  35, 207, 165,  96, 38 },
-	{ 28733, 45598, 33556,  17, 82, 172,  96, 27 },
-	{ 29158, 45598, 34193,  43, 82, 211,  99, 27 },
-	{ 29158, 45598, 34193,  43, 82, 211,  99, 27 },
-	{ 29137, 44236, 34215,  57, 207, 197,  99, 38 },
-	{ 28704, 44236, 33567,  35, 207, 165,  96, 38 },
-	{ 27112, 48322, 32767,  22, 199, 127,  83, 6 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 27380, 48322, 34134,  30, 199, 167,  85, 6 },
-	{ 27112, 48322, 32767,  22, 199, 127,  83, 6 },
-	{ 27271, 47104, 32767,  10, 76, 127,  85, 15 },
-	{ 27112, 48322, 32767,  22, 199, 127,  83, 6 },
-	{ 27380, 48322, 34134,  30, 199, 167,  85, 6 },
-	{ 27380, 48322, 34134,  30, 199, 167,  85, 6 },
-	{ 27527, 47104, 34071,  19, 76, 172,  87, 15 },
-	{ 27271, 47104, 32767,  10, 76, 127,  85, 15 },
-	{ 28577, 45598, 32767,  8, 82, 127,  95, 27 },
-	{ 27271, 47104, 32767,  10, 76, 127,  85, 15 },
-	{ 27527, 47104, 34071,  19, 76, 172,  87, 15 },
-	{ 27527, 47104, 34071,  19, 76, 172,  87, 15 },
-	{ 28733, 45598, 33556,  17, 82, 172,  96, 27 },
-	{ 28577, 45598, 32767,  8, 82, 127,  95, 27 },
-	{ 28546, 44236, 32767,  27, 207, 127,  95, 38 },
-	{ 28577, 45598, 32767,  8, 82, 127,  95, 27 },
-	{ 28733, 45598, 33556,  17, 82, 172,  96, 27 },
-	{ 28733, 45598, 33556,  17, 82, 172,  96, 27 },
-	{ 28704, 44236, 33567,  35, 207, 165,  96, 38 },
-	{ 28546, 44236, 32767,  27, 207, 127,  95, 38 },
-	{ 27380, 48322, 31400,  30, 199, 87,  85, 6 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 27112, 48322, 32767,  22, 199, 127,  83, 6 },
-	{ 27380, 48322, 31400,  30, 199, 87,  85, 6 },
-	{ 27527, 47104, 31463,  19, 76, 82,  87, 15 },
-	{ 27380, 48322, 31400,  30, 199, 87,  85, 6 },
-	{ 27112, 48322, 32767,  22, 199, 127,  83, 6 },
-	{ 27112, 48322, 32767,  22, 199, 127,  83, 6 },
-	{ 27271, 47104, 32767,  10, 76, 127,  85, 15 },
-	{ 27527, 47104, 31463,  19, 76, 82,  87, 15 },
-	{ 28733, 45598, 31978,  17, 82, 82,  96, 27 },
-	{ 27527, 47104, 31463,  19, 76, 82,  87, 15 },
-	{ 27271, 47104, 32767,  10, 76, 127,  85, 15 },
-	{ 27271, 47104, 32767,  10, 76, 127,  85, 15 },
-	{ 28577, 45598, 32767,  8, 82, 127,  95, 27 },
-	{ 28733, 45598, 31978,  17, 82, 82,  96, 27 },
-	{ 28704, 44236, 31967,  35, 207, 89,  96, 38 },
-	{ 28733, 45598, 31978,  17, 82, 82,  96, 27 },
-	{ 28577, 45598, 32767,  8, 82, 127,  95, 27 },
-	{ 28577, 45598, 32767,  8, 82, 127,  95, 27 },
-	{ 28546, 44236, 32767,  27, 207, 127,  95, 38 },
-	{ 28704, 44236, 31967,  35, 207, 89,  96, 38 },
-	{ 28116, 48322, 30298,  53, 199, 53,  91, 6 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 27380, 48322, 31400,  30, 199, 87,  85, 6 },
-	{ 28116, 48322, 30298,  53, 199, 53,  91, 6 },
-	{ 28229, 47104, 30412,  44, 76, 44,  92, 15 },
-	{ 28116, 48322, 30298,  53, 199, 53,  91, 6 },
-	{ 27380, 48322, 31400,  30, 199, 87,  85, 6 },
-	{ 27380, 48322, 31400,  30, 199, 87,  85, 6 },
-	{ 27527, 47104, 31463,  19, 76, 82,  87, 15 },
-	{ 28229, 47104, 30412,  44, 76, 44,  92, 15 },
-	{ 29158, 45598, 31341,  43, 82, 43,  99, 27 },
-	{ 28229, 47104, 30412,  44, 76, 44,  92, 15 },
-	{ 27527, 47104, 31463,  19, 76, 82,  87, 15 },
-	{ 27527, 47104, 31463,  19, 76, 82,  87, 15 },
-	{ 28733, 45598, 31978,  17, 82, 82,  96, 27 },
-	{ 29158, 45598, 31341,  43, 82, 43,  99, 27 },
-	{ 29137, 44236, 31319,  57, 207, 57,  99, 38 },
-	{ 29158, 45598, 31341,  43, 82, 43,  99, 27 },
-	{ 28733, 45598, 31978,  17, 82, 82,  96, 27 },
-	{ 28733, 45598, 31978,  17, 82, 82,  96, 27 },
-	{ 28704, 44236, 31967,  35, 207, 89,  96, 38 },
-	{ 29137, 44236, 31319,  57, 207, 57,  99, 38 },
-	{ 29218, 48322, 29562,  87, 199, 30,  100, 6 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 28116, 48322, 30298,  53, 199, 53,  91, 6 },
-	{ 29218, 48322, 29562,  87, 199, 30,  100, 6 },
-	{ 29281, 47104, 29709,  82, 76, 19,  100, 15 },
-	{ 29218, 48322, 29562,  87, 199, 30,  100, 6 },
-	{ 28116, 48322, 30298,  53, 199, 53,  91, 6 },
-	{ 28116, 48322, 30298,  53, 199, 53,  91, 6 },
-	{ 28229, 47104, 30412,  44, 76, 44,  92, 15 },
-	{ 29281, 47104, 29709,  82, 76, 19,  100, 15 },
-	{ 29796, 45598, 30915,  82, 82, 17,  104, 27 },
-	{ 29281, 47104, 29709,  82, 76, 19,  100, 15 },
-	{ 28229, 47104, 30412,  44, 76, 44,  92, 15 },
-	{ 28229, 47104, 30412,  44, 76, 44,  92, 15 },
-	{ 29158, 45598, 31341,  43, 82, 43,  99, 27 },
-	{ 29796, 45598, 30915,  82, 82, 17,  104, 27 },
-	{ 29784, 44236, 30886,  89, 207, 35,  104, 38 },
-	{ 29796, 45598, 30915,  82, 82, 17,  104, 27 },
-	{ 29158, 45598, 31341,  43, 82, 43,  99, 27 },
-	{ 29158, 45598, 31341,  43, 82, 43,  99, 27 },
-	{ 29137, 44236, 31319,  57, 207, 57,  99, 38 },
-	{ 29784, 44236, 30886,  89, 207, 35,  104, 38 },
-	{ 30585, 48322, 29294,  127, 199, 22,  110, 6 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 29218, 48322, 29562,  87, 199, 30,  100, 6 },
-	{ 30585, 48322, 29294,  127, 199, 22,  110, 6 },
-	{ 30585, 47104, 29454,  127, 76, 10,  110, 15 },
-	{ 30585, 48322, 29294,  127, 199, 22,  110, 6 },
-	{ 29218, 48322, 29562,  87, 199, 30,  100, 6 },
-	{ 29218, 48322, 29562,  87, 199, 30,  100, 6 },
-	{ 29281, 47104, 29709,  82, 76, 19,  100, 15 },
-	{ 30585, 47104, 29454,  127, 76, 10,  110, 15 },
-	{ 30585, 45598, 30760,  127, 82, 8,  110, 27 },
-	{ 30585, 47104, 29454,  127, 76, 10,  110, 15 },
-	{ 29281, 47104, 29709,  82, 76, 19,  100, 15 },
-	{ 29281, 47104, 29709,  82, 76, 19,  100, 15 },
-	{ 29796, 45598, 30915,  82, 82, 17,  104, 27 },
-	{ 30585, 45598, 30760,  127, 82, 8,  110, 27 },
-	{ 30585, 44236, 30728,  127, 207, 27,  110, 38 },
-	{ 30585, 45598, 30760,  127, 82, 8,  110, 27 },
-	{ 29796, 45598, 30915,  82, 82, 17,  104, 27 },
-	{ 29796, 45598, 30915,  82, 82, 17,  104, 27 },
-	{ 29784, 44236, 30886,  89, 207, 35,  104, 38 },
-	{ 30585, 44236, 30728,  127, 207, 27,  110, 38 },
-	{ 31951, 48322, 29562,  167, 199, 30,  121, 6 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 30585, 48322, 29294,  127, 199, 22,  110, 6 },
-	{ 31951, 48322, 29562,  167, 199, 30,  121, 6 },
-	{ 31888, 47104, 29709,  172, 76, 19,  121, 15 },
-	{ 31951, 48322, 29562,  167, 199, 30,  121, 6 },
-	{ 30585, 48322, 29294,  127, 199, 22,  110, 6 },
-	{ 30585, 48322, 29294,  127, 199, 22,  110, 6 },
-	{ 30585, 47104, 29454,  127, 76, 10,  110, 15 },
-	{ 31888, 47104, 29709,  172, 76, 19,  121, 15 },
-	{ 31374, 45598, 30915,  172, 82, 17,  117, 27 },
-	{ 31888, 47104, 29709,  172, 76, 19,  121, 15 },
-	{ 30585, 47104, 29454,  127, 76, 10,  110, 15 },
-	{ 30585, 47104, 29454,  127, 76, 10,  110, 15 },
-	{ 30585, 45598, 30760,  127, 82, 8,  110, 27 },
-	{ 31374, 45598, 30915,  172, 82, 17,  117, 27 },
-	{ 31385, 44236, 30886,  165, 207, 35,  117, 38 },
-	{ 31374, 45598, 30915,  172, 82, 17,  117, 27 },
-	{ 30585, 45598, 30760,  127, 82, 8,  110, 27 },
-	{ 30585, 45598, 30760,  127, 82, 8,  110, 27 },
-	{ 30585, 44236, 30728,  127, 207, 27,  110, 38 },
-	{ 31385, 44236, 30886,  165, 207, 35,  117, 38 },
-	{ 33053, 48322, 30298,  201, 199, 53,  130, 6 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 31951, 48322, 29562,  167, 199, 30,  121, 6 },
-	{ 33053, 48322, 30298,  201, 199, 53,  130, 6 },
-	{ 32940, 47104, 30412,  210, 76, 44,  129, 15 },
-	{ 33053, 48322, 30298,  201, 199, 53,  130, 6 },
-	{ 31951, 48322, 29562,  167, 199, 30,  121, 6 },
-	{ 31951, 48322, 29562,  167, 199, 30,  121, 6 },
-	{ 31888, 47104, 29709,  172, 76, 19,  121, 15 },
-	{ 32940, 47104, 30412,  210, 76, 44,  129, 15 },
-	{ 32011, 45598, 31341,  211, 82, 43,  122, 27 },
-	{ 32940, 47104, 30412,  210, 76, 44,  129, 15 },
-	{ 31888, 47104, 29709,  172, 76, 19,  121, 15 },
-	{ 31888, 47104, 29709,  172, 76, 19,  121, 15 },
-	{ 31374, 45598, 30915,  172, 82, 17,  117, 27 },
-	{ 32011, 45598, 31341,  211, 82, 43,  122, 27 },
-	{ 32032, 44236, 31319,  197, 207, 57,  122, 38 },
-	{ 32011, 45598, 31341,  211, 82, 43,  122, 27 },
-	{ 31374, 45598, 30915,  172, 82, 17,  117, 27 },
-	{ 31374, 45598, 30915,  172, 82, 17,  117, 27 },
-	{ 31385, 44236, 30886,  165, 207, 35,  117, 38 },
-	{ 32032, 44236, 31319,  197, 207, 57,  122, 38 },
-	{ 33789, 48322, 31400,  224, 199, 87,  135, 6 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 33053, 48322, 30298,  201, 199, 53,  130, 6 },
-	{ 33789, 48322, 31400,  224, 199, 87,  135, 6 },
-	{ 33642, 47104, 31463,  235, 76, 82,  134, 15 },
-	{ 33789, 48322, 31400,  224, 199, 87,  135, 6 },
-	{ 33053, 48322, 30298,  201, 199, 53,  130, 6 },
-	{ 33053, 48322, 30298,  201, 199, 53,  130, 6 },
-	{ 32940, 47104, 30412,  210, 76, 44,  129, 15 },
-	{ 33642, 47104, 31463,  235, 76, 82,  134, 15 },
-	{ 32437, 45598, 31978,  237, 82, 82,  125, 27 },
-	{ 33642, 47104, 31463,  235, 76, 82,  134, 15 },
-	{ 32940, 47104, 30412,  210, 76, 44,  129, 15 },
-	{ 32940, 47104, 30412,  210, 76, 44,  129, 15 },
-	{ 32011, 45598, 31341,  211, 82, 43,  122, 27 },
-	{ 32437, 45598, 31978,  237, 82, 82,  125, 27 },
-	{ 32466, 44236, 31967,  219, 207, 89,  125, 38 },
-	{ 32437, 45598, 31978,  237, 82, 82,  125, 27 },
-	{ 32011, 45598, 31341,  211, 82, 43,  122, 27 },
-	{ 32011, 45598, 31341,  211, 82, 43,  122, 27 },
-	{ 32032, 44236, 31319,  197, 207, 57,  122, 38 },
-	{ 32466, 44236, 31967,  219, 207, 89,  125, 38 },
-	{ 34057, 48322, 32767,  232, 199, 127,  138, 6 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 30585, 48824, 32767,  127, 255, 127,  110, 2 },
-	{ 33789, 48322, 31400,  224, 199, 87,  135, 6 },
-	{ 34057, 48322, 32767,  232, 199, 127,  138, 6 },
-	{ 33898, 47104, 32767,  244, 76, 127,  136, 15 },
-	{ 34057, 48322, 32767,  232, 199, 127,  138, 6 },
-	{ 33789, 48322, 31400,  224, 199, 87,  135, 6 },
-	{ 33789, 48322, 31400,  224, 199, 87,  135, 6 },
-	{ 33642, 47104, 31463,  235, 76, 82,  134, 15 },
-	{ 33898, 47104, 32767,  244, 76, 127,  136, 15 },
-	{ 32592, 45598, 32767,  246, 82, 127,  126, 27 },
-	{ 33898, 47104, 32767,  244, 76, 127,  136, 15 },
-	{ 33642, 47104, 31463,  235, 76, 82,  134, 15 },
-	{ 33642, 47104, 31463,  235, 76, 82,  134, 15 },
-	{ 32437, 45598, 31978,  237, 82, 82,  125, 27 },
-	{ 32592, 45598, 32767,  246, 82, 127,  126, 27 },
-	{ 32624, 44236, 32767,  227, 207, 127,  126, 38 },
-	{ 32592, 45598, 32767,  246, 82, 127,  126, 27 },
-	{ 32437, 45598, 31978,  237, 82, 82,  125, 27 },
-	{ 32437, 45598, 31978,  237, 82, 82,  125, 27 },
-	{ 32466, 44236, 31967,  219, 207, 89,  125, 38 },
-	{ 32624, 44236, 32767,  227, 207, 127,  126, 38 },
-	{ 34876, 43328, 34593,  155, 251, 139,  144, 45 },
-	{ 32466, 44236, 33567,  219, 207, 165,  125, 38 },
-	{ 32624, 44236, 32767,  227, 207, 127,  126, 38 },
-	{ 32624, 44236, 32767,  227, 207, 127,  126, 38 },
-	{ 35236, 43328, 32767,  157, 251, 127,  147, 45 },
-	{ 34876, 43328, 34593,  155, 251, 139,  144, 45 },
-	{ 38344, 42707, 36068,  147, 253, 135,  171, 50 },
-	{ 34876, 43328, 34593,  155, 251, 139,  144, 45 },
-	{ 35236, 43328, 32767,  157, 251, 127,  147, 45 },
-	{ 35236, 43328, 32767,  157, 251, 127,  147, 45 },
-	{ 38996, 42707, 32767,  149, 253, 127,  176, 50 },
-	{ 38344, 42707, 36068,  147, 253, 135,  171, 50 },
-	{ 41459, 42086, 37394,  172, 245, 145,  195, 55 },
-	{ 38344, 42707, 36068,  147, 253, 135,  171, 50 },
-	{ 38996, 42707, 32767,  149, 253, 127,  176, 50 },
-	{ 38996, 42707, 32767,  149, 253, 127,  176, 50 },
-	{ 42373, 42086, 32767,  175, 245, 127,  203, 55 },
-	{ 41459, 42086, 37394,  172, 245, 145,  195, 55 },
-	{ 42811, 41178, 37969,  189, 235, 153,  206, 62 },
-	{ 41459, 42086, 37394,  172, 245, 145,  195, 55 },
-	{ 42373, 42086, 32767,  175, 245, 127,  203, 55 },
-	{ 42373, 42086, 32767,  175, 245, 127,  203, 55 },
-	{ 43838, 41178, 32767,  194, 235, 127,  214, 62 },
-	{ 42811, 41178, 37969,  189, 235, 153,  206, 62 },
-	{ 33887, 43328, 36070,  148, 251, 148,  136, 45 },
-	{ 32032, 44236, 34215,  197, 207, 197,  122, 38 },
-	{ 32466, 44236, 33567,  219, 207, 165,  125, 38 },
-	{ 32466, 44236, 33567,  219, 207, 165,  125, 38 },
-	{ 34876, 43328, 34593,  155, 251, 139,  144, 45 },
-	{ 33887, 43328, 36070,  148, 251, 148,  136, 45 },
-	{ 36556, 42707, 38739,  143, 253, 143,  157, 50 },
-	{ 33887, 43328, 36070,  148, 251, 148,  136, 45 },
-	{ 34876, 43328, 34593,  155, 251, 139,  144, 45 },
-	{ 34876, 43328, 34593,  155, 251, 139,  144, 45 },
-	{ 38344, 42707, 36068,  147, 253, 135,  171, 50 },
-	{ 36556, 42707, 38739,  143, 253, 143,  157, 50 },
-	{ 38954, 42086, 41137,  161, 245, 161,  176, 55 },
-	{ 36556, 42707, 38739,  143, 253, 143,  157, 50 },
-	{ 38344, 42707, 36068,  147, 253, 135,  171, 50 },
-	{ 38344, 42707, 36068,  147, 253, 135,  171, 50 },
-	{ 41459, 42086, 37394,  172, 245, 145,  195, 55 },
-	{ 38954, 42086, 41137,  161, 245, 161,  176, 55 },
-	{ 39995, 41178, 42177,  174, 236, 174,  184, 62 },
-	{ 38954, 42086, 41137,  161, 245, 161,  176, 55 },
-	{ 41459, 42086, 37394,  172, 245, 145,  195, 55 },
-	{ 41459, 42086, 37394,  172, 245, 145,  195, 55 },
-	{ 42811, 41178, 37969,  189, 235, 153,  206, 62 },
-	{ 39995, 41178, 42177,  174, 236, 174,  184, 62 },
-	{ 32410, 43328, 37058,  139, 251, 155,  125, 45 },
-	{ 31385, 44236, 34648,  165, 207, 219,  117, 38 },
-	{ 32032, 44236, 34215,  197, 207, 197,  122, 38 },
-	{ 32032, 44236, 34215,  197, 207, 197,  122, 38 },
-	{ 33887, 43328, 36070,  148, 251, 148,  136, 45 },
-	{ 32410, 43328, 37058,  139, 251, 155,  125, 45 },
-	{ 33886, 42707, 40526,  135, 253, 147,  136, 50 },
-	{ 32410, 43328, 37058,  139, 251, 155,  125, 45 },
-	{ 33887, 43328, 36070,  148, 251, 148,  136, 45 },
-	{ 33887, 43328, 36070,  148, 251, 148,  136, 45 },
-	{ 36556, 42707, 38739,  143, 253, 143,  157, 50 },
-	{ 33886, 42707, 40526,  135, 253, 147,  136, 50 },
-	{ 35211, 42086, 43641,  145, 245, 172,  147, 55 },
-	{ 33886, 42707, 40526,  135, 253, 147,  136, 50 },
-	{ 36556, 42707, 38739,  143, 253, 143,  157, 50 },
-	{ 36556, 42707, 38739,  143, 253, 143,  157, 50 },
-	{ 38954, 42086, 41137,  161, 245, 161,  176, 55 },
-	{ 35211, 42086, 43641,  145, 245, 172,  147, 55 },
-	{ 35787, 41178, 44993,  153, 235, 189,  151, 62 },
-	{ 35211, 42086, 43641,  145, 245, 172,  147, 55 },
-	{ 38954, 42086, 41137,  161, 245, 161,  176, 55 },
-	{ 38954, 42086, 41137,  161, 245, 161,  176, 55 },
-	{ 39995, 41178, 42177,  174, 236, 174,  184, 62 },
-	{ 35787, 41178, 44993,  153, 235, 189,  151, 62 },
-	{ 30585, 43328, 37419,  127, 251, 157,  110, 45 },
-	{ 30585, 44236, 34806,  127, 207, 227,  110, 38 },
-	{ 31385, 44236, 34648,  165, 207, 219,  117, 38 },
-	{ 31385, 44236, 34648,  165, 207, 219,  117, 38 },
-	{ 32410, 43328, 37058,  139, 251, 155,  125, 45 },
-	{ 30585, 43328, 37419,  127, 251, 157,  110, 45 },
-	{ 30585, 42707, 41178,  127, 253, 149,  110, 50 },
-	{ 30585, 43328, 37419,  127, 251, 157,  110, 45 },
-	{ 32410, 43328, 37058,  139, 251, 155,  125, 45 },
-	{ 32410, 43328, 37058,  139, 251, 155,  125, 45 },
-	{ 33886, 42707, 40526,  135, 253, 147,  136, 50 },
-	{ 30585, 42707, 41178,  127, 253, 149,  110, 50 },
-	{ 30585, 42086, 44555,  127, 245, 175,  110, 55 },
-	{ 30585, 42707, 41178,  127, 253, 149,  110, 50 },
-	{ 33886, 42707, 40526,  135, 253, 147,  136, 50 },
-	{ 33886, 42707, 40526,  135, 253, 147,  136, 50 },
-	{ 35211, 42086, 43641,  145, 245, 172,  147, 55 },
-	{ 30585, 42086, 44555,  127, 245, 175,  110, 55 },
-	{ 30585, 41178, 46021,  127, 235, 194,  110, 62 },
-	{ 30585, 42086, 44555,  127, 245, 175,  110, 55 },
-	{ 35211, 42086, 43641,  145, 245, 172,  147, 55 },
-	{ 35211, 42086, 43641,  145, 245, 172,  147, 55 },
-	{ 35787, 41178, 44993,  153, 235, 189,  151, 62 },
-	{ 30585, 41178, 46021,  127, 235, 194,  110, 62 },
-	{ 28759, 43328, 37058,  115, 251, 155,  96, 45 },
-	{ 29784, 44236, 34648,  89, 207, 219,  104, 38 },
-	{ 30585, 44236, 34806,  127, 207, 227,  110, 38 },
-	{ 30585, 44236, 34806,  127, 207, 227,  110, 38 },
-	{ 30585, 43328, 37419,  127, 251, 157,  110, 45 },
-	{ 28759, 43328, 37058,  115, 251, 155,  96, 45 },
-	{ 27283, 42707, 40526,  119, 253, 147,  85, 50 },
-	{ 28759, 43328, 37058,  115, 251, 155,  96, 45 },
-	{ 30585, 43328, 37419,  127, 251, 157,  110, 45 },
-	{ 30585, 43328, 37419,  127, 251, 157,  110, 45 },
-	{ 30585, 42707, 41178,  127, 253, 149,  110, 50 },
-	{ 27283, 42707, 40526,  119, 253, 147,  85, 50 },
-	{ 25958, 42086, 43641,  109, 245, 172,  74, 55 },
-	{ 27283, 42707, 40526,  119, 253, 147,  85, 50 },
-	{ 30585, 42707, 41178,  127, 253, 149,  110, 50 },
-	{ 30585, 42707, 41178,  127, 253, 149,  110, 50 },
-	{ 30585, 42086, 44555,  127, 245, 175,  110, 55 },
-	{ 25958, 42086, 43641,  109, 245, 172,  74, 55 },
-	{ 25383, 41178, 44993,  101, 235, 189,  70, 62 },
-	{ 25958, 42086, 43641,  109, 245, 172,  74, 55 },
-	{ 30585, 42086, 44555,  127, 245, 175,  110, 55 },
-	{ 30585, 42086, 44555,  127, 245, 175,  110, 55 },
-	{ 30585, 41178, 46021,  127, 235, 194,  110, 62 },
-	{ 25383, 41178, 44993,  101, 235, 189,  70, 62 },
-	{ 27282, 43328, 36070,  106, 251, 148,  85, 45 },
-	{ 29137, 44236, 34215,  57, 207, 197,  99, 38 },
-	{ 29784, 44236, 34648,  89, 207, 219,  104, 38 },
-	{ 29784, 44236, 34648,  89, 207, 219,  104, 38 },
-	{ 28759, 43328, 37058,  115, 251, 155,  96, 45 },
-	{ 27282, 43328, 36070,  106, 251, 148,  85, 45 },
-	{ 24613, 42707, 38739,  111, 253, 143,  64, 50 },
-	{ 27282, 43328, 36070,  106, 251, 148,  85, 45 },
-	{ 28759, 43328, 37058,  115, 251, 155,  96, 45 },
-	{ 28759, 43328, 37058,  115, 251, 155,  96, 45 },
-	{ 27283, 42707, 40526,  119, 253, 147,  85, 50 },
-	{ 24613, 42707, 38739,  111, 253, 143,  64, 50 },
-	{ 22215, 42086, 41137,  93, 245, 161,  45, 55 },
-	{ 24613, 42707, 38739,  111, 253, 143,  64, 50 },
-	{ 27283, 42707, 40526,  119, 253, 147,  85, 50 },
-	{ 27283, 42707, 40526,  119, 253, 147,  85, 50 },
-	{ 25958, 42086, 43641,  109, 245, 172,  74, 55 },
-	{ 22215, 42086, 41137,  93, 245, 161,  45, 55 },
-	{ 21175, 41178, 42177,  80, 236, 174,  37, 62 },
-	{ 22215, 42086, 41137,  93, 245, 161,  45, 55 },
-	{ 25958, 42086, 43641,  109, 245, 172,  74, 55 },
-	{ 25958, 42086, 43641,  109, 245, 172,  74, 55 },
-	{ 25383, 41178, 44993,  101, 235, 189,  70, 62 },
-	{ 21175, 41178, 42177,  80, 236, 174,  37, 62 },
-	{ 26294, 43328, 34593,  99, 251, 139,  77, 45 },
-	{ 28704, 44236, 33567,  35, 207, 165,  96, 38 },
-	{ 29137, 44236, 34215,  57, 207, 197,  99, 38 },
-	{ 29137, 44236, 34215,  57, 207, 197,  99, 38 },
-	{ 27282, 43328, 36070,  106, 251, 148,  85, 45 },
-	{ 26294, 43328, 34593,  99, 251, 139,  77, 45 },
-	{ 22826, 42707, 36068,  107, 253, 135,  50, 50 },
-	{ 26294, 43328, 34593,  99, 251, 139,  77, 45 },
-	{ 27282, 43328, 36070,  106, 251, 148,  85, 45 },
-	{ 27282, 43328, 36070,  106, 251, 148,  85, 45 },
-	{ 24613, 42707, 38739,  111, 253, 143,  64, 50 },
-	{ 22826, 42707, 36068,  107, 253, 135,  50, 50 },
-	{ 19710, 42086, 37394,  82, 245, 145,  25, 55 },
-	{ 22826, 42707, 36068,  107, 253, 135,  50, 50 },
-	{ 24613, 42707, 38739,  111, 253, 143,  64, 50 },
-	{ 24613, 42707, 38739,  111, 253, 143,  64, 50 },
-	{ 22215, 42086, 41137,  93, 245, 161,  45, 55 },
-	{ 19710, 42086, 37394,  82, 245, 145,  25, 55 },
-	{ 18358, 41178, 37969,  65, 235, 153,  15, 62 },
-	{ 19710, 42086, 37394,  82, 245, 145,  25, 55 },
-	{ 22215, 42086, 41137,  93, 245, 161,  45, 55 },
-	{ 22215, 42086, 41137,  93, 245, 161,  45, 55 },
-	{ 21175, 41178, 42177,  80, 236, 174,  37, 62 },
-	{ 18358, 41178, 37969,  65, 235, 153,  15, 62 },
-	{ 25933, 43328, 32767,  97, 251, 127,  74, 45 },
-	{ 28546, 44236, 32767,  27, 207, 127,  95, 38 },
-	{ 28704, 44236, 33567,  35, 207, 165,  96, 38 },
-	{ 28704, 44236, 33567,  35, 207, 165,  96, 38 },
-	{ 26294, 43328, 34593,  99, 251, 139,  77, 45 },
-	{ 25933, 43328, 32767,  97, 251, 127,  74, 45 },
-	{ 22174, 42707, 32767,  105, 253, 127,  45, 50 },
-	{ 25933, 43328, 32767,  97, 251, 127,  74, 45 },
-	{ 26294, 43328, 34593,  99, 251, 139,  77, 45 },
-	{ 26294, 43328, 34593,  99, 251, 139,  77, 45 },
-	{ 22826, 42707, 36068,  107, 253, 135,  50, 50 },
-	{ 22174, 42707, 32767,  105, 253, 127,  45, 50 },
-	{ 18797, 42086, 32767,  79, 245, 127,  18, 55 },
-	{ 22174, 42707, 32767,  105, 253, 127,  45, 50 },
-	{ 22826, 42707, 36068,  107, 253, 135,  50, 50 },
-	{ 22826, 42707, 36068,  107, 253, 135,  50, 50 },
-	{ 19710, 42086, 37394,  82, 245, 145,  25, 55 },
-	{ 18797, 42086, 32767,  79, 245, 127,  18, 55 },
-	{ 17331, 41178, 32767,  60, 235, 127,  7, 62 },
-	{ 18797, 42086, 32767,  79, 245, 127,  18, 55 },
-	{ 19710, 42086, 37394,  82, 245, 145,  25, 55 },
-	{ 19710, 42086, 37394,  82, 245, 145,  25, 55 },
-	{ 18358, 41178, 37969,  65, 235, 153,  15, 62 },
-	{ 17331, 41178, 32767,  60, 235, 127,  7, 62 },
-	{ 26294, 43328, 30941,  99, 251, 115,  77, 45 },
-	{ 28704, 44236, 31967,  35, 207, 89,  96, 38 },
-	{ 28546, 44236, 32767,  27, 207, 127,  95, 38 },
-	{ 28546, 44236, 32767,  27, 207, 127,  95, 38 },
-	{ 25933, 43328, 32767,  97, 251, 127,  74, 45 },
-	{ 26294, 43328, 30941,  99, 251, 115,  77, 45 },
-	{ 22826, 42707, 29466,  107, 253, 119,  50, 50 },
-	{ 26294, 43328, 30941,  99, 251, 115,  77, 45 },
-	{ 25933, 43328, 32767,  97, 251, 127,  74, 45 },
-	{ 25933, 43328, 32767,  97, 251, 127,  74, 45 },
-	{ 22174, 42707, 32767,  105, 253, 127,  45, 50 },
-	{ 22826, 42707, 29466,  107, 253, 119,  50, 50 },
-	{ 19710, 42086, 28140,  82, 245, 109,  25, 55 },
-	{ 22826, 42707, 29466,  107, 253, 119,  50, 50 },
-	{ 22174, 42707, 32767,  105, 253, 127,  45, 50 },
-	{ 22174, 42707, 32767,  105, 253, 127,  45, 50 },
-	{ 18797, 42086, 32767,  79, 245, 127,  18, 55 },
-	{ 19710, 42086, 28140,  82, 245, 109,  25, 55 },
-	{ 18358, 41178, 27565,  65, 235, 101,  15, 62 },
-	{ 19710, 42086, 28140,  82, 245, 109,  25, 55 },
-	{ 18797, 42086, 32767,  79, 245, 127,  18, 55 },
-	{ 18797, 42086, 32767,  79, 245, 127,  18, 55 },
-	{ 17331, 41178, 32767,  60, 235, 127,  7, 62 },
-	{ 18358, 41178, 27565,  65, 235, 101,  15, 62 },
-	{ 27282, 43328, 29464,  106, 251, 106,  85, 45 },
-	{ 29137, 44236, 31319,  57, 207, 57,  99, 38 },
-	{ 28704, 44236, 31967,  35, 207, 89,  96, 38 },
-	{ 28704, 44236, 31967,  35, 207, 89,  96, 38 },
-	{ 26294, 43328, 30941,  99, 251, 115,  77, 45 },
-	{ 27282, 43328, 29464,  106, 251, 106,  85, 45 },
-	{ 24613, 42707, 26795,  111, 253, 111,  64, 50 },
-	{ 27282, 43328, 29464,  106, 251, 106,  85, 45 },
-	{ 26294, 43328, 30941,  99, 251, 115,  77, 45 },
-	{ 26294, 43328, 30941,  99, 251, 115,  77, 45 },
-	{ 22826, 42707, 29466,  107, 253, 119,  50, 50 },
-	{ 24613, 42707, 26795,  111, 253, 111,  64, 50 },
-	{ 22215, 42086, 24398,  93, 245, 93,  45, 55 },
-	{ 24613, 42707, 26795,  111, 253, 111,  64, 50 },
-	{ 22826, 42707, 29466,  107, 253, 119,  50, 50 },
-	{ 22826, 42707, 29466,  107, 253, 119,  50, 50 },
-	{ 19710, 42086, 28140,  82, 245, 109,  25, 55 },
-	{ 22215, 42086, 24398,  93, 245, 93,  45, 55 },
-	{ 21175, 41178, 23357,  80, 236, 80,  37, 62 },
-	{ 22215, 42086, 24398,  93, 245, 93,  45, 55 },
-	{ 19710, 42086, 28140,  82, 245, 109,  25, 55 },
-	{ 19710, 42086, 28140,  82, 245, 109,  25, 55 },
-	{ 18358, 41178, 27565,  65, 235, 101,  15, 62 },
-	{ 21175, 41178, 23357,  80, 236, 80,  37, 62 },
-	{ 28759, 43328, 28476,  115, 251, 99,  96, 45 },
-	{ 29784, 44236, 30886,  89, 207, 35,  104, 38 },
-	{ 29137, 44236, 31319,  57, 207, 57,  99, 38 },
-	{ 29137, 44236, 31319,  57, 207, 57,  99, 38 },
-	{ 27282, 43328, 29464,  106, 251, 106,  85, 45 },
-	{ 28759, 43328, 28476,  115, 251, 99,  96, 45 },
-	{ 27283, 42707, 25008,  119, 253, 107,  85, 50 },
-	{ 28759, 43328, 28476,  115, 251, 99,  96, 45 },
-	{ 27282, 43328, 29464,  106, 251, 106,  85, 45 },
-	{ 27282, 43328, 29464,  106, 251, 106,  85, 45 },
-	{ 24613, 42707, 26795,  111, 253, 111,  64, 50 },
-	{ 27283, 42707, 25008,  119, 253, 107,  85, 50 },
-	{ 25958, 42086, 21893,  109, 245, 82,  74, 55 },
-	{ 27283, 42707, 25008,  119, 253, 107,  85, 50 },
-	{ 24613, 42707, 26795,  111, 253, 111,  64, 50 },
-	{ 24613, 42707, 26795,  111, 253, 111,  64, 50 },
-	{ 22215, 42086, 24398,  93, 245, 93,  45, 55 },
-	{ 25958, 42086, 21893,  109, 245, 82,  74, 55 },
-	{ 25383, 41178, 20541,  101, 235, 65,  70, 62 },
-	{ 25958, 42086, 21893,  109, 245, 82,  74, 55 },
-	{ 22215, 42086, 24398,  93, 245, 93,  45, 55 },
-	{ 22215, 42086, 24398,  93, 245, 93,  45, 55 },
-	{ 21175, 41178, 23357,  80, 236, 80,  37, 62 },
-	{ 25383, 41178, 20541,  101, 235, 65,  70, 62 },
-	{ 30585, 43328, 28116,  127, 251, 97,  110, 45 },
-	{ 30585, 44236, 30728,  127, 207, 27,  110, 38 },
-	{ 29784, 44236, 30886,  89, 207, 35,  104, 38 },
-	{ 29784, 44236, 30886,  89, 207, 35,  104, 38 },
-	{ 28759, 43328, 28476,  115, 251, 99,  96, 45 },
-	{ 30585, 43328, 28116,  127, 251, 97,  110, 45 },
-	{ 30585, 42707, 24356,  127, 253, 105,  110, 50 },
-	{ 30585, 43328, 28116,  127, 251, 97,  110, 45 },
-	{ 28759, 43328, 28476,  115, 251, 99,  96, 45 },
-	{ 28759, 43328, 28476,  115, 251, 99,  96, 45 },
-	{ 27283, 42707, 25008,  119, 253, 107,  85, 50 },
-	{ 30585, 42707, 24356,  127, 253, 105,  110, 50 },
-	{ 30585, 42086, 20979,  127, 245, 79,  110, 55 },
-	{ 30585, 42707, 24356,  127, 253, 105,  110, 50 },
-	{ 27283, 42707, 25008,  119, 253, 107,  85, 50 },
-	{ 27283, 42707, 25008,  119, 253, 107,  85, 50 },
-	{ 25958, 42086, 21893,  109, 245, 82,  74, 55 },
-	{ 30585, 42086, 20979,  127, 245, 79,  110, 55 },
-	{ 30585, 41178, 19513,  127, 235, 60,  110, 62 },
-	{ 30585, 42086, 20979,  127, 245, 79,  110, 55 },
-	{ 25958, 42086, 21893,  109, 245, 82,  74, 55 },
-	{ 25958, 42086, 21893,  109, 245, 82,  74, 55 },
-	{ 25383, 41178, 20541,  101, 235, 65,  70, 62 },
-	{ 30585, 41178, 19513,  127, 235, 60,  110, 62 },
-	{ 32410, 43328, 28476,  139, 251, 99,  125, 45 },
-	{ 31385, 44236, 30886,  165, 207, 35,  117, 38 },
-	{ 30585, 44236, 30728,  127, 207, 27,  110, 38 },
-	{ 30585, 44236, 30728,  127, 207, 27,  110, 38 },
-	{ 30585, 43328, 28116,  127, 251, 97,  110, 45 },
-	{ 32410, 43328, 28476,  139, 251, 99,  125, 45 },
-	{ 33886, 42707, 25008,  135, 253, 107,  136, 50 },
-	{ 32410, 43328, 28476,  139, 251, 99,  125, 45 },
-	{ 30585, 43328, 28116,  127, 251, 97,  110, 45 },
-	{ 30585, 43328, 28116,  127, 251, 97,  110, 45 },
-	{ 30585, 42707, 24356,  127, 253, 105,  110, 50 },
-	{ 33886, 42707, 25008,  135, 253, 107,  136, 50 },
-	{ 35211, 42086, 21893,  145, 245, 82,  147, 55 },
-	{ 33886, 42707, 25008,  135, 253, 107,  136, 50 },
-	{ 30585, 42707, 24356,  127, 253, 105,  110, 50 },
-	{ 30585, 42707, 24356,  127, 253, 105,  110, 50 },
-	{ 30585, 42086, 20979,  127, 245, 79,  110, 55 },
-	{ 35211, 42086, 21893,  145, 245, 82,  147, 55 },
-	{ 35787, 41178, 20541,  153, 235, 65,  151, 62 },
-	{ 35211, 42086, 21893,  145, 245, 82,  147, 55 },
-	{ 30585, 42086, 20979,  127, 245, 79,  110, 55 },
-	{ 30585, 42086, 20979,  127, 245, 79,  110, 55 },
-	{ 30585, 41178, 19513,  127, 235, 60,  110, 62 },
-	{ 35787, 41178, 20541,  153, 235, 65,  151, 62 },
-	{ 33887, 43328, 29464,  148, 251, 106,  136, 45 },
-	{ 32032, 44236, 31319,  197, 207, 57,  122, 38 },
-	{ 31385, 44236, 30886,  165, 207, 35,  117, 38 },
-	{ 31385, 44236, 30886,  165, 207, 35,  117, 38 },
-	{ 32410, 43328, 28476,  139, 251, 99,  125, 45 },
-	{ 33887, 43328, 29464,  148, 251, 106,  136, 45 },
-	{ 36556, 42707, 26795,  143, 253, 111,  157, 50 },
-	{ 33887, 43328, 29464,  148, 251, 106,  136, 45 },
-	{ 32410, 43328, 28476,  139, 251, 99,  125, 45 },
-	{ 32410, 43328, 28476,  139, 251, 99,  125, 45 },
-	{ 33886, 42707, 25008,  135, 253, 107,  136, 50 },
-	{ 36556, 42707, 26795,  143, 253, 111,  157, 50 },
-	{ 38954, 42086, 24398,  161, 245, 93,  176, 55 },
-	{ 36556, 42707, 26795,  143, 253, 111,  157, 50 },
-	{ 33886, 42707, 25008,  135, 253, 107,  136, 50 },
-	{ 33886, 42707, 25008,  135, 253, 107,  136, 50 },
-	{ 35211, 42086, 21893,  145, 245, 82,  147, 55 },
-	{ 38954, 42086, 24398,  161, 245, 93,  176, 55 },
-	{ 39995, 41178, 23357,  174, 236, 80,  184, 62 },
-	{ 38954, 42086, 24398,  161, 245, 93,  176, 55 },
-	{ 35211, 42086, 21893,  145, 245, 82,  147, 55 },
-	{ 35211, 42086, 21893,  145, 245, 82,  147, 55 },
-	{ 35787, 41178, 20541,  153, 235, 65,  151, 62 },
-	{ 39995, 41178, 23357,  174, 236, 80,  184, 62 },
-	{ 34876, 43328, 30941,  155, 251, 115,  144, 45 },
-	{ 32466, 44236, 31967,  219, 207, 89,  125, 38 },
-	{ 32032, 44236, 31319,  197, 207, 57,  122, 38 },
-	{ 32032, 44236, 31319,  197, 207, 57,  122, 38 },
-	{ 33887, 43328, 29464,  148, 251, 106,  136, 45 },
-	{ 34876, 43328, 30941,  155, 251, 115,  144, 45 },
-	{ 38344, 42707, 29466,  147, 253, 119,  171, 50 },
-	{ 34876, 43328, 30941,  155, 251, 115,  144, 45 },
-	{ 33887, 43328, 29464,  148, 251, 106,  136, 45 },
-	{ 33887, 43328, 29464,  148, 251, 106,  136, 45 },
-	{ 36556, 42707, 26795,  143, 253, 111,  157, 50 },
-	{ 38344, 42707, 29466,  147, 253, 119,  171, 50 },
-	{ 41459, 42086, 28140,  172, 245, 109,  195, 55 },
-	{ 38344, 42707, 29466,  147, 253, 119,  171, 50 },
-	{ 36556, 42707, 26795,  143, 253, 111,  157, 50 },
-	{ 36556, 42707, 26795,  143, 253, 111,  157, 50 },
-	{ 38954, 42086, 24398,  161, 245, 93,  176, 55 },
-	{ 41459, 42086, 28140,  172, 245, 109,  195, 55 },
-	{ 42811, 41178, 27565,  189, 235, 101,  206, 62 },
-	{ 41459, 42086, 28140,  172, 245, 109,  195, 55 },
-	{ 38954, 42086, 24398,  161, 245, 93,  176, 55 },
-	{ 38954, 42086, 24398,  161, 245, 93,  176, 55 },
-	{ 39995, 41178, 23357,  174, 236, 80,  184, 62 },
-	{ 42811, 41178, 27565,  189, 235, 101,  206, 62 },
-	{ 35236, 43328, 32767,  157, 251, 127,  147, 45 },
-	{ 32624, 44236, 32767,  227, 207, 127,  126, 38 },
-	{ 32466, 44236, 31967,  219, 207, 89,  125, 38 },
-	{ 32466, 44236, 31967,  219, 207, 89,  125, 38 },
-	{ 34876, 43328, 30941,  155, 251, 115,  144, 45 },
-	{ 35236, 43328, 32767,  157, 251, 127,  147, 45 },
-	{ 38996, 42707, 32767,  149, 253, 127,  176, 50 },
-	{ 35236, 43328, 32767,  157, 251, 127,  147, 45 },
-	{ 34876, 43328, 30941,  155, 251, 115,  144, 45 },
-	{ 34876, 43328, 30941,  155, 251, 115,  144, 45 },
-	{ 38344, 42707, 29466,  147, 253, 119,  171, 50 },
-	{ 38996, 42707, 32767,  149, 253, 127,  176, 50 },
-	{ 42373, 42086, 32767,  175, 245, 127,  203, 55 },
-	{ 38996, 42707, 32767,  149, 253, 127,  176, 50 },
-	{ 38344, 42707, 29466,  147, 253, 119,  171, 50 },
-	{ 38344, 42707, 29466,  147, 253, 119,  171, 50 },
-	{ 41459, 42086, 28140,  172, 245, 109,  195, 55 },
-	{ 42373, 42086, 32767,  175, 245, 127,  203, 55 },
-	{ 43838, 41178, 32767,  194, 235, 127,  214, 62 },
-	{ 42373, 42086, 32767,  175, 245, 127,  203, 55 },
-	{ 41459, 42086, 28140,  172, 245, 109,  195, 55 },
-	{ 41459, 42086, 28140,  172, 245, 109,  195, 55 },
-	{ 42811, 41178, 27565,  189, 235, 101,  206, 62 },
-	{ 43838, 41178, 32767,  194, 235, 127,  214, 62 },
+const vertex_position_t positions0[] =
+{ // position[xyz]
+	{ 43568, 41931, 38291 },
+	{ 43752, 41178, 38369 },
+	{ 44858, 41178, 32767 },
+	{ 44858, 41178, 32767 },
+	{ 44659, 41931, 32767 },
+	{ 43568, 41931, 38291 },
+	{ 43781, 42181, 38382 },
+	{ 43568, 41931, 38291 },
+	{ 44659, 41931, 32767 },
+	{ 44659, 41931, 32767 },
+	{ 44890, 42181, 32767 },
+	{ 43781, 42181, 38382 },
+	{ 44214, 41931, 38566 },
+	{ 43781, 42181, 38382 },
+	{ 44890, 42181, 32767 },
+	{ 44890, 42181, 32767 },
+	{ 45359, 41931, 32767 },
+	{ 44214, 41931, 38566 },
+	{ 44692, 41178, 38769 },
+	{ 44214, 41931, 38566 },
+	{ 45359, 41931, 32767 },
+	{ 45359, 41931, 32767 },
+	{ 45877, 41178, 32767 },
+	{ 44692, 41178, 38769 },
+	{ 40577, 41931, 42760 },
+	{ 40719, 41178, 42901 },
+	{ 43752, 41178, 38369 },
+	{ 43752, 41178, 38369 },
+	{ 43568, 41931, 38291 },
+	{ 40577, 41931, 42760 },
+	{ 40741, 42181, 42923 },
+	{ 40577, 41931, 42760 },
+	{ 43568, 41931, 38291 },
+	{ 43568, 41931, 38291 },
+	{ 43781, 42181, 38382 },
+	{ 40741, 42181, 42923 },
+	{ 41075, 41931, 43257 },
+	{ 40741, 42181, 42923 },
+	{ 43781, 42181, 38382 },
+	{ 43781, 42181, 38382 },
+	{ 44214, 41931, 38566 },
+	{ 41075, 41931, 43257 },
+	{ 41442, 41178, 43625 },
+	{ 41075, 41931, 43257 },
+	{ 44214, 41931, 38566 },
+	{ 44214, 41931, 38566 },
+	{ 44692, 41178, 38769 },
+	{ 41442, 41178, 43625 },
+	{ 36109, 41931, 45750 },
+	{ 36187, 41178, 45934 },
+	{ 40719, 41178, 42901 },
+	{ 40719, 41178, 42901 },
+	{ 40577, 41931, 42760 },
+	{ 36109, 41931, 45750 },
+	{ 36199, 42181, 45963 },
+	{ 36109, 41931, 45750 },
+	{ 40577, 41931, 42760 },
+	{ 40577, 41931, 42760 },
+	{ 40741, 42181, 42923 },
+	{ 36199, 42181, 45963 },
+	{ 36384, 41931, 46397 },
+	{ 36199, 42181, 45963 },
+	{ 40741, 42181, 42923 },
+	{ 40741, 42181, 42923 },
+	{ 41075, 41931, 43257 },
+	{ 36384, 41931, 46397 },
+	{ 36587, 41178, 46874 },
+	{ 36384, 41931, 46397 },
+	{ 41075, 41931, 43257 },
+	{ 41075, 41931, 43257 },
+	{ 41442, 41178, 43625 },
+	{ 36587, 41178, 46874 },
+	{ 30585, 41931, 46841 },
+	{ 30585, 41178, 47040 },
+	{ 36187, 41178, 45934 },
+	{ 36187, 41178, 45934 },
+	{ 36109, 41931, 45750 },
+	{ 30585, 41931, 46841 },
+	{ 30585, 42181, 47072 },
+	{ 30585, 41931, 46841 },
+	{ 36109, 41931, 45750 },
+	{ 36109, 41931, 45750 },
+	{ 36199, 42181, 45963 },
+	{ 30585, 42181, 47072 },
+	{ 30585, 41931, 47542 },
+	{ 30585, 42181, 47072 },
+	{ 36199, 42181, 45963 },
+	{ 36199, 42181, 45963 },
+	{ 36384, 41931, 46397 },
+	{ 30585, 41931, 47542 },
+	{ 30585, 41178, 48060 },
+	{ 30585, 41931, 47542 },
+	{ 36384, 41931, 46397 },
+	{ 36384, 41931, 46397 },
+	{ 36587, 41178, 46874 },
+	{ 30585, 41178, 48060 },
+	{ 24897, 41931, 45750 },
+	{ 24595, 41178, 45934 },
+	{ 30585, 41178, 47040 },
+	{ 30585, 41178, 47040 },
+	{ 30585, 41931, 46841 },
+	{ 24897, 41931, 45750 },
+	{ 24922, 42181, 45963 },
+	{ 24897, 41931, 45750 },
+	{ 30585, 41931, 46841 },
+	{ 30585, 41931, 46841 },
+	{ 30585, 42181, 47072 },
+	{ 24922, 42181, 45963 },
+	{ 24779, 41931, 46397 },
+	{ 24922, 42181, 45963 },
+	{ 30585, 42181, 47072 },
+	{ 30585, 42181, 47072 },
+	{ 30585, 41931, 47542 },
+	{ 24779, 41931, 46397 },
+	{ 24582, 41178, 46874 },
+	{ 24779, 41931, 46397 },
+	{ 30585, 41931, 47542 },
+	{ 30585, 41931, 47542 },
+	{ 30585, 41178, 48060 },
+	{ 24582, 41178, 46874 },
+	{ 20447, 41931, 42760 },
+	{ 20107, 41178, 42901 },
+	{ 24595, 41178, 45934 },
+	{ 24595, 41178, 45934 },
+	{ 24897, 41931, 45750 },
+	{ 20447, 41931, 42760 },
+	{ 20385, 42181, 42923 },
+	{ 20447, 41931, 42760 },
+	{ 24897, 41931, 45750 },
+	{ 24897, 41931, 45750 },
+	{ 24922, 42181, 45963 },
+	{ 20385, 42181, 42923 },
+	{ 20089, 41931, 43257 },
+	{ 20385, 42181, 42923 },
+	{ 24922, 42181, 45963 },
+	{ 24922, 42181, 45963 },
+	{ 24779, 41931, 46397 },
+	{ 20089, 41931, 43257 },
+	{ 19727, 41178, 43625 },
+	{ 20089, 41931, 43257 },
+	{ 24779, 41931, 46397 },
+	{ 24779, 41931, 46397 },
+	{ 24582, 41178, 46874 },
+	{ 19727, 41178, 43625 },
+	{ 17547, 41931, 38291 },
+	{ 17289, 41178, 38369 },
+	{ 20107, 41178, 42901 },
+	{ 20107, 41178, 42901 },
+	{ 20447, 41931, 42760 },
+	{ 17547, 41931, 38291 },
+	{ 17372, 42181, 38382 },
+	{ 17547, 41931, 38291 },
+	{ 20447, 41931, 42760 },
+	{ 20447, 41931, 42760 },
+	{ 20385, 42181, 42923 },
+	{ 17372, 42181, 38382 },
+	{ 16953, 41931, 38566 },
+	{ 17372, 42181, 38382 },
+	{ 20385, 42181, 42923 },
+	{ 20385, 42181, 42923 },
+	{ 20089, 41931, 43257 },
+	{ 16953, 41931, 38566 },
+	{ 16477, 41178, 38769 },
+	{ 16953, 41931, 38566 },
+	{ 20089, 41931, 43257 },
+	{ 20089, 41931, 43257 },
+	{ 19727, 41178, 43625 },
+	{ 16477, 41178, 38769 },
+	{ 16511, 41931, 32767 },
+	{ 16312, 41178, 32767 },
+	{ 17289, 41178, 38369 },
+	{ 17289, 41178, 38369 },
+	{ 17547, 41931, 38291 },
+	{ 16511, 41931, 32767 },
+	{ 16280, 42181, 32767 },
+	{ 16511, 41931, 32767 },
+	{ 17547, 41931, 38291 },
+	{ 17547, 41931, 38291 },
+	{ 17372, 42181, 38382 },
+	{ 16280, 42181, 32767 },
+	{ 15810, 41931, 32767 },
+	{ 16280, 42181, 32767 },
+	{ 17372, 42181, 38382 },
+	{ 17372, 42181, 38382 },
+	{ 16953, 41931, 38566 },
+	{ 15810, 41931, 32767 },
+	{ 15292, 41178, 32767 },
+	{ 15810, 41931, 32767 },
+	{ 16953, 41931, 38566 },
+	{ 16953, 41931, 38566 },
+	{ 16477, 41178, 38769 },
+	{ 15292, 41178, 32767 },
+	{ 17601, 41931, 27243 },
+	{ 17418, 41178, 27165 },
+	{ 16312, 41178, 32767 },
+	{ 16312, 41178, 32767 },
+	{ 16511, 41931, 32767 },
+	{ 17601, 41931, 27243 },
+	{ 17388, 42181, 27152 },
+	{ 17601, 41931, 27243 },
+	{ 16511, 41931, 32767 },
+	{ 16511, 41931, 32767 },
+	{ 16280, 42181, 32767 },
+	{ 17388, 42181, 27152 },
+	{ 16955, 41931, 26968 },
+	{ 17388, 42181, 27152 },
+	{ 16280, 42181, 32767 },
+	{ 16280, 42181, 32767 },
+	{ 15810, 41931, 32767 },
+	{ 16955, 41931, 26968 },
+	{ 16477, 41178, 26765 },
+	{ 16955, 41931, 26968 },
+	{ 15810, 41931, 32767 },
+	{ 15810, 41931, 32767 },
+	{ 15292, 41178, 32767 },
+	{ 16477, 41178, 26765 },
+	{ 20592, 41931, 22775 },
+	{ 20451, 41178, 22633 },
+	{ 17418, 41178, 27165 },
+	{ 17418, 41178, 27165 },
+	{ 17601, 41931, 27243 },
+	{ 20592, 41931, 22775 },
+	{ 20428, 42181, 22611 },
+	{ 20592, 41931, 22775 },
+	{ 17601, 41931, 27243 },
+	{ 17601, 41931, 27243 },
+	{ 17388, 42181, 27152 },
+	{ 20428, 42181, 22611 },
+	{ 20094, 41931, 22277 },
+	{ 20428, 42181, 22611 },
+	{ 17388, 42181, 27152 },
+	{ 17388, 42181, 27152 },
+	{ 16955, 41931, 26968 },
+	{ 20094, 41931, 22277 },
+	{ 19727, 41178, 21909 },
+	{ 20094, 41931, 22277 },
+	{ 16955, 41931, 26968 },
+	{ 16955, 41931, 26968 },
+	{ 16477, 41178, 26765 },
+	{ 19727, 41178, 21909 },
+	{ 25061, 41931, 19784 },
+	{ 24982, 41178, 19600 },
+	{ 20451, 41178, 22633 },
+	{ 20451, 41178, 22633 },
+	{ 20592, 41931, 22775 },
+	{ 25061, 41931, 19784 },
+	{ 24970, 42181, 19571 },
+	{ 25061, 41931, 19784 },
+	{ 20592, 41931, 22775 },
+	{ 20592, 41931, 22775 },
+	{ 20428, 42181, 22611 },
+	{ 24970, 42181, 19571 },
+	{ 24786, 41931, 19137 },
+	{ 24970, 42181, 19571 },
+	{ 20428, 42181, 22611 },
+	{ 20428, 42181, 22611 },
+	{ 20094, 41931, 22277 },
+	{ 24786, 41931, 19137 },
+	{ 24582, 41178, 18660 },
+	{ 24786, 41931, 19137 },
+	{ 20094, 41931, 22277 },
+	{ 20094, 41931, 22277 },
+	{ 19727, 41178, 21909 },
+	{ 24582, 41178, 18660 },
+	{ 30585, 41931, 18693 },
+	{ 30585, 41178, 18494 },
+	{ 24982, 41178, 19600 },
+	{ 24982, 41178, 19600 },
+	{ 25061, 41931, 19784 },
+	{ 30585, 41931, 18693 },
+	{ 30585, 42181, 18462 },
+	{ 30585, 41931, 18693 },
+	{ 25061, 41931, 19784 },
+	{ 25061, 41931, 19784 },
+	{ 24970, 42181, 19571 },
+	{ 30585, 42181, 18462 },
+	{ 30585, 41931, 17992 },
+	{ 30585, 42181, 18462 },
+	{ 24970, 42181, 19571 },
+	{ 24970, 42181, 19571 },
+	{ 24786, 41931, 19137 },
+	{ 30585, 41931, 17992 },
+	{ 30585, 41178, 17474 },
+	{ 30585, 41931, 17992 },
+	{ 24786, 41931, 19137 },
+	{ 24786, 41931, 19137 },
+	{ 24582, 41178, 18660 },
+	{ 30585, 41178, 17474 },
+	{ 36109, 41931, 19784 },
+	{ 36187, 41178, 19600 },
+	{ 30585, 41178, 18494 },
+	{ 30585, 41178, 18494 },
+	{ 30585, 41931, 18693 },
+	{ 36109, 41931, 19784 },
+	{ 36199, 42181, 19571 },
+	{ 36109, 41931, 19784 },
+	{ 30585, 41931, 18693 },
+	{ 30585, 41931, 18693 },
+	{ 30585, 42181, 18462 },
+	{ 36199, 42181, 19571 },
+	{ 36384, 41931, 19137 },
+	{ 36199, 42181, 19571 },
+	{ 30585, 42181, 18462 },
+	{ 30585, 42181, 18462 },
+	{ 30585, 41931, 17992 },
+	{ 36384, 41931, 19137 },
+	{ 36587, 41178, 18660 },
+	{ 36384, 41931, 19137 },
+	{ 30585, 41931, 17992 },
+	{ 30585, 41931, 17992 },
+	{ 30585, 41178, 17474 },
+	{ 36587, 41178, 18660 },
+	{ 40577, 41931, 22775 },
+	{ 40719, 41178, 22633 },
+	{ 36187, 41178, 19600 },
+	{ 36187, 41178, 19600 },
+	{ 36109, 41931, 19784 },
+	{ 40577, 41931, 22775 },
+	{ 40741, 42181, 22611 },
+	{ 40577, 41931, 22775 },
+	{ 36109, 41931, 19784 },
+	{ 36109, 41931, 19784 },
+	{ 36199, 42181, 19571 },
+	{ 40741, 42181, 22611 },
+	{ 41075, 41931, 22277 },
+	{ 40741, 42181, 22611 },
+	{ 36199, 42181, 19571 },
+	{ 36199, 42181, 19571 },
+	{ 36384, 41931, 19137 },
+	{ 41075, 41931, 22277 },
+	{ 41442, 41178, 21909 },
+	{ 41075, 41931, 22277 },
+	{ 36384, 41931, 19137 },
+	{ 36384, 41931, 19137 },
+	{ 36587, 41178, 18660 },
+	{ 41442, 41178, 21909 },
+	{ 43568, 41931, 27243 },
+	{ 43752, 41178, 27165 },
+	{ 40719, 41178, 22633 },
+	{ 40719, 41178, 22633 },
+	{ 40577, 41931, 22775 },
+	{ 43568, 41931, 27243 },
+	{ 43781, 42181, 27152 },
+	{ 43568, 41931, 27243 },
+	{ 40577, 41931, 22775 },
+	{ 40577, 41931, 22775 },
+	{ 40741, 42181, 22611 },
+	{ 43781, 42181, 27152 },
+	{ 44214, 41931, 26968 },
+	{ 43781, 42181, 27152 },
+	{ 40741, 42181, 22611 },
+	{ 40741, 42181, 22611 },
+	{ 41075, 41931, 22277 },
+	{ 44214, 41931, 26968 },
+	{ 44692, 41178, 26765 },
+	{ 44214, 41931, 26968 },
+	{ 41075, 41931, 22277 },
+	{ 41075, 41931, 22277 },
+	{ 41442, 41178, 21909 },
+	{ 44692, 41178, 26765 },
+	{ 44659, 41931, 32767 },
+	{ 44858, 41178, 32767 },
+	{ 43752, 41178, 27165 },
+	{ 43752, 41178, 27165 },
+	{ 43568, 41931, 27243 },
+	{ 44659, 41931, 32767 },
+	{ 44890, 42181, 32767 },
+	{ 44659, 41931, 32767 },
+	{ 43568, 41931, 27243 },
+	{ 43568, 41931, 27243 },
+	{ 43781, 42181, 27152 },
+	{ 44890, 42181, 32767 },
+	{ 45359, 41931, 32767 },
+	{ 44890, 42181, 32767 },
+	{ 43781, 42181, 27152 },
+	{ 43781, 42181, 27152 },
+	{ 44214, 41931, 26968 },
+	{ 45359, 41931, 32767 },
+	{ 45877, 41178, 32767 },
+	{ 45359, 41931, 32767 },
+	{ 44214, 41931, 26968 },
+	{ 44214, 41931, 26968 },
+	{ 44692, 41178, 26765 },
+	{ 45877, 41178, 32767 },
+	{ 46419, 37176, 39504 },
+	{ 44692, 41178, 38769 },
+	{ 45877, 41178, 32767 },
+	{ 45877, 41178, 32767 },
+	{ 47749, 37176, 32767 },
+	{ 46419, 37176, 39504 },
+	{ 47925, 33245, 40145 },
+	{ 46419, 37176, 39504 },
+	{ 47749, 37176, 32767 },
+	{ 47749, 37176, 32767 },
+	{ 49382, 33245, 32767 },
+	{ 47925, 33245, 40145 },
+	{ 48990, 29458, 40598 },
+	{ 47925, 33245, 40145 },
+	{ 49382, 33245, 32767 },
+	{ 49382, 33245, 32767 },
+	{ 50537, 29458, 32767 },
+	{ 48990, 29458, 40598 },
+	{ 49394, 25885, 40770 },
+	{ 48990, 29458, 40598 },
+	{ 50537, 29458, 32767 },
+	{ 50537, 29458, 32767 },
+	{ 50975, 25885, 32767 },
+	{ 49394, 25885, 40770 },
+	{ 42771, 37176, 44954 },
+	{ 41442, 41178, 43625 },
+	{ 44692, 41178, 38769 },
+	{ 44692, 41178, 38769 },
+	{ 46419, 37176, 39504 },
+	{ 42771, 37176, 44954 },
+	{ 43931, 33245, 46113 },
+	{ 42771, 37176, 44954 },
+	{ 46419, 37176, 39504 },
+	{ 46419, 37176, 39504 },
+	{ 47925, 33245, 40145 },
+	{ 43931, 33245, 46113 },
+	{ 44751, 29458, 46933 },
+	{ 43931, 33245, 46113 },
+	{ 47925, 33245, 40145 },
+	{ 47925, 33245, 40145 },
+	{ 48990, 29458, 40598 },
+	{ 44751, 29458, 46933 },
+	{ 45062, 25885, 47244 },
+	{ 44751, 29458, 46933 },
+	{ 48990, 29458, 40598 },
+	{ 48990, 29458, 40598 },
+	{ 49394, 25885, 40770 },
+	{ 45062, 25885, 47244 },
+	{ 37322, 37176, 48601 },
+	{ 36587, 41178, 46874 },
+	{ 41442, 41178, 43625 },
+	{ 41442, 41178, 43625 },
+	{ 42771, 37176, 44954 },
+	{ 37322, 37176, 48601 },
+	{ 37963, 33245, 50107 },
+	{ 37322, 37176, 48601 },
+	{ 42771, 37176, 44954 },
+	{ 42771, 37176, 44954 },
+	{ 43931, 33245, 46113 },
+	{ 37963, 33245, 50107 },
+	{ 38416, 29458, 51173 },
+	{ 37963, 33245, 50107 },
+	{ 43931, 33245, 46113 },
+	{ 43931, 33245, 46113 },
+	{ 44751, 29458, 46933 },
+	{ 38416, 29458, 51173 },
+	{ 38588, 25885, 51577 },
+	{ 38416, 29458, 51173 },
+	{ 44751, 29458, 46933 },
+	{ 44751, 29458, 46933 },
+	{ 45062, 25885, 47244 },
+	{ 38588, 25885, 51577 },
+	{ 30585, 37176, 49931 },
+	{ 30585, 41178, 48060 },
+	{ 36587, 41178, 46874 },
+	{ 36587, 41178, 46874 },
+	{ 37322, 37176, 48601 },
+	{ 30585, 37176, 49931 },
+	{ 30585, 33245, 51564 },
+	{ 30585, 37176, 49931 },
+	{ 37322, 37176, 48601 },
+	{ 37322, 37176, 48601 },
+	{ 37963, 33245, 50107 },
+	{ 30585, 33245, 51564 },
+	{ 30585, 29458, 52719 },
+	{ 30585, 33245, 51564 },
+	{ 37963, 33245, 50107 },
+	{ 37963, 33245, 50107 },
+	{ 38416, 29458, 51173 },
+	{ 30585, 29458, 52719 },
+	{ 30585, 25885, 53157 },
+	{ 30585, 29458, 52719 },
+	{ 38416, 29458, 51173 },
+	{ 38416, 29458, 51173 },
+	{ 38588, 25885, 51577 },
+	{ 30585, 25885, 53157 },
+	{ 23848, 37176, 48601 },
+	{ 24582, 41178, 46874 },
+	{ 30585, 41178, 48060 },
+	{ 30585, 41178, 48060 },
+	{ 30585, 37176, 49931 },
+	{ 23848, 37176, 48601 },
+	{ 23207, 33245, 50107 },
+	{ 23848, 37176, 48601 },
+	{ 30585, 37176, 49931 },
+	{ 30585, 37176, 49931 },
+	{ 30585, 33245, 51564 },
+	{ 23207, 33245, 50107 },
+	{ 22753, 29458, 51173 },
+	{ 23207, 33245, 50107 },
+	{ 30585, 33245, 51564 },
+	{ 30585, 33245, 51564 },
+	{ 30585, 29458, 52719 },
+	{ 22753, 29458, 51173 },
+	{ 22582, 25885, 51577 },
+	{ 22753, 29458, 51173 },
+	{ 30585, 29458, 52719 },
+	{ 30585, 29458, 52719 },
+	{ 30585, 25885, 53157 },
+	{ 22582, 25885, 51577 },
+	{ 18398, 37176, 44954 },
+	{ 19727, 41178, 43625 },
+	{ 24582, 41178, 46874 },
+	{ 24582, 41178, 46874 },
+	{ 23848, 37176, 48601 },
+	{ 18398, 37176, 44954 },
+	{ 17239, 33245, 46113 },
+	{ 18398, 37176, 44954 },
+	{ 23848, 37176, 48601 },
+	{ 23848, 37176, 48601 },
+	{ 23207, 33245, 50107 },
+	{ 17239, 33245, 46113 },
+	{ 16419, 29458, 46933 },
+	{ 17239, 33245, 46113 },
+	{ 23207, 33245, 50107 },
+	{ 23207, 33245, 50107 },
+	{ 22753, 29458, 51173 },
+	{ 16419, 29458, 46933 },
+	{ 16108, 25885, 47244 },
+	{ 16419, 29458, 46933 },
+	{ 22753, 29458, 51173 },
+	{ 22753, 29458, 51173 },
+	{ 22582, 25885, 51577 },
+	{ 16108, 25885, 47244 },
+	{ 14751, 37176, 39504 },
+	{ 16477, 41178, 38769 },
+	{ 19727, 41178, 43625 },
+	{ 19727, 41178, 43625 },
+	{ 18398, 37176, 44954 },
+	{ 14751, 37176, 39504 },
+	{ 13244, 33245, 40145 },
+	{ 14751, 37176, 39504 },
+	{ 18398, 37176, 44954 },
+	{ 18398, 37176, 44954 },
+	{ 17239, 33245, 46113 },
+	{ 13244, 33245, 40145 },
+	{ 12179, 29458, 40598 },
+	{ 13244, 33245, 40145 },
+	{ 17239, 33245, 46113 },
+	{ 17239, 33245, 46113 },
+	{ 16419, 29458, 46933 },
+	{ 12179, 29458, 40598 },
+	{ 11775, 25885, 40770 },
+	{ 12179, 29458, 40598 },
+	{ 16419, 29458, 46933 },
+	{ 16419, 29458, 46933 },
+	{ 16108, 25885, 47244 },
+	{ 11775, 25885, 40770 },
+	{ 13420, 37176, 32767 },
+	{ 15292, 41178, 32767 },
+	{ 16477, 41178, 38769 },
+	{ 16477, 41178, 38769 },
+	{ 14751, 37176, 39504 },
+	{ 13420, 37176, 32767 },
+	{ 11788, 33245, 32767 },
+	{ 13420, 37176, 32767 },
+	{ 14751, 37176, 39504 },
+	{ 14751, 37176, 39504 },
+	{ 13244, 33245, 40145 },
+	{ 11788, 33245, 32767 },
+	{ 10633, 29458, 32767 },
+	{ 11788, 33245, 32767 },
+	{ 13244, 33245, 40145 },
+	{ 13244, 33245, 40145 },
+	{ 12179, 29458, 40598 },
+	{ 10633, 29458, 32767 },
+	{ 10195, 25885, 32767 },
+	{ 10633, 29458, 32767 },
+	{ 12179, 29458, 40598 },
+	{ 12179, 29458, 40598 },
+	{ 11775, 25885, 40770 },
+	{ 10195, 25885, 32767 },
+	{ 14751, 37176, 26030 },
+	{ 16477, 41178, 26765 },
+	{ 15292, 41178, 32767 },
+	{ 15292, 41178, 32767 },
+	{ 13420, 37176, 32767 },
+	{ 14751, 37176, 26030 },
+	{ 13244, 33245, 25389 },
+	{ 14751, 37176, 26030 },
+	{ 13420, 37176, 32767 },
+	{ 13420, 37176, 32767 },
+	{ 11788, 33245, 32767 },
+	{ 13244, 33245, 25389 },
+	{ 12179, 29458, 24936 },
+	{ 13244, 33245, 25389 },
+	{ 11788, 33245, 32767 },
+	{ 11788, 33245, 32767 },
+	{ 10633, 29458, 32767 },
+	{ 12179, 29458, 24936 },
+	{ 11775, 25885, 24764 },
+	{ 12179, 29458, 24936 },
+	{ 10633, 29458, 32767 },
+	{ 10633, 29458, 32767 },
+	{ 10195, 25885, 32767 },
+	{ 11775, 25885, 24764 },
+	{ 18398, 37176, 20580 },
+	{ 19727, 41178, 21909 },
+	{ 16477, 41178, 26765 },
+	{ 16477, 41178, 26765 },
+	{ 14751, 37176, 26030 },
+	{ 18398, 37176, 20580 },
+	{ 17239, 33245, 19421 },
+	{ 18398, 37176, 20580 },
+	{ 14751, 37176, 26030 },
+	{ 14751, 37176, 26030 },
+	{ 13244, 33245, 25389 },
+	{ 17239, 33245, 19421 },
+	{ 16419, 29458, 18601 },
+	{ 17239, 33245, 19421 },
+	{ 13244, 33245, 25389 },
+	{ 13244, 33245, 25389 },
+	{ 12179, 29458, 24936 },
+	{ 16419, 29458, 18601 },
+	{ 16108, 25885, 18290 },
+	{ 16419, 29458, 18601 },
+	{ 12179, 29458, 24936 },
+	{ 12179, 29458, 24936 },
+	{ 11775, 25885, 24764 },
+	{ 16108, 25885, 18290 },
+	{ 23848, 37176, 16933 },
+	{ 24582, 41178, 18660 },
+	{ 19727, 41178, 21909 },
+	{ 19727, 41178, 21909 },
+	{ 18398, 37176, 20580 },
+	{ 23848, 37176, 16933 },
+	{ 23207, 33245, 15427 },
+	{ 23848, 37176, 16933 },
+	{ 18398, 37176, 20580 },
+	{ 18398, 37176, 20580 },
+	{ 17239, 33245, 19421 },
+	{ 23207, 33245, 15427 },
+	{ 22753, 29458, 14361 },
+	{ 23207, 33245, 15427 },
+	{ 17239, 33245, 19421 },
+	{ 17239, 33245, 19421 },
+	{ 16419, 29458, 18601 },
+	{ 22753, 29458, 14361 },
+	{ 22582, 25885, 13957 },
+	{ 22753, 29458, 14361 },
+	{ 16419, 29458, 18601 },
+	{ 16419, 29458, 18601 },
+	{ 16108, 25885, 18290 },
+	{ 22582, 25885, 13957 },
+	{ 30585, 37176, 15603 },
+	{ 30585, 41178, 17474 },
+	{ 24582, 41178, 18660 },
+	{ 24582, 41178, 18660 },
+	{ 23848, 37176, 16933 },
+	{ 30585, 37176, 15603 },
+	{ 30585, 33245, 13970 },
+	{ 30585, 37176, 15603 },
+	{ 23848, 37176, 16933 },
+	{ 23848, 37176, 16933 },
+	{ 23207, 33245, 15427 },
+	{ 30585, 33245, 13970 },
+	{ 30585, 29458, 12815 },
+	{ 30585, 33245, 13970 },
+	{ 23207, 33245, 15427 },
+	{ 23207, 33245, 15427 },
+	{ 22753, 29458, 14361 },
+	{ 30585, 29458, 12815 },
+	{ 30585, 25885, 12377 },
+	{ 30585, 29458, 12815 },
+	{ 22753, 29458, 14361 },
+	{ 22753, 29458, 14361 },
+	{ 22582, 25885, 13957 },
+	{ 30585, 25885, 12377 },
+	{ 37322, 37176, 16933 },
+	{ 36587, 41178, 18660 },
+	{ 30585, 41178, 17474 },
+	{ 30585, 41178, 17474 },
+	{ 30585, 37176, 15603 },
+	{ 37322, 37176, 16933 },
+	{ 37963, 33245, 15427 },
+	{ 37322, 37176, 16933 },
+	{ 30585, 37176, 15603 },
+	{ 30585, 37176, 15603 },
+	{ 30585, 33245, 13970 },
+	{ 37963, 33245, 15427 },
+	{ 38416, 29458, 14361 },
+	{ 37963, 33245, 15427 },
+	{ 30585, 33245, 13970 },
+	{ 30585, 33245, 13970 },
+	{ 30585, 29458, 12815 },
+	{ 38416, 29458, 14361 },
+	{ 38588, 25885, 13957 },
+	{ 38416, 29458, 14361 },
+	{ 30585, 29458, 12815 },
+	{ 30585, 29458, 12815 },
+	{ 30585, 25885, 12377 },
+	{ 38588, 25885, 13957 },
+	{ 42771, 37176, 20580 },
+	{ 41442, 41178, 21909 },
+	{ 36587, 41178, 18660 },
+	{ 36587, 41178, 18660 },
+	{ 37322, 37176, 16933 },
+	{ 42771, 37176, 20580 },
+	{ 43931, 33245, 19421 },
+	{ 42771, 37176, 20580 },
+	{ 37322, 37176, 16933 },
+	{ 37322, 37176, 16933 },
+	{ 37963, 33245, 15427 },
+	{ 43931, 33245, 19421 },
+	{ 44751, 29458, 18601 },
+	{ 43931, 33245, 19421 },
+	{ 37963, 33245, 15427 },
+	{ 37963, 33245, 15427 },
+	{ 38416, 29458, 14361 },
+	{ 44751, 29458, 18601 },
+	{ 45062, 25885, 18290 },
+	{ 44751, 29458, 18601 },
+	{ 38416, 29458, 14361 },
+	{ 38416, 29458, 14361 },
+	{ 38588, 25885, 13957 },
+	{ 45062, 25885, 18290 },
+	{ 46419, 37176, 26030 },
+	{ 44692, 41178, 26765 },
+	{ 41442, 41178, 21909 },
+	{ 41442, 41178, 21909 },
+	{ 42771, 37176, 20580 },
+	{ 46419, 37176, 26030 },
+	{ 47925, 33245, 25389 },
+	{ 46419, 37176, 26030 },
+	{ 42771, 37176, 20580 },
+	{ 42771, 37176, 20580 },
+	{ 43931, 33245, 19421 },
+	{ 47925, 33245, 25389 },
+	{ 48990, 29458, 24936 },
+	{ 47925, 33245, 25389 },
+	{ 43931, 33245, 19421 },
+	{ 43931, 33245, 19421 },
+	{ 44751, 29458, 18601 },
+	{ 48990, 29458, 24936 },
+	{ 49394, 25885, 24764 },
+	{ 48990, 29458, 24936 },
+	{ 44751, 29458, 18601 },
+	{ 44751, 29458, 18601 },
+	{ 45062, 25885, 18290 },
+	{ 49394, 25885, 24764 },
+	{ 47749, 37176, 32767 },
+	{ 45877, 41178, 32767 },
+	{ 44692, 41178, 26765 },
+	{ 44692, 41178, 26765 },
+	{ 46419, 37176, 26030 },
+	{ 47749, 37176, 32767 },
+	{ 49382, 33245, 32767 },
+	{ 47749, 37176, 32767 },
+	{ 46419, 37176, 26030 },
+	{ 46419, 37176, 26030 },
+	{ 47925, 33245, 25389 },
+	{ 49382, 33245, 32767 },
+	{ 50537, 29458, 32767 },
+	{ 49382, 33245, 32767 },
+	{ 47925, 33245, 25389 },
+	{ 47925, 33245, 25389 },
+	{ 48990, 29458, 24936 },
+	{ 50537, 29458, 32767 },
+	{ 50975, 25885, 32767 },
+	{ 50537, 29458, 32767 },
+	{ 48990, 29458, 24936 },
+	{ 48990, 29458, 24936 },
+	{ 49394, 25885, 24764 },
+	{ 50975, 25885, 32767 },
+	{ 48660, 22863, 40457 },
+	{ 49394, 25885, 40770 },
+	{ 50975, 25885, 32767 },
+	{ 50975, 25885, 32767 },
+	{ 50178, 22863, 32767 },
+	{ 48660, 22863, 40457 },
+	{ 47043, 20629, 39770 },
+	{ 48660, 22863, 40457 },
+	{ 50178, 22863, 32767 },
+	{ 50178, 22863, 32767 },
+	{ 48426, 20629, 32767 },
+	{ 47043, 20629, 39770 },
+	{ 45427, 19111, 39082 },
+	{ 47043, 20629, 39770 },
+	{ 48426, 20629, 32767 },
+	{ 48426, 20629, 32767 },
+	{ 46674, 19111, 32767 },
+	{ 45427, 19111, 39082 },
+	{ 44692, 18239, 38769 },
+	{ 45427, 19111, 39082 },
+	{ 46674, 19111, 32767 },
+	{ 46674, 19111, 32767 },
+	{ 45877, 18239, 32767 },
+	{ 44692, 18239, 38769 },
+	{ 44496, 22863, 46678 },
+	{ 45062, 25885, 47244 },
+	{ 49394, 25885, 40770 },
+	{ 49394, 25885, 40770 },
+	{ 48660, 22863, 40457 },
+	{ 44496, 22863, 46678 },
+	{ 43252, 20629, 45434 },
+	{ 44496, 22863, 46678 },
+	{ 48660, 22863, 40457 },
+	{ 48660, 22863, 40457 },
+	{ 47043, 20629, 39770 },
+	{ 43252, 20629, 45434 },
+	{ 42008, 19111, 44190 },
+	{ 43252, 20629, 45434 },
+	{ 47043, 20629, 39770 },
+	{ 47043, 20629, 39770 },
+	{ 45427, 19111, 39082 },
+	{ 42008, 19111, 44190 },
+	{ 41442, 18239, 43625 },
+	{ 42008, 19111, 44190 },
+	{ 45427, 19111, 39082 },
+	{ 45427, 19111, 39082 },
+	{ 44692, 18239, 38769 },
+	{ 41442, 18239, 43625 },
+	{ 38275, 22863, 50842 },
+	{ 38588, 25885, 51577 },
+	{ 45062, 25885, 47244 },
+	{ 45062, 25885, 47244 },
+	{ 44496, 22863, 46678 },
+	{ 38275, 22863, 50842 },
+	{ 37587, 20629, 49226 },
+	{ 38275, 22863, 50842 },
+	{ 44496, 22863, 46678 },
+	{ 44496, 22863, 46678 },
+	{ 43252, 20629, 45434 },
+	{ 37587, 20629, 49226 },
+	{ 36900, 19111, 47609 },
+	{ 37587, 20629, 49226 },
+	{ 43252, 20629, 45434 },
+	{ 43252, 20629, 45434 },
+	{ 42008, 19111, 44190 },
+	{ 36900, 19111, 47609 },
+	{ 36587, 18239, 46874 },
+	{ 36900, 19111, 47609 },
+	{ 42008, 19111, 44190 },
+	{ 42008, 19111, 44190 },
+	{ 41442, 18239, 43625 },
+	{ 36587, 18239, 46874 },
+	{ 30585, 22863, 52361 },
+	{ 30585, 25885, 53157 },
+	{ 38588, 25885, 51577 },
+	{ 38588, 25885, 51577 },
+	{ 38275, 22863, 50842 },
+	{ 30585, 22863, 52361 },
+	{ 30585, 20629, 50608 },
+	{ 30585, 22863, 52361 },
+	{ 38275, 22863, 50842 },
+	{ 38275, 22863, 50842 },
+	{ 37587, 20629, 49226 },
+	{ 30585, 20629, 50608 },
+	{ 30585, 19111, 48856 },
+	{ 30585, 20629, 50608 },
+	{ 37587, 20629, 49226 },
+	{ 37587, 20629, 49226 },
+	{ 36900, 19111, 47609 },
+	{ 30585, 19111, 48856 },
+	{ 30585, 18239, 48060 },
+	{ 30585, 19111, 48856 },
+	{ 36900, 19111, 47609 },
+	{ 36900, 19111, 47609 },
+	{ 36587, 18239, 46874 },
+	{ 30585, 18239, 48060 },
+	{ 22894, 22863, 50842 },
+	{ 22582, 25885, 51577 },
+	{ 30585, 25885, 53157 },
+	{ 30585, 25885, 53157 },
+	{ 30585, 22863, 52361 },
+	{ 22894, 22863, 50842 },
+	{ 23582, 20629, 49226 },
+	{ 22894, 22863, 50842 },
+	{ 30585, 22863, 52361 },
+	{ 30585, 22863, 52361 },
+	{ 30585, 20629, 50608 },
+	{ 23582, 20629, 49226 },
+	{ 24270, 19111, 47609 },
+	{ 23582, 20629, 49226 },
+	{ 30585, 20629, 50608 },
+	{ 30585, 20629, 50608 },
+	{ 30585, 19111, 48856 },
+	{ 24270, 19111, 47609 },
+	{ 24582, 18239, 46874 },
+	{ 24270, 19111, 47609 },
+	{ 30585, 19111, 48856 },
+	{ 30585, 19111, 48856 },
+	{ 30585, 18239, 48060 },
+	{ 24582, 18239, 46874 },
+	{ 16673, 22863, 46678 },
+	{ 16108, 25885, 47244 },
+	{ 22582, 25885, 51577 },
+	{ 22582, 25885, 51577 },
+	{ 22894, 22863, 50842 },
+	{ 16673, 22863, 46678 },
+	{ 17917, 20629, 45434 },
+	{ 16673, 22863, 46678 },
+	{ 22894, 22863, 50842 },
+	{ 22894, 22863, 50842 },
+	{ 23582, 20629, 49226 },
+	{ 17917, 20629, 45434 },
+	{ 19161, 19111, 44190 },
+	{ 17917, 20629, 45434 },
+	{ 23582, 20629, 49226 },
+	{ 23582, 20629, 49226 },
+	{ 24270, 19111, 47609 },
+	{ 19161, 19111, 44190 },
+	{ 19727, 18239, 43625 },
+	{ 19161, 19111, 44190 },
+	{ 24270, 19111, 47609 },
+	{ 24270, 19111, 47609 },
+	{ 24582, 18239, 46874 },
+	{ 19727, 18239, 43625 },
+	{ 12510, 22863, 40457 },
+	{ 11775, 25885, 40770 },
+	{ 16108, 25885, 47244 },
+	{ 16108, 25885, 47244 },
+	{ 16673, 22863, 46678 },
+	{ 12510, 22863, 40457 },
+	{ 14126, 20629, 39770 },
+	{ 12510, 22863, 40457 },
+	{ 16673, 22863, 46678 },
+	{ 16673, 22863, 46678 },
+	{ 17917, 20629, 45434 },
+	{ 14126, 20629, 39770 },
+	{ 15742, 19111, 39082 },
+	{ 14126, 20629, 39770 },
+	{ 17917, 20629, 45434 },
+	{ 17917, 20629, 45434 },
+	{ 19161, 19111, 44190 },
+	{ 15742, 19111, 39082 },
+	{ 16477, 18239, 38769 },
+	{ 15742, 19111, 39082 },
+	{ 19161, 19111, 44190 },
+	{ 19161, 19111, 44190 },
+	{ 19727, 18239, 43625 },
+	{ 16477, 18239, 38769 },
+	{ 10991, 22863, 32767 },
+	{ 10195, 25885, 32767 },
+	{ 11775, 25885, 40770 },
+	{ 11775, 25885, 40770 },
+	{ 12510, 22863, 40457 },
+	{ 10991, 22863, 32767 },
+	{ 12743, 20629, 32767 },
+	{ 10991, 22863, 32767 },
+	{ 12510, 22863, 40457 },
+	{ 12510, 22863, 40457 },
+	{ 14126, 20629, 39770 },
+	{ 12743, 20629, 32767 },
+	{ 14496, 19111, 32767 },
+	{ 12743, 20629, 32767 },
+	{ 14126, 20629, 39770 },
+	{ 14126, 20629, 39770 },
+	{ 15742, 19111, 39082 },
+	{ 14496, 19111, 32767 },
+	{ 15292, 18239, 32767 },
+	{ 14496, 19111, 32767 },
+	{ 15742, 19111, 39082 },
+	{ 15742, 19111, 39082 },
+	{ 16477, 18239, 38769 },
+	{ 15292, 18239, 32767 },
+	{ 12510, 22863, 25077 },
+	{ 11775, 25885, 24764 },
+	{ 10195, 25885, 32767 },
+	{ 10195, 25885, 32767 },
+	{ 10991, 22863, 32767 },
+	{ 12510, 22863, 25077 },
+	{ 14126, 20629, 25764 },
+	{ 12510, 22863, 25077 },
+	{ 10991, 22863, 32767 },
+	{ 10991, 22863, 32767 },
+	{ 12743, 20629, 32767 },
+	{ 14126, 20629, 25764 },
+	{ 15742, 19111, 26452 },
+	{ 14126, 20629, 25764 },
+	{ 12743, 20629, 32767 },
+	{ 12743, 20629, 32767 },
+	{ 14496, 19111, 32767 },
+	{ 15742, 19111, 26452 },
+	{ 16477, 18239, 26765 },
+	{ 15742, 19111, 26452 },
+	{ 14496, 19111, 32767 },
+	{ 14496, 19111, 32767 },
+	{ 15292, 18239, 32767 },
+	{ 16477, 18239, 26765 },
+	{ 16673, 22863, 18856 },
+	{ 16108, 25885, 18290 },
+	{ 11775, 25885, 24764 },
+	{ 11775, 25885, 24764 },
+	{ 12510, 22863, 25077 },
+	{ 16673, 22863, 18856 },
+	{ 17917, 20629, 20100 },
+	{ 16673, 22863, 18856 },
+	{ 12510, 22863, 25077 },
+	{ 12510, 22863, 25077 },
+	{ 14126, 20629, 25764 },
+	{ 17917, 20629, 20100 },
+	{ 19161, 19111, 21344 },
+	{ 17917, 20629, 20100 },
+	{ 14126, 20629, 25764 },
+	{ 14126, 20629, 25764 },
+	{ 15742, 19111, 26452 },
+	{ 19161, 19111, 21344 },
+	{ 19727, 18239, 21909 },
+	{ 19161, 19111, 21344 },
+	{ 15742, 19111, 26452 },
+	{ 15742, 19111, 26452 },
+	{ 16477, 18239, 26765 },
+	{ 19727, 18239, 21909 },
+	{ 22894, 22863, 14692 },
+	{ 22582, 25885, 13957 },
+	{ 16108, 25885, 18290 },
+	{ 16108, 25885, 18290 },
+	{ 16673, 22863, 18856 },
+	{ 22894, 22863, 14692 },
+	{ 23582, 20629, 16308 },
+	{ 22894, 22863, 14692 },
+	{ 16673, 22863, 18856 },
+	{ 16673, 22863, 18856 },
+	{ 17917, 20629, 20100 },
+	{ 23582, 20629, 16308 },
+	{ 24270, 19111, 17925 },
+	{ 23582, 20629, 16308 },
+	{ 17917, 20629, 20100 },
+	{ 17917, 20629, 20100 },
+	{ 19161, 19111, 21344 },
+	{ 24270, 19111, 17925 },
+	{ 24582, 18239, 18660 },
+	{ 24270, 19111, 17925 },
+	{ 19161, 19111, 21344 },
+	{ 19161, 19111, 21344 },
+	{ 19727, 18239, 21909 },
+	{ 24582, 18239, 18660 },
+	{ 30585, 22863, 13173 },
+	{ 30585, 25885, 12377 },
+	{ 22582, 25885, 13957 },
+	{ 22582, 25885, 13957 },
+	{ 22894, 22863, 14692 },
+	{ 30585, 22863, 13173 },
+	{ 30585, 20629, 14926 },
+	{ 30585, 22863, 13173 },
+	{ 22894, 22863, 14692 },
+	{ 22894, 22863, 14692 },
+	{ 23582, 20629, 16308 },
+	{ 30585, 20629, 14926 },
+	{ 30585, 19111, 16678 },
+	{ 30585, 20629, 14926 },
+	{ 23582, 20629, 16308 },
+	{ 23582, 20629, 16308 },
+	{ 24270, 19111, 17925 },
+	{ 30585, 19111, 16678 },
+	{ 30585, 18239, 17474 },
+	{ 30585, 19111, 16678 },
+	{ 24270, 19111, 17925 },
+	{ 24270, 19111, 17925 },
+	{ 24582, 18239, 18660 },
+	{ 30585, 18239, 17474 },
+	{ 38275, 22863, 14692 },
+	{ 38588, 25885, 13957 },
+	{ 30585, 25885, 12377 },
+	{ 30585, 25885, 12377 },
+	{ 30585, 22863, 13173 },
+	{ 38275, 22863, 14692 },
+	{ 37587, 20629, 16308 },
+	{ 38275, 22863, 14692 },
+	{ 30585, 22863, 13173 },
+	{ 30585, 22863, 13173 },
+	{ 30585, 20629, 14926 },
+	{ 37587, 20629, 16308 },
+	{ 36900, 19111, 17925 },
+	{ 37587, 20629, 16308 },
+	{ 30585, 20629, 14926 },
+	{ 30585, 20629, 14926 },
+	{ 30585, 19111, 16678 },
+	{ 36900, 19111, 17925 },
+	{ 36587, 18239, 18660 },
+	{ 36900, 19111, 17925 },
+	{ 30585, 19111, 16678 },
+	{ 30585, 19111, 16678 },
+	{ 30585, 18239, 17474 },
+	{ 36587, 18239, 18660 },
+	{ 44496, 22863, 18856 },
+	{ 45062, 25885, 18290 },
+	{ 38588, 25885, 13957 },
+	{ 38588, 25885, 13957 },
+	{ 38275, 22863, 14692 },
+	{ 44496, 22863, 18856 },
+	{ 43252, 20629, 20100 },
+	{ 44496, 22863, 18856 },
+	{ 38275, 22863, 14692 },
+	{ 38275, 22863, 14692 },
+	{ 37587, 20629, 16308 },
+	{ 43252, 20629, 20100 },
+	{ 42008, 19111, 21344 },
+	{ 43252, 20629, 20100 },
+	{ 37587, 20629, 16308 },
+	{ 37587, 20629, 16308 },
+	{ 36900, 19111, 17925 },
+	{ 42008, 19111, 21344 },
+	{ 41442, 18239, 21909 },
+	{ 42008, 19111, 21344 },
+	{ 36900, 19111, 17925 },
+	{ 36900, 19111, 17925 },
+	{ 36587, 18239, 18660 },
+	{ 41442, 18239, 21909 },
+	{ 48660, 22863, 25077 },
+	{ 49394, 25885, 24764 },
+	{ 45062, 25885, 18290 },
+	{ 45062, 25885, 18290 },
+	{ 44496, 22863, 18856 },
+	{ 48660, 22863, 25077 },
+	{ 47043, 20629, 25764 },
+	{ 48660, 22863, 25077 },
+	{ 44496, 22863, 18856 },
+	{ 44496, 22863, 18856 },
+	{ 43252, 20629, 20100 },
+	{ 47043, 20629, 25764 },
+	{ 45427, 19111, 26452 },
+	{ 47043, 20629, 25764 },
+	{ 43252, 20629, 20100 },
+	{ 43252, 20629, 20100 },
+	{ 42008, 19111, 21344 },
+	{ 45427, 19111, 26452 },
+	{ 44692, 18239, 26765 },
+	{ 45427, 19111, 26452 },
+	{ 42008, 19111, 21344 },
+	{ 42008, 19111, 21344 },
+	{ 41442, 18239, 21909 },
+	{ 44692, 18239, 26765 },
+	{ 50178, 22863, 32767 },
+	{ 50975, 25885, 32767 },
+	{ 49394, 25885, 24764 },
+	{ 49394, 25885, 24764 },
+	{ 48660, 22863, 25077 },
+	{ 50178, 22863, 32767 },
+	{ 48426, 20629, 32767 },
+	{ 50178, 22863, 32767 },
+	{ 48660, 22863, 25077 },
+	{ 48660, 22863, 25077 },
+	{ 47043, 20629, 25764 },
+	{ 48426, 20629, 32767 },
+	{ 46674, 19111, 32767 },
+	{ 48426, 20629, 32767 },
+	{ 47043, 20629, 25764 },
+	{ 47043, 20629, 25764 },
+	{ 45427, 19111, 26452 },
+	{ 46674, 19111, 32767 },
+	{ 45877, 18239, 32767 },
+	{ 46674, 19111, 32767 },
+	{ 45427, 19111, 26452 },
+	{ 45427, 19111, 26452 },
+	{ 44692, 18239, 26765 },
+	{ 45877, 18239, 32767 },
+	{ 44372, 17678, 38633 },
+	{ 44692, 18239, 38769 },
+	{ 45877, 18239, 32767 },
+	{ 45877, 18239, 32767 },
+	{ 45531, 17678, 32767 },
+	{ 44372, 17678, 38633 },
+	{ 42664, 17188, 37906 },
+	{ 44372, 17678, 38633 },
+	{ 45531, 17678, 32767 },
+	{ 45531, 17678, 32767 },
+	{ 43679, 17188, 32767 },
+	{ 42664, 17188, 37906 },
+	{ 38443, 16841, 36110 },
+	{ 42664, 17188, 37906 },
+	{ 43679, 17188, 32767 },
+	{ 43679, 17188, 32767 },
+	{ 39103, 16841, 32767 },
+	{ 38443, 16841, 36110 },
+	{ 30585, 16710, 32767 },
+	{ 38443, 16841, 36110 },
+	{ 39103, 16841, 32767 },
+	{ 39103, 16841, 32767 },
+	{ 30585, 16710, 32767 },
+	{ 30585, 16710, 32767 },
+	{ 41196, 17678, 43379 },
+	{ 41442, 18239, 43625 },
+	{ 44692, 18239, 38769 },
+	{ 44692, 18239, 38769 },
+	{ 44372, 17678, 38633 },
+	{ 41196, 17678, 43379 },
+	{ 39882, 17188, 42064 },
+	{ 41196, 17678, 43379 },
+	{ 44372, 17678, 38633 },
+	{ 44372, 17678, 38633 },
+	{ 42664, 17188, 37906 },
+	{ 39882, 17188, 42064 },
+	{ 36633, 16841, 38815 },
+	{ 39882, 17188, 42064 },
+	{ 42664, 17188, 37906 },
+	{ 42664, 17188, 37906 },
+	{ 38443, 16841, 36110 },
+	{ 36633, 16841, 38815 },
+	{ 30585, 16710, 32767 },
+	{ 36633, 16841, 38815 },
+	{ 38443, 16841, 36110 },
+	{ 38443, 16841, 36110 },
+	{ 30585, 16710, 32767 },
+	{ 30585, 16710, 32767 },
+	{ 36451, 17678, 46555 },
+	{ 36587, 18239, 46874 },
+	{ 41442, 18239, 43625 },
+	{ 41442, 18239, 43625 },
+	{ 41196, 17678, 43379 },
+	{ 36451, 17678, 46555 },
+	{ 35724, 17188, 44846 },
+	{ 36451, 17678, 46555 },
+	{ 41196, 17678, 43379 },
+	{ 41196, 17678, 43379 },
+	{ 39882, 17188, 42064 },
+	{ 35724, 17188, 44846 },
+	{ 33928, 16841, 40625 },
+	{ 35724, 17188, 44846 },
+	{ 39882, 17188, 42064 },
+	{ 39882, 17188, 42064 },
+	{ 36633, 16841, 38815 },
+	{ 33928, 16841, 40625 },
+	{ 30585, 16710, 32767 },
+	{ 33928, 16841, 40625 },
+	{ 36633, 16841, 38815 },
+	{ 36633, 16841, 38815 },
+	{ 30585, 16710, 32767 },
+	{ 30585, 16710, 32767 },
+	{ 30585, 17678, 47713 },
+	{ 30585, 18239, 48060 },
+	{ 36587, 18239, 46874 },
+	{ 36587, 18239, 46874 },
+	{ 36451, 17678, 46555 },
+	{ 30585, 17678, 47713 },
+	{ 30585, 17188, 45861 },
+	{ 30585, 17678, 47713 },
+	{ 36451, 17678, 46555 },
+	{ 36451, 17678, 46555 },
+	{ 35724, 17188, 44846 },
+	{ 30585, 17188, 45861 },
+	{ 30585, 16841, 41285 },
+	{ 30585, 17188, 45861 },
+	{ 35724, 17188, 44846 },
+	{ 35724, 17188, 44846 },
+	{ 33928, 16841, 40625 },
+	{ 30585, 16841, 41285 },
+	{ 30585, 16710, 32767 },
+	{ 30585, 16841, 41285 },
+	{ 33928, 16841, 40625 },
+	{ 33928, 16841, 40625 },
+	{ 30585, 16710, 32767 },
+	{ 30585, 16710, 32767 },
+	{ 24718, 17678, 46555 },
+	{ 24582, 18239, 46874 },
+	{ 30585, 18239, 48060 },
+	{ 30585, 18239, 48060 },
+	{ 30585, 17678, 47713 },
+	{ 24718, 17678, 46555 },
+	{ 25445, 17188, 44846 },
+	{ 24718, 17678, 46555 },
+	{ 30585, 17678, 47713 },
+	{ 30585, 17678, 47713 },
+	{ 30585, 17188, 45861 },
+	{ 25445, 17188, 44846 },
+	{ 27241, 16841, 40625 },
+	{ 25445, 17188, 44846 },
+	{ 30585, 17188, 45861 },
+	{ 30585, 17188, 45861 },
+	{ 30585, 16841, 41285 },
+	{ 27241, 16841, 40625 },
+	{ 30585, 16710, 32767 },
+	{ 27241, 16841, 40625 },
+	{ 30585, 16841, 41285 },
+	{ 30585, 16841, 41285 },
+	{ 30585, 16710, 32767 },
+	{ 30585, 16710, 32767 },
+	{ 19973, 17678, 43379 },
+	{ 19727, 18239, 43625 },
+	{ 24582, 18239, 46874 },
+	{ 24582, 18239, 46874 },
+	{ 24718, 17678, 46555 },
+	{ 19973, 17678, 43379 },
+	{ 21288, 17188, 42064 },
+	{ 19973, 17678, 43379 },
+	{ 24718, 17678, 46555 },
+	{ 24718, 17678, 46555 },
+	{ 25445, 17188, 44846 },
+	{ 21288, 17188, 42064 },
+	{ 24537, 16841, 38815 },
+	{ 21288, 17188, 42064 },
+	{ 25445, 17188, 44846 },
+	{ 25445, 17188, 44846 },
+	{ 27241, 16841, 40625 },
+	{ 24537, 16841, 38815 },
+	{ 30585, 16710, 32767 },
+	{ 24537, 16841, 38815 },
+	{ 27241, 16841, 40625 },
+	{ 27241, 16841, 40625 },
+	{ 30585, 16710, 32767 },
+	{ 30585, 16710, 32767 },
+	{ 16797, 17678, 38633 },
+	{ 16477, 18239, 38769 },
+	{ 19727, 18239, 43625 },
+	{ 19727, 18239, 43625 },
+	{ 19973, 17678, 43379 },
+	{ 16797, 17678, 38633 },
+	{ 18505, 17188, 37906 },
+	{ 16797, 17678, 38633 },
+	{ 19973, 17678, 43379 },
+	{ 19973, 17678, 43379 },
+	{ 21288, 17188, 42064 },
+	{ 18505, 17188, 37906 },
+	{ 22726, 16841, 36110 },
+	{ 18505, 17188, 37906 },
+	{ 21288, 17188, 42064 },
+	{ 21288, 17188, 42064 },
+	{ 24537, 16841, 38815 },
+	{ 22726, 16841, 36110 },
+	{ 30585, 16710, 32767 },
+	{ 22726, 16841, 36110 },
+	{ 24537, 16841, 38815 },
+	{ 24537, 16841, 38815 },
+	{ 30585, 16710, 32767 },
+	{ 30585, 16710, 32767 },
+	{ 15639, 17678, 32767 },
+	{ 15292, 18239, 32767 },
+	{ 16477, 18239, 38769 },
+	{ 16477, 18239, 38769 },
+	{ 16797, 17678, 38633 },
+	{ 15639, 17678, 32767 },
+	{ 17490, 17188, 32767 },
+	{ 15639, 17678, 32767 },
+	{ 16797, 17678, 38633 },
+	{ 16797, 17678, 38633 },
+	{ 18505, 17188, 37906 },
+	{ 17490, 17188, 32767 },
+	{ 22066, 16841, 32767 },
+	{ 17490, 17188, 32767 },
+	{ 18505, 17188, 37906 },
+	{ 18505, 17188, 37906 },
+	{ 22726, 16841, 36110 },
+	{ 22066, 16841, 32767 },
+	{ 30585, 16710, 32767 },
+	{ 22066, 16841, 32767 },
+	{ 22726, 16841, 36110 },
+	{ 22726, 16841, 36110 },
+	{ 30585, 16710, 32767 },
+	{ 30585, 16710, 32767 },
+	{ 16797, 17678, 26901 },
+	{ 16477, 18239, 26765 },
+	{ 15292, 18239, 32767 },
+	{ 15292, 18239, 32767 },
+	{ 15639, 17678, 32767 },
+	{ 16797, 17678, 26901 },
+	{ 18505, 17188, 27628 },
+	{ 16797, 17678, 26901 },
+	{ 15639, 17678, 32767 },
+	{ 15639, 17678, 32767 },
+	{ 17490, 17188, 32767 },
+	{ 18505, 17188, 27628 },
+	{ 22726, 16841, 29424 },
+	{ 18505, 17188, 27628 },
+	{ 17490, 17188, 32767 },
+	{ 17490, 17188, 32767 },
+	{ 22066, 16841, 32767 },
+	{ 22726, 16841, 29424 },
+	{ 30585, 16710, 32767 },
+	{ 22726, 16841, 29424 },
+	{ 22066, 16841, 32767 },
+	{ 22066, 16841, 32767 },
+	{ 30585, 16710, 32767 },
+	{ 30585, 16710, 32767 },
+	{ 19973, 17678, 22155 },
+	{ 19727, 18239, 21909 },
+	{ 16477, 18239, 26765 },
+	{ 16477, 18239, 26765 },
+	{ 16797, 17678, 26901 },
+	{ 19973, 17678, 22155 },
+	{ 21288, 17188, 23470 },
+	{ 19973, 17678, 22155 },
+	{ 16797, 17678, 26901 },
+	{ 16797, 17678, 26901 },
+	{ 18505, 17188, 27628 },
+	{ 21288, 17188, 23470 },
+	{ 24537, 16841, 26719 },
+	{ 21288, 17188, 23470 },
+	{ 18505, 17188, 27628 },
+	{ 18505, 17188, 27628 },
+	{ 22726, 16841, 29424 },
+	{ 24537, 16841, 26719 },
+	{ 30585, 16710, 32767 },
+	{ 24537, 16841, 26719 },
+	{ 22726, 16841, 29424 },
+	{ 22726, 16841, 29424 },
+	{ 30585, 16710, 32767 },
+	{ 30585, 16710, 32767 },
+	{ 24718, 17678, 18979 },
+	{ 24582, 18239, 18660 },
+	{ 19727, 18239, 21909 },
+	{ 19727, 18239, 21909 },
+	{ 19973, 17678, 22155 },
+	{ 24718, 17678, 18979 },
+	{ 25445, 17188, 20688 },
+	{ 24718, 17678, 18979 },
+	{ 19973, 17678, 22155 },
+	{ 19973, 17678, 22155 },
+	{ 21288, 17188, 23470 },
+	{ 25445, 17188, 20688 },
+	{ 27241, 16841, 24909 },
+	{ 25445, 17188, 20688 },
+	{ 21288, 17188, 23470 },
+	{ 21288, 17188, 23470 },
+	{ 24537, 16841, 26719 },
+	{ 27241, 16841, 24909 },
+	{ 30585, 16710, 32767 },
+	{ 27241, 16841, 24909 },
+	{ 24537, 16841, 26719 },
+	{ 24537, 16841, 26719 },
+	{ 30585, 16710, 32767 },
+	{ 30585, 16710, 32767 },
+	{ 30585, 17678, 17821 },
+	{ 30585, 18239, 17474 },
+	{ 24582, 18239, 18660 },
+	{ 24582, 18239, 18660 },
+	{ 24718, 17678, 18979 },
+	{ 30585, 17678, 17821 },
+	{ 30585, 17188, 19673 },
+	{ 30585, 17678, 17821 },
+	{ 24718, 17678, 18979 },
+	{ 24718, 17678, 18979 },
+	{ 25445, 17188, 20688 },
+	{ 30585, 17188, 19673 },
+	{ 30585, 16841, 24249 },
+	{ 30585, 17188, 19673 },
+	{ 25445, 17188, 20688 },
+	{ 25445, 17188, 20688 },
+	{ 27241, 16841, 24909 },
+	{ 30585, 16841, 24249 },
+	{ 30585, 16710, 32767 },
+	{ 30585, 16841, 24249 },
+	{ 27241, 16841, 24909 },
+	{ 27241, 16841, 24909 },
+	{ 30585, 16710, 32767 },
+	{ 30585, 16710, 32767 },
+	{ 36451, 17678, 18979 },
+	{ 36587, 18239, 18660 },
+	{ 30585, 18239, 17474 },
+	{ 30585, 18239, 17474 },
+	{ 30585, 17678, 17821 },
+	{ 36451, 17678, 18979 },
+	{ 35724, 17188, 20688 },
+	{ 36451, 17678, 18979 },
+	{ 30585, 17678, 17821 },
+	{ 30585, 17678, 17821 },
+	{ 30585, 17188, 19673 },
+	{ 35724, 17188, 20688 },
+	{ 33928, 16841, 24909 },
+	{ 35724, 17188, 20688 },
+	{ 30585, 17188, 19673 },
+	{ 30585, 17188, 19673 },
+	{ 30585, 16841, 24249 },
+	{ 33928, 16841, 24909 },
+	{ 30585, 16710, 32767 },
+	{ 33928, 16841, 24909 },
+	{ 30585, 16841, 24249 },
+	{ 30585, 16841, 24249 },
+	{ 30585, 16710, 32767 },
+	{ 30585, 16710, 32767 },
+	{ 41196, 17678, 22155 },
+	{ 41442, 18239, 21909 },
+	{ 36587, 18239, 18660 },
+	{ 36587, 18239, 18660 },
+	{ 36451, 17678, 18979 },
+	{ 41196, 17678, 22155 },
+	{ 39882, 17188, 23470 },
+	{ 41196, 17678, 22155 },
+	{ 36451, 17678, 18979 },
+	{ 36451, 17678, 18979 },
+	{ 35724, 17188, 20688 },
+	{ 39882, 17188, 23470 },
+	{ 36633, 16841, 26719 },
+	{ 39882, 17188, 23470 },
+	{ 35724, 17188, 20688 },
+	{ 35724, 17188, 20688 },
+	{ 33928, 16841, 24909 },
+	{ 36633, 16841, 26719 },
+	{ 30585, 16710, 32767 },
+	{ 36633, 16841, 26719 },
+	{ 33928, 16841, 24909 },
+	{ 33928, 16841, 24909 },
+	{ 30585, 16710, 32767 },
+	{ 30585, 16710, 32767 },
+	{ 44372, 17678, 26901 },
+	{ 44692, 18239, 26765 },
+	{ 41442, 18239, 21909 },
+	{ 41442, 18239, 21909 },
+	{ 41196, 17678, 22155 },
+	{ 44372, 17678, 26901 },
+	{ 42664, 17188, 27628 },
+	{ 44372, 17678, 26901 },
+	{ 41196, 17678, 22155 },
+	{ 41196, 17678, 22155 },
+	{ 39882, 17188, 23470 },
+	{ 42664, 17188, 27628 },
+	{ 38443, 16841, 29424 },
+	{ 42664, 17188, 27628 },
+	{ 39882, 17188, 23470 },
+	{ 39882, 17188, 23470 },
+	{ 36633, 16841, 26719 },
+	{ 38443, 16841, 29424 },
+	{ 30585, 16710, 32767 },
+	{ 38443, 16841, 29424 },
+	{ 36633, 16841, 26719 },
+	{ 36633, 16841, 26719 },
+	{ 30585, 16710, 32767 },
+	{ 30585, 16710, 32767 },
+	{ 45531, 17678, 32767 },
+	{ 45877, 18239, 32767 },
+	{ 44692, 18239, 26765 },
+	{ 44692, 18239, 26765 },
+	{ 44372, 17678, 26901 },
+	{ 45531, 17678, 32767 },
+	{ 43679, 17188, 32767 },
+	{ 45531, 17678, 32767 },
+	{ 44372, 17678, 26901 },
+	{ 44372, 17678, 26901 },
+	{ 42664, 17188, 27628 },
+	{ 43679, 17188, 32767 },
+	{ 39103, 16841, 32767 },
+	{ 43679, 17188, 32767 },
+	{ 42664, 17188, 27628 },
+	{ 42664, 17188, 27628 },
+	{ 38443, 16841, 29424 },
+	{ 39103, 16841, 32767 },
+	{ 30585, 16710, 32767 },
+	{ 39103, 16841, 32767 },
+	{ 38443, 16841, 29424 },
+	{ 38443, 16841, 29424 },
+	{ 30585, 16710, 32767 },
+	{ 30585, 16710, 32767 },
+	{ 9368, 37672, 34487 },
+	{ 14432, 37713, 34487 },
+	{ 14273, 37355, 32767 },
+	{ 14273, 37355, 32767 },
+	{ 9510, 37319, 32767 },
+	{ 9368, 37672, 34487 },
+	{ 5651, 37382, 34487 },
+	{ 9368, 37672, 34487 },
+	{ 9510, 37319, 32767 },
+	{ 9510, 37319, 32767 },
+	{ 5989, 37068, 32767 },
+	{ 5651, 37382, 34487 },
+	{ 3361, 36594, 34487 },
+	{ 5651, 37382, 34487 },
+	{ 5989, 37068, 32767 },
+	{ 5989, 37068, 32767 },
+	{ 3807, 36387, 32767 },
+	{ 3361, 36594, 34487 },
+	{ 2580, 35061, 34487 },
+	{ 3361, 36594, 34487 },
+	{ 3807, 36387, 32767 },
+	{ 3807, 36387, 32767 },
+	{ 3058, 35061, 32767 },
+	{ 2580, 35061, 34487 },
+	{ 9056, 38448, 35061 },
+	{ 14782, 38502, 35061 },
+	{ 14432, 37713, 34487 },
+	{ 14432, 37713, 34487 },
+	{ 9368, 37672, 34487 },
+	{ 9056, 38448, 35061 },
+	{ 4906, 38072, 35061 },
+	{ 9056, 38448, 35061 },
+	{ 9368, 37672, 34487 },
+	{ 9368, 37672, 34487 },
+	{ 5651, 37382, 34487 },
+	{ 4906, 38072, 35061 },
+	{ 2381, 37050, 35061 },
+	{ 4906, 38072, 35061 },
+	{ 5651, 37382, 34487 },
+	{ 5651, 37382, 34487 },
+	{ 3361, 36594, 34487 },
+	{ 2381, 37050, 35061 },
+	{ 1529, 35061, 35061 },
+	{ 2381, 37050, 35061 },
+	{ 3361, 36594, 34487 },
+	{ 3361, 36594, 34487 },
+	{ 2580, 35061, 34487 },
+	{ 1529, 35061, 35061 },
+	{ 8743, 39224, 34487 },
+	{ 15133, 39290, 34487 },
+	{ 14782, 38502, 35061 },
+	{ 14782, 38502, 35061 },
+	{ 9056, 38448, 35061 },
+	{ 8743, 39224, 34487 },
+	{ 4161, 38762, 34487 },
+	{ 8743, 39224, 34487 },
+	{ 9056, 38448, 35061 },
+	{ 9056, 38448, 35061 },
+	{ 4906, 38072, 35061 },
+	{ 4161, 38762, 34487 },
+	{ 1401, 37506, 34487 },
+	{ 4161, 38762, 34487 },
+	{ 4906, 38072, 35061 },
+	{ 4906, 38072, 35061 },
+	{ 2381, 37050, 35061 },
+	{ 1401, 37506, 34487 },
+	{ 477, 35061, 34487 },
+	{ 1401, 37506, 34487 },
+	{ 2381, 37050, 35061 },
+	{ 2381, 37050, 35061 },
+	{ 1529, 35061, 35061 },
+	{ 477, 35061, 34487 },
+	{ 8602, 39577, 32767 },
+	{ 15292, 39649, 32767 },
+	{ 15133, 39290, 34487 },
+	{ 15133, 39290, 34487 },
+	{ 8743, 39224, 34487 },
+	{ 8602, 39577, 32767 },
+	{ 3823, 39075, 32767 },
+	{ 8602, 39577, 32767 },
+	{ 8743, 39224, 34487 },
+	{ 8743, 39224, 34487 },
+	{ 4161, 38762, 34487 },
+	{ 3823, 39075, 32767 },
+	{ 955, 37713, 32767 },
+	{ 3823, 39075, 32767 },
+	{ 4161, 38762, 34487 },
+	{ 4161, 38762, 34487 },
+	{ 1401, 37506, 34487 },
+	{ 955, 37713, 32767 },
+	{ 0, 35061, 32767 },
+	{ 955, 37713, 32767 },
+	{ 1401, 37506, 34487 },
+	{ 1401, 37506, 34487 },
+	{ 477, 35061, 34487 },
+	{ 0, 35061, 32767 },
+	{ 8743, 39224, 31047 },
+	{ 15133, 39290, 31047 },
+	{ 15292, 39649, 32767 },
+	{ 15292, 39649, 32767 },
+	{ 8602, 39577, 32767 },
+	{ 8743, 39224, 31047 },
+	{ 4161, 38762, 31047 },
+	{ 8743, 39224, 31047 },
+	{ 8602, 39577, 32767 },
+	{ 8602, 39577, 32767 },
+	{ 3823, 39075, 32767 },
+	{ 4161, 38762, 31047 },
+	{ 1401, 37506, 31047 },
+	{ 4161, 38762, 31047 },
+	{ 3823, 39075, 32767 },
+	{ 3823, 39075, 32767 },
+	{ 955, 37713, 32767 },
+	{ 1401, 37506, 31047 },
+	{ 477, 35061, 31047 },
+	{ 1401, 37506, 31047 },
+	{ 955, 37713, 32767 },
+	{ 955, 37713, 32767 },
+	{ 0, 35061, 32767 },
+	{ 477, 35061, 31047 },
+	{ 9056, 38448, 30473 },
+	{ 14782, 38502, 30473 },
+	{ 15133, 39290, 31047 },
+	{ 15133, 39290, 31047 },
+	{ 8743, 39224, 31047 },
+	{ 9056, 38448, 30473 },
+	{ 4906, 38072, 30473 },
+	{ 9056, 38448, 30473 },
+	{ 8743, 39224, 31047 },
+	{ 8743, 39224, 31047 },
+	{ 4161, 38762, 31047 },
+	{ 4906, 38072, 30473 },
+	{ 2381, 37050, 30473 },
+	{ 4906, 38072, 30473 },
+	{ 4161, 38762, 31047 },
+	{ 4161, 38762, 31047 },
+	{ 1401, 37506, 31047 },
+	{ 2381, 37050, 30473 },
+	{ 1529, 35061, 30473 },
+	{ 2381, 37050, 30473 },
+	{ 1401, 37506, 31047 },
+	{ 1401, 37506, 31047 },
+	{ 477, 35061, 31047 },
+	{ 1529, 35061, 30473 },
+	{ 9368, 37672, 31047 },
+	{ 14432, 37713, 31047 },
+	{ 14782, 38502, 30473 },
+	{ 14782, 38502, 30473 },
+	{ 9056, 38448, 30473 },
+	{ 9368, 37672, 31047 },
+	{ 5651, 37382, 31047 },
+	{ 9368, 37672, 31047 },
+	{ 9056, 38448, 30473 },
+	{ 9056, 38448, 30473 },
+	{ 4906, 38072, 30473 },
+	{ 5651, 37382, 31047 },
+	{ 3361, 36594, 31047 },
+	{ 5651, 37382, 31047 },
+	{ 4906, 38072, 30473 },
+	{ 4906, 38072, 30473 },
+	{ 2381, 37050, 30473 },
+	{ 3361, 36594, 31047 },
+	{ 2580, 35061, 31047 },
+	{ 3361, 36594, 31047 },
+	{ 2381, 37050, 30473 },
+	{ 2381, 37050, 30473 },
+	{ 1529, 35061, 30473 },
+	{ 2580, 35061, 31047 },
+	{ 9510, 37319, 32767 },
+	{ 14273, 37355, 32767 },
+	{ 14432, 37713, 31047 },
+	{ 14432, 37713, 31047 },
+	{ 9368, 37672, 31047 },
+	{ 9510, 37319, 32767 },
+	{ 5989, 37068, 32767 },
+	{ 9510, 37319, 32767 },
+	{ 9368, 37672, 31047 },
+	{ 9368, 37672, 31047 },
+	{ 5651, 37382, 31047 },
+	{ 5989, 37068, 32767 },
+	{ 3807, 36387, 32767 },
+	{ 5989, 37068, 32767 },
+	{ 5651, 37382, 31047 },
+	{ 5651, 37382, 31047 },
+	{ 3361, 36594, 31047 },
+	{ 3807, 36387, 32767 },
+	{ 3058, 35061, 32767 },
+	{ 3807, 36387, 32767 },
+	{ 3361, 36594, 31047 },
+	{ 3361, 36594, 31047 },
+	{ 2580, 35061, 31047 },
+	{ 3058, 35061, 32767 },
+	{ 3022, 32781, 34487 },
+	{ 2580, 35061, 34487 },
+	{ 3058, 35061, 32767 },
+	{ 3058, 35061, 32767 },
+	{ 3456, 32982, 32767 },
+	{ 3022, 32781, 34487 },
+	{ 4406, 30167, 34487 },
+	{ 3022, 32781, 34487 },
+	{ 3456, 32982, 32767 },
+	{ 3456, 32982, 32767 },
+	{ 4715, 30473, 32767 },
+	{ 4406, 30167, 34487 },
+	{ 6821, 27586, 34487 },
+	{ 4406, 30167, 34487 },
+	{ 4715, 30473, 32767 },
+	{ 4715, 30473, 32767 },
+	{ 6929, 27964, 32767 },
+	{ 6821, 27586, 34487 },
+	{ 10354, 25407, 34487 },
+	{ 6821, 27586, 34487 },
+	{ 6929, 27964, 32767 },
+	{ 6929, 27964, 32767 },
+	{ 10195, 25885, 32767 },
+	{ 10354, 25407, 34487 },
+	{ 2066, 32340, 35061 },
+	{ 1529, 35061, 35061 },
+	{ 2580, 35061, 34487 },
+	{ 2580, 35061, 34487 },
+	{ 3022, 32781, 34487 },
+	{ 2066, 32340, 35061 },
+	{ 3727, 29493, 35061 },
+	{ 2066, 32340, 35061 },
+	{ 3022, 32781, 34487 },
+	{ 3022, 32781, 34487 },
+	{ 4406, 30167, 34487 },
+	{ 3727, 29493, 35061 },
+	{ 6582, 26755, 35061 },
+	{ 3727, 29493, 35061 },
+	{ 4406, 30167, 34487 },
+	{ 4406, 30167, 34487 },
+	{ 6821, 27586, 34487 },
+	{ 6582, 26755, 35061 },
+	{ 10704, 24356, 35061 },
+	{ 6582, 26755, 35061 },
+	{ 6821, 27586, 34487 },
+	{ 6821, 27586, 34487 },
+	{ 10354, 25407, 34487 },
+	{ 10704, 24356, 35061 },
+	{ 1111, 31898, 34487 },
+	{ 477, 35061, 34487 },
+	{ 1529, 35061, 35061 },
+	{ 1529, 35061, 35061 },
+	{ 2066, 32340, 35061 },
+	{ 1111, 31898, 34487 },
+	{ 3048, 28820, 34487 },
+	{ 1111, 31898, 34487 },
+	{ 2066, 32340, 35061 },
+	{ 2066, 32340, 35061 },
+	{ 3727, 29493, 35061 },
+	{ 3048, 28820, 34487 },
+	{ 6344, 25923, 34487 },
+	{ 3048, 28820, 34487 },
+	{ 3727, 29493, 35061 },
+	{ 3727, 29493, 35061 },
+	{ 6582, 26755, 35061 },
+	{ 6344, 25923, 34487 },
+	{ 11055, 23305, 34487 },
+	{ 6344, 25923, 34487 },
+	{ 6582, 26755, 35061 },
+	{ 6582, 26755, 35061 },
+	{ 10704, 24356, 35061 },
+	{ 11055, 23305, 34487 },
+	{ 677, 31698, 32767 },
+	{ 0, 35061, 32767 },
+	{ 477, 35061, 34487 },
+	{ 477, 35061, 34487 },
+	{ 1111, 31898, 34487 },
+	{ 677, 31698, 32767 },
+	{ 2739, 28514, 32767 },
+	{ 677, 31698, 32767 },
+	{ 1111, 31898, 34487 },
+	{ 1111, 31898, 34487 },
+	{ 3048, 28820, 34487 },
+	{ 2739, 28514, 32767 },
+	{ 6236, 25545, 32767 },
+	{ 2739, 28514, 32767 },
+	{ 3048, 28820, 34487 },
+	{ 3048, 28820, 34487 },
+	{ 6344, 25923, 34487 },
+	{ 6236, 25545, 32767 },
+	{ 11214, 22827, 32767 },
+	{ 6236, 25545, 32767 },
+	{ 6344, 25923, 34487 },
+	{ 6344, 25923, 34487 },
+	{ 11055, 23305, 34487 },
+	{ 11214, 22827, 32767 },
+	{ 1111, 31898, 31047 },
+	{ 477, 35061, 31047 },
+	{ 0, 35061, 32767 },
+	{ 0, 35061, 32767 },
+	{ 677, 31698, 32767 },
+	{ 1111, 31898, 31047 },
+	{ 3048, 28820, 31047 },
+	{ 1111, 31898, 31047 },
+	{ 677, 31698, 32767 },
+	{ 677, 31698, 32767 },
+	{ 2739, 28514, 32767 },
+	{ 3048, 28820, 31047 },
+	{ 6344, 25923, 31047 },
+	{ 3048, 28820, 31047 },
+	{ 2739, 28514, 32767 },
+	{ 2739, 28514, 32767 },
+	{ 6236, 25545, 32767 },
+	{ 6344, 25923, 31047 },
+	{ 11055, 23305, 31047 },
+	{ 6344, 25923, 31047 },
+	{ 6236, 25545, 32767 },
+	{ 6236, 25545, 32767 },
+	{ 11214, 22827, 32767 },
+	{ 11055, 23305, 31047 },
+	{ 2066, 32340, 30473 },
+	{ 1529, 35061, 30473 },
+	{ 477, 35061, 31047 },
+	{ 477, 35061, 31047 },
+	{ 1111, 31898, 31047 },
+	{ 2066, 32340, 30473 },
+	{ 3727, 29493, 30473 },
+	{ 2066, 32340, 30473 },
+	{ 1111, 31898, 31047 },
+	{ 1111, 31898, 31047 },
+	{ 3048, 28820, 31047 },
+	{ 3727, 29493, 30473 },
+	{ 6582, 26755, 30473 },
+	{ 3727, 29493, 30473 },
+	{ 3048, 28820, 31047 },
+	{ 3048, 28820, 31047 },
+	{ 6344, 25923, 31047 },
+	{ 6582, 26755, 30473 },
+	{ 10704, 24356, 30473 },
+	{ 6582, 26755, 30473 },
+	{ 6344, 25923, 31047 },
+	{ 6344, 25923, 31047 },
+	{ 11055, 23305, 31047 },
+	{ 10704, 24356, 30473 },
+	{ 3022, 32781, 31047 },
+	{ 2580, 35061, 31047 },
+	{ 1529, 35061, 30473 },
+	{ 1529, 35061, 30473 },
+	{ 2066, 32340, 30473 },
+	{ 3022, 32781, 31047 },
+	{ 4406, 30167, 31047 },
+	{ 3022, 32781, 31047 },
+	{ 2066, 32340, 30473 },
+	{ 2066, 32340, 30473 },
+	{ 3727, 29493, 30473 },
+	{ 4406, 30167, 31047 },
+	{ 6821, 27586, 31047 },
+	{ 4406, 30167, 31047 },
+	{ 3727, 29493, 30473 },
+	{ 3727, 29493, 30473 },
+	{ 6582, 26755, 30473 },
+	{ 6821, 27586, 31047 },
+	{ 10354, 25407, 31047 },
+	{ 6821, 27586, 31047 },
+	{ 6582, 26755, 30473 },
+	{ 6582, 26755, 30473 },
+	{ 10704, 24356, 30473 },
+	{ 10354, 25407, 31047 },
+	{ 3456, 32982, 32767 },
+	{ 3058, 35061, 32767 },
+	{ 2580, 35061, 31047 },
+	{ 2580, 35061, 31047 },
+	{ 3022, 32781, 31047 },
+	{ 3456, 32982, 32767 },
+	{ 4715, 30473, 32767 },
+	{ 3456, 32982, 32767 },
+	{ 3022, 32781, 31047 },
+	{ 3022, 32781, 31047 },
+	{ 4406, 30167, 31047 },
+	{ 4715, 30473, 32767 },
+	{ 6929, 27964, 32767 },
+	{ 4715, 30473, 32767 },
+	{ 4406, 30167, 31047 },
+	{ 4406, 30167, 31047 },
+	{ 6821, 27586, 31047 },
+	{ 6929, 27964, 32767 },
+	{ 10195, 25885, 32767 },
+	{ 6929, 27964, 32767 },
+	{ 6821, 27586, 31047 },
+	{ 6821, 27586, 31047 },
+	{ 10354, 25407, 31047 },
+	{ 10195, 25885, 32767 },
+	{ 53180, 31386, 36185 },
+	{ 47916, 29924, 36552 },
+	{ 47916, 31238, 32767 },
+	{ 47916, 31238, 32767 },
+	{ 52807, 32361, 32767 },
+	{ 53180, 31386, 36185 },
+	{ 55403, 34493, 35376 },
+	{ 53180, 31386, 36185 },
+	{ 52807, 32361, 32767 },
+	{ 52807, 32361, 32767 },
+	{ 54925, 35061, 32767 },
+	{ 55403, 34493, 35376 },
+	{ 56671, 38129, 34568 },
+	{ 55403, 34493, 35376 },
+	{ 54925, 35061, 32767 },
+	{ 54925, 35061, 32767 },
+	{ 56088, 38334, 32767 },
+	{ 56671, 38129, 34568 },
+	{ 59067, 41178, 34201 },
+	{ 56671, 38129, 34568 },
+	{ 56088, 38334, 32767 },
+	{ 56088, 38334, 32767 },
+	{ 58111, 41178, 32767 },
+	{ 59067, 41178, 34201 },
+	{ 54001, 29243, 37324 },
+	{ 47916, 27032, 37814 },
+	{ 47916, 29924, 36552 },
+	{ 47916, 29924, 36552 },
+	{ 53180, 31386, 36185 },
+	{ 54001, 29243, 37324 },
+	{ 56455, 33245, 36246 },
+	{ 54001, 29243, 37324 },
+	{ 53180, 31386, 36185 },
+	{ 53180, 31386, 36185 },
+	{ 55403, 34493, 35376 },
+	{ 56455, 33245, 36246 },
+	{ 57952, 37677, 35168 },
+	{ 56455, 33245, 36246 },
+	{ 55403, 34493, 35376 },
+	{ 55403, 34493, 35376 },
+	{ 56671, 38129, 34568 },
+	{ 57952, 37677, 35168 },
+	{ 61170, 41178, 34679 },
+	{ 57952, 37677, 35168 },
+	{ 56671, 38129, 34568 },
+	{ 56671, 38129, 34568 },
+	{ 59067, 41178, 34201 },
+	{ 61170, 41178, 34679 },
+	{ 54823, 27099, 36185 },
+	{ 47916, 24141, 36552 },
+	{ 47916, 27032, 37814 },
+	{ 47916, 27032, 37814 },
+	{ 54001, 29243, 37324 },
+	{ 54823, 27099, 36185 },
+	{ 57506, 31996, 35376 },
+	{ 54823, 27099, 36185 },
+	{ 54001, 29243, 37324 },
+	{ 54001, 29243, 37324 },
+	{ 56455, 33245, 36246 },
+	{ 57506, 31996, 35376 },
+	{ 59233, 37226, 34568 },
+	{ 57506, 31996, 35376 },
+	{ 56455, 33245, 36246 },
+	{ 56455, 33245, 36246 },
+	{ 57952, 37677, 35168 },
+	{ 59233, 37226, 34568 },
+	{ 63272, 41178, 34201 },
+	{ 59233, 37226, 34568 },
+	{ 57952, 37677, 35168 },
+	{ 57952, 37677, 35168 },
+	{ 61170, 41178, 34679 },
+	{ 63272, 41178, 34201 },
+	{ 55196, 26124, 32767 },
+	{ 47916, 22827, 32767 },
+	{ 47916, 24141, 36552 },
+	{ 47916, 24141, 36552 },
+	{ 54823, 27099, 36185 },
+	{ 55196, 26124, 32767 },
+	{ 57984, 31429, 32767 },
+	{ 55196, 26124, 32767 },
+	{ 54823, 27099, 36185 },
+	{ 54823, 27099, 36185 },
+	{ 57506, 31996, 35376 },
+	{ 57984, 31429, 32767 },
+	{ 59816, 37020, 32767 },
+	{ 57984, 31429, 32767 },
+	{ 57506, 31996, 35376 },
+	{ 57506, 31996, 35376 },
+	{ 59233, 37226, 34568 },
+	{ 59816, 37020, 32767 },
+	{ 64228, 41178, 32767 },
+	{ 59816, 37020, 32767 },
+	{ 59233, 37226, 34568 },
+	{ 59233, 37226, 34568 },
+	{ 63272, 41178, 34201 },
+	{ 64228, 41178, 32767 },
+	{ 54823, 27099, 29349 },
+	{ 47916, 24141, 28982 },
+	{ 47916, 22827, 32767 },
+	{ 47916, 22827, 32767 },
+	{ 55196, 26124, 32767 },
+	{ 54823, 27099, 29349 },
+	{ 57506, 31996, 30158 },
+	{ 54823, 27099, 29349 },
+	{ 55196, 26124, 32767 },
+	{ 55196, 26124, 32767 },
+	{ 57984, 31429, 32767 },
+	{ 57506, 31996, 30158 },
+	{ 59233, 37226, 30966 },
+	{ 57506, 31996, 30158 },
+	{ 57984, 31429, 32767 },
+	{ 57984, 31429, 32767 },
+	{ 59816, 37020, 32767 },
+	{ 59233, 37226, 30966 },
+	{ 63272, 41178, 31333 },
+	{ 59233, 37226, 30966 },
+	{ 59816, 37020, 32767 },
+	{ 59816, 37020, 32767 },
+	{ 64228, 41178, 32767 },
+	{ 63272, 41178, 31333 },
+	{ 54001, 29243, 28210 },
+	{ 47916, 27032, 27720 },
+	{ 47916, 24141, 28982 },
+	{ 47916, 24141, 28982 },
+	{ 54823, 27099, 29349 },
+	{ 54001, 29243, 28210 },
+	{ 56455, 33245, 29288 },
+	{ 54001, 29243, 28210 },
+	{ 54823, 27099, 29349 },
+	{ 54823, 27099, 29349 },
+	{ 57506, 31996, 30158 },
+	{ 56455, 33245, 29288 },
+	{ 57952, 37677, 30366 },
+	{ 56455, 33245, 29288 },
+	{ 57506, 31996, 30158 },
+	{ 57506, 31996, 30158 },
+	{ 59233, 37226, 30966 },
+	{ 57952, 37677, 30366 },
+	{ 61170, 41178, 30855 },
+	{ 57952, 37677, 30366 },
+	{ 59233, 37226, 30966 },
+	{ 59233, 37226, 30966 },
+	{ 63272, 41178, 31333 },
+	{ 61170, 41178, 30855 },
+	{ 53180, 31386, 29349 },
+	{ 47916, 29924, 28982 },
+	{ 47916, 27032, 27720 },
+	{ 47916, 27032, 27720 },
+	{ 54001, 29243, 28210 },
+	{ 53180, 31386, 29349 },
+	{ 55403, 34493, 30158 },
+	{ 53180, 31386, 29349 },
+	{ 54001, 29243, 28210 },
+	{ 54001, 29243, 28210 },
+	{ 56455, 33245, 29288 },
+	{ 55403, 34493, 30158 },
+	{ 56671, 38129, 30966 },
+	{ 55403, 34493, 30158 },
+	{ 56455, 33245, 29288 },
+	{ 56455, 33245, 29288 },
+	{ 57952, 37677, 30366 },
+	{ 56671, 38129, 30966 },
+	{ 59067, 41178, 31333 },
+	{ 56671, 38129, 30966 },
+	{ 57952, 37677, 30366 },
+	{ 57952, 37677, 30366 },
+	{ 61170, 41178, 30855 },
+	{ 59067, 41178, 31333 },
+	{ 52807, 32361, 32767 },
+	{ 47916, 31238, 32767 },
+	{ 47916, 29924, 28982 },
+	{ 47916, 29924, 28982 },
+	{ 53180, 31386, 29349 },
+	{ 52807, 32361, 32767 },
+	{ 54925, 35061, 32767 },
+	{ 52807, 32361, 32767 },
+	{ 53180, 31386, 29349 },
+	{ 53180, 31386, 29349 },
+	{ 55403, 34493, 30158 },
+	{ 54925, 35061, 32767 },
+	{ 56088, 38334, 32767 },
+	{ 54925, 35061, 32767 },
+	{ 55403, 34493, 30158 },
+	{ 55403, 34493, 30158 },
+	{ 56671, 38129, 30966 },
+	{ 56088, 38334, 32767 },
+	{ 58111, 41178, 32767 },
+	{ 56088, 38334, 32767 },
+	{ 56671, 38129, 30966 },
+	{ 56671, 38129, 30966 },
+	{ 59067, 41178, 31333 },
+	{ 58111, 41178, 32767 },
+	{ 59868, 41629, 34111 },
+	{ 59067, 41178, 34201 },
+	{ 58111, 41178, 32767 },
+	{ 58111, 41178, 32767 },
+	{ 58844, 41608, 32767 },
+	{ 59868, 41629, 34111 },
+	{ 60346, 41785, 33914 },
+	{ 59868, 41629, 34111 },
+	{ 58844, 41608, 32767 },
+	{ 58844, 41608, 32767 },
+	{ 59386, 41751, 32767 },
+	{ 60346, 41785, 33914 },
+	{ 60361, 41637, 33717 },
+	{ 60346, 41785, 33914 },
+	{ 59386, 41751, 32767 },
+	{ 59386, 41751, 32767 },
+	{ 59545, 41608, 32767 },
+	{ 60361, 41637, 33717 },
+	{ 59768, 41178, 33627 },
+	{ 60361, 41637, 33717 },
+	{ 59545, 41608, 32767 },
+	{ 59545, 41608, 32767 },
+	{ 59131, 41178, 32767 },
+	{ 59768, 41178, 33627 },
+	{ 62120, 41675, 34559 },
+	{ 61170, 41178, 34679 },
+	{ 59067, 41178, 34201 },
+	{ 59067, 41178, 34201 },
+	{ 59868, 41629, 34111 },
+	{ 62120, 41675, 34559 },
+	{ 62460, 41859, 34296 },
+	{ 62120, 41675, 34559 },
+	{ 59868, 41629, 34111 },
+	{ 59868, 41629, 34111 },
+	{ 60346, 41785, 33914 },
+	{ 62460, 41859, 34296 },
+	{ 62155, 41702, 34033 },
+	{ 62460, 41859, 34296 },
+	{ 60346, 41785, 33914 },
+	{ 60346, 41785, 33914 },
+	{ 60361, 41637, 33717 },
+	{ 62155, 41702, 34033 },
+	{ 61170, 41178, 33914 },
+	{ 62155, 41702, 34033 },
+	{ 60361, 41637, 33717 },
+	{ 60361, 41637, 33717 },
+	{ 59768, 41178, 33627 },
+	{ 61170, 41178, 33914 },
+	{ 64372, 41721, 34111 },
+	{ 63272, 41178, 34201 },
+	{ 61170, 41178, 34679 },
+	{ 61170, 41178, 34679 },
+	{ 62120, 41675, 34559 },
+	{ 64372, 41721, 34111 },
+	{ 64574, 41933, 33914 },
+	{ 64372, 41721, 34111 },
+	{ 62120, 41675, 34559 },
+	{ 62120, 41675, 34559 },
+	{ 62460, 41859, 34296 },
+	{ 64574, 41933, 33914 },
+	{ 63950, 41767, 33717 },
+	{ 64574, 41933, 33914 },
+	{ 62460, 41859, 34296 },
+	{ 62460, 41859, 34296 },
+	{ 62155, 41702, 34033 },
+	{ 63950, 41767, 33717 },
+	{ 62572, 41178, 33627 },
+	{ 63950, 41767, 33717 },
+	{ 62155, 41702, 34033 },
+	{ 62155, 41702, 34033 },
+	{ 61170, 41178, 33914 },
+	{ 62572, 41178, 33627 },
+	{ 65395, 41742, 32767 },
+	{ 64228, 41178, 32767 },
+	{ 63272, 41178, 34201 },
+	{ 63272, 41178, 34201 },
+	{ 64372, 41721, 34111 },
+	{ 65395, 41742, 32767 },
+	{ 65535, 41966, 32767 },
+	{ 65395, 41742, 32767 },
+	{ 64372, 41721, 34111 },
+	{ 64372, 41721, 34111 },
+	{ 64574, 41933, 33914 },
+	{ 65535, 41966, 32767 },
+	{ 64766, 41796, 32767 },
+	{ 65535, 41966, 32767 },
+	{ 64574, 41933, 33914 },
+	{ 64574, 41933, 33914 },
+	{ 63950, 41767, 33717 },
+	{ 64766, 41796, 32767 },
+	{ 63209, 41178, 32767 },
+	{ 64766, 41796, 32767 },
+	{ 63950, 41767, 33717 },
+	{ 63950, 41767, 33717 },
+	{ 62572, 41178, 33627 },
+	{ 63209, 41178, 32767 },
+	{ 64372, 41721, 31423 },
+	{ 63272, 41178, 31333 },
+	{ 64228, 41178, 32767 },
+	{ 64228, 41178, 32767 },
+	{ 65395, 41742, 32767 },
+	{ 64372, 41721, 31423 },
+	{ 64574, 41933, 31620 },
+	{ 64372, 41721, 31423 },
+	{ 65395, 41742, 32767 },
+	{ 65395, 41742, 32767 },
+	{ 65535, 41966, 32767 },
+	{ 64574, 41933, 31620 },
+	{ 63950, 41767, 31817 },
+	{ 64574, 41933, 31620 },
+	{ 65535, 41966, 32767 },
+	{ 65535, 41966, 32767 },
+	{ 64766, 41796, 32767 },
+	{ 63950, 41767, 31817 },
+	{ 62572, 41178, 31907 },
+	{ 63950, 41767, 31817 },
+	{ 64766, 41796, 32767 },
+	{ 64766, 41796, 32767 },
+	{ 63209, 41178, 32767 },
+	{ 62572, 41178, 31907 },
+	{ 62120, 41675, 30975 },
+	{ 61170, 41178, 30855 },
+	{ 63272, 41178, 31333 },
+	{ 63272, 41178, 31333 },
+	{ 64372, 41721, 31423 },
+	{ 62120, 41675, 30975 },
+	{ 62460, 41859, 31238 },
+	{ 62120, 41675, 30975 },
+	{ 64372, 41721, 31423 },
+	{ 64372, 41721, 31423 },
+	{ 64574, 41933, 31620 },
+	{ 62460, 41859, 31238 },
+	{ 62155, 41702, 31501 },
+	{ 62460, 41859, 31238 },
+	{ 64574, 41933, 31620 },
+	{ 64574, 41933, 31620 },
+	{ 63950, 41767, 31817 },
+	{ 62155, 41702, 31501 },
+	{ 61170, 41178, 31620 },
+	{ 62155, 41702, 31501 },
+	{ 63950, 41767, 31817 },
+	{ 63950, 41767, 31817 },
+	{ 62572, 41178, 31907 },
+	{ 61170, 41178, 31620 },
+	{ 59868, 41629, 31423 },
+	{ 59067, 41178, 31333 },
+	{ 61170, 41178, 30855 },
+	{ 61170, 41178, 30855 },
+	{ 62120, 41675, 30975 },
+	{ 59868, 41629, 31423 },
+	{ 60346, 41785, 31620 },
+	{ 59868, 41629, 31423 },
+	{ 62120, 41675, 30975 },
+	{ 62120, 41675, 30975 },
+	{ 62460, 41859, 31238 },
+	{ 60346, 41785, 31620 },
+	{ 60361, 41637, 31817 },
+	{ 60346, 41785, 31620 },
+	{ 62460, 41859, 31238 },
+	{ 62460, 41859, 31238 },
+	{ 62155, 41702, 31501 },
+	{ 60361, 41637, 31817 },
+	{ 59768, 41178, 31907 },
+	{ 60361, 41637, 31817 },
+	{ 62155, 41702, 31501 },
+	{ 62155, 41702, 31501 },
+	{ 61170, 41178, 31620 },
+	{ 59768, 41178, 31907 },
+	{ 58844, 41608, 32767 },
+	{ 58111, 41178, 32767 },
+	{ 59067, 41178, 31333 },
+	{ 59067, 41178, 31333 },
+	{ 59868, 41629, 31423 },
+	{ 58844, 41608, 32767 },
+	{ 59386, 41751, 32767 },
+	{ 58844, 41608, 32767 },
+	{ 59868, 41629, 31423 },
+	{ 59868, 41629, 31423 },
+	{ 60346, 41785, 31620 },
+	{ 59386, 41751, 32767 },
+	{ 59545, 41608, 32767 },
+	{ 59386, 41751, 32767 },
+	{ 60346, 41785, 31620 },
+	{ 60346, 41785, 31620 },
+	{ 60361, 41637, 31817 },
+	{ 59545, 41608, 32767 },
+	{ 59131, 41178, 32767 },
+	{ 59545, 41608, 32767 },
+	{ 60361, 41637, 31817 },
+	{ 60361, 41637, 31817 },
+	{ 59768, 41178, 31907 },
+	{ 59131, 41178, 32767 },
+	{ 33789, 48322, 34134 },
+	{ 30585, 48824, 32767 },
+	{ 30585, 48824, 32767 },
+	{ 30585, 48824, 32767 },
+	{ 34057, 48322, 32767 },
+	{ 33789, 48322, 34134 },
+	{ 33642, 47104, 34071 },
+	{ 33789, 48322, 34134 },
+	{ 34057, 48322, 32767 },
+	{ 34057, 48322, 32767 },
+	{ 33898, 47104, 32767 },
+	{ 33642, 47104, 34071 },
+	{ 32437, 45598, 33556 },
+	{ 33642, 47104, 34071 },
+	{ 33898, 47104, 32767 },
+	{ 33898, 47104, 32767 },
+	{ 32592, 45598, 32767 },
+	{ 32437, 45598, 33556 },
+	{ 32466, 44236, 33567 },
+	{ 32437, 45598, 33556 },
+	{ 32592, 45598, 32767 },
+	{ 32592, 45598, 32767 },
+	{ 32624, 44236, 32767 },
+	{ 32466, 44236, 33567 },
+	{ 33053, 48322, 35236 },
+	{ 30585, 48824, 32767 },
+	{ 30585, 48824, 32767 },
+	{ 30585, 48824, 32767 },
+	{ 33789, 48322, 34134 },
+	{ 33053, 48322, 35236 },
+	{ 32940, 47104, 35122 },
+	{ 33053, 48322, 35236 },
+	{ 33789, 48322, 34134 },
+	{ 33789, 48322, 34134 },
+	{ 33642, 47104, 34071 },
+	{ 32940, 47104, 35122 },
+	{ 32011, 45598, 34193 },
+	{ 32940, 47104, 35122 },
+	{ 33642, 47104, 34071 },
+	{ 33642, 47104, 34071 },
+	{ 32437, 45598, 33556 },
+	{ 32011, 45598, 34193 },
+	{ 32032, 44236, 34215 },
+	{ 32011, 45598, 34193 },
+	{ 32437, 45598, 33556 },
+	{ 32437, 45598, 33556 },
+	{ 32466, 44236, 33567 },
+	{ 32032, 44236, 34215 },
+	{ 31951, 48322, 35972 },
+	{ 30585, 48824, 32767 },
+	{ 30585, 48824, 32767 },
+	{ 30585, 48824, 32767 },
+	{ 33053, 48322, 35236 },
+	{ 31951, 48322, 35972 },
+	{ 31888, 47104, 35825 },
+	{ 31951, 48322, 35972 },
+	{ 33053, 48322, 35236 },
+	{ 33053, 48322, 35236 },
+	{ 32940, 47104, 35122 },
+	{ 31888, 47104, 35825 },
+	{ 31374, 45598, 34619 },
+	{ 31888, 47104, 35825 },
+	{ 32940, 47104, 35122 },
+	{ 32940, 47104, 35122 },
+	{ 32011, 45598, 34193 },
+	{ 31374, 45598, 34619 },
+	{ 31385, 44236, 34648 },
+	{ 31374, 45598, 34619 },
+	{ 32011, 45598, 34193 },
+	{ 32011, 45598, 34193 },
+	{ 32032, 44236, 34215 },
+	{ 31385, 44236, 34648 },
+	{ 30585, 48322, 36240 },
+	{ 30585, 48824, 32767 },
+	{ 30585, 48824, 32767 },
+	{ 30585, 48824, 32767 },
+	{ 31951, 48322, 35972 },
+	{ 30585, 48322, 36240 },
+	{ 30585, 47104, 36080 },
+	{ 30585, 48322, 36240 },
+	{ 31951, 48322, 35972 },
+	{ 31951, 48322, 35972 },
+	{ 31888, 47104, 35825 },
+	{ 30585, 47104, 36080 },
+	{ 30585, 45598, 34774 },
+	{ 30585, 47104, 36080 },
+	{ 31888, 47104, 35825 },
+	{ 31888, 47104, 35825 },
+	{ 31374, 45598, 34619 },
+	{ 30585, 45598, 34774 },
+	{ 30585, 44236, 34806 },
+	{ 30585, 45598, 34774 },
+	{ 31374, 45598, 34619 },
+	{ 31374, 45598, 34619 },
+	{ 31385, 44236, 34648 },
+	{ 30585, 44236, 34806 },
+	{ 29218, 48322, 35972 },
+	{ 30585, 48824, 32767 },
+	{ 30585, 48824, 32767 },
+	{ 30585, 48824, 32767 },
+	{ 30585, 48322, 36240 },
+	{ 29218, 48322, 35972 },
+	{ 29281, 47104, 35825 },
+	{ 29218, 48322, 35972 },
+	{ 30585, 48322, 36240 },
+	{ 30585, 48322, 36240 },
+	{ 30585, 47104, 36080 },
+	{ 29281, 47104, 35825 },
+	{ 29796, 45598, 34619 },
+	{ 29281, 47104, 35825 },
+	{ 30585, 47104, 36080 },
+	{ 30585, 47104, 36080 },
+	{ 30585, 45598, 34774 },
+	{ 29796, 45598, 34619 },
+	{ 29784, 44236, 34648 },
+	{ 29796, 45598, 34619 },
+	{ 30585, 45598, 34774 },
+	{ 30585, 45598, 34774 },
+	{ 30585, 44236, 34806 },
+	{ 29784, 44236, 34648 },
+	{ 28116, 48322, 35236 },
+	{ 30585, 48824, 32767 },
+	{ 30585, 48824, 32767 },
+	{ 30585, 48824, 32767 },
+	{ 29218, 48322, 35972 },
+	{ 28116, 48322, 35236 },
+	{ 28229, 47104, 35122 },
+	{ 28116, 48322, 35236 },
+	{ 29218, 48322, 35972 },
+	{ 29218, 48322, 35972 },
+	{ 29281, 47104, 35825 },
+	{ 28229, 47104, 35122 },
+	{ 29158, 45598, 34193 },
+	{ 28229, 47104, 35122 },
+	{ 29281, 47104, 35825 },
+	{ 29281, 47104, 35825 },
+	{ 29796, 45598, 34619 },
+	{ 29158, 45598, 34193 },
+	{ 29137, 44236, 34215 },
+	{ 29158, 45598, 34193 },
+	{ 29796, 45598, 34619 },
+	{ 29796, 45598, 34619 },
+	{ 29784, 44236, 34648 },
+	{ 29137, 44236, 34215 },
+	{ 27380, 48322, 34134 },
+	{ 30585, 48824, 32767 },
+	{ 30585, 48824, 32767 },
+	{ 30585, 48824, 32767 },
+	{ 28116, 48322, 35236 },
+	{ 27380, 48322, 34134 },
+	{ 27527, 47104, 34071 },
+	{ 27380, 48322, 34134 },
+	{ 28116, 48322, 35236 },
+	{ 28116, 48322, 35236 },
+	{ 28229, 47104, 35122 },
+	{ 27527, 47104, 34071 },
+	{ 28733, 45598, 33556 },
+	{ 27527, 47104, 34071 },
+	{ 28229, 47104, 35122 },
+	{ 28229, 47104, 35122 },
+	{ 29158, 45598, 34193 },
+	{ 28733, 45598, 33556 },
+	{ 28704, 44236, 33567 },
+	{ 28733, 45598, 33556 },
+	{ 29158, 45598, 34193 },
+	{ 29158, 45598, 34193 },
+	{ 29137, 44236, 34215 },
+	{ 28704, 44236, 33567 },
+	{ 27112, 48322, 32767 },
+	{ 30585, 48824, 32767 },
+	{ 30585, 48824, 32767 },
+	{ 30585, 48824, 32767 },
+	{ 27380, 48322, 34134 },
+	{ 27112, 48322, 32767 },
+	{ 27271, 47104, 32767 },
+	{ 27112, 48322, 32767 },
+	{ 27380, 48322, 34134 },
+	{ 27380, 48322, 34134 },
+	{ 27527, 47104, 34071 },
+	{ 27271, 47104, 32767 },
+	{ 28577, 45598, 32767 },
+	{ 27271, 47104, 32767 },
+	{ 27527, 47104, 34071 },
+	{ 27527, 47104, 34071 },
+	{ 28733, 45598, 33556 },
+	{ 28577, 45598, 32767 },
+	{ 28546, 44236, 32767 },
+	{ 28577, 45598, 32767 },
+	{ 28733, 45598, 33556 },
+	{ 28733, 45598, 33556 },
+	{ 28704, 44236, 33567 },
+	{ 28546, 44236, 32767 },
+	{ 27380, 48322, 31400 },
+	{ 30585, 48824, 32767 },
+	{ 30585, 48824, 32767 },
+	{ 30585, 48824, 32767 },
+	{ 27112, 48322, 32767 },
+	{ 27380, 48322, 31400 },
+	{ 27527, 47104, 31463 },
+	{ 27380, 48322, 31400 },
+	{ 27112, 48322, 32767 },
+	{ 27112, 48322, 32767 },
+	{ 27271, 47104, 32767 },
+	{ 27527, 47104, 31463 },
+	{ 28733, 45598, 31978 },
+	{ 27527, 47104, 31463 },
+	{ 27271, 47104, 32767 },
+	{ 27271, 47104, 32767 },
+	{ 28577, 45598, 32767 },
+	{ 28733, 45598, 31978 },
+	{ 28704, 44236, 31967 },
+	{ 28733, 45598, 31978 },
+	{ 28577, 45598, 32767 },
+	{ 28577, 45598, 32767 },
+	{ 28546, 44236, 32767 },
+	{ 28704, 44236, 31967 },
+	{ 28116, 48322, 30298 },
+	{ 30585, 48824, 32767 },
+	{ 30585, 48824, 32767 },
+	{ 30585, 48824, 32767 },
+	{ 27380, 48322, 31400 },
+	{ 28116, 48322, 30298 },
+	{ 28229, 47104, 30412 },
+	{ 28116, 48322, 30298 },
+	{ 27380, 48322, 31400 },
+	{ 27380, 48322, 31400 },
+	{ 27527, 47104, 31463 },
+	{ 28229, 47104, 30412 },
+	{ 29158, 45598, 31341 },
+	{ 28229, 47104, 30412 },
+	{ 27527, 47104, 31463 },
+	{ 27527, 47104, 31463 },
+	{ 28733, 45598, 31978 },
+	{ 29158, 45598, 31341 },
+	{ 29137, 44236, 31319 },
+	{ 29158, 45598, 31341 },
+	{ 28733, 45598, 31978 },
+	{ 28733, 45598, 31978 },
+	{ 28704, 44236, 31967 },
+	{ 29137, 44236, 31319 },
+	{ 29218, 48322, 29562 },
+	{ 30585, 48824, 32767 },
+	{ 30585, 48824, 32767 },
+	{ 30585, 48824, 32767 },
+	{ 28116, 48322, 30298 },
+	{ 29218, 48322, 29562 },
+	{ 29281, 47104, 29709 },
+	{ 29218, 48322, 29562 },
+	{ 28116, 48322, 30298 },
+	{ 28116, 48322, 30298 },
+	{ 28229, 47104, 30412 },
+	{ 29281, 47104, 29709 },
+	{ 29796, 45598, 30915 },
+	{ 29281, 47104, 29709 },
+	{ 28229, 47104, 30412 },
+	{ 28229, 47104, 30412 },
+	{ 29158, 45598, 31341 },
+	{ 29796, 45598, 30915 },
+	{ 29784, 44236, 30886 },
+	{ 29796, 45598, 30915 },
+	{ 29158, 45598, 31341 },
+	{ 29158, 45598, 31341 },
+	{ 29137, 44236, 31319 },
+	{ 29784, 44236, 30886 },
+	{ 30585, 48322, 29294 },
+	{ 30585, 48824, 32767 },
+	{ 30585, 48824, 32767 },
+	{ 30585, 48824, 32767 },
+	{ 29218, 48322, 29562 },
+	{ 30585, 48322, 29294 },
+	{ 30585, 47104, 29454 },
+	{ 30585, 48322, 29294 },
+	{ 29218, 48322, 29562 },
+	{ 29218, 48322, 29562 },
+	{ 29281, 47104, 29709 },
+	{ 30585, 47104, 29454 },
+	{ 30585, 45598, 30760 },
+	{ 30585, 47104, 29454 },
+	{ 29281, 47104, 29709 },
+	{ 29281, 47104, 29709 },
+	{ 29796, 45598, 30915 },
+	{ 30585, 45598, 30760 },
+	{ 30585, 44236, 30728 },
+	{ 30585, 45598, 30760 },
+	{ 29796, 45598, 30915 },
+	{ 29796, 45598, 30915 },
+	{ 29784, 44236, 30886 },
+	{ 30585, 44236, 30728 },
+	{ 31951, 48322, 29562 },
+	{ 30585, 48824, 32767 },
+	{ 30585, 48824, 32767 },
+	{ 30585, 48824, 32767 },
+	{ 30585, 48322, 29294 },
+	{ 31951, 48322, 29562 },
+	{ 31888, 47104, 29709 },
+	{ 31951, 48322, 29562 },
+	{ 30585, 48322, 29294 },
+	{ 30585, 48322, 29294 },
+	{ 30585, 47104, 29454 },
+	{ 31888, 47104, 29709 },
+	{ 31374, 45598, 30915 },
+	{ 31888, 47104, 29709 },
+	{ 30585, 47104, 29454 },
+	{ 30585, 47104, 29454 },
+	{ 30585, 45598, 30760 },
+	{ 31374, 45598, 30915 },
+	{ 31385, 44236, 30886 },
+	{ 31374, 45598, 30915 },
+	{ 30585, 45598, 30760 },
+	{ 30585, 45598, 30760 },
+	{ 30585, 44236, 30728 },
+	{ 31385, 44236, 30886 },
+	{ 33053, 48322, 30298 },
+	{ 30585, 48824, 32767 },
+	{ 30585, 48824, 32767 },
+	{ 30585, 48824, 32767 },
+	{ 31951, 48322, 29562 },
+	{ 33053, 48322, 30298 },
+	{ 32940, 47104, 30412 },
+	{ 33053, 48322, 30298 },
+	{ 31951, 48322, 29562 },
+	{ 31951, 48322, 29562 },
+	{ 31888, 47104, 29709 },
+	{ 32940, 47104, 30412 },
+	{ 32011, 45598, 31341 },
+	{ 32940, 47104, 30412 },
+	{ 31888, 47104, 29709 },
+	{ 31888, 47104, 29709 },
+	{ 31374, 45598, 30915 },
+	{ 32011, 45598, 31341 },
+	{ 32032, 44236, 31319 },
+	{ 32011, 45598, 31341 },
+	{ 31374, 45598, 30915 },
+	{ 31374, 45598, 30915 },
+	{ 31385, 44236, 30886 },
+	{ 32032, 44236, 31319 },
+	{ 33789, 48322, 31400 },
+	{ 30585, 48824, 32767 },
+	{ 30585, 48824, 32767 },
+	{ 30585, 48824, 32767 },
+	{ 33053, 48322, 30298 },
+	{ 33789, 48322, 31400 },
+	{ 33642, 47104, 31463 },
+	{ 33789, 48322, 31400 },
+	{ 33053, 48322, 30298 },
+	{ 33053, 48322, 30298 },
+	{ 32940, 47104, 30412 },
+	{ 33642, 47104, 31463 },
+	{ 32437, 45598, 31978 },
+	{ 33642, 47104, 31463 },
+	{ 32940, 47104, 30412 },
+	{ 32940, 47104, 30412 },
+	{ 32011, 45598, 31341 },
+	{ 32437, 45598, 31978 },
+	{ 32466, 44236, 31967 },
+	{ 32437, 45598, 31978 },
+	{ 32011, 45598, 31341 },
+	{ 32011, 45598, 31341 },
+	{ 32032, 44236, 31319 },
+	{ 32466, 44236, 31967 },
+	{ 34057, 48322, 32767 },
+	{ 30585, 48824, 32767 },
+	{ 30585, 48824, 32767 },
+	{ 30585, 48824, 32767 },
+	{ 33789, 48322, 31400 },
+	{ 34057, 48322, 32767 },
+	{ 33898, 47104, 32767 },
+	{ 34057, 48322, 32767 },
+	{ 33789, 48322, 31400 },
+	{ 33789, 48322, 31400 },
+	{ 33642, 47104, 31463 },
+	{ 33898, 47104, 32767 },
+	{ 32592, 45598, 32767 },
+	{ 33898, 47104, 32767 },
+	{ 33642, 47104, 31463 },
+	{ 33642, 47104, 31463 },
+	{ 32437, 45598, 31978 },
+	{ 32592, 45598, 32767 },
+	{ 32624, 44236, 32767 },
+	{ 32592, 45598, 32767 },
+	{ 32437, 45598, 31978 },
+	{ 32437, 45598, 31978 },
+	{ 32466, 44236, 31967 },
+	{ 32624, 44236, 32767 },
+	{ 34876, 43328, 34593 },
+	{ 32466, 44236, 33567 },
+	{ 32624, 44236, 32767 },
+	{ 32624, 44236, 32767 },
+	{ 35236, 43328, 32767 },
+	{ 34876, 43328, 34593 },
+	{ 38344, 42707, 36068 },
+	{ 34876, 43328, 34593 },
+	{ 35236, 43328, 32767 },
+	{ 35236, 43328, 32767 },
+	{ 38996, 42707, 32767 },
+	{ 38344, 42707, 36068 },
+	{ 41459, 42086, 37394 },
+	{ 38344, 42707, 36068 },
+	{ 38996, 42707, 32767 },
+	{ 38996, 42707, 32767 },
+	{ 42373, 42086, 32767 },
+	{ 41459, 42086, 37394 },
+	{ 42811, 41178, 37969 },
+	{ 41459, 42086, 37394 },
+	{ 42373, 42086, 32767 },
+	{ 42373, 42086, 32767 },
+	{ 43838, 41178, 32767 },
+	{ 42811, 41178, 37969 },
+	{ 33887, 43328, 36070 },
+	{ 32032, 44236, 34215 },
+	{ 32466, 44236, 33567 },
+	{ 32466, 44236, 33567 },
+	{ 34876, 43328, 34593 },
+	{ 33887, 43328, 36070 },
+	{ 36556, 42707, 38739 },
+	{ 33887, 43328, 36070 },
+	{ 34876, 43328, 34593 },
+	{ 34876, 43328, 34593 },
+	{ 38344, 42707, 36068 },
+	{ 36556, 42707, 38739 },
+	{ 38954, 42086, 41137 },
+	{ 36556, 42707, 38739 },
+	{ 38344, 42707, 36068 },
+	{ 38344, 42707, 36068 },
+	{ 41459, 42086, 37394 },
+	{ 38954, 42086, 41137 },
+	{ 39995, 41178, 42177 },
+	{ 38954, 42086, 41137 },
+	{ 41459, 42086, 37394 },
+	{ 41459, 42086, 37394 },
+	{ 42811, 41178, 37969 },
+	{ 39995, 41178, 42177 },
+	{ 32410, 43328, 37058 },
+	{ 31385, 44236, 34648 },
+	{ 32032, 44236, 34215 },
+	{ 32032, 44236, 34215 },
+	{ 33887, 43328, 36070 },
+	{ 32410, 43328, 37058 },
+	{ 33886, 42707, 40526 },
+	{ 32410, 43328, 37058 },
+	{ 33887, 43328, 36070 },
+	{ 33887, 43328, 36070 },
+	{ 36556, 42707, 38739 },
+	{ 33886, 42707, 40526 },
+	{ 35211, 42086, 43641 },
+	{ 33886, 42707, 40526 },
+	{ 36556, 42707, 38739 },
+	{ 36556, 42707, 38739 },
+	{ 38954, 42086, 41137 },
+	{ 35211, 42086, 43641 },
+	{ 35787, 41178, 44993 },
+	{ 35211, 42086, 43641 },
+	{ 38954, 42086, 41137 },
+	{ 38954, 42086, 41137 },
+	{ 39995, 41178, 42177 },
+	{ 35787, 41178, 44993 },
+	{ 30585, 43328, 37419 },
+	{ 30585, 44236, 34806 },
+	{ 31385, 44236, 34648 },
+	{ 31385, 44236, 34648 },
+	{ 32410, 43328, 37058 },
+	{ 30585, 43328, 37419 },
+	{ 30585, 42707, 41178 },
+	{ 30585, 43328, 37419 },
+	{ 32410, 43328, 37058 },
+	{ 32410, 43328, 37058 },
+	{ 33886, 42707, 40526 },
+	{ 30585, 42707, 41178 },
+	{ 30585, 42086, 44555 },
+	{ 30585, 42707, 41178 },
+	{ 33886, 42707, 40526 },
+	{ 33886, 42707, 40526 },
+	{ 35211, 42086, 43641 },
+	{ 30585, 42086, 44555 },
+	{ 30585, 41178, 46021 },
+	{ 30585, 42086, 44555 },
+	{ 35211, 42086, 43641 },
+	{ 35211, 42086, 43641 },
+	{ 35787, 41178, 44993 },
+	{ 30585, 41178, 46021 },
+	{ 28759, 43328, 37058 },
+	{ 29784, 44236, 34648 },
+	{ 30585, 44236, 34806 },
+	{ 30585, 44236, 34806 },
+	{ 30585, 43328, 37419 },
+	{ 28759, 43328, 37058 },
+	{ 27283, 42707, 40526 },
+	{ 28759, 43328, 37058 },
+	{ 30585, 43328, 37419 },
+	{ 30585, 43328, 37419 },
+	{ 30585, 42707, 41178 },
+	{ 27283, 42707, 40526 },
+	{ 25958, 42086, 43641 },
+	{ 27283, 42707, 40526 },
+	{ 30585, 42707, 41178 },
+	{ 30585, 42707, 41178 },
+	{ 30585, 42086, 44555 },
+	{ 25958, 42086, 43641 },
+	{ 25383, 41178, 44993 },
+	{ 25958, 42086, 43641 },
+	{ 30585, 42086, 44555 },
+	{ 30585, 42086, 44555 },
+	{ 30585, 41178, 46021 },
+	{ 25383, 41178, 44993 },
+	{ 27282, 43328, 36070 },
+	{ 29137, 44236, 34215 },
+	{ 29784, 44236, 34648 },
+	{ 29784, 44236, 34648 },
+	{ 28759, 43328, 37058 },
+	{ 27282, 43328, 36070 },
+	{ 24613, 42707, 38739 },
+	{ 27282, 43328, 36070 },
+	{ 28759, 43328, 37058 },
+	{ 28759, 43328, 37058 },
+	{ 27283, 42707, 40526 },
+	{ 24613, 42707, 38739 },
+	{ 22215, 42086, 41137 },
+	{ 24613, 42707, 38739 },
+	{ 27283, 42707, 40526 },
+	{ 27283, 42707, 40526 },
+	{ 25958, 42086, 43641 },
+	{ 22215, 42086, 41137 },
+	{ 21175, 41178, 42177 },
+	{ 22215, 42086, 41137 },
+	{ 25958, 42086, 43641 },
+	{ 25958, 42086, 43641 },
+	{ 25383, 41178, 44993 },
+	{ 21175, 41178, 42177 },
+	{ 26294, 43328, 34593 },
+	{ 28704, 44236, 33567 },
+	{ 29137, 44236, 34215 },
+	{ 29137, 44236, 34215 },
+	{ 27282, 43328, 36070 },
+	{ 26294, 43328, 34593 },
+	{ 22826, 42707, 36068 },
+	{ 26294, 43328, 34593 },
+	{ 27282, 43328, 36070 },
+	{ 27282, 43328, 36070 },
+	{ 24613, 42707, 38739 },
+	{ 22826, 42707, 36068 },
+	{ 19710, 42086, 37394 },
+	{ 22826, 42707, 36068 },
+	{ 24613, 42707, 38739 },
+	{ 24613, 42707, 38739 },
+	{ 22215, 42086, 41137 },
+	{ 19710, 42086, 37394 },
+	{ 18358, 41178, 37969 },
+	{ 19710, 42086, 37394 },
+	{ 22215, 42086, 41137 },
+	{ 22215, 42086, 41137 },
+	{ 21175, 41178, 42177 },
+	{ 18358, 41178, 37969 },
+	{ 25933, 43328, 32767 },
+	{ 28546, 44236, 32767 },
+	{ 28704, 44236, 33567 },
+	{ 28704, 44236, 33567 },
+	{ 26294, 43328, 34593 },
+	{ 25933, 43328, 32767 },
+	{ 22174, 42707, 32767 },
+	{ 25933, 43328, 32767 },
+	{ 26294, 43328, 34593 },
+	{ 26294, 43328, 34593 },
+	{ 22826, 42707, 36068 },
+	{ 22174, 42707, 32767 },
+	{ 18797, 42086, 32767 },
+	{ 22174, 42707, 32767 },
+	{ 22826, 42707, 36068 },
+	{ 22826, 42707, 36068 },
+	{ 19710, 42086, 37394 },
+	{ 18797, 42086, 32767 },
+	{ 17331, 41178, 32767 },
+	{ 18797, 42086, 32767 },
+	{ 19710, 42086, 37394 },
+	{ 19710, 42086, 37394 },
+	{ 18358, 41178, 37969 },
+	{ 17331, 41178, 32767 },
+	{ 26294, 43328, 30941 },
+	{ 28704, 44236, 31967 },
+	{ 28546, 44236, 32767 },
+	{ 28546, 44236, 32767 },
+	{ 25933, 43328, 32767 },
+	{ 26294, 43328, 30941 },
+	{ 22826, 42707, 29466 },
+	{ 26294, 43328, 30941 },
+	{ 25933, 43328, 32767 },
+	{ 25933, 43328, 32767 },
+	{ 22174, 42707, 32767 },
+	{ 22826, 42707, 29466 },
+	{ 19710, 42086, 28140 },
+	{ 22826, 42707, 29466 },
+	{ 22174, 42707, 32767 },
+	{ 22174, 42707, 32767 },
+	{ 18797, 42086, 32767 },
+	{ 19710, 42086, 28140 },
+	{ 18358, 41178, 27565 },
+	{ 19710, 42086, 28140 },
+	{ 18797, 42086, 32767 },
+	{ 18797, 42086, 32767 },
+	{ 17331, 41178, 32767 },
+	{ 18358, 41178, 27565 },
+	{ 27282, 43328, 29464 },
+	{ 29137, 44236, 31319 },
+	{ 28704, 44236, 31967 },
+	{ 28704, 44236, 31967 },
+	{ 26294, 43328, 30941 },
+	{ 27282, 43328, 29464 },
+	{ 24613, 42707, 26795 },
+	{ 27282, 43328, 29464 },
+	{ 26294, 43328, 30941 },
+	{ 26294, 43328, 30941 },
+	{ 22826, 42707, 29466 },
+	{ 24613, 42707, 26795 },
+	{ 22215, 42086, 24398 },
+	{ 24613, 42707, 26795 },
+	{ 22826, 42707, 29466 },
+	{ 22826, 42707, 29466 },
+	{ 19710, 42086, 28140 },
+	{ 22215, 42086, 24398 },
+	{ 21175, 41178, 23357 },
+	{ 22215, 42086, 24398 },
+	{ 19710, 42086, 28140 },
+	{ 19710, 42086, 28140 },
+	{ 18358, 41178, 27565 },
+	{ 21175, 41178, 23357 },
+	{ 28759, 43328, 28476 },
+	{ 29784, 44236, 30886 },
+	{ 29137, 44236, 31319 },
+	{ 29137, 44236, 31319 },
+	{ 27282, 43328, 29464 },
+	{ 28759, 43328, 28476 },
+	{ 27283, 42707, 25008 },
+	{ 28759, 43328, 28476 },
+	{ 27282, 43328, 29464 },
+	{ 27282, 43328, 29464 },
+	{ 24613, 42707, 26795 },
+	{ 27283, 42707, 25008 },
+	{ 25958, 42086, 21893 },
+	{ 27283, 42707, 25008 },
+	{ 24613, 42707, 26795 },
+	{ 24613, 42707, 26795 },
+	{ 22215, 42086, 24398 },
+	{ 25958, 42086, 21893 },
+	{ 25383, 41178, 20541 },
+	{ 25958, 42086, 21893 },
+	{ 22215, 42086, 24398 },
+	{ 22215, 42086, 24398 },
+	{ 21175, 41178, 23357 },
+	{ 25383, 41178, 20541 },
+	{ 30585, 43328, 28116 },
+	{ 30585, 44236, 30728 },
+	{ 29784, 44236, 30886 },
+	{ 29784, 44236, 30886 },
+	{ 28759, 43328, 28476 },
+	{ 30585, 43328, 28116 },
+	{ 30585, 42707, 24356 },
+	{ 30585, 43328, 28116 },
+	{ 28759, 43328, 28476 },
+	{ 28759, 43328, 28476 },
+	{ 27283, 42707, 25008 },
+	{ 30585, 42707, 24356 },
+	{ 30585, 42086, 20979 },
+	{ 30585, 42707, 24356 },
+	{ 27283, 42707, 25008 },
+	{ 27283, 42707, 25008 },
+	{ 25958, 42086, 21893 },
+	{ 30585, 42086, 20979 },
+	{ 30585, 41178, 19513 },
+	{ 30585, 42086, 20979 },
+	{ 25958, 42086, 21893 },
+	{ 25958, 42086, 21893 },
+	{ 25383, 41178, 20541 },
+	{ 30585, 41178, 19513 },
+	{ 32410, 43328, 28476 },
+	{ 31385, 44236, 30886 },
+	{ 30585, 44236, 30728 },
+	{ 30585, 44236, 30728 },
+	{ 30585, 43328, 28116 },
+	{ 32410, 43328, 28476 },
+	{ 33886, 42707, 25008 },
+	{ 32410, 43328, 28476 },
+	{ 30585, 43328, 28116 },
+	{ 30585, 43328, 28116 },
+	{ 30585, 42707, 24356 },
+	{ 33886, 42707, 25008 },
+	{ 35211, 42086, 21893 },
+	{ 33886, 42707, 25008 },
+	{ 30585, 42707, 24356 },
+	{ 30585, 42707, 24356 },
+	{ 30585, 42086, 20979 },
+	{ 35211, 42086, 21893 },
+	{ 35787, 41178, 20541 },
+	{ 35211, 42086, 21893 },
+	{ 30585, 42086, 20979 },
+	{ 30585, 42086, 20979 },
+	{ 30585, 41178, 19513 },
+	{ 35787, 41178, 20541 },
+	{ 33887, 43328, 29464 },
+	{ 32032, 44236, 31319 },
+	{ 31385, 44236, 30886 },
+	{ 31385, 44236, 30886 },
+	{ 32410, 43328, 28476 },
+	{ 33887, 43328, 29464 },
+	{ 36556, 42707, 26795 },
+	{ 33887, 43328, 29464 },
+	{ 32410, 43328, 28476 },
+	{ 32410, 43328, 28476 },
+	{ 33886, 42707, 25008 },
+	{ 36556, 42707, 26795 },
+	{ 38954, 42086, 24398 },
+	{ 36556, 42707, 26795 },
+	{ 33886, 42707, 25008 },
+	{ 33886, 42707, 25008 },
+	{ 35211, 42086, 21893 },
+	{ 38954, 42086, 24398 },
+	{ 39995, 41178, 23357 },
+	{ 38954, 42086, 24398 },
+	{ 35211, 42086, 21893 },
+	{ 35211, 42086, 21893 },
+	{ 35787, 41178, 20541 },
+	{ 39995, 41178, 23357 },
+	{ 34876, 43328, 30941 },
+	{ 32466, 44236, 31967 },
+	{ 32032, 44236, 31319 },
+	{ 32032, 44236, 31319 },
+	{ 33887, 43328, 29464 },
+	{ 34876, 43328, 30941 },
+	{ 38344, 42707, 29466 },
+	{ 34876, 43328, 30941 },
+	{ 33887, 43328, 29464 },
+	{ 33887, 43328, 29464 },
+	{ 36556, 42707, 26795 },
+	{ 38344, 42707, 29466 },
+	{ 41459, 42086, 28140 },
+	{ 38344, 42707, 29466 },
+	{ 36556, 42707, 26795 },
+	{ 36556, 42707, 26795 },
+	{ 38954, 42086, 24398 },
+	{ 41459, 42086, 28140 },
+	{ 42811, 41178, 27565 },
+	{ 41459, 42086, 28140 },
+	{ 38954, 42086, 24398 },
+	{ 38954, 42086, 24398 },
+	{ 39995, 41178, 23357 },
+	{ 42811, 41178, 27565 },
+	{ 35236, 43328, 32767 },
+	{ 32624, 44236, 32767 },
+	{ 32466, 44236, 31967 },
+	{ 32466, 44236, 31967 },
+	{ 34876, 43328, 30941 },
+	{ 35236, 43328, 32767 },
+	{ 38996, 42707, 32767 },
+	{ 35236, 43328, 32767 },
+	{ 34876, 43328, 30941 },
+	{ 34876, 43328, 30941 },
+	{ 38344, 42707, 29466 },
+	{ 38996, 42707, 32767 },
+	{ 42373, 42086, 32767 },
+	{ 38996, 42707, 32767 },
+	{ 38344, 42707, 29466 },
+	{ 38344, 42707, 29466 },
+	{ 41459, 42086, 28140 },
+	{ 42373, 42086, 32767 },
+	{ 43838, 41178, 32767 },
+	{ 42373, 42086, 32767 },
+	{ 41459, 42086, 28140 },
+	{ 41459, 42086, 28140 },
+	{ 42811, 41178, 27565 },
+	{ 43838, 41178, 32767 },
 };
 
-const uint16_t *indices0 = (uint16_t*)0;
\ No newline at end of file
+const vertex_attributes_t attributes0[] =
+{ // normal[xyz], uv[xy]
+	{ 13, 160, 80,  212, 56 },
+	{ 13, 94, 80,  213, 62 },
+	{ 4, 94, 127,  222, 62 },
+	{ 4, 94, 127,  222, 62 },
+	{ 4, 160, 127,  220, 56 },
+	{ 13, 160, 80,  212, 56 },
+	{ 116, 254, 122,  214, 54 },
+	{ 13, 160, 80,  212, 56 },
+	{ 4, 160, 127,  220, 56 },
+	{ 4, 160, 127,  220, 56 },
+	{ 115, 254, 127,  222, 54 },
+	{ 116, 254, 122,  214, 54 },
+	{ 207, 220, 160,  217, 56 },
+	{ 116, 254, 122,  214, 54 },
+	{ 115, 254, 127,  222, 54 },
+	{ 115, 254, 127,  222, 54 },
+	{ 214, 220, 127,  226, 56 },
+	{ 207, 220, 160,  217, 56 },
+	{ 229, 190, 169,  221, 62 },
+	{ 207, 220, 160,  217, 56 },
+	{ 214, 220, 127,  226, 56 },
+	{ 214, 220, 127,  226, 56 },
+	{ 238, 190, 127,  230, 62 },
+	{ 229, 190, 169,  221, 62 },
+	{ 40, 160, 40,  189, 56 },
+	{ 40, 94, 40,  190, 62 },
+	{ 13, 94, 80,  213, 62 },
+	{ 13, 94, 80,  213, 62 },
+	{ 13, 160, 80,  212, 56 },
+	{ 40, 160, 40,  189, 56 },
+	{ 119, 254, 119,  190, 54 },
+	{ 40, 160, 40,  189, 56 },
+	{ 13, 160, 80,  212, 56 },
+	{ 13, 160, 80,  212, 56 },
+	{ 116, 254, 122,  214, 54 },
+	{ 119, 254, 119,  190, 54 },
+	{ 188, 220, 188,  192, 56 },
+	{ 119, 254, 119,  190, 54 },
+	{ 116, 254, 122,  214, 54 },
+	{ 116, 254, 122,  214, 54 },
+	{ 207, 220, 160,  217, 56 },
+	{ 188, 220, 188,  192, 56 },
+	{ 205, 190, 205,  195, 62 },
+	{ 188, 220, 188,  192, 56 },
+	{ 207, 220, 160,  217, 56 },
+	{ 207, 220, 160,  217, 56 },
+	{ 229, 190, 169,  221, 62 },
+	{ 205, 190, 205,  195, 62 },
+	{ 80, 160, 13,  154, 56 },
+	{ 80, 94, 13,  154, 62 },
+	{ 40, 94, 40,  190, 62 },
+	{ 40, 94, 40,  190, 62 },
+	{ 40, 160, 40,  189, 56 },
+	{ 80, 160, 13,  154, 56 },
+	{ 122, 254, 116,  154, 54 },
+	{ 80, 160, 13,  154, 56 },
+	{ 40, 160, 40,  189, 56 },
+	{ 40, 160, 40,  189, 56 },
+	{ 119, 254, 119,  190, 54 },
+	{ 122, 254, 116,  154, 54 },
+	{ 160, 220, 207,  156, 56 },
+	{ 122, 254, 116,  154, 54 },
+	{ 119, 254, 119,  190, 54 },
+	{ 119, 254, 119,  190, 54 },
+	{ 188, 220, 188,  192, 56 },
+	{ 160, 220, 207,  156, 56 },
+	{ 169, 190, 229,  157, 62 },
+	{ 160, 220, 207,  156, 56 },
+	{ 188, 220, 188,  192, 56 },
+	{ 188, 220, 188,  192, 56 },
+	{ 205, 190, 205,  195, 62 },
+	{ 169, 190, 229,  157, 62 },
+	{ 127, 159, 4,  110, 56 },
+	{ 127, 94, 4,  110, 62 },
+	{ 80, 94, 13,  154, 62 },
+	{ 80, 94, 13,  154, 62 },
+	{ 80, 160, 13,  154, 56 },
+	{ 127, 159, 4,  110, 56 },
+	{ 127, 254, 115,  110, 54 },
+	{ 127, 159, 4,  110, 56 },
+	{ 80, 160, 13,  154, 56 },
+	{ 80, 160, 13,  154, 56 },
+	{ 122, 254, 116,  154, 54 },
+	{ 127, 254, 115,  110, 54 },
+	{ 127, 220, 214,  110, 56 },
+	{ 127, 254, 115,  110, 54 },
+	{ 122, 254, 116,  154, 54 },
+	{ 122, 254, 116,  154, 54 },
+	{ 160, 220, 207,  156, 56 },
+	{ 127, 220, 214,  110, 56 },
+	{ 127, 190, 238,  110, 62 },
+	{ 127, 220, 214,  110, 56 },
+	{ 160, 220, 207,  156, 56 },
+	{ 160, 220, 207,  156, 56 },
+	{ 169, 190, 229,  157, 62 },
+	{ 127, 190, 238,  110, 62 },
+	{ 175, 146, 10,  66, 56 },
+	{ 175, 81, 18,  64, 62 },
+	{ 127, 94, 4,  110, 62 },
+	{ 127, 94, 4,  110, 62 },
+	{ 127, 159, 4,  110, 56 },
+	{ 175, 146, 10,  66, 56 },
+	{ 131, 253, 111,  66, 54 },
+	{ 175, 146, 10,  66, 56 },
+	{ 127, 159, 4,  110, 56 },
+	{ 127, 159, 4,  110, 56 },
+	{ 127, 254, 115,  110, 54 },
+	{ 131, 253, 111,  66, 54 },
+	{ 94, 220, 208,  65, 56 },
+	{ 131, 253, 111,  66, 54 },
+	{ 127, 254, 115,  110, 54 },
+	{ 127, 254, 115,  110, 54 },
+	{ 127, 220, 214,  110, 56 },
+	{ 94, 220, 208,  65, 56 },
+	{ 85, 190, 230,  64, 62 },
+	{ 94, 220, 208,  65, 56 },
+	{ 127, 220, 214,  110, 56 },
+	{ 127, 220, 214,  110, 56 },
+	{ 127, 190, 238,  110, 62 },
+	{ 85, 190, 230,  64, 62 },
+	{ 218, 136, 38,  31, 56 },
+	{ 212, 75, 47,  29, 62 },
+	{ 175, 81, 18,  64, 62 },
+	{ 175, 81, 18,  64, 62 },
+	{ 175, 146, 10,  66, 56 },
+	{ 218, 136, 38,  31, 56 },
+	{ 140, 253, 111,  31, 54 },
+	{ 218, 136, 38,  31, 56 },
+	{ 175, 146, 10,  66, 56 },
+	{ 175, 146, 10,  66, 56 },
+	{ 131, 253, 111,  66, 54 },
+	{ 140, 253, 111,  31, 54 },
+	{ 65, 219, 189,  28, 56 },
+	{ 140, 253, 111,  31, 54 },
+	{ 131, 253, 111,  66, 54 },
+	{ 131, 253, 111,  66, 54 },
+	{ 94, 220, 208,  65, 56 },
+	{ 65, 219, 189,  28, 56 },
+	{ 49, 190, 205,  26, 62 },
+	{ 65, 219, 189,  28, 56 },
+	{ 94, 220, 208,  65, 56 },
+	{ 94, 220, 208,  65, 56 },
+	{ 85, 190, 230,  64, 62 },
+	{ 49, 190, 205,  26, 62 },
+	{ 244, 148, 81,  9, 56 },
+	{ 239, 85, 84,  7, 62 },
+	{ 212, 75, 47,  29, 62 },
+	{ 212, 75, 47,  29, 62 },
+	{ 218, 136, 38,  31, 56 },
+	{ 244, 148, 81,  9, 56 },
+	{ 141, 254, 121,  7, 54 },
+	{ 244, 148, 81,  9, 56 },
+	{ 218, 136, 38,  31, 56 },
+	{ 218, 136, 38,  31, 56 },
+	{ 140, 253, 111,  31, 54 },
+	{ 141, 254, 121,  7, 54 },
+	{ 46, 220, 160,  4, 56 },
+	{ 141, 254, 121,  7, 54 },
+	{ 140, 253, 111,  31, 54 },
+	{ 140, 253, 111,  31, 54 },
+	{ 65, 219, 189,  28, 56 },
+	{ 46, 220, 160,  4, 56 },
+	{ 24, 190, 169,  0, 62 },
+	{ 46, 220, 160,  4, 56 },
+	{ 65, 219, 189,  28, 56 },
+	{ 65, 219, 189,  28, 56 },
+	{ 49, 190, 205,  26, 62 },
+	{ 24, 190, 169,  0, 62 },
+	{ 250, 159, 128,  0, 56 },
+	{ 250, 94, 128,  0, 62 },
+	{ 239, 85, 84,  7, 62 },
+	{ 239, 85, 84,  7, 62 },
+	{ 244, 148, 81,  9, 56 },
+	{ 250, 159, 128,  0, 56 },
+	{ 139, 254, 127,  0, 54 },
+	{ 250, 159, 128,  0, 56 },
+	{ 244, 148, 81,  9, 56 },
+	{ 244, 148, 81,  9, 56 },
+	{ 141, 254, 121,  7, 54 },
+	{ 139, 254, 127,  0, 54 },
+	{ 40, 220, 127,  252, 56 },
+	{ 139, 254, 127,  0, 54 },
+	{ 141, 254, 121,  7, 54 },
+	{ 141, 254, 121,  7, 54 },
+	{ 46, 220, 160,  4, 56 },
+	{ 40, 220, 127,  252, 56 },
+	{ 16, 190, 127,  248, 62 },
+	{ 40, 220, 127,  252, 56 },
+	{ 46, 220, 160,  4, 56 },
+	{ 46, 220, 160,  4, 56 },
+	{ 24, 190, 169,  0, 62 },
+	{ 16, 190, 127,  248, 62 },
+	{ 241, 160, 174,  9, 56 },
+	{ 241, 94, 174,  8, 62 },
+	{ 250, 94, 128,  0, 62 },
+	{ 250, 94, 128,  0, 62 },
+	{ 250, 159, 128,  0, 56 },
+	{ 241, 160, 174,  9, 56 },
+	{ 138, 254, 132,  7, 54 },
+	{ 241, 160, 174,  9, 56 },
+	{ 250, 159, 128,  0, 56 },
+	{ 250, 159, 128,  0, 56 },
+	{ 139, 254, 127,  0, 54 },
+	{ 138, 254, 132,  7, 54 },
+	{ 47, 220, 94,  4, 56 },
+	{ 138, 254, 132,  7, 54 },
+	{ 139, 254, 127,  0, 54 },
+	{ 139, 254, 127,  0, 54 },
+	{ 40, 220, 127,  252, 56 },
+	{ 47, 220, 94,  4, 56 },
+	{ 25, 190, 85,  0, 62 },
+	{ 47, 220, 94,  4, 56 },
+	{ 40, 220, 127,  252, 56 },
+	{ 40, 220, 127,  252, 56 },
+	{ 16, 190, 127,  248, 62 },
+	{ 25, 190, 85,  0, 62 },
+	{ 214, 160, 214,  32, 56 },
+	{ 214, 94, 214,  31, 62 },
+	{ 241, 94, 174,  8, 62 },
+	{ 241, 94, 174,  8, 62 },
+	{ 241, 160, 174,  9, 56 },
+	{ 214, 160, 214,  32, 56 },
+	{ 135, 254, 135,  31, 54 },
+	{ 214, 160, 214,  32, 56 },
+	{ 241, 160, 174,  9, 56 },
+	{ 241, 160, 174,  9, 56 },
+	{ 138, 254, 132,  7, 54 },
+	{ 135, 254, 135,  31, 54 },
+	{ 66, 220, 66,  28, 56 },
+	{ 135, 254, 135,  31, 54 },
+	{ 138, 254, 132,  7, 54 },
+	{ 138, 254, 132,  7, 54 },
+	{ 47, 220, 94,  4, 56 },
+	{ 66, 220, 66,  28, 56 },
+	{ 49, 190, 49,  26, 62 },
+	{ 66, 220, 66,  28, 56 },
+	{ 47, 220, 94,  4, 56 },
+	{ 47, 220, 94,  4, 56 },
+	{ 25, 190, 85,  0, 62 },
+	{ 49, 190, 49,  26, 62 },
+	{ 174, 160, 241,  67, 56 },
+	{ 174, 94, 241,  67, 62 },
+	{ 214, 94, 214,  31, 62 },
+	{ 214, 94, 214,  31, 62 },
+	{ 214, 160, 214,  32, 56 },
+	{ 174, 160, 241,  67, 56 },
+	{ 132, 254, 138,  67, 54 },
+	{ 174, 160, 241,  67, 56 },
+	{ 214, 160, 214,  32, 56 },
+	{ 214, 160, 214,  32, 56 },
+	{ 135, 254, 135,  31, 54 },
+	{ 132, 254, 138,  67, 54 },
+	{ 94, 220, 47,  65, 56 },
+	{ 132, 254, 138,  67, 54 },
+	{ 135, 254, 135,  31, 54 },
+	{ 135, 254, 135,  31, 54 },
+	{ 66, 220, 66,  28, 56 },
+	{ 94, 220, 47,  65, 56 },
+	{ 85, 190, 25,  64, 62 },
+	{ 94, 220, 47,  65, 56 },
+	{ 66, 220, 66,  28, 56 },
+	{ 66, 220, 66,  28, 56 },
+	{ 49, 190, 49,  26, 62 },
+	{ 85, 190, 25,  64, 62 },
+	{ 127, 160, 250,  110, 56 },
+	{ 127, 94, 250,  110, 62 },
+	{ 174, 94, 241,  67, 62 },
+	{ 174, 94, 241,  67, 62 },
+	{ 174, 160, 241,  67, 56 },
+	{ 127, 160, 250,  110, 56 },
+	{ 127, 254, 139,  110, 54 },
+	{ 127, 160, 250,  110, 56 },
+	{ 174, 160, 241,  67, 56 },
+	{ 174, 160, 241,  67, 56 },
+	{ 132, 254, 138,  67, 54 },
+	{ 127, 254, 139,  110, 54 },
+	{ 127, 220, 40,  110, 56 },
+	{ 127, 254, 139,  110, 54 },
+	{ 132, 254, 138,  67, 54 },
+	{ 132, 254, 138,  67, 54 },
+	{ 94, 220, 47,  65, 56 },
+	{ 127, 220, 40,  110, 56 },
+	{ 127, 190, 16,  110, 62 },
+	{ 127, 220, 40,  110, 56 },
+	{ 94, 220, 47,  65, 56 },
+	{ 94, 220, 47,  65, 56 },
+	{ 85, 190, 25,  64, 62 },
+	{ 127, 190, 16,  110, 62 },
+	{ 80, 160, 241,  154, 56 },
+	{ 80, 94, 241,  154, 62 },
+	{ 127, 94, 250,  110, 62 },
+	{ 127, 94, 250,  110, 62 },
+	{ 127, 160, 250,  110, 56 },
+	{ 80, 160, 241,  154, 56 },
+	{ 122, 254, 138,  154, 54 },
+	{ 80, 160, 241,  154, 56 },
+	{ 127, 160, 250,  110, 56 },
+	{ 127, 160, 250,  110, 56 },
+	{ 127, 254, 139,  110, 54 },
+	{ 122, 254, 138,  154, 54 },
+	{ 160, 220, 47,  156, 56 },
+	{ 122, 254, 138,  154, 54 },
+	{ 127, 254, 139,  110, 54 },
+	{ 127, 254, 139,  110, 54 },
+	{ 127, 220, 40,  110, 56 },
+	{ 160, 220, 47,  156, 56 },
+	{ 169, 190, 25,  157, 62 },
+	{ 160, 220, 47,  156, 56 },
+	{ 127, 220, 40,  110, 56 },
+	{ 127, 220, 40,  110, 56 },
+	{ 127, 190, 16,  110, 62 },
+	{ 169, 190, 25,  157, 62 },
+	{ 40, 160, 214,  189, 56 },
+	{ 40, 94, 214,  190, 62 },
+	{ 80, 94, 241,  154, 62 },
+	{ 80, 94, 241,  154, 62 },
+	{ 80, 160, 241,  154, 56 },
+	{ 40, 160, 214,  189, 56 },
+	{ 119, 254, 135,  190, 54 },
+	{ 40, 160, 214,  189, 56 },
+	{ 80, 160, 241,  154, 56 },
+	{ 80, 160, 241,  154, 56 },
+	{ 122, 254, 138,  154, 54 },
+	{ 119, 254, 135,  190, 54 },
+	{ 188, 220, 66,  192, 56 },
+	{ 119, 254, 135,  190, 54 },
+	{ 122, 254, 138,  154, 54 },
+	{ 122, 254, 138,  154, 54 },
+	{ 160, 220, 47,  156, 56 },
+	{ 188, 220, 66,  192, 56 },
+	{ 205, 190, 49,  195, 62 },
+	{ 188, 220, 66,  192, 56 },
+	{ 160, 220, 47,  156, 56 },
+	{ 160, 220, 47,  156, 56 },
+	{ 169, 190, 25,  157, 62 },
+	{ 205, 190, 49,  195, 62 },
+	{ 13, 160, 174,  212, 56 },
+	{ 13, 94, 174,  213, 62 },
+	{ 40, 94, 214,  190, 62 },
+	{ 40, 94, 214,  190, 62 },
+	{ 40, 160, 214,  189, 56 },
+	{ 13, 160, 174,  212, 56 },
+	{ 116, 254, 132,  214, 54 },
+	{ 13, 160, 174,  212, 56 },
+	{ 40, 160, 214,  189, 56 },
+	{ 40, 160, 214,  189, 56 },
+	{ 119, 254, 135,  190, 54 },
+	{ 116, 254, 132,  214, 54 },
+	{ 207, 220, 94,  217, 56 },
+	{ 116, 254, 132,  214, 54 },
+	{ 119, 254, 135,  190, 54 },
+	{ 119, 254, 135,  190, 54 },
+	{ 188, 220, 66,  192, 56 },
+	{ 207, 220, 94,  217, 56 },
+	{ 229, 190, 85,  221, 62 },
+	{ 207, 220, 94,  217, 56 },
+	{ 188, 220, 66,  192, 56 },
+	{ 188, 220, 66,  192, 56 },
+	{ 205, 190, 49,  195, 62 },
+	{ 229, 190, 85,  221, 62 },
+	{ 4, 160, 127,  220, 56 },
+	{ 4, 94, 127,  222, 62 },
+	{ 13, 94, 174,  213, 62 },
+	{ 13, 94, 174,  213, 62 },
+	{ 13, 160, 174,  212, 56 },
+	{ 4, 160, 127,  220, 56 },
+	{ 115, 254, 127,  222, 54 },
+	{ 4, 160, 127,  220, 56 },
+	{ 13, 160, 174,  212, 56 },
+	{ 13, 160, 174,  212, 56 },
+	{ 116, 254, 132,  214, 54 },
+	{ 115, 254, 127,  222, 54 },
+	{ 214, 220, 127,  226, 56 },
+	{ 115, 254, 127,  222, 54 },
+	{ 116, 254, 132,  214, 54 },
+	{ 116, 254, 132,  214, 54 },
+	{ 207, 220, 94,  217, 56 },
+	{ 214, 220, 127,  226, 56 },
+	{ 238, 190, 127,  230, 62 },
+	{ 214, 220, 127,  226, 56 },
+	{ 207, 220, 94,  217, 56 },
+	{ 207, 220, 94,  217, 56 },
+	{ 229, 190, 85,  221, 62 },
+	{ 238, 190, 127,  230, 62 },
+	{ 235, 178, 172,  234, 93 },
+	{ 229, 190, 169,  221, 62 },
+	{ 238, 190, 127,  230, 62 },
+	{ 238, 190, 127,  230, 62 },
+	{ 244, 178, 127,  245, 93 },
+	{ 235, 178, 172,  234, 93 },
+	{ 238, 170, 173,  246, 124 },
+	{ 235, 178, 172,  234, 93 },
+	{ 244, 178, 127,  245, 93 },
+	{ 244, 178, 127,  245, 93 },
+	{ 247, 170, 127,  1, 124 },
+	{ 238, 170, 173,  246, 124 },
+	{ 242, 153, 175,  254, 153 },
+	{ 238, 170, 173,  246, 124 },
+	{ 247, 170, 127,  1, 124 },
+	{ 247, 170, 127,  1, 124 },
+	{ 252, 153, 127,  10, 153 },
+	{ 242, 153, 175,  254, 153 },
+	{ 245, 119, 176,  1, 181 },
+	{ 242, 153, 175,  254, 153 },
+	{ 252, 153, 127,  10, 153 },
+	{ 252, 153, 127,  10, 153 },
+	{ 254, 119, 127,  14, 181 },
+	{ 245, 119, 176,  1, 181 },
+	{ 209, 179, 209,  206, 93 },
+	{ 205, 190, 205,  195, 62 },
+	{ 229, 190, 169,  221, 62 },
+	{ 229, 190, 169,  221, 62 },
+	{ 235, 178, 172,  234, 93 },
+	{ 209, 179, 209,  206, 93 },
+	{ 212, 170, 212,  215, 124 },
+	{ 209, 179, 209,  206, 93 },
+	{ 235, 178, 172,  234, 93 },
+	{ 235, 178, 172,  234, 93 },
+	{ 238, 170, 173,  246, 124 },
+	{ 212, 170, 212,  215, 124 },
+	{ 215, 153, 215,  221, 153 },
+	{ 212, 170, 212,  215, 124 },
+	{ 238, 170, 173,  246, 124 },
+	{ 238, 170, 173,  246, 124 },
+	{ 242, 153, 175,  254, 153 },
+	{ 215, 153, 215,  221, 153 },
+	{ 217, 119, 217,  224, 181 },
+	{ 215, 153, 215,  221, 153 },
+	{ 242, 153, 175,  254, 153 },
+	{ 242, 153, 175,  254, 153 },
+	{ 245, 119, 176,  1, 181 },
+	{ 217, 119, 217,  224, 181 },
+	{ 172, 178, 235,  163, 93 },
+	{ 169, 190, 229,  157, 62 },
+	{ 205, 190, 205,  195, 62 },
+	{ 205, 190, 205,  195, 62 },
+	{ 209, 179, 209,  206, 93 },
+	{ 172, 178, 235,  163, 93 },
+	{ 173, 170, 238,  168, 124 },
+	{ 172, 178, 235,  163, 93 },
+	{ 209, 179, 209,  206, 93 },
+	{ 209, 179, 209,  206, 93 },
+	{ 212, 170, 212,  215, 124 },
+	{ 173, 170, 238,  168, 124 },
+	{ 175, 153, 242,  172, 153 },
+	{ 173, 170, 238,  168, 124 },
+	{ 212, 170, 212,  215, 124 },
+	{ 212, 170, 212,  215, 124 },
+	{ 215, 153, 215,  221, 153 },
+	{ 175, 153, 242,  172, 153 },
+	{ 176, 119, 245,  173, 181 },
+	{ 175, 153, 242,  172, 153 },
+	{ 215, 153, 215,  221, 153 },
+	{ 215, 153, 215,  221, 153 },
+	{ 217, 119, 217,  224, 181 },
+	{ 176, 119, 245,  173, 181 },
+	{ 127, 178, 244,  110, 93 },
+	{ 127, 190, 238,  110, 62 },
+	{ 169, 190, 229,  157, 62 },
+	{ 169, 190, 229,  157, 62 },
+	{ 172, 178, 235,  163, 93 },
+	{ 127, 178, 244,  110, 93 },
+	{ 127, 170, 247,  110, 124 },
+	{ 127, 178, 244,  110, 93 },
+	{ 172, 178, 235,  163, 93 },
+	{ 172, 178, 235,  163, 93 },
+	{ 173, 170, 238,  168, 124 },
+	{ 127, 170, 247,  110, 124 },
+	{ 127, 153, 252,  110, 153 },
+	{ 127, 170, 247,  110, 124 },
+	{ 173, 170, 238,  168, 124 },
+	{ 173, 170, 238,  168, 124 },
+	{ 175, 153, 242,  172, 153 },
+	{ 127, 153, 252,  110, 153 },
+	{ 127, 119, 254,  110, 181 },
+	{ 127, 153, 252,  110, 153 },
+	{ 175, 153, 242,  172, 153 },
+	{ 175, 153, 242,  172, 153 },
+	{ 176, 119, 245,  173, 181 },
+	{ 127, 119, 254,  110, 181 },
+	{ 82, 178, 235,  58, 93 },
+	{ 85, 190, 230,  64, 62 },
+	{ 127, 190, 238,  110, 62 },
+	{ 127, 190, 238,  110, 62 },
+	{ 127, 178, 244,  110, 93 },
+	{ 82, 178, 235,  58, 93 },
+	{ 81, 170, 238,  53, 124 },
+	{ 82, 178, 235,  58, 93 },
+	{ 127, 178, 244,  110, 93 },
+	{ 127, 178, 244,  110, 93 },
+	{ 127, 170, 247,  110, 124 },
+	{ 81, 170, 238,  53, 124 },
+	{ 79, 153, 242,  49, 153 },
+	{ 81, 170, 238,  53, 124 },
+	{ 127, 170, 247,  110, 124 },
+	{ 127, 170, 247,  110, 124 },
+	{ 127, 153, 252,  110, 153 },
+	{ 79, 153, 242,  49, 153 },
+	{ 78, 119, 245,  48, 181 },
+	{ 79, 153, 242,  49, 153 },
+	{ 127, 153, 252,  110, 153 },
+	{ 127, 153, 252,  110, 153 },
+	{ 127, 119, 254,  110, 181 },
+	{ 78, 119, 245,  48, 181 },
+	{ 45, 179, 209,  15, 93 },
+	{ 49, 190, 205,  26, 62 },
+	{ 85, 190, 230,  64, 62 },
+	{ 85, 190, 230,  64, 62 },
+	{ 82, 178, 235,  58, 93 },
+	{ 45, 179, 209,  15, 93 },
+	{ 42, 170, 212,  6, 124 },
+	{ 45, 179, 209,  15, 93 },
+	{ 82, 178, 235,  58, 93 },
+	{ 82, 178, 235,  58, 93 },
+	{ 81, 170, 238,  53, 124 },
+	{ 42, 170, 212,  6, 124 },
+	{ 39, 153, 215,  0, 153 },
+	{ 42, 170, 212,  6, 124 },
+	{ 81, 170, 238,  53, 124 },
+	{ 81, 170, 238,  53, 124 },
+	{ 79, 153, 242,  49, 153 },
+	{ 39, 153, 215,  0, 153 },
+	{ 37, 119, 217,  254, 181 },
+	{ 39, 153, 215,  0, 153 },
+	{ 79, 153, 242,  49, 153 },
+	{ 79, 153, 242,  49, 153 },
+	{ 78, 119, 245,  48, 181 },
+	{ 37, 119, 217,  254, 181 },
+	{ 19, 178, 172,  244, 93 },
+	{ 24, 190, 169,  0, 62 },
+	{ 49, 190, 205,  26, 62 },
+	{ 49, 190, 205,  26, 62 },
+	{ 45, 179, 209,  15, 93 },
+	{ 19, 178, 172,  244, 93 },
+	{ 16, 170, 173,  232, 124 },
+	{ 19, 178, 172,  244, 93 },
+	{ 45, 179, 209,  15, 93 },
+	{ 45, 179, 209,  15, 93 },
+	{ 42, 170, 212,  6, 124 },
+	{ 16, 170, 173,  232, 124 },
+	{ 12, 153, 175,  224, 153 },
+	{ 16, 170, 173,  232, 124 },
+	{ 42, 170, 212,  6, 124 },
+	{ 42, 170, 212,  6, 124 },
+	{ 39, 153, 215,  0, 153 },
+	{ 12, 153, 175,  224, 153 },
+	{ 9, 119, 176,  220, 181 },
+	{ 12, 153, 175,  224, 153 },
+	{ 39, 153, 215,  0, 153 },
+	{ 39, 153, 215,  0, 153 },
+	{ 37, 119, 217,  254, 181 },
+	{ 9, 119, 176,  220, 181 },
+	{ 10, 178, 127,  233, 93 },
+	{ 16, 190, 127,  248, 62 },
+	{ 24, 190, 169,  0, 62 },
+	{ 24, 190, 169,  0, 62 },
+	{ 19, 178, 172,  244, 93 },
+	{ 10, 178, 127,  233, 93 },
+	{ 7, 170, 127,  221, 124 },
+	{ 10, 178, 127,  233, 93 },
+	{ 19, 178, 172,  244, 93 },
+	{ 19, 178, 172,  244, 93 },
+	{ 16, 170, 173,  232, 124 },
+	{ 7, 170, 127,  221, 124 },
+	{ 2, 153, 127,  212, 153 },
+	{ 7, 170, 127,  221, 124 },
+	{ 16, 170, 173,  232, 124 },
+	{ 16, 170, 173,  232, 124 },
+	{ 12, 153, 175,  224, 153 },
+	{ 2, 153, 127,  212, 153 },
+	{ 0, 119, 127,  208, 181 },
+	{ 2, 153, 127,  212, 153 },
+	{ 12, 153, 175,  224, 153 },
+	{ 12, 153, 175,  224, 153 },
+	{ 9, 119, 176,  220, 181 },
+	{ 0, 119, 127,  208, 181 },
+	{ 19, 178, 82,  244, 93 },
+	{ 25, 190, 85,  0, 62 },
+	{ 16, 190, 127,  248, 62 },
+	{ 16, 190, 127,  248, 62 },
+	{ 10, 178, 127,  233, 93 },
+	{ 19, 178, 82,  244, 93 },
+	{ 16, 170, 81,  232, 124 },
+	{ 19, 178, 82,  244, 93 },
+	{ 10, 178, 127,  233, 93 },
+	{ 10, 178, 127,  233, 93 },
+	{ 7, 170, 127,  221, 124 },
+	{ 16, 170, 81,  232, 124 },
+	{ 12, 153, 79,  224, 153 },
+	{ 16, 170, 81,  232, 124 },
+	{ 7, 170, 127,  221, 124 },
+	{ 7, 170, 127,  221, 124 },
+	{ 2, 153, 127,  212, 153 },
+	{ 12, 153, 79,  224, 153 },
+	{ 9, 119, 78,  220, 181 },
+	{ 12, 153, 79,  224, 153 },
+	{ 2, 153, 127,  212, 153 },
+	{ 2, 153, 127,  212, 153 },
+	{ 0, 119, 127,  208, 181 },
+	{ 9, 119, 78,  220, 181 },
+	{ 45, 179, 45,  15, 93 },
+	{ 49, 190, 49,  26, 62 },
+	{ 25, 190, 85,  0, 62 },
+	{ 25, 190, 85,  0, 62 },
+	{ 19, 178, 82,  244, 93 },
+	{ 45, 179, 45,  15, 93 },
+	{ 42, 170, 42,  6, 124 },
+	{ 45, 179, 45,  15, 93 },
+	{ 19, 178, 82,  244, 93 },
+	{ 19, 178, 82,  244, 93 },
+	{ 16, 170, 81,  232, 124 },
+	{ 42, 170, 42,  6, 124 },
+	{ 39, 153, 39,  0, 153 },
+	{ 42, 170, 42,  6, 124 },
+	{ 16, 170, 81,  232, 124 },
+	{ 16, 170, 81,  232, 124 },
+	{ 12, 153, 79,  224, 153 },
+	{ 39, 153, 39,  0, 153 },
+	{ 37, 119, 37,  254, 181 },
+	{ 39, 153, 39,  0, 153 },
+	{ 12, 153, 79,  224, 153 },
+	{ 12, 153, 79,  224, 153 },
+	{ 9, 119, 78,  220, 181 },
+	{ 37, 119, 37,  254, 181 },
+	{ 82, 178, 19,  58, 93 },
+	{ 85, 190, 25,  64, 62 },
+	{ 49, 190, 49,  26, 62 },
+	{ 49, 190, 49,  26, 62 },
+	{ 45, 179, 45,  15, 93 },
+	{ 82, 178, 19,  58, 93 },
+	{ 81, 170, 16,  53, 124 },
+	{ 82, 178, 19,  58, 93 },
+	{ 45, 179, 45,  15, 93 },
+	{ 45, 179, 45,  15, 93 },
+	{ 42, 170, 42,  6, 124 },
+	{ 81, 170, 16,  53, 124 },
+	{ 79, 153, 12,  49, 153 },
+	{ 81, 170, 16,  53, 124 },
+	{ 42, 170, 42,  6, 124 },
+	{ 42, 170, 42,  6, 124 },
+	{ 39, 153, 39,  0, 153 },
+	{ 79, 153, 12,  49, 153 },
+	{ 78, 119, 9,  48, 181 },
+	{ 79, 153, 12,  49, 153 },
+	{ 39, 153, 39,  0, 153 },
+	{ 39, 153, 39,  0, 153 },
+	{ 37, 119, 37,  254, 181 },
+	{ 78, 119, 9,  48, 181 },
+	{ 127, 178, 10,  110, 93 },
+	{ 127, 190, 16,  110, 62 },
+	{ 85, 190, 25,  64, 62 },
+	{ 85, 190, 25,  64, 62 },
+	{ 82, 178, 19,  58, 93 },
+	{ 127, 178, 10,  110, 93 },
+	{ 127, 170, 7,  110, 124 },
+	{ 127, 178, 10,  110, 93 },
+	{ 82, 178, 19,  58, 93 },
+	{ 82, 178, 19,  58, 93 },
+	{ 81, 170, 16,  53, 124 },
+	{ 127, 170, 7,  110, 124 },
+	{ 127, 153, 2,  110, 153 },
+	{ 127, 170, 7,  110, 124 },
+	{ 81, 170, 16,  53, 124 },
+	{ 81, 170, 16,  53, 124 },
+	{ 79, 153, 12,  49, 153 },
+	{ 127, 153, 2,  110, 153 },
+	{ 127, 119, 0,  110, 181 },
+	{ 127, 153, 2,  110, 153 },
+	{ 79, 153, 12,  49, 153 },
+	{ 79, 153, 12,  49, 153 },
+	{ 78, 119, 9,  48, 181 },
+	{ 127, 119, 0,  110, 181 },
+	{ 172, 178, 19,  163, 93 },
+	{ 169, 190, 25,  157, 62 },
+	{ 127, 190, 16,  110, 62 },
+	{ 127, 190, 16,  110, 62 },
+	{ 127, 178, 10,  110, 93 },
+	{ 172, 178, 19,  163, 93 },
+	{ 173, 170, 16,  168, 124 },
+	{ 172, 178, 19,  163, 93 },
+	{ 127, 178, 10,  110, 93 },
+	{ 127, 178, 10,  110, 93 },
+	{ 127, 170, 7,  110, 124 },
+	{ 173, 170, 16,  168, 124 },
+	{ 175, 153, 12,  172, 153 },
+	{ 173, 170, 16,  168, 124 },
+	{ 127, 170, 7,  110, 124 },
+	{ 127, 170, 7,  110, 124 },
+	{ 127, 153, 2,  110, 153 },
+	{ 175, 153, 12,  172, 153 },
+	{ 176, 119, 9,  173, 181 },
+	{ 175, 153, 12,  172, 153 },
+	{ 127, 153, 2,  110, 153 },
+	{ 127, 153, 2,  110, 153 },
+	{ 127, 119, 0,  110, 181 },
+	{ 176, 119, 9,  173, 181 },
+	{ 209, 179, 45,  206, 93 },
+	{ 205, 190, 49,  195, 62 },
+	{ 169, 190, 25,  157, 62 },
+	{ 169, 190, 25,  157, 62 },
+	{ 172, 178, 19,  163, 93 },
+	{ 209, 179, 45,  206, 93 },
+	{ 212, 170, 42,  215, 124 },
+	{ 209, 179, 45,  206, 93 },
+	{ 172, 178, 19,  163, 93 },
+	{ 172, 178, 19,  163, 93 },
+	{ 173, 170, 16,  168, 124 },
+	{ 212, 170, 42,  215, 124 },
+	{ 215, 153, 39,  221, 153 },
+	{ 212, 170, 42,  215, 124 },
+	{ 173, 170, 16,  168, 124 },
+	{ 173, 170, 16,  168, 124 },
+	{ 175, 153, 12,  172, 153 },
+	{ 215, 153, 39,  221, 153 },
+	{ 217, 119, 37,  224, 181 },
+	{ 215, 153, 39,  221, 153 },
+	{ 175, 153, 12,  172, 153 },
+	{ 175, 153, 12,  172, 153 },
+	{ 176, 119, 9,  173, 181 },
+	{ 217, 119, 37,  224, 181 },
+	{ 235, 178, 82,  234, 93 },
+	{ 229, 190, 85,  221, 62 },
+	{ 205, 190, 49,  195, 62 },
+	{ 205, 190, 49,  195, 62 },
+	{ 209, 179, 45,  206, 93 },
+	{ 235, 178, 82,  234, 93 },
+	{ 238, 170, 81,  246, 124 },
+	{ 235, 178, 82,  234, 93 },
+	{ 209, 179, 45,  206, 93 },
+	{ 209, 179, 45,  206, 93 },
+	{ 212, 170, 42,  215, 124 },
+	{ 238, 170, 81,  246, 124 },
+	{ 242, 153, 79,  254, 153 },
+	{ 238, 170, 81,  246, 124 },
+	{ 212, 170, 42,  215, 124 },
+	{ 212, 170, 42,  215, 124 },
+	{ 215, 153, 39,  221, 153 },
+	{ 242, 153, 79,  254, 153 },
+	{ 245, 119, 78,  1, 181 },
+	{ 242, 153, 79,  254, 153 },
+	{ 215, 153, 39,  221, 153 },
+	{ 215, 153, 39,  221, 153 },
+	{ 217, 119, 37,  224, 181 },
+	{ 245, 119, 78,  1, 181 },
+	{ 244, 178, 127,  245, 93 },
+	{ 238, 190, 127,  230, 62 },
+	{ 229, 190, 85,  221, 62 },
+	{ 229, 190, 85,  221, 62 },
+	{ 235, 178, 82,  234, 93 },
+	{ 244, 178, 127,  245, 93 },
+	{ 247, 170, 127,  1, 124 },
+	{ 244, 178, 127,  245, 93 },
+	{ 235, 178, 82,  234, 93 },
+	{ 235, 178, 82,  234, 93 },
+	{ 238, 170, 81,  246, 124 },
+	{ 247, 170, 127,  1, 124 },
+	{ 252, 153, 127,  10, 153 },
+	{ 247, 170, 127,  1, 124 },
+	{ 238, 170, 81,  246, 124 },
+	{ 238, 170, 81,  246, 124 },
+	{ 242, 153, 79,  254, 153 },
+	{ 252, 153, 127,  10, 153 },
+	{ 254, 119, 127,  14, 181 },
+	{ 252, 153, 127,  10, 153 },
+	{ 242, 153, 79,  254, 153 },
+	{ 242, 153, 79,  254, 153 },
+	{ 245, 119, 78,  1, 181 },
+	{ 254, 119, 127,  14, 181 },
+	{ 233, 71, 171,  252, 205 },
+	{ 245, 119, 176,  1, 181 },
+	{ 254, 119, 127,  14, 181 },
+	{ 254, 119, 127,  14, 181 },
+	{ 242, 71, 127,  8, 205 },
+	{ 233, 71, 171,  252, 205 },
+	{ 213, 40, 163,  239, 222 },
+	{ 233, 71, 171,  252, 205 },
+	{ 242, 71, 127,  8, 205 },
+	{ 242, 71, 127,  8, 205 },
+	{ 220, 40, 127,  250, 222 },
+	{ 213, 40, 163,  239, 222 },
+	{ 209, 35, 161,  226, 234 },
+	{ 213, 40, 163,  239, 222 },
+	{ 220, 40, 127,  250, 222 },
+	{ 220, 40, 127,  250, 222 },
+	{ 215, 35, 127,  236, 234 },
+	{ 209, 35, 161,  226, 234 },
+	{ 220, 49, 166,  221, 241 },
+	{ 209, 35, 161,  226, 234 },
+	{ 215, 35, 127,  236, 234 },
+	{ 215, 35, 127,  236, 234 },
+	{ 228, 49, 127,  230, 241 },
+	{ 220, 49, 166,  221, 241 },
+	{ 208, 71, 208,  219, 205 },
+	{ 217, 119, 217,  224, 181 },
+	{ 245, 119, 176,  1, 181 },
+	{ 245, 119, 176,  1, 181 },
+	{ 233, 71, 171,  252, 205 },
+	{ 208, 71, 208,  219, 205 },
+	{ 193, 40, 193,  209, 222 },
+	{ 208, 71, 208,  219, 205 },
+	{ 233, 71, 171,  252, 205 },
+	{ 233, 71, 171,  252, 205 },
+	{ 213, 40, 163,  239, 222 },
+	{ 193, 40, 193,  209, 222 },
+	{ 189, 35, 189,  200, 234 },
+	{ 193, 40, 193,  209, 222 },
+	{ 213, 40, 163,  239, 222 },
+	{ 213, 40, 163,  239, 222 },
+	{ 209, 35, 161,  226, 234 },
+	{ 189, 35, 189,  200, 234 },
+	{ 198, 49, 198,  195, 241 },
+	{ 189, 35, 189,  200, 234 },
+	{ 209, 35, 161,  226, 234 },
+	{ 209, 35, 161,  226, 234 },
+	{ 220, 49, 166,  221, 241 },
+	{ 198, 49, 198,  195, 241 },
+	{ 171, 71, 233,  171, 205 },
+	{ 176, 119, 245,  173, 181 },
+	{ 217, 119, 217,  224, 181 },
+	{ 217, 119, 217,  224, 181 },
+	{ 208, 71, 208,  219, 205 },
+	{ 171, 71, 233,  171, 205 },
+	{ 163, 40, 213,  165, 222 },
+	{ 171, 71, 233,  171, 205 },
+	{ 208, 71, 208,  219, 205 },
+	{ 208, 71, 208,  219, 205 },
+	{ 193, 40, 193,  209, 222 },
+	{ 163, 40, 213,  165, 222 },
+	{ 161, 35, 209,  160, 234 },
+	{ 163, 40, 213,  165, 222 },
+	{ 193, 40, 193,  209, 222 },
+	{ 193, 40, 193,  209, 222 },
+	{ 189, 35, 189,  200, 234 },
+	{ 161, 35, 209,  160, 234 },
+	{ 166, 49, 220,  157, 241 },
+	{ 161, 35, 209,  160, 234 },
+	{ 189, 35, 189,  200, 234 },
+	{ 189, 35, 189,  200, 234 },
+	{ 198, 49, 198,  195, 241 },
+	{ 166, 49, 220,  157, 241 },
+	{ 127, 71, 242,  110, 205 },
+	{ 127, 119, 254,  110, 181 },
+	{ 176, 119, 245,  173, 181 },
+	{ 176, 119, 245,  173, 181 },
+	{ 171, 71, 233,  171, 205 },
+	{ 127, 71, 242,  110, 205 },
+	{ 127, 40, 220,  110, 222 },
+	{ 127, 71, 242,  110, 205 },
+	{ 171, 71, 233,  171, 205 },
+	{ 171, 71, 233,  171, 205 },
+	{ 163, 40, 213,  165, 222 },
+	{ 127, 40, 220,  110, 222 },
+	{ 127, 35, 215,  110, 234 },
+	{ 127, 40, 220,  110, 222 },
+	{ 163, 40, 213,  165, 222 },
+	{ 163, 40, 213,  165, 222 },
+	{ 161, 35, 209,  160, 234 },
+	{ 127, 35, 215,  110, 234 },
+	{ 127, 49, 228,  110, 241 },
+	{ 127, 35, 215,  110, 234 },
+	{ 161, 35, 209,  160, 234 },
+	{ 161, 35, 209,  160, 234 },
+	{ 166, 49, 220,  157, 241 },
+	{ 127, 49, 228,  110, 241 },
+	{ 83, 71, 233,  50, 205 },
+	{ 78, 119, 245,  48, 181 },
+	{ 127, 119, 254,  110, 181 },
+	{ 127, 119, 254,  110, 181 },
+	{ 127, 71, 242,  110, 205 },
+	{ 83, 71, 233,  50, 205 },
+	{ 91, 40, 213,  56, 222 },
+	{ 83, 71, 233,  50, 205 },
+	{ 127, 71, 242,  110, 205 },
+	{ 127, 71, 242,  110, 205 },
+	{ 127, 40, 220,  110, 222 },
+	{ 91, 40, 213,  56, 222 },
+	{ 93, 35, 209,  61, 234 },
+	{ 91, 40, 213,  56, 222 },
+	{ 127, 40, 220,  110, 222 },
+	{ 127, 40, 220,  110, 222 },
+	{ 127, 35, 215,  110, 234 },
+	{ 93, 35, 209,  61, 234 },
+	{ 88, 49, 220,  64, 241 },
+	{ 93, 35, 209,  61, 234 },
+	{ 127, 35, 215,  110, 234 },
+	{ 127, 35, 215,  110, 234 },
+	{ 127, 49, 228,  110, 241 },
+	{ 88, 49, 220,  64, 241 },
+	{ 46, 71, 208,  2, 205 },
+	{ 37, 119, 217,  254, 181 },
+	{ 78, 119, 245,  48, 181 },
+	{ 78, 119, 245,  48, 181 },
+	{ 83, 71, 233,  50, 205 },
+	{ 46, 71, 208,  2, 205 },
+	{ 61, 40, 193,  11, 222 },
+	{ 46, 71, 208,  2, 205 },
+	{ 83, 71, 233,  50, 205 },
+	{ 83, 71, 233,  50, 205 },
+	{ 91, 40, 213,  56, 222 },
+	{ 61, 40, 193,  11, 222 },
+	{ 65, 35, 189,  21, 234 },
+	{ 61, 40, 193,  11, 222 },
+	{ 91, 40, 213,  56, 222 },
+	{ 91, 40, 213,  56, 222 },
+	{ 93, 35, 209,  61, 234 },
+	{ 65, 35, 189,  21, 234 },
+	{ 56, 49, 198,  26, 241 },
+	{ 65, 35, 189,  21, 234 },
+	{ 93, 35, 209,  61, 234 },
+	{ 93, 35, 209,  61, 234 },
+	{ 88, 49, 220,  64, 241 },
+	{ 56, 49, 198,  26, 241 },
+	{ 21, 71, 171,  226, 205 },
+	{ 9, 119, 176,  220, 181 },
+	{ 37, 119, 217,  254, 181 },
+	{ 37, 119, 217,  254, 181 },
+	{ 46, 71, 208,  2, 205 },
+	{ 21, 71, 171,  226, 205 },
+	{ 41, 40, 163,  239, 222 },
+	{ 21, 71, 171,  226, 205 },
+	{ 46, 71, 208,  2, 205 },
+	{ 46, 71, 208,  2, 205 },
+	{ 61, 40, 193,  11, 222 },
+	{ 41, 40, 163,  239, 222 },
+	{ 45, 35, 161,  251, 234 },
+	{ 41, 40, 163,  239, 222 },
+	{ 61, 40, 193,  11, 222 },
+	{ 61, 40, 193,  11, 222 },
+	{ 65, 35, 189,  21, 234 },
+	{ 45, 35, 161,  251, 234 },
+	{ 34, 49, 166,  0, 241 },
+	{ 45, 35, 161,  251, 234 },
+	{ 65, 35, 189,  21, 234 },
+	{ 65, 35, 189,  21, 234 },
+	{ 56, 49, 198,  26, 241 },
+	{ 34, 49, 166,  0, 241 },
+	{ 12, 71, 127,  214, 205 },
+	{ 0, 119, 127,  208, 181 },
+	{ 9, 119, 176,  220, 181 },
+	{ 9, 119, 176,  220, 181 },
+	{ 21, 71, 171,  226, 205 },
+	{ 12, 71, 127,  214, 205 },
+	{ 34, 40, 127,  228, 222 },
+	{ 12, 71, 127,  214, 205 },
+	{ 21, 71, 171,  226, 205 },
+	{ 21, 71, 171,  226, 205 },
+	{ 41, 40, 163,  239, 222 },
+	{ 34, 40, 127,  228, 222 },
+	{ 39, 35, 127,  242, 234 },
+	{ 34, 40, 127,  228, 222 },
+	{ 41, 40, 163,  239, 222 },
+	{ 41, 40, 163,  239, 222 },
+	{ 45, 35, 161,  251, 234 },
+	{ 39, 35, 127,  242, 234 },
+	{ 26, 49, 127,  248, 241 },
+	{ 39, 35, 127,  242, 234 },
+	{ 45, 35, 161,  251, 234 },
+	{ 45, 35, 161,  251, 234 },
+	{ 34, 49, 166,  0, 241 },
+	{ 26, 49, 127,  248, 241 },
+	{ 21, 71, 83,  226, 205 },
+	{ 9, 119, 78,  220, 181 },
+	{ 0, 119, 127,  208, 181 },
+	{ 0, 119, 127,  208, 181 },
+	{ 12, 71, 127,  214, 205 },
+	{ 21, 71, 83,  226, 205 },
+	{ 41, 40, 91,  239, 222 },
+	{ 21, 71, 83,  226, 205 },
+	{ 12, 71, 127,  214, 205 },
+	{ 12, 71, 127,  214, 205 },
+	{ 34, 40, 127,  228, 222 },
+	{ 41, 40, 91,  239, 222 },
+	{ 45, 35, 93,  251, 234 },
+	{ 41, 40, 91,  239, 222 },
+	{ 34, 40, 127,  228, 222 },
+	{ 34, 40, 127,  228, 222 },
+	{ 39, 35, 127,  242, 234 },
+	{ 45, 35, 93,  251, 234 },
+	{ 34, 49, 88,  0, 241 },
+	{ 45, 35, 93,  251, 234 },
+	{ 39, 35, 127,  242, 234 },
+	{ 39, 35, 127,  242, 234 },
+	{ 26, 49, 127,  248, 241 },
+	{ 34, 49, 88,  0, 241 },
+	{ 46, 71, 46,  2, 205 },
+	{ 37, 119, 37,  254, 181 },
+	{ 9, 119, 78,  220, 181 },
+	{ 9, 119, 78,  220, 181 },
+	{ 21, 71, 83,  226, 205 },
+	{ 46, 71, 46,  2, 205 },
+	{ 61, 40, 61,  11, 222 },
+	{ 46, 71, 46,  2, 205 },
+	{ 21, 71, 83,  226, 205 },
+	{ 21, 71, 83,  226, 205 },
+	{ 41, 40, 91,  239, 222 },
+	{ 61, 40, 61,  11, 222 },
+	{ 65, 35, 65,  21, 234 },
+	{ 61, 40, 61,  11, 222 },
+	{ 41, 40, 91,  239, 222 },
+	{ 41, 40, 91,  239, 222 },
+	{ 45, 35, 93,  251, 234 },
+	{ 65, 35, 65,  21, 234 },
+	{ 56, 49, 56,  26, 241 },
+	{ 65, 35, 65,  21, 234 },
+	{ 45, 35, 93,  251, 234 },
+	{ 45, 35, 93,  251, 234 },
+	{ 34, 49, 88,  0, 241 },
+	{ 56, 49, 56,  26, 241 },
+	{ 83, 71, 21,  50, 205 },
+	{ 78, 119, 9,  48, 181 },
+	{ 37, 119, 37,  254, 181 },
+	{ 37, 119, 37,  254, 181 },
+	{ 46, 71, 46,  2, 205 },
+	{ 83, 71, 21,  50, 205 },
+	{ 91, 40, 41,  56, 222 },
+	{ 83, 71, 21,  50, 205 },
+	{ 46, 71, 46,  2, 205 },
+	{ 46, 71, 46,  2, 205 },
+	{ 61, 40, 61,  11, 222 },
+	{ 91, 40, 41,  56, 222 },
+	{ 93, 35, 45,  61, 234 },
+	{ 91, 40, 41,  56, 222 },
+	{ 61, 40, 61,  11, 222 },
+	{ 61, 40, 61,  11, 222 },
+	{ 65, 35, 65,  21, 234 },
+	{ 93, 35, 45,  61, 234 },
+	{ 88, 49, 34,  64, 241 },
+	{ 93, 35, 45,  61, 234 },
+	{ 65, 35, 65,  21, 234 },
+	{ 65, 35, 65,  21, 234 },
+	{ 56, 49, 56,  26, 241 },
+	{ 88, 49, 34,  64, 241 },
+	{ 127, 71, 12,  110, 205 },
+	{ 127, 119, 0,  110, 181 },
+	{ 78, 119, 9,  48, 181 },
+	{ 78, 119, 9,  48, 181 },
+	{ 83, 71, 21,  50, 205 },
+	{ 127, 71, 12,  110, 205 },
+	{ 127, 40, 34,  110, 222 },
+	{ 127, 71, 12,  110, 205 },
+	{ 83, 71, 21,  50, 205 },
+	{ 83, 71, 21,  50, 205 },
+	{ 91, 40, 41,  56, 222 },
+	{ 127, 40, 34,  110, 222 },
+	{ 127, 35, 39,  110, 234 },
+	{ 127, 40, 34,  110, 222 },
+	{ 91, 40, 41,  56, 222 },
+	{ 91, 40, 41,  56, 222 },
+	{ 93, 35, 45,  61, 234 },
+	{ 127, 35, 39,  110, 234 },
+	{ 127, 49, 26,  110, 241 },
+	{ 127, 35, 39,  110, 234 },
+	{ 93, 35, 45,  61, 234 },
+	{ 93, 35, 45,  61, 234 },
+	{ 88, 49, 34,  64, 241 },
+	{ 127, 49, 26,  110, 241 },
+	{ 171, 71, 21,  171, 205 },
+	{ 176, 119, 9,  173, 181 },
+	{ 127, 119, 0,  110, 181 },
+	{ 127, 119, 0,  110, 181 },
+	{ 127, 71, 12,  110, 205 },
+	{ 171, 71, 21,  171, 205 },
+	{ 163, 40, 41,  165, 222 },
+	{ 171, 71, 21,  171, 205 },
+	{ 127, 71, 12,  110, 205 },
+	{ 127, 71, 12,  110, 205 },
+	{ 127, 40, 34,  110, 222 },
+	{ 163, 40, 41,  165, 222 },
+	{ 161, 35, 45,  160, 234 },
+	{ 163, 40, 41,  165, 222 },
+	{ 127, 40, 34,  110, 222 },
+	{ 127, 40, 34,  110, 222 },
+	{ 127, 35, 39,  110, 234 },
+	{ 161, 35, 45,  160, 234 },
+	{ 166, 49, 34,  157, 241 },
+	{ 161, 35, 45,  160, 234 },
+	{ 127, 35, 39,  110, 234 },
+	{ 127, 35, 39,  110, 234 },
+	{ 127, 49, 26,  110, 241 },
+	{ 166, 49, 34,  157, 241 },
+	{ 208, 71, 46,  219, 205 },
+	{ 217, 119, 37,  224, 181 },
+	{ 176, 119, 9,  173, 181 },
+	{ 176, 119, 9,  173, 181 },
+	{ 171, 71, 21,  171, 205 },
+	{ 208, 71, 46,  219, 205 },
+	{ 193, 40, 61,  209, 222 },
+	{ 208, 71, 46,  219, 205 },
+	{ 171, 71, 21,  171, 205 },
+	{ 171, 71, 21,  171, 205 },
+	{ 163, 40, 41,  165, 222 },
+	{ 193, 40, 61,  209, 222 },
+	{ 189, 35, 65,  200, 234 },
+	{ 193, 40, 61,  209, 222 },
+	{ 163, 40, 41,  165, 222 },
+	{ 163, 40, 41,  165, 222 },
+	{ 161, 35, 45,  160, 234 },
+	{ 189, 35, 65,  200, 234 },
+	{ 198, 49, 56,  195, 241 },
+	{ 189, 35, 65,  200, 234 },
+	{ 161, 35, 45,  160, 234 },
+	{ 161, 35, 45,  160, 234 },
+	{ 166, 49, 34,  157, 241 },
+	{ 198, 49, 56,  195, 241 },
+	{ 233, 71, 83,  252, 205 },
+	{ 245, 119, 78,  1, 181 },
+	{ 217, 119, 37,  224, 181 },
+	{ 217, 119, 37,  224, 181 },
+	{ 208, 71, 46,  219, 205 },
+	{ 233, 71, 83,  252, 205 },
+	{ 213, 40, 91,  239, 222 },
+	{ 233, 71, 83,  252, 205 },
+	{ 208, 71, 46,  219, 205 },
+	{ 208, 71, 46,  219, 205 },
+	{ 193, 40, 61,  209, 222 },
+	{ 213, 40, 91,  239, 222 },
+	{ 209, 35, 93,  226, 234 },
+	{ 213, 40, 91,  239, 222 },
+	{ 193, 40, 61,  209, 222 },
+	{ 193, 40, 61,  209, 222 },
+	{ 189, 35, 65,  200, 234 },
+	{ 209, 35, 93,  226, 234 },
+	{ 220, 49, 88,  221, 241 },
+	{ 209, 35, 93,  226, 234 },
+	{ 189, 35, 65,  200, 234 },
+	{ 189, 35, 65,  200, 234 },
+	{ 198, 49, 56,  195, 241 },
+	{ 220, 49, 88,  221, 241 },
+	{ 242, 71, 127,  8, 205 },
+	{ 254, 119, 127,  14, 181 },
+	{ 245, 119, 78,  1, 181 },
+	{ 245, 119, 78,  1, 181 },
+	{ 233, 71, 83,  252, 205 },
+	{ 242, 71, 127,  8, 205 },
+	{ 220, 40, 127,  250, 222 },
+	{ 242, 71, 127,  8, 205 },
+	{ 233, 71, 83,  252, 205 },
+	{ 233, 71, 83,  252, 205 },
+	{ 213, 40, 91,  239, 222 },
+	{ 220, 40, 127,  250, 222 },
+	{ 215, 35, 127,  236, 234 },
+	{ 220, 40, 127,  250, 222 },
+	{ 213, 40, 91,  239, 222 },
+	{ 213, 40, 91,  239, 222 },
+	{ 209, 35, 93,  226, 234 },
+	{ 215, 35, 127,  236, 234 },
+	{ 228, 49, 127,  230, 241 },
+	{ 215, 35, 127,  236, 234 },
+	{ 209, 35, 93,  226, 234 },
+	{ 209, 35, 93,  226, 234 },
+	{ 220, 49, 88,  221, 241 },
+	{ 228, 49, 127,  230, 241 },
+	{ 200, 27, 157,  218, 245 },
+	{ 220, 49, 166,  221, 241 },
+	{ 228, 49, 127,  230, 241 },
+	{ 228, 49, 127,  230, 241 },
+	{ 207, 27, 127,  227, 245 },
+	{ 200, 27, 157,  218, 245 },
+	{ 148, 2, 136,  205, 249 },
+	{ 200, 27, 157,  218, 245 },
+	{ 207, 27, 127,  227, 245 },
+	{ 207, 27, 127,  227, 245 },
+	{ 150, 2, 127,  213, 249 },
+	{ 148, 2, 136,  205, 249 },
+	{ 133, 0, 129,  172, 252 },
+	{ 148, 2, 136,  205, 249 },
+	{ 150, 2, 127,  213, 249 },
+	{ 150, 2, 127,  213, 249 },
+	{ 133, 0, 127,  177, 252 },
+	{ 133, 0, 129,  172, 252 },
+	{ 127, 0, 127,  110, 253 },
+	{ 133, 0, 129,  172, 252 },
+	{ 133, 0, 127,  177, 252 },
+	{ 133, 0, 127,  177, 252 },
+	{ 127, 0, 127,  110, 253 },
+	{ 127, 0, 127,  110, 253 },
+	{ 183, 27, 183,  193, 245 },
+	{ 198, 49, 198,  195, 241 },
+	{ 220, 49, 166,  221, 241 },
+	{ 220, 49, 166,  221, 241 },
+	{ 200, 27, 157,  218, 245 },
+	{ 183, 27, 183,  193, 245 },
+	{ 143, 2, 143,  183, 249 },
+	{ 183, 27, 183,  193, 245 },
+	{ 200, 27, 157,  218, 245 },
+	{ 200, 27, 157,  218, 245 },
+	{ 148, 2, 136,  205, 249 },
+	{ 143, 2, 143,  183, 249 },
+	{ 131, 0, 131,  158, 252 },
+	{ 143, 2, 143,  183, 249 },
+	{ 148, 2, 136,  205, 249 },
+	{ 148, 2, 136,  205, 249 },
+	{ 133, 0, 129,  172, 252 },
+	{ 131, 0, 131,  158, 252 },
+	{ 127, 0, 127,  110, 253 },
+	{ 131, 0, 131,  158, 252 },
+	{ 133, 0, 129,  172, 252 },
+	{ 133, 0, 129,  172, 252 },
+	{ 127, 0, 127,  110, 253 },
+	{ 127, 0, 127,  110, 253 },
+	{ 157, 27, 200,  156, 245 },
+	{ 166, 49, 220,  157, 241 },
+	{ 198, 49, 198,  195, 241 },
+	{ 198, 49, 198,  195, 241 },
+	{ 183, 27, 183,  193, 245 },
+	{ 157, 27, 200,  156, 245 },
+	{ 136, 2, 148,  151, 249 },
+	{ 157, 27, 200,  156, 245 },
+	{ 183, 27, 183,  193, 245 },
+	{ 183, 27, 183,  193, 245 },
+	{ 143, 2, 143,  183, 249 },
+	{ 136, 2, 148,  151, 249 },
+	{ 129, 0, 133,  137, 252 },
+	{ 136, 2, 148,  151, 249 },
+	{ 143, 2, 143,  183, 249 },
+	{ 143, 2, 143,  183, 249 },
+	{ 131, 0, 131,  158, 252 },
+	{ 129, 0, 133,  137, 252 },
+	{ 127, 0, 127,  110, 253 },
+	{ 129, 0, 133,  137, 252 },
+	{ 131, 0, 131,  158, 252 },
+	{ 131, 0, 131,  158, 252 },
+	{ 127, 0, 127,  110, 253 },
+	{ 127, 0, 127,  110, 253 },
+	{ 127, 27, 207,  110, 245 },
+	{ 127, 49, 228,  110, 241 },
+	{ 166, 49, 220,  157, 241 },
+	{ 166, 49, 220,  157, 241 },
+	{ 157, 27, 200,  156, 245 },
+	{ 127, 27, 207,  110, 245 },
+	{ 127, 2, 150,  110, 249 },
+	{ 127, 27, 207,  110, 245 },
+	{ 157, 27, 200,  156, 245 },
+	{ 157, 27, 200,  156, 245 },
+	{ 136, 2, 148,  151, 249 },
+	{ 127, 2, 150,  110, 249 },
+	{ 127, 0, 133,  110, 252 },
+	{ 127, 2, 150,  110, 249 },
+	{ 136, 2, 148,  151, 249 },
+	{ 136, 2, 148,  151, 249 },
+	{ 129, 0, 133,  137, 252 },
+	{ 127, 0, 133,  110, 252 },
+	{ 127, 0, 127,  110, 253 },
+	{ 127, 0, 133,  110, 252 },
+	{ 129, 0, 133,  137, 252 },
+	{ 129, 0, 133,  137, 252 },
+	{ 127, 0, 127,  110, 253 },
+	{ 127, 0, 127,  110, 253 },
+	{ 97, 27, 200,  65, 245 },
+	{ 88, 49, 220,  64, 241 },
+	{ 127, 49, 228,  110, 241 },
+	{ 127, 49, 228,  110, 241 },
+	{ 127, 27, 207,  110, 245 },
+	{ 97, 27, 200,  65, 245 },
+	{ 118, 2, 148,  70, 249 },
+	{ 97, 27, 200,  65, 245 },
+	{ 127, 27, 207,  110, 245 },
+	{ 127, 27, 207,  110, 245 },
+	{ 127, 2, 150,  110, 249 },
+	{ 118, 2, 148,  70, 249 },
+	{ 125, 0, 133,  84, 252 },
+	{ 118, 2, 148,  70, 249 },
+	{ 127, 2, 150,  110, 249 },
+	{ 127, 2, 150,  110, 249 },
+	{ 127, 0, 133,  110, 252 },
+	{ 125, 0, 133,  84, 252 },
+	{ 127, 0, 127,  110, 253 },
+	{ 125, 0, 133,  84, 252 },
+	{ 127, 0, 133,  110, 252 },
+	{ 127, 0, 133,  110, 252 },
+	{ 127, 0, 127,  110, 253 },
+	{ 127, 0, 127,  110, 253 },
+	{ 71, 27, 183,  28, 245 },
+	{ 56, 49, 198,  26, 241 },
+	{ 88, 49, 220,  64, 241 },
+	{ 88, 49, 220,  64, 241 },
+	{ 97, 27, 200,  65, 245 },
+	{ 71, 27, 183,  28, 245 },
+	{ 111, 2, 143,  38, 249 },
+	{ 71, 27, 183,  28, 245 },
+	{ 97, 27, 200,  65, 245 },
+	{ 97, 27, 200,  65, 245 },
+	{ 118, 2, 148,  70, 249 },
+	{ 111, 2, 143,  38, 249 },
+	{ 123, 0, 131,  63, 252 },
+	{ 111, 2, 143,  38, 249 },
+	{ 118, 2, 148,  70, 249 },
+	{ 118, 2, 148,  70, 249 },
+	{ 125, 0, 133,  84, 252 },
+	{ 123, 0, 131,  63, 252 },
+	{ 127, 0, 127,  110, 253 },
+	{ 123, 0, 131,  63, 252 },
+	{ 125, 0, 133,  84, 252 },
+	{ 125, 0, 133,  84, 252 },
+	{ 127, 0, 127,  110, 253 },
+	{ 127, 0, 127,  110, 253 },
+	{ 54, 27, 157,  3, 245 },
+	{ 34, 49, 166,  0, 241 },
+	{ 56, 49, 198,  26, 241 },
+	{ 56, 49, 198,  26, 241 },
+	{ 71, 27, 183,  28, 245 },
+	{ 54, 27, 157,  3, 245 },
+	{ 106, 2, 136,  16, 249 },
+	{ 54, 27, 157,  3, 245 },
+	{ 71, 27, 183,  28, 245 },
+	{ 71, 27, 183,  28, 245 },
+	{ 111, 2, 143,  38, 249 },
+	{ 106, 2, 136,  16, 249 },
+	{ 121, 0, 129,  49, 252 },
+	{ 106, 2, 136,  16, 249 },
+	{ 111, 2, 143,  38, 249 },
+	{ 111, 2, 143,  38, 249 },
+	{ 123, 0, 131,  63, 252 },
+	{ 121, 0, 129,  49, 252 },
+	{ 127, 0, 127,  110, 253 },
+	{ 121, 0, 129,  49, 252 },
+	{ 123, 0, 131,  63, 252 },
+	{ 123, 0, 131,  63, 252 },
+	{ 127, 0, 127,  110, 253 },
+	{ 127, 0, 127,  110, 253 },
+	{ 47, 27, 127,  251, 245 },
+	{ 26, 49, 127,  248, 241 },
+	{ 34, 49, 166,  0, 241 },
+	{ 34, 49, 166,  0, 241 },
+	{ 54, 27, 157,  3, 245 },
+	{ 47, 27, 127,  251, 245 },
+	{ 104, 2, 127,  8, 249 },
+	{ 47, 27, 127,  251, 245 },
+	{ 54, 27, 157,  3, 245 },
+	{ 54, 27, 157,  3, 245 },
+	{ 106, 2, 136,  16, 249 },
+	{ 104, 2, 127,  8, 249 },
+	{ 121, 0, 127,  44, 252 },
+	{ 104, 2, 127,  8, 249 },
+	{ 106, 2, 136,  16, 249 },
+	{ 106, 2, 136,  16, 249 },
+	{ 121, 0, 129,  49, 252 },
+	{ 121, 0, 127,  44, 252 },
+	{ 127, 0, 127,  110, 253 },
+	{ 121, 0, 127,  44, 252 },
+	{ 121, 0, 129,  49, 252 },
+	{ 121, 0, 129,  49, 252 },
+	{ 127, 0, 127,  110, 253 },
+	{ 127, 0, 127,  110, 253 },
+	{ 54, 27, 97,  3, 245 },
+	{ 34, 49, 88,  0, 241 },
+	{ 26, 49, 127,  248, 241 },
+	{ 26, 49, 127,  248, 241 },
+	{ 47, 27, 127,  251, 245 },
+	{ 54, 27, 97,  3, 245 },
+	{ 106, 2, 118,  16, 249 },
+	{ 54, 27, 97,  3, 245 },
+	{ 47, 27, 127,  251, 245 },
+	{ 47, 27, 127,  251, 245 },
+	{ 104, 2, 127,  8, 249 },
+	{ 106, 2, 118,  16, 249 },
+	{ 121, 0, 125,  49, 252 },
+	{ 106, 2, 118,  16, 249 },
+	{ 104, 2, 127,  8, 249 },
+	{ 104, 2, 127,  8, 249 },
+	{ 121, 0, 127,  44, 252 },
+	{ 121, 0, 125,  49, 252 },
+	{ 127, 0, 127,  110, 253 },
+	{ 121, 0, 125,  49, 252 },
+	{ 121, 0, 127,  44, 252 },
+	{ 121, 0, 127,  44, 252 },
+	{ 127, 0, 127,  110, 253 },
+	{ 127, 0, 127,  110, 253 },
+	{ 71, 27, 71,  28, 245 },
+	{ 56, 49, 56,  26, 241 },
+	{ 34, 49, 88,  0, 241 },
+	{ 34, 49, 88,  0, 241 },
+	{ 54, 27, 97,  3, 245 },
+	{ 71, 27, 71,  28, 245 },
+	{ 111, 2, 111,  38, 249 },
+	{ 71, 27, 71,  28, 245 },
+	{ 54, 27, 97,  3, 245 },
+	{ 54, 27, 97,  3, 245 },
+	{ 106, 2, 118,  16, 249 },
+	{ 111, 2, 111,  38, 249 },
+	{ 123, 0, 123,  63, 252 },
+	{ 111, 2, 111,  38, 249 },
+	{ 106, 2, 118,  16, 249 },
+	{ 106, 2, 118,  16, 249 },
+	{ 121, 0, 125,  49, 252 },
+	{ 123, 0, 123,  63, 252 },
+	{ 127, 0, 127,  110, 253 },
+	{ 123, 0, 123,  63, 252 },
+	{ 121, 0, 125,  49, 252 },
+	{ 121, 0, 125,  49, 252 },
+	{ 127, 0, 127,  110, 253 },
+	{ 127, 0, 127,  110, 253 },
+	{ 97, 27, 54,  65, 245 },
+	{ 88, 49, 34,  64, 241 },
+	{ 56, 49, 56,  26, 241 },
+	{ 56, 49, 56,  26, 241 },
+	{ 71, 27, 71,  28, 245 },
+	{ 97, 27, 54,  65, 245 },
+	{ 118, 2, 106,  70, 249 },
+	{ 97, 27, 54,  65, 245 },
+	{ 71, 27, 71,  28, 245 },
+	{ 71, 27, 71,  28, 245 },
+	{ 111, 2, 111,  38, 249 },
+	{ 118, 2, 106,  70, 249 },
+	{ 125, 0, 121,  84, 252 },
+	{ 118, 2, 106,  70, 249 },
+	{ 111, 2, 111,  38, 249 },
+	{ 111, 2, 111,  38, 249 },
+	{ 123, 0, 123,  63, 252 },
+	{ 125, 0, 121,  84, 252 },
+	{ 127, 0, 127,  110, 253 },
+	{ 125, 0, 121,  84, 252 },
+	{ 123, 0, 123,  63, 252 },
+	{ 123, 0, 123,  63, 252 },
+	{ 127, 0, 127,  110, 253 },
+	{ 127, 0, 127,  110, 253 },
+	{ 127, 27, 47,  110, 245 },
+	{ 127, 49, 26,  110, 241 },
+	{ 88, 49, 34,  64, 241 },
+	{ 88, 49, 34,  64, 241 },
+	{ 97, 27, 54,  65, 245 },
+	{ 127, 27, 47,  110, 245 },
+	{ 127, 2, 104,  110, 249 },
+	{ 127, 27, 47,  110, 245 },
+	{ 97, 27, 54,  65, 245 },
+	{ 97, 27, 54,  65, 245 },
+	{ 118, 2, 106,  70, 249 },
+	{ 127, 2, 104,  110, 249 },
+	{ 127, 0, 121,  110, 252 },
+	{ 127, 2, 104,  110, 249 },
+	{ 118, 2, 106,  70, 249 },
+	{ 118, 2, 106,  70, 249 },
+	{ 125, 0, 121,  84, 252 },
+	{ 127, 0, 121,  110, 252 },
+	{ 127, 0, 127,  110, 253 },
+	{ 127, 0, 121,  110, 252 },
+	{ 125, 0, 121,  84, 252 },
+	{ 125, 0, 121,  84, 252 },
+	{ 127, 0, 127,  110, 253 },
+	{ 127, 0, 127,  110, 253 },
+	{ 157, 27, 54,  156, 245 },
+	{ 166, 49, 34,  157, 241 },
+	{ 127, 49, 26,  110, 241 },
+	{ 127, 49, 26,  110, 241 },
+	{ 127, 27, 47,  110, 245 },
+	{ 157, 27, 54,  156, 245 },
+	{ 136, 2, 106,  151, 249 },
+	{ 157, 27, 54,  156, 245 },
+	{ 127, 27, 47,  110, 245 },
+	{ 127, 27, 47,  110, 245 },
+	{ 127, 2, 104,  110, 249 },
+	{ 136, 2, 106,  151, 249 },
+	{ 129, 0, 121,  137, 252 },
+	{ 136, 2, 106,  151, 249 },
+	{ 127, 2, 104,  110, 249 },
+	{ 127, 2, 104,  110, 249 },
+	{ 127, 0, 121,  110, 252 },
+	{ 129, 0, 121,  137, 252 },
+	{ 127, 0, 127,  110, 253 },
+	{ 129, 0, 121,  137, 252 },
+	{ 127, 0, 121,  110, 252 },
+	{ 127, 0, 121,  110, 252 },
+	{ 127, 0, 127,  110, 253 },
+	{ 127, 0, 127,  110, 253 },
+	{ 183, 27, 71,  193, 245 },
+	{ 198, 49, 56,  195, 241 },
+	{ 166, 49, 34,  157, 241 },
+	{ 166, 49, 34,  157, 241 },
+	{ 157, 27, 54,  156, 245 },
+	{ 183, 27, 71,  193, 245 },
+	{ 143, 2, 111,  183, 249 },
+	{ 183, 27, 71,  193, 245 },
+	{ 157, 27, 54,  156, 245 },
+	{ 157, 27, 54,  156, 245 },
+	{ 136, 2, 106,  151, 249 },
+	{ 143, 2, 111,  183, 249 },
+	{ 131, 0, 123,  158, 252 },
+	{ 143, 2, 111,  183, 249 },
+	{ 136, 2, 106,  151, 249 },
+	{ 136, 2, 106,  151, 249 },
+	{ 129, 0, 121,  137, 252 },
+	{ 131, 0, 123,  158, 252 },
+	{ 127, 0, 127,  110, 253 },
+	{ 131, 0, 123,  158, 252 },
+	{ 129, 0, 121,  137, 252 },
+	{ 129, 0, 121,  137, 252 },
+	{ 127, 0, 127,  110, 253 },
+	{ 127, 0, 127,  110, 253 },
+	{ 200, 27, 97,  218, 245 },
+	{ 220, 49, 88,  221, 241 },
+	{ 198, 49, 56,  195, 241 },
+	{ 198, 49, 56,  195, 241 },
+	{ 183, 27, 71,  193, 245 },
+	{ 200, 27, 97,  218, 245 },
+	{ 148, 2, 118,  205, 249 },
+	{ 200, 27, 97,  218, 245 },
+	{ 183, 27, 71,  193, 245 },
+	{ 183, 27, 71,  193, 245 },
+	{ 143, 2, 111,  183, 249 },
+	{ 148, 2, 118,  205, 249 },
+	{ 133, 0, 125,  172, 252 },
+	{ 148, 2, 118,  205, 249 },
+	{ 143, 2, 111,  183, 249 },
+	{ 143, 2, 111,  183, 249 },
+	{ 131, 0, 123,  158, 252 },
+	{ 133, 0, 125,  172, 252 },
+	{ 127, 0, 127,  110, 253 },
+	{ 133, 0, 125,  172, 252 },
+	{ 131, 0, 123,  158, 252 },
+	{ 131, 0, 123,  158, 252 },
+	{ 127, 0, 127,  110, 253 },
+	{ 127, 0, 127,  110, 253 },
+	{ 207, 27, 127,  227, 245 },
+	{ 228, 49, 127,  230, 241 },
+	{ 220, 49, 88,  221, 241 },
+	{ 220, 49, 88,  221, 241 },
+	{ 200, 27, 97,  218, 245 },
+	{ 207, 27, 127,  227, 245 },
+	{ 150, 2, 127,  213, 249 },
+	{ 207, 27, 127,  227, 245 },
+	{ 200, 27, 97,  218, 245 },
+	{ 200, 27, 97,  218, 245 },
+	{ 148, 2, 118,  205, 249 },
+	{ 150, 2, 127,  213, 249 },
+	{ 133, 0, 127,  177, 252 },
+	{ 150, 2, 127,  213, 249 },
+	{ 148, 2, 118,  205, 249 },
+	{ 148, 2, 118,  205, 249 },
+	{ 133, 0, 125,  172, 252 },
+	{ 133, 0, 127,  177, 252 },
+	{ 127, 0, 127,  110, 253 },
+	{ 133, 0, 127,  177, 252 },
+	{ 133, 0, 125,  172, 252 },
+	{ 133, 0, 125,  172, 252 },
+	{ 127, 0, 127,  110, 253 },
+	{ 127, 0, 127,  110, 253 },
+	{ 132, 20, 197,  202, 89 },
+	{ 128, 23, 201,  241, 89 },
+	{ 128, 0, 127,  240, 92 },
+	{ 128, 0, 127,  240, 92 },
+	{ 132, 0, 127,  203, 92 },
+	{ 132, 20, 197,  202, 89 },
+	{ 148, 24, 199,  173, 91 },
+	{ 132, 20, 197,  202, 89 },
+	{ 132, 0, 127,  203, 92 },
+	{ 132, 0, 127,  203, 92 },
+	{ 150, 2, 126,  175, 94 },
+	{ 148, 24, 199,  173, 91 },
+	{ 189, 51, 209,  155, 98 },
+	{ 148, 24, 199,  173, 91 },
+	{ 150, 2, 126,  175, 94 },
+	{ 150, 2, 126,  175, 94 },
+	{ 205, 26, 126,  158, 99 },
+	{ 189, 51, 209,  155, 98 },
+	{ 221, 112, 212,  149, 110 },
+	{ 189, 51, 209,  155, 98 },
+	{ 205, 26, 126,  158, 99 },
+	{ 205, 26, 126,  158, 99 },
+	{ 253, 106, 126,  152, 110 },
+	{ 221, 112, 212,  149, 110 },
+	{ 127, 129, 254,  199, 83 },
+	{ 127, 148, 253,  244, 83 },
+	{ 128, 23, 201,  241, 89 },
+	{ 128, 23, 201,  241, 89 },
+	{ 132, 20, 197,  202, 89 },
+	{ 127, 129, 254,  199, 83 },
+	{ 128, 136, 254,  167, 86 },
+	{ 127, 129, 254,  199, 83 },
+	{ 132, 20, 197,  202, 89 },
+	{ 132, 20, 197,  202, 89 },
+	{ 148, 24, 199,  173, 91 },
+	{ 128, 136, 254,  167, 86 },
+	{ 119, 144, 253,  147, 94 },
+	{ 128, 136, 254,  167, 86 },
+	{ 148, 24, 199,  173, 91 },
+	{ 148, 24, 199,  173, 91 },
+	{ 189, 51, 209,  155, 98 },
+	{ 119, 144, 253,  147, 94 },
+	{ 115, 129, 254,  140, 110 },
+	{ 119, 144, 253,  147, 94 },
+	{ 189, 51, 209,  155, 98 },
+	{ 189, 51, 209,  155, 98 },
+	{ 221, 112, 212,  149, 110 },
+	{ 115, 129, 254,  140, 110 },
+	{ 121, 234, 196,  197, 77 },
+	{ 126, 238, 190,  247, 77 },
+	{ 127, 148, 253,  244, 83 },
+	{ 127, 148, 253,  244, 83 },
+	{ 127, 129, 254,  199, 83 },
+	{ 121, 234, 196,  197, 77 },
+	{ 99, 229, 197,  161, 81 },
+	{ 121, 234, 196,  197, 77 },
+	{ 127, 129, 254,  199, 83 },
+	{ 127, 129, 254,  199, 83 },
+	{ 128, 136, 254,  167, 86 },
+	{ 99, 229, 197,  161, 81 },
+	{ 51, 198, 200,  139, 90 },
+	{ 99, 229, 197,  161, 81 },
+	{ 128, 136, 254,  167, 86 },
+	{ 128, 136, 254,  167, 86 },
+	{ 119, 144, 253,  147, 94 },
+	{ 51, 198, 200,  139, 90 },
+	{ 25, 136, 202,  132, 110 },
+	{ 51, 198, 200,  139, 90 },
+	{ 119, 144, 253,  147, 94 },
+	{ 119, 144, 253,  147, 94 },
+	{ 115, 129, 254,  140, 110 },
+	{ 25, 136, 202,  132, 110 },
+	{ 120, 254, 127,  196, 74 },
+	{ 126, 254, 127,  248, 74 },
+	{ 126, 238, 190,  247, 77 },
+	{ 126, 238, 190,  247, 77 },
+	{ 121, 234, 196,  197, 77 },
+	{ 120, 254, 127,  196, 74 },
+	{ 91, 249, 127,  158, 78 },
+	{ 120, 254, 127,  196, 74 },
+	{ 121, 234, 196,  197, 77 },
+	{ 121, 234, 196,  197, 77 },
+	{ 99, 229, 197,  161, 81 },
+	{ 91, 249, 127,  158, 78 },
+	{ 31, 211, 128,  136, 89 },
+	{ 91, 249, 127,  158, 78 },
+	{ 99, 229, 197,  161, 81 },
+	{ 99, 229, 197,  161, 81 },
+	{ 51, 198, 200,  139, 90 },
+	{ 31, 211, 128,  136, 89 },
+	{ 0, 136, 127,  128, 110 },
+	{ 31, 211, 128,  136, 89 },
+	{ 51, 198, 200,  139, 90 },
+	{ 51, 198, 200,  139, 90 },
+	{ 25, 136, 202,  132, 110 },
+	{ 0, 136, 127,  128, 110 },
+	{ 121, 234, 58,  197, 77 },
+	{ 126, 238, 64,  247, 77 },
+	{ 126, 254, 127,  248, 74 },
+	{ 126, 254, 127,  248, 74 },
+	{ 120, 254, 127,  196, 74 },
+	{ 121, 234, 58,  197, 77 },
+	{ 99, 230, 57,  161, 81 },
+	{ 121, 234, 58,  197, 77 },
+	{ 120, 254, 127,  196, 74 },
+	{ 120, 254, 127,  196, 74 },
+	{ 91, 249, 127,  158, 78 },
+	{ 99, 230, 57,  161, 81 },
+	{ 51, 198, 54,  139, 90 },
+	{ 99, 230, 57,  161, 81 },
+	{ 91, 249, 127,  158, 78 },
+	{ 91, 249, 127,  158, 78 },
+	{ 31, 211, 128,  136, 89 },
+	{ 51, 198, 54,  139, 90 },
+	{ 24, 135, 52,  132, 110 },
+	{ 51, 198, 54,  139, 90 },
+	{ 31, 211, 128,  136, 89 },
+	{ 31, 211, 128,  136, 89 },
+	{ 0, 136, 127,  128, 110 },
+	{ 24, 135, 52,  132, 110 },
+	{ 127, 129, 0,  199, 83 },
+	{ 127, 148, 1,  244, 83 },
+	{ 126, 238, 64,  247, 77 },
+	{ 126, 238, 64,  247, 77 },
+	{ 121, 234, 58,  197, 77 },
+	{ 127, 129, 0,  199, 83 },
+	{ 128, 135, 0,  167, 86 },
+	{ 127, 129, 0,  199, 83 },
+	{ 121, 234, 58,  197, 77 },
+	{ 121, 234, 58,  197, 77 },
+	{ 99, 230, 57,  161, 81 },
+	{ 128, 135, 0,  167, 86 },
+	{ 119, 142, 1,  147, 94 },
+	{ 128, 135, 0,  167, 86 },
+	{ 99, 230, 57,  161, 81 },
+	{ 99, 230, 57,  161, 81 },
+	{ 51, 198, 54,  139, 90 },
+	{ 119, 142, 1,  147, 94 },
+	{ 116, 129, 0,  140, 110 },
+	{ 119, 142, 1,  147, 94 },
+	{ 51, 198, 54,  139, 90 },
+	{ 51, 198, 54,  139, 90 },
+	{ 24, 135, 52,  132, 110 },
+	{ 116, 129, 0,  140, 110 },
+	{ 131, 20, 57,  202, 89 },
+	{ 128, 23, 53,  241, 89 },
+	{ 127, 148, 1,  244, 83 },
+	{ 127, 148, 1,  244, 83 },
+	{ 127, 129, 0,  199, 83 },
+	{ 131, 20, 57,  202, 89 },
+	{ 147, 23, 55,  173, 91 },
+	{ 131, 20, 57,  202, 89 },
+	{ 127, 129, 0,  199, 83 },
+	{ 127, 129, 0,  199, 83 },
+	{ 128, 135, 0,  167, 86 },
+	{ 147, 23, 55,  173, 91 },
+	{ 189, 52, 45,  155, 98 },
+	{ 147, 23, 55,  173, 91 },
+	{ 128, 135, 0,  167, 86 },
+	{ 128, 135, 0,  167, 86 },
+	{ 119, 142, 1,  147, 94 },
+	{ 189, 52, 45,  155, 98 },
+	{ 221, 114, 42,  149, 110 },
+	{ 189, 52, 45,  155, 98 },
+	{ 119, 142, 1,  147, 94 },
+	{ 119, 142, 1,  147, 94 },
+	{ 116, 129, 0,  140, 110 },
+	{ 221, 114, 42,  149, 110 },
+	{ 132, 0, 127,  203, 92 },
+	{ 128, 0, 127,  240, 92 },
+	{ 128, 23, 53,  241, 89 },
+	{ 128, 23, 53,  241, 89 },
+	{ 131, 20, 57,  202, 89 },
+	{ 132, 0, 127,  203, 92 },
+	{ 150, 2, 126,  175, 94 },
+	{ 132, 0, 127,  203, 92 },
+	{ 131, 20, 57,  202, 89 },
+	{ 131, 20, 57,  202, 89 },
+	{ 147, 23, 55,  173, 91 },
+	{ 150, 2, 126,  175, 94 },
+	{ 205, 26, 126,  158, 99 },
+	{ 150, 2, 126,  175, 94 },
+	{ 147, 23, 55,  173, 91 },
+	{ 147, 23, 55,  173, 91 },
+	{ 189, 52, 45,  155, 98 },
+	{ 205, 26, 126,  158, 99 },
+	{ 253, 106, 126,  152, 110 },
+	{ 205, 26, 126,  158, 99 },
+	{ 189, 52, 45,  155, 98 },
+	{ 189, 52, 45,  155, 98 },
+	{ 221, 114, 42,  149, 110 },
+	{ 253, 106, 126,  152, 110 },
+	{ 220, 160, 208,  152, 127 },
+	{ 221, 112, 212,  149, 110 },
+	{ 253, 106, 126,  152, 110 },
+	{ 253, 106, 126,  152, 110 },
+	{ 248, 168, 127,  156, 126 },
+	{ 220, 160, 208,  152, 127 },
+	{ 209, 186, 204,  163, 148 },
+	{ 220, 160, 208,  152, 127 },
+	{ 248, 168, 127,  156, 126 },
+	{ 248, 168, 127,  156, 126 },
+	{ 232, 199, 126,  165, 145 },
+	{ 209, 186, 204,  163, 148 },
+	{ 195, 208, 198,  182, 168 },
+	{ 209, 186, 204,  163, 148 },
+	{ 232, 199, 126,  165, 145 },
+	{ 232, 199, 126,  165, 145 },
+	{ 210, 224, 126,  183, 165 },
+	{ 195, 208, 198,  182, 168 },
+	{ 181, 214, 203,  209, 185 },
+	{ 195, 208, 198,  182, 168 },
+	{ 210, 224, 126,  183, 165 },
+	{ 210, 224, 126,  183, 165 },
+	{ 195, 235, 126,  208, 181 },
+	{ 181, 214, 203,  209, 185 },
+	{ 121, 124, 254,  145, 131 },
+	{ 115, 129, 254,  140, 110 },
+	{ 221, 112, 212,  149, 110 },
+	{ 221, 112, 212,  149, 110 },
+	{ 220, 160, 208,  152, 127 },
+	{ 121, 124, 254,  145, 131 },
+	{ 122, 122, 254,  158, 153 },
+	{ 121, 124, 254,  145, 131 },
+	{ 220, 160, 208,  152, 127 },
+	{ 220, 160, 208,  152, 127 },
+	{ 209, 186, 204,  163, 148 },
+	{ 122, 122, 254,  158, 153 },
+	{ 122, 122, 254,  180, 174 },
+	{ 122, 122, 254,  158, 153 },
+	{ 209, 186, 204,  163, 148 },
+	{ 209, 186, 204,  163, 148 },
+	{ 195, 208, 198,  182, 168 },
+	{ 122, 122, 254,  180, 174 },
+	{ 105, 89, 247,  212, 193 },
+	{ 122, 122, 254,  180, 174 },
+	{ 195, 208, 198,  182, 168 },
+	{ 195, 208, 198,  182, 168 },
+	{ 181, 214, 203,  209, 185 },
+	{ 105, 89, 247,  212, 193 },
+	{ 32, 89, 203,  137, 134 },
+	{ 25, 136, 202,  132, 110 },
+	{ 115, 129, 254,  140, 110 },
+	{ 115, 129, 254,  140, 110 },
+	{ 121, 124, 254,  145, 131 },
+	{ 32, 89, 203,  137, 134 },
+	{ 48, 60, 201,  152, 158 },
+	{ 32, 89, 203,  137, 134 },
+	{ 121, 124, 254,  145, 131 },
+	{ 121, 124, 254,  145, 131 },
+	{ 122, 122, 254,  158, 153 },
+	{ 48, 60, 201,  152, 158 },
+	{ 65, 40, 196,  178, 181 },
+	{ 48, 60, 201,  152, 158 },
+	{ 122, 122, 254,  158, 153 },
+	{ 122, 122, 254,  158, 153 },
+	{ 122, 122, 254,  180, 174 },
+	{ 65, 40, 196,  178, 181 },
+	{ 70, 26, 180,  215, 201 },
+	{ 65, 40, 196,  178, 181 },
+	{ 122, 122, 254,  180, 174 },
+	{ 122, 122, 254,  180, 174 },
+	{ 105, 89, 247,  212, 193 },
+	{ 70, 26, 180,  215, 201 },
+	{ 9, 79, 127,  134, 136 },
+	{ 0, 136, 127,  128, 110 },
+	{ 25, 136, 202,  132, 110 },
+	{ 25, 136, 202,  132, 110 },
+	{ 32, 89, 203,  137, 134 },
+	{ 9, 79, 127,  134, 136 },
+	{ 31, 43, 128,  150, 161 },
+	{ 9, 79, 127,  134, 136 },
+	{ 32, 89, 203,  137, 134 },
+	{ 32, 89, 203,  137, 134 },
+	{ 48, 60, 201,  152, 158 },
+	{ 31, 43, 128,  150, 161 },
+	{ 55, 22, 127,  177, 184 },
+	{ 31, 43, 128,  150, 161 },
+	{ 48, 60, 201,  152, 158 },
+	{ 48, 60, 201,  152, 158 },
+	{ 65, 40, 196,  178, 181 },
+	{ 55, 22, 127,  177, 184 },
+	{ 66, 15, 127,  216, 205 },
+	{ 55, 22, 127,  177, 184 },
+	{ 65, 40, 196,  178, 181 },
+	{ 65, 40, 196,  178, 181 },
+	{ 70, 26, 180,  215, 201 },
+	{ 66, 15, 127,  216, 205 },
+	{ 32, 89, 51,  137, 134 },
+	{ 24, 135, 52,  132, 110 },
+	{ 0, 136, 127,  128, 110 },
+	{ 0, 136, 127,  128, 110 },
+	{ 9, 79, 127,  134, 136 },
+	{ 32, 89, 51,  137, 134 },
+	{ 48, 60, 53,  152, 158 },
+	{ 32, 89, 51,  137, 134 },
+	{ 9, 79, 127,  134, 136 },
+	{ 9, 79, 127,  134, 136 },
+	{ 31, 43, 128,  150, 161 },
+	{ 48, 60, 53,  152, 158 },
+	{ 66, 39, 58,  178, 181 },
+	{ 48, 60, 53,  152, 158 },
+	{ 31, 43, 128,  150, 161 },
+	{ 31, 43, 128,  150, 161 },
+	{ 55, 22, 127,  177, 184 },
+	{ 66, 39, 58,  178, 181 },
+	{ 71, 25, 74,  215, 201 },
+	{ 66, 39, 58,  178, 181 },
+	{ 55, 22, 127,  177, 184 },
+	{ 55, 22, 127,  177, 184 },
+	{ 66, 15, 127,  216, 205 },
+	{ 71, 25, 74,  215, 201 },
+	{ 121, 125, 0,  145, 131 },
+	{ 116, 129, 0,  140, 110 },
+	{ 24, 135, 52,  132, 110 },
+	{ 24, 135, 52,  132, 110 },
+	{ 32, 89, 51,  137, 134 },
+	{ 121, 125, 0,  145, 131 },
+	{ 124, 123, 0,  158, 153 },
+	{ 121, 125, 0,  145, 131 },
+	{ 32, 89, 51,  137, 134 },
+	{ 32, 89, 51,  137, 134 },
+	{ 48, 60, 53,  152, 158 },
+	{ 124, 123, 0,  158, 153 },
+	{ 124, 123, 0,  180, 174 },
+	{ 124, 123, 0,  158, 153 },
+	{ 48, 60, 53,  152, 158 },
+	{ 48, 60, 53,  152, 158 },
+	{ 66, 39, 58,  178, 181 },
+	{ 124, 123, 0,  180, 174 },
+	{ 107, 90, 7,  212, 193 },
+	{ 124, 123, 0,  180, 174 },
+	{ 66, 39, 58,  178, 181 },
+	{ 66, 39, 58,  178, 181 },
+	{ 71, 25, 74,  215, 201 },
+	{ 107, 90, 7,  212, 193 },
+	{ 220, 159, 46,  152, 127 },
+	{ 221, 114, 42,  149, 110 },
+	{ 116, 129, 0,  140, 110 },
+	{ 116, 129, 0,  140, 110 },
+	{ 121, 125, 0,  145, 131 },
+	{ 220, 159, 46,  152, 127 },
+	{ 209, 186, 49,  163, 148 },
+	{ 220, 159, 46,  152, 127 },
+	{ 121, 125, 0,  145, 131 },
+	{ 121, 125, 0,  145, 131 },
+	{ 124, 123, 0,  158, 153 },
+	{ 209, 186, 49,  163, 148 },
+	{ 194, 209, 55,  182, 168 },
+	{ 209, 186, 49,  163, 148 },
+	{ 124, 123, 0,  158, 153 },
+	{ 124, 123, 0,  158, 153 },
+	{ 124, 123, 0,  180, 174 },
+	{ 194, 209, 55,  182, 168 },
+	{ 179, 214, 50,  209, 185 },
+	{ 194, 209, 55,  182, 168 },
+	{ 124, 123, 0,  180, 174 },
+	{ 124, 123, 0,  180, 174 },
+	{ 107, 90, 7,  212, 193 },
+	{ 179, 214, 50,  209, 185 },
+	{ 248, 168, 127,  156, 126 },
+	{ 253, 106, 126,  152, 110 },
+	{ 221, 114, 42,  149, 110 },
+	{ 221, 114, 42,  149, 110 },
+	{ 220, 159, 46,  152, 127 },
+	{ 248, 168, 127,  156, 126 },
+	{ 232, 199, 126,  165, 145 },
+	{ 248, 168, 127,  156, 126 },
+	{ 220, 159, 46,  152, 127 },
+	{ 220, 159, 46,  152, 127 },
+	{ 209, 186, 49,  163, 148 },
+	{ 232, 199, 126,  165, 145 },
+	{ 210, 224, 126,  183, 165 },
+	{ 232, 199, 126,  165, 145 },
+	{ 209, 186, 49,  163, 148 },
+	{ 209, 186, 49,  163, 148 },
+	{ 194, 209, 55,  182, 168 },
+	{ 210, 224, 126,  183, 165 },
+	{ 195, 235, 126,  208, 181 },
+	{ 210, 224, 126,  183, 165 },
+	{ 194, 209, 55,  182, 168 },
+	{ 194, 209, 55,  182, 168 },
+	{ 179, 214, 50,  209, 185 },
+	{ 195, 235, 126,  208, 181 },
+	{ 87, 208, 217,  31, 138 },
+	{ 108, 215, 218,  246, 150 },
+	{ 98, 251, 126,  246, 139 },
+	{ 98, 251, 126,  246, 139 },
+	{ 57, 234, 127,  28, 131 },
+	{ 87, 208, 217,  31, 138 },
+	{ 50, 187, 209,  48, 114 },
+	{ 87, 208, 217,  31, 138 },
+	{ 57, 234, 127,  28, 131 },
+	{ 57, 234, 127,  28, 131 },
+	{ 15, 189, 128,  45, 110 },
+	{ 50, 187, 209,  48, 114 },
+	{ 46, 184, 207,  58, 86 },
+	{ 50, 187, 209,  48, 114 },
+	{ 15, 189, 128,  45, 110 },
+	{ 15, 189, 128,  45, 110 },
+	{ 15, 188, 129,  54, 84 },
+	{ 46, 184, 207,  58, 86 },
+	{ 71, 204, 212,  77, 62 },
+	{ 46, 184, 207,  58, 86 },
+	{ 15, 188, 129,  54, 84 },
+	{ 15, 188, 129,  54, 84 },
+	{ 38, 218, 130,  69, 62 },
+	{ 71, 204, 212,  77, 62 },
+	{ 155, 128, 251,  37, 155 },
+	{ 141, 116, 253,  246, 172 },
+	{ 108, 215, 218,  246, 150 },
+	{ 108, 215, 218,  246, 150 },
+	{ 87, 208, 217,  31, 138 },
+	{ 155, 128, 251,  37, 155 },
+	{ 151, 147, 251,  57, 124 },
+	{ 155, 128, 251,  37, 155 },
+	{ 87, 208, 217,  31, 138 },
+	{ 87, 208, 217,  31, 138 },
+	{ 50, 187, 209,  48, 114 },
+	{ 151, 147, 251,  57, 124 },
+	{ 128, 151, 252,  68, 89 },
+	{ 151, 147, 251,  57, 124 },
+	{ 50, 187, 209,  48, 114 },
+	{ 50, 187, 209,  48, 114 },
+	{ 46, 184, 207,  58, 86 },
+	{ 128, 151, 252,  68, 89 },
+	{ 126, 158, 251,  93, 62 },
+	{ 128, 151, 252,  68, 89 },
+	{ 46, 184, 207,  58, 86 },
+	{ 46, 184, 207,  58, 86 },
+	{ 71, 204, 212,  77, 62 },
+	{ 126, 158, 251,  93, 62 },
+	{ 200, 55, 202,  44, 172 },
+	{ 171, 35, 203,  246, 195 },
+	{ 141, 116, 253,  246, 172 },
+	{ 141, 116, 253,  246, 172 },
+	{ 155, 128, 251,  37, 155 },
+	{ 200, 55, 202,  44, 172 },
+	{ 227, 94, 198,  65, 134 },
+	{ 200, 55, 202,  44, 172 },
+	{ 155, 128, 251,  37, 155 },
+	{ 155, 128, 251,  37, 155 },
+	{ 151, 147, 251,  57, 124 },
+	{ 227, 94, 198,  65, 134 },
+	{ 210, 88, 216,  78, 93 },
+	{ 227, 94, 198,  65, 134 },
+	{ 151, 147, 251,  57, 124 },
+	{ 151, 147, 251,  57, 124 },
+	{ 128, 151, 252,  68, 89 },
+	{ 210, 88, 216,  78, 93 },
+	{ 182, 63, 223,  110, 62 },
+	{ 210, 88, 216,  78, 93 },
+	{ 128, 151, 252,  68, 89 },
+	{ 128, 151, 252,  68, 89 },
+	{ 126, 158, 251,  93, 62 },
+	{ 182, 63, 223,  110, 62 },
+	{ 213, 33, 127,  47, 179 },
+	{ 179, 11, 127,  246, 205 },
+	{ 171, 35, 203,  246, 195 },
+	{ 171, 35, 203,  246, 195 },
+	{ 200, 55, 202,  44, 172 },
+	{ 213, 33, 127,  47, 179 },
+	{ 245, 78, 126,  69, 138 },
+	{ 213, 33, 127,  47, 179 },
+	{ 200, 55, 202,  44, 172 },
+	{ 200, 55, 202,  44, 172 },
+	{ 227, 94, 198,  65, 134 },
+	{ 245, 78, 126,  69, 138 },
+	{ 235, 59, 125,  83, 94 },
+	{ 245, 78, 126,  69, 138 },
+	{ 227, 94, 198,  65, 134 },
+	{ 227, 94, 198,  65, 134 },
+	{ 210, 88, 216,  78, 93 },
+	{ 235, 59, 125,  83, 94 },
+	{ 195, 19, 126,  117, 62 },
+	{ 235, 59, 125,  83, 94 },
+	{ 210, 88, 216,  78, 93 },
+	{ 210, 88, 216,  78, 93 },
+	{ 182, 63, 223,  110, 62 },
+	{ 195, 19, 126,  117, 62 },
+	{ 201, 55, 52,  44, 172 },
+	{ 171, 35, 50,  246, 195 },
+	{ 179, 11, 127,  246, 205 },
+	{ 179, 11, 127,  246, 205 },
+	{ 213, 33, 127,  47, 179 },
+	{ 201, 55, 52,  44, 172 },
+	{ 227, 95, 55,  65, 134 },
+	{ 201, 55, 52,  44, 172 },
+	{ 213, 33, 127,  47, 179 },
+	{ 213, 33, 127,  47, 179 },
+	{ 245, 78, 126,  69, 138 },
+	{ 227, 95, 55,  65, 134 },
+	{ 209, 88, 37,  78, 93 },
+	{ 227, 95, 55,  65, 134 },
+	{ 245, 78, 126,  69, 138 },
+	{ 245, 78, 126,  69, 138 },
+	{ 235, 59, 125,  83, 94 },
+	{ 209, 88, 37,  78, 93 },
+	{ 180, 63, 30,  110, 62 },
+	{ 209, 88, 37,  78, 93 },
+	{ 235, 59, 125,  83, 94 },
+	{ 235, 59, 125,  83, 94 },
+	{ 195, 19, 126,  117, 62 },
+	{ 180, 63, 30,  110, 62 },
+	{ 157, 129, 3,  37, 155 },
+	{ 142, 117, 1,  246, 172 },
+	{ 171, 35, 50,  246, 195 },
+	{ 171, 35, 50,  246, 195 },
+	{ 201, 55, 52,  44, 172 },
+	{ 157, 129, 3,  37, 155 },
+	{ 153, 147, 4,  57, 124 },
+	{ 157, 129, 3,  37, 155 },
+	{ 201, 55, 52,  44, 172 },
+	{ 201, 55, 52,  44, 172 },
+	{ 227, 95, 55,  65, 134 },
+	{ 153, 147, 4,  57, 124 },
+	{ 130, 148, 1,  68, 89 },
+	{ 153, 147, 4,  57, 124 },
+	{ 227, 95, 55,  65, 134 },
+	{ 227, 95, 55,  65, 134 },
+	{ 209, 88, 37,  78, 93 },
+	{ 130, 148, 1,  68, 89 },
+	{ 127, 154, 2,  93, 62 },
+	{ 130, 148, 1,  68, 89 },
+	{ 209, 88, 37,  78, 93 },
+	{ 209, 88, 37,  78, 93 },
+	{ 180, 63, 30,  110, 62 },
+	{ 127, 154, 2,  93, 62 },
+	{ 86, 208, 37,  31, 138 },
+	{ 110, 215, 36,  246, 150 },
+	{ 142, 117, 1,  246, 172 },
+	{ 142, 117, 1,  246, 172 },
+	{ 157, 129, 3,  37, 155 },
+	{ 86, 208, 37,  31, 138 },
+	{ 50, 186, 44,  48, 114 },
+	{ 86, 208, 37,  31, 138 },
+	{ 157, 129, 3,  37, 155 },
+	{ 157, 129, 3,  37, 155 },
+	{ 153, 147, 4,  57, 124 },
+	{ 50, 186, 44,  48, 114 },
+	{ 46, 183, 45,  58, 86 },
+	{ 50, 186, 44,  48, 114 },
+	{ 153, 147, 4,  57, 124 },
+	{ 153, 147, 4,  57, 124 },
+	{ 130, 148, 1,  68, 89 },
+	{ 46, 183, 45,  58, 86 },
+	{ 73, 205, 42,  77, 62 },
+	{ 46, 183, 45,  58, 86 },
+	{ 130, 148, 1,  68, 89 },
+	{ 130, 148, 1,  68, 89 },
+	{ 127, 154, 2,  93, 62 },
+	{ 73, 205, 42,  77, 62 },
+	{ 57, 234, 127,  28, 131 },
+	{ 98, 251, 126,  246, 139 },
+	{ 110, 215, 36,  246, 150 },
+	{ 110, 215, 36,  246, 150 },
+	{ 86, 208, 37,  31, 138 },
+	{ 57, 234, 127,  28, 131 },
+	{ 15, 189, 128,  45, 110 },
+	{ 57, 234, 127,  28, 131 },
+	{ 86, 208, 37,  31, 138 },
+	{ 86, 208, 37,  31, 138 },
+	{ 50, 186, 44,  48, 114 },
+	{ 15, 189, 128,  45, 110 },
+	{ 15, 188, 129,  54, 84 },
+	{ 15, 189, 128,  45, 110 },
+	{ 50, 186, 44,  48, 114 },
+	{ 50, 186, 44,  48, 114 },
+	{ 46, 183, 45,  58, 86 },
+	{ 15, 188, 129,  54, 84 },
+	{ 38, 218, 130,  69, 62 },
+	{ 15, 188, 129,  54, 84 },
+	{ 46, 183, 45,  58, 86 },
+	{ 46, 183, 45,  58, 86 },
+	{ 73, 205, 42,  77, 62 },
+	{ 38, 218, 130,  69, 62 },
+	{ 94, 228, 197,  83, 58 },
+	{ 71, 204, 212,  77, 62 },
+	{ 38, 218, 130,  69, 62 },
+	{ 38, 218, 130,  69, 62 },
+	{ 73, 242, 128,  75, 58 },
+	{ 94, 228, 197,  83, 58 },
+	{ 128, 254, 124,  87, 57 },
+	{ 94, 228, 197,  83, 58 },
+	{ 73, 242, 128,  75, 58 },
+	{ 73, 242, 128,  75, 58 },
+	{ 130, 254, 127,  79, 57 },
+	{ 128, 254, 124,  87, 57 },
+	{ 179, 169, 19,  87, 58 },
+	{ 128, 254, 124,  87, 57 },
+	{ 130, 254, 127,  79, 57 },
+	{ 130, 254, 127,  79, 57 },
+	{ 254, 130, 128,  81, 58 },
+	{ 179, 169, 19,  87, 58 },
+	{ 196, 57, 46,  82, 62 },
+	{ 179, 169, 19,  87, 58 },
+	{ 254, 130, 128,  81, 58 },
+	{ 254, 130, 128,  81, 58 },
+	{ 217, 37, 128,  77, 62 },
+	{ 196, 57, 46,  82, 62 },
+	{ 133, 185, 240,  101, 58 },
+	{ 126, 158, 251,  93, 62 },
+	{ 71, 204, 212,  77, 62 },
+	{ 71, 204, 212,  77, 62 },
+	{ 94, 228, 197,  83, 58 },
+	{ 133, 185, 240,  101, 58 },
+	{ 126, 253, 146,  103, 56 },
+	{ 133, 185, 240,  101, 58 },
+	{ 94, 228, 197,  83, 58 },
+	{ 94, 228, 197,  83, 58 },
+	{ 128, 254, 124,  87, 57 },
+	{ 126, 253, 146,  103, 56 },
+	{ 121, 214, 34,  101, 58 },
+	{ 126, 253, 146,  103, 56 },
+	{ 128, 254, 124,  87, 57 },
+	{ 128, 254, 124,  87, 57 },
+	{ 179, 169, 19,  87, 58 },
+	{ 121, 214, 34,  101, 58 },
+	{ 143, 128, 0,  93, 62 },
+	{ 121, 214, 34,  101, 58 },
+	{ 179, 169, 19,  87, 58 },
+	{ 179, 169, 19,  87, 58 },
+	{ 196, 57, 46,  82, 62 },
+	{ 143, 128, 0,  93, 62 },
+	{ 188, 104, 236,  118, 58 },
+	{ 182, 63, 223,  110, 62 },
+	{ 126, 158, 251,  93, 62 },
+	{ 126, 158, 251,  93, 62 },
+	{ 133, 185, 240,  101, 58 },
+	{ 188, 104, 236,  118, 58 },
+	{ 185, 221, 191,  120, 56 },
+	{ 188, 104, 236,  118, 58 },
+	{ 133, 185, 240,  101, 58 },
+	{ 133, 185, 240,  101, 58 },
+	{ 126, 253, 146,  103, 56 },
+	{ 185, 221, 191,  120, 56 },
+	{ 99, 243, 81,  115, 57 },
+	{ 185, 221, 191,  120, 56 },
+	{ 126, 253, 146,  103, 56 },
+	{ 126, 253, 146,  103, 56 },
+	{ 121, 214, 34,  101, 58 },
+	{ 99, 243, 81,  115, 57 },
+	{ 97, 211, 36,  104, 62 },
+	{ 99, 243, 81,  115, 57 },
+	{ 121, 214, 34,  101, 58 },
+	{ 121, 214, 34,  101, 58 },
+	{ 143, 128, 0,  93, 62 },
+	{ 97, 211, 36,  104, 62 },
+	{ 220, 40, 125,  126, 57 },
+	{ 195, 19, 126,  117, 62 },
+	{ 182, 63, 223,  110, 62 },
+	{ 182, 63, 223,  110, 62 },
+	{ 188, 104, 236,  118, 58 },
+	{ 220, 40, 125,  126, 57 },
+	{ 240, 185, 125,  127, 56 },
+	{ 220, 40, 125,  126, 57 },
+	{ 188, 104, 236,  118, 58 },
+	{ 188, 104, 236,  118, 58 },
+	{ 185, 221, 191,  120, 56 },
+	{ 240, 185, 125,  127, 56 },
+	{ 94, 250, 127,  121, 57 },
+	{ 240, 185, 125,  127, 56 },
+	{ 185, 221, 191,  120, 56 },
+	{ 185, 221, 191,  120, 56 },
+	{ 99, 243, 81,  115, 57 },
+	{ 94, 250, 127,  121, 57 },
+	{ 80, 245, 126,  109, 62 },
+	{ 94, 250, 127,  121, 57 },
+	{ 99, 243, 81,  115, 57 },
+	{ 99, 243, 81,  115, 57 },
+	{ 97, 211, 36,  104, 62 },
+	{ 80, 245, 126,  109, 62 },
+	{ 188, 104, 17,  118, 58 },
+	{ 180, 63, 30,  110, 62 },
+	{ 195, 19, 126,  117, 62 },
+	{ 195, 19, 126,  117, 62 },
+	{ 220, 40, 125,  126, 57 },
+	{ 188, 104, 17,  118, 58 },
+	{ 189, 218, 64,  120, 56 },
+	{ 188, 104, 17,  118, 58 },
+	{ 220, 40, 125,  126, 57 },
+	{ 220, 40, 125,  126, 57 },
+	{ 240, 185, 125,  127, 56 },
+	{ 189, 218, 64,  120, 56 },
+	{ 99, 242, 173,  115, 57 },
+	{ 189, 218, 64,  120, 56 },
+	{ 240, 185, 125,  127, 56 },
+	{ 240, 185, 125,  127, 56 },
+	{ 94, 250, 127,  121, 57 },
+	{ 99, 242, 173,  115, 57 },
+	{ 97, 212, 218,  104, 62 },
+	{ 99, 242, 173,  115, 57 },
+	{ 94, 250, 127,  121, 57 },
+	{ 94, 250, 127,  121, 57 },
+	{ 80, 245, 126,  109, 62 },
+	{ 97, 212, 218,  104, 62 },
+	{ 134, 183, 13,  101, 58 },
+	{ 127, 154, 2,  93, 62 },
+	{ 180, 63, 30,  110, 62 },
+	{ 180, 63, 30,  110, 62 },
+	{ 188, 104, 17,  118, 58 },
+	{ 134, 183, 13,  101, 58 },
+	{ 127, 253, 106,  103, 56 },
+	{ 134, 183, 13,  101, 58 },
+	{ 188, 104, 17,  118, 58 },
+	{ 188, 104, 17,  118, 58 },
+	{ 189, 218, 64,  120, 56 },
+	{ 127, 253, 106,  103, 56 },
+	{ 121, 214, 220,  101, 58 },
+	{ 127, 253, 106,  103, 56 },
+	{ 189, 218, 64,  120, 56 },
+	{ 189, 218, 64,  120, 56 },
+	{ 99, 242, 173,  115, 57 },
+	{ 121, 214, 220,  101, 58 },
+	{ 145, 123, 253,  93, 62 },
+	{ 121, 214, 220,  101, 58 },
+	{ 99, 242, 173,  115, 57 },
+	{ 99, 242, 173,  115, 57 },
+	{ 97, 212, 218,  104, 62 },
+	{ 145, 123, 253,  93, 62 },
+	{ 94, 229, 57,  83, 58 },
+	{ 73, 205, 42,  77, 62 },
+	{ 127, 154, 2,  93, 62 },
+	{ 127, 154, 2,  93, 62 },
+	{ 134, 183, 13,  101, 58 },
+	{ 94, 229, 57,  83, 58 },
+	{ 129, 254, 129,  87, 57 },
+	{ 94, 229, 57,  83, 58 },
+	{ 134, 183, 13,  101, 58 },
+	{ 134, 183, 13,  101, 58 },
+	{ 127, 253, 106,  103, 56 },
+	{ 129, 254, 129,  87, 57 },
+	{ 178, 172, 235,  87, 58 },
+	{ 129, 254, 129,  87, 57 },
+	{ 127, 253, 106,  103, 56 },
+	{ 127, 253, 106,  103, 56 },
+	{ 121, 214, 220,  101, 58 },
+	{ 178, 172, 235,  87, 58 },
+	{ 196, 53, 205,  82, 62 },
+	{ 178, 172, 235,  87, 58 },
+	{ 121, 214, 220,  101, 58 },
+	{ 121, 214, 220,  101, 58 },
+	{ 145, 123, 253,  93, 62 },
+	{ 196, 53, 205,  82, 62 },
+	{ 73, 242, 128,  75, 58 },
+	{ 38, 218, 130,  69, 62 },
+	{ 73, 205, 42,  77, 62 },
+	{ 73, 205, 42,  77, 62 },
+	{ 94, 229, 57,  83, 58 },
+	{ 73, 242, 128,  75, 58 },
+	{ 130, 254, 127,  79, 57 },
+	{ 73, 242, 128,  75, 58 },
+	{ 94, 229, 57,  83, 58 },
+	{ 94, 229, 57,  83, 58 },
+	{ 129, 254, 129,  87, 57 },
+	{ 130, 254, 127,  79, 57 },
+	{ 254, 130, 128,  81, 58 },
+	{ 130, 254, 127,  79, 57 },
+	{ 129, 254, 129,  87, 57 },
+	{ 129, 254, 129,  87, 57 },
+	{ 178, 172, 235,  87, 58 },
+	{ 254, 130, 128,  81, 58 },
+	{ 217, 37, 128,  77, 62 },
+	{ 254, 130, 128,  81, 58 },
+	{ 178, 172, 235,  87, 58 },
+	{ 178, 172, 235,  87, 58 },
+	{ 196, 53, 205,  82, 62 },
+	{ 217, 37, 128,  77, 62 },
+	{ 224, 199, 167,  135, 6 },
+	{ 127, 255, 127,  110, 2 },
+	{ 127, 255, 127,  110, 2 },
+	{ 127, 255, 127,  110, 2 },
+	{ 232, 199, 127,  138, 6 },
+	{ 224, 199, 167,  135, 6 },
+	{ 235, 76, 172,  134, 15 },
+	{ 224, 199, 167,  135, 6 },
+	{ 232, 199, 127,  138, 6 },
+	{ 232, 199, 127,  138, 6 },
+	{ 244, 76, 127,  136, 15 },
+	{ 235, 76, 172,  134, 15 },
+	{ 237, 82, 172,  125, 27 },
+	{ 235, 76, 172,  134, 15 },
+	{ 244, 76, 127,  136, 15 },
+	{ 244, 76, 127,  136, 15 },
+	{ 246, 82, 127,  126, 27 },
+	{ 237, 82, 172,  125, 27 },
+	{ 219, 207, 165,  125, 38 },
+	{ 237, 82, 172,  125, 27 },
+	{ 246, 82, 127,  126, 27 },
+	{ 246, 82, 127,  126, 27 },
+	{ 227, 207, 127,  126, 38 },
+	{ 219, 207, 165,  125, 38 },
+	{ 201, 199, 201,  130, 6 },
+	{ 127, 255, 127,  110, 2 },
+	{ 127, 255, 127,  110, 2 },
+	{ 127, 255, 127,  110, 2 },
+	{ 224, 199, 167,  135, 6 },
+	{ 201, 199, 201,  130, 6 },
+	{ 210, 76, 210,  129, 15 },
+	{ 201, 199, 201,  130, 6 },
+	{ 224, 199, 167,  135, 6 },
+	{ 224, 199, 167,  135, 6 },
+	{ 235, 76, 172,  134, 15 },
+	{ 210, 76, 210,  129, 15 },
+	{ 211, 82, 211,  122, 27 },
+	{ 210, 76, 210,  129, 15 },
+	{ 235, 76, 172,  134, 15 },
+	{ 235, 76, 172,  134, 15 },
+	{ 237, 82, 172,  125, 27 },
+	{ 211, 82, 211,  122, 27 },
+	{ 197, 207, 197,  122, 38 },
+	{ 211, 82, 211,  122, 27 },
+	{ 237, 82, 172,  125, 27 },
+	{ 237, 82, 172,  125, 27 },
+	{ 219, 207, 165,  125, 38 },
+	{ 197, 207, 197,  122, 38 },
+	{ 167, 199, 224,  121, 6 },
+	{ 127, 255, 127,  110, 2 },
+	{ 127, 255, 127,  110, 2 },
+	{ 127, 255, 127,  110, 2 },
+	{ 201, 199, 201,  130, 6 },
+	{ 167, 199, 224,  121, 6 },
+	{ 172, 76, 235,  121, 15 },
+	{ 167, 199, 224,  121, 6 },
+	{ 201, 199, 201,  130, 6 },
+	{ 201, 199, 201,  130, 6 },
+	{ 210, 76, 210,  129, 15 },
+	{ 172, 76, 235,  121, 15 },
+	{ 172, 82, 237,  117, 27 },
+	{ 172, 76, 235,  121, 15 },
+	{ 210, 76, 210,  129, 15 },
+	{ 210, 76, 210,  129, 15 },
+	{ 211, 82, 211,  122, 27 },
+	{ 172, 82, 237,  117, 27 },
+	{ 165, 207, 219,  117, 38 },
+	{ 172, 82, 237,  117, 27 },
+	{ 211, 82, 211,  122, 27 },
+	{ 211, 82, 211,  122, 27 },
+	{ 197, 207, 197,  122, 38 },
+	{ 165, 207, 219,  117, 38 },
+	{ 127, 199, 232,  110, 6 },
+	{ 127, 255, 127,  110, 2 },
+	{ 127, 255, 127,  110, 2 },
+	{ 127, 255, 127,  110, 2 },
+	{ 167, 199, 224,  121, 6 },
+	{ 127, 199, 232,  110, 6 },
+	{ 127, 76, 244,  110, 15 },
+	{ 127, 199, 232,  110, 6 },
+	{ 167, 199, 224,  121, 6 },
+	{ 167, 199, 224,  121, 6 },
+	{ 172, 76, 235,  121, 15 },
+	{ 127, 76, 244,  110, 15 },
+	{ 127, 82, 246,  110, 27 },
+	{ 127, 76, 244,  110, 15 },
+	{ 172, 76, 235,  121, 15 },
+	{ 172, 76, 235,  121, 15 },
+	{ 172, 82, 237,  117, 27 },
+	{ 127, 82, 246,  110, 27 },
+	{ 127, 207, 227,  110, 38 },
+	{ 127, 82, 246,  110, 27 },
+	{ 172, 82, 237,  117, 27 },
+	{ 172, 82, 237,  117, 27 },
+	{ 165, 207, 219,  117, 38 },
+	{ 127, 207, 227,  110, 38 },
+	{ 87, 199, 224,  100, 6 },
+	{ 127, 255, 127,  110, 2 },
+	{ 127, 255, 127,  110, 2 },
+	{ 127, 255, 127,  110, 2 },
+	{ 127, 199, 232,  110, 6 },
+	{ 87, 199, 224,  100, 6 },
+	{ 82, 76, 235,  100, 15 },
+	{ 87, 199, 224,  100, 6 },
+	{ 127, 199, 232,  110, 6 },
+	{ 127, 199, 232,  110, 6 },
+	{ 127, 76, 244,  110, 15 },
+	{ 82, 76, 235,  100, 15 },
+	{ 82, 82, 237,  104, 27 },
+	{ 82, 76, 235,  100, 15 },
+	{ 127, 76, 244,  110, 15 },
+	{ 127, 76, 244,  110, 15 },
+	{ 127, 82, 246,  110, 27 },
+	{ 82, 82, 237,  104, 27 },
+	{ 89, 207, 219,  104, 38 },
+	{ 82, 82, 237,  104, 27 },
+	{ 127, 82, 246,  110, 27 },
+	{ 127, 82, 246,  110, 27 },
+	{ 127, 207, 227,  110, 38 },
+	{ 89, 207, 219,  104, 38 },
+	{ 53, 199, 201,  91, 6 },
+	{ 127, 255, 127,  110, 2 },
+	{ 127, 255, 127,  110, 2 },
+	{ 127, 255, 127,  110, 2 },
+	{ 87, 199, 224,  100, 6 },
+	{ 53, 199, 201,  91, 6 },
+	{ 44, 76, 210,  92, 15 },
+	{ 53, 199, 201,  91, 6 },
+	{ 87, 199, 224,  100, 6 },
+	{ 87, 199, 224,  100, 6 },
+	{ 82, 76, 235,  100, 15 },
+	{ 44, 76, 210,  92, 15 },
+	{ 43, 82, 211,  99, 27 },
+	{ 44, 76, 210,  92, 15 },
+	{ 82, 76, 235,  100, 15 },
+	{ 82, 76, 235,  100, 15 },
+	{ 82, 82, 237,  104, 27 },
+	{ 43, 82, 211,  99, 27 },
+	{ 57, 207, 197,  99, 38 },
+	{ 43, 82, 211,  99, 27 },
+	{ 82, 82, 237,  104, 27 },
+	{ 82, 82, 237,  104, 27 },
+	{ 89, 207, 219,  104, 38 },
+	{ 57, 207, 197,  99, 38 },
+	{ 30, 199, 167,  85, 6 },
+	{ 127, 255, 127,  110, 2 },
+	{ 127, 255, 127,  110, 2 },
+	{ 127, 255, 127,  110, 2 },
+	{ 53, 199, 201,  91, 6 },
+	{ 30, 199, 167,  85, 6 },
+	{ 19, 76, 172,  87, 15 },
+	{ 30, 199, 167,  85, 6 },
+	{ 53, 199, 201,  91, 6 },
+	{ 53, 199, 201,  91, 6 },
+	{ 44, 76, 210,  92, 15 },
+	{ 19, 76, 172,  87, 15 },
+	{ 17, 82, 172,  96, 27 },
+	{ 19, 76, 172,  87, 15 },
+	{ 44, 76, 210,  92, 15 },
+	{ 44, 76, 210,  92, 15 },
+	{ 43, 82, 211,  99, 27 },
+	{ 17, 82, 172,  96, 27 },
+	{ 35, 207, 165,  96, 38 },
+	{ 17, 82, 172,  96, 27 },
+	{ 43, 82, 211,  99, 27 },
+	{ 43, 82, 211,  99, 27 },
+	{ 57, 207, 197,  99, 38 },
+	{ 35, 207, 165,  96, 38 },
+	{ 22, 199, 127,  83, 6 },
+	{ 127, 255, 127,  110, 2 },
+	{ 127, 255, 127,  110, 2 },
+	{ 127, 255, 127,  110, 2 },
+	{ 30, 199, 167,  85, 6 },
+	{ 22, 199, 127,  83, 6 },
+	{ 10, 76, 127,  85, 15 },
+	{ 22, 199, 127,  83, 6 },
+	{ 30, 199, 167,  85, 6 },
+	{ 30, 199, 167,  85, 6 },
+	{ 19, 76, 172,  87, 15 },
+	{ 10, 76, 127,  85, 15 },
+	{ 8, 82, 127,  95, 27 },
+	{ 10, 76, 127,  85, 15 },
+	{ 19, 76, 172,  87, 15 },
+	{ 19, 76, 172,  87, 15 },
+	{ 17, 82, 172,  96, 27 },
+	{ 8, 82, 127,  95, 27 },
+	{ 27, 207, 127,  95, 38 },
+	{ 8, 82, 127,  95, 27 },
+	{ 17, 82, 172,  96, 27 },
+	{ 17, 82, 172,  96, 27 },
+	{ 35, 207, 165,  96, 38 },
+	{ 27, 207, 127,  95, 38 },
+	{ 30, 199, 87,  85, 6 },
+	{ 127, 255, 127,  110, 2 },
+	{ 127, 255, 127,  110, 2 },
+	{ 127, 255, 127,  110, 2 },
+	{ 22, 199, 127,  83, 6 },
+	{ 30, 199, 87,  85, 6 },
+	{ 19, 76, 82,  87, 15 },
+	{ 30, 199, 87,  85, 6 },
+	{ 22, 199, 127,  83, 6 },
+	{ 22, 199, 127,  83, 6 },
+	{ 10, 76, 127,  85, 15 },
+	{ 19, 76, 82,  87, 15 },
+	{ 17, 82, 82,  96, 27 },
+	{ 19, 76, 82,  87, 15 },
+	{ 10, 76, 127,  85, 15 },
+	{ 10, 76, 127,  85, 15 },
+	{ 8, 82, 127,  95, 27 },
+	{ 17, 82, 82,  96, 27 },
+	{ 35, 207, 89,  96, 38 },
+	{ 17, 82, 82,  96, 27 },
+	{ 8, 82, 127,  95, 27 },
+	{ 8, 82, 127,  95, 27 },
+	{ 27, 207, 127,  95, 38 },
+	{ 35, 207, 89,  96, 38 },
+	{ 53, 199, 53,  91, 6 },
+	{ 127, 255, 127,  110, 2 },
+	{ 127, 255, 127,  110, 2 },
+	{ 127, 255, 127,  110, 2 },
+	{ 30, 199, 87,  85, 6 },
+	{ 53, 199, 53,  91, 6 },
+	{ 44, 76, 44,  92, 15 },
+	{ 53, 199, 53,  91, 6 },
+	{ 30, 199, 87,  85, 6 },
+	{ 30, 199, 87,  85, 6 },
+	{ 19, 76, 82,  87, 15 },
+	{ 44, 76, 44,  92, 15 },
+	{ 43, 82, 43,  99, 27 },
+	{ 44, 76, 44,  92, 15 },
+	{ 19, 76, 82,  87, 15 },
+	{ 19, 76, 82,  87, 15 },
+	{ 17, 82, 82,  96, 27 },
+	{ 43, 82, 43,  99, 27 },
+	{ 57, 207, 57,  99, 38 },
+	{ 43, 82, 43,  99, 27 },
+	{ 17, 82, 82,  96, 27 },
+	{ 17, 82, 82,  96, 27 },
+	{ 35, 207, 89,  96, 38 },
+	{ 57, 207, 57,  99, 38 },
+	{ 87, 199, 30,  100, 6 },
+	{ 127, 255, 127,  110, 2 },
+	{ 127, 255, 127,  110, 2 },
+	{ 127, 255, 127,  110, 2 },
+	{ 53, 199, 53,  91, 6 },
+	{ 87, 199, 30,  100, 6 },
+	{ 82, 76, 19,  100, 15 },
+	{ 87, 199, 30,  100, 6 },
+	{ 53, 199, 53,  91, 6 },
+	{ 53, 199, 53,  91, 6 },
+	{ 44, 76, 44,  92, 15 },
+	{ 82, 76, 19,  100, 15 },
+	{ 82, 82, 17,  104, 27 },
+	{ 82, 76, 19,  100, 15 },
+	{ 44, 76, 44,  92, 15 },
+	{ 44, 76, 44,  92, 15 },
+	{ 43, 82, 43,  99, 27 },
+	{ 82, 82, 17,  104, 27 },
+	{ 89, 207, 35,  104, 38 },
+	{ 82, 82, 17,  104, 27 },
+	{ 43, 82, 43,  99, 27 },
+	{ 43, 82, 43,  99, 27 },
+	{ 57, 207, 57,  99, 38 },
+	{ 89, 207, 35,  104, 38 },
+	{ 127, 199, 22,  110, 6 },
+	{ 127, 255, 127,  110, 2 },
+	{ 127, 255, 127,  110, 2 },
+	{ 127, 255, 127,  110, 2 },
+	{ 87, 199, 30,  100, 6 },
+	{ 127, 199, 22,  110, 6 },
+	{ 127, 76, 10,  110, 15 },
+	{ 127, 199, 22,  110, 6 },
+	{ 87, 199, 30,  100, 6 },
+	{ 87, 199, 30,  100, 6 },
+	{ 82, 76, 19,  100, 15 },
+	{ 127, 76, 10,  110, 15 },
+	{ 127, 82, 8,  110, 27 },
+	{ 127, 76, 10,  110, 15 },
+	{ 82, 76, 19,  100, 15 },
+	{ 82, 76, 19,  100, 15 },
+	{ 82, 82, 17,  104, 27 },
+	{ 127, 82, 8,  110, 27 },
+	{ 127, 207, 27,  110, 38 },
+	{ 127, 82, 8,  110, 27 },
+	{ 82, 82, 17,  104, 27 },
+	{ 82, 82, 17,  104, 27 },
+	{ 89, 207, 35,  104, 38 },
+	{ 127, 207, 27,  110, 38 },
+	{ 167, 199, 30,  121, 6 },
+	{ 127, 255, 127,  110, 2 },
+	{ 127, 255, 127,  110, 2 },
+	{ 127, 255, 127,  110, 2 },
+	{ 127, 199, 22,  110, 6 },
+	{ 167, 199, 30,  121, 6 },
+	{ 172, 76, 19,  121, 15 },
+	{ 167, 199, 30,  121, 6 },
+	{ 127, 199, 22,  110, 6 },
+	{ 127, 199, 22,  110, 6 },
+	{ 127, 76, 10,  110, 15 },
+	{ 172, 76, 19,  121, 15 },
+	{ 172, 82, 17,  117, 27 },
+	{ 172, 76, 19,  121, 15 },
+	{ 127, 76, 10,  110, 15 },
+	{ 127, 76, 10,  110, 15 },
+	{ 127, 82, 8,  110, 27 },
+	{ 172, 82, 17,  117, 27 },
+	{ 165, 207, 35,  117, 38 },
+	{ 172, 82, 17,  117, 27 },
+	{ 127, 82, 8,  110, 27 },
+	{ 127, 82, 8,  110, 27 },
+	{ 127, 207, 27,  110, 38 },
+	{ 165, 207, 35,  117, 38 },
+	{ 201, 199, 53,  130, 6 },
+	{ 127, 255, 127,  110, 2 },
+	{ 127, 255, 127,  110, 2 },
+	{ 127, 255, 127,  110, 2 },
+	{ 167, 199, 30,  121, 6 },
+	{ 201, 199, 53,  130, 6 },
+	{ 210, 76, 44,  129, 15 },
+	{ 201, 199, 53,  130, 6 },
+	{ 167, 199, 30,  121, 6 },
+	{ 167, 199, 30,  121, 6 },
+	{ 172, 76, 19,  121, 15 },
+	{ 210, 76, 44,  129, 15 },
+	{ 211, 82, 43,  122, 27 },
+	{ 210, 76, 44,  129, 15 },
+	{ 172, 76, 19,  121, 15 },
+	{ 172, 76, 19,  121, 15 },
+	{ 172, 82, 17,  117, 27 },
+	{ 211, 82, 43,  122, 27 },
+	{ 197, 207, 57,  122, 38 },
+	{ 211, 82, 43,  122, 27 },
+	{ 172, 82, 17,  117, 27 },
+	{ 172, 82, 17,  117, 27 },
+	{ 165, 207, 35,  117, 38 },
+	{ 197, 207, 57,  122, 38 },
+	{ 224, 199, 87,  135, 6 },
+	{ 127, 255, 127,  110, 2 },
+	{ 127, 255, 127,  110, 2 },
+	{ 127, 255, 127,  110, 2 },
+	{ 201, 199, 53,  130, 6 },
+	{ 224, 199, 87,  135, 6 },
+	{ 235, 76, 82,  134, 15 },
+	{ 224, 199, 87,  135, 6 },
+	{ 201, 199, 53,  130, 6 },
+	{ 201, 199, 53,  130, 6 },
+	{ 210, 76, 44,  129, 15 },
+	{ 235, 76, 82,  134, 15 },
+	{ 237, 82, 82,  125, 27 },
+	{ 235, 76, 82,  134, 15 },
+	{ 210, 76, 44,  129, 15 },
+	{ 210, 76, 44,  129, 15 },
+	{ 211, 82, 43,  122, 27 },
+	{ 237, 82, 82,  125, 27 },
+	{ 219, 207, 89,  125, 38 },
+	{ 237, 82, 82,  125, 27 },
+	{ 211, 82, 43,  122, 27 },
+	{ 211, 82, 43,  122, 27 },
+	{ 197, 207, 57,  122, 38 },
+	{ 219, 207, 89,  125, 38 },
+	{ 232, 199, 127,  138, 6 },
+	{ 127, 255, 127,  110, 2 },
+	{ 127, 255, 127,  110, 2 },
+	{ 127, 255, 127,  110, 2 },
+	{ 224, 199, 87,  135, 6 },
+	{ 232, 199, 127,  138, 6 },
+	{ 244, 76, 127,  136, 15 },
+	{ 232, 199, 127,  138, 6 },
+	{ 224, 199, 87,  135, 6 },
+	{ 224, 199, 87,  135, 6 },
+	{ 235, 76, 82,  134, 15 },
+	{ 244, 76, 127,  136, 15 },
+	{ 246, 82, 127,  126, 27 },
+	{ 244, 76, 127,  136, 15 },
+	{ 235, 76, 82,  134, 15 },
+	{ 235, 76, 82,  134, 15 },
+	{ 237, 82, 82,  125, 27 },
+	{ 246, 82, 127,  126, 27 },
+	{ 227, 207, 127,  126, 38 },
+	{ 246, 82, 127,  126, 27 },
+	{ 237, 82, 82,  125, 27 },
+	{ 237, 82, 82,  125, 27 },
+	{ 219, 207, 89,  125, 38 },
+	{ 227, 207, 127,  126, 38 },
+	{ 155, 251, 139,  144, 45 },
+	{ 219, 207, 165,  125, 38 },
+	{ 227, 207, 127,  126, 38 },
+	{ 227, 207, 127,  126, 38 },
+	{ 157, 251, 127,  147, 45 },
+	{ 155, 251, 139,  144, 45 },
+	{ 147, 253, 135,  171, 50 },
+	{ 155, 251, 139,  144, 45 },
+	{ 157, 251, 127,  147, 45 },
+	{ 157, 251, 127,  147, 45 },
+	{ 149, 253, 127,  176, 50 },
+	{ 147, 253, 135,  171, 50 },
+	{ 172, 245, 145,  195, 55 },
+	{ 147, 253, 135,  171, 50 },
+	{ 149, 253, 127,  176, 50 },
+	{ 149, 253, 127,  176, 50 },
+	{ 175, 245, 127,  203, 55 },
+	{ 172, 245, 145,  195, 55 },
+	{ 189, 235, 153,  206, 62 },
+	{ 172, 245, 145,  195, 55 },
+	{ 175, 245, 127,  203, 55 },
+	{ 175, 245, 127,  203, 55 },
+	{ 194, 235, 127,  214, 62 },
+	{ 189, 235, 153,  206, 62 },
+	{ 148, 251, 148,  136, 45 },
+	{ 197, 207, 197,  122, 38 },
+	{ 219, 207, 165,  125, 38 },
+	{ 219, 207, 165,  125, 38 },
+	{ 155, 251, 139,  144, 45 },
+	{ 148, 251, 148,  136, 45 },
+	{ 143, 253, 143,  157, 50 },
+	{ 148, 251, 148,  136, 45 },
+	{ 155, 251, 139,  144, 45 },
+	{ 155, 251, 139,  144, 45 },
+	{ 147, 253, 135,  171, 50 },
+	{ 143, 253, 143,  157, 50 },
+	{ 161, 245, 161,  176, 55 },
+	{ 143, 253, 143,  157, 50 },
+	{ 147, 253, 135,  171, 50 },
+	{ 147, 253, 135,  171, 50 },
+	{ 172, 245, 145,  195, 55 },
+	{ 161, 245, 161,  176, 55 },
+	{ 174, 236, 174,  184, 62 },
+	{ 161, 245, 161,  176, 55 },
+	{ 172, 245, 145,  195, 55 },
+	{ 172, 245, 145,  195, 55 },
+	{ 189, 235, 153,  206, 62 },
+	{ 174, 236, 174,  184, 62 },
+	{ 139, 251, 155,  125, 45 },
+	{ 165, 207, 219,  117, 38 },
+	{ 197, 207, 197,  122, 38 },
+	{ 197, 207, 197,  122, 38 },
+	{ 148, 251, 148,  136, 45 },
+	{ 139, 251, 155,  125, 45 },
+	{ 135, 253, 147,  136, 50 },
+	{ 139, 251, 155,  125, 45 },
+	{ 148, 251, 148,  136, 45 },
+	{ 148, 251, 148,  136, 45 },
+	{ 143, 253, 143,  157, 50 },
+	{ 135, 253, 147,  136, 50 },
+	{ 145, 245, 172,  147, 55 },
+	{ 135, 253, 147,  136, 50 },
+	{ 143, 253, 143,  157, 50 },
+	{ 143, 253, 143,  157, 50 },
+	{ 161, 245, 161,  176, 55 },
+	{ 145, 245, 172,  147, 55 },
+	{ 153, 235, 189,  151, 62 },
+	{ 145, 245, 172,  147, 55 },
+	{ 161, 245, 161,  176, 55 },
+	{ 161, 245, 161,  176, 55 },
+	{ 174, 236, 174,  184, 62 },
+	{ 153, 235, 189,  151, 62 },
+	{ 127, 251, 157,  110, 45 },
+	{ 127, 207, 227,  110, 38 },
+	{ 165, 207, 219,  117, 38 },
+	{ 165, 207, 219,  117, 38 },
+	{ 139, 251, 155,  125, 45 },
+	{ 127, 251, 157,  110, 45 },
+	{ 127, 253, 149,  110, 50 },
+	{ 127, 251, 157,  110, 45 },
+	{ 139, 251, 155,  125, 45 },
+	{ 139, 251, 155,  125, 45 },
+	{ 135, 253, 147,  136, 50 },
+	{ 127, 253, 149,  110, 50 },
+	{ 127, 245, 175,  110, 55 },
+	{ 127, 253, 149,  110, 50 },
+	{ 135, 253, 147,  136, 50 },
+	{ 135, 253, 147,  136, 50 },
+	{ 145, 245, 172,  147, 55 },
+	{ 127, 245, 175,  110, 55 },
+	{ 127, 235, 194,  110, 62 },
+	{ 127, 245, 175,  110, 55 },
+	{ 145, 245, 172,  147, 55 },
+	{ 145, 245, 172,  147, 55 },
+	{ 153, 235, 189,  151, 62 },
+	{ 127, 235, 194,  110, 62 },
+	{ 115, 251, 155,  96, 45 },
+	{ 89, 207, 219,  104, 38 },
+	{ 127, 207, 227,  110, 38 },
+	{ 127, 207, 227,  110, 38 },
+	{ 127, 251, 157,  110, 45 },
+	{ 115, 251, 155,  96, 45 },
+	{ 119, 253, 147,  85, 50 },
+	{ 115, 251, 155,  96, 45 },
+	{ 127, 251, 157,  110, 45 },
+	{ 127, 251, 157,  110, 45 },
+	{ 127, 253, 149,  110, 50 },
+	{ 119, 253, 147,  85, 50 },
+	{ 109, 245, 172,  74, 55 },
+	{ 119, 253, 147,  85, 50 },
+	{ 127, 253, 149,  110, 50 },
+	{ 127, 253, 149,  110, 50 },
+	{ 127, 245, 175,  110, 55 },
+	{ 109, 245, 172,  74, 55 },
+	{ 101, 235, 189,  70, 62 },
+	{ 109, 245, 172,  74, 55 },
+	{ 127, 245, 175,  110, 55 },
+	{ 127, 245, 175,  110, 55 },
+	{ 127, 235, 194,  110, 62 },
+	{ 101, 235, 189,  70, 62 },
+	{ 106, 251, 148,  85, 45 },
+	{ 57, 207, 197,  99, 38 },
+	{ 89, 207, 219,  104, 38 },
+	{ 89, 207, 219,  104, 38 },
+	{ 115, 251, 155,  96, 45 },
+	{ 106, 251, 148,  85, 45 },
+	{ 111, 253, 143,  64, 50 },
+	{ 106, 251, 148,  85, 45 },
+	{ 115, 251, 155,  96, 45 },
+	{ 115, 251, 155,  96, 45 },
+	{ 119, 253, 147,  85, 50 },
+	{ 111, 253, 143,  64, 50 },
+	{ 93, 245, 161,  45, 55 },
+	{ 111, 253, 143,  64, 50 },
+	{ 119, 253, 147,  85, 50 },
+	{ 119, 253, 147,  85, 50 },
+	{ 109, 245, 172,  74, 55 },
+	{ 93, 245, 161,  45, 55 },
+	{ 80, 236, 174,  37, 62 },
+	{ 93, 245, 161,  45, 55 },
+	{ 109, 245, 172,  74, 55 },
+	{ 109, 245, 172,  74, 55 },
+	{ 101, 235, 189,  70, 62 },
+	{ 80, 236, 174,  37, 62 },
+	{ 99, 251, 139,  77, 45 },
+	{ 35, 207, 165,  96, 38 },
+	{ 57, 207, 197,  99, 38 },
+	{ 57, 207, 197,  99, 38 },
+	{ 106, 251, 148,  85, 45 },
+	{ 99, 251, 139,  77, 45 },
+	{ 107, 253, 135,  50, 50 },
+	{ 99, 251, 139,  77, 45 },
+	{ 106, 251, 148,  85, 45 },
+	{ 106, 251, 148,  85, 45 },
+	{ 111, 253, 143,  64, 50 },
+	{ 107, 253, 135,  50, 50 },
+	{ 82, 245, 145,  25, 55 },
+	{ 107, 253, 135,  50, 50 },
+	{ 111, 253, 143,  64, 50 },
+	{ 111, 253, 143,  64, 50 },
+	{ 93, 245, 161,  45, 55 },
+	{ 82, 245, 145,  25, 55 },
+	{ 65, 235, 153,  15, 62 },
+	{ 82, 245, 145,  25, 55 },
+	{ 93, 245, 161,  45, 55 },
+	{ 93, 245, 161,  45, 55 },
+	{ 80, 236, 174,  37, 62 },
+	{ 65, 235, 153,  15, 62 },
+	{ 97, 251, 127,  74, 45 },
+	{ 27, 207, 127,  95, 38 },
+	{ 35, 207, 165,  96, 38 },
+	{ 35, 207, 165,  96, 38 },
+	{ 99, 251, 139,  77, 45 },
+	{ 97, 251, 127,  74, 45 },
+	{ 105, 253, 127,  45, 50 },
+	{ 97, 251, 127,  74, 45 },
+	{ 99, 251, 139,  77, 45 },
+	{ 99, 251, 139,  77, 45 },
+	{ 107, 253, 135,  50, 50 },
+	{ 105, 253, 127,  45, 50 },
+	{ 79, 245, 127,  18, 55 },
+	{ 105, 253, 127,  45, 50 },
+	{ 107, 253, 135,  50, 50 },
+	{ 107, 253, 135,  50, 50 },
+	{ 82, 245, 145,  25, 55 },
+	{ 79, 245, 127,  18, 55 },
+	{ 60, 235, 127,  7, 62 },
+	{ 79, 245, 127,  18, 55 },
+	{ 82, 245, 145,  25, 55 },
+	{ 82, 245, 145,  25, 55 },
+	{ 65, 235, 153,  15, 62 },
+	{ 60, 235, 127,  7, 62 },
+	{ 99, 251, 115,  77, 45 },
+	{ 35, 207, 89,  96, 38 },
+	{ 27, 207, 127,  95, 38 },
+	{ 27, 207, 127,  95, 38 },
+	{ 97, 251, 127,  74, 45 },
+	{ 99, 251, 115,  77, 45 },
+	{ 107, 253, 119,  50, 50 },
+	{ 99, 251, 115,  77, 45 },
+	{ 97, 251, 127,  74, 45 },
+	{ 97, 251, 127,  74, 45 },
+	{ 105, 253, 127,  45, 50 },
+	{ 107, 253, 119,  50, 50 },
+	{ 82, 245, 109,  25, 55 },
+	{ 107, 253, 119,  50, 50 },
+	{ 105, 253, 127,  45, 50 },
+	{ 105, 253, 127,  45, 50 },
+	{ 79, 245, 127,  18, 55 },
+	{ 82, 245, 109,  25, 55 },
+	{ 65, 235, 101,  15, 62 },
+	{ 82, 245, 109,  25, 55 },
+	{ 79, 245, 127,  18, 55 },
+	{ 79, 245, 127,  18, 55 },
+	{ 60, 235, 127,  7, 62 },
+	{ 65, 235, 101,  15, 62 },
+	{ 106, 251, 106,  85, 45 },
+	{ 57, 207, 57,  99, 38 },
+	{ 35, 207, 89,  96, 38 },
+	{ 35, 207, 89,  96, 38 },
+	{ 99, 251, 115,  77, 45 },
+	{ 106, 251, 106,  85, 45 },
+	{ 111, 253, 111,  64, 50 },
+	{ 106, 251, 106,  85, 45 },
+	{ 99, 251, 115,  77, 45 },
+	{ 99, 251, 115,  77, 45 },
+	{ 107, 253, 119,  50, 50 },
+	{ 111, 253, 111,  64, 50 },
+	{ 93, 245, 93,  45, 55 },
+	{ 111, 253, 111,  64, 50 },
+	{ 107, 253, 119,  50, 50 },
+	{ 107, 253, 119,  50, 50 },
+	{ 82, 245, 109,  25, 55 },
+	{ 93, 245, 93,  45, 55 },
+	{ 80, 236, 80,  37, 62 },
+	{ 93, 245, 93,  45, 55 },
+	{ 82, 245, 109,  25, 55 },
+	{ 82, 245, 109,  25, 55 },
+	{ 65, 235, 101,  15, 62 },
+	{ 80, 236, 80,  37, 62 },
+	{ 115, 251, 99,  96, 45 },
+	{ 89, 207, 35,  104, 38 },
+	{ 57, 207, 57,  99, 38 },
+	{ 57, 207, 57,  99, 38 },
+	{ 106, 251, 106,  85, 45 },
+	{ 115, 251, 99,  96, 45 },
+	{ 119, 253, 107,  85, 50 },
+	{ 115, 251, 99,  96, 45 },
+	{ 106, 251, 106,  85, 45 },
+	{ 106, 251, 106,  85, 45 },
+	{ 111, 253, 111,  64, 50 },
+	{ 119, 253, 107,  85, 50 },
+	{ 109, 245, 82,  74, 55 },
+	{ 119, 253, 107,  85, 50 },
+	{ 111, 253, 111,  64, 50 },
+	{ 111, 253, 111,  64, 50 },
+	{ 93, 245, 93,  45, 55 },
+	{ 109, 245, 82,  74, 55 },
+	{ 101, 235, 65,  70, 62 },
+	{ 109, 245, 82,  74, 55 },
+	{ 93, 245, 93,  45, 55 },
+	{ 93, 245, 93,  45, 55 },
+	{ 80, 236, 80,  37, 62 },
+	{ 101, 235, 65,  70, 62 },
+	{ 127, 251, 97,  110, 45 },
+	{ 127, 207, 27,  110, 38 },
+	{ 89, 207, 35,  104, 38 },
+	{ 89, 207, 35,  104, 38 },
+	{ 115, 251, 99,  96, 45 },
+	{ 127, 251, 97,  110, 45 },
+	{ 127, 253, 105,  110, 50 },
+	{ 127, 251, 97,  110, 45 },
+	{ 115, 251, 99,  96, 45 },
+	{ 115, 251, 99,  96, 45 },
+	{ 119, 253, 107,  85, 50 },
+	{ 127, 253, 105,  110, 50 },
+	{ 127, 245, 79,  110, 55 },
+	{ 127, 253, 105,  110, 50 },
+	{ 119, 253, 107,  85, 50 },
+	{ 119, 253, 107,  85, 50 },
+	{ 109, 245, 82,  74, 55 },
+	{ 127, 245, 79,  110, 55 },
+	{ 127, 235, 60,  110, 62 },
+	{ 127, 245, 79,  110, 55 },
+	{ 109, 245, 82,  74, 55 },
+	{ 109, 245, 82,  74, 55 },
+	{ 101, 235, 65,  70, 62 },
+	{ 127, 235, 60,  110, 62 },
+	{ 139, 251, 99,  125, 45 },
+	{ 165, 207, 35,  117, 38 },
+	{ 127, 207, 27,  110, 38 },
+	{ 127, 207, 27,  110, 38 },
+	{ 127, 251, 97,  110, 45 },
+	{ 139, 251, 99,  125, 45 },
+	{ 135, 253, 107,  136, 50 },
+	{ 139, 251, 99,  125, 45 },
+	{ 127, 251, 97,  110, 45 },
+	{ 127, 251, 97,  110, 45 },
+	{ 127, 253, 105,  110, 50 },
+	{ 135, 253, 107,  136, 50 },
+	{ 145, 245, 82,  147, 55 },
+	{ 135, 253, 107,  136, 50 },
+	{ 127, 253, 105,  110, 50 },
+	{ 127, 253, 105,  110, 50 },
+	{ 127, 245, 79,  110, 55 },
+	{ 145, 245, 82,  147, 55 },
+	{ 153, 235, 65,  151, 62 },
+	{ 145, 245, 82,  147, 55 },
+	{ 127, 245, 79,  110, 55 },
+	{ 127, 245, 79,  110, 55 },
+	{ 127, 235, 60,  110, 62 },
+	{ 153, 235, 65,  151, 62 },
+	{ 148, 251, 106,  136, 45 },
+	{ 197, 207, 57,  122, 38 },
+	{ 165, 207, 35,  117, 38 },
+	{ 165, 207, 35,  117, 38 },
+	{ 139, 251, 99,  125, 45 },
+	{ 148, 251, 106,  136, 45 },
+	{ 143, 253, 111,  157, 50 },
+	{ 148, 251, 106,  136, 45 },
+	{ 139, 251, 99,  125, 45 },
+	{ 139, 251, 99,  125, 45 },
+	{ 135, 253, 107,  136, 50 },
+	{ 143, 253, 111,  157, 50 },
+	{ 161, 245, 93,  176, 55 },
+	{ 143, 253, 111,  157, 50 },
+	{ 135, 253, 107,  136, 50 },
+	{ 135, 253, 107,  136, 50 },
+	{ 145, 245, 82,  147, 55 },
+	{ 161, 245, 93,  176, 55 },
+	{ 174, 236, 80,  184, 62 },
+	{ 161, 245, 93,  176, 55 },
+	{ 145, 245, 82,  147, 55 },
+	{ 145, 245, 82,  147, 55 },
+	{ 153, 235, 65,  151, 62 },
+	{ 174, 236, 80,  184, 62 },
+	{ 155, 251, 115,  144, 45 },
+	{ 219, 207, 89,  125, 38 },
+	{ 197, 207, 57,  122, 38 },
+	{ 197, 207, 57,  122, 38 },
+	{ 148, 251, 106,  136, 45 },
+	{ 155, 251, 115,  144, 45 },
+	{ 147, 253, 119,  171, 50 },
+	{ 155, 251, 115,  144, 45 },
+	{ 148, 251, 106,  136, 45 },
+	{ 148, 251, 106,  136, 45 },
+	{ 143, 253, 111,  157, 50 },
+	{ 147, 253, 119,  171, 50 },
+	{ 172, 245, 109,  195, 55 },
+	{ 147, 253, 119,  171, 50 },
+	{ 143, 253, 111,  157, 50 },
+	{ 143, 253, 111,  157, 50 },
+	{ 161, 245, 93,  176, 55 },
+	{ 172, 245, 109,  195, 55 },
+	{ 189, 235, 101,  206, 62 },
+	{ 172, 245, 109,  195, 55 },
+	{ 161, 245, 93,  176, 55 },
+	{ 161, 245, 93,  176, 55 },
+	{ 174, 236, 80,  184, 62 },
+	{ 189, 235, 101,  206, 62 },
+	{ 157, 251, 127,  147, 45 },
+	{ 227, 207, 127,  126, 38 },
+	{ 219, 207, 89,  125, 38 },
+	{ 219, 207, 89,  125, 38 },
+	{ 155, 251, 115,  144, 45 },
+	{ 157, 251, 127,  147, 45 },
+	{ 149, 253, 127,  176, 50 },
+	{ 157, 251, 127,  147, 45 },
+	{ 155, 251, 115,  144, 45 },
+	{ 155, 251, 115,  144, 45 },
+	{ 147, 253, 119,  171, 50 },
+	{ 149, 253, 127,  176, 50 },
+	{ 175, 245, 127,  203, 55 },
+	{ 149, 253, 127,  176, 50 },
+	{ 147, 253, 119,  171, 50 },
+	{ 147, 253, 119,  171, 50 },
+	{ 172, 245, 109,  195, 55 },
+	{ 175, 245, 127,  203, 55 },
+	{ 194, 235, 127,  214, 62 },
+	{ 175, 245, 127,  203, 55 },
+	{ 172, 245, 109,  195, 55 },
+	{ 172, 245, 109,  195, 55 },
+	{ 189, 235, 101,  206, 62 },
+	{ 194, 235, 127,  214, 62 },
+};
+
+const uint16_t *indices0 = (uint16_t*)0;
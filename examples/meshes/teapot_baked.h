@@ -0,0 +1,3075 @@
+const vertex_baked_t baked0[] =
+{ // ambient occlusion * (ambient + diffuse)
+	{ 77 },
+	{ 59 },
+	{ 90 },
+	{ 90 },
+	{ 99 },
+	{ 77 },
+	{ 139 },
+	{ 77 },
+	{ 99 },
+	{ 99 },
+	{ 140 },
+	{ 139 },
+	{ 82 },
+	{ 139 },
+	{ 140 },
+	{ 140 },
+	{ 54 },
+	{ 82 },
+	{ 51 },
+	{ 82 },
+	{ 54 },
+	{ 54 },
+	{ 48 },
+	{ 51 },
+	{ 44 },
+	{ 40 },
+	{ 59 },
+	{ 59 },
+	{ 77 },
+	{ 44 },
+	{ 135 },
+	{ 44 },
+	{ 77 },
+	{ 77 },
+	{ 139 },
+	{ 135 },
+	{ 116 },
+	{ 135 },
+	{ 139 },
+	{ 139 },
+	{ 82 },
+	{ 116 },
+	{ 95 },
+	{ 116 },
+	{ 82 },
+	{ 82 },
+	{ 51 },
+	{ 95 },
+	{ 32 },
+	{ 40 },
+	{ 40 },
+	{ 40 },
+	{ 44 },
+	{ 32 },
+	{ 133 },
+	{ 32 },
+	{ 44 },
+	{ 44 },
+	{ 135 },
+	{ 133 },
+	{ 149 },
+	{ 133 },
+	{ 135 },
+	{ 135 },
+	{ 116 },
+	{ 149 },
+	{ 137 },
+	{ 149 },
+	{ 116 },
+	{ 116 },
+	{ 95 },
+	{ 137 },
+	{ 30 },
+	{ 40 },
+	{ 40 },
+	{ 40 },
+	{ 32 },
+	{ 30 },
+	{ 129 },
+	{ 30 },
+	{ 32 },
+	{ 32 },
+	{ 133 },
+	{ 129 },
+	{ 176 },
+	{ 129 },
+	{ 133 },
+	{ 133 },
+	{ 149 },
+	{ 176 },
+	{ 172 },
+	{ 176 },
+	{ 149 },
+	{ 149 },
+	{ 137 },
+	{ 172 },
+	{ 30 },
+	{ 42 },
+	{ 40 },
+	{ 40 },
+	{ 30 },
+	{ 30 },
+	{ 123 },
+	{ 30 },
+	{ 30 },
+	{ 30 },
+	{ 129 },
+	{ 123 },
+	{ 194 },
+	{ 123 },
+	{ 129 },
+	{ 129 },
+	{ 176 },
+	{ 194 },
+	{ 195 },
+	{ 194 },
+	{ 176 },
+	{ 176 },
+	{ 172 },
+	{ 195 },
+	{ 29 },
+	{ 41 },
+	{ 42 },
+	{ 42 },
+	{ 30 },
+	{ 29 },
+	{ 112 },
+	{ 29 },
+	{ 30 },
+	{ 30 },
+	{ 123 },
+	{ 112 },
+	{ 201 },
+	{ 112 },
+	{ 123 },
+	{ 123 },
+	{ 194 },
+	{ 201 },
+	{ 203 },
+	{ 201 },
+	{ 194 },
+	{ 194 },
+	{ 195 },
+	{ 203 },
+	{ 29 },
+	{ 41 },
+	{ 41 },
+	{ 41 },
+	{ 29 },
+	{ 29 },
+	{ 121 },
+	{ 29 },
+	{ 29 },
+	{ 29 },
+	{ 112 },
+	{ 121 },
+	{ 191 },
+	{ 121 },
+	{ 112 },
+	{ 112 },
+	{ 201 },
+	{ 191 },
+	{ 188 },
+	{ 191 },
+	{ 201 },
+	{ 201 },
+	{ 203 },
+	{ 188 },
+	{ 32 },
+	{ 41 },
+	{ 41 },
+	{ 41 },
+	{ 29 },
+	{ 32 },
+	{ 129 },
+	{ 32 },
+	{ 29 },
+	{ 29 },
+	{ 121 },
+	{ 129 },
+	{ 173 },
+	{ 129 },
+	{ 121 },
+	{ 121 },
+	{ 191 },
+	{ 173 },
+	{ 158 },
+	{ 173 },
+	{ 191 },
+	{ 191 },
+	{ 188 },
+	{ 158 },
+	{ 30 },
+	{ 40 },
+	{ 41 },
+	{ 41 },
+	{ 32 },
+	{ 30 },
+	{ 131 },
+	{ 30 },
+	{ 32 },
+	{ 32 },
+	{ 129 },
+	{ 131 },
+	{ 146 },
+	{ 131 },
+	{ 129 },
+	{ 129 },
+	{ 173 },
+	{ 146 },
+	{ 136 },
+	{ 146 },
+	{ 173 },
+	{ 173 },
+	{ 158 },
+	{ 136 },
+	{ 47 },
+	{ 41 },
+	{ 40 },
+	{ 40 },
+	{ 30 },
+	{ 47 },
+	{ 135 },
+	{ 47 },
+	{ 30 },
+	{ 30 },
+	{ 131 },
+	{ 135 },
+	{ 115 },
+	{ 135 },
+	{ 131 },
+	{ 131 },
+	{ 146 },
+	{ 115 },
+	{ 94 },
+	{ 115 },
+	{ 146 },
+	{ 146 },
+	{ 136 },
+	{ 94 },
+	{ 75 },
+	{ 58 },
+	{ 41 },
+	{ 41 },
+	{ 47 },
+	{ 75 },
+	{ 139 },
+	{ 75 },
+	{ 47 },
+	{ 47 },
+	{ 135 },
+	{ 139 },
+	{ 83 },
+	{ 139 },
+	{ 135 },
+	{ 135 },
+	{ 115 },
+	{ 83 },
+	{ 53 },
+	{ 83 },
+	{ 115 },
+	{ 115 },
+	{ 94 },
+	{ 53 },
+	{ 100 },
+	{ 88 },
+	{ 58 },
+	{ 58 },
+	{ 75 },
+	{ 100 },
+	{ 143 },
+	{ 100 },
+	{ 75 },
+	{ 75 },
+	{ 139 },
+	{ 143 },
+	{ 55 },
+	{ 143 },
+	{ 139 },
+	{ 139 },
+	{ 83 },
+	{ 55 },
+	{ 51 },
+	{ 55 },
+	{ 83 },
+	{ 83 },
+	{ 53 },
+	{ 51 },
+	{ 119 },
+	{ 113 },
+	{ 88 },
+	{ 88 },
+	{ 100 },
+	{ 119 },
+	{ 145 },
+	{ 119 },
+	{ 100 },
+	{ 100 },
+	{ 143 },
+	{ 145 },
+	{ 51 },
+	{ 145 },
+	{ 143 },
+	{ 143 },
+	{ 55 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 55 },
+	{ 55 },
+	{ 51 },
+	{ 51 },
+	{ 128 },
+	{ 121 },
+	{ 113 },
+	{ 113 },
+	{ 119 },
+	{ 128 },
+	{ 148 },
+	{ 128 },
+	{ 119 },
+	{ 119 },
+	{ 145 },
+	{ 148 },
+	{ 51 },
+	{ 148 },
+	{ 145 },
+	{ 145 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 110 },
+	{ 109 },
+	{ 121 },
+	{ 121 },
+	{ 128 },
+	{ 110 },
+	{ 148 },
+	{ 110 },
+	{ 128 },
+	{ 128 },
+	{ 148 },
+	{ 148 },
+	{ 51 },
+	{ 148 },
+	{ 148 },
+	{ 148 },
+	{ 51 },
+	{ 51 },
+	{ 49 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 49 },
+	{ 99 },
+	{ 90 },
+	{ 109 },
+	{ 109 },
+	{ 110 },
+	{ 99 },
+	{ 140 },
+	{ 99 },
+	{ 110 },
+	{ 110 },
+	{ 148 },
+	{ 140 },
+	{ 54 },
+	{ 140 },
+	{ 148 },
+	{ 148 },
+	{ 51 },
+	{ 54 },
+	{ 48 },
+	{ 54 },
+	{ 51 },
+	{ 51 },
+	{ 49 },
+	{ 48 },
+	{ 47 },
+	{ 51 },
+	{ 48 },
+	{ 48 },
+	{ 42 },
+	{ 47 },
+	{ 48 },
+	{ 47 },
+	{ 42 },
+	{ 42 },
+	{ 31 },
+	{ 48 },
+	{ 48 },
+	{ 48 },
+	{ 31 },
+	{ 31 },
+	{ 1 },
+	{ 48 },
+	{ 49 },
+	{ 48 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 49 },
+	{ 87 },
+	{ 95 },
+	{ 51 },
+	{ 51 },
+	{ 47 },
+	{ 87 },
+	{ 81 },
+	{ 87 },
+	{ 47 },
+	{ 47 },
+	{ 48 },
+	{ 81 },
+	{ 69 },
+	{ 81 },
+	{ 48 },
+	{ 48 },
+	{ 48 },
+	{ 69 },
+	{ 51 },
+	{ 69 },
+	{ 48 },
+	{ 48 },
+	{ 49 },
+	{ 51 },
+	{ 130 },
+	{ 137 },
+	{ 95 },
+	{ 95 },
+	{ 87 },
+	{ 130 },
+	{ 126 },
+	{ 130 },
+	{ 87 },
+	{ 87 },
+	{ 81 },
+	{ 126 },
+	{ 116 },
+	{ 126 },
+	{ 81 },
+	{ 81 },
+	{ 69 },
+	{ 116 },
+	{ 93 },
+	{ 116 },
+	{ 69 },
+	{ 69 },
+	{ 51 },
+	{ 93 },
+	{ 168 },
+	{ 172 },
+	{ 137 },
+	{ 137 },
+	{ 130 },
+	{ 168 },
+	{ 164 },
+	{ 168 },
+	{ 130 },
+	{ 130 },
+	{ 126 },
+	{ 164 },
+	{ 156 },
+	{ 164 },
+	{ 126 },
+	{ 126 },
+	{ 116 },
+	{ 156 },
+	{ 134 },
+	{ 156 },
+	{ 116 },
+	{ 116 },
+	{ 93 },
+	{ 134 },
+	{ 192 },
+	{ 195 },
+	{ 172 },
+	{ 172 },
+	{ 168 },
+	{ 192 },
+	{ 190 },
+	{ 192 },
+	{ 168 },
+	{ 168 },
+	{ 164 },
+	{ 190 },
+	{ 182 },
+	{ 190 },
+	{ 164 },
+	{ 164 },
+	{ 156 },
+	{ 182 },
+	{ 161 },
+	{ 182 },
+	{ 156 },
+	{ 156 },
+	{ 134 },
+	{ 161 },
+	{ 201 },
+	{ 203 },
+	{ 195 },
+	{ 195 },
+	{ 192 },
+	{ 201 },
+	{ 198 },
+	{ 201 },
+	{ 192 },
+	{ 192 },
+	{ 190 },
+	{ 198 },
+	{ 191 },
+	{ 198 },
+	{ 190 },
+	{ 190 },
+	{ 182 },
+	{ 191 },
+	{ 170 },
+	{ 191 },
+	{ 182 },
+	{ 182 },
+	{ 161 },
+	{ 170 },
+	{ 180 },
+	{ 188 },
+	{ 203 },
+	{ 203 },
+	{ 201 },
+	{ 180 },
+	{ 177 },
+	{ 180 },
+	{ 201 },
+	{ 201 },
+	{ 198 },
+	{ 177 },
+	{ 170 },
+	{ 177 },
+	{ 198 },
+	{ 198 },
+	{ 191 },
+	{ 170 },
+	{ 158 },
+	{ 170 },
+	{ 191 },
+	{ 191 },
+	{ 170 },
+	{ 158 },
+	{ 55 },
+	{ 158 },
+	{ 188 },
+	{ 188 },
+	{ 180 },
+	{ 55 },
+	{ 105 },
+	{ 55 },
+	{ 180 },
+	{ 180 },
+	{ 177 },
+	{ 105 },
+	{ 94 },
+	{ 105 },
+	{ 177 },
+	{ 177 },
+	{ 170 },
+	{ 94 },
+	{ 0 },
+	{ 94 },
+	{ 170 },
+	{ 170 },
+	{ 158 },
+	{ 0 },
+	{ 123 },
+	{ 136 },
+	{ 158 },
+	{ 158 },
+	{ 55 },
+	{ 123 },
+	{ 117 },
+	{ 123 },
+	{ 55 },
+	{ 55 },
+	{ 105 },
+	{ 117 },
+	{ 110 },
+	{ 117 },
+	{ 105 },
+	{ 105 },
+	{ 94 },
+	{ 110 },
+	{ 91 },
+	{ 110 },
+	{ 94 },
+	{ 94 },
+	{ 0 },
+	{ 91 },
+	{ 87 },
+	{ 94 },
+	{ 136 },
+	{ 136 },
+	{ 123 },
+	{ 87 },
+	{ 80 },
+	{ 87 },
+	{ 123 },
+	{ 123 },
+	{ 117 },
+	{ 80 },
+	{ 69 },
+	{ 80 },
+	{ 117 },
+	{ 117 },
+	{ 110 },
+	{ 69 },
+	{ 51 },
+	{ 69 },
+	{ 110 },
+	{ 110 },
+	{ 91 },
+	{ 51 },
+	{ 51 },
+	{ 53 },
+	{ 94 },
+	{ 94 },
+	{ 87 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 87 },
+	{ 87 },
+	{ 80 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 80 },
+	{ 80 },
+	{ 69 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 69 },
+	{ 69 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 53 },
+	{ 53 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 48 },
+	{ 49 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 48 },
+	{ 47 },
+	{ 48 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 47 },
+	{ 49 },
+	{ 47 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 49 },
+	{ 50 },
+	{ 49 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 42 },
+	{ 48 },
+	{ 49 },
+	{ 49 },
+	{ 48 },
+	{ 42 },
+	{ 31 },
+	{ 42 },
+	{ 48 },
+	{ 48 },
+	{ 47 },
+	{ 31 },
+	{ 1 },
+	{ 31 },
+	{ 47 },
+	{ 47 },
+	{ 49 },
+	{ 1 },
+	{ 1 },
+	{ 1 },
+	{ 49 },
+	{ 49 },
+	{ 50 },
+	{ 1 },
+	{ 51 },
+	{ 49 },
+	{ 1 },
+	{ 1 },
+	{ 49 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 49 },
+	{ 49 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 49 },
+	{ 49 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 55 },
+	{ 93 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 55 },
+	{ 51 },
+	{ 55 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 91 },
+	{ 134 },
+	{ 93 },
+	{ 93 },
+	{ 55 },
+	{ 91 },
+	{ 55 },
+	{ 91 },
+	{ 55 },
+	{ 55 },
+	{ 51 },
+	{ 55 },
+	{ 51 },
+	{ 55 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 67 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 67 },
+	{ 116 },
+	{ 161 },
+	{ 134 },
+	{ 134 },
+	{ 91 },
+	{ 116 },
+	{ 75 },
+	{ 116 },
+	{ 91 },
+	{ 91 },
+	{ 55 },
+	{ 75 },
+	{ 66 },
+	{ 75 },
+	{ 55 },
+	{ 55 },
+	{ 51 },
+	{ 66 },
+	{ 88 },
+	{ 66 },
+	{ 51 },
+	{ 51 },
+	{ 67 },
+	{ 88 },
+	{ 124 },
+	{ 170 },
+	{ 161 },
+	{ 161 },
+	{ 116 },
+	{ 124 },
+	{ 82 },
+	{ 124 },
+	{ 116 },
+	{ 116 },
+	{ 75 },
+	{ 82 },
+	{ 72 },
+	{ 82 },
+	{ 75 },
+	{ 75 },
+	{ 66 },
+	{ 72 },
+	{ 95 },
+	{ 72 },
+	{ 66 },
+	{ 66 },
+	{ 88 },
+	{ 95 },
+	{ 115 },
+	{ 158 },
+	{ 170 },
+	{ 170 },
+	{ 124 },
+	{ 115 },
+	{ 75 },
+	{ 115 },
+	{ 124 },
+	{ 124 },
+	{ 82 },
+	{ 75 },
+	{ 67 },
+	{ 75 },
+	{ 82 },
+	{ 82 },
+	{ 72 },
+	{ 67 },
+	{ 88 },
+	{ 67 },
+	{ 72 },
+	{ 72 },
+	{ 95 },
+	{ 88 },
+	{ 87 },
+	{ 0 },
+	{ 158 },
+	{ 158 },
+	{ 115 },
+	{ 87 },
+	{ 55 },
+	{ 87 },
+	{ 115 },
+	{ 115 },
+	{ 75 },
+	{ 55 },
+	{ 51 },
+	{ 55 },
+	{ 75 },
+	{ 75 },
+	{ 67 },
+	{ 51 },
+	{ 66 },
+	{ 51 },
+	{ 67 },
+	{ 67 },
+	{ 88 },
+	{ 66 },
+	{ 55 },
+	{ 91 },
+	{ 0 },
+	{ 0 },
+	{ 87 },
+	{ 55 },
+	{ 51 },
+	{ 55 },
+	{ 87 },
+	{ 87 },
+	{ 55 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 55 },
+	{ 55 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 66 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 91 },
+	{ 91 },
+	{ 55 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 55 },
+	{ 55 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 50 },
+	{ 51 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 51 },
+	{ 49 },
+	{ 1 },
+	{ 50 },
+	{ 50 },
+	{ 51 },
+	{ 49 },
+	{ 51 },
+	{ 49 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 67 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 53 },
+	{ 88 },
+	{ 67 },
+	{ 67 },
+	{ 51 },
+	{ 53 },
+	{ 51 },
+	{ 53 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 59 },
+	{ 95 },
+	{ 88 },
+	{ 88 },
+	{ 53 },
+	{ 59 },
+	{ 51 },
+	{ 59 },
+	{ 53 },
+	{ 53 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 53 },
+	{ 88 },
+	{ 95 },
+	{ 95 },
+	{ 59 },
+	{ 53 },
+	{ 51 },
+	{ 53 },
+	{ 59 },
+	{ 59 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 66 },
+	{ 88 },
+	{ 88 },
+	{ 53 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 53 },
+	{ 53 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 66 },
+	{ 66 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 50 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 50 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 29 },
+	{ 23 },
+	{ 26 },
+	{ 26 },
+	{ 23 },
+	{ 29 },
+	{ 33 },
+	{ 29 },
+	{ 23 },
+	{ 23 },
+	{ 25 },
+	{ 33 },
+	{ 32 },
+	{ 33 },
+	{ 25 },
+	{ 25 },
+	{ 22 },
+	{ 32 },
+	{ 33 },
+	{ 32 },
+	{ 22 },
+	{ 22 },
+	{ 18 },
+	{ 33 },
+	{ 121 },
+	{ 33 },
+	{ 23 },
+	{ 23 },
+	{ 29 },
+	{ 121 },
+	{ 138 },
+	{ 121 },
+	{ 29 },
+	{ 29 },
+	{ 33 },
+	{ 138 },
+	{ 153 },
+	{ 138 },
+	{ 33 },
+	{ 33 },
+	{ 32 },
+	{ 153 },
+	{ 146 },
+	{ 153 },
+	{ 32 },
+	{ 32 },
+	{ 33 },
+	{ 146 },
+	{ 175 },
+	{ 22 },
+	{ 33 },
+	{ 33 },
+	{ 121 },
+	{ 175 },
+	{ 191 },
+	{ 175 },
+	{ 121 },
+	{ 121 },
+	{ 138 },
+	{ 191 },
+	{ 204 },
+	{ 191 },
+	{ 138 },
+	{ 138 },
+	{ 153 },
+	{ 204 },
+	{ 180 },
+	{ 204 },
+	{ 153 },
+	{ 153 },
+	{ 146 },
+	{ 180 },
+	{ 142 },
+	{ 20 },
+	{ 22 },
+	{ 22 },
+	{ 175 },
+	{ 142 },
+	{ 161 },
+	{ 142 },
+	{ 175 },
+	{ 175 },
+	{ 191 },
+	{ 161 },
+	{ 176 },
+	{ 161 },
+	{ 191 },
+	{ 191 },
+	{ 204 },
+	{ 176 },
+	{ 145 },
+	{ 176 },
+	{ 204 },
+	{ 204 },
+	{ 180 },
+	{ 145 },
+	{ 80 },
+	{ 9 },
+	{ 20 },
+	{ 20 },
+	{ 142 },
+	{ 80 },
+	{ 93 },
+	{ 80 },
+	{ 142 },
+	{ 142 },
+	{ 161 },
+	{ 93 },
+	{ 102 },
+	{ 93 },
+	{ 161 },
+	{ 161 },
+	{ 176 },
+	{ 102 },
+	{ 75 },
+	{ 102 },
+	{ 176 },
+	{ 176 },
+	{ 145 },
+	{ 75 },
+	{ 45 },
+	{ 8 },
+	{ 9 },
+	{ 9 },
+	{ 80 },
+	{ 45 },
+	{ 48 },
+	{ 45 },
+	{ 80 },
+	{ 80 },
+	{ 93 },
+	{ 48 },
+	{ 50 },
+	{ 48 },
+	{ 93 },
+	{ 93 },
+	{ 102 },
+	{ 50 },
+	{ 50 },
+	{ 50 },
+	{ 102 },
+	{ 102 },
+	{ 75 },
+	{ 50 },
+	{ 29 },
+	{ 22 },
+	{ 8 },
+	{ 8 },
+	{ 45 },
+	{ 29 },
+	{ 30 },
+	{ 29 },
+	{ 45 },
+	{ 45 },
+	{ 48 },
+	{ 30 },
+	{ 32 },
+	{ 30 },
+	{ 48 },
+	{ 48 },
+	{ 50 },
+	{ 32 },
+	{ 33 },
+	{ 32 },
+	{ 50 },
+	{ 50 },
+	{ 50 },
+	{ 33 },
+	{ 23 },
+	{ 26 },
+	{ 22 },
+	{ 22 },
+	{ 29 },
+	{ 23 },
+	{ 25 },
+	{ 23 },
+	{ 29 },
+	{ 29 },
+	{ 30 },
+	{ 25 },
+	{ 22 },
+	{ 25 },
+	{ 30 },
+	{ 30 },
+	{ 32 },
+	{ 22 },
+	{ 18 },
+	{ 22 },
+	{ 32 },
+	{ 32 },
+	{ 33 },
+	{ 18 },
+	{ 43 },
+	{ 33 },
+	{ 18 },
+	{ 18 },
+	{ 19 },
+	{ 43 },
+	{ 53 },
+	{ 43 },
+	{ 19 },
+	{ 19 },
+	{ 21 },
+	{ 53 },
+	{ 60 },
+	{ 53 },
+	{ 21 },
+	{ 21 },
+	{ 24 },
+	{ 60 },
+	{ 49 },
+	{ 60 },
+	{ 24 },
+	{ 24 },
+	{ 41 },
+	{ 49 },
+	{ 132 },
+	{ 146 },
+	{ 33 },
+	{ 33 },
+	{ 43 },
+	{ 132 },
+	{ 130 },
+	{ 132 },
+	{ 43 },
+	{ 43 },
+	{ 53 },
+	{ 130 },
+	{ 124 },
+	{ 130 },
+	{ 53 },
+	{ 53 },
+	{ 60 },
+	{ 124 },
+	{ 100 },
+	{ 124 },
+	{ 60 },
+	{ 60 },
+	{ 49 },
+	{ 100 },
+	{ 143 },
+	{ 180 },
+	{ 146 },
+	{ 146 },
+	{ 132 },
+	{ 143 },
+	{ 110 },
+	{ 143 },
+	{ 132 },
+	{ 132 },
+	{ 130 },
+	{ 110 },
+	{ 80 },
+	{ 110 },
+	{ 130 },
+	{ 130 },
+	{ 124 },
+	{ 80 },
+	{ 52 },
+	{ 80 },
+	{ 124 },
+	{ 124 },
+	{ 100 },
+	{ 52 },
+	{ 99 },
+	{ 145 },
+	{ 180 },
+	{ 180 },
+	{ 143 },
+	{ 99 },
+	{ 60 },
+	{ 99 },
+	{ 143 },
+	{ 143 },
+	{ 110 },
+	{ 60 },
+	{ 51 },
+	{ 60 },
+	{ 110 },
+	{ 110 },
+	{ 80 },
+	{ 51 },
+	{ 0 },
+	{ 51 },
+	{ 80 },
+	{ 80 },
+	{ 52 },
+	{ 0 },
+	{ 51 },
+	{ 75 },
+	{ 145 },
+	{ 145 },
+	{ 99 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 99 },
+	{ 99 },
+	{ 60 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 60 },
+	{ 60 },
+	{ 51 },
+	{ 51 },
+	{ 48 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 0 },
+	{ 48 },
+	{ 49 },
+	{ 50 },
+	{ 75 },
+	{ 75 },
+	{ 51 },
+	{ 49 },
+	{ 47 },
+	{ 49 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 47 },
+	{ 45 },
+	{ 47 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 45 },
+	{ 39 },
+	{ 45 },
+	{ 51 },
+	{ 51 },
+	{ 48 },
+	{ 39 },
+	{ 32 },
+	{ 33 },
+	{ 50 },
+	{ 50 },
+	{ 49 },
+	{ 32 },
+	{ 30 },
+	{ 32 },
+	{ 49 },
+	{ 49 },
+	{ 47 },
+	{ 30 },
+	{ 28 },
+	{ 30 },
+	{ 47 },
+	{ 47 },
+	{ 45 },
+	{ 28 },
+	{ 20 },
+	{ 28 },
+	{ 45 },
+	{ 45 },
+	{ 39 },
+	{ 20 },
+	{ 19 },
+	{ 18 },
+	{ 33 },
+	{ 33 },
+	{ 32 },
+	{ 19 },
+	{ 21 },
+	{ 19 },
+	{ 32 },
+	{ 32 },
+	{ 30 },
+	{ 21 },
+	{ 24 },
+	{ 21 },
+	{ 30 },
+	{ 30 },
+	{ 28 },
+	{ 24 },
+	{ 41 },
+	{ 24 },
+	{ 28 },
+	{ 28 },
+	{ 20 },
+	{ 41 },
+	{ 148 },
+	{ 41 },
+	{ 42 },
+	{ 42 },
+	{ 103 },
+	{ 148 },
+	{ 146 },
+	{ 148 },
+	{ 103 },
+	{ 103 },
+	{ 99 },
+	{ 146 },
+	{ 158 },
+	{ 146 },
+	{ 99 },
+	{ 99 },
+	{ 118 },
+	{ 158 },
+	{ 193 },
+	{ 158 },
+	{ 118 },
+	{ 118 },
+	{ 161 },
+	{ 193 },
+	{ 113 },
+	{ 13 },
+	{ 41 },
+	{ 41 },
+	{ 148 },
+	{ 113 },
+	{ 130 },
+	{ 113 },
+	{ 148 },
+	{ 148 },
+	{ 146 },
+	{ 130 },
+	{ 149 },
+	{ 130 },
+	{ 146 },
+	{ 146 },
+	{ 158 },
+	{ 149 },
+	{ 159 },
+	{ 149 },
+	{ 158 },
+	{ 158 },
+	{ 193 },
+	{ 159 },
+	{ 51 },
+	{ 1 },
+	{ 13 },
+	{ 13 },
+	{ 113 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 113 },
+	{ 113 },
+	{ 130 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 130 },
+	{ 130 },
+	{ 149 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 149 },
+	{ 149 },
+	{ 159 },
+	{ 51 },
+	{ 51 },
+	{ 0 },
+	{ 1 },
+	{ 1 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 51 },
+	{ 1 },
+	{ 0 },
+	{ 0 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 51 },
+	{ 49 },
+	{ 6 },
+	{ 1 },
+	{ 1 },
+	{ 51 },
+	{ 49 },
+	{ 49 },
+	{ 49 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 49 },
+	{ 48 },
+	{ 49 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 48 },
+	{ 50 },
+	{ 48 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 57 },
+	{ 15 },
+	{ 6 },
+	{ 6 },
+	{ 49 },
+	{ 57 },
+	{ 64 },
+	{ 57 },
+	{ 49 },
+	{ 49 },
+	{ 49 },
+	{ 64 },
+	{ 70 },
+	{ 64 },
+	{ 49 },
+	{ 49 },
+	{ 48 },
+	{ 70 },
+	{ 79 },
+	{ 70 },
+	{ 48 },
+	{ 48 },
+	{ 50 },
+	{ 79 },
+	{ 103 },
+	{ 42 },
+	{ 15 },
+	{ 15 },
+	{ 57 },
+	{ 103 },
+	{ 99 },
+	{ 103 },
+	{ 57 },
+	{ 57 },
+	{ 64 },
+	{ 99 },
+	{ 118 },
+	{ 99 },
+	{ 64 },
+	{ 64 },
+	{ 70 },
+	{ 118 },
+	{ 161 },
+	{ 118 },
+	{ 70 },
+	{ 70 },
+	{ 79 },
+	{ 161 },
+	{ 190 },
+	{ 193 },
+	{ 161 },
+	{ 161 },
+	{ 164 },
+	{ 190 },
+	{ 137 },
+	{ 190 },
+	{ 164 },
+	{ 164 },
+	{ 137 },
+	{ 137 },
+	{ 32 },
+	{ 137 },
+	{ 137 },
+	{ 137 },
+	{ 22 },
+	{ 32 },
+	{ 6 },
+	{ 32 },
+	{ 22 },
+	{ 22 },
+	{ 3 },
+	{ 6 },
+	{ 166 },
+	{ 159 },
+	{ 193 },
+	{ 193 },
+	{ 190 },
+	{ 166 },
+	{ 152 },
+	{ 166 },
+	{ 190 },
+	{ 190 },
+	{ 137 },
+	{ 152 },
+	{ 41 },
+	{ 152 },
+	{ 137 },
+	{ 137 },
+	{ 32 },
+	{ 41 },
+	{ 18 },
+	{ 41 },
+	{ 32 },
+	{ 32 },
+	{ 6 },
+	{ 18 },
+	{ 68 },
+	{ 51 },
+	{ 159 },
+	{ 159 },
+	{ 166 },
+	{ 68 },
+	{ 120 },
+	{ 68 },
+	{ 166 },
+	{ 166 },
+	{ 152 },
+	{ 120 },
+	{ 113 },
+	{ 120 },
+	{ 152 },
+	{ 152 },
+	{ 41 },
+	{ 113 },
+	{ 45 },
+	{ 113 },
+	{ 41 },
+	{ 41 },
+	{ 18 },
+	{ 45 },
+	{ 51 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 68 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 68 },
+	{ 68 },
+	{ 120 },
+	{ 51 },
+	{ 154 },
+	{ 51 },
+	{ 120 },
+	{ 120 },
+	{ 113 },
+	{ 154 },
+	{ 137 },
+	{ 154 },
+	{ 113 },
+	{ 113 },
+	{ 45 },
+	{ 137 },
+	{ 51 },
+	{ 51 },
+	{ 50 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 174 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 154 },
+	{ 174 },
+	{ 130 },
+	{ 174 },
+	{ 154 },
+	{ 154 },
+	{ 137 },
+	{ 130 },
+	{ 51 },
+	{ 50 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 123 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 51 },
+	{ 123 },
+	{ 152 },
+	{ 123 },
+	{ 51 },
+	{ 51 },
+	{ 174 },
+	{ 152 },
+	{ 42 },
+	{ 152 },
+	{ 174 },
+	{ 174 },
+	{ 130 },
+	{ 42 },
+	{ 94 },
+	{ 79 },
+	{ 50 },
+	{ 50 },
+	{ 51 },
+	{ 94 },
+	{ 139 },
+	{ 94 },
+	{ 51 },
+	{ 51 },
+	{ 123 },
+	{ 139 },
+	{ 76 },
+	{ 139 },
+	{ 123 },
+	{ 123 },
+	{ 152 },
+	{ 76 },
+	{ 6 },
+	{ 76 },
+	{ 152 },
+	{ 152 },
+	{ 42 },
+	{ 6 },
+	{ 164 },
+	{ 161 },
+	{ 79 },
+	{ 79 },
+	{ 94 },
+	{ 164 },
+	{ 137 },
+	{ 164 },
+	{ 94 },
+	{ 94 },
+	{ 139 },
+	{ 137 },
+	{ 22 },
+	{ 137 },
+	{ 139 },
+	{ 139 },
+	{ 76 },
+	{ 22 },
+	{ 3 },
+	{ 22 },
+	{ 76 },
+	{ 76 },
+	{ 6 },
+	{ 3 },
+	{ 59 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 49 },
+	{ 59 },
+	{ 28 },
+	{ 59 },
+	{ 49 },
+	{ 49 },
+	{ 29 },
+	{ 28 },
+	{ 24 },
+	{ 28 },
+	{ 29 },
+	{ 29 },
+	{ 24 },
+	{ 24 },
+	{ 47 },
+	{ 24 },
+	{ 24 },
+	{ 24 },
+	{ 35 },
+	{ 47 },
+	{ 98 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 59 },
+	{ 98 },
+	{ 29 },
+	{ 98 },
+	{ 59 },
+	{ 59 },
+	{ 28 },
+	{ 29 },
+	{ 24 },
+	{ 29 },
+	{ 28 },
+	{ 28 },
+	{ 24 },
+	{ 24 },
+	{ 73 },
+	{ 24 },
+	{ 24 },
+	{ 24 },
+	{ 47 },
+	{ 73 },
+	{ 136 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 98 },
+	{ 136 },
+	{ 30 },
+	{ 136 },
+	{ 98 },
+	{ 98 },
+	{ 29 },
+	{ 30 },
+	{ 30 },
+	{ 30 },
+	{ 29 },
+	{ 29 },
+	{ 24 },
+	{ 30 },
+	{ 101 },
+	{ 30 },
+	{ 24 },
+	{ 24 },
+	{ 73 },
+	{ 101 },
+	{ 166 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 136 },
+	{ 166 },
+	{ 53 },
+	{ 166 },
+	{ 136 },
+	{ 136 },
+	{ 30 },
+	{ 53 },
+	{ 51 },
+	{ 53 },
+	{ 30 },
+	{ 30 },
+	{ 30 },
+	{ 51 },
+	{ 123 },
+	{ 51 },
+	{ 30 },
+	{ 30 },
+	{ 101 },
+	{ 123 },
+	{ 187 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 166 },
+	{ 187 },
+	{ 70 },
+	{ 187 },
+	{ 166 },
+	{ 166 },
+	{ 53 },
+	{ 70 },
+	{ 60 },
+	{ 70 },
+	{ 53 },
+	{ 53 },
+	{ 51 },
+	{ 60 },
+	{ 138 },
+	{ 60 },
+	{ 51 },
+	{ 51 },
+	{ 123 },
+	{ 138 },
+	{ 201 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 187 },
+	{ 201 },
+	{ 69 },
+	{ 201 },
+	{ 187 },
+	{ 187 },
+	{ 70 },
+	{ 69 },
+	{ 64 },
+	{ 69 },
+	{ 70 },
+	{ 70 },
+	{ 60 },
+	{ 64 },
+	{ 143 },
+	{ 64 },
+	{ 60 },
+	{ 60 },
+	{ 138 },
+	{ 143 },
+	{ 187 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 201 },
+	{ 187 },
+	{ 66 },
+	{ 187 },
+	{ 201 },
+	{ 201 },
+	{ 69 },
+	{ 66 },
+	{ 59 },
+	{ 66 },
+	{ 69 },
+	{ 69 },
+	{ 64 },
+	{ 59 },
+	{ 135 },
+	{ 59 },
+	{ 64 },
+	{ 64 },
+	{ 143 },
+	{ 135 },
+	{ 168 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 187 },
+	{ 168 },
+	{ 54 },
+	{ 168 },
+	{ 187 },
+	{ 187 },
+	{ 66 },
+	{ 54 },
+	{ 48 },
+	{ 54 },
+	{ 66 },
+	{ 66 },
+	{ 59 },
+	{ 48 },
+	{ 117 },
+	{ 48 },
+	{ 59 },
+	{ 59 },
+	{ 135 },
+	{ 117 },
+	{ 136 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 168 },
+	{ 136 },
+	{ 34 },
+	{ 136 },
+	{ 168 },
+	{ 168 },
+	{ 54 },
+	{ 34 },
+	{ 32 },
+	{ 34 },
+	{ 54 },
+	{ 54 },
+	{ 48 },
+	{ 32 },
+	{ 98 },
+	{ 32 },
+	{ 48 },
+	{ 48 },
+	{ 117 },
+	{ 98 },
+	{ 96 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 136 },
+	{ 96 },
+	{ 29 },
+	{ 96 },
+	{ 136 },
+	{ 136 },
+	{ 34 },
+	{ 29 },
+	{ 22 },
+	{ 29 },
+	{ 34 },
+	{ 34 },
+	{ 32 },
+	{ 22 },
+	{ 75 },
+	{ 22 },
+	{ 32 },
+	{ 32 },
+	{ 98 },
+	{ 75 },
+	{ 60 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 96 },
+	{ 60 },
+	{ 29 },
+	{ 60 },
+	{ 96 },
+	{ 96 },
+	{ 29 },
+	{ 29 },
+	{ 24 },
+	{ 29 },
+	{ 29 },
+	{ 29 },
+	{ 22 },
+	{ 24 },
+	{ 48 },
+	{ 24 },
+	{ 22 },
+	{ 22 },
+	{ 75 },
+	{ 48 },
+	{ 50 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 60 },
+	{ 50 },
+	{ 28 },
+	{ 50 },
+	{ 60 },
+	{ 60 },
+	{ 29 },
+	{ 28 },
+	{ 24 },
+	{ 28 },
+	{ 29 },
+	{ 29 },
+	{ 24 },
+	{ 24 },
+	{ 36 },
+	{ 24 },
+	{ 24 },
+	{ 24 },
+	{ 48 },
+	{ 36 },
+	{ 49 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 50 },
+	{ 49 },
+	{ 29 },
+	{ 49 },
+	{ 50 },
+	{ 50 },
+	{ 28 },
+	{ 29 },
+	{ 26 },
+	{ 29 },
+	{ 28 },
+	{ 28 },
+	{ 24 },
+	{ 26 },
+	{ 37 },
+	{ 26 },
+	{ 24 },
+	{ 24 },
+	{ 36 },
+	{ 37 },
+	{ 49 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 49 },
+	{ 49 },
+	{ 29 },
+	{ 49 },
+	{ 49 },
+	{ 49 },
+	{ 29 },
+	{ 29 },
+	{ 23 },
+	{ 29 },
+	{ 29 },
+	{ 29 },
+	{ 26 },
+	{ 23 },
+	{ 37 },
+	{ 23 },
+	{ 26 },
+	{ 26 },
+	{ 37 },
+	{ 37 },
+	{ 49 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 49 },
+	{ 49 },
+	{ 29 },
+	{ 49 },
+	{ 49 },
+	{ 49 },
+	{ 29 },
+	{ 29 },
+	{ 23 },
+	{ 29 },
+	{ 29 },
+	{ 29 },
+	{ 23 },
+	{ 23 },
+	{ 35 },
+	{ 23 },
+	{ 23 },
+	{ 23 },
+	{ 37 },
+	{ 35 },
+	{ 49 },
+	{ 139 },
+	{ 139 },
+	{ 139 },
+	{ 49 },
+	{ 49 },
+	{ 29 },
+	{ 49 },
+	{ 49 },
+	{ 49 },
+	{ 29 },
+	{ 29 },
+	{ 24 },
+	{ 29 },
+	{ 29 },
+	{ 29 },
+	{ 23 },
+	{ 24 },
+	{ 35 },
+	{ 24 },
+	{ 23 },
+	{ 23 },
+	{ 35 },
+	{ 35 },
+	{ 108 },
+	{ 47 },
+	{ 35 },
+	{ 35 },
+	{ 100 },
+	{ 108 },
+	{ 122 },
+	{ 108 },
+	{ 100 },
+	{ 100 },
+	{ 119 },
+	{ 122 },
+	{ 107 },
+	{ 122 },
+	{ 119 },
+	{ 119 },
+	{ 93 },
+	{ 107 },
+	{ 58 },
+	{ 107 },
+	{ 93 },
+	{ 93 },
+	{ 47 },
+	{ 58 },
+	{ 116 },
+	{ 73 },
+	{ 47 },
+	{ 47 },
+	{ 108 },
+	{ 116 },
+	{ 134 },
+	{ 116 },
+	{ 108 },
+	{ 108 },
+	{ 122 },
+	{ 134 },
+	{ 129 },
+	{ 134 },
+	{ 122 },
+	{ 122 },
+	{ 107 },
+	{ 129 },
+	{ 73 },
+	{ 129 },
+	{ 107 },
+	{ 107 },
+	{ 58 },
+	{ 73 },
+	{ 125 },
+	{ 101 },
+	{ 73 },
+	{ 73 },
+	{ 116 },
+	{ 125 },
+	{ 142 },
+	{ 125 },
+	{ 116 },
+	{ 116 },
+	{ 134 },
+	{ 142 },
+	{ 142 },
+	{ 142 },
+	{ 134 },
+	{ 134 },
+	{ 129 },
+	{ 142 },
+	{ 87 },
+	{ 142 },
+	{ 129 },
+	{ 129 },
+	{ 73 },
+	{ 87 },
+	{ 136 },
+	{ 123 },
+	{ 101 },
+	{ 101 },
+	{ 125 },
+	{ 136 },
+	{ 149 },
+	{ 136 },
+	{ 125 },
+	{ 125 },
+	{ 142 },
+	{ 149 },
+	{ 159 },
+	{ 149 },
+	{ 142 },
+	{ 142 },
+	{ 142 },
+	{ 159 },
+	{ 100 },
+	{ 159 },
+	{ 142 },
+	{ 142 },
+	{ 87 },
+	{ 100 },
+	{ 144 },
+	{ 138 },
+	{ 123 },
+	{ 123 },
+	{ 136 },
+	{ 144 },
+	{ 150 },
+	{ 144 },
+	{ 136 },
+	{ 136 },
+	{ 149 },
+	{ 150 },
+	{ 168 },
+	{ 150 },
+	{ 149 },
+	{ 149 },
+	{ 159 },
+	{ 168 },
+	{ 105 },
+	{ 168 },
+	{ 159 },
+	{ 159 },
+	{ 100 },
+	{ 105 },
+	{ 143 },
+	{ 143 },
+	{ 138 },
+	{ 138 },
+	{ 144 },
+	{ 143 },
+	{ 155 },
+	{ 143 },
+	{ 144 },
+	{ 144 },
+	{ 150 },
+	{ 155 },
+	{ 172 },
+	{ 155 },
+	{ 150 },
+	{ 150 },
+	{ 168 },
+	{ 172 },
+	{ 114 },
+	{ 172 },
+	{ 168 },
+	{ 168 },
+	{ 105 },
+	{ 114 },
+	{ 141 },
+	{ 135 },
+	{ 143 },
+	{ 143 },
+	{ 143 },
+	{ 141 },
+	{ 153 },
+	{ 141 },
+	{ 143 },
+	{ 143 },
+	{ 155 },
+	{ 153 },
+	{ 165 },
+	{ 153 },
+	{ 155 },
+	{ 155 },
+	{ 172 },
+	{ 165 },
+	{ 108 },
+	{ 165 },
+	{ 172 },
+	{ 172 },
+	{ 114 },
+	{ 108 },
+	{ 135 },
+	{ 117 },
+	{ 135 },
+	{ 135 },
+	{ 141 },
+	{ 135 },
+	{ 151 },
+	{ 135 },
+	{ 141 },
+	{ 141 },
+	{ 153 },
+	{ 151 },
+	{ 161 },
+	{ 151 },
+	{ 153 },
+	{ 153 },
+	{ 165 },
+	{ 161 },
+	{ 102 },
+	{ 161 },
+	{ 165 },
+	{ 165 },
+	{ 108 },
+	{ 102 },
+	{ 127 },
+	{ 98 },
+	{ 117 },
+	{ 117 },
+	{ 135 },
+	{ 127 },
+	{ 139 },
+	{ 127 },
+	{ 135 },
+	{ 135 },
+	{ 151 },
+	{ 139 },
+	{ 142 },
+	{ 139 },
+	{ 151 },
+	{ 151 },
+	{ 161 },
+	{ 142 },
+	{ 87 },
+	{ 142 },
+	{ 161 },
+	{ 161 },
+	{ 102 },
+	{ 87 },
+	{ 115 },
+	{ 75 },
+	{ 98 },
+	{ 98 },
+	{ 127 },
+	{ 115 },
+	{ 134 },
+	{ 115 },
+	{ 127 },
+	{ 127 },
+	{ 139 },
+	{ 134 },
+	{ 126 },
+	{ 134 },
+	{ 139 },
+	{ 139 },
+	{ 142 },
+	{ 126 },
+	{ 75 },
+	{ 126 },
+	{ 142 },
+	{ 142 },
+	{ 87 },
+	{ 75 },
+	{ 108 },
+	{ 48 },
+	{ 75 },
+	{ 75 },
+	{ 115 },
+	{ 108 },
+	{ 122 },
+	{ 108 },
+	{ 115 },
+	{ 115 },
+	{ 134 },
+	{ 122 },
+	{ 107 },
+	{ 122 },
+	{ 134 },
+	{ 134 },
+	{ 126 },
+	{ 107 },
+	{ 58 },
+	{ 107 },
+	{ 126 },
+	{ 126 },
+	{ 75 },
+	{ 58 },
+	{ 101 },
+	{ 36 },
+	{ 48 },
+	{ 48 },
+	{ 108 },
+	{ 101 },
+	{ 119 },
+	{ 101 },
+	{ 108 },
+	{ 108 },
+	{ 122 },
+	{ 119 },
+	{ 96 },
+	{ 119 },
+	{ 122 },
+	{ 122 },
+	{ 107 },
+	{ 96 },
+	{ 47 },
+	{ 96 },
+	{ 107 },
+	{ 107 },
+	{ 58 },
+	{ 47 },
+	{ 94 },
+	{ 37 },
+	{ 36 },
+	{ 36 },
+	{ 101 },
+	{ 94 },
+	{ 115 },
+	{ 94 },
+	{ 101 },
+	{ 101 },
+	{ 119 },
+	{ 115 },
+	{ 85 },
+	{ 115 },
+	{ 119 },
+	{ 119 },
+	{ 96 },
+	{ 85 },
+	{ 37 },
+	{ 85 },
+	{ 96 },
+	{ 96 },
+	{ 47 },
+	{ 37 },
+	{ 94 },
+	{ 37 },
+	{ 37 },
+	{ 37 },
+	{ 94 },
+	{ 94 },
+	{ 112 },
+	{ 94 },
+	{ 94 },
+	{ 94 },
+	{ 115 },
+	{ 112 },
+	{ 83 },
+	{ 112 },
+	{ 115 },
+	{ 115 },
+	{ 85 },
+	{ 83 },
+	{ 37 },
+	{ 83 },
+	{ 85 },
+	{ 85 },
+	{ 37 },
+	{ 37 },
+	{ 95 },
+	{ 35 },
+	{ 37 },
+	{ 37 },
+	{ 94 },
+	{ 95 },
+	{ 113 },
+	{ 95 },
+	{ 94 },
+	{ 94 },
+	{ 112 },
+	{ 113 },
+	{ 86 },
+	{ 113 },
+	{ 112 },
+	{ 112 },
+	{ 83 },
+	{ 86 },
+	{ 38 },
+	{ 86 },
+	{ 83 },
+	{ 83 },
+	{ 37 },
+	{ 38 },
+	{ 100 },
+	{ 35 },
+	{ 35 },
+	{ 35 },
+	{ 95 },
+	{ 100 },
+	{ 119 },
+	{ 100 },
+	{ 95 },
+	{ 95 },
+	{ 113 },
+	{ 119 },
+	{ 93 },
+	{ 119 },
+	{ 113 },
+	{ 113 },
+	{ 86 },
+	{ 93 },
+	{ 47 },
+	{ 93 },
+	{ 86 },
+	{ 86 },
+	{ 38 },
+	{ 47 },
+};
@@ -0,0 +1,1027 @@
+const r3d_face_t faces0[] =
+{ // plane normal[xyz], distance (scaled by 127)
+	{ 121, 32, 24, 26 },
+	{ 121, 32, 24, 26 },
+	{ 92, -85, 18, 5 },
+	{ 92, -85, 18, 5 },
+	{ -59, -112, -12, -27 },
+	{ -59, -112, -12, -27 },
+	{ -103, -71, -20, -30 },
+	{ -103, -71, -20, -30 },
+	{ 102, 32, 68, 27 },
+	{ 102, 32, 68, 27 },
+	{ 78, -85, 52, 5 },
+	{ 78, -86, 52, 5 },
+	{ -50, -112, -34, -27 },
+	{ -50, -112, -34, -27 },
+	{ -87, -71, -58, -30 },
+	{ -87, -71, -58, -30 },
+	{ 68, 32, 102, 28 },
+	{ 68, 32, 102, 28 },
+	{ 52, -85, 78, 6 },
+	{ 52, -85, 78, 6 },
+	{ -34, -112, -50, -28 },
+	{ -34, -112, -50, -28 },
+	{ -59, -71, -87, -31 },
+	{ -58, -71, -87, -31 },
+	{ 24, 32, 121, 30 },
+	{ 24, 32, 121, 30 },
+	{ 18, -85, 92, 7 },
+	{ 18, -85, 92, 7 },
+	{ -12, -112, -59, -29 },
+	{ -12, -112, -59, -29 },
+	{ -20, -71, -103, -33 },
+	{ -20, -71, -103, -33 },
+	{ -22, 38, 119, 32 },
+	{ -23, 32, 121, 31 },
+	{ -19, -80, 97, 10 },
+	{ -18, -85, 92, 9 },
+	{ 12, -111, -60, -30 },
+	{ 12, -112, -59, -29 },
+	{ 20, -71, -103, -34 },
+	{ 20, -71, -103, -34 },
+	{ -66, 48, 97, 34 },
+	{ -65, 50, 97, 34 },
+	{ -59, -71, 87, 14 },
+	{ -59, -69, 88, 15 },
+	{ 35, -111, -52, -30 },
+	{ 35, -110, -52, -31 },
+	{ 59, -71, -88, -35 },
+	{ 59, -71, -88, -35 },
+	{ -102, 41, 63, 35 },
+	{ -96, 55, 62, 35 },
+	{ -84, -78, 54, 13 },
+	{ -92, -63, 61, 18 },
+	{ 51, -111, -34, -31 },
+	{ 53, -110, -35, -31 },
+	{ 87, -71, -58, -36 },
+	{ 88, -71, -59, -36 },
+	{ -121, 32, 21, 35 },
+	{ -118, 43, 22, 35 },
+	{ -92, -85, 17, 11 },
+	{ -99, -77, 19, 14 },
+	{ 59, -112, -12, -31 },
+	{ 61, -111, -12, -31 },
+	{ 103, -71, -20, -37 },
+	{ 103, -71, -20, -37 },
+	{ -121, 32, -24, 34 },
+	{ -121, 32, -24, 34 },
+	{ -92, -85, -18, 11 },
+	{ -92, -85, -18, 11 },
+	{ 59, -112, 12, -31 },
+	{ 59, -112, 12, -31 },
+	{ 103, -71, 20, -37 },
+	{ 103, -71, 20, -37 },
+	{ -102, 32, -68, 34 },
+	{ -102, 32, -68, 34 },
+	{ -78, -85, -52, 11 },
+	{ -78, -86, -52, 11 },
+	{ 50, -112, 34, -31 },
+	{ 50, -112, 34, -31 },
+	{ 87, -71, 58, -36 },
+	{ 87, -71, 58, -36 },
+	{ -68, 32, -102, 33 },
+	{ -68, 32, -102, 33 },
+	{ -52, -86, -78, 10 },
+	{ -52, -85, -78, 10 },
+	{ 34, -112, 50, -30 },
+	{ 34, -112, 50, -30 },
+	{ 58, -71, 87, -35 },
+	{ 58, -71, 87, -35 },
+	{ -24, 32, -121, 31 },
+	{ -24, 32, -121, 31 },
+	{ -18, -85, -92, 9 },
+	{ -18, -85, -92, 9 },
+	{ 12, -112, 59, -29 },
+	{ 12, -112, 59, -29 },
+	{ 20, -71, 103, -34 },
+	{ 20, -71, 103, -34 },
+	{ 24, 32, -121, 30 },
+	{ 24, 32, -121, 30 },
+	{ 18, -85, -92, 7 },
+	{ 18, -85, -92, 7 },
+	{ -12, -112, 59, -29 },
+	{ -12, -112, 59, -29 },
+	{ -20, -71, 103, -33 },
+	{ -20, -71, 103, -33 },
+	{ 68, 32, -102, 28 },
+	{ 68, 32, -102, 28 },
+	{ 52, -85, -78, 6 },
+	{ 52, -85, -78, 6 },
+	{ -34, -112, 50, -28 },
+	{ -34, -112, 50, -28 },
+	{ -58, -71, 87, -31 },
+	{ -59, -71, 87, -31 },
+	{ 102, 32, -68, 27 },
+	{ 102, 32, -68, 27 },
+	{ 78, -86, -52, 5 },
+	{ 78, -85, -52, 5 },
+	{ -50, -112, 34, -27 },
+	{ -50, -112, 34, -27 },
+	{ -87, -71, 58, -30 },
+	{ -87, -71, 58, -30 },
+	{ 121, 32, -24, 26 },
+	{ 121, 32, -24, 26 },
+	{ 92, -85, -18, 5 },
+	{ 92, -85, -18, 5 },
+	{ -59, -112, 12, -27 },
+	{ -59, -112, 12, -27 },
+	{ -103, -71, 20, -30 },
+	{ -103, -71, 20, -30 },
+	{ -113, -53, -22, -29 },
+	{ -113, -53, -22, -29 },
+	{ -115, -48, -23, -30 },
+	{ -115, -48, -23, -30 },
+	{ -119, -36, -24, -31 },
+	{ -119, -36, -24, -31 },
+	{ -124, -15, -24, -33 },
+	{ -124, -15, -24, -33 },
+	{ -96, -53, -64, -30 },
+	{ -96, -53, -64, -30 },
+	{ -98, -48, -65, -30 },
+	{ -98, -48, -65, -30 },
+	{ -101, -37, -68, -31 },
+	{ -101, -37, -68, -31 },
+	{ -105, -15, -70, -34 },
+	{ -105, -15, -70, -34 },
+	{ -64, -53, -96, -31 },
+	{ -64, -53, -96, -31 },
+	{ -65, -48, -98, -31 },
+	{ -65, -48, -98, -31 },
+	{ -68, -37, -101, -32 },
+	{ -68, -37, -101, -32 },
+	{ -70, -15, -105, -35 },
+	{ -70, -15, -105, -35 },
+	{ -22, -53, -113, -32 },
+	{ -22, -53, -113, -32 },
+	{ -23, -48, -115, -33 },
+	{ -23, -48, -115, -33 },
+	{ -24, -36, -119, -34 },
+	{ -24, -36, -119, -34 },
+	{ -24, -15, -124, -36 },
+	{ -24, -15, -124, -36 },
+	{ 22, -53, -113, -34 },
+	{ 22, -53, -113, -34 },
+	{ 23, -48, -115, -34 },
+	{ 23, -48, -115, -34 },
+	{ 24, -36, -119, -35 },
+	{ 24, -36, -119, -35 },
+	{ 24, -15, -124, -38 },
+	{ 24, -15, -124, -38 },
+	{ 64, -53, -96, -35 },
+	{ 64, -53, -96, -35 },
+	{ 65, -48, -98, -36 },
+	{ 65, -48, -98, -36 },
+	{ 68, -37, -101, -37 },
+	{ 68, -37, -101, -37 },
+	{ 70, -15, -105, -39 },
+	{ 70, -15, -105, -39 },
+	{ 96, -53, -64, -37 },
+	{ 96, -53, -64, -37 },
+	{ 98, -48, -65, -37 },
+	{ 98, -48, -65, -37 },
+	{ 101, -37, -68, -38 },
+	{ 101, -37, -68, -38 },
+	{ 105, -15, -70, -41 },
+	{ 105, -15, -70, -41 },
+	{ 113, -53, -22, -37 },
+	{ 113, -53, -22, -37 },
+	{ 115, -48, -23, -37 },
+	{ 115, -48, -23, -37 },
+	{ 119, -36, -24, -38 },
+	{ 119, -36, -24, -38 },
+	{ 124, -15, -24, -41 },
+	{ 124, -15, -24, -41 },
+	{ 113, -53, 22, -37 },
+	{ 113, -53, 22, -37 },
+	{ 115, -48, 23, -37 },
+	{ 115, -48, 23, -37 },
+	{ 119, -36, 24, -38 },
+	{ 119, -36, 24, -38 },
+	{ 124, -15, 24, -41 },
+	{ 124, -15, 24, -41 },
+	{ 96, -53, 64, -37 },
+	{ 96, -53, 64, -37 },
+	{ 98, -48, 65, -37 },
+	{ 98, -48, 65, -37 },
+	{ 101, -37, 68, -38 },
+	{ 101, -37, 68, -38 },
+	{ 105, -15, 70, -41 },
+	{ 105, -15, 70, -41 },
+	{ 64, -53, 96, -35 },
+	{ 64, -53, 96, -35 },
+	{ 65, -48, 98, -36 },
+	{ 65, -48, 98, -36 },
+	{ 68, -37, 101, -37 },
+	{ 68, -37, 101, -37 },
+	{ 70, -15, 105, -39 },
+	{ 70, -15, 105, -39 },
+	{ 22, -53, 113, -34 },
+	{ 22, -53, 113, -34 },
+	{ 23, -48, 115, -34 },
+	{ 23, -48, 115, -34 },
+	{ 24, -36, 119, -35 },
+	{ 24, -36, 119, -35 },
+	{ 24, -15, 124, -38 },
+	{ 24, -15, 124, -38 },
+	{ -22, -53, 113, -32 },
+	{ -22, -53, 113, -32 },
+	{ -23, -48, 115, -33 },
+	{ -23, -48, 115, -33 },
+	{ -24, -36, 119, -34 },
+	{ -24, -36, 119, -34 },
+	{ -24, -15, 124, -36 },
+	{ -24, -15, 124, -36 },
+	{ -64, -53, 96, -31 },
+	{ -64, -53, 96, -31 },
+	{ -65, -48, 98, -31 },
+	{ -65, -48, 98, -31 },
+	{ -68, -37, 101, -32 },
+	{ -68, -37, 101, -32 },
+	{ -70, -15, 105, -35 },
+	{ -70, -15, 105, -35 },
+	{ -96, -53, 64, -30 },
+	{ -96, -53, 64, -30 },
+	{ -98, -48, 65, -30 },
+	{ -98, -48, 65, -30 },
+	{ -101, -37, 68, -31 },
+	{ -101, -37, 68, -31 },
+	{ -105, -15, 70, -34 },
+	{ -105, -15, 70, -34 },
+	{ -113, -53, 22, -29 },
+	{ -113, -53, 22, -29 },
+	{ -115, -48, 23, -30 },
+	{ -115, -48, 23, -30 },
+	{ -119, -36, 24, -31 },
+	{ -119, -36, 24, -31 },
+	{ -124, -15, 24, -33 },
+	{ -124, -15, 24, -33 },
+	{ -121, 32, -24, -37 },
+	{ -121, 32, -24, -37 },
+	{ -99, 77, -19, -38 },
+	{ -99, 77, -20, -38 },
+	{ -82, 95, -16, -37 },
+	{ -82, 95, -16, -37 },
+	{ -93, 85, -18, -37 },
+	{ -93, 85, -18, -37 },
+	{ -102, 32, -68, -38 },
+	{ -102, 32, -68, -38 },
+	{ -84, 78, -56, -39 },
+	{ -84, 78, -56, -39 },
+	{ -70, 95, -47, -38 },
+	{ -70, 95, -47, -38 },
+	{ -78, 85, -53, -38 },
+	{ -78, 85, -53, -38 },
+	{ -68, 32, -102, -39 },
+	{ -68, 32, -102, -39 },
+	{ -56, 78, -84, -39 },
+	{ -56, 78, -84, -39 },
+	{ -47, 95, -70, -39 },
+	{ -47, 95, -70, -39 },
+	{ -53, 85, -78, -39 },
+	{ -53, 85, -78, -39 },
+	{ -24, 32, -121, -40 },
+	{ -24, 32, -121, -40 },
+	{ -20, 77, -99, -41 },
+	{ -19, 77, -99, -41 },
+	{ -16, 95, -82, -40 },
+	{ -16, 95, -82, -40 },
+	{ -18, 85, -93, -40 },
+	{ -18, 85, -93, -40 },
+	{ 24, 32, -121, -42 },
+	{ 24, 32, -121, -42 },
+	{ 20, 77, -99, -42 },
+	{ 19, 77, -99, -42 },
+	{ 16, 95, -82, -41 },
+	{ 16, 95, -82, -41 },
+	{ 18, 85, -93, -41 },
+	{ 18, 85, -93, -41 },
+	{ 68, 32, -102, -43 },
+	{ 68, 32, -102, -43 },
+	{ 56, 78, -84, -43 },
+	{ 56, 78, -84, -43 },
+	{ 47, 95, -70, -42 },
+	{ 47, 95, -70, -42 },
+	{ 53, 85, -78, -42 },
+	{ 53, 85, -78, -42 },
+	{ 102, 32, -68, -44 },
+	{ 102, 32, -68, -44 },
+	{ 84, 78, -56, -44 },
+	{ 84, 78, -56, -44 },
+	{ 70, 95, -47, -42 },
+	{ 70, 95, -47, -42 },
+	{ 78, 85, -53, -43 },
+	{ 78, 85, -53, -43 },
+	{ 121, 32, -24, -45 },
+	{ 121, 32, -24, -45 },
+	{ 99, 77, -20, -45 },
+	{ 99, 77, -20, -45 },
+	{ 82, 95, -16, -43 },
+	{ 82, 95, -16, -43 },
+	{ 93, 85, -18, -44 },
+	{ 93, 85, -18, -44 },
+	{ 121, 32, 24, -45 },
+	{ 121, 32, 24, -45 },
+	{ 99, 77, 20, -45 },
+	{ 99, 77, 20, -45 },
+	{ 82, 95, 16, -43 },
+	{ 82, 95, 16, -43 },
+	{ 93, 85, 18, -44 },
+	{ 93, 85, 18, -44 },
+	{ 102, 32, 68, -44 },
+	{ 102, 32, 68, -44 },
+	{ 84, 78, 56, -44 },
+	{ 84, 78, 56, -44 },
+	{ 70, 95, 47, -42 },
+	{ 70, 95, 47, -42 },
+	{ 78, 85, 53, -43 },
+	{ 78, 85, 53, -43 },
+	{ 68, 32, 102, -43 },
+	{ 68, 32, 102, -43 },
+	{ 56, 78, 84, -43 },
+	{ 56, 78, 84, -43 },
+	{ 47, 95, 70, -42 },
+	{ 47, 95, 70, -42 },
+	{ 53, 85, 78, -42 },
+	{ 53, 85, 78, -42 },
+	{ 24, 32, 121, -42 },
+	{ 24, 32, 121, -42 },
+	{ 19, 77, 99, -42 },
+	{ 19, 77, 99, -42 },
+	{ 16, 95, 82, -41 },
+	{ 16, 95, 82, -41 },
+	{ 18, 85, 93, -41 },
+	{ 18, 85, 93, -41 },
+	{ -24, 32, 121, -40 },
+	{ -24, 32, 121, -40 },
+	{ -20, 77, 99, -41 },
+	{ -19, 77, 99, -41 },
+	{ -16, 95, 82, -40 },
+	{ -16, 95, 82, -40 },
+	{ -18, 85, 93, -40 },
+	{ -18, 85, 93, -40 },
+	{ -68, 32, 102, -39 },
+	{ -68, 32, 102, -39 },
+	{ -56, 78, 84, -39 },
+	{ -56, 78, 84, -39 },
+	{ -47, 95, 70, -39 },
+	{ -47, 95, 70, -39 },
+	{ -53, 85, 78, -39 },
+	{ -52, 85, 78, -39 },
+	{ -102, 32, 68, -38 },
+	{ -102, 32, 68, -38 },
+	{ -84, 78, 56, -39 },
+	{ -84, 78, 56, -39 },
+	{ -70, 95, 47, -38 },
+	{ -70, 95, 47, -38 },
+	{ -78, 85, 53, -38 },
+	{ -78, 85, 53, -38 },
+	{ -121, 32, 24, -37 },
+	{ -121, 32, 24, -37 },
+	{ -99, 77, 19, -38 },
+	{ -99, 77, 19, -38 },
+	{ -82, 95, 16, -37 },
+	{ -82, 95, 16, -37 },
+	{ -93, 85, 18, -37 },
+	{ -93, 85, 18, -37 },
+	{ -107, 66, -21, -36 },
+	{ -107, 66, -21, -36 },
+	{ -32, 123, -6, -35 },
+	{ -32, 123, -6, -35 },
+	{ -10, 127, -2, -32 },
+	{ -10, 127, -2, -32 },
+	{ -2, 127, 0, -31 },
+	{ 0, 0, 0, 0 },
+	{ -90, 66, -60, -37 },
+	{ -90, 66, -60, -37 },
+	{ -27, 123, -18, -35 },
+	{ -27, 123, -18, -35 },
+	{ -8, 127, -5, -32 },
+	{ -8, 127, -5, -32 },
+	{ -2, 127, -1, -31 },
+	{ 0, 0, 0, 0 },
+	{ -60, 66, -90, -38 },
+	{ -60, 66, -90, -38 },
+	{ -18, 123, -27, -35 },
+	{ -18, 123, -27, -35 },
+	{ -5, 127, -8, -32 },
+	{ -5, 127, -8, -32 },
+	{ -1, 127, -2, -31 },
+	{ 0, 0, 0, 0 },
+	{ -21, 66, -107, -39 },
+	{ -21, 66, -107, -39 },
+	{ -6, 123, -32, -35 },
+	{ -6, 123, -32, -35 },
+	{ -2, 127, -10, -32 },
+	{ -2, 127, -10, -32 },
+	{ 0, 127, -2, -31 },
+	{ 0, 0, 0, 0 },
+	{ 21, 66, -107, -40 },
+	{ 21, 66, -107, -40 },
+	{ 6, 123, -32, -36 },
+	{ 6, 123, -32, -36 },
+	{ 2, 127, -10, -32 },
+	{ 2, 127, -10, -32 },
+	{ 0, 127, -2, -31 },
+	{ 0, 0, 0, 0 },
+	{ 60, 66, -90, -42 },
+	{ 60, 66, -90, -42 },
+	{ 18, 123, -27, -36 },
+	{ 18, 123, -27, -36 },
+	{ 5, 127, -8, -32 },
+	{ 5, 127, -8, -32 },
+	{ 1, 127, -2, -31 },
+	{ 0, 0, 0, 0 },
+	{ 90, 66, -60, -43 },
+	{ 90, 66, -60, -43 },
+	{ 27, 123, -18, -37 },
+	{ 27, 123, -18, -37 },
+	{ 8, 127, -5, -32 },
+	{ 8, 127, -5, -32 },
+	{ 2, 127, -1, -31 },
+	{ 0, 0, 0, 0 },
+	{ 107, 66, -21, -43 },
+	{ 107, 66, -21, -43 },
+	{ 32, 123, -6, -37 },
+	{ 32, 123, -6, -37 },
+	{ 10, 127, -2, -32 },
+	{ 10, 127, -2, -32 },
+	{ 2, 127, 0, -31 },
+	{ 0, 0, 0, 0 },
+	{ 107, 66, 21, -43 },
+	{ 107, 66, 21, -43 },
+	{ 32, 123, 6, -37 },
+	{ 32, 123, 6, -37 },
+	{ 10, 127, 2, -32 },
+	{ 10, 127, 2, -32 },
+	{ 2, 127, 0, -31 },
+	{ 0, 0, 0, 0 },
+	{ 90, 66, 60, -43 },
+	{ 90, 66, 60, -43 },
+	{ 27, 123, 18, -37 },
+	{ 27, 123, 18, -37 },
+	{ 8, 127, 5, -32 },
+	{ 8, 127, 5, -32 },
+	{ 2, 127, 1, -31 },
+	{ 0, 0, 0, 0 },
+	{ 60, 66, 90, -42 },
+	{ 60, 66, 90, -42 },
+	{ 18, 123, 27, -36 },
+	{ 18, 123, 27, -36 },
+	{ 5, 127, 8, -32 },
+	{ 5, 127, 8, -32 },
+	{ 1, 127, 2, -31 },
+	{ 0, 0, 0, 0 },
+	{ 21, 66, 107, -40 },
+	{ 21, 66, 107, -40 },
+	{ 6, 123, 32, -36 },
+	{ 6, 123, 32, -36 },
+	{ 2, 127, 10, -32 },
+	{ 2, 127, 10, -32 },
+	{ 0, 127, 2, -31 },
+	{ 0, 0, 0, 0 },
+	{ -21, 66, 107, -39 },
+	{ -21, 66, 107, -39 },
+	{ -6, 123, 32, -35 },
+	{ -6, 123, 32, -35 },
+	{ -2, 127, 10, -32 },
+	{ -2, 127, 10, -32 },
+	{ 0, 127, 2, -31 },
+	{ 0, 0, 0, 0 },
+	{ -60, 66, 90, -38 },
+	{ -60, 66, 90, -38 },
+	{ -18, 123, 27, -35 },
+	{ -18, 123, 27, -35 },
+	{ -5, 127, 8, -32 },
+	{ -5, 127, 8, -32 },
+	{ -1, 127, 2, -31 },
+	{ 0, 0, 0, 0 },
+	{ -90, 66, 60, -37 },
+	{ -90, 66, 60, -37 },
+	{ -27, 123, 18, -35 },
+	{ -27, 123, 18, -35 },
+	{ -8, 127, 5, -32 },
+	{ -8, 127, 5, -32 },
+	{ -2, 127, 1, -31 },
+	{ 0, 0, 0, 0 },
+	{ -107, 66, 21, -36 },
+	{ -107, 66, 21, -36 },
+	{ -32, 123, 6, -35 },
+	{ -32, 123, 6, -35 },
+	{ -10, 127, 2, -32 },
+	{ -10, 127, 2, -32 },
+	{ -2, 127, 0, -31 },
+	{ 0, 0, 0, 0 },
+	{ -1, 124, -26, 9 },
+	{ -1, 124, -26, 9 },
+	{ -10, 124, -26, 12 },
+	{ -9, 124, -24, 12 },
+	{ -40, 117, -29, 24 },
+	{ -37, 119, -24, 23 },
+	{ -109, 55, -35, 51 },
+	{ -107, 61, -30, 51 },
+	{ -1, 75, -103, 3 },
+	{ -1, 75, -102, 3 },
+	{ -7, 74, -103, 5 },
+	{ -6, 77, -101, 5 },
+	{ -25, 62, -108, 12 },
+	{ -25, 73, -101, 13 },
+	{ -55, 23, -112, 23 },
+	{ -59, 30, -108, 25 },
+	{ 1, -75, -102, -10 },
+	{ 1, -75, -102, -10 },
+	{ 7, -73, -103, -13 },
+	{ 7, -77, -101, -13 },
+	{ 27, -60, -108, -20 },
+	{ 28, -69, -103, -21 },
+	{ 56, -21, -112, -31 },
+	{ 60, -26, -109, -33 },
+	{ 1, -124, -26, -13 },
+	{ 1, -124, -26, -13 },
+	{ 13, -124, -26, -18 },
+	{ 12, -124, -25, -17 },
+	{ 53, -111, -31, -34 },
+	{ 51, -113, -27, -33 },
+	{ 115, -41, -35, -59 },
+	{ 115, -43, -32, -59 },
+	{ 1, -124, 26, -13 },
+	{ 1, -124, 26, -13 },
+	{ 12, -124, 26, -17 },
+	{ 13, -124, 25, -18 },
+	{ 51, -112, 30, -33 },
+	{ 53, -112, 27, -34 },
+	{ 114, -43, 35, -59 },
+	{ 116, -42, 32, -59 },
+	{ 1, -75, 103, -10 },
+	{ 1, -75, 102, -10 },
+	{ 7, -74, 103, -12 },
+	{ 8, -76, 101, -13 },
+	{ 25, -62, 108, -20 },
+	{ 30, -66, 104, -22 },
+	{ 55, -23, 112, -31 },
+	{ 60, -23, 110, -33 },
+	{ -1, 75, 103, 3 },
+	{ -1, 75, 102, 3 },
+	{ -6, 74, 103, 5 },
+	{ -7, 77, 101, 6 },
+	{ -22, 65, 107, 11 },
+	{ -28, 69, 103, 14 },
+	{ -53, 27, 112, 22 },
+	{ -60, 26, 109, 25 },
+	{ -1, 124, 26, 9 },
+	{ -1, 124, 26, 9 },
+	{ -9, 124, 26, 12 },
+	{ -10, 124, 25, 12 },
+	{ -37, 118, 29, 23 },
+	{ -41, 118, 25, 24 },
+	{ -106, 60, 35, 50 },
+	{ -110, 56, 31, 52 },
+	{ -120, -23, -33, 54 },
+	{ -120, -23, -33, 54 },
+	{ -108, -57, -34, 48 },
+	{ -110, -55, -30, 49 },
+	{ -90, -84, -31, 41 },
+	{ -94, -83, -24, 43 },
+	{ -65, -106, -27, 33 },
+	{ -67, -105, -23, 34 },
+	{ -61, -12, -111, 25 },
+	{ -61, -12, -111, 25 },
+	{ -53, -31, -111, 21 },
+	{ -60, -32, -108, 24 },
+	{ -45, -47, -109, 19 },
+	{ -57, -53, -100, 24 },
+	{ -36, -62, -105, 16 },
+	{ -42, -68, -99, 19 },
+	{ 61, 12, -111, -32 },
+	{ 61, 12, -111, -33 },
+	{ 52, 33, -111, -28 },
+	{ 58, 34, -108, -31 },
+	{ 43, 49, -109, -25 },
+	{ 53, 55, -102, -30 },
+	{ 35, 62, -105, -23 },
+	{ 39, 68, -100, -25 },
+	{ 120, 24, -33, -59 },
+	{ 120, 24, -33, -59 },
+	{ 103, 67, -34, -51 },
+	{ 104, 66, -30, -52 },
+	{ 80, 94, -31, -43 },
+	{ 82, 93, -26, -44 },
+	{ 59, 109, -28, -36 },
+	{ 61, 109, -25, -36 },
+	{ 120, 24, 33, -59 },
+	{ 120, 24, 33, -59 },
+	{ 104, 65, 34, -52 },
+	{ 103, 67, 31, -52 },
+	{ 81, 92, 31, -43 },
+	{ 80, 95, 26, -43 },
+	{ 60, 108, 28, -36 },
+	{ 60, 109, 25, -36 },
+	{ 61, 12, 111, -32 },
+	{ 61, 12, 111, -32 },
+	{ 53, 31, 111, -29 },
+	{ 56, 35, 108, -31 },
+	{ 45, 47, 109, -26 },
+	{ 50, 56, 102, -29 },
+	{ 36, 62, 105, -24 },
+	{ 38, 68, 101, -25 },
+	{ -61, -12, 111, 25 },
+	{ -61, -12, 111, 25 },
+	{ -54, -28, 111, 21 },
+	{ -58, -34, 108, 24 },
+	{ -48, -45, 109, 20 },
+	{ -53, -55, 102, 23 },
+	{ -38, -61, 105, 17 },
+	{ -39, -68, 100, 18 },
+	{ -120, -23, 33, 54 },
+	{ -120, -23, 33, 54 },
+	{ -109, -55, 34, 49 },
+	{ -109, -58, 30, 49 },
+	{ -92, -81, 31, 42 },
+	{ -91, -85, 24, 42 },
+	{ -67, -105, 27, 34 },
+	{ -66, -106, 23, 34 },
+	{ 30, -117, -41, 10 },
+	{ 27, -118, -37, 9 },
+	{ 96, -77, -32, 30 },
+	{ 96, -76, -34, 30 },
+	{ 114, -47, -31, 37 },
+	{ 113, -40, -41, 37 },
+	{ 93, -78, -39, 26 },
+	{ 91, -65, -61, 27 },
+	{ 9, -51, -116, -2 },
+	{ 8, -57, -113, -2 },
+	{ 30, -49, -113, 4 },
+	{ 31, -52, -112, 5 },
+	{ 43, -42, -112, 9 },
+	{ 40, -39, -114, 8 },
+	{ 35, -48, -112, 6 },
+	{ 27, -36, -119, 4 },
+	{ -27, 50, -114, -19 },
+	{ -27, 50, -114, -19 },
+	{ -75, 24, -100, -32 },
+	{ -70, 14, -105, -31 },
+	{ -74, 9, -103, -32 },
+	{ -56, -9, -114, -26 },
+	{ -42, 33, -115, -18 },
+	{ -28, 9, -124, -15 },
+	{ -50, 110, -38, -28 },
+	{ -49, 111, -37, -28 },
+	{ -110, 58, -28, -43 },
+	{ -110, 55, -32, -43 },
+	{ -117, 38, -30, -46 },
+	{ -116, 32, -41, -46 },
+	{ -83, 88, -37, -29 },
+	{ -83, 79, -55, -29 },
+	{ -49, 111, 38, -28 },
+	{ -50, 111, 37, -28 },
+	{ -111, 56, 28, -43 },
+	{ -109, 57, 32, -43 },
+	{ -119, 35, 29, -46 },
+	{ -114, 37, 41, -45 },
+	{ -87, 85, 38, -30 },
+	{ -79, 84, 53, -27 },
+	{ -27, 50, 114, -19 },
+	{ -27, 50, 114, -19 },
+	{ -78, 22, 98, -33 },
+	{ -66, 19, 107, -29 },
+	{ -79, 3, 99, -34 },
+	{ -54, 0, 115, -25 },
+	{ -45, 25, 116, -20 },
+	{ -28, 17, 123, -13 },
+	{ 6, -51, 116, -3 },
+	{ 11, -56, 113, -1 },
+	{ 28, -50, 114, 4 },
+	{ 33, -50, 112, 6 },
+	{ 45, -40, 112, 10 },
+	{ 39, -41, 114, 8 },
+	{ 38, -43, 113, 7 },
+	{ 27, -41, 117, 3 },
+	{ 27, -117, 41, 9 },
+	{ 30, -118, 37, 10 },
+	{ 97, -76, 32, 30 },
+	{ 95, -77, 34, 29 },
+	{ 116, -41, 30, 38 },
+	{ 110, -48, 41, 35 },
+	{ 98, -70, 40, 29 },
+	{ 86, -74, 57, 24 },
+	{ 56, -107, -38, 8 },
+	{ 60, -103, -44, 10 },
+	{ 31, -121, -22, -4 },
+	{ 32, -121, -23, -4 },
+	{ -69, -88, 61, -40 },
+	{ -73, -81, 65, -41 },
+	{ -74, 83, 61, -19 },
+	{ -81, 78, 60, -22 },
+	{ 24, -70, -103, -2 },
+	{ 23, -62, -108, -1 },
+	{ 14, -111, -60, -10 },
+	{ 14, -113, -56, -11 },
+	{ -10, -104, 73, -17 },
+	{ -10, -102, 76, -17 },
+	{ -22, 14, 124, -6 },
+	{ -25, 8, 124, -8 },
+	{ -27, 35, -119, -11 },
+	{ -25, 18, -123, -12 },
+	{ -18, -76, -100, -21 },
+	{ -11, -96, -82, -20 },
+	{ 14, -114, 53, -8 },
+	{ 13, -115, 53, -9 },
+	{ 21, -66, 107, 3 },
+	{ 22, -65, 107, 3 },
+	{ -53, 110, -35, -11 },
+	{ -56, 106, -41, -13 },
+	{ -91, 57, -68, -37 },
+	{ -97, 17, -81, -46 },
+	{ 27, -123, 19, -4 },
+	{ 27, -123, 19, -4 },
+	{ 45, -113, 35, 6 },
+	{ 46, -113, 34, 7 },
+	{ -56, 108, 37, -13 },
+	{ -53, 109, 38, -11 },
+	{ -99, 25, 75, -46 },
+	{ -88, 55, 72, -36 },
+	{ 27, -123, -19, -4 },
+	{ 27, -123, -20, -4 },
+	{ 46, -113, -36, 7 },
+	{ 45, -114, -33, 6 },
+	{ -28, 24, 122, -13 },
+	{ -25, 30, 121, -10 },
+	{ -15, -93, 85, -22 },
+	{ -15, -78, 99, -20 },
+	{ 14, -115, -53, -9 },
+	{ 14, -114, -53, -8 },
+	{ 21, -64, -107, 3 },
+	{ 22, -67, -106, 3 },
+	{ 24, -64, 107, -1 },
+	{ 22, -68, 105, -2 },
+	{ 14, -113, 57, -11 },
+	{ 15, -111, 59, -10 },
+	{ -10, -102, -76, -17 },
+	{ -9, -104, -72, -17 },
+	{ -22, 4, -125, -7 },
+	{ -25, 19, -123, -6 },
+	{ 61, -104, 41, 10 },
+	{ 56, -107, 41, 8 },
+	{ 32, -121, 22, -4 },
+	{ 31, -121, 22, -4 },
+	{ -73, -82, -64, -41 },
+	{ -68, -88, -61, -40 },
+	{ -79, 76, -65, -22 },
+	{ -75, 86, -56, -19 },
+	{ 0, 0, 0, 0 },
+	{ -18, -126, -4, -30 },
+	{ -124, 16, -24, 1 },
+	{ -124, 16, -24, 1 },
+	{ -95, 82, -19, 16 },
+	{ -95, 82, -19, 16 },
+	{ -125, -3, -24, 0 },
+	{ -125, -3, -25, 0 },
+	{ 0, 0, 0, 0 },
+	{ -15, -126, -10, -30 },
+	{ -105, 16, -70, 1 },
+	{ -105, 16, -70, 1 },
+	{ -80, 83, -54, 16 },
+	{ -80, 83, -54, 16 },
+	{ -106, -3, -71, -1 },
+	{ -105, -3, -71, -1 },
+	{ 0, 0, 0, 0 },
+	{ -10, -126, -15, -30 },
+	{ -70, 16, -105, 0 },
+	{ -70, 16, -105, 0 },
+	{ -54, 83, -80, 15 },
+	{ -54, 83, -80, 15 },
+	{ -71, -3, -106, -2 },
+	{ -71, -3, -106, -2 },
+	{ 0, 0, 0, 0 },
+	{ -4, -126, -18, -31 },
+	{ -24, 16, -124, -2 },
+	{ -24, 16, -124, -2 },
+	{ -19, 82, -95, 14 },
+	{ -19, 82, -95, 14 },
+	{ -24, -3, -125, -4 },
+	{ -25, -3, -125, -4 },
+	{ 0, 0, 0, 0 },
+	{ 4, -126, -18, -31 },
+	{ 24, 16, -124, -4 },
+	{ 24, 16, -124, -4 },
+	{ 19, 82, -95, 13 },
+	{ 19, 82, -95, 13 },
+	{ 24, -3, -125, -5 },
+	{ 25, -3, -125, -5 },
+	{ 0, 0, 0, 0 },
+	{ 10, -126, -15, -31 },
+	{ 70, 16, -105, -5 },
+	{ 70, 16, -105, -5 },
+	{ 54, 83, -80, 11 },
+	{ 54, 83, -80, 11 },
+	{ 71, -3, -106, -7 },
+	{ 71, -3, -106, -7 },
+	{ 0, 0, 0, 0 },
+	{ 15, -126, -10, -31 },
+	{ 105, 16, -70, -6 },
+	{ 105, 16, -70, -6 },
+	{ 80, 83, -54, 11 },
+	{ 80, 83, -54, 11 },
+	{ 106, -3, -70, -8 },
+	{ 106, -3, -71, -8 },
+	{ 0, 0, 0, 0 },
+	{ 18, -126, -4, -31 },
+	{ 124, 16, -24, -7 },
+	{ 124, 16, -24, -7 },
+	{ 95, 82, -19, 10 },
+	{ 95, 82, -19, 10 },
+	{ 125, -3, -25, -9 },
+	{ 125, -3, -25, -9 },
+	{ 0, 0, 0, 0 },
+	{ 18, -126, 4, -31 },
+	{ 124, 16, 24, -7 },
+	{ 124, 16, 24, -7 },
+	{ 95, 82, 19, 10 },
+	{ 95, 82, 19, 10 },
+	{ 125, -3, 25, -9 },
+	{ 125, -3, 25, -9 },
+	{ 0, 0, 0, 0 },
+	{ 15, -126, 10, -31 },
+	{ 105, 16, 70, -6 },
+	{ 105, 16, 70, -6 },
+	{ 80, 83, 54, 11 },
+	{ 80, 83, 54, 11 },
+	{ 106, -3, 70, -8 },
+	{ 106, -3, 71, -8 },
+	{ 0, 0, 0, 0 },
+	{ 10, -126, 15, -31 },
+	{ 70, 16, 105, -5 },
+	{ 70, 16, 105, -5 },
+	{ 54, 83, 80, 11 },
+	{ 54, 83, 80, 11 },
+	{ 71, -3, 106, -7 },
+	{ 71, -3, 106, -7 },
+	{ 0, 0, 0, 0 },
+	{ 4, -126, 18, -31 },
+	{ 24, 16, 124, -4 },
+	{ 24, 16, 124, -4 },
+	{ 19, 82, 95, 13 },
+	{ 19, 82, 95, 13 },
+	{ 24, -3, 125, -5 },
+	{ 25, -3, 125, -5 },
+	{ 0, 0, 0, 0 },
+	{ -4, -126, 18, -31 },
+	{ -24, 16, 124, -2 },
+	{ -24, 16, 124, -2 },
+	{ -19, 82, 95, 14 },
+	{ -19, 82, 95, 14 },
+	{ -24, -3, 125, -4 },
+	{ -25, -3, 125, -4 },
+	{ 0, 0, 0, 0 },
+	{ -10, -126, 15, -30 },
+	{ -70, 16, 105, 0 },
+	{ -70, 16, 105, 0 },
+	{ -54, 83, 80, 15 },
+	{ -54, 83, 80, 15 },
+	{ -71, -3, 106, -2 },
+	{ -71, -3, 106, -2 },
+	{ 0, 0, 0, 0 },
+	{ -15, -126, 10, -30 },
+	{ -105, 16, 70, 1 },
+	{ -105, 16, 70, 1 },
+	{ -80, 83, 54, 16 },
+	{ -80, 83, 54, 16 },
+	{ -106, -3, 71, -1 },
+	{ -105, -3, 71, -1 },
+	{ 0, 0, 0, 0 },
+	{ -18, -126, 4, -30 },
+	{ -124, 16, 24, 1 },
+	{ -124, 16, 24, 1 },
+	{ -95, 82, 19, 16 },
+	{ -95, 82, 19, 16 },
+	{ -125, -3, 24, 0 },
+	{ -125, -3, 25, 0 },
+	{ -42, -120, -8, -21 },
+	{ -42, -120, -8, -21 },
+	{ -21, -125, -4, -21 },
+	{ -21, -125, -4, -21 },
+	{ -23, -125, -5, -21 },
+	{ -23, -125, -5, -21 },
+	{ -67, -107, -13, -25 },
+	{ -67, -107, -13, -25 },
+	{ -35, -120, -24, -21 },
+	{ -35, -120, -24, -21 },
+	{ -17, -125, -12, -21 },
+	{ -17, -125, -12, -21 },
+	{ -19, -125, -13, -21 },
+	{ -19, -125, -13, -21 },
+	{ -56, -108, -38, -25 },
+	{ -56, -107, -38, -25 },
+	{ -24, -120, -35, -21 },
+	{ -23, -120, -35, -21 },
+	{ -12, -125, -17, -21 },
+	{ -12, -125, -17, -21 },
+	{ -13, -125, -19, -21 },
+	{ -13, -125, -19, -21 },
+	{ -38, -108, -56, -26 },
+	{ -38, -107, -56, -26 },
+	{ -8, -120, -42, -22 },
+	{ -8, -120, -42, -22 },
+	{ -4, -125, -21, -22 },
+	{ -4, -125, -21, -22 },
+	{ -5, -125, -23, -22 },
+	{ -5, -125, -23, -22 },
+	{ -13, -107, -67, -27 },
+	{ -13, -107, -67, -27 },
+	{ 8, -120, -42, -23 },
+	{ 8, -120, -42, -23 },
+	{ 4, -125, -21, -22 },
+	{ 4, -125, -21, -22 },
+	{ 5, -125, -23, -22 },
+	{ 5, -125, -23, -22 },
+	{ 13, -107, -67, -28 },
+	{ 13, -107, -67, -28 },
+	{ 24, -120, -35, -23 },
+	{ 23, -120, -35, -23 },
+	{ 12, -125, -17, -22 },
+	{ 12, -125, -17, -22 },
+	{ 13, -125, -19, -22 },
+	{ 13, -125, -19, -22 },
+	{ 38, -107, -56, -29 },
+	{ 38, -107, -56, -29 },
+	{ 35, -120, -23, -23 },
+	{ 35, -120, -23, -23 },
+	{ 17, -125, -12, -22 },
+	{ 17, -125, -12, -22 },
+	{ 19, -125, -13, -23 },
+	{ 19, -125, -13, -23 },
+	{ 56, -107, -38, -29 },
+	{ 56, -107, -38, -29 },
+	{ 42, -120, -8, -24 },
+	{ 42, -120, -8, -24 },
+	{ 21, -125, -4, -22 },
+	{ 21, -125, -4, -22 },
+	{ 23, -125, -5, -23 },
+	{ 23, -125, -5, -23 },
+	{ 67, -107, -13, -29 },
+	{ 67, -107, -13, -29 },
+	{ 42, -120, 8, -24 },
+	{ 42, -120, 8, -24 },
+	{ 21, -125, 4, -22 },
+	{ 21, -125, 4, -22 },
+	{ 23, -125, 5, -23 },
+	{ 23, -125, 5, -23 },
+	{ 67, -107, 13, -29 },
+	{ 67, -107, 13, -29 },
+	{ 35, -120, 23, -23 },
+	{ 35, -120, 23, -23 },
+	{ 17, -125, 12, -22 },
+	{ 17, -125, 12, -22 },
+	{ 19, -125, 13, -23 },
+	{ 19, -125, 13, -23 },
+	{ 56, -107, 38, -29 },
+	{ 56, -107, 38, -29 },
+	{ 24, -120, 35, -23 },
+	{ 23, -120, 35, -23 },
+	{ 12, -125, 17, -22 },
+	{ 12, -125, 17, -22 },
+	{ 13, -125, 19, -22 },
+	{ 13, -125, 19, -22 },
+	{ 38, -107, 56, -29 },
+	{ 38, -108, 56, -29 },
+	{ 8, -120, 42, -23 },
+	{ 8, -120, 42, -23 },
+	{ 4, -125, 21, -22 },
+	{ 4, -125, 21, -22 },
+	{ 5, -125, 23, -22 },
+	{ 5, -125, 23, -22 },
+	{ 13, -107, 67, -28 },
+	{ 13, -107, 67, -28 },
+	{ -8, -120, 42, -22 },
+	{ -8, -120, 42, -22 },
+	{ -4, -125, 21, -22 },
+	{ -4, -125, 21, -22 },
+	{ -5, -125, 23, -22 },
+	{ -5, -125, 23, -22 },
+	{ -13, -107, 67, -27 },
+	{ -13, -107, 67, -27 },
+	{ -24, -120, 35, -21 },
+	{ -23, -120, 35, -21 },
+	{ -12, -125, 17, -21 },
+	{ -12, -125, 17, -21 },
+	{ -13, -125, 19, -21 },
+	{ -13, -125, 19, -21 },
+	{ -38, -108, 56, -26 },
+	{ -38, -108, 56, -26 },
+	{ -35, -120, 24, -21 },
+	{ -35, -120, 24, -21 },
+	{ -17, -125, 12, -21 },
+	{ -17, -125, 12, -21 },
+	{ -19, -125, 13, -21 },
+	{ -19, -125, 13, -21 },
+	{ -56, -107, 38, -25 },
+	{ -56, -108, 38, -25 },
+	{ -42, -120, 8, -21 },
+	{ -42, -120, 8, -21 },
+	{ -21, -125, 4, -21 },
+	{ -21, -125, 4, -21 },
+	{ -23, -125, 5, -21 },
+	{ -23, -125, 5, -21 },
+	{ -67, -107, 13, -25 },
+	{ -67, -107, 13, -25 },
+};
@@ -0,0 +1,611 @@
+static const struct { uint16_t w, h, levels, format; uint8_t d[]; } box_texture_mips =
+{
+  128, 128, 6, R3D_TEXTURE_BC1,
+  "\344\232\301\50\13\267\256\222\345\222\300\70\10\252\2\325\46\233"
+  "\201\131\253\177\42\346\206\263\1\101\372\252\250\325\105\243\141\121"
+  "\367\376\240\255\305\232\3\162\355\51\277\76\146\263\2\162\375\212"
+  "\375\17\106\253\2\162\177\242\137\202\206\263\302\141\325\2\365\352"
+  "\45\243\343\151\376\240\367\333\45\233\303\141\367\240\252\50\5\233"
+  "\201\131\72\257\152\0\206\263\343\151\275\337\53\172\146\253\202\121"
+  "\252\137\0\352\145\253\202\121\277\135\200\252\106\253\300\60\252\131"
+  "\0\253\145\253\1\101\242\325\0\212\206\263\300\70\252\127\0\257"
+  "\206\263\102\111\253\325\0\377\105\253\202\121\252\125\0\353\45\243"
+  "\101\111\72\165\40\252\206\263\340\70\12\367\2\252\46\243\142\111"
+  "\0\375\200\210\206\263\41\101\0\325\252\252\105\253\202\131\240\365"
+  "\276\252\304\222\302\141\140\245\12\40\45\243\101\111\375\362\272\200"
+  "\304\222\142\121\253\136\212\0\244\212\201\131\270\365\43\256\305\222"
+  "\201\141\52\367\254\242\244\212\101\121\0\170\240\352\244\222\100\20"
+  "\100\232\256\217\304\222\1\71\140\210\212\212\344\222\102\111\372\351"
+  "\346\244\5\233\242\141\55\165\375\16\304\222\141\121\0\173\303\370"
+  "\304\222\341\70\0\277\0\137\345\222\142\121\42\177\0\157\5\233"
+  "\142\121\376\375\0\131\345\222\102\111\373\253\200\371\45\243\302\141"
+  "\55\127\352\336\5\233\142\121\250\257\176\367\244\222\41\101\12\0"
+  "\132\276\45\243\343\141\52\10\177\12\206\263\41\121\12\52\327\200"
+  "\106\253\202\121\232\250\333\210\345\222\242\131\300\236\253\176\345\222"
+  "\141\131\354\42\252\365\5\233\43\162\251\241\252\47\10\304\103\172"
+  "\252\53\127\377\111\314\103\172\253\370\365\357\207\253\203\212\360\156"
+  "\2\252\146\253\302\131\327\252\40\50\146\253\41\101\172\42\350\40"
+  "\146\253\102\111\125\212\252\252\146\253\242\131\167\250\252\202\5\233"
+  "\242\131\267\252\352\12\5\243\202\131\52\177\335\342\45\243\41\111"
+  "\0\377\373\137\146\243\41\111\200\377\337\377\304\222\101\121\0\253"
+  "\127\256\244\212\242\141\2\256\265\170\204\212\140\30\200\112\260\276"
+  "\304\232\140\30\201\202\202\202\245\212\242\141\210\316\111\177\345\232"
+  "\100\30\34\154\354\254\146\253\341\70\12\252\251\377\146\243\340\70"
+  "\0\252\212\367\106\253\301\60\200\12\40\267\45\243\243\131\327\0"
+  "\0\252\105\243\41\101\167\40\2\373\45\243\102\111\165\0\0\377"
+  "\106\243\1\71\125\200\0\377\206\263\200\50\135\250\0\377\45\243"
+  "\240\50\347\352\0\277\106\243\101\121\165\277\250\252\244\212\242\131"
+  "\255\12\200\12\345\222\43\162\153\0\306\152\345\232\202\121\347\2"
+  "\357\243\244\212\241\50\250\0\127\250\5\233\1\71\353\10\325\256"
+  "\244\222\341\70\253\0\276\172\304\222\101\111\56\362\256\367\304\222"
+  "\141\121\200\337\137\251\345\222\0\101\210\352\367\40\244\212\141\121"
+  "\2\47\365\240\305\222\340\70\0\212\333\242\146\243\202\131\200\337"
+  "\235\357\344\222\2\152\362\11\52\154\305\222\242\131\177\40\257\372"
+  "\45\243\240\50\127\200\376\252\203\212\241\50\375\240\256\252\3\162"
+  "\42\101\167\0\0\0\204\212\140\40\125\2\300\252\244\212\100\30"
+  "\207\213\16\214\244\222\3\152\233\272\263\162\144\172\201\131\346\176"
+  "\114\112\5\233\240\60\256\204\344\204\244\212\201\131\243\313\216\311"
+  "\5\233\0\111\254\46\66\274\304\222\242\141\366\354\364\354\45\243"
+  "\43\162\252\252\254\204\5\233\241\50\1\11\3\3\304\222\242\141"
+  "\341\341\261\261\304\212\3\152\141\155\143\341\345\222\342\151\33\73"
+  "\277\252\204\202\142\111\203\41\41\11\244\212\342\151\250\262\230\226"
+  "\244\212\242\141\212\211\243\341\342\151\201\121\314\260\364\117\143\202"
+  "\300\70\61\61\243\263\103\172\101\121\130\164\374\272\204\212\1\101"
+  "\246\44\76\57\143\202\241\50\150\142\100\102\43\162\101\121\52\256"
+  "\267\76\244\212\300\60\253\273\253\211\143\202\141\121\272\272\230\232"
+  "\244\212\301\50\140\142\100\100\146\243\302\141\316\112\110\112\305\232"
+  "\242\131\357\150\366\66\105\253\142\121\204\246\246\256\244\212\241\50"
+  "\140\342\302\102\204\212\141\121\371\333\361\222\207\253\2\162\367\57"
+  "\243\73\244\212\241\141\211\213\252\351\304\222\101\121\54\46\66\246"
+  "\344\222\141\121\346\314\304\210\244\222\44\162\130\310\340\310\345\232"
+  "\1\101\356\352\162\162\46\243\100\30\244\244\244\254\45\243\1\101"
+  "\257\211\11\211\305\222\101\111\76\226\330\234\5\243\302\141\166\176"
+  "\126\374\106\243\204\202\206\356\206\4\45\243\341\60\1\1\43\251"
+  "\305\222\201\131\253\42\22\32\305\222\302\151\363\372\151\355\244\222"
+  "\342\151\222\232\271\273\43\172\102\101\1\1\1\3\204\202\141\131"
+  "\40\56\4\14\244\212\243\131\73\263\375\371\2\162\41\101\74\276"
+  "\356\332\103\202\0\101\241\243\43\243\43\172\41\111\272\250\260\220"
+  "\204\212\300\70\52\46\57\72\143\202\201\40\102\102\342\152\103\172"
+  "\141\131\227\36\230\130\204\202\340\70\213\211\311\341\244\212\201\131"
+  "\73\266\224\236\345\232\341\60\100\150\140\160\45\243\202\111\110\300"
+  "\140\340\146\253\101\111\66\36\76\76\344\232\41\111\214\206\12\16"
+  "\304\212\301\60\342\340\362\322\345\232\141\121\332\373\121\323\46\243"
+  "\343\151\42\43\23\31\304\222\41\111\217\201\11\213\244\212\101\121"
+  "\257\267\170\374\4\243\142\121\366\356\344\254\305\222\2\162\212\241"
+  "\243\212\304\222\202\121\343\352\150\262\207\253\300\70\266\366\264\270"
+  "\206\263\341\70\213\215\211\211\304\222\102\121\150\356\352\340\46\233"
+  "\302\141\274\374\374\344\146\253\3\162\16\56\64\64\345\232\301\50"
+  "\11\201\1\1\345\222\202\131\32\72\30\236\143\212\343\141\253\213"
+  "\216\206\345\232\342\151\273\263\22\23\244\222\102\111\251\201\251\241"
+  "\306\222\342\151\16\215\57\77\143\172\202\131\251\354\253\263\143\202"
+  "\142\121\136\174\356\370\244\222\141\121\271\231\261\361\43\172\101\111"
+  "\262\220\320\162\244\212\0\101\77\76\32\32\43\172\140\40\102\152"
+  "\312\312\204\202\101\121\237\253\271\261\244\222\300\60\351\255\253\213"
+  "\203\202\101\111\72\22\232\236\45\243\142\111\162\162\162\142\106\253"
+  "\142\121\320\220\220\362\45\243\202\131\64\66\64\66\45\243\342\161"
+  "\255\53\241\51\5\233\301\50\162\143\143\123\345\222\201\131\61\23"
+  "\62\222\206\253\141\121\43\241\211\252\206\263\201\131\313\356\317\215"
+  "\244\222\41\111\154\356\356\370\344\232\302\141\276\274\274\264\244\222"
+  "\343\151\2\203\232\32\207\253\242\131\372\363\332\363\106\243\242\131"
+  "\234\276\252\262\206\263\341\60\211\211\253\251\146\253\242\131\146\344"
+  "\356\266\45\243\343\151\170\172\176\376\207\253\43\172\26\46\356\250"
+  "\45\243\301\50\1\1\41\11\45\243\342\141\226\234\276\26\244\212"
+  "\343\151\307\307\211\15\146\253\242\141\233\73\73\72\105\253\341\60"
+  "\251\251\251\243\245\212\302\141\222\253\266\342\103\202\341\60\243\251"
+  "\253\363\203\212\101\111\254\236\334\130\244\222\101\111\361\371\331\321"
+  "\43\162\41\111\212\312\102\300\245\202\201\131\33\277\273\237\204\202"
+  "\301\60\112\102\153\143\204\202\101\121\353\317\311\216\304\212\101\111"
+  "\306\206\306\307\3\162\141\121\62\272\143\342\345\222\301\50\340\360"
+  "\160\150\45\243\341\70\220\220\220\320\106\253\242\131\26\66\64\236"
+  "\5\243\342\161\251\243\241\201\244\222\341\70\123\163\133\373\5\233"
+  "\202\131\232\62\220\242\247\263\43\172\253\217\313\255\206\263\101\111"
+  "\315\215\257\355\45\253\202\121\166\344\354\354\304\222\342\151\270\256"
+  "\366\266\304\222\342\151\32\52\42\40\247\263\242\131\363\363\322\322"
+  "\146\243\342\151\222\242\360\322\345\222\41\111\211\50\60\260\46\243"
+  "\302\141\264\244\264\274\305\212\142\121\276\72\72\220\207\253\245\202"
+  "\244\207\57\253\45\243\200\40\11\11\11\11\45\243\203\121\232\230"
+  "\230\270\244\212\202\121\201\1\203\241\46\243\2\152\32\52\50\262"
+  "\46\243\240\50\243\243\41\3\5\243\2\162\126\176\162\372\204\202"
+  "\102\111\163\142\360\273\304\222\300\60\330\360\360\160\304\222\141\121"
+  "\321\361\323\333\203\202\41\111\152\312\102\113\203\202\141\121\76\372"
+  "\152\354\204\212\301\60\142\142\310\350\204\212\242\141\207\215\255\213"
+  "\204\202\0\101\214\212\216\204\102\172\102\121\352\353\313\116\345\232"
+  "\341\60\170\150\150\172\45\243\240\50\220\260\260\220\5\243\343\151"
+  "\26\76\276\376\5\233\242\141\3\201\251\301\104\172\341\70\173\156"
+  "\164\376\5\233\302\141\142\142\140\102\45\243\3\162\212\252\220\232"
+  "\5\233\202\131\215\256\270\272\45\243\242\141\344\366\164\374\305\222"
+  "\41\101\56\270\70\220\106\253\2\162\373\271\253\241\247\263\101\111"
+  "\222\232\333\322\207\253\302\141\272\253\211\243\207\253\202\131\232\262"
+  "\273\262\106\253\303\141\376\164\146\166\6\233\302\141\232\222\323\263"
+  "\250\263\204\202\253\217\257\55\146\253\301\50\11\11\13\211\206\263"
+  "\202\121\230\232\234\374\204\212\242\131\43\63\243\1\5\233\142\111"
+  "\250\340\340\110\5\233\102\101\41\71\201\51\5\223\2\162\123\333"
+  "\161\242\305\222\202\131\337\367\56\47\244\212\240\60\160\142\343\342"
+  "\243\222\142\121\363\363\221\323\305\222\102\111\112\112\114\110\244\222"
+  "\141\121\354\354\356\344\345\222\1\71\150\150\142\140\204\212\241\141"
+  "\270\272\246\243\203\212\42\111\256\364\246\157\304\222\41\111\157\157"
+  "\117\117\5\233\341\60\170\140\140\140\106\253\301\60\220\220\230\220"
+  "\106\243\241\131\246\217\317\313\45\243\3\152\351\357\316\306\304\212"
+  "\300\60\356\374\174\166\345\222\141\121\300\200\342\100\51\304\302\141"
+  "\237\35\75\273\45\243\302\141\232\262\272\260\345\222\101\111\350\150"
+  "\112\112\106\243\201\131\332\372\163\263\105\253\104\172\103\353\353\311"
+  "\106\253\341\70\162\172\272\272\310\263\41\111\203\243\241\341\206\253"
+  "\102\111\262\260\230\230\45\253\243\121\356\272\254\344\46\243\343\141"
+  "\173\163\273\361\247\263\303\141\13\53\51\41\45\243\301\50\211\215"
+  "\11\211\246\273\202\121\230\334\332\336\244\212\302\151\43\53\244\254"
+  "\244\212\202\121\100\302\352\252\5\233\41\101\13\11\251\251\46\243"
+  "\141\131\363\241\371\272\244\222\102\111\73\35\53\253\344\232\301\60"
+  "\343\143\113\103\344\232\42\101\323\222\222\222\304\222\202\121\112\302"
+  "\112\313\344\232\101\111\346\116\354\374\244\222\1\71\160\160\360\150"
+  "\244\222\141\121\313\353\112\352\203\202\41\111\355\307\306\344\304\222"
+  "\41\101\117\117\353\113\5\243\301\50\150\150\142\152\146\253\140\40"
+  "\220\230\220\230\5\233\101\111\5\41\241\253\106\243\302\141\257\256"
+  "\244\254\244\212\1\71\166\164\176\144\5\233\240\60\100\100\250\252"
+  "\247\253\41\111\73\261\261\271\106\243\242\131\260\270\230\230\5\233"
+  "\202\131\153\163\350\154\105\253\202\121\353\313\353\153\105\253\3\162"
+  "\315\275\257\212\45\233\303\141\222\223\223\333\247\263\41\111\341\143"
+  "\241\251\207\263\41\111\220\223\260\362\5\233\2\101\314\314\154\354"
+  "\45\243\303\131\263\243\351\261\247\263\242\131\15\17\253\311\45\243"
+  "\241\40\15\15\51\251\45\233\302\141\334\336\336\336\244\222\3\162"
+  "\54\74\254\154\244\212\1\71\210\252\246\50\305\222\300\60\253\53"
+  "\51\271\244\212\302\141\43\242\252\147\345\232\202\131\273\35\55\271"
+  "\344\232\1\71\102\112\312\316\5\233\42\101\232\223\63\23\5\233"
+  "\303\141\152\213\13\57\345\222\142\121\344\146\347\347\305\222\1\71"
+  "\140\160\142\142\244\212\201\131\317\204\214\252\304\222\301\60\354\354"
+  "\352\346\305\222\41\111\112\152\313\312\103\172\241\50\102\103\152\343"
+  "\304\222\240\60\220\262\232\60\244\212\1\71\242\342\241\40\146\253"
+  "\141\121\274\364\144\344\345\232\300\60\170\344\356\357\345\222\243\131"
+  "\42\41\241\253\206\263\1\101\261\361\271\271\206\263\142\111\230\222"
+  "\262\262\5\233\1\101\312\312\116\316\304\232\202\121\343\303\211\303"
+  "\45\243\2\162\215\51\277\245\244\202\202\131\242\252\223\252\207\253"
+  "\142\121\273\253\273\241\105\243\102\111\240\60\230\20\5\243\41\101"
+  "\154\104\346\304\46\243\243\131\243\341\141\151\107\243\43\162\311\355"
+  "\367\157\204\202\240\50\41\43\61\41\345\222\41\111\270\230\32\230"
+  "\144\202\101\131\354\356\307\376\244\212\142\121\254\54\264\214\204\212"
+  "\300\60\43\261\241\241\203\212\242\131\216\156\314\210\304\222\243\131"
+  "\33\223\43\41\304\222\241\50\316\314\114\356\6\233\41\101\223\223"
+  "\273\262\345\222\202\131\213\251\11\12\144\202\142\121\272\350\370\230"
+  "\244\212\1\71\342\162\162\152\203\212\142\121\256\72\50\44\43\172"
+  "\301\50\206\204\246\204\244\212\141\121\217\245\215\315\244\212\301\50"
+  "\253\211\341\301\345\232\101\111\22\63\72\62\345\222\342\141\317\202"
+  "\303\311\206\263\141\121\344\244\256\257\244\212\41\101\145\107\106\114"
+  "\344\222\1\101\213\272\222\62\243\222\242\131\73\37\37\71\5\243"
+  "\141\111\260\60\23\23\305\222\101\111\156\146\356\116\5\243\101\111"
+  "\343\343\103\117\5\233\342\151\256\373\363\361\245\212\302\141\313\352"
+  "\313\41\46\233\302\141\41\57\13\15\146\253\303\141\230\232\72\52"
+  "\206\253\142\121\104\316\116\356\305\222\102\111\263\273\61\61\245\212"
+  "\342\151\352\303\303\103\244\212\200\40\251\241\263\61\346\222\201\131"
+  "\234\274\244\246\43\172\201\141\35\247\71\22\244\212\141\121\250\44"
+  "\256\212\5\233\301\60\271\261\61\23\244\212\142\121\250\210\244\254"
+  "\304\222\202\131\51\73\55\57\204\212\101\101\152\113\302\312\46\233"
+  "\41\111\223\222\262\253\304\222\303\131\3\11\12\213\244\212\341\70"
+  "\32\32\22\62\304\222\340\60\373\143\142\143\244\222\141\121\66\4"
+  "\56\17\143\202\341\70\246\246\66\74\244\212\1\101\257\47\77\55"
+  "\4\233\241\50\351\301\311\211\45\243\202\131\21\263\363\261\207\263"
+  "\241\141\257\311\313\312\246\263\302\141\264\364\264\354\46\233\41\101"
+  "\306\316\117\116\5\233\142\121\73\72\263\241\304\222\202\121\51\57"
+  "\13\51\206\263\202\121\271\73\61\53\45\243\202\131\146\313\353\153"
+  "\304\222\101\101\103\102\102\340\244\222\342\151\143\301\312\113\5\233"
+  "\202\131\251\53\373\361\45\233\243\131\15\15\55\7\307\273\343\151"
+  "\273\251\241\342\305\222\342\151\112\272\356\157\305\222\341\70\33\263"
+  "\61\72\245\212\3\162\141\242\112\203\106\253\140\30\271\261\241\241"
+  "\204\202\202\121\4\204\50\252\143\172\241\141\256\46\256\14\305\222"
+  "\302\141\346\224\244\274\146\253\1\71\271\261\221\261\5\233\302\151"
+  "\366\376\322\270\46\233\242\141\265\365\75\77\244\212\202\121\103\116"
+  "\350\140\345\222\302\141\351\261\21\363\244\212\303\131\201\201\1\12"
+  "\304\222\42\101\70\32\232\222\244\222\240\50\142\152\152\342\304\222"
+  "\101\121\207\206\252\352\304\222\1\101\272\74\230\22\143\202\241\50"
+  "\54\43\11\1\45\243\200\40\251\261\241\341\206\263\141\131\261\341"
+  "\141\341\345\232\43\162\240\250\176\352\246\263\142\111\374\164\144\344"
+  "\5\233\102\101\117\356\350\116\5\233\142\121\241\63\363\361\5\243"
+  "\141\121\51\211\13\53\106\243\242\141\41\43\3\42\5\233\302\141"
+  "\341\151\353\155\5\233\142\121\170\170\162\170\244\222\3\162\113\253"
+  "\313\52\345\222\102\111\361\141\151\351\105\243\243\131\216\47\257\46"
+  "\247\263\3\162\343\352\353\341\304\222\41\111\316\344\204\214\304\222"
+  "\1\101\223\73\263\223\5\233\302\141\53\15\11\57\345\222\301\50"
+  "\41\51\201\53\345\222\302\141\75\75\55\255\244\202\302\151\47\253"
+  "\51\51\304\222\142\121\52\273\32\43\105\253\1\71\261\261\71\31"
+  "\304\222\343\151\250\314\256\117\344\222\41\111\73\32\72\222\304\222"
+  "\242\131\142\172\340\362\5\233\2\152\245\17\253\251\345\222\302\141"
+  "\356\266\74\344\244\212\102\111\230\362\142\142\144\202\341\70\142\162"
+  "\142\150\304\222\201\131\245\255\217\215\5\233\341\100\220\222\262\272"
+  "\143\202\240\60\201\251\311\101\5\233\341\70\341\311\341\351\45\243"
+  "\41\101\361\263\343\353\344\232\202\121\16\244\64\256\106\243\41\101"
+  "\374\164\374\344\105\243\1\101\316\146\346\307\4\243\41\101\363\171"
+  "\341\251\5\233\342\151\16\7\217\307\46\243\103\172\253\204\246\356"
+  "\305\222\141\121\313\356\316\112\105\243\101\111\372\162\162\362\304\222"
+  "\302\151\213\15\12\254\144\202\42\101\251\363\361\343\5\233\141\121"
+  "\6\56\57\277\247\263\342\161\261\271\33\227\5\233\142\121\214\14"
+  "\4\214\345\232\102\111\223\261\241\271\106\243\3\162\5\46\147\53"
+  "\46\243\1\61\73\51\41\53\304\222\102\111\211\5\7\47\305\222"
+  "\242\131\251\277\253\207\5\233\142\121\43\241\251\63\5\233\300\60"
+  "\61\61\41\53\106\243\343\151\347\347\155\306\304\222\102\111\72\262"
+  "\232\23\304\222\242\131\322\140\260\362\345\222\101\111\241\203\253\212"
+  "\305\222\303\141\244\316\214\206\304\222\341\60\342\302\302\142\244\212"
+  "\341\70\110\110\110\152\244\222\201\131\17\257\251\213\204\202\242\141"
+  "\232\362\270\334\144\202\41\111\101\155\243\271\5\233\301\60\343\101"
+  "\103\153\345\222\341\70\241\261\241\241\146\243\3\162\361\331\337\237"
+  "\106\243\101\111\354\244\244\246\345\232\141\111\117\375\156\346\204\202"
+  "\142\111\51\263\261\271\4\233\41\111\256\16\15\211\105\253\302\151"
+  "\72\76\76\64\345\222\202\121\152\112\116\210\146\253\101\121\362\362"
+  "\162\323\45\243\2\162\107\357\167\237\5\233\1\71\353\343\301\261"
+  "\305\212\0\111\253\243\271\261\5\233\302\151\26\237\263\243\5\233"
+  "\202\121\246\264\244\304\345\222\101\111\77\273\71\53\310\273\241\141"
+  "\53\57\55\45\247\263\341\50\51\51\51\251\146\253\202\131\57\47"
+  "\57\277\344\222\142\121\6\216\216\216\106\243\202\121\21\61\33\23"
+  "\147\253\341\70\71\71\271\71\5\233\242\131\104\354\344\354\244\222"
+  "\303\141\231\73\373\231\204\212\343\141\152\256\252\212\345\222\2\152"
+  "\106\33\53\12\304\222\302\141\206\212\316\354\344\232\102\111\102\102"
+  "\312\313\244\212\1\71\150\140\302\112\244\212\201\131\51\17\241\241"
+  "\304\222\101\121\377\233\333\62\43\172\300\60\43\63\21\363\143\202"
+  "\241\50\142\143\142\343\5\233\141\111\271\215\52\52\146\263\3\162"
+  "\237\233\71\221\45\243\1\101\254\4\54\254\304\222\102\101\317\117"
+  "\113\143\344\232\240\50\251\243\1\43\143\202\301\60\3\1\11\53"
+  "\345\232\241\141\64\76\274\250\244\202\202\131\17\254\114\154\5\233"
+  "\242\141\223\322\322\362\345\232\202\121\246\256\206\206\206\273\341\50"
+  "\271\71\51\263\304\212\101\111\301\311\243\101\304\222\1\71\250\54"
+  "\244\14\5\233\42\101\354\370\164\374\147\253\201\131\255\27\267\247"
+  "\106\253\142\121\17\13\252\46\247\263\301\50\251\311\301\341\345\222"
+  "\43\162\266\352\346\350\106\243\40\111\216\206\246\256\106\243\303\131"
+  "\61\63\273\261\6\233\1\71\71\71\251\57\45\233\202\131\346\364"
+  "\324\134\5\233\202\131\237\333\332\23\344\232\242\141\356\315\306\146"
+  "\305\222\302\141\13\343\251\203\305\222\242\141\306\213\256\373\45\243"
+  "\242\141\311\253\213\11\305\212\1\71\150\102\142\143\144\202\41\111"
+  "\51\71\213\342\304\222\202\131\233\223\223\221\103\172\301\60\341\202"
+  "\303\343\345\232\240\50\143\143\143\163\147\253\3\152\227\237\27\257"
+  "\246\263\43\162\341\343\343\343\4\233\1\101\254\244\244\354\304\232"
+  "\1\101\141\141\341\163\146\263\301\60\73\71\51\251\243\222\1\101"
+  "\73\73\53\71\304\222\101\111\244\44\254\16\345\222\202\131\354\270"
+  "\246\76\45\243\141\131\222\222\322\322\44\243\242\131\207\215\356\255"
+  "\307\273\241\50\261\51\71\71\46\233\202\131\301\301\301\241\345\232"
+  "\2\162\246\176\250\60\206\263\41\101\354\346\154\254\106\243\1\101"
+  "\257\53\77\251\147\253\103\172\135\375\73\52\247\263\140\30\343\301"
+  "\341\301\146\253\3\152\256\172\356\154\45\243\303\141\247\352\150\314"
+  "\147\253\202\131\221\22\23\23\350\273\41\101\275\65\35\35\305\222"
+  "\0\71\254\210\340\140\345\232\201\131\361\263\371\361\344\232\102\111"
+  "\117\116\352\150\345\222\302\141\241\341\273\361\204\212\202\131\32\272"
+  "\56\230\146\253\141\121\213\211\155\357\244\212\240\50\353\341\343\351"
+  "\244\212\242\141\355\351\73\331\344\232\41\111\262\323\263\263\204\212"
+  "\300\60\343\242\203\211\345\232\42\101\161\343\363\143\146\253\201\131"
+  "\57\55\255\255\247\263\3\162\343\241\271\273\244\222\302\141\146\344"
+  "\270\112\143\202\41\101\342\341\152\362\247\273\240\50\251\51\71\71"
+  "\203\212\101\121\43\13\51\3\344\222\340\100\51\253\2\2\247\263"
+  "\242\131\256\246\64\64\105\253\202\131\322\222\223\223\5\243\141\121"
+  "\351\253\57\56\206\263\201\40\51\11\51\51\345\222\142\121\11\353"
+  "\243\261\106\253\103\172\310\313\311\277\206\263\343\141\244\364\164\264"
+  "\345\222\101\111\251\11\217\257\150\253\204\202\256\357\272\51\5\233"
+  "\140\30\301\201\251\241\106\243\242\131\244\246\244\354\5\233\302\131"
+  "\212\153\253\43\206\253\343\141\31\33\277\55\46\233\41\101\33\263"
+  "\63\23\305\222\301\60\340\162\154\342\304\222\142\121\162\170\340\350"
+  "\244\212\242\131\154\316\252\250\106\243\142\121\363\171\223\233\304\222"
+  "\141\121\272\362\362\173\203\212\242\131\41\257\13\213\244\212\240\50"
+  "\301\351\351\171\45\253\142\121\355\205\207\206\304\222\0\111\222\33"
+  "\270\60\244\212\202\131\135\331\265\15\344\232\42\71\143\143\150\142"
+  "\5\233\141\131\17\17\57\51\247\263\202\131\50\270\230\230\5\243"
+  "\101\111\356\316\214\104\142\212\43\71\353\343\352\143\145\253\240\50"
+  "\51\11\41\51\4\243\42\111\273\33\233\251\106\253\342\151\211\211"
+  "\311\251\106\253\303\141\54\64\24\64\105\253\101\121\233\222\222\222"
+  "\5\233\41\111\14\4\257\4\206\263\100\20\41\41\41\51\305\212"
+  "\141\121\63\52\61\22\345\232\104\162\101\342\240\117\206\263\202\131"
+  "\356\256\344\344\204\202\1\101\216\16\46\55\106\243\43\152\253\53"
+  "\271\263\244\212\140\30\241\41\41\43\305\232\202\121\354\356\253\311"
+  "\345\232\42\162\223\175\271\362\45\243\142\121\57\55\7\7\304\222"
+  "\41\101\273\353\15\215\244\222\1\71\142\313\312\310\5\233\202\131"
+  "\172\173\373\343\4\243\303\141\354\356\152\152\6\223\101\111\33\32"
+  "\73\71\143\202\202\131\362\222\22\60\243\222\243\121\252\53\253\211"
+  "\204\212\200\40\151\361\161\161\203\212\202\131\72\66\377\156\203\212"
+  "\141\131\20\272\330\272\204\212\340\70\51\11\213\243\244\222\341\60"
+  "\142\122\152\112\45\233\202\131\41\73\71\61\206\263\41\101\230\230"
+  "\230\270\5\233\1\101\104\344\104\114\304\232\140\30\112\102\302\302"
+  "\105\253\341\70\51\51\51\77\303\232\41\101\42\272\73\32\344\232"
+  "\242\141\301\301\201\311\146\253\201\131\276\276\264\264\145\253\101\121"
+  "\323\222\220\322\146\253\40\111\256\67\247\266\105\253\301\50\31\271"
+  "\271\273\244\212\341\70\62\362\262\222\305\222\42\101\0\201\242\242"
+  "\350\273\142\121\146\144\164\374\144\202\341\70\55\44\244\270\207\253"
+  "\204\202\31\33\27\330\106\253\42\71\241\241\343\61\305\222\342\141"
+  "\311\313\251\213\106\243\101\111\242\272\42\41\106\243\41\101\7\17"
+  "\206\216\45\243\102\101\15\215\251\211\244\222\341\70\340\340\340\170"
+  "\304\222\242\141\142\372\372\222\304\232\3\152\154\156\174\353\5\233"
+  "\41\101\251\243\243\343\244\222\41\101\252\22\62\270\244\222\342\141"
+  "\17\257\55\73\204\212\200\40\361\161\173\163\43\172\101\121\202\231"
+  "\56\72\304\232\201\131\356\254\364\326\144\202\0\101\253\361\241\243"
+  "\244\222\301\50\112\102\102\342\146\253\0\101\251\241\341\341\206\263"
+  "\101\101\262\260\223\262\5\243\1\71\354\114\314\314\4\243\41\101"
+  "\153\153\143\143\244\212\101\111\31\277\351\353\244\222\101\111\32\30"
+  "\236\234\304\222\242\141\243\341\171\361\310\263\202\131\366\364\364\374"
+  "\45\253\1\101\322\132\122\162\247\263\141\131\267\77\76\266\345\222"
+  "\142\121\321\261\253\272\345\222\140\40\230\270\270\60\5\233\1\71"
+  "\252\242\43\5\105\243\303\141\354\246\256\257\245\212\41\101\66\76"
+  "\66\66\207\253\244\212\24\224\275\32\146\263\301\50\261\261\241\263"
+  "\5\233\43\162\255\113\356\156\107\233\103\172\33\257\351\376\106\243"
+  "\242\131\206\206\316\206\45\253\142\111\311\251\311\251\105\253\200\50"
+  "\352\152\112\312\244\222\2\152\262\362\332\262\304\222\141\121\243\253"
+  "\241\201\203\212\142\121\343\341\341\341\244\222\242\141\170\350\276\132"
+  "\344\232\102\111\253\53\51\51\344\232\100\20\142\152\112\110\345\232"
+  "\141\131\233\73\37\227\143\202\141\131\46\206\312\52\144\202\340\70"
+  "\1\241\253\53\345\232\0\0\352\352\100\100\147\253\41\111\351\241"
+  "\241\253\206\263\142\121\230\230\270\220\45\243\142\121\344\354\154\356"
+  "\45\243\341\60\103\302\102\102\304\212\242\131\163\143\312\340\5\243"
+  "\300\60\270\230\230\30\244\222\101\111\243\243\42\6\106\253\40\111"
+  "\254\376\236\232\344\232\141\121\122\122\322\322\206\263\201\131\76\67"
+  "\67\66\5\233\343\141\261\261\373\233\46\243\100\30\220\20\20\60"
+  "\45\243\202\131\311\311\211\275\46\243\43\162\306\116\157\151\204\212"
+  "\301\50\66\74\254\56\146\253\204\212\32\30\62\26\307\273\301\50"
+  "\361\361\361\361\45\243\343\151\152\322\313\252\45\243\144\202\136\271"
+  "\263\320\146\243\142\121\204\214\214\204\304\222\243\121\1\241\241\261"
+  "\344\232\41\111\114\156\150\372\5\233\202\121\252\211\213\253\304\222"
+  "\41\111\211\241\251\241\244\212\101\111\241\313\351\152\244\222\142\121"
+  "\242\262\332\273\45\243\0\101\51\71\53\53\344\232\100\20\110\110"
+  "\112\310\304\222\0\101\76\66\27\27\204\202\201\141\51\63\252\252"
+  "\244\212\41\101\57\51\255\267\105\253\140\30\140\152\350\140\105\243"
+  "\302\151\352\211\357\234\106\243\201\131\220\272\222\230\45\243\101\111"
+  "\116\116\114\354\5\233\300\60\342\142\340\160\46\233\302\141\343\352"
+  "\370\230\345\232\340\70\34\274\274\30\106\243\342\151\113\317\315\377"
+  "\5\233\41\111\30\264\354\252\45\243\142\121\222\322\222\262\146\253"
+  "\40\111\47\57\47\57\345\222\142\131\76\273\273\233\46\243\200\40"
+  "\220\20\20\220\146\243\342\151\337\277\77\27\46\233\302\141\301\251"
+  "\203\203\103\172\2\71\46\44\16\52\350\273\2\162\246\52\52\50"
+  "\206\263\300\60\361\361\341\341\345\222\2\172\250\352\244\304\46\233"
+  "\3\152\261\243\242\252\206\253\101\111\346\344\244\306\304\222\243\121"
+  "\241\241\243\201\6\233\342\161\332\174\174\172\46\233\141\121\43\51"
+  "\251\273\45\243\101\111\243\351\301\111\244\212\202\131\111\117\213\216"
+  "\344\232\302\141\231\223\223\261\244\222\302\141\17\41\42\243\304\222"
+  "\100\30\110\110\110\100\45\243\0\101\237\273\77\33\304\222\342\151"
+  "\46\253\241\235\143\202\142\111\57\57\46\6\106\253\240\40\140\140"
+  "\142\142\45\253\302\141\330\220\270\232\345\222\40\111\260\260\250\211"
+  "\45\243\242\141\344\364\344\344\244\212\300\60\160\350\350\310\305\212"
+  "\101\111\30\270\210\260\304\222\1\71\232\36\36\36\45\243\2\152"
+  "\376\364\66\36\45\243\3\162\345\45\65\53\5\243\3\152\222\263"
+  "\223\343\310\273\300\70\57\55\45\45\345\222\101\111\273\263\23\63"
+  "\5\233\100\30\20\20\60\20\146\263\242\131\233\77\77\27\46\233"
+  "\342\161\201\41\243\41\345\222\41\101\257\77\243\261\207\263\204\202"
+  "\53\57\256\47\247\263\200\40\241\241\241\241\345\232\342\151\256\256"
+  "\217\215\345\222\3\152\241\243\253\206\247\263\41\111\306\306\216\206"
+  "\304\222\142\111\201\251\211\211\204\212\242\141\242\172\352\243\304\222"
+  "\142\121\272\332\360\362\105\243\341\70\113\117\352\257\244\212\101\121"
+  "\11\213\213\213\345\232\302\151\223\273\355\325\304\232\141\131\253\251"
+  "\203\352\244\222\100\20\110\150\350\150\304\222\242\141\377\375\271\361"
+  "\243\222\241\141\337\351\246\207\244\212\1\71\257\256\56\44\4\243"
+  "\1\61\140\160\140\170\5\243\101\111\62\242\272\222\145\263\341\70"
+  "\251\251\211\211\106\253\202\131\346\346\104\166\345\232\300\60\152\152"
+  "\112\150\304\222\242\131\352\152\142\362\203\212\341\70\36\237\70\270"
+  "\105\253\303\141\235\77\66\236\345\232\43\172\231\41\243\231\304\222"
+  "\201\131\200\256\72\32\206\263\100\121\247\47\56\57\247\263\202\131"
+  "\271\31\31\33\146\253\240\60\222\20\20\220\106\243\41\111\77\66"
+  "\66\74\45\243\343\151\51\51\53\255\345\232\41\111\221\341\343\343"
+  "\307\273\305\232\67\70\66\26\206\263\241\50\241\241\241\243\304\222"
+  "\41\111\213\211\241\241\6\223\3\162\215\15\1\43\106\253\1\71"
+  "\204\204\44\44\146\253\102\101\211\211\211\251\244\212\202\141\341\342"
+  "\373\163\344\222\202\131\143\312\56\52\345\232\340\60\353\316\116\356"
+  "\244\212\202\131\153\117\312\212\244\212\201\121\212\342\352\110\45\243"
+  "\201\131\277\246\46\56\5\243\40\10\150\110\150\350\344\232\141\121"
+  "\271\257\356\243\243\212\101\121\6\6\16\76\244\222\1\71\4\16"
+  "\244\44\344\232\240\50\140\140\342\342\304\232\341\70\220\330\332\332"
+  "\246\263\0\101\215\211\255\213\304\222\141\121\360\352\356\150\345\232"
+  "\41\101\154\150\170\170\345\222\302\151\362\23\51\63\304\222\41\111"
+  "\236\236\234\324\5\243\343\141\74\276\36\232\5\243\2\152\75\271"
+  "\73\67\143\202\101\111\221\243\200\250\310\263\203\212\47\256\247\77"
+  "\5\233\102\121\23\273\353\153\46\243\1\101\320\220\260\242\146\243"
+  "\300\70\72\76\76\66\304\222\41\111\16\12\206\214\143\212\142\111"
+  "\322\332\272\272\106\253\43\172\50\277\76\36\45\243\102\101\201\201"
+  "\201\1\304\222\240\50\11\211\201\11\106\243\43\162\77\315\255\365"
+  "\206\263\41\101\44\44\54\56\304\222\200\40\1\1\241\201\305\222"
+  "\141\111\141\341\341\143\203\212\43\162\76\223\363\357\244\212\141\121"
+  "\152\353\317\304\245\212\302\141\106\56\32\242\344\232\202\131\352\356"
+  "\314\304\304\222\43\162\4\4\244\254\5\233\140\40\140\140\150\150"
+  "\244\222\242\141\257\217\357\155\203\212\101\111\206\206\216\212\344\222"
+  "\1\101\244\244\244\254\244\222\200\40\142\142\112\150\143\202\102\111"
+  "\322\352\274\70\45\253\40\111\213\211\211\257\304\212\41\111\270\270"
+  "\26\56\304\232\101\101\370\174\170\174\345\222\101\121\242\342\112\143"
+  "\4\243\41\101\330\170\370\170\206\263\102\111\272\32\37\27\345\232"
+  "\101\111\56\53\246\204\244\212\141\131\326\366\354\254\106\243\342\151"
+  "\12\247\53\71\244\212\341\70\303\343\343\153\45\253\343\141\152\152"
+  "\117\113\244\222\41\101\44\346\310\352\45\243\141\121\214\204\206\204"
+  "\203\212\341\70\202\102\102\312\206\263\342\151\276\232\37\35\145\253"
+  "\1\71\201\201\201\243\244\212\200\50\1\11\11\13\305\212\342\151"
+  "\13\212\277\251\145\253\302\141\77\77\35\375\345\232\100\30\211\13"
+  "\213\251\244\212\201\131\143\150\342\317\244\212\242\131\354\344\246\356"
+  "\304\222\202\131\306\316\306\346\345\222\1\71\262\242\261\261\203\222"
+  "\101\111\344\264\244\344\244\212\343\151\6\207\255\216\305\222\100\30"
+  "\150\150\150\150\243\212\242\141\106\317\316\107\102\202\142\121\206\204"
+  "\204\244\244\212\142\121\244\44\244\244\204\212\200\40\110\110\150\150"
+  "\103\202\102\101\250\270\52\30\304\222\101\121\311\211\313\211\345\222"
+  "\0\111\74\44\44\214\204\212\41\101\150\154\150\154\305\222\0\101"
+  "\342\142\343\162\5\233\202\121\170\370\236\276\106\243\202\131\26\336"
+  "\377\377\5\233\141\131\254\244\206\214\303\222\141\121\252\312\350\154"
+  "\46\243\302\141\73\73\27\275\244\222\102\111\151\101\143\343\106\253"
+  "\41\101\203\302\142\332\42\172\101\121\213\322\252\12\304\222\242\141"
+  "\206\375\265\377\144\202\242\131\140\376\0\257\203\202\101\121\50\137"
+  "\200\376\5\233\41\111\243\365\2\125\244\212\102\121\12\267\10\325"
+  "\305\222\201\121\12\53\352\327\305\212\242\141\12\372\127\355\244\222"
+  "\242\121\55\2\273\146\305\222\202\131\210\260\2\175\304\222\41\101"
+  "\252\372\0\127\304\222\341\70\210\377\0\165\304\222\240\50\53\353"
+  "\0\125\244\222\341\70\0\276\252\235\304\222\341\70\12\277\367\212"
+  "\5\233\1\101\340\253\365\0\106\253\142\121\276\173\175\2\204\212"
+  "\240\50\250\356\255\240\244\212\1\71\52\177\256\0\244\212\1\71"
+  "\312\125\210\0\244\212\301\60\52\275\0\250\146\253\202\131\353\365"
+  "\2\372\146\253\242\141\267\365\0\337\244\222\3\152\156\257\260\254"
+  "\344\232\342\151\123\333\47\270\46\243\3\162\325\253\240\253\345\222"
+  "\342\141\176\2\252\252\304\222\140\30\252\100\202\200\204\212\241\40"
+  "\340\210\211\46\304\222\141\121\53\43\41\11\304\222\101\111\163\161"
+  "\163\163\204\212\341\70\50\124\377\200\103\202\101\111\170\265\377\252"
+  "\43\172\1\101\127\2\377\272\244\212\300\70\155\240\377\277\342\151"
+  "\1\101\251\202\12\376\3\162\1\101\12\260\12\135\43\172\42\101"
+  "\0\12\72\355\144\202\302\151\242\266\145\205\244\212\201\131\337\377"
+  "\337\52\345\232\142\121\137\252\235\0\46\233\141\121\325\252\372\0"
+  "\305\222\302\141\365\252\372\0\4\243\242\131\252\212\327\252\305\222"
+  "\43\162\372\242\245\153\305\222\342\151\42\366\350\267\305\222\103\162"
+  "\0\371\2\252\304\222\242\131\2\367\52\52\304\222\241\131\0\177"
+  "\254\370\204\212\142\121\200\255\350\372\143\202\142\131\0\352\57\245"
+  "\243\212\242\141\332\367\2\266\244\212\202\131\353\353\240\135\143\202"
+  "\1\101\12\372\210\367\344\222\1\101\0\367\12\165\5\233\101\111"
+  "\40\177\200\375\345\232\101\121\240\133\212\177\244\222\202\131\372\12"
+  "\250\15\45\243\0\111\377\0\177\240\304\222\1\101\272\240\365\202"
+  "\203\212\100\20\274\332\153\0\345\232\40\20\12\13\13\1\304\232"
+  "\200\40\362\42\256\351\345\222\241\141\275\362\375\177\103\172\41\111"
+  "\172\0\250\0\203\202\300\100\375\0\252\252\103\172\201\131\125\0"
+  "\42\257\143\202\242\151\255\240\10\167\203\202\242\141\352\176\370\156"
+  "\144\202\201\131\72\357\42\367\143\202\141\121\10\226\252\252\204\202"
+  "\102\111\0\2\272\333\105\243\102\101\252\10\127\277\244\212\102\111"
+  "\200\200\377\173\305\222\142\111\2\175\13\377\5\233\202\121\252\137"
+  "\12\135\5\223\141\121\210\373\0\47\346\222\2\152\272\212\10\133"
+  "\46\233\303\141\377\50\242\125\345\222\302\141\337\200\102\253\305\212"
+  "\202\131\337\210\252\3\344\232\1\101\277\2\176\252\244\212\141\121"
+  "\136\50\2\377\345\222\242\131\171\0\340\335\345\232\342\151\77\200"
+  "\177\175\344\232\302\141\12\253\377\125\45\243\101\121\50\252\327\377"
+  "\5\243\302\141\40\252\367\252\244\212\242\141\54\356\132\252\304\222"
+  "\242\141\16\132\271\252\244\212\0\111\160\252\0\240\204\212\101\101"
+  "\265\2\240\252\106\253\202\131\375\53\376\175\45\243\140\30\7\270"
+  "\272\152\244\212\202\121\251\266\350\242\204\202\342\151\246\240\251\342"
+  "\244\212\343\141\57\0\353\246\304\222\343\151\200\2\325\376\304\212"
+  "\302\151\0\250\53\136\345\222\241\131\252\200\2\47\45\243\43\162"
+  "\137\252\342\157\345\232\242\131\177\0\256\377\146\253\242\141\137\252"
+  "\53\253\206\263\342\151\125\253\250\12\45\243\343\151\325\52\356\200"
+  "\345\232\104\162\273\240\355\0\244\212\43\162\376\0\375\162\304\222"
+  "\101\121\376\0\212\367\244\212\302\141\257\202\242\345\143\202\41\101"
+  "\110\230\50\16\144\202\101\111\140\352\252\252\345\222\242\131\0\335"
+  "\73\273\5\233\2\152\240\15\207\256\305\222\242\121\252\242\241\243"
+  "\204\202\242\131\152\0\12\10\305\222\201\121\365\12\253\253\244\212"
+  "\242\131\13\0\162\132\244\212\101\121\242\172\177\377\103\172\101\111"
+  "\0\153\142\302\104\162\101\121\200\252\273\35\244\212\202\121\50\257"
+  "\116\316\305\222\242\131\202\266\242\270\304\222\202\131\252\252\142\142"
+  "\344\222\202\131\167\376\47\16\204\202\101\121\137\352\42\272\204\212"
+  "\300\60\11\202\12\0\244\212\202\131\76\264\372\314\5\233\242\141"
+  "\331\141\361\341\106\243\343\151\247\47\56\257\345\222\242\131\243\243"
+  "\241\243\244\212\2\162\306\175\215\215\244\212\242\141\251\71\53\43"
+  "\103\172\141\121\240\152\152\212\43\162\101\121\252\312\312\110\43\172"
+  "\41\111\103\343\172\370\103\172\101\111\73\274\232\52\304\222\101\111"
+  "\317\116\317\317\45\243\3\152\334\264\264\224\304\222\41\101\342\142"
+  "\342\140\5\233\201\131\6\246\52\56\345\232\202\131\333\143\362\343"
+  "\244\212\3\162\45\17\14\352\46\243\3\152\356\246\246\104\345\232"
+  "\242\131\241\253\253\252\106\243\44\152\246\247\45\47\5\233\142\121"
+  "\243\241\241\201\304\222\3\152\211\11\13\17\305\222\342\141\355\353"
+  "\352\203\204\212\101\111\353\157\116\116\102\172\142\121\276\346\254\254"
+  "\43\162\141\121\342\152\110\210\144\202\242\141\31\231\263\223\304\222"
+  "\101\111\117\117\117\157\45\243\202\131\264\244\244\344\244\222\41\101"
+  "\140\160\160\162\46\243\43\162\67\66\246\356\345\222\302\141\361\351"
+  "\253\356\304\222\342\151\252\217\17\4\5\233\142\121\254\46\46\256"
+  "\45\243\44\162\146\136\174\364\146\253\3\152\56\47\66\77\45\243"
+  "\142\111\243\303\311\351\305\222\43\162\117\111\153\137\304\222\302\141"
+  "\353\203\243\271\204\202\41\111\112\342\353\242\204\202\202\121\216\216"
+  "\206\254\244\212\101\111\312\312\112\310\103\172\101\121\250\260\222\252"
+  "\304\222\141\111\117\117\117\157\45\243\101\111\274\274\264\244\345\222"
+  "\41\101\362\162\162\162\5\233\343\151\56\46\244\276\5\233\3\152"
+  "\156\132\150\354\345\222\2\152\204\56\72\56\305\212\3\152\214\67"
+  "\47\47\106\243\3\152\364\174\136\326\207\263\44\162\37\275\277\325"
+  "\4\233\1\71\301\353\253\357\204\202\201\141\200\260\256\255\104\172"
+  "\202\131\3\251\251\17\204\202\242\131\202\243\252\160\305\222\303\131"
+  "\246\56\266\76\244\212\141\121\116\113\156\156\143\202\101\111\242\240"
+  "\232\322\103\172\101\111\350\160\62\262\204\202\142\131\304\254\10\0"
+  "\244\212\101\111\150\372\322\262\245\212\342\151\342\363\373\226\105\243"
+  "\343\141\376\174\172\336\344\222\43\162\77\31\247\345\5\233\343\141"
+  "\77\73\33\36\5\233\104\162\274\320\362\120\144\202\303\141\12\3"
+  "\7\17\204\202\202\121\215\57\53\253\144\172\241\141\255\257\253\12"
+  "\345\222\303\141\355\275\357\317\204\202\302\141\143\341\371\303\244\212"
+  "\3\152\64\56\72\74\143\202\101\111\152\310\150\154\204\212\141\121"
+  "\323\363\243\312\144\172\141\121\271\21\233\241\345\222\43\162\72\16"
+  "\16\346\305\212\303\141\220\330\374\356\304\222\3\152\232\37\33\67"
+  "\345\232\43\162\273\162\142\322\304\222\302\141\256\256\244\44\345\232"
+  "\202\131\67\77\77\267\46\243\3\152\320\232\272\273\5\233\343\141"
+  "\67\67\47\55\244\212\202\121\51\41\21\22\205\202\342\151\253\253"
+  "\51\41\244\212\302\141\12\53\51\51\244\212\302\141\312\312\110\316"
+  "\305\212\43\162\261\242\251\71\204\212\101\111\154\356\354\354\244\212"
+  "\241\141\111\341\343\353\43\162\101\121\41\251\212\252\244\212\343\141"
+  "\56\73\5\7\204\202\242\131\264\274\362\262\345\222\242\131\47\73"
+  "\75\35\344\232\3\152\320\122\162\362\345\232\202\131\64\244\244\244"
+  "\305\212\342\141\377\177\321\362\244\212\242\131\72\40\312\143\107\243"
+  "\302\141\55\35\71\271\5\233\343\141\21\221\251\257\305\222\342\151"
+  "\251\253\43\253\204\202\242\131\203\13\253\301\144\202\3\152\352\56"
+  "\67\274\245\212\43\162\53\362\232\371\345\232\303\131\156\153\172\162"
+  "\203\202\202\131\363\302\251\256\342\151\142\111\102\116\312\112\5\233"
+  "\343\141\251\253\212\3\304\222\302\141\322\162\173\137\304\222\101\121"
+  "\273\233\263\263\244\212\3\152\222\160\303\263\304\222\342\151\64\24"
+  "\34\64\6\233\243\131\253\251\261\261\345\232\43\162\173\152\240\242"
+  "\6\233\302\141\253\11\11\11\244\212\202\121\12\13\53\11\345\222"
+  "\104\172\115\314\225\33\305\222\142\121\251\311\112\152\244\212\302\141"
+  "\236\356\244\254\204\202\242\131\240\240\314\110\5\233\101\111\163\333"
+  "\332\133\344\232\202\131\153\357\341\343\204\202\202\131\156\351\157\103"
+  "\45\243\302\141\251\251\211\311\204\202\141\121\152\170\372\340\344\222"
+  "\202\131\263\271\261\261\345\232\301\151\71\53\42\242\344\232\343\151"
+  "\334\76\76\24\345\222\242\121\241\241\355\157\305\222\43\162\272\242"
+  "\152\106\345\222\41\111\53\11\15\17\244\212\142\121\251\53\52\52"
+  "\46\243\302\141\236\32\36\272\304\222\141\121\357\341\303\143\204\212"
+  "\342\151\204\250\214\216\143\202\302\141\116\203\312\210\244\212\300\60"
+  "\362\162\162\162\143\202\302\151\311\145\205\145\143\202\42\101\103\352"
+  "\352\212\46\243\3\152\113\313\111\157\244\212\202\131\153\356\356\312"
+  "\244\222\202\131\241\361\255\357\245\222\2\162\52\253\152\307\5\233"
+  "\41\111\74\274\264\244\5\233\142\121\157\152\112\316\244\222\343\141"
+  "\252\61\43\43\5\233\242\131\17\15\15\15\304\222\3\152\45\255"
+  "\307\5\345\232\43\162\32\232\52\70\244\222\202\131\143\343\343\352"
+  "\244\212\342\151\54\234\22\223\204\212\342\151\307\145\251\145\244\212"
+  "\41\101\142\342\342\342\43\172\141\121\40\42\43\11\344\232\102\111"
+  "\353\113\111\111\45\243\3\162\117\113\353\156\244\212\141\121\210\210"
+  "\312\110\305\222\302\141\157\156\152\174\244\212\342\151\217\103\340\343"
+  "\345\232\141\121\66\74\74\74\5\233\242\131\113\117\117\316\305\222"
+  "\42\162\253\43\53\51\146\253\142\121\55\15\57\57\244\222\343\141"
+  "\7\57\57\73\345\232\43\152\232\270\232\33\244\212\343\141\312\212"
+  "\353\241\244\212\242\141\242\272\236\374\204\212\342\151\251\253\201\261"
+  "\244\212\41\101\302\300\102\100\204\212\342\151\45\253\335\232\105\253"
+  "\141\111\115\115\155\153\5\243\242\131\354\270\232\236\204\212\102\111"
+  "\110\340\342\310\244\212\242\131\356\370\136\354\304\232\43\162\76\52"
+  "\251\252\45\243\0\101\72\32\72\72\45\243\303\141\113\113\117\317"
+  "\304\222\242\141\41\53\73\71\146\253\141\121\17\16\247\257\345\222"
+  "\141\121\72\272\222\22\5\233\104\162\21\23\63\71\304\222\242\131"
+  "\243\343\361\351\203\202\342\151\134\122\120\332\144\202\3\152\375\153"
+  "\243\50\304\222\102\111\143\102\102\112\143\202\242\141\33\60\22\273"
+  "\244\222\101\111\103\313\113\152\5\233\101\111\76\66\76\277\204\212"
+  "\202\121\310\116\156\153\304\222\142\121\352\342\112\116\244\212\342\151"
+  "\50\40\30\221\146\253\302\141\45\57\265\277\304\222\302\141\207\47"
+  "\7\107\244\222\241\141\57\77\265\377\304\222\302\141\7\47\127\373"
+  "\345\222\41\111\222\222\273\373\304\222\342\151\62\233\242\125\244\212"
+  "\41\111\241\251\202\252\103\172\302\141\0\73\374\336\144\172\242\141"
+  "\370\273\255\125\244\212\41\101\102\102\212\253\203\202\242\131\272\272"
+  "\370\320\143\202\101\111\342\152\372\2\304\222\202\131\277\277\275\12"
+  "\304\222\302\141\151\163\251\200\304\222\202\131\316\246\252\2\244\212"
+  "\303\131\52\56\110\0\244\212\101\111\12\50\54\51\144\172\101\121"
+  "\356\244\210\251\2\162\201\131\167\173\236\240\43\172\141\121\372\125"
+  "\12\12\43\162\141\131\52\235\250\50\204\202\201\121\372\253\13\152"
+  "\304\222\202\121\276\212\200\175\304\222\3\152\13\370\377\375\244\212"
+  "\103\162\250\377\57\301\244\212\43\162\320\40\302\207\204\202\342\151"
+  "\250\150\72\140\204\202\242\141\352\251\216\212\244\222\242\141\337\136"
+  "\40\377\304\222\242\141\353\255\0\275\143\202\3\162\44\76\212\266"
+  "\204\202\242\141\200\376\226\210\244\222\41\101\47\76\62\156\144\172"
+  "\302\141\53\250\6\253\304\222\3\152\13\375\340\363\244\212\3\152"
+  "\0\77\236\262\244\222\242\141\240\240\352\126\45\243\242\141\276\12"
+  "\377\125\304\222\3\152\12\40\377\305\245\222\302\141\252\376\136\36"
+  "\204\202\241\131\352\72\67\52\244\212\3\152\355\306\40\0\5\233"
+  "\44\162\371\323\363\221\305\222\342\151\237\273\272\243\2\162\242\141"
+  "\244\352\335\253\43\162\141\121\252\246\56\12\244\212\242\141\213\13"
+  "\15\57\304\222\142\111\76\54\44\44\244\212\342\151\66\44\52\50"
+  "\244\212\44\152\203\203\212\301\6\233\302\141\242\262\322\332\204\202"
+  "\302\141\2\52\270\231\204\202\302\141\267\247\52\54\143\172\202\131"
+  "\312\352\212\112\204\202\201\121\13\253\246\16\305\212\201\121\4\4"
+  "\216\254\304\222\3\152\74\54\274\266\345\232\303\141\212\212\311\251"
+  "\244\212\302\141\222\263\263\243\204\202\342\151\231\53\52\22\204\202"
+  "\3\152\66\17\13\13\103\172\302\141\107\46\46\214\244\212\242\131"
+  "\17\17\255\75\244\212\343\151\204\256\27\226\244\222\43\162\234\274"
+  "\264\264\305\222\3\152\245\166\252\212\345\222\3\152\243\262\232\223"
+  "\244\202\3\152\222\322\220\160\144\202\43\162\12\211\105\132\244\212"
+  "\201\121\352\270\246\246\344\222\202\131\45\45\57\57\244\212\242\141"
+  "\354\356\246\256\244\212\43\162\366\257\243\240\244\212\343\141\12\255"
+  "\57\12\5\233\303\141\231\261\261\261\304\222\342\151\132\352\150\360"
+  "\144\202\2\152\362\242\230\334\103\172\101\111\244\44\210\50\244\212"
+  "\302\141\7\55\17\17\204\202\342\151\345\232\250\316\204\202\2\152"
+  "\200\22\72\250\244\222\104\162\275\55\72\331\106\253\302\141\261\361"
+  "\363\171\244\212\3\152\40\360\340\120\144\202\2\152\270\247\366\244"
+  "\203\202\342\151\64\364\364\364\244\212\342\151\211\215\237\226\204\202"
+  "\342\151\144\146\112\245\5\243\2\152\352\272\32\236\204\212\241\141"
+  "\63\363\137\377\244\212\141\131\302\376\365\373\204\202\342\151\230\52"
+  "\246\251\204\202\302\141\352\337\0\12\244\212\302\141\366\153\250\242"
+  "\144\202\302\141\266\53\352\2\244\212\2\152\266\42\253\242\204\202"
+  "\242\131\42\60\232\352\244\212\3\152\57\211\213\200\244\212\242\141"
+  "\202\352\372\330\304\222\242\141\0\277\265\237\204\212\2\152\370\236"
+  "\43\41\304\212\3\152\202\112\142\343\144\202\2\152\122\267\73\52"
+  "\244\212\302\141\277\237\37\237\204\212\43\152\1\57\213\217\204\212"
+  "\44\152\211\202\341\203\244\212\43\152\54\374\354\354\244\212\302\141"
+  "\36\77\75\77\204\212\43\152\57\17\215\257\244\212\301\141\202\210"
+  "\256\327\244\212\2\152\250\274\136\51\204\202\2\152\76\376\335\370"
+  "\204\212\2\152\7\215\252\172\204\202\342\151\202\140\240\250\144\202"
+  "\2\152\342\51\55\55\144\202\2\152\200\200\200\347\144\202\2\152"
+  "\73\251\37\256\144\202\42\152\250\30\260\272"
+};
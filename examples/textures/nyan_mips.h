@@ -0,0 +1,336 @@
+static const struct { uint16_t w, h, levels, format; uint8_t d[]; } nyan_mips =
+{
+  64, 64, 7, R3D_TEXTURE_P8,
+  "\40\0\0\372\347\247\4\41\377\377\165\372\347\257\364\363\77\5"
+  "\72\375\100\375\64\255\345\377\105\51\324\373\265\376\245\61\110\112"
+  "\64\245\40\372\24\245\101\372\132\375\141\372\37\322\131\375\363\234"
+  "\201\372\141\375\132\375\142\372\132\375\202\372\132\375\202\372\132\375"
+  "\40\375\132\375\132\375\132\375\132\375\132\375\132\375\132\375\132\375"
+  "\132\375\132\375\132\375\132\375\132\375\132\375\132\375\132\375\132\375"
+  "\132\375\132\375\132\375\132\375\132\375\132\375\132\375\132\375\132\375"
+  "\132\375\132\375\132\375\132\375\132\375\132\375\132\375\132\375\132\375"
+  "\132\375\132\375\132\375\132\375\132\375\132\375\132\375\132\375\132\375"
+  "\132\375\132\375\132\375\132\375\132\375\132\375\132\375\132\375\132\375"
+  "\132\375\132\375\132\375\132\375\132\375\132\375\132\375\132\375\132\375"
+  "\172\375\64\255\64\255\64\255\64\255\64\255\64\255\64\255\64\255"
+  "\64\255\64\255\64\255\64\255\64\255\64\255\64\255\64\255\64\255"
+  "\64\255\64\255\64\255\64\255\124\255\124\255\124\255\124\255\124\255"
+  "\124\255\124\255\124\255\124\255\124\255\124\255\124\255\124\255\124\255"
+  "\124\255\124\255\124\255\124\255\124\255\124\255\124\255\124\255\124\255"
+  "\124\255\124\255\124\255\124\255\124\255\124\255\124\255\124\255\124\255"
+  "\124\255\124\255\124\255\124\255\124\255\124\255\124\255\124\255\65\255"
+  "\340\377\172\375\125\245\172\375\133\375\232\375\125\255\173\375\125\255"
+  "\272\375\125\255\125\255\125\255\125\255\125\255\125\255\125\255\131\355"
+  "\276\367\376\377\242\20\350\257\77\5\77\5\137\5\137\15\347\377"
+  "\324\373\225\376\341\377\242\30\351\257\137\15\324\373\137\15\324\373"
+  "\137\15\324\373\137\15\324\373\137\15\331\374\137\15\137\15\137\15"
+  "\177\15\177\25\302\30\165\376\351\377\343\377\353\267\177\25\302\30"
+  "\177\25\302\30\177\25\302\30\177\25\302\30\177\25\302\30\177\25"
+  "\302\30\177\25\303\30\237\35\303\30\277\55\303\30\303\30\303\30"
+  "\303\30\303\30\303\30\303\30\303\30\303\30\303\30\303\30\303\30"
+  "\303\30\303\30\303\30\343\30\343\30\343\30\343\30\3\31\343\40"
+  "\366\372\202\61\247\101\137\332\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\265\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\265\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\265\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\265\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\0\0\266"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\23\27\40\23\4\4"
+  "\4\4\4\4\4\33\23\25\23\27\25\4\4\4\4\4\4\40"
+  "\23\36\25\25\23\1\0\17\17\17\276\17\17\17\17\17\17\17"
+  "\17\17\17\17\17\17\17\0\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\23\23\23\23\36\40\25\40\40\25\25\23\1\23"
+  "\1\1\1\27\23\25\23\25\40\23\1\1\1\1\1\266\17\17"
+  "\17\251\26\143\251\26\143\247\251\143\251\251\251\143\247\17\276\17"
+  "\0\4\4\4\4\4\4\4\4\4\4\4\4\4\27\23\23\25"
+  "\23\1\1\1\1\23\1\25\1\23\27\25\23\23\23\23\1\1"
+  "\23\23\1\23\25\23\23\266\17\17\251\26\26\26\26\374\11\26"
+  "\26\26\374\11\26\26\26\247\17\17\0\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\34\12\34\34\27\1\25\23\23\23\27\34"
+  "\34\12\34\12\12\23\23\25\1\23\36\34\12\12\12\12\12\373"
+  "\17\253\26\374\26\26\26\11\26\26\26\26\11\11\26\251\374\11"
+  "\26\17\0\4\4\4\4\4\4\4\4\4\4\4\4\4\12\12"
+  "\12\12\34\34\34\34\34\34\12\12\12\12\12\12\12\34\12\34"
+  "\12\12\34\12\12\12\12\12\12\266\17\26\26\11\11\26\26\26"
+  "\26\143\251\26\26\376\376\263\26\11\26\17\0\4\4\343\366\265"
+  "\4\4\4\4\4\4\4\4\34\12\12\12\12\12\44\44\12\12"
+  "\12\34\34\34\12\12\12\12\12\12\12\44\12\34\34\12\12\12"
+  "\12\0\17\26\26\26\26\251\26\26\11\5\26\26\343\22\24\343"
+  "\26\26\143\17\0\265\15\22\13\21\4\4\4\4\4\4\4\4"
+  "\277\324\277\277\12\44\12\12\12\12\34\14\277\14\277\14\274\34"
+  "\12\12\12\12\12\242\242\242\242\277\14\266\17\26\11\11\26\143"
+  "\26\11\26\11\143\26\266\22\22\171\266\143\26\17\15\372\13\171"
+  "\241\15\4\4\4\4\4\4\4\4\242\242\277\277\324\277\277\14"
+  "\274\323\277\277\242\242\242\277\324\277\324\324\14\324\277\242\375\375"
+  "\324\242\242\0\17\143\26\26\26\26\5\143\26\26\26\26\266\171"
+  "\13\171\22\15\343\343\3\13\250\22\171\15\4\4\4\4\4\4"
+  "\4\4\277\242\242\242\242\242\242\242\242\242\242\324\242\277\14\14"
+  "\277\242\242\242\242\242\277\373\171\13\3\277\242\0\17\26\26\26"
+  "\26\246\11\26\26\26\26\26\266\171\22\171\171\171\171\171\171\250"
+  "\171\13\13\343\4\4\4\4\4\4\4\4\325\301\267\325\242\242"
+  "\277\242\277\277\277\325\325\301\325\267\325\323\277\14\324\242\323\266"
+  "\171\22\266\266\266\3\17\143\374\11\26\26\26\26\26\5\313\15"
+  "\32\22\171\22\13\171\241\171\171\171\13\244\250\171\20\4\4\4"
+  "\4\4\4\4\6\6\6\267\325\301\325\301\325\325\325\267\6\2"
+  "\267\6\6\267\267\325\301\301\325\325\15\250\13\171\171\15\17\246"
+  "\11\11\26\26\143\26\26\11\26\266\22\171\250\4\3\171\171\171"
+  "\13\171\4\3\22\13\366\4\4\4\4\4\4\4\325\267\6\6"
+  "\6\2\6\6\6\6\267\325\6\267\267\267\6\6\6\6\2\6"
+  "\6\6\267\343\266\171\13\321\17\251\26\26\26\26\26\26\26\26"
+  "\11\266\13\250\171\266\266\171\171\171\20\13\321\300\22\171\15\4"
+  "\4\4\4\4\4\4\317\320\317\272\267\267\267\267\6\2\6\344"
+  "\272\317\320\273\320\325\301\6\6\301\267\267\346\346\346\3\266\15"
+  "\17\143\26\26\11\31\5\26\26\26\26\266\171\16\16\171\250\171"
+  "\171\13\13\171\171\13\16\16\3\4\4\4\4\4\4\4\272\272"
+  "\272\272\273\273\273\320\317\320\320\272\272\272\272\272\272\320\320\317"
+  "\317\317\272\272\272\272\272\273\320\266\17\17\251\5\11\26\11\26"
+  "\26\26\26\266\22\16\16\171\3\22\250\366\13\171\21\171\7\16"
+  "\321\4\4\4\4\4\4\4\273\272\273\273\272\272\272\10\272\272"
+  "\317\320\272\273\272\10\272\273\272\10\10\272\272\272\317\317\10\272"
+  "\320\0\17\17\17\313\11\26\26\26\26\26\26\246\3\22\250\13"
+  "\343\343\266\266\343\366\343\13\171\15\4\4\4\4\4\4\4\4"
+  "\377\377\377\377\272\273\317\272\273\272\10\377\30\377\377\377\377\317"
+  "\272\272\317\272\272\320\377\30\30\30\30\0\321\17\17\276\322\17"
+  "\276\17\17\276\322\276\17\366\171\250\171\171\241\241\22\171\171\171"
+  "\266\4\4\4\4\4\4\4\4\4\30\30\30\377\377\377\377\377"
+  "\377\377\377\30\30\30\377\30\30\377\30\377\30\377\30\377\30\30"
+  "\30\30\0\24\171\321\0\343\3\266\300\266\0\0\0\0\300\343"
+  "\373\366\343\343\373\366\376\373\266\321\4\4\4\4\4\4\4\4"
+  "\4\4\377\30\30\30\30\30\30\30\30\30\30\30\377\30\30\30"
+  "\30\30\30\30\30\30\377\30\377\30\30\30\0\24\171\266\264\3"
+  "\171\171\171\266\4\4\4\4\4\265\266\22\13\343\4\266\22\13"
+  "\321\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\377\30"
+  "\377\30\377\30\377\4\4\4\4\4\4\377\377\377\30\377\30\30"
+  "\4\4\4\4\266\15\343\4\4\4\366\0\366\343\4\4\4\4"
+  "\4\4\4\343\266\366\4\4\300\266\343\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\250\32\32\32\32\32\32"
+  "\32\32\250\4\4\4\4\4\4\4\23\23\7\7\7\40\23\23"
+  "\40\7\7\40\23\23\1\13\322\253\253\322\322\253\253\322\13\250"
+  "\4\4\4\4\4\4\33\33\23\23\23\33\33\33\33\23\1\33"
+  "\33\33\21\322\313\26\313\26\26\313\26\313\322\32\4\4\4\4"
+  "\4\4\12\12\34\12\34\12\12\12\12\12\12\12\12\12\21\253"
+  "\26\26\26\313\26\32\21\26\322\32\32\32\4\4\4\4\277\277"
+  "\277\277\14\277\277\277\324\277\277\242\44\277\21\253\26\26\313\26"
+  "\26\21\171\21\32\21\171\21\4\4\4\4\14\14\242\242\242\14"
+  "\14\6\14\277\277\21\171\375\375\253\313\26\26\313\7\32\171\171"
+  "\171\171\171\32\263\4\4\4\267\6\267\301\301\301\6\267\6\267"
+  "\267\301\21\32\21\253\26\26\26\26\32\171\32\21\171\32\21\13"
+  "\32\4\4\4\273\272\32\32\32\346\272\273\346\32\32\32\344\10"
+  "\15\322\313\26\313\26\32\7\7\32\32\171\32\16\32\4\4\4"
+  "\346\346\272\272\272\346\346\346\346\272\272\272\346\346\21\13\322\322"
+  "\322\322\253\21\250\21\21\21\32\32\4\4\4\4\30\377\377\30"
+  "\377\30\377\30\30\377\30\377\30\30\21\21\21\21\20\32\32\32"
+  "\376\376\21\21\21\4\4\4\4\4\4\4\246\246\246\264\4\4"
+  "\264\246\246\246\4\4\32\250\4\32\32\4\4\4\250\32\4\32"
+  "\250\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\7\276\322\7\322\322\7\13\13\13\13\13"
+  "\250\4\4\4\44\33\44\44\44\44\44\32\11\11\263\263\13\250"
+  "\4\4\324\242\324\14\324\34\2\32\11\11\32\32\32\32\264\4"
+  "\32\325\325\32\325\325\32\32\11\11\32\32\32\32\250\4\30\346"
+  "\30\30\30\346\30\21\32\32\32\21\21\32\4\4\4\264\264\4"
+  "\264\264\4\263\264\264\4\263\264\264\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4"
+  "\253\17\264\276\253\253\264\4\34\34\34\34\11\241\13\4\244\244"
+  "\244\32\263\32\32\264\4\4\264\264\264\264\264\4\4\4\4\4"
+  "\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\4\323\322"
+  "\263\264\263\250\263\264\4\4\4\4\17\264\264\264\264"
+};
@@ -0,0 +1,611 @@
+static const struct { uint16_t w, h, levels, format; uint8_t d[]; } twilight_mips =
+{
+  128, 128, 6, R3D_TEXTURE_BC1,
+  "\237\355\0\0\125\65\5\15\177\345\117\151\255\0\0\0\237\355"
+  "\1\0\172\0\0\0\77\345\0\0\125\126\120\140\137\345\0\0"
+  "\125\45\1\2\237\355\106\50\275\0\0\0\137\355\1\0\170\0"
+  "\0\0\137\355\0\0\125\126\120\120\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\77\345\0\0\125\125\45\1\137\345\0\0\125\13\0\0"
+  "\177\355\0\0\125\160\0\0\277\344\0\0\125\125\25\6\77\345"
+  "\0\0\125\212\0\0\177\355\0\0\125\176\0\0\37\345\0\0"
+  "\125\125\126\120\177\355\0\0\11\11\15\5\177\345\177\345\0\0"
+  "\0\0\177\345\177\345\0\0\0\0\177\345\0\0\140\140\160\160"
+  "\237\355\4\30\2\2\2\1\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\177\355\0\0\120\120\120\130\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\245\40"
+  "\0\0\125\25\25\125\277\355\265\212\1\0\0\1\177\345\177\345"
+  "\0\0\0\0\237\345\177\345\125\125\125\25\177\355\104\30\4\14"
+  "\4\7\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0"
+  "\177\355\0\0\140\100\100\100\177\355\0\0\65\225\125\125\177\355"
+  "\0\0\0\0\57\125\137\355\0\0\0\200\136\125\177\355\0\0"
+  "\120\126\125\125\177\355\0\0\11\45\125\125\137\345\0\0\0\0"
+  "\352\125\177\355\0\0\0\200\177\125\137\355\0\0\124\225\65\25"
+  "\137\345\0\0\125\252\0\0\137\345\0\0\125\252\0\0\137\345"
+  "\0\0\125\252\0\0\137\345\0\0\125\252\0\0\137\345\0\0"
+  "\125\252\0\0\137\345\0\0\125\252\0\0\137\345\0\0\125\252"
+  "\0\0\377\344\0\0\125\126\130\120\306\50\0\0\125\125\125\25"
+  "\137\355\0\0\125\253\0\0\77\345\0\0\125\252\0\0\77\345"
+  "\0\0\125\252\0\0\77\345\0\0\125\252\0\0\77\345\0\0"
+  "\125\252\0\0\77\345\0\0\125\252\0\0\77\345\0\0\125\252"
+  "\0\0\137\355\0\0\125\152\100\100\137\355\0\0\1\15\225\125"
+  "\77\345\0\0\0\0\0\125\137\345\0\0\0\300\132\125\337\344"
+  "\0\0\5\25\125\125\177\355\0\0\0\0\55\125\137\345\0\0"
+  "\0\0\350\125\77\345\0\0\140\130\125\125\337\365\0\0\125\15"
+  "\15\5\277\355\102\10\125\0\0\0\277\355\102\10\125\0\0\0"
+  "\277\355\102\10\125\0\0\0\277\355\102\10\125\0\0\0\277\355"
+  "\102\10\125\0\0\0\277\355\102\10\125\0\0\0\177\355\1\0"
+  "\25\260\340\140\337\355\177\345\125\125\126\124\177\345\177\345\0\0"
+  "\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0"
+  "\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\277\355\0\0\120\120\120\120\357\151\0\0"
+  "\225\25\25\325\277\355\177\345\126\126\125\124\177\345\177\345\0\0"
+  "\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0"
+  "\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\137\355\0\0\160\20\20\30\277\355\205\40"
+  "\125\0\0\0\277\355\245\50\125\0\0\0\277\355\245\40\125\0"
+  "\0\0\237\355\306\50\125\0\0\0\237\355\306\50\125\0\0\0"
+  "\237\355\306\50\125\0\0\0\237\355\245\40\125\0\0\0\237\355"
+  "\0\0\5\5\5\5\177\345\177\345\0\0\0\0\177\345\177\345"
+  "\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0"
+  "\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0"
+  "\77\345\0\0\140\140\140\140\137\345\1\0\2\3\1\11\177\345"
+  "\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345"
+  "\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0"
+  "\0\0\177\345\177\345\0\0\0\0\277\355\0\0\160\120\120\120"
+  "\245\40\0\0\25\25\225\325\377\365\177\345\126\126\126\124\177\345"
+  "\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345"
+  "\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0"
+  "\0\0\237\345\177\345\125\125\125\25\37\355\0\0\34\24\26\27"
+  "\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345"
+  "\0\0\0\0\177\345\177\345\0\0\0\0\177\345\373\262\0\300"
+  "\300\100\77\345\0\0\45\45\25\225\177\345\177\345\0\0\0\0"
+  "\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345"
+  "\0\0\0\0\137\345\0\0\140\140\160\160\177\355\0\0\15\5"
+  "\45\65\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0"
+  "\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\177\345\177\345\0\0\0\0\77\355\0\0"
+  "\120\130\130\134\0\0\0\0\0\0\0\0\277\355\23\202\0\0"
+  "\2\1\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0"
+  "\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\237\355\1\0\0\200\300\100\235\303\0\0"
+  "\25\25\25\25\177\345\177\345\0\0\0\0\177\345\177\345\0\0"
+  "\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0"
+  "\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\355"
+  "\1\0\200\300\100\160\101\10\0\0\25\125\125\125\177\355\0\0"
+  "\0\2\1\11\177\345\177\345\0\0\0\0\177\345\177\345\0\0"
+  "\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0"
+  "\177\345\177\345\0\0\0\0\177\355\0\0\160\120\120\130\237\334"
+  "\0\0\25\225\325\125\337\355\177\334\252\252\250\251\177\345\177\345"
+  "\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0"
+  "\0\0\177\345\177\345\0\0\0\0\237\345\177\345\125\125\125\25"
+  "\77\365\0\0\124\124\126\127\0\0\0\0\0\0\0\0\237\355"
+  "\0\0\3\1\1\11\177\345\177\345\0\0\0\0\177\345\177\345"
+  "\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0"
+  "\0\0\177\345\177\345\0\0\0\0\177\355\0\0\140\160\120\130"
+  "\265\222\0\0\25\225\325\125\277\355\177\345\125\125\124\126\177\345"
+  "\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345"
+  "\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0"
+  "\0\0\37\355\0\0\120\134\124\126\0\0\0\0\0\0\0\0"
+  "\237\355\0\0\15\5\45\65\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345"
+  "\0\0\0\0\177\345\177\345\0\0\0\0\137\355\0\0\134\134"
+  "\124\124\0\0\0\0\0\0\0\0\177\355\0\0\2\1\1\15"
+  "\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\177\345\177\345\0\0\0\0\237\355\1\0"
+  "\0\200\300\100\41\0\0\0\124\125\125\125\0\0\0\0\0\0"
+  "\0\0\237\355\0\0\15\5\45\65\177\345\177\345\0\0\0\0"
+  "\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\277\355\72\263\0\0\0\100\137\355\0\0"
+  "\134\124\126\125\0\0\0\0\0\0\0\0\237\355\1\0\2\3"
+  "\3\1\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0"
+  "\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0\237\355"
+  "\3\10\0\0\300\100\245\40\0\0\124\125\125\125\0\0\0\0"
+  "\0\0\0\0\77\355\0\0\25\225\325\125\337\355\177\345\125\125"
+  "\126\124\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0"
+  "\177\345\177\345\0\0\0\0\237\345\177\345\125\25\25\125\337\344"
+  "\0\0\126\127\127\134\137\355\0\0\125\125\325\45\177\355\1\0"
+  "\237\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0"
+  "\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0"
+  "\137\355\0\0\140\160\120\130\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\77\334\0\0\25\325\125\125\277\355\132\263"
+  "\0\0\0\1\177\345\177\345\0\0\0\0\177\345\177\345\0\0"
+  "\0\0\177\345\177\345\0\0\0\0\177\345\1\0\160\0\0\0"
+  "\177\355\0\0\137\130\120\300\40\0\0\0\125\125\125\124\77\345"
+  "\1\0\1\11\11\2\177\345\177\345\0\0\0\0\177\345\177\345"
+  "\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0"
+  "\0\0\177\355\0\0\100\140\160\120\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\237\355"
+  "\220\151\0\2\3\1\177\345\177\345\0\0\0\0\177\345\177\345"
+  "\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0"
+  "\0\0\237\345\267\232\160\0\0\0\377\355\336\313\241\252\252\252"
+  "\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345"
+  "\0\0\0\0\177\355\0\0\130\140\300\0\102\20\0\0\125\125"
+  "\125\124\0\0\0\0\0\0\0\0\137\355\0\0\125\25\45\15"
+  "\177\345\77\345\1\0\0\0\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345"
+  "\0\0\0\0\237\345\177\345\25\125\125\125\277\355\227\232\334\0"
+  "\0\0\277\355\177\345\124\125\125\125\177\345\177\345\0\0\0\0"
+  "\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\137\355\0\0\120\130\134\134\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\177\355\0\0\2\45\65\65\177\345\177\345\0\0\0\0"
+  "\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345"
+  "\0\0\0\0\177\345\177\345\0\0\0\0\71\373\337\345\125\125"
+  "\125\65\323\371\277\355\135\131\131\321\77\367\77\345\125\126\130\125"
+  "\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0\37\345"
+  "\0\0\134\134\124\126\0\0\0\0\0\0\0\0\237\355\1\0"
+  "\3\2\1\11\177\345\177\345\0\0\0\0\177\345\137\345\0\0"
+  "\100\0\376\363\277\346\377\277\65\213\266\372\37\346\127\126\124\154"
+  "\237\355\177\345\125\125\125\124\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345"
+  "\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0"
+  "\0\0\277\355\2\10\0\200\100\100\237\355\0\0\134\125\125\125"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\77\345\0\0\45\45\45\45\177\345\177\345"
+  "\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0"
+  "\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0"
+  "\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0\131\372"
+  "\137\347\267\377\77\257\260\371\377\355\200\102\2\121\237\364\237\345"
+  "\125\125\127\124\177\345\177\345\0\0\0\0\237\355\14\111\0\0"
+  "\300\100\204\30\0\0\124\125\125\125\0\0\0\0\0\0\0\0"
+  "\177\355\0\0\15\5\5\45\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\321\371\177\355\45\25\5\325\260\371\277\355"
+  "\160\130\150\364\277\377\137\345\124\127\125\125\177\345\177\345\0\0"
+  "\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0"
+  "\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\237\355\11\101\100\100\100\100\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\237\355\0\0\45\65\65\25"
+  "\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345"
+  "\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0"
+  "\0\0\137\366\137\345\125\165\205\125\24\372\277\345\121\131\125\125"
+  "\337\366\137\345\125\124\127\125\177\345\177\345\0\0\0\0\177\355"
+  "\0\0\100\140\160\120\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\137\355\0\0\65\25\225\125\237\345\177\345\125\125"
+  "\125\124\177\345\177\345\0\0\0\0\77\377\77\345\125\361\135\125"
+  "\165\372\377\345\124\126\125\125\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345"
+  "\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0"
+  "\0\0\177\345\177\345\0\0\0\0\237\355\0\0\300\100\100\100"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\137\355\0\0"
+  "\25\25\25\25\177\345\177\345\0\0\0\0\177\345\177\345\0\0"
+  "\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0"
+  "\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345"
+  "\0\0\0\0\177\345\177\345\0\0\0\0\237\355\1\0\0\0"
+  "\300\160\237\345\0\0\124\127\125\125\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\177\355"
+  "\0\0\3\11\45\325\337\355\177\345\125\125\125\124\177\345\177\345"
+  "\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0"
+  "\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0"
+  "\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\177\345\177\345\0\0\0\0\77\345\0\0"
+  "\140\140\140\100\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\177\355\0\0\25\65\45\5\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345"
+  "\0\0\0\0\337\355\177\345\125\125\125\45\177\345\55\121\0\0"
+  "\0\176\277\355\103\30\0\0\0\127\277\355\0\0\0\0\0\125"
+  "\177\355\0\0\0\0\370\125\177\355\0\0\0\160\125\125\357\151"
+  "\0\0\124\125\125\125\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\77\345\0\0\11\225\125\125"
+  "\237\355\0\0\0\0\365\125\237\355\0\0\0\0\2\125\277\355"
+  "\42\10\0\0\0\125\237\355\146\40\0\0\0\365\277\355\226\222"
+  "\0\0\0\11\177\345\177\345\0\0\0\0\177\345\177\345\0\0"
+  "\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0"
+  "\237\355\1\0\100\100\300\200\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\177\355\0\0\15\15\125\125\177\355\0\0\0\0"
+  "\13\325\277\355\276\313\0\0\0\1\177\345\177\345\0\0\0\0"
+  "\177\345\52\101\0\0\0\100\377\344\0\0\160\126\125\125\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\103\20\0\0\125\125\125\25\172\372\0\0\125\125"
+  "\265\0\233\372\0\0\125\125\136\300\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\316\141\0\0\25\125\125\125\177\355\0\0\0\11\5\45\177\345"
+  "\177\345\0\0\0\0\237\345\177\345\125\125\125\25\177\355\1\0"
+  "\0\0\0\130\237\355\0\0\0\0\136\125\306\50\0\0\125\124"
+  "\125\125\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\61\172\0\0\51\125\125\125\77\355\0\0"
+  "\2\265\125\125\177\355\0\0\100\100\151\125\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\70\372\0\0\25\5\15\11\221\371"
+  "\121\371\244\252\252\252\173\372\161\371\25\125\125\125\173\372\0\0"
+  "\127\124\130\120\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\177\365\0\0\65\25"
+  "\25\125\237\355\0\0\0\140\127\125\276\313\0\0\350\125\125\125"
+  "\245\40\0\0\124\125\125\125\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\366\371\42\0\1\1"
+  "\3\3\161\371\161\371\0\0\0\0\161\371\161\371\0\0\0\0"
+  "\365\371\41\0\160\140\140\100\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\367\371"
+  "\41\0\3\1\11\15\161\371\161\371\0\0\0\0\161\371\161\371"
+  "\0\0\0\0\30\372\0\0\140\160\120\130\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\173\372\0\0\5\65\225\125\161\371\172\312\0\0\2\45"
+  "\366\371\145\50\0\0\0\100\233\352\0\0\134\126\125\125\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\61\162\0\0\125\125\125\25\10\71\0\0"
+  "\125\125\125\124\102\10\0\0\125\125\125\25\265\222\0\0\125\125"
+  "\125\57\137\355\0\0\125\125\125\2\277\355\0\0\125\125\365\0"
+  "\237\355\0\0\125\125\377\0\177\345\0\0\125\125\377\0\277\355"
+  "\0\0\125\125\377\0\337\365\0\0\125\125\127\0\77\365\0\0"
+  "\265\125\125\0\177\365\0\0\127\125\125\0\337\355\0\0\125\125"
+  "\325\0\237\355\0\0\125\125\377\0\177\345\0\0\125\125\377\0"
+  "\237\355\0\0\125\125\377\0\337\355\0\0\125\125\127\0\77\365"
+  "\0\0\125\125\125\240\61\172\0\0\125\125\125\170\0\0\0\0"
+  "\0\0\0\0\316\141\0\0\125\125\125\65\10\71\0\0\125\125"
+  "\125\124\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\41\0\0\0\125\125\125\25\177\355\0\0\5\11\3\0"
+  "\337\355\175\273\160\0\0\0\37\356\37\324\11\252\252\252\337\355"
+  "\177\345\130\125\125\125\177\345\177\345\0\0\0\0\177\345\177\345"
+  "\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0"
+  "\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0"
+  "\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345"
+  "\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0"
+  "\0\0\177\345\177\345\0\0\0\0\337\355\177\345\15\125\125\125"
+  "\377\355\276\313\160\252\252\252\337\355\276\313\1\0\0\0\177\355"
+  "\0\0\124\120\140\300\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\137\355\0\0\225\65\5\1\177\345\177\345"
+  "\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0"
+  "\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0"
+  "\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345"
+  "\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0"
+  "\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0"
+  "\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345"
+  "\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0"
+  "\0\0\177\345\137\345\100\0\0\0\137\345\0\0\125\126\134\120"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\377\323\0\0\125\125\225\25\277\355\20\152\1\0\0\0"
+  "\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345"
+  "\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0"
+  "\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0"
+  "\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345"
+  "\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0"
+  "\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0"
+  "\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\177\345\177\345\0\0\0\0\237\355\1\0"
+  "\140\300\0\0\102\20\0\0\125\125\125\124\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\237\365\0\0\25\65\5\5\177\345\177\345"
+  "\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0"
+  "\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0"
+  "\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345"
+  "\0\0\0\0\237\345\77\313\200\140\0\0\237\345\377\312\377\125"
+  "\0\0\237\345\377\312\277\125\0\0\177\345\37\324\0\1\0\0"
+  "\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345"
+  "\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0"
+  "\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0"
+  "\177\345\177\345\0\0\0\0\137\365\0\0\127\126\124\134\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\237\355\0\0\15\15\5\5"
+  "\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345"
+  "\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0"
+  "\0\0\177\355\4\41\0\0\100\160\177\355\343\30\0\0\265\125"
+  "\237\355\343\30\0\0\2\125\237\345\354\131\0\0\0\1\177\345"
+  "\337\334\0\20\0\0\177\345\277\334\0\4\0\0\137\345\203\30"
+  "\0\0\0\140\77\345\343\30\0\0\200\125\177\355\302\30\0\0"
+  "\127\125\177\345\344\40\0\0\2\1\177\345\177\345\0\0\0\0"
+  "\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345"
+  "\0\0\0\0\177\345\177\345\0\0\0\0\137\355\0\0\130\130"
+  "\134\134\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\37\345\0\0"
+  "\5\45\45\65\177\345\177\345\0\0\0\0\177\345\177\345\0\0"
+  "\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0"
+  "\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\177\355\3\41\130\124\134\120\44\41\44\41"
+  "\0\0\0\0\262\202\3\31\125\125\125\25\177\355\244\30\11\3"
+  "\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0"
+  "\177\355\343\30\120\140\100\0\44\41\3\31\0\0\0\1\44\41"
+  "\44\41\0\0\0\0\137\355\303\30\15\5\5\11\177\345\177\345"
+  "\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0"
+  "\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0"
+  "\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0\77\355"
+  "\0\0\124\124\124\126\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\237\355\0\0\65\25\325\125\277\355\61\162\0\0\0\1\177\345"
+  "\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345"
+  "\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0"
+  "\0\0\177\345\177\345\0\0\0\0\137\345\344\40\140\0\0\0"
+  "\77\345\343\30\125\127\200\0\177\355\4\41\65\5\2\0\177\345"
+  "\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345"
+  "\0\0\0\0\177\345\177\345\0\0\0\0\177\355\344\40\126\134"
+  "\240\0\137\355\343\30\125\65\2\0\237\355\161\162\1\0\0\0"
+  "\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345"
+  "\0\0\0\0\177\345\177\345\0\0\0\0\177\355\1\0\0\0"
+  "\200\100\123\202\0\0\124\126\125\125\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\37\345\0\0\11\5"
+  "\25\125\277\355\177\345\125\125\125\124\177\345\177\345\0\0\0\0"
+  "\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345"
+  "\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0"
+  "\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0"
+  "\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345"
+  "\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0"
+  "\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0"
+  "\177\345\177\345\0\0\0\0\277\355\61\162\0\0\0\100\137\345"
+  "\0\0\120\124\127\125\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\177\355\0\0\3\11\225\125\237\355\44\30"
+  "\0\0\0\11\177\345\177\345\0\0\0\0\177\345\177\345\0\0"
+  "\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0"
+  "\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345"
+  "\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0"
+  "\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0"
+  "\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345"
+  "\0\0\0\0\177\355\1\0\0\0\0\160\137\355\0\0\140\130"
+  "\127\125\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\71\253\0\0\25\125\125\125\237\355\0\0\0\11\325\125\237\355"
+  "\1\0\0\0\2\265\337\355\235\303\0\0\0\1\177\345\177\345"
+  "\0\0\0\0\237\345\177\345\125\125\125\25\337\355\33\263\0\0"
+  "\0\140\237\355\1\0\0\0\200\136\177\355\0\0\0\200\127\125"
+  "\137\355\0\0\240\127\125\125\137\355\0\0\2\265\125\125\177\355"
+  "\0\0\0\0\265\125\237\355\1\0\0\0\0\275\337\355\377\323"
+  "\252\252\252\1\177\345\177\345\0\0\0\0\177\345\177\345\0\0"
+  "\0\0\337\355\227\222\0\0\0\140\237\355\0\0\0\0\300\127"
+  "\137\355\0\0\0\170\125\125\112\101\0\0\124\125\125\125\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\122\172\0\0\65\125\125\125"
+  "\265\222\0\0\0\125\125\125\265\222\0\0\200\125\125\125\347\60"
+  "\0\0\124\125\125\125\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\214\121\0\0\65\125\125\125\265\222\0\0\0\125\125\125\265\222"
+  "\0\0\0\125\125\125\153\111\0\0\124\125\125\125\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\177\345\0\0\55\1\3\1\137\345\0\0\172\100\300\300"
+  "\137\345\0\0\255\2\0\2\177\355\0\0\130\100\100\100\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\137\345\0\0\125\65\5\5\177\345"
+  "\144\30\175\0\0\0\177\355\1\0\365\11\2\3\177\345\0\0"
+  "\127\140\300\200\237\355\0\0\15\365\251\1\177\345\0\0\140\127"
+  "\252\0\177\345\0\0\3\365\252\0\177\345\0\0\360\227\252\300"
+  "\177\345\153\111\125\0\0\0\177\345\153\111\125\0\0\0\177\345"
+  "\153\111\125\0\0\0\177\355\0\0\177\100\100\100\137\345\0\0"
+  "\365\5\15\5\177\345\315\131\125\0\0\0\177\345\315\131\125\0"
+  "\0\0\177\345\315\131\125\0\0\0\177\345\0\0\67\334\254\14"
+  "\177\345\1\10\200\177\252\0\177\345\0\0\11\325\252\0\137\345"
+  "\0\0\100\137\252\0\177\345\0\0\1\1\11\15\177\345\177\345"
+  "\0\0\0\0\177\345\177\345\0\0\0\0\177\345\307\60\300\100"
+  "\100\100\177\345\0\0\2\3\1\11\177\345\177\345\0\0\0\0"
+  "\177\345\177\345\0\0\0\0\177\355\0\0\100\100\100\140\177\355"
+  "\0\0\5\5\5\5\177\345\177\345\0\0\0\0\177\345\177\345"
+  "\0\0\0\0\177\345\123\213\0\0\0\100\177\345\1\0\16\17"
+  "\15\15\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0"
+  "\177\345\52\111\0\0\200\100\177\345\0\0\5\65\25\225\177\345"
+  "\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345\0\0"
+  "\100\100\140\160\137\345\0\0\15\5\45\65\177\345\177\345\0\0"
+  "\0\0\177\345\177\345\0\0\0\0\177\345\0\0\140\160\120\130"
+  "\137\345\0\0\45\65\25\225\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\137\345\0\0\300\100\140\160\177\345\0\0"
+  "\15\5\45\45\177\345\177\345\0\0\0\0\177\345\177\345\0\0"
+  "\0\0\137\345\0\0\140\160\120\130\116\152\0\0\25\325\125\125"
+  "\177\345\371\263\0\0\0\1\177\345\177\345\0\0\0\0\177\345"
+  "\0\0\160\160\0\0\137\345\0\0\245\15\0\0\177\345\177\345"
+  "\0\0\0\0\177\345\177\345\0\0\0\0\137\345\0\0\134\124"
+  "\124\120\275\314\0\0\325\125\325\25\177\345\376\334\0\1\0\0"
+  "\177\345\177\345\0\0\0\0\177\345\1\0\150\300\0\0\137\345"
+  "\0\0\65\45\0\0\177\345\177\345\0\0\0\0\177\345\177\345"
+  "\0\0\0\0\137\345\0\0\134\124\124\126\0\0\0\0\0\0"
+  "\0\0\137\345\0\0\3\11\11\11\177\345\177\345\0\0\0\0"
+  "\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0\62\372"
+  "\277\355\125\165\205\255\37\366\137\345\127\124\125\125\137\345\0\0"
+  "\140\160\120\130\137\355\0\0\45\65\25\25\177\345\177\345\0\0"
+  "\0\0\62\372\177\355\125\165\111\351\37\356\177\345\125\125\124\125"
+  "\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345"
+  "\362\202\200\100\300\300\14\132\0\0\124\125\125\125\0\0\0\0"
+  "\0\0\0\0\177\345\0\0\11\11\11\11\177\345\177\345\0\0"
+  "\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0"
+  "\73\364\237\345\105\125\125\125\237\355\55\142\0\0\0\100\137\345"
+  "\0\0\134\124\127\125\362\202\0\0\25\325\125\125\177\345\0\0"
+  "\0\0\2\11\73\364\237\345\105\125\125\125\177\345\177\345\0\0"
+  "\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0"
+  "\177\345\255\131\300\300\100\100\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\137\345\0\0\11\1\1\265\177\345\37\345"
+  "\0\0\0\1\177\345\0\0\0\0\140\130\137\345\0\0\0\250"
+  "\125\125\177\345\0\0\0\172\125\125\77\374\0\0\130\125\125\353"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\124\223"
+  "\0\0\65\125\125\125\177\355\0\0\0\275\125\125\177\345\0\0"
+  "\0\252\125\125\177\355\0\0\0\0\45\25\177\345\177\345\0\0"
+  "\0\0\137\345\0\0\200\200\0\170\41\10\0\0\125\125\124\125"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\267\253"
+  "\0\0\55\125\125\125\177\345\0\0\130\135\125\125\0\0\0\0"
+  "\0\0\0\0\264\361\0\0\225\65\45\45\264\371\161\371\25\125"
+  "\125\125\325\361\0\0\127\124\134\134\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\22\213\0\0\25\325\125\125\77\345\0\0"
+  "\370\125\125\125\41\10\0\0\124\125\125\125\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\264\361\0\0\45\65\25\325\161\371\366\261"
+  "\0\0\0\103\365\351\0\0\134\124\126\125\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\177\355\0\0\125\125"
+  "\1\2\237\355\0\0\125\325\0\0\177\345\0\0\125\253\0\0"
+  "\177\345\0\0\125\252\0\0\177\345\0\0\125\252\0\0\177\345"
+  "\1\0\135\276\0\0\177\345\0\0\125\252\0\0\177\345\0\0"
+  "\125\252\0\0\177\345\0\0\125\352\0\0\177\355\0\0\125\127"
+  "\0\0\137\345\0\0\125\125\140\300\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\137\345\0\0\225\65\5\15\177\345\177\345"
+  "\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0"
+  "\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0"
+  "\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345"
+  "\0\0\0\0\177\345\177\345\0\0\0\0\137\345\0\0\127\124"
+  "\130\120\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\177\355\0\0\11\1\1\1\177\345"
+  "\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345"
+  "\0\0\0\0\177\345\5\41\0\0\0\334\177\345\361\172\0\0"
+  "\0\45\177\345\177\323\125\0\0\0\177\345\57\152\0\0\0\134"
+  "\177\345\343\40\0\0\0\45\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\177\345\177\345\0\0\0\0\137\345\0\0"
+  "\160\140\100\140\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\137\345\0\0\1\11\11\5"
+  "\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\137\345\44\41\126\126\130\0\137\345\4\41"
+  "\65\5\11\0\177\345\177\345\0\0\0\0\137\345\4\41\124\130"
+  "\140\200\137\345\4\41\25\25\15\0\177\345\177\345\0\0\0\0"
+  "\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0\137\345"
+  "\0\0\140\160\160\130\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\37\345\0\0\65\325"
+  "\125\125\177\345\0\0\0\0\3\55\177\345\177\345\0\0\0\0"
+  "\177\345\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345"
+  "\177\345\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345"
+  "\0\0\0\0\177\345\177\345\0\0\0\0\177\345\177\345\0\0"
+  "\0\0\177\345\177\345\0\0\0\0\177\345\0\0\0\0\300\130"
+  "\30\264\0\0\124\125\125\125\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\347\60\0\0\25\125\125\125\137\345\0\0\2\265"
+  "\125\125\137\345\0\0\0\0\375\125\177\355\0\0\0\0\137\125"
+  "\137\345\0\0\0\136\125\125\226\243\0\0\54\125\125\125\137\345"
+  "\0\0\0\255\125\125\177\345\0\0\0\0\365\125\177\355\0\0"
+  "\0\0\137\125\137\345\0\0\200\136\125\125\103\20\0\0\124\125"
+  "\125\125\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\137\345"
+  "\204\30\303\202\171\253\137\345\151\101\153\300\171\252\137\345\0\0"
+  "\125\125\252\0\137\345\0\0\125\125\352\200\137\345\0\0\125\125"
+  "\251\1\137\345\0\0\125\125\252\0\137\345\0\0\255\1\256\252"
+  "\137\345\245\40\151\202\151\252\177\345\0\0\2\3\1\15\177\345"
+  "\151\101\200\300\300\100\177\345\0\0\2\3\1\11\177\345\0\0"
+  "\200\300\300\100\177\355\0\0\1\1\11\15\177\345\7\61\0\0"
+  "\300\100\177\345\0\0\3\3\1\1\177\345\0\0\0\200\300\100"
+  "\137\345\0\0\5\5\45\65\177\345\305\50\100\0\0\0\137\355"
+  "\144\40\11\0\0\200\177\355\0\0\140\140\300\100\177\345\0\0"
+  "\5\15\11\11\177\355\120\202\140\0\0\12\177\345\0\0\11\0"
+  "\0\0\177\345\0\0\140\160\120\120\137\345\0\0\65\65\65\265"
+  "\177\345\306\50\0\0\0\100\177\345\0\0\0\0\250\125\177\345"
+  "\0\0\140\120\127\137\177\345\0\0\15\45\325\125\177\355\0\0"
+  "\0\0\52\125\177\345\41\10\0\0\0\11\137\345\0\0\130\130"
+  "\120\130\0\0\0\0\0\0\0\0\156\152\0\0\113\125\125\125"
+  "\221\311\0\0\225\25\25\325\222\371\1\0\160\140\140\120\0\0"
+  "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\156\152\0\0"
+  "\311\125\125\125\0\0\0\0\0\0\0\0\177\345\0\0\125\45"
+  "\15\1\177\345\0\0\365\0\0\0\177\345\211\101\125\0\0\0"
+  "\177\345\151\101\125\0\0\0\177\345\47\61\125\0\0\0\177\345"
+  "\0\0\125\200\0\0\274\314\0\0\125\125\127\124\0\0\0\0"
+  "\0\0\0\0\177\345\245\40\3\3\3\1\177\345\177\345\0\0"
+  "\0\0\137\345\4\41\0\50\27\50\137\345\4\41\0\200\140\200"
+  "\177\345\4\41\0\2\11\2\177\345\177\345\0\0\0\0\137\345"
+  "\0\0\134\134\134\124\0\0\0\0\0\0\0\0\177\345\0\0"
+  "\15\65\125\125\177\345\0\0\0\0\13\125\177\345\0\0\0\0"
+  "\240\125\177\345\0\0\0\0\57\125\177\345\1\10\0\0\0\125"
+  "\177\345\0\0\0\300\136\125\47\61\0\0\124\125\125\125\0\0"
+  "\0\0\0\0\0\0\137\345\252\111\252\377\202\201\137\345\0\0"
+  "\125\200\202\203\137\345\0\0\125\3\2\203\177\345\212\111\351\373"
+  "\2\303\177\345\0\0\201\11\11\211\137\345\0\0\302\200\300\177"
+  "\137\355\0\0\1\3\1\365\177\345\0\0\302\100\100\142\177\345"
+  "\0\0\125\125\255\3\36\365\0\20\155\145\252\0\177\345\0\0"
+  "\125\125\352\0\211\101\0\0\133\125\125\124\177\345\0\0\2\2"
+  "\1\265\137\345\244\40\0\213\0\337\177\345\0\0\0\2\200\172"
+  "\165\223\0\0\124\124\125\125\76\335\251\111\173\242\203\141\36\335"
+  "\107\71\255\42\302\311\137\345\0\10\325\13\40\253\177\345\0\0"
+  "\125\130\160\132\131\274\41\10\50\52\173\100"
+};
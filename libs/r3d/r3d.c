@@ -6,6 +6,11 @@
 #include <string.h>
 #include <r3d.h>
 
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && !defined(R3D_NO_HOST_SIMD)
+#define R3D_HOST_SIMD // host builds: 8 pixel loop, see r3d_triangle_wide
+#include <immintrin.h>
+#endif
+
 typedef void (*r3d_primitive_rasterizer_func)(const float *in);
 static void r3d_points_rasterizer(const float *in);
 static void r3d_lines_rasterizer(const float *in);
@@ -20,7 +25,12 @@ static void r3d_triangle_fan_rasterizer(const float *in);
 // public variables
 r3d_switch_t r3d_backface_culling = R3D_DISABLE;
 r3d_primitive_winding_t r3d_primitive_winding = R3D_PRIMITIVE_WINDING_CCW;
+r3d_rasterizer_loop_t r3d_rasterizer_loop = R3D_RASTERIZER_LOOP_AUTO;
 r3d_shader_t r3d_shader = {0};
+vec3_t r3d_eye_position = {0};
+r3d_switch_t r3d_eye_mirrored = R3D_DISABLE;
+int r3d_texcoord_area = 0;
+r3d_texture_cache_stats_t r3d_texture_cache_stats = {0};
 
 // private variables
 static vec2_t r3d_viewport_position = {0};
@@ -29,6 +39,26 @@ static int r3d_viewport_width = 0;
 static int r3d_viewport_height = 0;
 static float *r3d_primitive_vertex_buffer;
 static uint8_t r3d_primitive_vertex_index = 0;
+static uint8_t r3d_varyings_smooth[R3D_VERTEX_ELEMENTS_MAX]; // element indices
+static uint8_t r3d_varyings_smooth_count = 0;
+static uint8_t r3d_varyings_flat[R3D_VERTEX_ELEMENTS_MAX];
+static uint8_t r3d_varyings_flat_count = 0;
+static r3d_shading_t r3d_shading = R3D_SHADING_FRAGMENT; // of the current draw call
+static uint16_t r3d_flat_color565; // R3D_SHADING_FLAT color of the current primitive
+static vec3_t r3d_flat_color;
+
+typedef struct {
+	const void *source; // original data
+	uint8_t *copy; // in the pool
+	uint32_t size;
+	uint32_t bound; // r3d_texture_cache_time of the last bind (one per draw call)
+} r3d_texture_cache_entry_t;
+
+static uint8_t *r3d_texture_cache_pool = 0;
+static uint32_t r3d_texture_cache_size = 0;
+static r3d_texture_cache_entry_t r3d_texture_cache_entries[R3D_TEXTURE_CACHE_ENTRIES]; // sorted by copy
+static int r3d_texture_cache_count = 0;
+static uint32_t r3d_texture_cache_time = 0;
 static r3d_primitive_rasterizer_func r3d_primitive_rasterizers[R3D_PRIMITIVE_TYPE_NUM] = {
 	r3d_points_rasterizer,
 	r3d_lines_rasterizer,
@@ -42,6 +72,15 @@ static r3d_primitive_rasterizer_func r3d_primitive_rasterizers[R3D_PRIMITIVE_TYP
 	//r3d_quad_strip_rasterizer
 };
 
+// quantized normal decoding table
+#define R3D_SNORM8_1(i) ((float)(i) * (2.0f / 255.0f) - 1.0f)
+#define R3D_SNORM8_4(i) R3D_SNORM8_1(i), R3D_SNORM8_1(i + 1), R3D_SNORM8_1(i + 2), R3D_SNORM8_1(i + 3)
+#define R3D_SNORM8_16(i) R3D_SNORM8_4(i), R3D_SNORM8_4(i + 4), R3D_SNORM8_4(i + 8), R3D_SNORM8_4(i + 12)
+#define R3D_SNORM8_64(i) R3D_SNORM8_16(i), R3D_SNORM8_16(i + 16), R3D_SNORM8_16(i + 32), R3D_SNORM8_16(i + 48)
+const float r3d_snorm8[256] = {
+	R3D_SNORM8_64(0), R3D_SNORM8_64(64), R3D_SNORM8_64(128), R3D_SNORM8_64(192)
+};
+
 void r3d_viewport(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
 {
 	r3d_viewport_position.x = x0;
@@ -52,10 +91,272 @@ void r3d_viewport(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
 	r3d_viewport_height = y1 - y0;
 }
 
+// in bytes
+static uint32_t r3d_texture_level_size(int format, uint32_t width, uint32_t height)
+{
+	switch (format) {
+	case R3D_TEXTURE_P8: return width * height;
+	case R3D_TEXTURE_P4:
+	case R3D_TEXTURE_BC1: return (width * height + 1) / 2;
+	default: return width * height * sizeof(uint16_t);
+	}
+}
+
+void r3d_mipmap_sampler(r3d_mipmap_sampler_t *s, const r3d_mipmap_t *mipmap)
+{
+	const uint8_t *data = (const uint8_t *)mipmap->data;
+	const uint16_t *palette = 0;
+	uint16_t width = mipmap->width, height = mipmap->height;
+	if (mipmap->format == R3D_TEXTURE_P8 || mipmap->format == R3D_TEXTURE_P4) {
+		palette = mipmap->data;
+		data += (mipmap->format == R3D_TEXTURE_P8 ? 256 : 16) * sizeof(uint16_t);
+	}
+	s->levels = int_min(mipmap->levels, R3D_MIPMAP_LEVELS_MAX);
+	s->log2area = __builtin_ctz(width) + __builtin_ctz(height);
+	for (int i = 0; i < s->levels; i++) {
+		r3d_sampler_t *l = &s->level[i];
+		*l = r3d_sampler_data((const uint16_t *)data, width, height);
+		l->format = mipmap->format;
+		l->palette = palette;
+		if (mipmap->format == R3D_TEXTURE_RGB565_TILED && width >= 4 && height >= 4)
+			l->tile = 2;
+		data += r3d_texture_level_size(mipmap->format, width, height);
+		width = int_max(width >> 1, 1);
+		height = int_max(height >> 1, 1);
+	}
+}
+
+void r3d_texture_cache_init(void *pool, uint32_t size)
+{
+	r3d_texture_cache_pool = pool;
+	r3d_texture_cache_size = size;
+	r3d_texture_cache_count = 0;
+}
+
+static void r3d_texture_cache_remove(int i)
+{
+	r3d_texture_cache_count--;
+	memmove(&r3d_texture_cache_entries[i], &r3d_texture_cache_entries[i + 1],
+	        (r3d_texture_cache_count - i) * sizeof(r3d_texture_cache_entry_t));
+}
+
+// first fit, evicting the least recently bound entries which are not
+// bound for the current draw call. returns the insert position or -1.
+static int r3d_texture_cache_alloc(uint32_t size, uint8_t **copy)
+{
+	for (;;) {
+		uint8_t *begin = r3d_texture_cache_pool;
+		for (int i = 0; i <= r3d_texture_cache_count; i++) {
+			uint8_t *end = i < r3d_texture_cache_count ? r3d_texture_cache_entries[i].copy :
+			               r3d_texture_cache_pool + r3d_texture_cache_size;
+			if (end - begin >= (int32_t)size && r3d_texture_cache_count < R3D_TEXTURE_CACHE_ENTRIES) {
+				*copy = begin;
+				return i;
+			}
+			if (i < r3d_texture_cache_count) // 4 byte aligned copies
+				begin = r3d_texture_cache_entries[i].copy + ((r3d_texture_cache_entries[i].size + 3) & ~3);
+		}
+		int lru = -1;
+		for (int i = 0; i < r3d_texture_cache_count; i++) {
+			r3d_texture_cache_entry_t *e = &r3d_texture_cache_entries[i];
+			if (e->bound != r3d_texture_cache_time &&
+			    (lru < 0 || e->bound < r3d_texture_cache_entries[lru].bound))
+				lru = i;
+		}
+		if (lru < 0)
+			return -1;
+		r3d_texture_cache_remove(lru);
+	}
+}
+
+static const void *r3d_texture_cache_get(const void *source, uint32_t size)
+{
+	for (int i = 0; i < r3d_texture_cache_count; i++) {
+		r3d_texture_cache_entry_t *e = &r3d_texture_cache_entries[i];
+		if (e->source == source) {
+			e->bound = r3d_texture_cache_time;
+			r3d_texture_cache_stats.hits++;
+			return e->copy;
+		}
+	}
+	r3d_texture_cache_stats.misses++;
+	uint8_t *copy;
+	int i = size <= r3d_texture_cache_size ? r3d_texture_cache_alloc(size, &copy) : -1;
+	if (i < 0)
+		return source;
+	memmove(&r3d_texture_cache_entries[i + 1], &r3d_texture_cache_entries[i],
+	        (r3d_texture_cache_count - i) * sizeof(r3d_texture_cache_entry_t));
+	r3d_texture_cache_count++;
+	r3d_texture_cache_entry_t *e = &r3d_texture_cache_entries[i];
+	e->source = source;
+	e->copy = copy;
+	e->size = size;
+	e->bound = r3d_texture_cache_time;
+	memcpy(copy, source, size);
+	r3d_texture_cache_stats.bytes_copied += size;
+	return copy;
+}
+
+void r3d_texture_cache_bind(r3d_mipmap_sampler_t *s)
+{
+	if (!r3d_texture_cache_pool)
+		return;
+	if (s->levels > 0 && s->level[0].palette) {
+		const uint16_t *palette = r3d_texture_cache_get(s->level[0].palette,
+		                          (s->level[0].format == R3D_TEXTURE_P8 ? 256 : 16) * sizeof(uint16_t));
+		for (int i = 0; i < s->levels; i++)
+			s->level[i].palette = palette;
+	}
+	for (int i = s->levels - 1; i >= 0; i--) {
+		r3d_sampler_t *l = &s->level[i];
+		l->data = r3d_texture_cache_get(l->data, r3d_texture_level_size(l->format, l->umask + 1, l->vmask + 1));
+	}
+}
+
+// element index lists from the shader's varying masks
+static void r3d_varyings_setup(void)
+{
+	uint32_t smooth = r3d_shader.varyings_smooth;
+	uint32_t flat = r3d_shader.varyings_flat;
+	if (smooth == 0 && flat == 0)
+		smooth = R3D_VARYINGS(0, r3d_shader.vertex_out_elements);
+
+	r3d_varyings_smooth_count = 0;
+	r3d_varyings_flat_count = 0;
+	for (int i = 0; i < r3d_shader.vertex_out_elements; i++) {
+		if (smooth & R3D_VARYING(i))
+			r3d_varyings_smooth[r3d_varyings_smooth_count++] = i;
+		else if (flat & R3D_VARYING(i))
+			r3d_varyings_flat[r3d_varyings_flat_count++] = i;
+	}
+}
+
+// points in[] to the i-th vertex (or indexed vertex) of all streams
+static inline void r3d_vertex_fetch(const r3d_drawcall_t *drawcall, uint32_t i, const void **in)
+{
+	uint32_t index = drawcall->indices ? drawcall->indices[i] : i;
+	for (int s = 0; s < R3D_VERTEX_STREAMS_MAX; s++) {
+		const uint8_t *vertices = drawcall->streams[s].vertices;
+		in[s] = vertices ? vertices + index * drawcall->streams[s].stride : 0; // unused streams stay 0
+	}
+}
+
+static void r3d_vertexshader_split(const void *uniforms, const void *const *in, float *out)
+{
+	r3d_shader.positionshader(uniforms, in, out);
+	r3d_shader.attributeshader(uniforms, in, out);
+}
+
+static int r3d_triangle_rejected(const float *v0, const float *v1, const float *v2);
+static void r3d_triangle_rasterizer(const float *v0, const float *v1, const float *v2);
+
+// r3d_draw_triangles with r3d_shader.positionshader_n: the positions of up
+// to R3D_TRIANGLE_BATCH front facing triangles in one call
+static void r3d_draw_triangles_batched(const r3d_drawcall_t *drawcall, const r3d_face_t *face,
+                                       int ex, int ey, int ez, int ed, int tolerance)
+{
+	const void *vs_in[3 * R3D_TRIANGLE_BATCH][R3D_VERTEX_STREAMS_MAX];
+	vec3x4_t positions[(3 * R3D_TRIANGLE_BATCH + 3) / 4];
+	float vs_out[3][R3D_VERTEX_ELEMENTS_MAX];
+
+	uint32_t i = 0;
+	while (i + 2 < drawcall->count) {
+		uint32_t n = 0;
+		for (; i + 2 < drawcall->count && n < 3 * R3D_TRIANGLE_BATCH; i += 3) {
+			if (face) {
+				int s = face->nx * ex + face->ny * ey + face->nz * ez - face->d * ed;
+				face++;
+				if (s < -tolerance)
+					continue; // back face
+			}
+			for (int j = 0; j < 3; j++)
+				r3d_vertex_fetch(drawcall, i + j, vs_in[n++]);
+		}
+		if (n == 0)
+			break;
+		r3d_shader.positionshader_n(r3d_shader.uniforms, (const void *const (*)[R3D_VERTEX_STREAMS_MAX])vs_in,
+		                            positions, n);
+		for (uint32_t k = 0; k < n; k += 3) {
+			for (int j = 0; j < 3; j++) {
+				const vec3x4_t *p = &positions[(k + j) / 4];
+				vs_out[j][0] = p->x[(k + j) % 4];
+				vs_out[j][1] = p->y[(k + j) % 4];
+				vs_out[j][2] = p->z[(k + j) % 4];
+			}
+			if (r3d_triangle_rejected(vs_out[0], vs_out[1], vs_out[2]))
+				continue;
+			for (int j = 0; j < 3; j++)
+				r3d_shader.attributeshader(r3d_shader.uniforms, vs_in[k + j], vs_out[j]);
+			r3d_triangle_rasterizer(vs_out[0], vs_out[1], vs_out[2]);
+		}
+	}
+}
+
+// triangle lists: face plane culling in object space (before any vertex
+// is fetched) and split vertex shaders (attributes only for triangles
+// which are actually rasterized)
+static void r3d_draw_triangles(const r3d_drawcall_t *drawcall)
+{
+	const void *vs_in[3][R3D_VERTEX_STREAMS_MAX];
+	float vs_out[3][R3D_VERTEX_ELEMENTS_MAX];
+
+	// eye position in face plane units (127 * 256) and the worst case
+	// error of quantized face planes and eye position in these units
+	const r3d_face_t *face = r3d_backface_culling ? drawcall->faces : 0;
+	int sign = (r3d_primitive_winding == R3D_PRIMITIVE_WINDING_CCW) != (r3d_eye_mirrored != 0) ? 1 : -1;
+	int ex = sign * (int)(r3d_eye_position.x * 256.0f);
+	int ey = sign * (int)(r3d_eye_position.y * 256.0f);
+	int ez = sign * (int)(r3d_eye_position.z * 256.0f);
+	int ed = sign * 256;
+	int tolerance = (int_abs(ex) + int_abs(ey) + int_abs(ez) + 256) / 2 + 3 * 127 + 1;
+
+	if (r3d_shader.vertexshader == 0 && r3d_shader.positionshader_n) {
+		r3d_draw_triangles_batched(drawcall, face, ex, ey, ez, ed, tolerance);
+		return;
+	}
+	for (uint32_t i = 0; i + 2 < drawcall->count; i += 3) {
+		if (face) {
+			int s = face->nx * ex + face->ny * ey + face->nz * ez - face->d * ed;
+			face++;
+			if (s < -tolerance)
+				continue; // back face
+		}
+		for (int j = 0; j < 3; j++)
+			r3d_vertex_fetch(drawcall, i + j, vs_in[j]);
+		if (r3d_shader.vertexshader) {
+			for (int j = 0; j < 3; j++)
+				r3d_shader.vertexshader(r3d_shader.uniforms, vs_in[j], vs_out[j]);
+		} else {
+			for (int j = 0; j < 3; j++)
+				r3d_shader.positionshader(r3d_shader.uniforms, vs_in[j], vs_out[j]);
+			if (r3d_triangle_rejected(vs_out[0], vs_out[1], vs_out[2]))
+				continue;
+			for (int j = 0; j < 3; j++)
+				r3d_shader.attributeshader(r3d_shader.uniforms, vs_in[j], vs_out[j]);
+		}
+		r3d_triangle_rasterizer(vs_out[0], vs_out[1], vs_out[2]);
+	}
+}
+
 void r3d_draw(const r3d_drawcall_t *drawcall)
 {
-	const void *vs_in;
+	const void *vs_in[R3D_VERTEX_STREAMS_MAX];
 	float vs_out[R3D_VERTEX_ELEMENTS_MAX];
+	r3d_vertexshader_func vertexshader = r3d_shader.vertexshader;
+
+	if (r3d_shader.prologue)
+		r3d_shader.prologue(r3d_shader.uniforms);
+	r3d_texture_cache_time++; // ends the binds of this draw call
+	r3d_varyings_setup();
+	r3d_texcoord_area = 0;
+	r3d_shading = drawcall->shading;
+	if (drawcall->primitive_type == R3D_PRIMITIVE_TYPE_TRIANGLES &&
+	    (vertexshader == 0 || (drawcall->faces && r3d_backface_culling))) {
+		r3d_draw_triangles(drawcall);
+		return;
+	}
+	if (vertexshader == 0)
+		vertexshader = r3d_vertexshader_split;
 
 	// initialize rasterizer
 	float primitive_buffer[R3D_PRIMITIVE_VERTEX_BUFFER * R3D_VERTEX_ELEMENTS_MAX];
@@ -63,63 +364,133 @@ void r3d_draw(const r3d_drawcall_t *drawcall)
 	r3d_primitive_vertex_buffer = primitive_buffer;
 	r3d_primitive_vertex_index = 0;
 
-	if (drawcall->indices == 0) {
-		// rasterize vertex arrays
-		vs_in = drawcall->vertices;
-		const void *vs_end = vs_in + drawcall->count * drawcall->stride;
-		if (drawcall->primitive_type == R3D_PRIMITIVE_TYPE_LINE_LOOP) {
-			r3d_shader.vertexshader(vs_end - drawcall->stride, vs_out);
-			rasterizer(vs_out);
-		}
-		while (vs_in != vs_end) {
-			r3d_shader.vertexshader(vs_in, vs_out);
-			rasterizer(vs_out);
-			vs_in += drawcall->stride;
-		}
-	} else {
-		// rasterize indexed arrays
-		if (drawcall->primitive_type == R3D_PRIMITIVE_TYPE_LINE_LOOP) {
-			vs_in = drawcall->vertices + drawcall->indices[drawcall->count - 1] * drawcall->stride;
-			r3d_shader.vertexshader(vs_in, vs_out);
-			rasterizer(vs_out);
-		}
-		for (uint32_t i = 0; i < drawcall->count; i++) {
-			vs_in = drawcall->vertices + drawcall->indices[i] * drawcall->stride;
-			r3d_shader.vertexshader(vs_in, vs_out);
-			rasterizer(vs_out);
-		}
+	// rasterize vertex or indexed arrays
+	if (drawcall->primitive_type == R3D_PRIMITIVE_TYPE_LINE_LOOP) {
+		r3d_vertex_fetch(drawcall, drawcall->count - 1, vs_in);
+		vertexshader(r3d_shader.uniforms, vs_in, vs_out);
+		rasterizer(vs_out);
 	}
+	for (uint32_t i = 0; i < drawcall->count; i++) {
+		r3d_vertex_fetch(drawcall, i, vs_in);
+		vertexshader(r3d_shader.uniforms, vs_in, vs_out);
+		rasterizer(vs_out);
+	}
+	r3d_primitive_vertex_buffer = 0; // primitive_buffer goes out of scope
 }
 
-// interpolators
+// interpolators (smooth varyings only)
 static inline void r3d_primitive_linear_interpolate(const float *in0, const float *in1, float *out, float x)
 {
 	float xr = 1.0f - x;
-	for (int i = 0; i < r3d_shader.vertex_out_elements; i++)
+	for (int k = 0; k < r3d_varyings_smooth_count; k++) {
+		int i = r3d_varyings_smooth[k];
 		out[i] = in0[i] * xr + in1[i] * x;
+	}
 }
 
 static inline void r3d_primitive_barycentric_interpolate(const float *in0, const float *in1, const float *in2, float *out, float t0, float t1, float t2)
 {
-	for (int i = 0; i < r3d_shader.vertex_out_elements; i++)
+	for (int k = 0; k < r3d_varyings_smooth_count; k++) {
+		int i = r3d_varyings_smooth[k];
 		out[i] = in0[i] * t0 + in1[i] * t1 + in2[i] * t2;
+	}
+}
+
+// flat varyings are set once per primitive from its first vertex
+static inline void r3d_primitive_flat_copy(const float *in, float *out)
+{
+	for (int k = 0; k < r3d_varyings_flat_count; k++) {
+		int i = r3d_varyings_flat[k];
+		out[i] = in[i];
+	}
 }
 
 // temporary buffer access
 #define r3d_primitive_vertex_buffer(i) (r3d_primitive_vertex_buffer + (i) * r3d_shader.vertex_out_elements)
 #define r3d_primitive_vertex_buffer_put(i, in) memcpy(r3d_primitive_vertex_buffer(i), in, r3d_shader.vertex_out_elements * sizeof(float));
 
-static inline void r3d_fragment_rasterizer(const float *in, uint16_t x, uint16_t y)
+// depth as fixed point with R3D_DEPTH_FRACTION fractional bits, computed
+// once per vertex and stepped in integers: the depth test compares it to
+// the stored value without any float conversion. Fragments in front of
+// the near plane (depth > R3D_DEPTH_NEAR) are dropped. 24 bit depth is
+// stepped in 64 bits: 32 bit words would leave 5 fractional bits, and the
+// rounding of the gradients would add up to tens of LSB across the screen.
+#if R3D_DEPTH_BITS > 16
+typedef int64_t r3d_depth_fixed_t;
+typedef uint64_t r3d_depth_step_t; // wrapping adds
+#define R3D_DEPTH_FRACTION 24 // same headroom for steep planes as 16 bit depth
+#else
+typedef int32_t r3d_depth_fixed_t;
+typedef uint32_t r3d_depth_step_t;
+#define R3D_DEPTH_FRACTION (29 - R3D_DEPTH_BITS)
+#endif
+#define R3D_DEPTH_NEAR ((r3d_depth_fixed_t)R3D_DEPTH_MAX << R3D_DEPTH_FRACTION)
+
+static inline float r3d_depth_fixed_f(float z) // from normalized device z, not rounded
+{
+	float d = (1.0f - z) * (0.5f * (float)R3D_DEPTH_NEAR);
+	return float_clamp(d, -3.0f * (float)R3D_DEPTH_NEAR, 3.0f * (float)R3D_DEPTH_NEAR);
+}
+
+static inline int r3d_depth_test_stored(r3d_depth_fixed_t depth, r3d_depth_t stored)
+{
+	return depth > ((r3d_depth_fixed_t)stored << R3D_DEPTH_FRACTION) && depth <= R3D_DEPTH_NEAR;
+}
+
+static inline int r3d_depth_test(r3d_depth_fixed_t depth, uint16_t x, uint16_t y)
+{
+	return r3d_depth_test_stored(depth, r3d_get_depth(x, y));
+}
+
+// shades and stores a fragment which passed the depth test
+static inline void r3d_fragment_store(const float *in, r3d_depth_fixed_t depth, uint16_t x, uint16_t y)
 {
 	// TODO: alpha test
-	float z = (in[2] - 1.0f) * -0.5f;
-	if (z > r3d_get_depth(x, y)) {
-		vec4_t color = r3d_shader.fragmentshader(in);
-		color.r = float_clamp(color.r, 0.0f, 1.0f);
-		color.g = float_clamp(color.g, 0.0f, 1.0f);
-		color.b = float_clamp(color.b, 0.0f, 1.0f);
-		r3d_set_pixel(x, y, z, color.rgb);
+	r3d_depth_t z = (r3d_depth_t)(depth >> R3D_DEPTH_FRACTION);
+	if (r3d_shader.fragmentshader565) {
+		r3d_set_pixel_rgb565(x, y, z, r3d_shader.fragmentshader565(r3d_shader.uniforms, in));
+		return;
+	}
+	vec4_t color = r3d_shader.fragmentshader(r3d_shader.uniforms, in);
+	color.r = float_clamp(color.r, 0.0f, 1.0f);
+	color.g = float_clamp(color.g, 0.0f, 1.0f);
+	color.b = float_clamp(color.b, 0.0f, 1.0f);
+	r3d_set_pixel(x, y, z, color.rgb);
+}
+
+static inline void r3d_fragment_rasterizer(const float *in, r3d_depth_fixed_t depth, uint16_t x, uint16_t y)
+{
+	if (r3d_depth_test(depth, x, y))
+		r3d_fragment_store(in, depth, x, y);
+}
+
+// R3D_SHADING_FLAT: shades the primitive once at its provoking vertex
+static void r3d_primitive_flat_shade(const float *in)
+{
+	if (r3d_shader.fragmentshader565) {
+		r3d_flat_color565 = r3d_shader.fragmentshader565(r3d_shader.uniforms, in);
+		return;
 	}
+	vec4_t color = r3d_shader.fragmentshader(r3d_shader.uniforms, in);
+	r3d_flat_color.r = float_clamp(color.r, 0.0f, 1.0f);
+	r3d_flat_color.g = float_clamp(color.g, 0.0f, 1.0f);
+	r3d_flat_color.b = float_clamp(color.b, 0.0f, 1.0f);
+}
+
+// store of the flat color, no varyings needed
+static inline void r3d_fragment_flat_store(r3d_depth_fixed_t depth, uint16_t x, uint16_t y)
+{
+	r3d_depth_t z = (r3d_depth_t)(depth >> R3D_DEPTH_FRACTION);
+	if (r3d_shader.fragmentshader565)
+		r3d_set_pixel_rgb565(x, y, z, r3d_flat_color565);
+	else
+		r3d_set_pixel(x, y, z, r3d_flat_color);
+}
+
+static inline void r3d_fragment_flat_rasterizer(r3d_depth_fixed_t depth, uint16_t x, uint16_t y)
+{
+	if (r3d_depth_test(depth, x, y))
+		r3d_fragment_flat_store(depth, x, y);
 }
 
 static void r3d_points_rasterizer(const float *in)
@@ -128,7 +499,7 @@ static void r3d_points_rasterizer(const float *in)
 		return;
 	uint16_t x = (uint16_t)((in[0] + 1.0f) * r3d_viewport_half_size.x + r3d_viewport_position.x);
 	uint16_t y = (uint16_t)((in[1] - 1.0f) * -r3d_viewport_half_size.y + r3d_viewport_position.y);
-	r3d_fragment_rasterizer(in, x, y);
+	r3d_fragment_rasterizer(in, (r3d_depth_fixed_t)r3d_depth_fixed_f(in[2]), x, y);
 }
 
 static void r3d_line_rasterizer(const float *v0, const float *v1)
@@ -143,15 +514,26 @@ static void r3d_line_rasterizer(const float *v0, const float *v1)
 	int dy = y1 - y0, sy = y0 < y1 ? 1 : -1;
 	if (dx < 0) dx = -dx;
 	if (dy < 0) dy = -dy;
-	int cur = 0, len = dx < dy ? dy : dx;
+	int len = dx < dy ? dy : dx;
 	int err = (dx > dy ? dx : -dy) / 2, e2;
-	float t;
+	float t = 0.0f, dt = len ? 1.0f / (float)len : 0.0f; // incremental: no divide per pixel
+	float d0 = r3d_depth_fixed_f(v0[2]), d1 = r3d_depth_fixed_f(v1[2]);
+	r3d_depth_step_t depth = (r3d_depth_step_t)(int64_t)d0, ddepth = (r3d_depth_step_t)(int64_t)((d1 - d0) * dt);
 	float *vi = r3d_primitive_vertex_buffer(1);
+	r3d_primitive_flat_copy(v0, vi);
+	int flat = r3d_shading == R3D_SHADING_FLAT;
+	if (flat)
+		r3d_primitive_flat_shade(v0);
 
 	for (;;) {
-		t = (float)(cur++) / (float)len; // TODO: incremental?
-		r3d_primitive_linear_interpolate(v0, v1, vi, t);
-		r3d_fragment_rasterizer(vi, x0, y0);
+		if (flat) {
+			r3d_fragment_flat_rasterizer((r3d_depth_fixed_t)depth, x0, y0);
+		} else {
+			r3d_primitive_linear_interpolate(v0, v1, vi, t);
+			r3d_fragment_rasterizer(vi, (r3d_depth_fixed_t)depth, x0, y0);
+		}
+		t += dt;
+		depth += ddepth;
 
 		if (x0 == x1 && y0 == y1) break;
 		e2 = err;
@@ -209,6 +591,247 @@ static inline int r3d_orientation2i(const int *i0, const int *i1, const int *i2)
 	return (i1[0] - i0[0]) * (i2[1] - i0[1]) - (i1[1] - i0[1]) * (i2[0] - i0[0]);
 }
 
+// two 16 bit edge function values per word: pixel x in the low and x + 1
+// in the high half, stepped with one halfword add (SIMD within a register)
+#ifdef ARM_MATH_CM4
+#define r3d_add16x2(a, b) __SADD16(a, b)
+#else
+static inline uint32_t r3d_add16x2(uint32_t a, uint32_t b) // no carry between the halves
+{
+	return ((a & 0x7fff7fffu) + (b & 0x7fff7fffu)) ^ ((a ^ b) & 0x80008000u);
+}
+#endif
+
+static inline uint32_t r3d_pack16x2(int lo, int hi)
+{
+	return ((uint32_t)hi << 16) | ((uint32_t)lo & 0xffffu);
+}
+
+// edge function w + a * x + b * y stays within 16 bits for x in [0, dx], y in [0, dy]
+static inline int r3d_edge_fits16(int w, int a, int b, int dx, int dy)
+{
+	int lo = w + int_min(a * dx, 0) + int_min(b * dy, 0);
+	int hi = w + int_max(a * dx, 0) + int_max(b * dy, 0);
+	return lo >= -32768 && hi <= 32767;
+}
+
+#ifdef R3D_HOST_SIMD
+// 8 pixel kernels of the wide loop, one per instruction set (see
+// r3d_triangle_wide). coverage: bit i is set if pixel x + i is on or inside
+// all edges, given the edge functions w at x and their offsets d[i] = i * a.
+typedef unsigned (*r3d_coverage8_func)(int w0, int w1, int w2, const int *d0, const int *d1, const int *d2);
+
+static inline unsigned r3d_coverage8_scalar(int w0, int w1, int w2, const int *d0, const int *d1, const int *d2)
+{
+	unsigned mask = 0;
+	for (int i = 0; i < 8; i++)
+		mask |= (unsigned)(((w0 + d0[i]) | (w1 + d1[i]) | (w2 + d2[i])) >= 0) << i;
+	return mask;
+}
+
+__attribute__((target("sse2")))
+static inline unsigned r3d_coverage8_sse2(int w0, int w1, int w2, const int *d0, const int *d1, const int *d2)
+{
+	__m128i v0 = _mm_set1_epi32(w0), v1 = _mm_set1_epi32(w1), v2 = _mm_set1_epi32(w2);
+	__m128i lo = _mm_or_si128(_mm_or_si128(_mm_add_epi32(v0, _mm_loadu_si128((const __m128i *)d0)),
+	                                       _mm_add_epi32(v1, _mm_loadu_si128((const __m128i *)d1))),
+	                          _mm_add_epi32(v2, _mm_loadu_si128((const __m128i *)d2)));
+	__m128i hi = _mm_or_si128(_mm_or_si128(_mm_add_epi32(v0, _mm_loadu_si128((const __m128i *)(d0 + 4))),
+	                                       _mm_add_epi32(v1, _mm_loadu_si128((const __m128i *)(d1 + 4)))),
+	                          _mm_add_epi32(v2, _mm_loadu_si128((const __m128i *)(d2 + 4))));
+	unsigned outside = (unsigned)_mm_movemask_ps(_mm_castsi128_ps(lo)) | ((unsigned)_mm_movemask_ps(_mm_castsi128_ps(hi)) << 4);
+	return ~outside & 0xffu; // sign bits
+}
+
+__attribute__((target("avx2")))
+static inline unsigned r3d_coverage8_avx2(int w0, int w1, int w2, const int *d0, const int *d1, const int *d2)
+{
+	__m256i o = _mm256_or_si256(_mm256_or_si256(_mm256_add_epi32(_mm256_set1_epi32(w0), _mm256_loadu_si256((const __m256i *)d0)),
+	                                             _mm256_add_epi32(_mm256_set1_epi32(w1), _mm256_loadu_si256((const __m256i *)d1))),
+	                            _mm256_add_epi32(_mm256_set1_epi32(w2), _mm256_loadu_si256((const __m256i *)d2)));
+	return ~(unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(o)) & 0xffu;
+}
+
+// depth test: bit i is set if depth + d[i] (wrapping) passes
+// r3d_depth_test against the stored depth s[i]
+typedef unsigned (*r3d_depth8_func)(r3d_depth_step_t depth, const r3d_depth_step_t *d, const r3d_depth_t *s);
+
+static inline unsigned r3d_depth8_scalar(r3d_depth_step_t depth, const r3d_depth_step_t *d, const r3d_depth_t *s)
+{
+	unsigned mask = 0;
+	for (int i = 0; i < 8; i++)
+		mask |= (unsigned)r3d_depth_test_stored((r3d_depth_fixed_t)(depth + d[i]), s[i]) << i;
+	return mask;
+}
+
+#if R3D_DEPTH_BITS > 16 // 64 bit depth steps are tested per pixel, see r3d_triangle_wide
+#define r3d_depth8_sse2 r3d_depth8_scalar
+#define r3d_depth8_avx2 r3d_depth8_scalar
+#else
+__attribute__((target("sse2")))
+static inline unsigned r3d_depth8_sse2(r3d_depth_step_t depth, const r3d_depth_step_t *d, const r3d_depth_t *s)
+{
+	__m128i v = _mm_set1_epi32((int32_t)depth), near = _mm_set1_epi32(R3D_DEPTH_NEAR);
+	__m128i lo = _mm_add_epi32(v, _mm_loadu_si128((const __m128i *)d));
+	__m128i hi = _mm_add_epi32(v, _mm_loadu_si128((const __m128i *)(d + 4)));
+	__m128i stored = _mm_loadu_si128((const __m128i *)s), zero = _mm_setzero_si128();
+	__m128i stored_lo = _mm_slli_epi32(_mm_unpacklo_epi16(stored, zero), R3D_DEPTH_FRACTION);
+	__m128i stored_hi = _mm_slli_epi32(_mm_unpackhi_epi16(stored, zero), R3D_DEPTH_FRACTION);
+	__m128i pass_lo = _mm_andnot_si128(_mm_cmpgt_epi32(lo, near), _mm_cmpgt_epi32(lo, stored_lo));
+	__m128i pass_hi = _mm_andnot_si128(_mm_cmpgt_epi32(hi, near), _mm_cmpgt_epi32(hi, stored_hi));
+	return (unsigned)_mm_movemask_ps(_mm_castsi128_ps(pass_lo)) |
+	       ((unsigned)_mm_movemask_ps(_mm_castsi128_ps(pass_hi)) << 4);
+}
+
+__attribute__((target("avx2")))
+static inline unsigned r3d_depth8_avx2(r3d_depth_step_t depth, const r3d_depth_step_t *d, const r3d_depth_t *s)
+{
+	__m256i v = _mm256_add_epi32(_mm256_set1_epi32((int32_t)depth), _mm256_loadu_si256((const __m256i *)d));
+	__m256i stored = _mm256_slli_epi32(_mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)s)), R3D_DEPTH_FRACTION);
+	__m256i pass = _mm256_andnot_si256(_mm256_cmpgt_epi32(v, _mm256_set1_epi32(R3D_DEPTH_NEAR)),
+	                                   _mm256_cmpgt_epi32(v, stored));
+	return (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(pass));
+}
+#endif
+#endif
+
+// a covered pixel which passed the depth test: varyings are only
+// interpolated for pixels which are actually shaded
+static inline void r3d_triangle_pixel_store(const float *v0, const float *v1, const float *v2, float *vi, float wai,
+                                            int flat, int w0, int w1, int w2, r3d_depth_step_t depth, uint16_t x, uint16_t y)
+{
+	if (flat) {
+		r3d_fragment_flat_store((r3d_depth_fixed_t)depth, x, y);
+	} else {
+		r3d_primitive_barycentric_interpolate(v0, v1, v2, vi, w0 * wai, w1 * wai, w2 * wai);
+		r3d_fragment_store(vi, (r3d_depth_fixed_t)depth, x, y);
+	}
+}
+
+static inline void r3d_triangle_pixel(const float *v0, const float *v1, const float *v2, float *vi, float wai,
+                                      int flat, int w0, int w1, int w2, r3d_depth_step_t depth, uint16_t x, uint16_t y)
+{
+	if (r3d_depth_test((r3d_depth_fixed_t)depth, x, y))
+		r3d_triangle_pixel_store(v0, v1, v2, vi, wai, flat, w0, w1, w2, depth, x, y);
+}
+
+#ifdef R3D_HOST_SIMD
+// the wide loop of x86 host builds: coverage and depth test of 8 pixels
+// per step, then the pixels which pass are interpolated and shaded left to
+// right like in the scalar loops. testing the depths of a block before
+// shading any of it is safe: a triangle writes each pixel at most once.
+// with 24 bit depth, or if r3d_get_depth_row returns 0, the depths are
+// tested per pixel with r3d_get_depth.
+typedef struct {
+	const float *v0, *v1, *v2;
+	float *vi;
+	float wai;
+	int flat;
+	int minX, maxX, minY, maxY;
+	int w0, w1, w2; // edge functions at minX, minY
+	int A12, A20, A01, B12, B20, B01;
+	r3d_depth_step_t depth, depth_dx, depth_dy; // at minX, minY
+} r3d_triangle_setup_t;
+
+// inlined into one function per instruction set, so that the kernels are
+// inlined as well: no indirect call per block
+static inline __attribute__((always_inline))
+void r3d_triangle_wide(const r3d_triangle_setup_t *t, r3d_coverage8_func coverage8, r3d_depth8_func depth8)
+{
+	int e0[8], e1[8], e2[8]; // offsets of 8 consecutive pixels
+	r3d_depth_step_t ed[8];
+	for (int i = 0; i < 8; i++) {
+		e0[i] = i * t->A12;
+		e1[i] = i * t->A20;
+		e2[i] = i * t->A01;
+		ed[i] = i * t->depth_dx;
+	}
+	int w0_row = t->w0, w1_row = t->w1, w2_row = t->w2;
+	r3d_depth_step_t depth_row = t->depth;
+	for (int y = t->minY; y <= t->maxY; y++) {
+		int w0 = w0_row; // barycentric coordinates at start of row
+		int w1 = w1_row;
+		int w2 = w2_row;
+		r3d_depth_step_t depth = depth_row;
+		const r3d_depth_t *stored = 0;
+#if R3D_DEPTH_BITS <= 16
+		stored = r3d_get_depth_row(y);
+#endif
+
+		for (int x = t->minX; x <= t->maxX; x += 8) {
+			unsigned mask = coverage8(w0, w1, w2, e0, e1, e2);
+			if (t->maxX - x < 7)
+				mask &= (1u << (t->maxX - x + 1)) - 1;
+			if (mask && stored) {
+				const r3d_depth_t *s = stored + x;
+				r3d_depth_t tail[8] = {0}; // no loads beyond maxX (the end of the buffer)
+				if (t->maxX - x < 7) {
+					memcpy(tail, s, (t->maxX - x + 1) * sizeof(r3d_depth_t));
+					s = tail;
+				}
+				mask &= depth8(depth, ed, s);
+			}
+			while (mask) {
+				int i = __builtin_ctz(mask);
+				mask &= mask - 1;
+				if (stored)
+					r3d_triangle_pixel_store(t->v0, t->v1, t->v2, t->vi, t->wai, t->flat, w0 + e0[i], w1 + e1[i],
+					                         w2 + e2[i], depth + ed[i], x + i, y);
+				else
+					r3d_triangle_pixel(t->v0, t->v1, t->v2, t->vi, t->wai, t->flat, w0 + e0[i], w1 + e1[i],
+					                   w2 + e2[i], depth + ed[i], x + i, y);
+			}
+			w0 += 8 * t->A12; // eight steps to the right
+			w1 += 8 * t->A20;
+			w2 += 8 * t->A01;
+			depth += 8 * t->depth_dx;
+		}
+		w0_row += t->B12; // one row step
+		w1_row += t->B20;
+		w2_row += t->B01;
+		depth_row += t->depth_dy;
+	}
+}
+
+static void r3d_triangle_wide_scalar(const r3d_triangle_setup_t *t)
+{
+	r3d_triangle_wide(t, r3d_coverage8_scalar, r3d_depth8_scalar);
+}
+
+__attribute__((target("sse2")))
+static void r3d_triangle_wide_sse2(const r3d_triangle_setup_t *t)
+{
+	r3d_triangle_wide(t, r3d_coverage8_sse2, r3d_depth8_sse2);
+}
+
+__attribute__((target("avx2")))
+static void r3d_triangle_wide_avx2(const r3d_triangle_setup_t *t)
+{
+	r3d_triangle_wide(t, r3d_coverage8_avx2, r3d_depth8_avx2);
+}
+
+// instruction set of the wide loop, from the running cpu on first use
+#define R3D_HOST_SIMD_UNKNOWN 0
+#define R3D_HOST_SIMD_SCALAR  1
+#define R3D_HOST_SIMD_SSE2    2
+#define R3D_HOST_SIMD_AVX2    3
+static int r3d_host_simd = R3D_HOST_SIMD_UNKNOWN;
+
+static void r3d_triangle_wide_rasterizer(const r3d_triangle_setup_t *t)
+{
+	if (r3d_host_simd == R3D_HOST_SIMD_UNKNOWN) {
+		__builtin_cpu_init();
+		r3d_host_simd = __builtin_cpu_supports("avx2") ? R3D_HOST_SIMD_AVX2 :
+		                __builtin_cpu_supports("sse2") ? R3D_HOST_SIMD_SSE2 : R3D_HOST_SIMD_SCALAR;
+	}
+	switch (r3d_host_simd) {
+	case R3D_HOST_SIMD_AVX2: r3d_triangle_wide_avx2(t); break;
+	case R3D_HOST_SIMD_SSE2: r3d_triangle_wide_sse2(t); break;
+	default: r3d_triangle_wide_scalar(t); break;
+	}
+}
+#endif
+
 // triangle front face rasterizer
 static void r3d_triangle_front_rasterizer(const float *v0, const float *v1, const float *v2)
 {
@@ -234,31 +857,136 @@ static void r3d_triangle_front_rasterizer(const float *v0, const float *v1, cons
 	int w1_row = r3d_orientation2i(i2, i0, p);
 	int w2_row = r3d_orientation2i(i0, i1, p);
 
+	// w0 + w1 + w2 is the same for every pixel (twice the triangle area):
+	// a single divide per triangle normalizes the barycentric coordinates
+	int area = w0_row + w1_row + w2_row;
+	if (area <= 0)
+		return; // degenerate
+	float wai = 1.0f / (float)area;
+
 	float vi[R3D_VERTEX_ELEMENTS_MAX]; // interpolated vertex
+	r3d_primitive_flat_copy(v0, vi);
+
+	if (r3d_shader.texcoords) { // texture coordinate area per pixel for mip level selection
+		const float *t0 = v0 + r3d_shader.texcoords;
+		const float *t1 = v1 + r3d_shader.texcoords;
+		const float *t2 = v2 + r3d_shader.texcoords;
+		float uv_area = (t1[0] - t0[0]) * (t2[1] - t0[1]) - (t2[0] - t0[0]) * (t1[1] - t0[1]);
+		r3d_texcoord_area = float_ilog2(fabsf(uv_area) * wai * (1.0f / (R3D_UV_ONE * R3D_UV_ONE)));
+	}
+
+	int flat = r3d_shading == R3D_SHADING_FLAT;
+	if (flat)
+		r3d_primitive_flat_shade(v0);
+
+	// depth plane in fixed point, stepped with wrapping unsigned adds
+	// (values outside of the triangle may overflow, those inside cannot).
+	// plane and gradients convert through int64_t: steep gradients of
+	// 32 bit depth exceed the int32_t range, which would be undefined.
+	// they are relative to v0 (w0 = area - w1 - w2): the products of the
+	// absolute depths would cancel and lose most of the float precision.
+	float d0 = r3d_depth_fixed_f(v0[2]);
+	float d10 = r3d_depth_fixed_f(v1[2]) - d0, d20 = r3d_depth_fixed_f(v2[2]) - d0;
+	r3d_depth_step_t depth_row = (r3d_depth_step_t)(int64_t)(d0 + (d10 * w1_row + d20 * w2_row) * wai);
+	r3d_depth_step_t depth_dx = (r3d_depth_step_t)(int64_t)((d10 * A20 + d20 * A01) * wai);
+	r3d_depth_step_t depth_dy = (r3d_depth_step_t)(int64_t)((d10 * B20 + d20 * B01) * wai);
+
+#ifdef R3D_HOST_SIMD
+	if (r3d_rasterizer_loop == R3D_RASTERIZER_LOOP_AUTO || r3d_rasterizer_loop == R3D_RASTERIZER_LOOP_WIDE) {
+		r3d_triangle_setup_t t = {
+			v0, v1, v2, vi, wai, flat, minX, maxX, minY, maxY, w0_row, w1_row, w2_row,
+			A12, A20, A01, B12, B20, B01, depth_row, depth_dx, depth_dy
+		};
+		r3d_triangle_wide_rasterizer(&t);
+		return;
+	}
+#endif
+
+	int dx = maxX + 1 - minX, dy = maxY - minY; // the pixel pairs may reach maxX + 1
+	if (r3d_rasterizer_loop != R3D_RASTERIZER_LOOP_SCALAR &&
+	    r3d_edge_fits16(w0_row, A12, B12, dx, dy) && r3d_edge_fits16(w1_row, A20, B20, dx, dy) &&
+	    r3d_edge_fits16(w2_row, A01, B01, dx, dy)) {
+		// small triangles: coverage of two pixels per step from the sign bits
+		uint32_t s0 = r3d_pack16x2(2 * A12, 2 * A12);
+		uint32_t s1 = r3d_pack16x2(2 * A20, 2 * A20);
+		uint32_t s2 = r3d_pack16x2(2 * A01, 2 * A01);
+		for (p[1] = minY; p[1] <= maxY; p[1]++) {
+			uint32_t e0 = r3d_pack16x2(w0_row, w0_row + A12);
+			uint32_t e1 = r3d_pack16x2(w1_row, w1_row + A20);
+			uint32_t e2 = r3d_pack16x2(w2_row, w2_row + A01);
+			r3d_depth_step_t depth = depth_row;
+
+			for (p[0] = minX; p[0] <= maxX; p[0] += 2) {
+				uint32_t outside = (e0 | e1 | e2) & 0x80008000u;
+				if (outside != 0x80008000u) {
+					if (!(outside & 0x8000u))
+						r3d_triangle_pixel(v0, v1, v2, vi, wai, flat, (int16_t)e0, (int16_t)e1, (int16_t)e2,
+						                   depth, p[0], p[1]);
+					if (!(outside & 0x80000000u) && p[0] < maxX)
+						r3d_triangle_pixel(v0, v1, v2, vi, wai, flat, (int16_t)(e0 >> 16), (int16_t)(e1 >> 16),
+						                   (int16_t)(e2 >> 16), depth + depth_dx, p[0] + 1, p[1]);
+				}
+				e0 = r3d_add16x2(e0, s0); // two steps to the right
+				e1 = r3d_add16x2(e1, s1);
+				e2 = r3d_add16x2(e2, s2);
+				depth += 2 * depth_dx;
+			}
+			w0_row += B12; // one row step
+			w1_row += B20;
+			w2_row += B01;
+			depth_row += depth_dy;
+		}
+		return;
+	}
 
 	for (p[1] = minY; p[1] <= maxY; p[1]++) {
 		int w0 = w0_row; // barycentric coordinates at start of row
 		int w1 = w1_row;
 		int w2 = w2_row;
+		r3d_depth_step_t depth = depth_row;
 
 		for (p[0] = minX; p[0] <= maxX; p[0]++) {
-			if ((w0 | w1 | w2) >= 0) { // if p is on or inside all edges, render pixel.
-				float wai = 1.0f / (float)(w0 + w1 + w2);
-				r3d_primitive_barycentric_interpolate(v0, v1, v2, vi, w0 * wai, w1 * wai, w2 * wai);
-				r3d_fragment_rasterizer(vi, p[0], p[1]);
-			}
+			if ((w0 | w1 | w2) >= 0) // if p is on or inside all edges, render pixel.
+				r3d_triangle_pixel(v0, v1, v2, vi, wai, flat, w0, w1, w2, depth, p[0], p[1]);
 			w0 += A12; // one step to the right
 			w1 += A20;
 			w2 += A01;
+			depth += depth_dx;
 		}
 		w0_row += B12; // one row step
 		w1_row += B20;
 		w2_row += B01;
+		depth_row += depth_dy;
+	}
+}
+
+// trivial reject: all vertices are outside of the same clip plane
+static inline int r3d_triangle_outside(const float *v0, const float *v1, const float *v2)
+{
+	for (int i = 0; i < 3; i++) {
+		if (v0[i] < -1.0f && v1[i] < -1.0f && v2[i] < -1.0f)
+			return 1;
+		if (v0[i] > 1.0f && v1[i] > 1.0f && v2[i] > 1.0f)
+			return 1;
 	}
+	return 0;
+}
+
+// position-only test: triangle is outside of the view volume or back facing
+static int r3d_triangle_rejected(const float *v0, const float *v1, const float *v2)
+{
+	if (r3d_triangle_outside(v0, v1, v2))
+		return 1;
+	if (!r3d_backface_culling)
+		return 0;
+	float o = r3d_orientation2f(v0, v1, v2);
+	return r3d_primitive_winding == R3D_PRIMITIVE_WINDING_CCW ? o <= 0.0f : o >= 0.0f;
 }
 
 static void r3d_triangle_rasterizer(const float *v0, const float *v1, const float *v2)
 {
+	if (r3d_triangle_outside(v0, v1, v2))
+		return;
 	if (r3d_primitive_winding == R3D_PRIMITIVE_WINDING_CCW) {
 		if (r3d_orientation2f(v0, v1, v2) > 0.0f)
 			r3d_triangle_front_rasterizer(v0, v2, v1); // ccw front face
@@ -8,6 +8,7 @@
 
 #include <stdint.h>
 #include <r3d_math.h>
+#include <r3d_fixed.h>
 
 /*****************************************************************************/
 // to configure by user:
@@ -15,6 +16,15 @@
 // number of float elements per vertex passed to/between shaders (at least 3)
 #define R3D_VERTEX_ELEMENTS_MAX 16
 
+// maximum number of vertex streams per draw call
+#define R3D_VERTEX_STREAMS_MAX 3
+
+// maximum number of mip levels per texture (2^(n-1) texels wide or high)
+#define R3D_MIPMAP_LEVELS_MAX 10
+
+// maximum number of mip levels/palettes resident in the texture cache
+#define R3D_TEXTURE_CACHE_ENTRIES 32
+
 // sets the maximum number for *_FAN vertices.
 // should be at least:
 // 6 if quads are used, ?
@@ -23,9 +33,30 @@
 // 0 if only points are used
 #define R3D_PRIMITIVE_VERTEX_BUFFER 4
 
+// triangles per r3d_shader.positionshader_n call
+#define R3D_TRIANGLE_BATCH 8
+
+// depth buffer format: 16 bit, or 24 bit values stored in 32 bit words
+// (e.g. -DR3D_DEPTH_BITS=24). 0 is the far plane (cleared), R3D_DEPTH_MAX
+// the near plane.
+#ifndef R3D_DEPTH_BITS
+#define R3D_DEPTH_BITS 16
+#endif
+#if R3D_DEPTH_BITS > 16
+typedef uint32_t r3d_depth_t;
+#else
+typedef uint16_t r3d_depth_t;
+#endif
+#define R3D_DEPTH_MAX ((1 << R3D_DEPTH_BITS) - 1)
+
 // to implement:
-void r3d_set_pixel(uint16_t x, uint16_t y, float z, vec3_t color);
-float r3d_get_depth(uint16_t x, uint16_t y);
+void r3d_set_pixel(uint16_t x, uint16_t y, r3d_depth_t z, vec3_t color);
+void r3d_set_pixel_rgb565(uint16_t x, uint16_t y, r3d_depth_t z, uint16_t color);
+r3d_depth_t r3d_get_depth(uint16_t x, uint16_t y);
+// only for the 8 pixel loop of x86 host builds (R3D_HOST_SIMD in r3d.c):
+// row y of a depth buffer stored row by row (x + width * y), or 0 to read
+// each depth with r3d_get_depth
+const r3d_depth_t *r3d_get_depth_row(uint16_t y);
 
 // end of configuration section
 /*****************************************************************************/
@@ -39,6 +70,13 @@ typedef uint8_t r3d_primitive_winding_t;
 #define R3D_PRIMITIVE_WINDING_CW  0
 #define R3D_PRIMITIVE_WINDING_CCW 1
 
+// triangle rasterizer loops, selectable to compare them (tests, benchmarks)
+typedef uint8_t r3d_rasterizer_loop_t;
+#define R3D_RASTERIZER_LOOP_AUTO   0 // fastest available
+#define R3D_RASTERIZER_LOOP_SCALAR 1 // one pixel per step (reference)
+#define R3D_RASTERIZER_LOOP_PAIRS  2 // two pixels per step in 16 bit halves (scalar if they do not fit)
+#define R3D_RASTERIZER_LOOP_WIDE   3 // x86 hosts: 8 pixel coverage and depth kernels (-DR3D_NO_HOST_SIMD: like AUTO)
+
 typedef uint8_t r3d_primitive_type_t;
 #define R3D_PRIMITIVE_TYPE_POINTS         0x00
 #define R3D_PRIMITIVE_TYPE_LINES          0x01
@@ -52,20 +90,79 @@ typedef uint8_t r3d_primitive_type_t;
 //#define R3D_PRIMITIVE_TYPE_QUAD_STRIP     0x09
 #define R3D_PRIMITIVE_TYPE_NUM            0x08 //0x0a
 
-typedef void (*r3d_vertexshader_func)(const void *in, float *out);
-typedef vec4_t (*r3d_fragmentshader_func)(const float *in);
+typedef uint8_t r3d_shading_t;
+#define R3D_SHADING_FRAGMENT 0 // fragment shader for each pixel
+#define R3D_SHADING_FLAT     1 // fragment shader once per line/triangle with the
+                               // values of its first (provoking) vertex
+
+#define R3D_VARYING(i) (1u << (i))
+#define R3D_VARYINGS(i, n) (((1u << (n)) - 1u) << (i)) // n elements starting at i
+
+// uniforms: the shader's uniform block, in[i]: current vertex in drawcall stream i
+typedef void (*r3d_vertexshader_func)(const void *uniforms, const void *const *in, float *out);
+typedef vec4_t (*r3d_fragmentshader_func)(const void *uniforms, const float *in);
+typedef uint16_t (*r3d_fragmentshader565_func)(const void *uniforms, const float *in);
+typedef void (*r3d_prologue_func)(void *uniforms);
+// in[i]: vertex i in all drawcall streams, out: the positions (out[0..2]
+// of positionshader) of the n vertices, 4 per block
+typedef void (*r3d_positionshader_n_func)(const void *uniforms, const void *const (*in)[R3D_VERTEX_STREAMS_MAX],
+                                          vec3x4_t *out, uint32_t n);
 typedef struct {
 	r3d_vertexshader_func vertexshader;
 	r3d_fragmentshader_func fragmentshader;
 	uint8_t vertex_out_elements; // number of floats passed from vs to fs
+	// optional split vertex shader (used if vertexshader is 0):
+	// positionshader writes out[0..2] only, attributeshader the remaining
+	// elements. for triangle lists, attributes are only computed for the
+	// vertices of triangles that survive clipping and back face culling.
+	r3d_vertexshader_func positionshader;
+	r3d_vertexshader_func attributeshader;
+	// masks of vertex out elements (R3D_VARYING*) which are interpolated
+	// per pixel (smooth) or taken from the first vertex of the primitive
+	// (flat). other elements are undefined in the fragment shader.
+	// 0 for both masks: all elements are interpolated.
+	// the depth test uses element 2 (z) of the vertices only.
+	uint32_t varyings_smooth;
+	uint32_t varyings_flat;
+	// uniform block passed to all shader functions and the optional
+	// prologue, which runs once per draw call (before any vertex) to
+	// derive per-draw constants in the uniform block.
+	void *uniforms;
+	r3d_prologue_func prologue;
+	// optional replacement for fragmentshader which returns packed RGB565
+	// (see r3d_rgb565*), so that shaders can do their color math in
+	// integers and the result is stored without any conversion.
+	r3d_fragmentshader565_func fragmentshader565;
+	// element index of the texture coordinates (u, v in R3D_UV_ONE units)
+	// used for mip level selection, see r3d_texcoord_area (0: none)
+	uint8_t texcoords;
+	// optional batch replacement for positionshader in triangle lists
+	// (R3D_TRIANGLE_BATCH triangles per call, see mat4_transform_positions_n)
+	r3d_positionshader_n_func positionshader_n;
 } r3d_shader_t;
 
+// face plane n.p = d of a triangle in object space, n and d scaled by 127.
+// n is the normal of the ccw front face; |d| must be less than 1.
 typedef struct {
-	r3d_primitive_type_t primitive_type;
-	const void *vertices; // vertex buffer
+	int8_t nx, ny, nz;
+	int8_t d;
+} r3d_face_t;
+
+typedef struct {
+	const void *vertices; // vertex buffer (0 for unused streams)
 	uint8_t stride; // vertex stride
+} r3d_vertex_stream_t;
+
+typedef struct {
+	r3d_primitive_type_t primitive_type;
+	// e.g. positions in stream 0 and the remaining attributes in stream 1,
+	// so that position-only passes read densely packed data
+	r3d_vertex_stream_t streams[R3D_VERTEX_STREAMS_MAX];
 	uint32_t count; // number of vertices/indices
 	const uint16_t *indices; // index buffer
+	const r3d_face_t *faces; // optional face planes (one per triangle) for
+	                         // object space back face culling of triangle lists
+	r3d_shading_t shading;
 } r3d_drawcall_t;
 
 typedef struct {
@@ -77,14 +174,78 @@ typedef struct {
 // variables
 extern r3d_switch_t r3d_backface_culling;
 extern r3d_primitive_winding_t r3d_primitive_winding;
+extern r3d_rasterizer_loop_t r3d_rasterizer_loop;
 extern r3d_shader_t r3d_shader;
+extern vec3_t r3d_eye_position; // in object space, for culling with drawcall faces
+// set if the modelview matrix mirrors (negative determinant): the face
+// plane test is flipped so that it agrees with the screen space winding
+extern r3d_switch_t r3d_eye_mirrored;
+// floor(log2(texture coordinate area per pixel)) of the triangle being
+// rasterized, with uv in 0..1 (computed if r3d_shader.texcoords is set)
+extern int r3d_texcoord_area;
 
 // functions
 void r3d_viewport(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
 void r3d_draw(const r3d_drawcall_t *drawcall);
 
+// quantized vertices
+extern const float r3d_snorm8[256]; // r3d_snorm8[i] = i * 2 / 255 - 1
+
+// folds the decoding of quantized positions (p = q * scale + bias) into m
+// (m = m * translation(bias) * scaling(scale)), so that vertex shaders can
+// transform the integer coordinates directly
+static inline void r3d_dequantization_matrix(mat4_t *m, vec3_t scale, vec3_t bias)
+{
+	m->c[3] = vec4_add(m->c[3], vec4_add(vec4_add(vec4_mul(m->c[0], bias.x), vec4_mul(m->c[1], bias.y)),
+	                                     vec4_mul(m->c[2], bias.z)));
+	for (int i = 0; i < 3; i++)
+		m->c[i] = vec4_mul(m->c[i], scale.v[i]);
+}
+
+// r3d_dequantization_matrix for fixed point vertex shaders (see R3D_FIXED in
+// the Makefile), which use the integer coordinates q as Q16 values q / 65536
+static inline void r3d_dequantization_matrix_fixed(mat4x_t *r, const mat4_t *m, vec3_t scale, vec3_t bias)
+{
+	mat4_t mq = *m;
+	r3d_dequantization_matrix(&mq, vec3_mul(scale, 65536.0f), bias);
+	mat4x_from_mat4(r, &mq);
+}
+
+// decodes a normal quantized as n = q * 2 / 255 - 1 using r3d_snorm8
+static inline vec3_t r3d_dequantize_normal(uint8_t x, uint8_t y, uint8_t z)
+{
+	return vec3(r3d_snorm8[x], r3d_snorm8[y], r3d_snorm8[z]);
+}
+
+// packed RGB565 colors with 8 bit channels (0..255)
+static inline uint16_t r3d_rgb565(int r, int g, int b) // saturating
+{
+	r = int_clamp(r, 0, 255);
+	g = int_clamp(g, 0, 255);
+	b = int_clamp(b, 0, 255);
+	return ((r & 0xf8) << 8) | ((g & 0xfc) << 3) | (b >> 3);
+}
+
+static inline int r3d_rgb565_r(uint16_t c)
+{
+	int r = c >> 11;
+	return (r << 3) | (r >> 2);
+}
+
+static inline int r3d_rgb565_g(uint16_t c)
+{
+	int g = (c >> 5) & 63;
+	return (g << 2) | (g >> 4);
+}
+
+static inline int r3d_rgb565_b(uint16_t c)
+{
+	int b = c & 31;
+	return (b << 3) | (b >> 2);
+}
+
 // texturing (inlined for speed)
-static inline vec3_t r3d_texture_nearest(const r3d_texture_t *texture, vec2_t uv)
+static inline uint16_t r3d_texture_nearest_rgb565(const r3d_texture_t *texture, vec2_t uv)
 {
 	int ui = (int)uv.x;
 	int vi = (int)uv.y;
@@ -96,9 +257,160 @@ static inline vec3_t r3d_texture_nearest(const r3d_texture_t *texture, vec2_t uv
 	uv.y *= texture->height - 1;
 	ui = uv.x;
 	vi = uv.y;
-	uint16_t c = texture->data[vi * texture->width + ui];
+	return texture->data[vi * texture->width + ui];
+}
+
+static inline vec3_t r3d_texture_nearest(const r3d_texture_t *texture, vec2_t uv)
+{
+	uint16_t c = r3d_texture_nearest_rgb565(texture, uv);
 	const float ri = 1.0f / 63488.0f, gi = 1.0f / 2016.0f, bi = 1.0f / 31.0f;
 	return vec3((c & 63488) * ri, (c & 2016) * gi, (c & 31) * bi);
 }
 
+// power-of-two textures with fixed-point texture coordinates:
+// u and v are Q16 (65536 = 1.0), e.g. interpolated as uv * R3D_UV_ONE and
+// converted with a plain (int32_t) cast in the fragment shader.
+// wrapping is done with shifts and masks instead of float math.
+#define R3D_UV_ONE 65536.0f
+
+typedef enum {
+	R3D_TEXTURE_RGB565 = 0, // row-major texels
+	R3D_TEXTURE_RGB565_TILED, // 4x4 texel tiles (levels smaller than 4x4 are row-major)
+	// compressed formats, decoded when sampled:
+	R3D_TEXTURE_P8, // row-major 8 bit indices into a 256 color RGB565 palette
+	R3D_TEXTURE_P4, // row-major 4 bit indices (low nibble first), 16 color palette
+	R3D_TEXTURE_BC1 // 4x4 blocks of two RGB565 colors and 2 bit indices (4 colors only)
+} r3d_texture_format_t;
+
+typedef struct {
+	const uint16_t *data;
+	const uint16_t *palette; // R3D_TEXTURE_P8 and R3D_TEXTURE_P4
+	uint8_t format; // r3d_texture_format_t
+	uint8_t ushift, vshift; // 16 - log2(size)
+	uint8_t log2width;
+	uint8_t tile; // log2 of the tile size, 0 for row-major texels
+	uint16_t umask, vmask; // size - 1
+} r3d_sampler_t;
+
+// width and height must be powers of two (at most 65536)
+static inline r3d_sampler_t r3d_sampler_data(const uint16_t *data, uint16_t width, uint16_t height)
+{
+	r3d_sampler_t s;
+	s.data = data;
+	s.palette = 0;
+	s.format = R3D_TEXTURE_RGB565;
+	s.log2width = __builtin_ctz(width);
+	s.ushift = 16 - s.log2width;
+	s.vshift = 16 - __builtin_ctz(height);
+	s.tile = 0;
+	s.umask = width - 1;
+	s.vmask = height - 1;
+	return s;
+}
+
+static inline r3d_sampler_t r3d_sampler(const r3d_texture_t *texture)
+{
+	return r3d_sampler_data(texture->data, texture->width, texture->height);
+}
+
+// (2 * a + b) / 3 per channel
+static inline uint16_t r3d_rgb565_third(uint16_t a, uint16_t b)
+{
+	return ((2 * (a >> 11) + (b >> 11)) / 3 << 11) |
+	       ((2 * ((a >> 5) & 63) + ((b >> 5) & 63)) / 3 << 5) |
+	       (2 * (a & 31) + (b & 31)) / 3;
+}
+
+static inline uint16_t r3d_sampler_fetch_bc1(const r3d_sampler_t *s, uint32_t ui, uint32_t vi)
+{
+	const uint16_t *block = s->data + ((((vi >> 2) << (s->log2width - 2)) | (ui >> 2)) << 2);
+	uint32_t bits = ((uint32_t)block[3] << 16) | block[2];
+	switch ((bits >> ((((vi & 3) << 2) | (ui & 3)) << 1)) & 3) {
+	case 0: return block[0];
+	case 1: return block[1];
+	case 2: return r3d_rgb565_third(block[0], block[1]);
+	default: return r3d_rgb565_third(block[1], block[0]);
+	}
+}
+
+// decodes texel (ui, vi) of any r3d_texture_format_t. tiled texels are
+// stored in square tiles (row-major within and between tiles), so that
+// neighbouring samples share cache lines in any direction.
+static inline uint16_t r3d_sampler_fetch(const r3d_sampler_t *s, uint32_t ui, uint32_t vi)
+{
+	if (s->format == R3D_TEXTURE_BC1)
+		return r3d_sampler_fetch_bc1(s, ui, vi);
+	uint32_t t = s->tile, m = (1 << t) - 1;
+	uint32_t i = ((vi >> t) << (s->log2width + t)) | ((ui >> t) << (t + t)) | ((vi & m) << t) | (ui & m);
+	const uint8_t *indices = (const uint8_t *)s->data;
+	switch (s->format) {
+	case R3D_TEXTURE_P8: return s->palette[indices[i]];
+	case R3D_TEXTURE_P4: return s->palette[(indices[i >> 1] >> ((i & 1) << 2)) & 15];
+	default: return s->data[i];
+	}
+}
+
+static inline uint16_t r3d_sample_repeat(const r3d_sampler_t *s, int32_t u, int32_t v)
+{
+	return r3d_sampler_fetch(s, (u >> s->ushift) & s->umask, (v >> s->vshift) & s->vmask);
+}
+
+static inline uint16_t r3d_sample_clamp(const r3d_sampler_t *s, int32_t u, int32_t v)
+{
+	u = int_clamp(u, 0, 65535);
+	v = int_clamp(v, 0, 65535);
+	return r3d_sampler_fetch(s, u >> s->ushift, v >> s->vshift);
+}
+
+static inline uint16_t r3d_sample_mirror(const r3d_sampler_t *s, int32_t u, int32_t v)
+{
+	if (u & 0x10000) u = ~u; // odd periods run backwards
+	if (v & 0x10000) v = ~v;
+	return r3d_sampler_fetch(s, (u >> s->ushift) & s->umask, (v >> s->vshift) & s->vmask);
+}
+
+// mip chain of a power-of-two texture (e.g. generated by tools/texconv):
+// each level halves width and height (down to 1, or 4 for R3D_TEXTURE_BC1),
+// all levels are stored back to back in data, largest first, after the
+// palette of R3D_TEXTURE_P8 (256 colors) and R3D_TEXTURE_P4 (16 colors).
+typedef struct {
+	uint16_t width; // of level 0
+	uint16_t height;
+	uint16_t levels;
+	uint16_t format; // r3d_texture_format_t
+	uint16_t data[];
+} r3d_mipmap_t;
+
+typedef struct {
+	r3d_sampler_t level[R3D_MIPMAP_LEVELS_MAX];
+	int8_t levels;
+	int8_t log2area; // log2(width * height) of level 0
+} r3d_mipmap_sampler_t;
+
+void r3d_mipmap_sampler(r3d_mipmap_sampler_t *s, const r3d_mipmap_t *mipmap);
+
+// nearest mip level for the current triangle (see r3d_texcoord_area)
+static inline const r3d_sampler_t *r3d_mipmap_select(const r3d_mipmap_sampler_t *s)
+{
+	int level = (r3d_texcoord_area + s->log2area) >> 1; // texels per pixel in one direction
+	return &s->level[int_clamp(level, 0, s->levels - 1)];
+}
+
+// texture residency cache: copies mip levels (and palettes) into a pool in
+// fast memory (e.g. CCMRAM) when bound and evicts the least recently bound
+// ones. levels which do not fit are sampled from their original location.
+typedef struct {
+	uint32_t hits; // levels already resident when bound
+	uint32_t misses;
+	uint32_t bytes_copied;
+} r3d_texture_cache_stats_t;
+
+extern r3d_texture_cache_stats_t r3d_texture_cache_stats; // reset by the user
+
+void r3d_texture_cache_init(void *pool, uint32_t size);
+// points the levels of s to resident copies, smallest levels first. call
+// it in the prologue or before r3d_draw: textures bound for the same draw
+// call never evict each other.
+void r3d_texture_cache_bind(r3d_mipmap_sampler_t *s);
+
 #endif
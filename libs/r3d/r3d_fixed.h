@@ -0,0 +1,219 @@
+/**
+ * r3d -- 3D rendering library
+ * author: Andreas Mantler (ands)
+ */
+
+#ifndef R3D_FIXED_H
+#define R3D_FIXED_H
+
+// Q16.16 fixed point counterparts of the r3d_math.h types for vertex
+// transforms without an FPU. The layouts match their float versions
+// (mat4x_t is column major like mat4_t), products are accumulated in 64
+// bits and rounded once. The float conversions are meant for setup code
+// and for handing transformed positions to the rasterizer: its setup,
+// depth plane and varying interpolation stay float.
+
+#include <stdint.h>
+#include <r3d_math.h>
+
+typedef int32_t fixed_t;
+
+#define FIXED_ONE	65536
+#define FIXED_HALF	32768
+
+typedef struct {
+	union {
+		fixed_t v[3];
+		struct {
+			fixed_t x, y, z;
+		};
+	};
+} vec3x_t;
+
+typedef struct {
+	union {
+		fixed_t v[4];
+		struct {
+			fixed_t x, y, z, w;
+		};
+		vec3x_t xyz;
+	};
+} vec4x_t;
+
+typedef struct {
+	union {
+		fixed_t m[16];
+		struct {
+			fixed_t m00, m10, m20, m30,
+			        m01, m11, m21, m31,
+			        m02, m12, m22, m32,
+			        m03, m13, m23, m33;
+		};
+		vec4x_t c[4];
+	};
+} mat4x_t;
+
+static inline fixed_t fixed_from_int(int i) // |i| < 32768
+{
+	return (fixed_t)(i * FIXED_ONE);
+}
+static inline fixed_t fixed_from_float(float f)
+{
+	return (fixed_t)(f * 65536.0f + (f < 0.0f ? -0.5f : 0.5f));
+}
+static inline float fixed_to_float(fixed_t a)
+{
+	return (float)a * (1.0f / 65536.0f);
+}
+static inline fixed_t fixed_mul(fixed_t a, fixed_t b)
+{
+	return (fixed_t)(((int64_t)a * b + FIXED_HALF) >> 16);
+}
+static inline fixed_t fixed_div(fixed_t a, fixed_t b) // b != 0
+{
+	return (fixed_t)((int64_t)a * FIXED_ONE / b);
+}
+static inline fixed_t fixed_rcp(fixed_t a) // 1/a (+-1) for |a| >= 2 (2^-15), one 32 bit divide
+{
+	uint32_t r = 0xffffffffu / (uint32_t)(a < 0 ? -a : a);
+	return a < 0 ? -(fixed_t)r : (fixed_t)r;
+}
+static inline uint32_t uint64_isqrt(uint64_t a) // floor(sqrt(a))
+{
+	uint64_t r = 0, b = (uint64_t)1 << 62;
+	while (b > a)
+		b >>= 2;
+	while (b) {
+		if (a >= r + b) {
+			a -= r + b;
+			r = (r >> 1) + b;
+		} else {
+			r >>= 1;
+		}
+		b >>= 2;
+	}
+	return (uint32_t)r;
+}
+static inline fixed_t fixed_sqrt(fixed_t a) // a >= 0
+{
+	return (fixed_t)uint64_isqrt((uint64_t)a << 16);
+}
+
+static inline vec3x_t vec3x(fixed_t x, fixed_t y, fixed_t z)
+{
+	vec3x_t r = { { { x, y, z } } };
+	return r;
+}
+static inline vec3x_t vec3x_from_vec3(vec3_t v)
+{
+	vec3x_t r = { { { fixed_from_float(v.x), fixed_from_float(v.y), fixed_from_float(v.z) } } };
+	return r;
+}
+static inline vec3_t vec3x_to_vec3(vec3x_t v)
+{
+	vec3_t r = { { { fixed_to_float(v.x), fixed_to_float(v.y), fixed_to_float(v.z) } } };
+	return r;
+}
+static inline vec3x_t vec3x_add(vec3x_t v0, vec3x_t v1)
+{
+	vec3x_t r = { { { v0.x + v1.x, v0.y + v1.y, v0.z + v1.z } } };
+	return r;
+}
+static inline vec3x_t vec3x_sub(vec3x_t v0, vec3x_t v1)
+{
+	vec3x_t r = { { { v0.x - v1.x, v0.y - v1.y, v0.z - v1.z } } };
+	return r;
+}
+static inline vec3x_t vec3x_mul(vec3x_t v, fixed_t f)
+{
+	vec3x_t r = { { { fixed_mul(v.x, f), fixed_mul(v.y, f), fixed_mul(v.z, f) } } };
+	return r;
+}
+static inline int64_t vec3x_dot_q32(vec3x_t v0, vec3x_t v1) // unrounded, Q32.32
+{
+	return (int64_t)v0.x * v1.x + (int64_t)v0.y * v1.y + (int64_t)v0.z * v1.z;
+}
+static inline fixed_t vec3x_dot(vec3x_t v0, vec3x_t v1)
+{
+	return (fixed_t)((vec3x_dot_q32(v0, v1) + FIXED_HALF) >> 16);
+}
+static inline vec3x_t vec3x_cross(vec3x_t v0, vec3x_t v1)
+{
+	vec3x_t r = { { {
+		(fixed_t)(((int64_t)v0.y * v1.z - (int64_t)v0.z * v1.y + FIXED_HALF) >> 16),
+		(fixed_t)(((int64_t)v0.z * v1.x - (int64_t)v0.x * v1.z + FIXED_HALF) >> 16),
+		(fixed_t)(((int64_t)v0.x * v1.y - (int64_t)v0.y * v1.x + FIXED_HALF) >> 16)
+	} } };
+	return r;
+}
+static inline fixed_t vec3x_length(vec3x_t v)
+{
+	return (fixed_t)uint64_isqrt((uint64_t)vec3x_dot_q32(v, v)); // Q32 -> Q16
+}
+static inline vec3x_t vec3x_normalize(vec3x_t v) // components within 2^-16 of the exact result
+{
+	uint32_t m = (uint32_t)(v.x < 0 ? -v.x : v.x) | (uint32_t)(v.y < 0 ? -v.y : v.y) | (uint32_t)(v.z < 0 ? -v.z : v.z);
+	if (!m)
+		return v;
+	int ls = 0, rs = 0; // largest component to [2^28, 2^29): short vectors keep their precision
+	while ((m << ls) < (1u << 28))
+		ls++;
+	while ((m >> rs) >= (1u << 29))
+		rs++;
+	int64_t x = (int64_t)v.x * (1 << ls) >> rs, y = (int64_t)v.y * (1 << ls) >> rs, z = (int64_t)v.z * (1 << ls) >> rs;
+	uint32_t l = uint64_isqrt((uint64_t)(x * x + y * y + z * z)); // >= 2^28
+	int64_t li = ((int64_t)1 << 62) / l; // one divide
+	vec3x_t r = { { {
+		(fixed_t)((x * li + ((int64_t)1 << 45)) >> 46),
+		(fixed_t)((y * li + ((int64_t)1 << 45)) >> 46),
+		(fixed_t)((z * li + ((int64_t)1 << 45)) >> 46)
+	} } };
+	return r;
+}
+
+static inline void mat4x_from_mat4(mat4x_t *r, const mat4_t *m)
+{
+	for (int i = 0; i < 16; i++)
+		r->m[i] = fixed_from_float(m->m[i]);
+}
+static inline void mat4x_mul(mat4x_t *r, const mat4x_t *m0, const mat4x_t *m1) // r may alias m0 or m1
+{
+	mat4x_t m;
+	for (int c = 0; c < 4; c++) {
+		for (int i = 0; i < 4; i++) {
+			int64_t s = FIXED_HALF;
+			for (int k = 0; k < 4; k++)
+				s += (int64_t)m0->m[k * 4 + i] * m1->m[c * 4 + k];
+			m.m[c * 4 + i] = (fixed_t)(s >> 16);
+		}
+	}
+	*r = m;
+}
+static inline vec3x_t mat4x_transform_vector(const mat4x_t *m, vec3x_t v)
+{
+	vec3x_t r = { { {
+		(fixed_t)(((int64_t)m->m00 * v.x + (int64_t)m->m01 * v.y + (int64_t)m->m02 * v.z + FIXED_HALF) >> 16),
+		(fixed_t)(((int64_t)m->m10 * v.x + (int64_t)m->m11 * v.y + (int64_t)m->m12 * v.z + FIXED_HALF) >> 16),
+		(fixed_t)(((int64_t)m->m20 * v.x + (int64_t)m->m21 * v.y + (int64_t)m->m22 * v.z + FIXED_HALF) >> 16)
+	} } };
+	return r;
+}
+static inline vec4x_t mat4x_transform_vec4(const mat4x_t *m, vec3x_t v) // w = 1, no divide
+{
+	vec4x_t r = { { {
+		(fixed_t)(((int64_t)m->m00 * v.x + (int64_t)m->m01 * v.y + (int64_t)m->m02 * v.z + (int64_t)m->m03 * FIXED_ONE + FIXED_HALF) >> 16),
+		(fixed_t)(((int64_t)m->m10 * v.x + (int64_t)m->m11 * v.y + (int64_t)m->m12 * v.z + (int64_t)m->m13 * FIXED_ONE + FIXED_HALF) >> 16),
+		(fixed_t)(((int64_t)m->m20 * v.x + (int64_t)m->m21 * v.y + (int64_t)m->m22 * v.z + (int64_t)m->m23 * FIXED_ONE + FIXED_HALF) >> 16),
+		(fixed_t)(((int64_t)m->m30 * v.x + (int64_t)m->m31 * v.y + (int64_t)m->m32 * v.z + (int64_t)m->m33 * FIXED_ONE + FIXED_HALF) >> 16)
+	} } };
+	return r;
+}
+static inline vec3x_t mat4x_transform_position(const mat4x_t *m, vec3x_t v) // |w| >= 2^-15
+{
+	vec4x_t p = mat4x_transform_vec4(m, v);
+	fixed_t wi = fixed_rcp(p.w); // one divide instead of three 64 bit ones
+	vec3x_t r = { { { fixed_mul(p.x, wi), fixed_mul(p.y, wi), fixed_mul(p.z, wi) } } };
+	return r;
+}
+
+#endif
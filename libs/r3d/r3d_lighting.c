@@ -0,0 +1,69 @@
+/**
+ * r3d -- 3D rendering library
+ * author: Andreas Mantler (ands)
+ */
+
+#include <r3d_lighting.h>
+
+// the target links without libm: no powf, and sqrtf only on hosts
+
+static float r3d_sqrt(float f)
+{
+#ifdef R3D_ARM_MATH
+	float r;
+	arm_sqrt_f32(f, &r);
+	return r;
+#else
+	return sqrtf(f);
+#endif
+}
+
+static float r3d_pow(float f, int power) // by repeated squaring
+{
+	float r = 1.0f;
+	for (; power > 0; power >>= 1, f *= f)
+		if (power & 1)
+			r *= f;
+	return r;
+}
+
+void r3d_specular_lut(r3d_specular_lut_t *lut, int power, float scale)
+{
+	// smallest n.h which still rounds to an intensity of 1 (bisection)
+	float lo = 0.0f, hi = 1.0f;
+	for (int i = 0; i < 24 && scale > 0.0f; i++) {
+		float mid = (lo + hi) * 0.5f;
+		if (scale * r3d_pow(mid, power) * 255.0f < 0.5f)
+			lo = mid;
+		else
+			hi = mid;
+	}
+	lut->offset = scale > 0.0f ? lo : 0.0f;
+	lut->offset = float_min(lut->offset, 1.0f - 1.0f / (float)R3D_SPECULAR_LUT_SIZE);
+	lut->step = (float)(R3D_SPECULAR_LUT_SIZE - 1) / (1.0f - lut->offset);
+	for (int i = 0; i < R3D_SPECULAR_LUT_SIZE; i++) {
+		float ndoth = lut->offset + (float)i / lut->step;
+		float s = scale * r3d_pow(ndoth, power) * 255.0f;
+		lut->intensity[i] = (uint8_t)float_clamp(s + 0.5f, 0.0f, 255.0f);
+	}
+	lut->intensity[0] = 0; // everything below offset
+}
+
+void r3d_matcap_bake(r3d_matcap_t *matcap, vec3_t l, vec3_t h, int ambient, float diffuse,
+                     const r3d_specular_lut_t *specular)
+{
+	const float half = (float)R3D_MATCAP_SIZE * 0.5f;
+	for (int y = 0; y < R3D_MATCAP_SIZE; y++) {
+		for (int x = 0; x < R3D_MATCAP_SIZE; x++) {
+			vec3_t n = vec3(((float)x + 0.5f) / half - 1.0f, ((float)y + 0.5f) / half - 1.0f, 0.0f);
+			float r = n.x * n.x + n.y * n.y;
+			if (r < 1.0f) // front hemisphere, outside: rim
+				n.z = r3d_sqrt(1.0f - r);
+			else
+				n = vec3_div(n, r3d_sqrt(r));
+			int d = int_clamp(r3d_diffuse(vec3_dot(n, l), diffuse), 0, 255);
+			int a = int_clamp(ambient + r3d_specular(specular, vec3_dot(n, h)), 0, 255);
+			matcap->data[y * R3D_MATCAP_SIZE + x] = (d << 8) | a;
+		}
+	}
+}
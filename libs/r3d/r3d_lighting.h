@@ -0,0 +1,73 @@
+/**
+ * r3d -- 3D rendering library
+ * author: Andreas Mantler (ands)
+ */
+
+#ifndef R3D_LIGHTING_H
+#define R3D_LIGHTING_H
+
+#include <r3d.h>
+
+// lighting helpers for RGB565 fragment shaders: intensities are integers
+// (0..255), specular power curves are looked up instead of evaluated.
+
+#define R3D_SPECULAR_LUT_SIZE 256
+#define R3D_MATCAP_SIZE 64
+
+// the table only covers the n.h range in which the highlight is visible,
+// so that high powers do not band
+typedef struct {
+	float offset, step; // index = (n.h - offset) * step
+	uint8_t intensity[R3D_SPECULAR_LUT_SIZE]; // scale * pow(n.h, power)
+} r3d_specular_lut_t;
+
+void r3d_specular_lut(r3d_specular_lut_t *lut, int power, float scale);
+
+static inline int r3d_specular(const r3d_specular_lut_t *lut, float ndoth)
+{
+	int i = (int)((ndoth - lut->offset) * lut->step + 0.5f);
+	return lut->intensity[int_clamp(i, 0, R3D_SPECULAR_LUT_SIZE - 1)];
+}
+
+// diffuse factor in Q8 (256 = 1.0) for a light of the given intensity
+static inline int r3d_diffuse(float ndotl, float intensity)
+{
+	return (int)(ndotl * intensity * 256.0f);
+}
+
+// c * diffuse + additive (e.g. ambient + specular) per channel, saturating
+static inline uint16_t r3d_light_rgb565(uint16_t c, int diffuse, int additive)
+{
+	return r3d_rgb565(additive + ((r3d_rgb565_r(c) * diffuse) >> 8),
+	                  additive + ((r3d_rgb565_g(c) * diffuse) >> 8),
+	                  additive + ((r3d_rgb565_b(c) * diffuse) >> 8));
+}
+
+// matcap: the lighting of a sphere in view space, indexed by the xy of
+// view space normals, so that shading costs one lookup per fragment.
+// entries are diffuse (Q8, high byte) and additive intensity (low byte)
+// for r3d_light_rgb565, so that the matcap applies to textured surfaces.
+typedef struct {
+	uint16_t data[R3D_MATCAP_SIZE * R3D_MATCAP_SIZE];
+} r3d_matcap_t;
+
+// bakes ambient + diffuse * (n.l) + specular(n.h) with l and h in view space
+void r3d_matcap_bake(r3d_matcap_t *matcap, vec3_t l, vec3_t h, int ambient, float diffuse,
+                     const r3d_specular_lut_t *specular);
+
+static inline int r3d_matcap_index(float nx, float ny)
+{
+	const float half = (float)R3D_MATCAP_SIZE * 0.5f;
+	int x = int_clamp((int)(nx * half + half), 0, R3D_MATCAP_SIZE - 1);
+	int y = int_clamp((int)(ny * half + half), 0, R3D_MATCAP_SIZE - 1);
+	return y * R3D_MATCAP_SIZE + x;
+}
+
+// lights c with the matcap entry of the view space normal (nx, ny)
+static inline uint16_t r3d_matcap_rgb565(const r3d_matcap_t *matcap, float nx, float ny, uint16_t c)
+{
+	uint16_t l = matcap->data[r3d_matcap_index(nx, ny)];
+	return r3d_light_rgb565(c, l >> 8, l & 255);
+}
+
+#endif
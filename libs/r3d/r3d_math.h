@@ -6,6 +6,8 @@
 #ifndef R3D_MATH_H
 #define R3D_MATH_H
 
+#include <stdint.h>
+
 #if defined (ARM_MATH_CM4) || (ARM_MATH_CM3) || (ARM_MATH_CM0)
 #define R3D_ARM_MATH
 #include "arm_math.h"
@@ -13,6 +15,15 @@
 #include <math.h>
 #endif
 
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__SSE__) && !defined(R3D_NO_HOST_SIMD)
+#define R3D_MATH_SSE // host builds: SSE batch transforms (AVX with -mavx)
+#include <immintrin.h>
+#endif
+
+// define R3D_MATH_FAST to let float_rsqrt and all *_normalize functions use
+// the bit trick estimate below instead of a VSQRT + VDIV pair
+//#define R3D_MATH_FAST
+
 #define float_pi		3.1415926535897932f
 #define float_pi_over180	0.017453293f
 
@@ -69,6 +80,19 @@ typedef struct {
 	};
 } mat4_t;
 
+typedef struct { // affine transform: mat4_t without the implicit (0 0 0 1) row
+	union {
+		float m[12];
+		struct {
+			float m00, m10, m20,
+			      m01, m11, m21,
+			      m02, m12, m22,
+			      m03, m13, m23;
+		};
+		vec3_t c[4];
+	};
+} mat34_t;
+
 static inline int int_min(int a, int b)
 {
 	return a < b ? a : b;
@@ -77,6 +101,10 @@ static inline int int_max(int a, int b)
 {
 	return a < b ? b : a;
 }
+static inline int int_abs(int a)
+{
+	return a < 0 ? -a : a;
+}
 static inline int int_clamp(int value, int min, int max)
 {
 	return value < min ? min : (value < max ? value : max);
@@ -94,31 +122,54 @@ static inline float float_clamp(float value, float min, float max)
 {
 	return value < min ? min : (value < max ? value : max);
 }
+static inline int float_ilog2(float f) // floor(log2(f)) for f > 0 (exponent bits)
+{
+	union { float f; uint32_t i; } u = { f };
+	return (int)((u.i >> 23) & 255) - 127;
+}
+static inline float float_rsqrt_fast(float f) // 1/sqrt(f) for f in [2^-125, 2^125]
+{
+	// exponent halving estimate and one tuned newton step,
+	// max relative error 6.6e-4 (below half an 8 bit step).
+	// f * u.f * u.f may be evaluated as f * (u.f * u.f), which leaves the
+	// float range outside the limits above.
+	union { float f; uint32_t i; } u = { f };
+	u.i = 0x5f1ffff9 - (u.i >> 1);
+	return u.f * (1.68191409f - 0.703952253f * f * u.f * u.f);
+}
+static inline float float_rsqrt(float f)
+{
+#ifdef R3D_MATH_FAST
+	return float_rsqrt_fast(f);
+#else
+	return 1.0f / sqrtf(f);
+#endif
+}
 
 static inline vec2_t vec2(float x, float y)
 {
-	vec2_t r = { x, y };
+	vec2_t r = { { { x, y } } };
 	return r;
 }
 static inline vec2_t vec2_add(vec2_t v0, vec2_t v1)
 {
-	vec2_t r = { v0.x + v1.x, v0.y + v1.y };
+	vec2_t r = { { { v0.x + v1.x, v0.y + v1.y } } };
 	return r;
 }
 static inline vec2_t vec2_sub(vec2_t v0, vec2_t v1)
 {
-	vec2_t r = { v0.x - v1.x, v0.y - v1.y };
+	vec2_t r = { { { v0.x - v1.x, v0.y - v1.y } } };
 	return r;
 }
 static inline vec2_t vec2_mul(vec2_t v, float f)
 {
-	vec2_t r = { v.x * f, v.y * f };
+	vec2_t r = { { { v.x * f, v.y * f } } };
 	return r;
 }
 static inline vec2_t vec2_div(vec2_t v, float f)
 {
 	float fi = 1.0f / f;
-	vec2_t r = { v.x * fi, v.y * fi };
+	vec2_t r = { { { v.x * fi, v.y * fi } } };
 	return r;
 }
 static inline float vec2_dot(vec2_t v0, vec2_t v1)
@@ -135,40 +186,40 @@ static inline float vec2_length(vec2_t v)
 }
 static inline vec2_t vec2_normalize(vec2_t v)
 {
-	float fi = 1.0f / sqrtf(v.x * v.x + v.y * v.y);
-	vec2_t r = { v.x * fi, v.y * fi };
+	float fi = float_rsqrt(v.x * v.x + v.y * v.y);
+	vec2_t r = { { { v.x * fi, v.y * fi } } };
 	return r;
 }
 
 static inline vec3_t vec3(float x, float y, float z)
 {
-	vec3_t r = { x, y, z };
+	vec3_t r = { { { x, y, z } } };
 	return r;
 }
 static inline vec3_t vec3_2(vec2_t xy, float z)
 {
-	vec3_t r = { xy.x, xy.y, z };
+	vec3_t r = { { { xy.x, xy.y, z } } };
 	return r;
 }
 static inline vec3_t vec3_add(vec3_t v0, vec3_t v1)
 {
-	vec3_t r = { v0.x + v1.x, v0.y + v1.y, v0.z + v1.z };
+	vec3_t r = { { { v0.x + v1.x, v0.y + v1.y, v0.z + v1.z } } };
 	return r;
 }
 static inline vec3_t vec3_sub(vec3_t v0, vec3_t v1)
 {
-	vec3_t r = { v0.x - v1.x, v0.y - v1.y, v0.z - v1.z };
+	vec3_t r = { { { v0.x - v1.x, v0.y - v1.y, v0.z - v1.z } } };
 	return r;
 }
 static inline vec3_t vec3_mul(vec3_t v, float f)
 {
-	vec3_t r = { v.x * f, v.y * f, v.z * f };
+	vec3_t r = { { { v.x * f, v.y * f, v.z * f } } };
 	return r;
 }
 static inline vec3_t vec3_div(vec3_t v, float f)
 {
 	float fi = 1.0f / f;
-	vec3_t r = { v.x * fi, v.y * fi, v.z * fi };
+	vec3_t r = { { { v.x * fi, v.y * fi, v.z * fi } } };
 	return r;
 }
 static inline float vec3_dot(vec3_t v0, vec3_t v1)
@@ -177,54 +228,60 @@ static inline float vec3_dot(vec3_t v0, vec3_t v1)
 }
 static inline vec3_t vec3_cross(vec3_t v0, vec3_t v1)
 {
-	vec3_t r = { v0.y * v1.z - v0.z * v1.y, v0.z * v1.x - v0.x * v1.z, v0.x * v1.y - v0.y * v1.x };
+	vec3_t r = { { { v0.y * v1.z - v0.z * v1.y, v0.z * v1.x - v0.x * v1.z, v0.x * v1.y - v0.y * v1.x } } };
 	return r;
 }
 static inline float vec3_length(vec3_t v)
 {
 	return sqrtf(v.x * v.x + v.y * v.y + v.z * v.z);
 }
+static inline vec3_t vec3_normalize_fast(vec3_t v) // |result| within 6.6e-4 of 1
+{
+	float fi = float_rsqrt_fast(v.x * v.x + v.y * v.y + v.z * v.z);
+	vec3_t r = { { { v.x * fi, v.y * fi, v.z * fi } } };
+	return r;
+}
 static inline vec3_t vec3_normalize(vec3_t v)
 {
-	float fi = 1.0f / sqrtf(v.x * v.x + v.y * v.y + v.z * v.z);
-	vec3_t r = { v.x * fi, v.y * fi, v.z * fi };
+	float fi = float_rsqrt(v.x * v.x + v.y * v.y + v.z * v.z);
+	vec3_t r = { { { v.x * fi, v.y * fi, v.z * fi } } };
 	return r;
 }
 
 static inline vec4_t vec4(float x, float y, float z, float w)
 {
-	vec4_t r = { x, y, z, w };
+	vec4_t r = { { { x, y, z, w } } };
 	return r;
 }
 static inline vec4_t vec4_2(vec2_t xy, float z, float w)
 {
-	vec4_t r = { xy.x, xy.y, z, w };
+	vec4_t r = { { { xy.x, xy.y, z, w } } };
 	return r;
 }
 static inline vec4_t vec4_3(vec3_t xyz, float w)
 {
-	vec4_t r = { xyz.x, xyz.y, xyz.z, w };
+	vec4_t r = { { { xyz.x, xyz.y, xyz.z, w } } };
 	return r;
 }
 static inline vec4_t vec4_add(vec4_t v0, vec4_t v1)
 {
-	vec4_t r = { v0.x + v1.x, v0.y + v1.y, v0.z + v1.z, v0.w + v1.w };
+	vec4_t r = { { { v0.x + v1.x, v0.y + v1.y, v0.z + v1.z, v0.w + v1.w } } };
 	return r;
 }
 static inline vec4_t vec4_sub(vec4_t v0, vec4_t v1)
 {
-	vec4_t r = { v0.x - v1.x, v0.y - v1.y, v0.z - v1.z, v0.w - v1.w };
+	vec4_t r = { { { v0.x - v1.x, v0.y - v1.y, v0.z - v1.z, v0.w - v1.w } } };
 	return r;
 }
 static inline vec4_t vec4_mul(vec4_t v, float f)
 {
-	vec4_t r = { v.x * f, v.y * f, v.z * f, v.w * f };
+	vec4_t r = { { { v.x * f, v.y * f, v.z * f, v.w * f } } };
 	return r;
 }
 static inline vec4_t vec4_div(vec4_t v, float f)
 {
 	float fi = 1.0f / f;
-	vec4_t r = { v.x * fi, v.y * fi, v.z * fi, v.w * fi };
+	vec4_t r = { { { v.x * fi, v.y * fi, v.z * fi, v.w * fi } } };
 	return r;
 }
 static inline float vec4_dot(vec4_t v0, vec4_t v1)
@@ -241,30 +298,30 @@ static inline float vec4_length(vec4_t v)
 }
 static inline vec4_t vec4_normalize(vec4_t v)
 {
-	float fi = 1.0f / sqrtf(v.x * v.x + v.y * v.y + v.z * v.z + v.w * v.w);
-	vec4_t r = { v.x * fi, v.y * fi, v.z * fi, v.w * fi };
+	float fi = float_rsqrt(v.x * v.x + v.y * v.y + v.z * v.z + v.w * v.w);
+	vec4_t r = { { { v.x * fi, v.y * fi, v.z * fi, v.w * fi } } };
 	return r;
 }
 
 static inline mat4_t mat4(float m00, float m10, float m20, float m30, float m01, float m11, float m21, float m31, float m02, float m12, float m22, float m32, float m03, float m13, float m23, float m33)
 {
-	mat4_t m = {
+	mat4_t m = { { {
 		m00, m10, m20, m30,
 		m01, m11, m21, m31,
 		m02, m12, m22, m32,
 		m03, m13, m23, m33
-	};
+	} } };
 	return m;
 }
 
 static inline mat4_t mat4_identity()
 {
-	mat4_t m = {
+	mat4_t m = { { {
 		1.0f, 0.0f, 0.0f, 0.0f,
 		0.0f, 1.0f, 0.0f, 0.0f,
 		0.0f, 0.0f, 1.0f, 0.0f,
 		0.0f, 0.0f, 0.0f, 1.0f
-	};
+	} } };
 	return m;
 }
 
@@ -278,12 +335,12 @@ static inline mat4_t mat4_ortho(float left, float right,
 	float ty = - (top + bottom) / tb;
 	float fn = far - near;
 	float tz = - (far + near) / fn;
-	mat4_t m = {
+	mat4_t m = { { {
 		2.0f / rl, 0.0f, 0.0f, 0.0f,
 		0.0f, 2.0f / tb, 0.0f, 0.0f,
 		0.0f, 0.0f, -2.0f / fn, 0.0f,
 		tx, ty, tz, 1.0f
-	};
+	} } };
 	return m;
 }
 
@@ -297,18 +354,18 @@ static inline mat4_t mat4_perspective(float fovy, float aspect,
 	float f = 1.0f / tanf(a);
 #endif
 	float nfi = 1.0f / (near - far);
-	mat4_t m = {
+	mat4_t m = { { {
 		f / aspect, 0.0f, 0.0f, 0.0f,
 		0.0f, f, 0.0f, 0.0f,
 		0.0f, 0.0f, (far + near) * nfi, -1.0f,
 		0.0f, 0.0f, 2.0f * far * near * nfi, 0.0f
-	};
+	} } };
 	return m;
 }
 
 static inline mat4_t mat4_mul(mat4_t m0, mat4_t m1)
 {
-	mat4_t m = {
+	mat4_t m = { { {
 		m0.m00*m1.m00 + m0.m01*m1.m10 + m0.m02*m1.m20 + m0.m03 * m1.m30,
 		m0.m10*m1.m00 + m0.m11*m1.m10 + m0.m12*m1.m20 + m0.m13 * m1.m30,
 		m0.m20*m1.m00 + m0.m21*m1.m10 + m0.m22*m1.m20 + m0.m23 * m1.m30,
@@ -328,18 +385,18 @@ static inline mat4_t mat4_mul(mat4_t m0, mat4_t m1)
 		m0.m10*m1.m03 + m0.m11*m1.m13 + m0.m12*m1.m23 + m0.m13 * m1.m33,
 		m0.m20*m1.m03 + m0.m21*m1.m13 + m0.m22*m1.m23 + m0.m23 * m1.m33,
 		m0.m30*m1.m03 + m0.m31*m1.m13 + m0.m32*m1.m23 + m0.m33*m1.m33
-	};
+	} } };
 	return m;
 }
 
 static inline mat4_t mat4_translation(vec3_t v)
 {
-	mat4_t m = {
+	mat4_t m = { { {
 		1.0f, 0.0f, 0.0f, 0.0f,
 		0.0f, 1.0f, 0.0f, 0.0f,
 		0.0f, 0.0f, 1.0f, 0.0f,
 		v.x, v.y, v.z, 1.0f
-	};
+	} } };
 	return m;
 }
 
@@ -349,92 +406,157 @@ static inline mat4_t mat4_lookat(vec3_t eye, vec3_t center, vec3_t up)
 	vec3_t s = vec3_cross(f, vec3_normalize(up));
 	vec3_t u = vec3_cross(vec3_normalize(s), f);
 
-	mat4_t m = {
+	mat4_t m = { { {
 		s.x, u.x, -f.x, 0.0f,
 		s.y, u.y, -f.y, 0.0f,
 		s.z, u.z, -f.z, 0.0f,
 		0.0f, 0.0f, 0.0f, 1.0f
-	};
+	} } };
 	return mat4_mul(m, mat4_translation(vec3_mul(eye, -1.0f)));
 }
 
 static inline mat4_t mat4_scaling(vec3_t v)
 {
-	mat4_t m = {
+	mat4_t m = { { {
 		v.x, 0.0f, 0.0f, 0.0f,
 		0.0f, v.y, 0.0f, 0.0f,
 		0.0f, 0.0f, v.z, 0.0f,
 		0.0f, 0.0f, 0.0f, 1.0f
-	};
+	} } };
 	return m;
 }
 
-static inline mat4_t mat4_rotation(float angle, vec3_t axis)
+// sine and cosine of an angle in degrees
+static inline void float_sincos_degrees(float angle, float *s, float *c)
 {
 #ifdef R3D_ARM_MATH
-	float c, s;
 	const float i360 = 1.0f / 360.0f;
 	int a = (int)(angle * i360);
 	if (angle < 0.0f) a--;
-	arm_sin_cos_f32(angle - (a * 360.0f) - 180.0f, &c, &s); // accepts [-180, 180]
-	// = arm_sin_cos_f32(fmod(angle, 360) - 180, &c, &s)
-	c *= -1.0f;
-	s *= -1.0f; // we're 180° off. correct this
+	arm_sin_cos_f32(angle - (a * 360.0f) - 180.0f, c, s); // accepts [-180, 180]
+	// = arm_sin_cos_f32(fmod(angle, 360) - 180, c, s)
+	*c *= -1.0f;
+	*s *= -1.0f; // we're 180° off. correct this
 #else
 	angle *= float_pi_over180;
-	float c = cosf(angle);
-	float s = sinf(angle);
+	*c = cosf(angle);
+	*s = sinf(angle);
 #endif
+}
+
+static inline mat4_t mat4_rotation(float angle, vec3_t axis)
+{
+	float c, s;
+	float_sincos_degrees(angle, &s, &c);
 	float c2 = 1.0f - c;
 	axis = vec3_normalize(axis);
 	float x = axis.x;
 	float y = axis.y;
 	float z = axis.z;
 
-	mat4_t m = {
+	mat4_t m = { { {
 		x*x*c2 + c, y*x*c2 + z * s, x*z*c2 - y * s, 0.0f,
 		x*y*c2 - z * s, y*y*c2 + c, y*z*c2 + x * s, 0.0f,
 		x*z*c2 + y * s, y*z*c2 - x * s, z*z*c2 + c, 0.0f,
 		0.0f, 0.0f, 0.0f, 1.0f
-	};
+	} } };
 	return m;
 }
 
-static inline vec4_t mat4_transform(mat4_t m, vec4_t v)
+// vertex transforms take the matrix by pointer (like mat34_t and mat4x_t):
+// shaders read it from their uniform block instead of copying 64 bytes
+static inline vec4_t mat4_transform(const mat4_t *m, vec4_t v)
 {
-	vec4_t r = {
-		m.m00*v.x + m.m01*v.y + m.m02*v.z + m.m03 * v.w,
-		m.m10*v.x + m.m11*v.y + m.m12*v.z + m.m13 * v.w,
-		m.m20*v.x + m.m21*v.y + m.m22*v.z + m.m23 * v.w,
-		m.m30*v.x + m.m31*v.y + m.m32*v.z + m.m33*v.w
-	};
+	vec4_t r = { { {
+		m->m00*v.x + m->m01*v.y + m->m02*v.z + m->m03 * v.w,
+		m->m10*v.x + m->m11*v.y + m->m12*v.z + m->m13 * v.w,
+		m->m20*v.x + m->m21*v.y + m->m22*v.z + m->m23 * v.w,
+		m->m30*v.x + m->m31*v.y + m->m32*v.z + m->m33*v.w
+	} } };
 	return r;
 }
 
-static inline vec3_t mat4_transform_position(mat4_t m, vec3_t v)
+static inline vec3_t mat4_transform_position(const mat4_t *m, vec3_t v)
 {
-	float fi = 1.0f / (m.m30 * v.x + m.m31 * v.y + m.m32 * v.z + m.m33);
-	vec3_t r = {
-		(m.m00 * v.x + m.m01 * v.y + m.m02 * v.z + m.m03) * fi,
-		(m.m10 * v.x + m.m11 * v.y + m.m12 * v.z + m.m13) * fi,
-		(m.m20 * v.x + m.m21 * v.y + m.m22 * v.z + m.m23) * fi
-	};
+	float fi = 1.0f / (m->m30 * v.x + m->m31 * v.y + m->m32 * v.z + m->m33);
+	vec3_t r = { { {
+		(m->m00 * v.x + m->m01 * v.y + m->m02 * v.z + m->m03) * fi,
+		(m->m10 * v.x + m->m11 * v.y + m->m12 * v.z + m->m13) * fi,
+		(m->m20 * v.x + m->m21 * v.y + m->m22 * v.z + m->m23) * fi
+	} } };
 	return r;
 }
 
-static inline vec3_t mat4_transform_vector(mat4_t m, vec3_t v)
+static inline vec3_t mat4_transform_vector(const mat4_t *m, vec3_t v)
 {
-	vec3_t r = {
-		m.m00*v.x + m.m01*v.y + m.m02 * v.z,
-		m.m10*v.x + m.m11*v.y + m.m12 * v.z,
-		m.m20*v.x + m.m21*v.y + m.m22*v.z
-	};
+	vec3_t r = { { {
+		m->m00*v.x + m->m01*v.y + m->m02 * v.z,
+		m->m10*v.x + m->m11*v.y + m->m12 * v.z,
+		m->m20*v.x + m->m21*v.y + m->m22*v.z
+	} } };
 	return r;
 }
 
+// structure of arrays: 4 vectors for the batch transforms below
+typedef struct {
+	float x[4], y[4], z[4];
+} vec3x4_t;
+
+static inline void mat4_transform_positions4(const mat4_t *m, const vec3x4_t *v, vec3x4_t *r)
+{
+#ifdef R3D_MATH_SSE
+	// same operations in the same order as mat4_transform_position
+	__m128 x = _mm_loadu_ps(v->x), y = _mm_loadu_ps(v->y), z = _mm_loadu_ps(v->z);
+#define R3D_ROW4(i) _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(m->m##i##0), x), \
+	_mm_mul_ps(_mm_set1_ps(m->m##i##1), y)), _mm_mul_ps(_mm_set1_ps(m->m##i##2), z)), _mm_set1_ps(m->m##i##3))
+	__m128 fi = _mm_div_ps(_mm_set1_ps(1.0f), R3D_ROW4(3));
+	_mm_storeu_ps(r->x, _mm_mul_ps(R3D_ROW4(0), fi));
+	_mm_storeu_ps(r->y, _mm_mul_ps(R3D_ROW4(1), fi));
+	_mm_storeu_ps(r->z, _mm_mul_ps(R3D_ROW4(2), fi));
+#undef R3D_ROW4
+#else
+	for (int i = 0; i < 4; i++) {
+		float x = v->x[i], y = v->y[i], z = v->z[i];
+		float fi = 1.0f / (m->m30 * x + m->m31 * y + m->m32 * z + m->m33);
+		r->x[i] = (m->m00 * x + m->m01 * y + m->m02 * z + m->m03) * fi;
+		r->y[i] = (m->m10 * x + m->m11 * y + m->m12 * z + m->m13) * fi;
+		r->z[i] = (m->m20 * x + m->m21 * y + m->m22 * z + m->m23) * fi;
+	}
+#endif
+}
+
+#if defined(R3D_MATH_SSE) && defined(__AVX__)
+// two vec3x4_t blocks at once
+static inline void mat4_transform_positions8(const mat4_t *m, const vec3x4_t *v, vec3x4_t *r)
+{
+	__m256 x = _mm256_loadu2_m128(v[1].x, v[0].x);
+	__m256 y = _mm256_loadu2_m128(v[1].y, v[0].y);
+	__m256 z = _mm256_loadu2_m128(v[1].z, v[0].z);
+#define R3D_ROW8(i) _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(m->m##i##0), x), \
+	_mm256_mul_ps(_mm256_set1_ps(m->m##i##1), y)), _mm256_mul_ps(_mm256_set1_ps(m->m##i##2), z)), _mm256_set1_ps(m->m##i##3))
+	__m256 fi = _mm256_div_ps(_mm256_set1_ps(1.0f), R3D_ROW8(3));
+	_mm256_storeu2_m128(r[1].x, r[0].x, _mm256_mul_ps(R3D_ROW8(0), fi));
+	_mm256_storeu2_m128(r[1].y, r[0].y, _mm256_mul_ps(R3D_ROW8(1), fi));
+	_mm256_storeu2_m128(r[1].z, r[0].z, _mm256_mul_ps(R3D_ROW8(2), fi));
+#undef R3D_ROW8
+}
+#endif
+
+// mat4_transform_position of n vectors in (n + 3) / 4 blocks
+static inline void mat4_transform_positions_n(const mat4_t *m, const vec3x4_t *v, vec3x4_t *r, uint32_t n)
+{
+	uint32_t i = 0, blocks = (n + 3) / 4;
+#if defined(R3D_MATH_SSE) && defined(__AVX__)
+	for (; i + 1 < blocks; i += 2)
+		mat4_transform_positions8(m, &v[i], &r[i]);
+#endif
+	for (; i < blocks; i++)
+		mat4_transform_positions4(m, &v[i], &r[i]);
+}
+
 static inline mat4_t mat4_invert(mat4_t m)
 {
-	mat4_t mi = {
+	mat4_t mi = { { {
 		m.m11*m.m22*m.m33 + m.m12*m.m23*m.m31 + m.m13*m.m21*m.m32 - m.m11*m.m23*m.m32 - m.m12*m.m21*m.m33 - m.m13*m.m22 * m.m31,
 		m.m10*m.m23*m.m32 + m.m12*m.m20*m.m33 + m.m13*m.m22*m.m30 - m.m10*m.m22*m.m33 - m.m12*m.m23*m.m30 - m.m13*m.m20 * m.m32,
 		m.m10*m.m21*m.m33 + m.m11*m.m23*m.m30 + m.m13*m.m20*m.m31 - m.m10*m.m23*m.m31 - m.m11*m.m20*m.m33 - m.m13*m.m21 * m.m30,
@@ -451,19 +573,133 @@ static inline mat4_t mat4_invert(mat4_t m)
 		m.m00*m.m12*m.m23 + m.m02*m.m13*m.m20 + m.m03*m.m10*m.m22 - m.m00*m.m13*m.m22 - m.m02*m.m10*m.m23 - m.m03*m.m12 * m.m20,
 		m.m00*m.m13*m.m21 + m.m01*m.m10*m.m23 + m.m03*m.m11*m.m20 - m.m00*m.m11*m.m23 - m.m01*m.m13*m.m20 - m.m03*m.m10 * m.m21,
 		m.m00*m.m11*m.m22 + m.m01*m.m12*m.m20 + m.m02*m.m10*m.m21 - m.m00*m.m12*m.m21 - m.m01*m.m10*m.m22 - m.m02*m.m11 * m.m20,
-	};
+	} } };
 	return mi;
 }
 
 static inline mat4_t mat4_transpose(mat4_t m)
 {
-	mat4_t mt = {
+	mat4_t mt = { { {
 		m.m00, m.m01, m.m02, m.m03,
 		m.m10, m.m11, m.m12, m.m13,
 		m.m20, m.m21, m.m22, m.m23,
 		m.m30, m.m31, m.m32, m.m33
-	};
+	} } };
 	return mt;
 }
 
+// affine matrices: pointer based, results may alias the arguments
+static inline void mat34_from_mat4(mat34_t *r, const mat4_t *m)
+{
+	for (int i = 0; i < 4; i++)
+		r->c[i] = m->c[i].xyz;
+}
+
+static inline void mat4_from_mat34(mat4_t *r, const mat34_t *m)
+{
+	for (int i = 0; i < 4; i++)
+		r->c[i] = vec4_3(m->c[i], i == 3 ? 1.0f : 0.0f);
+}
+
+static inline void mat34_identity(mat34_t *r)
+{
+	static const mat34_t identity = { { {
+		1.0f, 0.0f, 0.0f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, 0.0f, 1.0f,
+		0.0f, 0.0f, 0.0f
+	} } };
+	*r = identity;
+}
+
+static inline void mat34_rotation(mat34_t *r, float angle, vec3_t axis)
+{
+	float c, s;
+	float_sincos_degrees(angle, &s, &c);
+	float c2 = 1.0f - c;
+	axis = vec3_normalize(axis);
+	float x = axis.x;
+	float y = axis.y;
+	float z = axis.z;
+
+	mat34_t m = { { {
+		x*x*c2 + c, y*x*c2 + z * s, x*z*c2 - y * s,
+		x*y*c2 - z * s, y*y*c2 + c, y*z*c2 + x * s,
+		x*z*c2 + y * s, y*z*c2 - x * s, z*z*c2 + c,
+		0.0f, 0.0f, 0.0f
+	} } };
+	*r = m;
+}
+
+static inline void mat34_scale(mat34_t *r, vec3_t v) // r = r * scaling(v)
+{
+	for (int i = 0; i < 3; i++)
+		r->c[i] = vec3_mul(r->c[i], v.v[i]);
+}
+
+static inline void mat34_mul(mat34_t *r, const mat34_t *m0, const mat34_t *m1) // 36 instead of 64 multiplies
+{
+	mat34_t m;
+	for (int i = 0; i < 4; i++) {
+		const vec3_t *c = &m1->c[i];
+		for (int j = 0; j < 3; j++)
+			m.c[i].v[j] = m0->m[j] * c->x + m0->m[3 + j] * c->y + m0->m[6 + j] * c->z;
+	}
+	m.c[3] = vec3_add(m.c[3], m0->c[3]);
+	*r = m;
+}
+
+static inline void mat4_mul_mat34(mat4_t *r, const mat4_t *m0, const mat34_t *m1) // r = m0 * affine m1
+{
+	mat4_t m;
+	for (int i = 0; i < 4; i++) {
+		const vec3_t *c = &m1->c[i];
+		for (int j = 0; j < 4; j++)
+			m.c[i].v[j] = m0->m[j] * c->x + m0->m[4 + j] * c->y + m0->m[8 + j] * c->z;
+	}
+	m.c[3] = vec4_add(m.c[3], m0->c[3]);
+	*r = m;
+}
+
+static inline float mat34_determinant(const mat34_t *m) // of the 3x3 part, negative if m mirrors
+{
+	return vec3_dot(m->c[0], vec3_cross(m->c[1], m->c[2]));
+}
+
+static inline void mat34_invert(mat34_t *r, const mat34_t *m) // inverse 3x3 part and -inverse * translation
+{
+	vec3_t x = vec3_cross(m->c[1], m->c[2]);
+	vec3_t y = vec3_cross(m->c[2], m->c[0]);
+	vec3_t z = vec3_cross(m->c[0], m->c[1]);
+	float di = 1.0f / vec3_dot(m->c[0], x);
+	vec3_t t = m->c[3];
+	mat34_t mi = { { { // rows of the inverse are the cross products
+		x.x * di, y.x * di, z.x * di,
+		x.y * di, y.y * di, z.y * di,
+		x.z * di, y.z * di, z.z * di,
+		-vec3_dot(x, t) * di, -vec3_dot(y, t) * di, -vec3_dot(z, t) * di
+	} } };
+	*r = mi;
+}
+
+static inline vec3_t mat34_transform_position(const mat34_t *m, vec3_t v)
+{
+	vec3_t r = { { {
+		m->m00 * v.x + m->m01 * v.y + m->m02 * v.z + m->m03,
+		m->m10 * v.x + m->m11 * v.y + m->m12 * v.z + m->m13,
+		m->m20 * v.x + m->m21 * v.y + m->m22 * v.z + m->m23
+	} } };
+	return r;
+}
+
+static inline vec3_t mat34_transform_vector(const mat34_t *m, vec3_t v)
+{
+	vec3_t r = { { {
+		m->m00 * v.x + m->m01 * v.y + m->m02 * v.z,
+		m->m10 * v.x + m->m11 * v.y + m->m12 * v.z,
+		m->m20 * v.x + m->m21 * v.y + m->m22 * v.z
+	} } };
+	return r;
+}
+
 #endif
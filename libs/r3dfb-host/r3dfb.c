@@ -0,0 +1,78 @@
+/**
+ * r3dfb -- 3D rendering library framebuffer for host builds
+ * author: Andreas Mantler (ands)
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "r3d.h"
+#include "r3dfb.h"
+
+uint16_t r3dfb_color_buffer[R3DFB_PIXEL_WIDTH * R3DFB_PIXEL_HEIGHT];
+r3d_depth_t r3dfb_depth_buffer[R3DFB_PIXEL_WIDTH * R3DFB_PIXEL_HEIGHT];
+void (*r3dfb_trace)(uint16_t x, uint16_t y, r3d_depth_t z, uint16_t color) = 0;
+void (*r3dfb_depth_trace)(uint16_t x, uint16_t y) = 0;
+
+void r3dfb_init(void)
+{
+	r3dfb_clear();
+}
+
+void r3dfb_clear(void)
+{
+	memset(r3dfb_depth_buffer, 0, sizeof(r3dfb_depth_buffer));
+	memset(r3dfb_color_buffer, 0xff, sizeof(r3dfb_color_buffer));
+}
+
+void r3dfb_resolve(void)
+{
+}
+
+void r3dfb_swap_buffers(void)
+{
+}
+
+int r3dfb_write_ppm(const char *filename)
+{
+	FILE *f = fopen(filename, "wb");
+	if (!f)
+		return -1;
+	fprintf(f, "P6 %d %d 255\n", R3DFB_PIXEL_WIDTH, R3DFB_PIXEL_HEIGHT);
+	for (int i = 0; i < R3DFB_PIXEL_WIDTH * R3DFB_PIXEL_HEIGHT; i++) {
+		uint16_t c = r3dfb_color_buffer[i];
+		uint8_t rgb[3] = { r3d_rgb565_r(c), r3d_rgb565_g(c), r3d_rgb565_b(c) };
+		fwrite(rgb, 1, 3, f);
+	}
+	return fclose(f);
+}
+
+// r3d interface
+void r3d_set_pixel(uint16_t x, uint16_t y, r3d_depth_t z, vec3_t color)
+{
+	// convert color to RGB565
+	uint16_t c = ((uint16_t)(color.r * 63488.0f) & 63488) |
+	             ((uint16_t)(color.g * 2016.0f) & 2016) |
+	             ((uint16_t)(color.b * 31.0f) & 31);
+	r3d_set_pixel_rgb565(x, y, z, c);
+}
+
+void r3d_set_pixel_rgb565(uint16_t x, uint16_t y, r3d_depth_t z, uint16_t color)
+{
+	const uint32_t i = x + R3DFB_PIXEL_WIDTH * y;
+	if (r3dfb_trace)
+		r3dfb_trace(x, y, z, color);
+	r3dfb_color_buffer[i] = color;
+	r3dfb_depth_buffer[i] = z;
+}
+
+r3d_depth_t r3d_get_depth(uint16_t x, uint16_t y)
+{
+	if (r3dfb_depth_trace)
+		r3dfb_depth_trace(x, y);
+	return r3dfb_depth_buffer[x + R3DFB_PIXEL_WIDTH * y];
+}
+
+const r3d_depth_t *r3d_get_depth_row(uint16_t y)
+{
+	return r3dfb_depth_trace ? 0 : &r3dfb_depth_buffer[R3DFB_PIXEL_WIDTH * y]; // traced reads go through r3d_get_depth
+}
@@ -0,0 +1,37 @@
+/**
+ * r3dfb -- 3D rendering library framebuffer for host builds
+ * author: Andreas Mantler (ands)
+ */
+
+#ifndef R3DFB_H
+#define R3DFB_H
+
+#include <r3d.h>
+
+// same interface as the target framebuffers, backed by plain arrays, for
+// the benchmarks and tests in bench/ and tests/ (see the Makefile)
+
+// 240x320 like the STM32F429-DISCOVERY display, other sizes with e.g.
+// -DR3DFB_PIXEL_WIDTH=1920 -DR3DFB_PIXEL_HEIGHT=1080 (see bench/rasterizer1080)
+#ifndef R3DFB_PIXEL_WIDTH
+#define R3DFB_PIXEL_WIDTH ((uint16_t) 240)
+#endif
+#ifndef R3DFB_PIXEL_HEIGHT
+#define R3DFB_PIXEL_HEIGHT ((uint16_t) 320)
+#endif
+
+extern uint16_t r3dfb_color_buffer[R3DFB_PIXEL_WIDTH * R3DFB_PIXEL_HEIGHT];
+extern r3d_depth_t r3dfb_depth_buffer[R3DFB_PIXEL_WIDTH * R3DFB_PIXEL_HEIGHT];
+
+// optional callback for every stored pixel, e.g. to compare rasterizers
+extern void (*r3dfb_trace)(uint16_t x, uint16_t y, r3d_depth_t z, uint16_t color);
+// optional callback for every depth read, e.g. to count memory accesses
+extern void (*r3dfb_depth_trace)(uint16_t x, uint16_t y);
+
+void r3dfb_init(void);
+void r3dfb_clear(void); // clears color buffer and depth buffer
+void r3dfb_resolve(void);
+void r3dfb_swap_buffers(void);
+int r3dfb_write_ppm(const char *filename); // color buffer as binary PPM, 0 on success
+
+#endif
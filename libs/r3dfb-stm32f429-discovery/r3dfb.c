@@ -9,6 +9,8 @@
 #include "r3d.h"
 #include "r3dfb.h"
 
+#define R3DFB_RESOLVE_BLOCK 64 // pixel pairs, divides R3DFB_PIXEL_WIDTH * R3DFB_PIXEL_HEIGHT / 2
+
 static uint32_t r3dfb_front_buffer = R3DFB_BUFFER0;
 static uint32_t r3dfb_back_buffer = R3DFB_BUFFER1;
 
@@ -45,8 +47,31 @@ void r3dfb_init(void)
 
 void r3dfb_clear(void)
 {
+#ifdef R3DFB_INTERLEAVED
+	uint32_t *p = (uint32_t *) R3DFB_DEPTH_BUFFER;
+	for (uint32_t i = 0; i < R3DFB_PIXEL_WIDTH * R3DFB_PIXEL_HEIGHT; i++)
+		p[i] = 0x0000ffff; // depth 0, white
+#else
 	memset((void *) R3DFB_DEPTH_BUFFER, 0, R3DFB_DEPTH_BUFFER_SIZE);
 	memset((void *) r3dfb_back_buffer, 0xff, R3DFB_COLOR_BUFFER_SIZE);
+#endif
+}
+
+void r3dfb_resolve(void)
+{
+#ifdef R3DFB_INTERLEAVED
+	// both buffers are in the same SDRAM bank: packing one 512 byte row
+	// into internal RAM before storing it avoids a row switch per pixel pair
+	static uint32_t block[R3DFB_RESOLVE_BLOCK];
+	const uint32_t *src = (const uint32_t *) R3DFB_DEPTH_BUFFER;
+	uint32_t *dst = (uint32_t *) r3dfb_back_buffer;
+	for (uint32_t i = 0; i < R3DFB_PIXEL_WIDTH * R3DFB_PIXEL_HEIGHT / 2; i += R3DFB_RESOLVE_BLOCK) {
+		for (uint32_t j = 0; j < R3DFB_RESOLVE_BLOCK; j++, src += 2)
+			block[j] = (src[0] & 0xffff) | (src[1] << 16); // two pixels per store
+		for (uint32_t j = 0; j < R3DFB_RESOLVE_BLOCK; j++)
+			dst[i + j] = block[j];
+	}
+#endif
 }
 
 void r3dfb_swap_buffers(void)
@@ -66,22 +91,39 @@ void r3dfb_swap_buffers(void)
 }
 
 // r3d interface
-void r3d_set_pixel(uint16_t x, uint16_t y, float z, vec3_t color)
+void r3d_set_pixel(uint16_t x, uint16_t y, r3d_depth_t z, vec3_t color)
 {
 	// convert color to RGB565
 	uint16_t c = ((uint16_t)(color.r * 63488.0f) & 63488) |
 	             ((uint16_t)(color.g * 2016.0f) & 2016) |
 	             ((uint16_t)(color.b * 31.0f) & 31);
-	// set color + depth
-	const uint32_t offset = 2 * (x + R3DFB_PIXEL_WIDTH * y);
-	*(__IO uint16_t *) (r3dfb_back_buffer + offset) = c;
-	*(__IO uint16_t *) (R3DFB_DEPTH_BUFFER + offset) = z * 65535.0f;
+	r3d_set_pixel_rgb565(x, y, z, c);
+}
+
+#ifdef R3DFB_INTERLEAVED
+void r3d_set_pixel_rgb565(uint16_t x, uint16_t y, r3d_depth_t z, uint16_t color)
+{
+	const uint32_t i = x + R3DFB_PIXEL_WIDTH * y;
+	*(__IO uint32_t *) (R3DFB_DEPTH_BUFFER + 4 * i) = ((uint32_t)z << 16) | color; // one store
+}
+
+r3d_depth_t r3d_get_depth(uint16_t x, uint16_t y)
+{
+	const uint32_t i = x + R3DFB_PIXEL_WIDTH * y;
+	return *(__IO uint32_t *) (R3DFB_DEPTH_BUFFER + 4 * i) >> 16;
+}
+#else
+void r3d_set_pixel_rgb565(uint16_t x, uint16_t y, r3d_depth_t z, uint16_t color)
+{
+	const uint32_t i = x + R3DFB_PIXEL_WIDTH * y;
+	*(__IO uint16_t *) (r3dfb_back_buffer + 2 * i) = color;
+	*(__IO r3d_depth_t *) (R3DFB_DEPTH_BUFFER + sizeof(r3d_depth_t) * i) = z;
 }
 
-float r3d_get_depth(uint16_t x, uint16_t y)
+r3d_depth_t r3d_get_depth(uint16_t x, uint16_t y)
 {
-	const float uint16to1f = 1.0f / 65535.0f;
-	const uint32_t offset = 2 * (x + R3DFB_PIXEL_WIDTH * y);
-	return (*(__IO uint16_t *) (R3DFB_DEPTH_BUFFER + offset)) * uint16to1f;
+	const uint32_t i = x + R3DFB_PIXEL_WIDTH * y;
+	return *(__IO r3d_depth_t *) (R3DFB_DEPTH_BUFFER + sizeof(r3d_depth_t) * i);
 }
+#endif
 
@@ -6,11 +6,28 @@
 #ifndef R3DFB_H
 #define R3DFB_H
 
+#include <r3d.h>
+
 #define R3DFB_PIXEL_WIDTH ((uint16_t) 240)
 #define R3DFB_PIXEL_HEIGHT ((uint16_t) 320)
 
+// optional render target with RGB565 color in the low and 16 bit depth in
+// the high half of one 32 bit word per pixel (at R3DFB_DEPTH_BUFFER), so a
+// fragment is one read and one write of the same SDRAM row instead of
+// accesses to two distant buffers. r3dfb_resolve copies the colors to the
+// back buffer for display.
+//#define R3DFB_INTERLEAVED
+
+#if defined(R3DFB_INTERLEAVED) && R3D_DEPTH_BITS != 16
+#error "R3DFB_INTERLEAVED requires R3D_DEPTH_BITS 16"
+#endif
+
 #define R3DFB_COLOR_BUFFER_SIZE (R3DFB_PIXEL_WIDTH * R3DFB_PIXEL_HEIGHT * sizeof(uint16_t))
-#define R3DFB_DEPTH_BUFFER_SIZE (R3DFB_PIXEL_WIDTH * R3DFB_PIXEL_HEIGHT * sizeof(uint16_t))
+#ifdef R3DFB_INTERLEAVED
+#define R3DFB_DEPTH_BUFFER_SIZE (R3DFB_PIXEL_WIDTH * R3DFB_PIXEL_HEIGHT * sizeof(uint32_t))
+#else
+#define R3DFB_DEPTH_BUFFER_SIZE (R3DFB_PIXEL_WIDTH * R3DFB_PIXEL_HEIGHT * sizeof(r3d_depth_t))
+#endif
 
 #define R3DFB_BUFFER_OFFSET ((uint32_t) 0x50000)
 #define R3DFB_BUFFER0 ((uint32_t) 0xD0000000)
@@ -19,6 +36,7 @@
 
 void r3dfb_init(void);
 void r3dfb_clear(void); // clears color back buffer and depth buffer
+void r3dfb_resolve(void); // R3DFB_INTERLEAVED: colors to the back buffer (call before drawing text)
 void r3dfb_swap_buffers(void); // swaps back and front color buffers
 
 #endif
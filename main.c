@@ -5,45 +5,66 @@
 #include "stm32f429i_discovery_l3gd20.h"
 #include <r3dfb.h>
 #include <r3d.h>
+#include <r3d_lighting.h>
 #include <string.h>
+#include <stddef.h>
 #include <stdio.h>
 
 static char *itoa(int value, char* result, int base);
 
-// vertex format
+// vertex format: positions and attributes in separate streams
 typedef struct {
 	uint16_t x, y, z;
+} vertex_position_t;
+
+typedef struct {
 	uint8_t nx, ny, nz;
 	uint8_t u, v;
-} vertex_t;
+} vertex_attributes_t;
+
+typedef struct { // static lighting baked by tools/meshconv (255 = 1.0)
+	uint8_t light;
+} vertex_baked_t;
 
 // meshes:
 #include "teapot.h"
 #include "box.h"
 #include "pony.h"
+#include "teapot_faces.h"
+#include "box_faces.h"
+#include "pony_faces.h"
+#include "teapot_baked.h"
+#include "box_baked.h"
+#include "pony_baked.h"
 
 // textures:
-#include "nyan.h"
-#include "box_texture.h"
-#include "twilight.h"
+#include "nyan_mips.h"
+#include "box_texture_mips.h"
+#include "twilight_mips.h"
 
 static const r3d_drawcall_t meshes[] = {
-	{ R3D_PRIMITIVE_TYPE_TRIANGLES, vertices0,
-	  sizeof(vertex_t), sizeof(vertices0) / sizeof(vertex_t), 0 },
-	{ R3D_PRIMITIVE_TYPE_TRIANGLES, vertices1,
-	  sizeof(vertex_t), sizeof(vertices1) / sizeof(vertex_t), 0 },
-	{ R3D_PRIMITIVE_TYPE_TRIANGLES, vertices2,
-	  sizeof(vertex_t), sizeof(vertices2) / sizeof(vertex_t), 0 },
+	{ R3D_PRIMITIVE_TYPE_TRIANGLES,
+	  { { positions0, sizeof(vertex_position_t) }, { attributes0, sizeof(vertex_attributes_t) },
+	    { baked0, sizeof(vertex_baked_t) } },
+	  sizeof(positions0) / sizeof(vertex_position_t), 0, faces0 },
+	{ R3D_PRIMITIVE_TYPE_TRIANGLES,
+	  { { positions1, sizeof(vertex_position_t) }, { attributes1, sizeof(vertex_attributes_t) },
+	    { baked1, sizeof(vertex_baked_t) } },
+	  sizeof(positions1) / sizeof(vertex_position_t), 0, faces1 },
+	{ R3D_PRIMITIVE_TYPE_TRIANGLES,
+	  { { positions2, sizeof(vertex_position_t) }, { attributes2, sizeof(vertex_attributes_t) },
+	    { baked2, sizeof(vertex_baked_t) } },
+	  sizeof(positions2) / sizeof(vertex_position_t), 0, faces2 },
 };
 static const r3d_primitive_winding_t windings[] = {
 	R3D_PRIMITIVE_WINDING_CW,
 	R3D_PRIMITIVE_WINDING_CCW,
 	R3D_PRIMITIVE_WINDING_CCW
 };
-static const r3d_texture_t *textures[] = {
-	(r3d_texture_t *) &nyan,
-	(r3d_texture_t *) &box_texture,
-	(r3d_texture_t *) &twilight
+static const r3d_mipmap_t *textures[] = {
+	(r3d_mipmap_t *) &nyan_mips,
+	(r3d_mipmap_t *) &box_texture_mips,
+	(r3d_mipmap_t *) &twilight_mips
 };
 
 // simulation stuff
@@ -51,58 +72,236 @@ static float time = 0.0f, frametime = 0.0f;
 static uint32_t fps = 0;
 static uint8_t fps_str[8] = "? FPS";
 static uint8_t info_str[16];
-static mat4_t model, view, projection, mv, mvp;
+static mat34_t model, view, mv; // affine
+static mat4_t projection, mvp;
 static int mesh = 0;
+static int shading = 0;
 static float axes[3] = {0};
 
 // shader
+typedef struct {
+	// set per frame
+	mat4_t mvp_q; // model view projection including position decoding
+#ifdef R3D_FIXED
+	mat4x_t mvp_qx; // the same for positions used as Q16 values
+#endif
+	mat34_t mv;
+	const r3d_mipmap_t *texture;
+	vec3_t E, L; // eye and light direction
+	const r3d_specular_lut_t *specular;
+	const r3d_matcap_t *matcap;
+	// derived per draw call in shader_prologue
+	vec3_t H;
+	r3d_mipmap_sampler_t sampler;
+} uniforms_t;
+
 typedef struct {
 	vec3_t position;
 	vec3_t normal;
-	vec2_t uv;
+	vec2_t uv; // Q16 fixed point (see r3d_sampler_t)
 } vs_to_fs_t;
 
-static void vertex_shader(const vertex_t *in, vs_to_fs_t *out)
+typedef struct { // gouraud shading
+	vec3_t position;
+	float diffuse, additive; // see r3d_light_rgb565
+	vec2_t uv;
+} vs_to_fs_lit_t;
+
+static uniforms_t uniforms;
+static r3d_specular_lut_t specular_lut;
+static r3d_matcap_t matcap;
+
+// resident copies of the bound textures in CCMRAM (see r3d_texture_cache_bind)
+static uint8_t texture_pool[48 * 1024] __attribute__((section(".ccmbss"), aligned(4)));
+
+static void shader_prologue(uniforms_t *u)
 {
-	// decode vertex
-	const vec3_t pc = { 0.5f, 0.5f, 0.5f }, nc = { 1.0f, 1.0f, 1.0f };
-	const float pi = 1.0f / 65535.0f, ni = 2.0f / 255.0f, uvi = 1.0f / 255.0f;
-	vec3_t position = vec3_sub(vec3_mul(vec3(in->x, in->y, in->z), pi), pc);
-	vec3_t normal = vec3_sub(vec3_mul(vec3(in->nx, in->ny, in->nz), ni), nc);
-	vec2_t uv = vec2_mul(vec2(in->u, in->v), uvi);
-	// transform vertex
-	out->position = mat4_transform_position(mvp, position);
-	out->normal = mat4_transform_vector(mv, normal);
+	u->H = vec3_normalize(vec3_add(u->E, u->L)); // blinn-phong half vector
+	r3d_mipmap_sampler(&u->sampler, u->texture);
+	r3d_texture_cache_bind(&u->sampler);
+}
+
+static void vertex_shader_position(const uniforms_t *u, const void *const *in, vs_to_fs_t *out)
+{
+	// quantized position: decoding is part of mvp_q
+	const vertex_position_t *p = in[0];
+#ifdef R3D_FIXED
+	vec3x_t position = mat4x_transform_position(&u->mvp_qx, vec3x(p->x, p->y, p->z)); // integer math
+	out->position = vec3x_to_vec3(position);
+#else
+	out->position = mat4_transform_position(&u->mvp_q, vec3(p->x, p->y, p->z));
+#endif
+}
+
+// vertex_shader_position for R3D_TRIANGLE_BATCH triangles at a time: the
+// float transform keeps mvp_q in registers across vertices
+static void vertex_shader_positions_n(const uniforms_t *u, const void *const (*in)[R3D_VERTEX_STREAMS_MAX],
+                                      vec3x4_t *out, uint32_t n)
+{
+#ifdef R3D_FIXED
+	for (uint32_t i = 0; i < n; i++) {
+		const vertex_position_t *p = in[i][0];
+		vec3_t position = vec3x_to_vec3(mat4x_transform_position(&u->mvp_qx, vec3x(p->x, p->y, p->z)));
+		out[i / 4].x[i % 4] = position.x;
+		out[i / 4].y[i % 4] = position.y;
+		out[i / 4].z[i % 4] = position.z;
+	}
+#else
+	vec3x4_t q[(3 * R3D_TRIANGLE_BATCH + 3) / 4];
+	for (uint32_t i = 0; i < (n + 3) / 4 * 4; i++) {
+		const vertex_position_t *p = in[i < n ? i : 0][0]; // pad with the first vertex
+		q[i / 4].x[i % 4] = p->x;
+		q[i / 4].y[i % 4] = p->y;
+		q[i / 4].z[i % 4] = p->z;
+	}
+	mat4_transform_positions_n(&u->mvp_q, q, out, n);
+#endif
+}
+
+static void vertex_shader_attributes(const uniforms_t *u, const void *const *in, vs_to_fs_t *out)
+{
+	// decode vertex attributes (only for vertices of visible triangles)
+	const vertex_attributes_t *a = in[1];
+	const float uvi = R3D_UV_ONE / 255.0f;
+	vec3_t normal = r3d_dequantize_normal(a->nx, a->ny, a->nz);
+	vec2_t uv = vec2_mul(vec2(a->u, a->v), uvi);
+	// transform vertex attributes
+	out->normal = mat34_transform_vector(&u->mv, normal);
 	out->uv = uv;
 }
 
-static vec4_t fragment_shader(const vs_to_fs_t *in)
+static uint16_t fragment_shader(const uniforms_t *u, const vs_to_fs_t *in)
+{
+	vec3_t N = vec3_normalize_fast(in->normal);
+
+	const int ambient = 13; // 0.05
+	int diffuse = r3d_diffuse(vec3_dot(N, u->L), 0.6f);
+	int specular = r3d_specular(u->specular, vec3_dot(N, u->H));
+
+	const r3d_sampler_t *s = r3d_mipmap_select(&u->sampler);
+	uint16_t c = r3d_sample_repeat(s, (int32_t)in->uv.x, (int32_t)in->uv.y); // read texel
+	return r3d_light_rgb565(c, diffuse, ambient + specular);
+}
+
+// matcap shading: lighting is a single lookup by the view space normal
+static void vertex_shader_attributes_matcap(const uniforms_t *u, const void *const *in, vs_to_fs_t *out)
+{
+	const vertex_attributes_t *a = in[1];
+	const float uvi = R3D_UV_ONE / 255.0f;
+	vec3_t normal = r3d_dequantize_normal(a->nx, a->ny, a->nz);
+	out->normal = vec3_normalize(mat34_transform_vector(&u->mv, normal)); // per vertex
+	out->uv = vec2_mul(vec2(a->u, a->v), uvi);
+}
+
+static uint16_t fragment_shader_matcap(const uniforms_t *u, const vs_to_fs_t *in)
+{
+	const r3d_sampler_t *s = r3d_mipmap_select(&u->sampler);
+	uint16_t c = r3d_sample_repeat(s, (int32_t)in->uv.x, (int32_t)in->uv.y); // read texel
+	return r3d_matcap_rgb565(u->matcap, in->normal.x, in->normal.y, c);
+}
+
+// gouraud shading: lighting per vertex, interpolated as two varyings
+static void vertex_shader_attributes_gouraud(const uniforms_t *u, const void *const *in, vs_to_fs_lit_t *out)
 {
-	const vec3_t E = { 0, 0, 1 };
-	const vec3_t L = { -0.577350269f, 0.577350269f, 0.577350269f };
-	vec3_t N = vec3_normalize(in->normal);
-	vec3_t H = vec3_normalize(vec3_add(E, L));
-
-	const float ambient = 0.05f;
-	float diffuse = vec3_dot(N, L) * 0.6f;
-	float specular = vec3_dot(N, H);
-	specular *= specular;
-	specular *= specular;
-	specular *= specular;
-	specular *= specular;
-	specular *= specular;
-	specular *= specular * 0.6f;
-
-	vec3_t c = r3d_texture_nearest(textures[mesh], in->uv); // read texel
-	return vec4(ambient + diffuse * c.r + specular,
-	            ambient + diffuse * c.g + specular,
-	            ambient + diffuse * c.b + specular, 1.0f);
+	const vertex_attributes_t *a = in[1];
+	const float uvi = R3D_UV_ONE / 255.0f;
+	vec3_t normal = r3d_dequantize_normal(a->nx, a->ny, a->nz);
+	vec3_t N = vec3_normalize(mat34_transform_vector(&u->mv, normal));
+	out->diffuse = (float)r3d_diffuse(vec3_dot(N, u->L), 0.6f);
+	out->additive = (float)(13 + r3d_specular(u->specular, vec3_dot(N, u->H)));
+	out->uv = vec2_mul(vec2(a->u, a->v), uvi);
 }
 
-static r3d_shader_t shader = {
-	(r3d_vertexshader_func)vertex_shader,
-	(r3d_fragmentshader_func)fragment_shader,
-	sizeof(vs_to_fs_t) / sizeof(float)
+static uint16_t fragment_shader_gouraud(const uniforms_t *u, const vs_to_fs_lit_t *in)
+{
+	const r3d_sampler_t *s = r3d_mipmap_select(&u->sampler);
+	uint16_t c = r3d_sample_repeat(s, (int32_t)in->uv.x, (int32_t)in->uv.y); // read texel
+	return r3d_light_rgb565(c, (int)in->diffuse, (int)in->additive);
+}
+
+// baked lighting: diffuse and ambient occlusion come from the baked
+// stream, only the view dependent specular is evaluated (per vertex)
+static void vertex_shader_attributes_baked(const uniforms_t *u, const void *const *in, vs_to_fs_lit_t *out)
+{
+	const vertex_attributes_t *a = in[1];
+	const vertex_baked_t *b = in[2];
+	const float uvi = R3D_UV_ONE / 255.0f;
+	vec3_t normal = r3d_dequantize_normal(a->nx, a->ny, a->nz);
+	vec3_t N = vec3_normalize(mat34_transform_vector(&u->mv, normal));
+	out->diffuse = (float)(b->light + (b->light >> 7)); // Q8
+	out->additive = (float)r3d_specular(u->specular, vec3_dot(N, u->H));
+	out->uv = vec2_mul(vec2(a->u, a->v), uvi);
+}
+
+static const r3d_shader_t shaders[] = {
+	{ // blinn-phong per fragment
+		0, // split into position and attribute shader
+		0, // packed RGB565 fragment shader below
+		sizeof(vs_to_fs_t) / sizeof(float),
+		(r3d_vertexshader_func)vertex_shader_position,
+		(r3d_vertexshader_func)vertex_shader_attributes,
+		R3D_VARYINGS(3, 5), // normal, uv (position is not used by the fragment shader)
+		0,
+		&uniforms,
+		(r3d_prologue_func)shader_prologue,
+		(r3d_fragmentshader565_func)fragment_shader,
+		offsetof(vs_to_fs_t, uv) / sizeof(float), // mip level selection
+		(r3d_positionshader_n_func)vertex_shader_positions_n
+	},
+	{ // matcap
+		0,
+		0,
+		sizeof(vs_to_fs_t) / sizeof(float),
+		(r3d_vertexshader_func)vertex_shader_position,
+		(r3d_vertexshader_func)vertex_shader_attributes_matcap,
+		R3D_VARYINGS(3, 2) | R3D_VARYINGS(6, 2), // normal xy, uv
+		0,
+		&uniforms,
+		(r3d_prologue_func)shader_prologue,
+		(r3d_fragmentshader565_func)fragment_shader_matcap,
+		offsetof(vs_to_fs_t, uv) / sizeof(float),
+		(r3d_positionshader_n_func)vertex_shader_positions_n
+	},
+	{ // gouraud
+		0,
+		0,
+		sizeof(vs_to_fs_lit_t) / sizeof(float),
+		(r3d_vertexshader_func)vertex_shader_position, // position is the first member of both
+		(r3d_vertexshader_func)vertex_shader_attributes_gouraud,
+		R3D_VARYINGS(3, 4), // diffuse, additive, uv
+		0,
+		&uniforms,
+		(r3d_prologue_func)shader_prologue,
+		(r3d_fragmentshader565_func)fragment_shader_gouraud,
+		offsetof(vs_to_fs_lit_t, uv) / sizeof(float),
+		(r3d_positionshader_n_func)vertex_shader_positions_n
+	},
+	{ // baked diffuse, gouraud specular
+		0,
+		0,
+		sizeof(vs_to_fs_lit_t) / sizeof(float),
+		(r3d_vertexshader_func)vertex_shader_position,
+		(r3d_vertexshader_func)vertex_shader_attributes_baked,
+		R3D_VARYINGS(3, 4), // diffuse, additive, uv
+		0,
+		&uniforms,
+		(r3d_prologue_func)shader_prologue,
+		(r3d_fragmentshader565_func)fragment_shader_gouraud, // same combine
+		offsetof(vs_to_fs_lit_t, uv) / sizeof(float),
+		(r3d_positionshader_n_func)vertex_shader_positions_n
+	}
+};
+
+static const struct {
+	const char *name;
+	const r3d_shader_t *shader;
+	r3d_shading_t shading; // per draw call
+} shading_modes[] = {
+	{ "phong", &shaders[0], R3D_SHADING_FRAGMENT },
+	{ "matcap", &shaders[1], R3D_SHADING_FRAGMENT },
+	{ "gouraud", &shaders[2], R3D_SHADING_FRAGMENT },
+	{ "flat", &shaders[0], R3D_SHADING_FLAT }, // phong once per triangle
+	{ "baked", &shaders[3], R3D_SHADING_FRAGMENT }
 };
 
 static void init(void)
@@ -117,11 +316,19 @@ static void init(void)
 	strcat(info_str, " tris");
 
 	r3d_viewport(1, 1, R3DFB_PIXEL_WIDTH - 1, R3DFB_PIXEL_HEIGHT - 1);
+	r3d_texture_cache_init(texture_pool, sizeof(texture_pool));
 	r3d_backface_culling = R3D_ENABLE;
 	r3d_primitive_winding = windings[mesh];
 
 	projection = mat4_perspective(60.0f, (float)R3DFB_PIXEL_WIDTH / (float)R3DFB_PIXEL_HEIGHT, 0.5f, 5.0f);
-	view = mat4_lookat(vec3(0.0f, 0.25f, 1.5f), vec3(0.0f, 0.0f, 0.0f), vec3(0.0f, 1.0f, 0.0f));
+	mat4_t lookat = mat4_lookat(vec3(0.0f, 0.25f, 1.5f), vec3(0.0f, 0.0f, 0.0f), vec3(0.0f, 1.0f, 0.0f));
+	mat34_from_mat4(&view, &lookat);
+	uniforms.E = vec3(0.0f, 0.0f, 1.0f);
+	uniforms.L = vec3(-0.577350269f, 0.577350269f, 0.577350269f);
+	r3d_specular_lut(&specular_lut, 64, 0.6f);
+	uniforms.specular = &specular_lut;
+	r3d_matcap_bake(&matcap, uniforms.L, vec3_normalize(vec3_add(uniforms.E, uniforms.L)), 13, 0.6f, &specular_lut);
+	uniforms.matcap = &matcap;
 
 	L3GD20_InitTypeDef L3GD20_InitStructure;
 	L3GD20_InitStructure.Power_Mode = L3GD20_MODE_ACTIVE;
@@ -160,6 +367,8 @@ static void update(void)
 
 	if (STM_EVAL_PBGetState(BUTTON_USER)) {
 		mesh = (mesh + 1) % 3; // next mesh
+		if (mesh == 0) // then next shading mode
+			shading = (shading + 1) % (sizeof(shading_modes) / sizeof(shading_modes[0]));
 		r3d_primitive_winding = windings[mesh];
 		itoa(meshes[mesh].count / 3, info_str, 10);
 		strcat(info_str, " tris");
@@ -172,22 +381,40 @@ static void update(void)
 		axes[i] += (float)a[i] * delta / 114.285f;
 	if (axes[0] < 0) axes[0] = 0;
 	if (axes[0] > 180) axes[0] = 180;
-	model = mat4_mul(
-	            mat4_rotation(axes[0], vec3(1.0f, 0.0f, 0.0f)),
-	            mat4_rotation(axes[1], vec3(0.0f, 1.0f, 0.0f)));
-	if (mesh == 1) model = mat4_mul(model, mat4_scaling(vec3(0.5f, 0.5f, 0.5f)));
-	mv = mat4_mul(view, model);
-	mvp = mat4_mul(projection, mv);
+	mat34_t rotation;
+	mat34_rotation(&model, axes[0], vec3(1.0f, 0.0f, 0.0f));
+	mat34_rotation(&rotation, axes[1], vec3(0.0f, 1.0f, 0.0f));
+	mat34_mul(&model, &model, &rotation);
+	if (mesh == 1) mat34_scale(&model, vec3(0.5f, 0.5f, 0.5f));
+	mat34_mul(&mv, &view, &model);
+	mat4_mul_mat34(&mvp, &projection, &mv);
+	mat34_t mvi;
+	mat34_invert(&mvi, &mv);
+	r3d_eye_position = mvi.c[3]; // transformed origin
+	r3d_eye_mirrored = mat34_determinant(&mv) < 0.0f;
 }
 
 static void render(void)
 {
 	r3dfb_clear();
 
-	r3d_shader = shader;
-	r3d_draw(&meshes[mesh]);
+	uniforms.mvp_q = mvp;
+	r3d_dequantization_matrix(&uniforms.mvp_q, vec3(1.0f / 65535.0f, 1.0f / 65535.0f, 1.0f / 65535.0f),
+	                          vec3(-0.5f, -0.5f, -0.5f));
+#ifdef R3D_FIXED
+	r3d_dequantization_matrix_fixed(&uniforms.mvp_qx, &mvp, vec3(1.0f / 65535.0f, 1.0f / 65535.0f, 1.0f / 65535.0f),
+	                                vec3(-0.5f, -0.5f, -0.5f));
+#endif
+	uniforms.mv = mv;
+	uniforms.texture = textures[mesh];
+	r3d_drawcall_t drawcall = meshes[mesh];
+	drawcall.shading = shading_modes[shading].shading;
+	r3d_shader = *shading_modes[shading].shader;
+	r3d_draw(&drawcall);
+	r3dfb_resolve();
 
 	LCD_DisplayStringLine(LCD_LINE_1, info_str);
+	LCD_DisplayStringLine(LCD_LINE_2, (uint8_t *)shading_modes[shading].name);
 	LCD_DisplayStringLine(LCD_LINE_3, fps_str);
 
 	char str[16] = "X: ";
@@ -200,6 +427,18 @@ static void render(void)
 	itoa(axes[2], str + 3, 10);
 	LCD_DisplayStringLine(LCD_LINE_7, str);
 
+	// texture cache: levels already resident / levels bound, bytes copied this frame
+	r3d_texture_cache_stats_t *tc = &r3d_texture_cache_stats;
+	strcpy(str, "T: ");
+	itoa(tc->hits, str + 3, 10);
+	strcat(str, "/");
+	itoa(tc->hits + tc->misses, str + strlen(str), 10);
+	LCD_DisplayStringLine(LCD_LINE_9, str);
+	strcpy(str, "C: ");
+	itoa(tc->bytes_copied, str + 3, 10);
+	LCD_DisplayStringLine(LCD_LINE_10, str);
+	memset(tc, 0, sizeof(*tc));
+
 	r3dfb_swap_buffers();
 	fps++;
 }
@@ -0,0 +1,124 @@
+/**
+ * r3d -- the 8 pixel kernels of x86 host builds against the scalar ones:
+ * coverage masks for random edge functions, depth test masks for random
+ * depths, and renders of the example views with the wide loop of every
+ * instruction set against the scalar loop (built with r3d.c included, so
+ * that the static kernels can be called directly)
+ */
+
+#include "test.h"
+#include <stdlib.h>
+#include "r3d.c"
+#include "scene.h"
+
+#ifdef R3D_HOST_SIMD
+typedef struct {
+	uint16_t x, y;
+	r3d_depth_t z;
+	uint16_t color;
+} pixel_t;
+
+#define TRACE_MAX (SCENE_MESHES * SCENE_VIEWS * R3DFB_PIXEL_WIDTH * R3DFB_PIXEL_HEIGHT)
+static pixel_t *trace;
+static uint32_t trace_count, trace_mismatches;
+static int trace_record;
+
+static void trace_pixel(uint16_t x, uint16_t y, r3d_depth_t z, uint16_t color)
+{
+	pixel_t p = { x, y, z, color };
+	if (trace_count < TRACE_MAX) {
+		if (trace_record)
+			trace[trace_count] = p;
+		else
+			trace_mismatches += memcmp(&trace[trace_count], &p, sizeof(p)) != 0;
+	}
+	trace_count++;
+}
+
+static void render_views(void)
+{
+	trace_count = 0;
+	for (int mesh = 0; mesh < SCENE_MESHES; mesh++)
+		for (int view = 0; view < SCENE_VIEWS; view++)
+			scene_render(mesh, view);
+}
+#endif
+
+int main(void)
+{
+#ifdef R3D_HOST_SIMD
+	struct {
+		const char *name;
+		int supported;
+		r3d_coverage8_func coverage8;
+		r3d_depth8_func depth8;
+		int simd;
+	} kernels[] = {
+		{ "sse2", 0, r3d_coverage8_sse2, r3d_depth8_sse2, R3D_HOST_SIMD_SSE2 },
+		{ "avx2", 0, r3d_coverage8_avx2, r3d_depth8_avx2, R3D_HOST_SIMD_AVX2 },
+		{ "scalar", 1, r3d_coverage8_scalar, r3d_depth8_scalar, R3D_HOST_SIMD_SCALAR }
+	};
+	__builtin_cpu_init();
+	kernels[0].supported = __builtin_cpu_supports("sse2");
+	kernels[1].supported = __builtin_cpu_supports("avx2");
+
+	trace = malloc(TRACE_MAX * sizeof(pixel_t));
+	r3dfb_init();
+	r3dfb_trace = trace_pixel;
+	trace_record = 1;
+	r3d_rasterizer_loop = R3D_RASTERIZER_LOOP_SCALAR;
+	render_views();
+	uint32_t reference_count = trace_count;
+	trace_record = 0;
+	r3d_rasterizer_loop = R3D_RASTERIZER_LOOP_WIDE;
+
+	srand(1);
+	for (int k = 0; k < (int)(sizeof(kernels) / sizeof(kernels[0])); k++) {
+		if (!kernels[k].supported) {
+			printf("%s: not supported by this cpu\n", kernels[k].name);
+			continue;
+		}
+		int coverage_mismatches = 0, depth_mismatches = 0;
+		for (int i = 0; i < 1000000; i++) {
+			// edge functions near 0 (pixels on the edges) and large ones
+			int w[3], d[3][8];
+			for (int j = 0; j < 3; j++) {
+				int a = rand() % 1024 - 512;
+				w[j] = (i & 1) ? rand() % 65536 - 32768 : (int)((unsigned)rand() << 8) / 4;
+				for (int l = 0; l < 8; l++)
+					d[j][l] = l * a;
+			}
+			unsigned r = r3d_coverage8_scalar(w[0], w[1], w[2], d[0], d[1], d[2]);
+			coverage_mismatches += kernels[k].coverage8(w[0], w[1], w[2], d[0], d[1], d[2]) != r;
+
+			// depths around the stored ones and the near plane, steps
+			// which cross both and wrap
+			r3d_depth_t stored[8];
+			r3d_depth_step_t ed[8], dx = (r3d_depth_step_t)(rand() % 65536 - 32768) << (i & 7);
+			r3d_depth_step_t depth = (i & 8) ? (r3d_depth_step_t)R3D_DEPTH_NEAR - dx * 4 :
+			                         (r3d_depth_step_t)(rand() % (R3D_DEPTH_MAX + 1)) << R3D_DEPTH_FRACTION;
+			for (int l = 0; l < 8; l++) {
+				stored[l] = (r3d_depth_t)(((depth + dx * l) >> R3D_DEPTH_FRACTION) + rand() % 5 - 2);
+				ed[l] = dx * l;
+			}
+			r = r3d_depth8_scalar(depth, ed, stored);
+			depth_mismatches += kernels[k].depth8(depth, ed, stored) != r;
+		}
+		TEST_CHECK(coverage_mismatches == 0, "%s: %d of 1000000 coverage masks differ", kernels[k].name,
+		           coverage_mismatches);
+		TEST_CHECK(depth_mismatches == 0, "%s: %d of 1000000 depth masks differ", kernels[k].name, depth_mismatches);
+
+		trace_mismatches = 0;
+		r3d_host_simd = kernels[k].simd;
+		render_views();
+		TEST_CHECK(trace_mismatches == 0 && trace_count == reference_count,
+		           "%s: %u of %u pixels differ from the scalar loop, %u instead of %u", kernels[k].name,
+		           trace_mismatches, reference_count, trace_count, reference_count);
+		printf("%s: 1000000 coverage and depth masks, %u pixels\n", kernels[k].name, trace_count);
+	}
+	free(trace);
+#else
+	printf("built without R3D_HOST_SIMD\n");
+#endif
+	return test_failures != 0;
+}
@@ -0,0 +1,88 @@
+/**
+ * r3d -- r3d_fixed.h against the float math, and renders of the example
+ * meshes with fixed point position transforms against float renders
+ */
+
+#include "test.h"
+#include <stdlib.h>
+#include <string.h>
+#include "scene.h"
+
+#define PSNR_MIN 30.0 // dB, differences are limited to a few edge pixels
+
+static double psnr(const uint16_t *a, const uint16_t *b, int n)
+{
+	double se = 0.0;
+	for (int i = 0; i < n; i++) {
+		int d[3] = {
+			r3d_rgb565_r(a[i]) - r3d_rgb565_r(b[i]),
+			r3d_rgb565_g(a[i]) - r3d_rgb565_g(b[i]),
+			r3d_rgb565_b(a[i]) - r3d_rgb565_b(b[i])
+		};
+		se += d[0] * d[0] + d[1] * d[1] + d[2] * d[2];
+	}
+	if (se == 0.0)
+		return 99.0;
+	return 10.0 * log10(255.0 * 255.0 * 3 * n / se);
+}
+
+static float frand(float min, float max)
+{
+	return min + (max - min) * (float)rand() / (float)RAND_MAX;
+}
+
+int main(void)
+{
+	TEST_CHECK(fixed_from_int(-3) == -3 * 65536, "%d", fixed_from_int(-3));
+	TEST_CHECK(int_abs(fixed_rcp(fixed_from_int(-2)) + 32768) <= 1, "%d", fixed_rcp(fixed_from_int(-2)));
+
+	// products and transforms within a few Q16 steps of the float math
+	srand(1);
+	double max = 0.0;
+	for (int i = 0; i < 10000; i++) {
+		mat4_t m0, m1;
+		for (int j = 0; j < 16; j++) {
+			m0.m[j] = frand(-2.0f, 2.0f);
+			m1.m[j] = frand(-2.0f, 2.0f);
+		}
+		mat4x_t mx0, mx1, mx;
+		mat4x_from_mat4(&mx0, &m0);
+		mat4x_from_mat4(&mx1, &m1);
+		mat4x_mul(&mx, &mx0, &mx1);
+		mat4_t m = mat4_mul(m0, m1);
+		for (int j = 0; j < 16; j++)
+			max = fmax(max, fabs(fixed_to_float(mx.m[j]) - m.m[j]));
+	}
+	TEST_CHECK(max < 8.0 / 65536.0, "mat4x_mul: %g", max);
+
+	max = 0.0;
+	for (int i = 0; i < 100000; i++) {
+		vec3_t v = vec3(frand(-100.0f, 100.0f), frand(-100.0f, 100.0f), frand(-100.0f, 100.0f));
+		v = vec3_mul(v, ldexpf(1.0f, rand() % 20 - 20));
+		vec3x_t vx = vec3x_from_vec3(v);
+		if (vx.x == 0 && vx.y == 0 && vx.z == 0)
+			continue;
+		vec3_t n = vec3x_to_vec3(vec3x_normalize(vx)), e = vec3_normalize(vec3x_to_vec3(vx));
+		max = fmax(max, fmax(fabs(n.x - e.x), fmax(fabs(n.y - e.y), fabs(n.z - e.z))));
+	}
+	TEST_CHECK(max <= 1.5 / 65536.0, "vec3x_normalize: %g", max);
+
+	// the example meshes, float and fixed point vertex transforms
+	static uint16_t reference[R3DFB_PIXEL_WIDTH * R3DFB_PIXEL_HEIGHT];
+	double min = 99.0;
+	for (int mesh = 0; mesh < SCENE_MESHES; mesh++) {
+		for (int view = 0; view < SCENE_VIEWS; view++) {
+			scene_uniforms.fixed = 0;
+			scene_render(mesh, view);
+			memcpy(reference, r3dfb_color_buffer, sizeof(reference));
+			scene_uniforms.fixed = 1;
+			scene_render(mesh, view);
+			double p = psnr(reference, r3dfb_color_buffer, R3DFB_PIXEL_WIDTH * R3DFB_PIXEL_HEIGHT);
+			TEST_CHECK(p >= PSNR_MIN, "mesh %d view %d: %.1f dB", mesh, view, p);
+			min = fmin(min, p);
+		}
+	}
+	printf("fixed point vertex transforms: PSNR >= %.1f dB\n", min);
+
+	return test_failures != 0;
+}
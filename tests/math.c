@@ -0,0 +1,88 @@
+/**
+ * r3d -- error bounds of the fast r3d_math.h functions
+ */
+
+#include "test.h"
+#include <stdlib.h>
+#include <float.h>
+#include <r3d_math.h>
+
+#define RSQRT_BOUND 6.6e-4 // documented at float_rsqrt_fast
+
+static double rsqrt_error(float f)
+{
+	double r = 1.0 / sqrt((double)f);
+	return fabs((double)float_rsqrt_fast(f) - r) / r;
+}
+
+int main(void)
+{
+	union { float f; uint32_t i; } u;
+
+	// the relative error only depends on the mantissa and on the parity of
+	// the exponent: all mantissas of [1, 4), then the whole valid range
+	double max = 0.0;
+	for (u.f = 1.0f; u.f < 4.0f; u.i++)
+		max = fmax(max, rsqrt_error(u.f));
+	TEST_CHECK(max <= RSQRT_BOUND, "float_rsqrt_fast on [1, 4): %g", max);
+	printf("float_rsqrt_fast: max relative error %.4g on [1, 4)\n", max);
+
+	max = 0.0;
+	for (u.f = ldexpf(1.0f, -125); u.f <= ldexpf(1.0f, 125); u.i += 997)
+		max = fmax(max, rsqrt_error(u.f));
+	TEST_CHECK(max <= RSQRT_BOUND, "float_rsqrt_fast on [2^-125, 2^125]: %g", max);
+
+	// vec3_normalize_fast: length within the same bound of 1
+	srand(1);
+	max = 0.0;
+	for (int i = 0; i < 1000000; i++) {
+		float s = ldexpf(1.0f, rand() % 60 - 60); // squared lengths in range
+		vec3_t v = vec3((rand() - RAND_MAX / 2) * s, (rand() - RAND_MAX / 2) * s, (rand() - RAND_MAX / 2) * s);
+		if (v.x == 0.0f && v.y == 0.0f && v.z == 0.0f)
+			continue;
+		vec3_t n = vec3_normalize_fast(v);
+		max = fmax(max, fabs(sqrt((double)n.x * n.x + (double)n.y * n.y + (double)n.z * n.z) - 1.0));
+	}
+	TEST_CHECK(max <= RSQRT_BOUND, "vec3_normalize_fast length: %g", max);
+	printf("vec3_normalize_fast: max length error %.4g\n", max);
+
+	// mat4_transform_positions_n against mat4_transform_position (random
+	// matrices and quantized positions, all batch sizes): -ffast-math may
+	// sum the rows in another order, so within a few rounding errors of
+	// the row terms
+	int mismatches = 0, transformed = 0;
+	for (int i = 0; i < 20000; i++) {
+		mat4_t m;
+		for (int j = 0; j < 16; j++)
+			m.m[j] = (float)(rand() - RAND_MAX / 2) / (float)RAND_MAX;
+		m.m33 += 4.0f; // w away from 0
+		uint32_t n = 1 + i % 24;
+		vec3x4_t v[6], r[6];
+		for (uint32_t j = 0; j < (n + 3) / 4 * 4; j++) {
+			v[j / 4].x[j % 4] = (float)(rand() % 65536) / 65535.0f;
+			v[j / 4].y[j % 4] = (float)(rand() % 65536) / 65535.0f;
+			v[j / 4].z[j % 4] = (float)(rand() % 65536) / 65535.0f;
+		}
+		mat4_transform_positions_n(&m, v, r, n);
+		for (uint32_t j = 0; j < n; j++) {
+			float x = v[j / 4].x[j % 4], y = v[j / 4].y[j % 4], z = v[j / 4].z[j % 4];
+			vec3_t p = mat4_transform_position(&m, vec3(x, y, z));
+			const float rp[3] = { r[j / 4].x[j % 4], r[j / 4].y[j % 4], r[j / 4].z[j % 4] };
+			double w = fabs(m.m30 * x) + fabs(m.m31 * y) + fabs(m.m32 * z) + fabs(m.m33);
+			double fi = 1.0 / fabs(m.m30 * x + m.m31 * y + m.m32 * z + m.m33);
+			int off = 0;
+			for (int k = 0; k < 3; k++) {
+				const float *row = &m.m[k]; // column major: mk0, mk1, mk2, mk3 4 floats apart
+				double terms = fabs(row[0] * x) + fabs(row[4] * y) + fabs(row[8] * z) + fabs(row[12]);
+				double bound = 8.0 * FLT_EPSILON * (terms + fabs(p.v[k]) * w) * fi;
+				off |= fabs(p.v[k] - rp[k]) > bound;
+			}
+			mismatches += off;
+			transformed++;
+		}
+	}
+	TEST_CHECK(mismatches == 0, "mat4_transform_positions_n: %d of %d positions off", mismatches, transformed);
+	printf("mat4_transform_positions_n: %d positions\n", transformed);
+
+	return test_failures != 0;
+}
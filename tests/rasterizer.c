@@ -0,0 +1,344 @@
+/**
+ * r3d -- the triangle rasterizer loops against the scalar reference loop:
+ * the same r3d_set_pixel calls (position, depth and color, in the same
+ * order) for random small and large triangles. stored depth against the
+ * exact plane, face plane culling against screen space culling (also with
+ * mirrored models), batch against per vertex position shaders, and (built
+ * as tests/rasterizer24 with R3D_DEPTH_BITS 24) renders of the example
+ * views against the 16 bit ones.
+ */
+
+#include "test.h"
+#include <stdlib.h>
+#include <math.h>
+#include "scene.h"
+
+#define SMALL 5000 // at most 40 pixels wide: 16 bit edge functions
+#define LARGE 200 // up to beyond the viewport: 32 bit edge functions
+
+typedef struct {
+	float x, y, z;
+	float r, g, b;
+} vertex_t;
+
+typedef struct {
+	uint16_t x, y;
+	r3d_depth_t z;
+	uint16_t color;
+} pixel_t;
+
+static vertex_t vertices[3 * (SMALL + LARGE)];
+static pixel_t *reference;
+static uint32_t reference_count, reference_size, trace_count, trace_mismatches;
+
+static void record(uint16_t x, uint16_t y, r3d_depth_t z, uint16_t color)
+{
+	pixel_t p = { x, y, z, color };
+	if (reference_count == reference_size) {
+		reference_size = reference_size ? 2 * reference_size : 65536;
+		reference = realloc(reference, reference_size * sizeof(pixel_t));
+	}
+	reference[reference_count++] = p;
+}
+
+static void compare(uint16_t x, uint16_t y, r3d_depth_t z, uint16_t color)
+{
+	const pixel_t *p = trace_count < reference_count ? &reference[trace_count] : 0;
+	if (!p || p->x != x || p->y != y || p->z != z || p->color != color) {
+		if (!trace_mismatches++)
+			printf("first mismatch at call %u: %d %d %d %04x\n", trace_count, x, y, z, color);
+	}
+	trace_count++;
+}
+
+static void count(uint16_t x, uint16_t y, r3d_depth_t z, uint16_t color)
+{
+	trace_count++;
+}
+
+static void position(const void *uniforms, const void *const *in, float *out)
+{
+	const vertex_t *v = in[0];
+	out[0] = v->x;
+	out[1] = v->y;
+	out[2] = v->z;
+}
+
+static void attributes(const void *uniforms, const void *const *in, float *out)
+{
+	const vertex_t *v = in[0];
+	out[3] = v->r;
+	out[4] = v->g;
+	out[5] = v->b;
+}
+
+static uint16_t fragment(const void *uniforms, const float *in)
+{
+	return r3d_rgb565((int)in[3], (int)in[4], (int)in[5]);
+}
+
+static float frand(float min, float max)
+{
+	return min + (max - min) * (float)rand() / (float)RAND_MAX;
+}
+
+static void random_triangle(vertex_t *v, float size)
+{
+	float cx = frand(-1.1f, 1.1f), cy = frand(-1.1f, 1.1f);
+	for (int i = 0; i < 3; i++) {
+		v[i].x = cx + frand(-size, size);
+		v[i].y = cy + frand(-size, size);
+		v[i].z = frand(-1.0f, 1.0f);
+		v[i].r = frand(0.0f, 255.0f);
+		v[i].g = frand(0.0f, 255.0f);
+		v[i].b = frand(0.0f, 255.0f);
+	}
+}
+
+// the plane through the snapped vertices of the triangle being drawn
+static double plane_x[3], plane_y[3], plane_depth[3];
+static double plane_error_max;
+static uint32_t plane_errors;
+
+static void plane_setup(const vertex_t *v)
+{
+	for (int i = 0; i < 3; i++) {
+		plane_x[i] = (int)((v[i].x + 1.0f) * (R3DFB_PIXEL_WIDTH * 0.5f));
+		plane_y[i] = (int)((v[i].y - 1.0f) * -(R3DFB_PIXEL_HEIGHT * 0.5f));
+		plane_depth[i] = (1.0 - v[i].z) * 0.5 * R3D_DEPTH_MAX;
+	}
+}
+
+static void plane_compare(uint16_t x, uint16_t y, r3d_depth_t z, uint16_t color)
+{
+	double ax = plane_x[1] - plane_x[0], ay = plane_y[1] - plane_y[0];
+	double bx = plane_x[2] - plane_x[0], by = plane_y[2] - plane_y[0];
+	double ad = plane_depth[1] - plane_depth[0], bd = plane_depth[2] - plane_depth[0];
+	double det = ax * by - ay * bx;
+	double gx = (ad * by - bd * ay) / det, gy = (bd * ax - ad * bx) / det; // per pixel
+	double exact = plane_depth[0] + gx * (x - plane_x[0]) + gy * (y - plane_y[0]);
+	// truncation, float vertex depths and setup: a few LSB, or a small
+	// fraction of a pixel along steep planes
+	double error = fabs(z - exact);
+	if (error > 4.0 + (fabs(gx) + fabs(gy)) / 64.0 && !plane_errors++)
+		printf("pixel %d %d: depth %u, exact %.1f\n", x, y, (unsigned)z, exact);
+	plane_error_max = error > plane_error_max ? error : plane_error_max;
+}
+
+static void draw(r3d_rasterizer_loop_t loop, r3d_shading_t shading)
+{
+	r3d_drawcall_t drawcall = {
+		R3D_PRIMITIVE_TYPE_TRIANGLES, { { vertices, sizeof(vertex_t) } },
+		3 * (SMALL + LARGE), 0, 0, shading
+	};
+	r3d_rasterizer_loop = loop;
+	r3dfb_clear();
+	r3d_draw(&drawcall);
+}
+
+// example views with and without drawcall faces: the face planes only
+// drop triangles which screen space culling drops as well, so the traces
+// must be the same. with r3d_eye_mirrored flipped the mirrored views must
+// lose their front faces (the test would not notice a wrong flip otherwise)
+static void culling_compare(void)
+{
+	uint32_t mirrored_mismatches = 0;
+	r3d_rasterizer_loop = R3D_RASTERIZER_LOOP_AUTO;
+	for (int mirrored = 0; mirrored < 2; mirrored++) {
+		scene_mirrored = mirrored;
+		for (int mesh = 0; mesh < SCENE_MESHES; mesh++) {
+			for (int view = 0; view < SCENE_VIEWS; view++) {
+				r3d_drawcall_t drawcall = scene_meshes[mesh];
+				scene_setup(mesh, view);
+				TEST_CHECK((r3d_eye_mirrored != 0) == mirrored, "mesh %d view %d: r3d_eye_mirrored %d",
+				           mesh, view, r3d_eye_mirrored);
+
+				reference_count = 0;
+				r3dfb_trace = record;
+				drawcall.faces = 0;
+				r3dfb_clear();
+				r3d_draw(&drawcall);
+
+				trace_count = trace_mismatches = 0;
+				r3dfb_trace = compare;
+				drawcall.faces = scene_meshes[mesh].faces;
+				r3dfb_clear();
+				r3d_draw(&drawcall);
+				TEST_CHECK(trace_mismatches == 0 && trace_count == reference_count,
+				           "mesh %d view %d mirrored %d: %u of %u pixels differ, %u instead of %u",
+				           mesh, view, mirrored, trace_mismatches, reference_count, trace_count, reference_count);
+
+				trace_count = 0;
+				r3dfb_trace = count;
+				r3d_eye_mirrored = !r3d_eye_mirrored;
+				r3dfb_clear();
+				r3d_draw(&drawcall);
+				mirrored_mismatches += trace_count * 2 < reference_count;
+			}
+		}
+	}
+	r3dfb_trace = 0;
+	scene_mirrored = 0;
+	TEST_CHECK(mirrored_mismatches == 2 * SCENE_MESHES * SCENE_VIEWS,
+	           "flipped r3d_eye_mirrored: %u of %d views lost most pixels", mirrored_mismatches,
+	           2 * SCENE_MESHES * SCENE_VIEWS);
+	printf("face culling: same pixels as screen space culling, also mirrored\n");
+}
+
+// scene_positions_n for one vertex: the reference of batch_compare, as
+// mat4_transform_position may round differently with -ffast-math
+// (tests/math checks the transforms against each other)
+static void batch_position(const scene_uniforms_t *u, const void *const *in, float *out)
+{
+	const void *in_n[1][R3D_VERTEX_STREAMS_MAX] = { { in[0], in[1], in[2] } };
+	vec3x4_t p;
+	scene_positions_n(u, (const void *const (*)[R3D_VERTEX_STREAMS_MAX])in_n, &p, 1);
+	out[0] = p.x[0];
+	out[1] = p.y[0];
+	out[2] = p.z[0];
+}
+
+// example views with the batch position shader of the scene against one
+// vertex at a time, with and without drawcall faces: batching must not
+// change which triangles are drawn or in which order
+static void batch_compare(void)
+{
+	r3d_shader_t shader = scene_shader;
+	shader.positionshader = (r3d_vertexshader_func)batch_position;
+	shader.positionshader_n = 0;
+	r3d_rasterizer_loop = R3D_RASTERIZER_LOOP_AUTO;
+	for (int mesh = 0; mesh < SCENE_MESHES; mesh++) {
+		for (int view = 0; view < SCENE_VIEWS; view++) {
+			for (int faces = 0; faces < 2; faces++) {
+				r3d_drawcall_t drawcall = scene_meshes[mesh];
+				drawcall.faces = faces ? drawcall.faces : 0;
+				scene_setup(mesh, view);
+
+				reference_count = 0;
+				r3dfb_trace = record;
+				r3d_shader = shader;
+				r3dfb_clear();
+				r3d_draw(&drawcall);
+
+				trace_count = trace_mismatches = 0;
+				r3dfb_trace = compare;
+				r3d_shader = scene_shader;
+				r3dfb_clear();
+				r3d_draw(&drawcall);
+				TEST_CHECK(trace_mismatches == 0 && trace_count == reference_count,
+				           "mesh %d view %d faces %d: %u of %u pixels differ, %u instead of %u",
+				           mesh, view, faces, trace_mismatches, reference_count, trace_count, reference_count);
+			}
+		}
+	}
+	r3dfb_trace = 0;
+	printf("batch position shader: same pixels as the per vertex one\n");
+}
+
+// example views with R3D_DEPTH_BITS 16 (written to SCENE_FILE) against
+// other depth formats: the same depth at 16 bits (+-1), the same colors
+// except where 16 bits cannot resolve two surfaces
+#define SCENE_FILE "tests/rasterizer_scene16.bin"
+#define SCENE_PIXELS (R3DFB_PIXEL_WIDTH * R3DFB_PIXEL_HEIGHT)
+
+static void scene_compare(void)
+{
+	static uint16_t scene[SCENE_MESHES * SCENE_VIEWS][2][SCENE_PIXELS]; // color, 16 bit depth
+	for (int mesh = 0; mesh < SCENE_MESHES; mesh++) {
+		for (int view = 0; view < SCENE_VIEWS; view++) {
+			uint16_t (*s)[SCENE_PIXELS] = scene[mesh * SCENE_VIEWS + view];
+			scene_render(mesh, view);
+			for (int i = 0; i < SCENE_PIXELS; i++) {
+				s[0][i] = r3dfb_color_buffer[i];
+				s[1][i] = (uint16_t)(r3dfb_depth_buffer[i] >> (R3D_DEPTH_BITS - 16));
+			}
+		}
+	}
+#if R3D_DEPTH_BITS == 16
+	FILE *f = fopen(SCENE_FILE, "wb");
+	TEST_CHECK(f && fwrite(scene, sizeof(scene), 1, f) == 1, "cannot write %s", SCENE_FILE);
+#else
+	static uint16_t scene16[SCENE_MESHES * SCENE_VIEWS][2][SCENE_PIXELS];
+	FILE *f = fopen(SCENE_FILE, "rb");
+	TEST_CHECK(f && fread(scene16, sizeof(scene16), 1, f) == 1, "cannot read %s (run tests/rasterizer first)", SCENE_FILE);
+	for (int i = 0; f && i < SCENE_MESHES * SCENE_VIEWS; i++) {
+		int colors = 0, depths = 0, covered = 0;
+		for (int j = 0; j < SCENE_PIXELS; j++) {
+			colors += scene[i][0][j] != scene16[i][0][j];
+			depths += abs(scene[i][1][j] - scene16[i][1][j]) > 1;
+			covered += scene16[i][1][j] != 0;
+		}
+		TEST_CHECK(depths == 0 && colors * 50 <= covered, "view %d: %d depths, %d of %d colors differ",
+		           i, depths, colors, covered);
+	}
+	printf("example views: within 1 LSB of the 16 bit depth\n");
+#endif
+	if (f)
+		fclose(f);
+}
+
+int main(void)
+{
+	static const r3d_shader_t shader = {
+		0, 0, 6, position, attributes, R3D_VARYINGS(3, 3), 0, 0, 0, fragment, 0
+	};
+	static const struct {
+		const char *name;
+		r3d_rasterizer_loop_t loop;
+	} loops[] = {
+		{ "pairs", R3D_RASTERIZER_LOOP_PAIRS },
+		{ "wide", R3D_RASTERIZER_LOOP_WIDE },
+		{ "auto", R3D_RASTERIZER_LOOP_AUTO }
+	};
+
+	srand(1);
+	for (int i = 0; i < SMALL; i++)
+		random_triangle(&vertices[3 * i], 20.0f / 120.0f);
+	for (int i = SMALL; i < SMALL + LARGE; i++)
+		random_triangle(&vertices[3 * i], 1.5f);
+
+	r3d_shader = shader;
+	r3d_viewport(0, 0, R3DFB_PIXEL_WIDTH, R3DFB_PIXEL_HEIGHT);
+	r3d_backface_culling = R3D_DISABLE; // both orientations
+	for (r3d_shading_t shading = R3D_SHADING_FRAGMENT; shading <= R3D_SHADING_FLAT; shading++) {
+		reference_count = 0;
+		r3dfb_trace = record;
+		draw(R3D_RASTERIZER_LOOP_SCALAR, shading);
+		for (int i = 0; i < (int)(sizeof(loops) / sizeof(loops[0])); i++) {
+			trace_count = trace_mismatches = 0;
+			r3dfb_trace = compare;
+			draw(loops[i].loop, shading);
+			TEST_CHECK(trace_mismatches == 0 && trace_count == reference_count,
+			           "%s, shading %d: %u of %u pixels differ, %u instead of %u",
+			           loops[i].name, shading, trace_mismatches, reference_count, trace_count, reference_count);
+		}
+		printf("shading %d: %u pixels\n", shading, reference_count);
+	}
+	r3dfb_trace = 0;
+
+	// one triangle per draw call, traced against its plane, as is and
+	// almost parallel to the screen (small steps over many pixels)
+	r3dfb_trace = plane_compare;
+	for (int i = 0; i < 2 * (SMALL + LARGE); i++) {
+		vertex_t v[3];
+		for (int j = 0; j < 3; j++) {
+			v[j] = vertices[3 * (i >> 1) + j];
+			if (i & 1)
+				v[j].z = vertices[3 * (i >> 1)].z + (v[j].z - vertices[3 * (i >> 1)].z) * 0.001f;
+		}
+		r3d_drawcall_t drawcall = { R3D_PRIMITIVE_TYPE_TRIANGLES, { { v, sizeof(vertex_t) } }, 3 };
+		plane_setup(v);
+		r3dfb_clear();
+		r3d_draw(&drawcall);
+	}
+	r3dfb_trace = 0;
+	TEST_CHECK(plane_errors == 0, "%u pixels off their plane", plane_errors);
+	printf("depth %d bits: max error %.2f LSB\n", R3D_DEPTH_BITS, plane_error_max);
+
+	culling_compare();
+	batch_compare();
+	free(reference);
+	scene_compare();
+
+	return test_failures != 0;
+}
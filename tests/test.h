@@ -0,0 +1,24 @@
+/**
+ * r3d -- host tests (make test)
+ * author: Andreas Mantler (ands)
+ */
+
+#ifndef TEST_H
+#define TEST_H
+
+#include <stdio.h>
+#include <stdint.h>
+
+static int test_failures;
+
+// reports a failed condition and keeps going, main returns test_failures
+#define TEST_CHECK(cond, ...) do { \
+	if (!(cond)) { \
+		printf("%s:%d: check failed: %s: ", __FILE__, __LINE__, #cond); \
+		printf(__VA_ARGS__); \
+		printf("\n"); \
+		test_failures++; \
+	} \
+} while (0)
+
+#endif
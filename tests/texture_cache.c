@@ -0,0 +1,145 @@
+/**
+ * r3d -- the texture residency cache under pressure: random draw calls bind
+ * more textures than fit into the pool (one before r3d_draw, the others in
+ * the prologue). after the last bind of a draw call every level and palette
+ * of every texture bound for it must still hold its source contents, i.e.
+ * no bind may evict or overwrite a copy which is still in use.
+ */
+
+#include "test.h"
+#include <stdlib.h>
+#include <string.h>
+#include <r3d.h>
+
+#define TEXTURES 8
+#define DRAWS 2000
+#define BINDS_MAX 3
+#define POOL_SIZE 4096 // about two textures
+
+typedef struct {
+	r3d_mipmap_t *mipmap;
+	r3d_mipmap_sampler_t source; // levels and palette in the mipmap
+	r3d_mipmap_sampler_t bound;
+} texture_t;
+
+static texture_t textures[TEXTURES];
+static uint32_t pool[POOL_SIZE / sizeof(uint32_t)];
+static int binds[BINDS_MAX], bind_count;
+static uint32_t resident, checked;
+
+static uint32_t level_size(const r3d_sampler_t *l)
+{
+	uint32_t texels = (l->umask + 1) * (l->vmask + 1);
+	switch (l->format) {
+	case R3D_TEXTURE_P8: return texels;
+	case R3D_TEXTURE_P4: return (texels + 1) / 2;
+	default: return texels * sizeof(uint16_t);
+	}
+}
+
+static r3d_mipmap_t *mipmap_random(r3d_texture_format_t format, uint16_t width, uint16_t height)
+{
+	uint32_t size = format == R3D_TEXTURE_P8 ? 256 * sizeof(uint16_t) :
+	                format == R3D_TEXTURE_P4 ? 16 * sizeof(uint16_t) : 0;
+	uint16_t levels = 1, w = width, h = height;
+	for (;;) {
+		size += format == R3D_TEXTURE_P8 ? w * h : format == R3D_TEXTURE_P4 ? (w * h + 1) / 2 : 2 * w * h;
+		if (w == 1 && h == 1)
+			break;
+		w = w > 1 ? w >> 1 : 1;
+		h = h > 1 ? h >> 1 : 1;
+		levels++;
+	}
+	r3d_mipmap_t *m = malloc(sizeof(r3d_mipmap_t) + size);
+	m->width = width;
+	m->height = height;
+	m->levels = levels;
+	m->format = format;
+	for (uint32_t i = 0; i < size; i++)
+		((uint8_t *)m->data)[i] = (uint8_t)rand();
+	return m;
+}
+
+static int in_pool(const void *p)
+{
+	return (const uint8_t *)p >= (const uint8_t *)pool && (const uint8_t *)p < (const uint8_t *)pool + POOL_SIZE;
+}
+
+static void check(const texture_t *t)
+{
+	const r3d_sampler_t *src = t->source.level, *b = t->bound.level;
+	if (src[0].palette) {
+		uint32_t size = (src[0].format == R3D_TEXTURE_P8 ? 256 : 16) * sizeof(uint16_t);
+		TEST_CHECK(memcmp(b[0].palette, src[0].palette, size) == 0, "texture %d: palette overwritten",
+		           (int)(t - textures));
+		resident += in_pool(b[0].palette);
+		checked++;
+	}
+	for (int i = 0; i < t->source.levels; i++) {
+		TEST_CHECK(b[i].palette == b[0].palette, "texture %d level %d: palette not shared", (int)(t - textures), i);
+		TEST_CHECK(memcmp(b[i].data, src[i].data, level_size(&src[i])) == 0, "texture %d level %d: overwritten",
+		           (int)(t - textures), i);
+		resident += in_pool(b[i].data);
+		checked++;
+	}
+}
+
+static void bind(int i)
+{
+	textures[i].bound = textures[i].source;
+	r3d_texture_cache_bind(&textures[i].bound);
+}
+
+static void prologue(void *uniforms)
+{
+	for (int i = 1; i < bind_count; i++)
+		bind(binds[i]);
+	for (int i = 0; i < bind_count; i++)
+		check(&textures[binds[i]]);
+}
+
+int main(void)
+{
+	static const r3d_drawcall_t drawcall = { R3D_PRIMITIVE_TYPE_TRIANGLES };
+	static const struct {
+		r3d_texture_format_t format;
+		uint16_t width, height;
+	} formats[TEXTURES] = { // 682 to 2730 bytes with all levels
+		{ R3D_TEXTURE_P8, 32, 32 }, { R3D_TEXTURE_P4, 64, 32 }, { R3D_TEXTURE_RGB565, 32, 32 },
+		{ R3D_TEXTURE_P8, 16, 64 }, { R3D_TEXTURE_RGB565_TILED, 32, 16 }, { R3D_TEXTURE_P4, 32, 64 },
+		{ R3D_TEXTURE_RGB565, 16, 16 }, { R3D_TEXTURE_P8, 32, 16 }
+	};
+
+	srand(1);
+	for (int i = 0; i < TEXTURES; i++) {
+		textures[i].mipmap = mipmap_random(formats[i].format, formats[i].width, formats[i].height);
+		r3d_mipmap_sampler(&textures[i].source, textures[i].mipmap);
+	}
+	r3d_texture_cache_init(pool, POOL_SIZE);
+	r3d_shader.prologue = prologue;
+
+	for (int d = 0; d < DRAWS; d++) {
+		bind_count = 1 + rand() % BINDS_MAX;
+		for (int i = 0; i < bind_count; i++) {
+			int j;
+			do { // distinct textures
+				binds[i] = rand() % TEXTURES;
+				for (j = 0; j < i && binds[j] != binds[i]; j++)
+					;
+			} while (j < i);
+		}
+		bind(binds[0]);
+		r3d_draw(&drawcall);
+	}
+
+	r3d_texture_cache_stats_t *stats = &r3d_texture_cache_stats;
+	TEST_CHECK(stats->hits > 0 && stats->misses > checked / 4, "%u hits, %u misses: no pressure",
+	           stats->hits, stats->misses);
+	TEST_CHECK(resident > checked / 4, "only %u of %u levels and palettes resident", resident, checked);
+	printf("%u levels and palettes checked, %u resident, %u hits, %u misses\n",
+	       checked, resident, stats->hits, stats->misses);
+
+	for (int i = 0; i < TEXTURES; i++)
+		free(textures[i].mipmap);
+	return test_failures != 0;
+}
@@ -0,0 +1,352 @@
+/**
+ * meshconv -- offline processing of r3d example meshes
+ *
+ * reads a mesh header (interleaved vertex_t or split position and
+ * attribute streams, see main.c) and writes streams derived from it
+ * as a new header to stdout.
+ *
+ * usage:
+ *   meshconv faces mesh.h > mesh_faces.h
+ *     per-triangle face planes for object space back face culling
+ *     (r3d_face_t, see r3d.h)
+ *   meshconv split mesh.h > mesh_split.h
+ *     separate position and normal/uv streams, so that position-only
+ *     passes read a densely packed array
+ *   meshconv bake mesh.h > mesh_baked.h
+ *     static lighting per vertex (ambient occlusion * (ambient + diffuse)
+ *     for a light fixed in object space) as a separate stream
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+
+// decoded vertex
+typedef struct {
+	unsigned x, y, z;
+	unsigned nx, ny, nz;
+	unsigned u, v;
+} vertex_t;
+
+typedef struct {
+	char index[16]; // suffix of the vertex array names, e.g. "2" for positions2
+	vertex_t *vertices;
+	int count;
+} mesh_t;
+
+static char *read_file(const char *filename)
+{
+	FILE *f = fopen(filename, "rb");
+	if (!f) {
+		perror(filename);
+		exit(1);
+	}
+	fseek(f, 0, SEEK_END);
+	long size = ftell(f);
+	fseek(f, 0, SEEK_SET);
+	char *data = malloc(size + 1);
+	if (fread(data, 1, size, f) != (size_t)size) {
+		perror(filename);
+		exit(1);
+	}
+	data[size] = '\0';
+	fclose(f);
+	return data;
+}
+
+// parses the tuples of "const T <name><index>[] = { { a, b, ... }, ... };"
+// returns the number of tuples or -1 if there is no such array
+static int parse_array(const char *data, const char *name, int fields, unsigned **values, char *index)
+{
+	const char *p = data;
+	size_t len = strlen(name);
+	do { // find declaration
+		p = strstr(p, name);
+		if (!p)
+			return -1;
+		p += len;
+	} while (!isdigit((unsigned char)*p) || (p - len > data && isalnum((unsigned char)p[-(long)len - 1])));
+
+	int n = 0;
+	while (isalnum((unsigned char)p[n]) && n < 15) {
+		index[n] = p[n];
+		n++;
+	}
+	index[n] = '\0';
+
+	int count = 0, capacity = 1024;
+	*values = malloc(capacity * fields * sizeof(unsigned));
+	p = strchr(p, '{');
+	while (p && *p) {
+		if (p[0] == '/' && p[1] == '/') { // comment
+			p = strchr(p, '\n');
+			continue;
+		}
+		if (*p == '}' && p[1] == ';')
+			break;
+		if (*p == '{' && isdigit((unsigned char)p[strspn(p + 1, " \t") + 1])) {
+			char *end = 0;
+			p += 1 + strspn(p + 1, " \t");
+			for (int i = 0; i < fields; i++) {
+				(*values)[count * fields + i] = strtoul(p, &end, 10);
+				if (end == p)
+					break;
+				p = end + strspn(end, " \t,");
+			}
+			if (end == p || *p != '}') {
+				fprintf(stderr, "malformed %s%s entry %d\n", name, index, count);
+				exit(1);
+			}
+			if (++count == capacity) {
+				capacity *= 2;
+				*values = realloc(*values, capacity * fields * sizeof(unsigned));
+			}
+		}
+		p++;
+	}
+	return count;
+}
+
+// reads interleaved (verticesN) or split (positionsN + attributesN) meshes
+static void load_mesh(const char *filename, mesh_t *mesh)
+{
+	char *data = read_file(filename);
+	unsigned *values, *attributes;
+	int count = parse_array(data, "vertices", 8, &values, mesh->index);
+	if (count >= 0) {
+		mesh->vertices = malloc(count * sizeof(vertex_t));
+		for (int i = 0; i < count; i++) {
+			vertex_t *v = &mesh->vertices[i];
+			const unsigned *f = &values[i * 8];
+			v->x = f[0], v->y = f[1], v->z = f[2];
+			v->nx = f[3], v->ny = f[4], v->nz = f[5];
+			v->u = f[6], v->v = f[7];
+		}
+	} else {
+		count = parse_array(data, "positions", 3, &values, mesh->index);
+		if (count < 0 || parse_array(data, "attributes", 5, &attributes, mesh->index) != count) {
+			fprintf(stderr, "%s: no vertex arrays found\n", filename);
+			exit(1);
+		}
+		mesh->vertices = malloc(count * sizeof(vertex_t));
+		for (int i = 0; i < count; i++) {
+			vertex_t *v = &mesh->vertices[i];
+			const unsigned *f = &values[i * 3], *a = &attributes[i * 5];
+			v->x = f[0], v->y = f[1], v->z = f[2];
+			v->nx = a[0], v->ny = a[1], v->nz = a[2];
+			v->u = a[3], v->v = a[4];
+		}
+		free(attributes);
+	}
+	mesh->count = count;
+	free(values);
+	free(data);
+	if (mesh->count % 3) {
+		fprintf(stderr, "%s: not a triangle list\n", filename);
+		exit(1);
+	}
+}
+
+// same decoding as the example vertex shader
+static void vertex_position(const vertex_t *v, double p[3])
+{
+	p[0] = v->x / 65535.0 - 0.5;
+	p[1] = v->y / 65535.0 - 0.5;
+	p[2] = v->z / 65535.0 - 0.5;
+}
+
+static int quantize_snorm8(double f)
+{
+	int i = (int)floor(f * 127.0 + 0.5);
+	return i < -127 ? -127 : (i > 127 ? 127 : i);
+}
+
+static void write_faces(const mesh_t *mesh)
+{
+	printf("const r3d_face_t faces%s[] =\n", mesh->index);
+	printf("{ // plane normal[xyz], distance (scaled by 127)\n");
+	for (int i = 0; i < mesh->count; i += 3) {
+		double p0[3], p1[3], p2[3], e1[3], e2[3], n[3];
+		vertex_position(&mesh->vertices[i + 0], p0);
+		vertex_position(&mesh->vertices[i + 1], p1);
+		vertex_position(&mesh->vertices[i + 2], p2);
+		for (int j = 0; j < 3; j++) {
+			e1[j] = p1[j] - p0[j];
+			e2[j] = p2[j] - p0[j];
+		}
+		// ccw front face normal
+		n[0] = e1[1] * e2[2] - e1[2] * e2[1];
+		n[1] = e1[2] * e2[0] - e1[0] * e2[2];
+		n[2] = e1[0] * e2[1] - e1[1] * e2[0];
+		double l = sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+		if (l == 0.0) { // degenerated: never culled
+			printf("\t{ 0, 0, 0, 0 },\n");
+			continue;
+		}
+		for (int j = 0; j < 3; j++)
+			n[j] /= l;
+		double d = n[0] * p0[0] + n[1] * p0[1] + n[2] * p0[2];
+		printf("\t{ %d, %d, %d, %d },\n",
+		       quantize_snorm8(n[0]), quantize_snorm8(n[1]),
+		       quantize_snorm8(n[2]), quantize_snorm8(d));
+	}
+	printf("};\n");
+}
+
+static void write_split(const mesh_t *mesh)
+{
+	printf("const vertex_position_t positions%s[] =\n", mesh->index);
+	printf("{ // position[xyz]\n");
+	for (int i = 0; i < mesh->count; i++) {
+		const vertex_t *v = &mesh->vertices[i];
+		printf("\t{ %u, %u, %u },\n", v->x, v->y, v->z);
+	}
+	printf("};\n\n");
+	printf("const vertex_attributes_t attributes%s[] =\n", mesh->index);
+	printf("{ // normal[xyz], uv[xy]\n");
+	for (int i = 0; i < mesh->count; i++) {
+		const vertex_t *v = &mesh->vertices[i];
+		printf("\t{ %u, %u, %u,  %u, %u },\n", v->nx, v->ny, v->nz, v->u, v->v);
+	}
+	printf("};\n\n");
+	printf("const uint16_t *indices%s = (uint16_t*)0;\n", mesh->index);
+}
+
+// light of the baked stream: direction in object space, intensities
+static const double bake_light[3] = { -0.577350269, 0.577350269, 0.577350269 };
+static const double bake_ambient = 0.2, bake_diffuse = 0.6;
+#define BAKE_RAYS 64
+#define BAKE_DISTANCE 0.25 // occluders further away do not darken
+
+static void vertex_normal(const vertex_t *v, double n[3])
+{
+	n[0] = v->nx * 2.0 / 255.0 - 1.0;
+	n[1] = v->ny * 2.0 / 255.0 - 1.0;
+	n[2] = v->nz * 2.0 / 255.0 - 1.0;
+	double l = sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+	for (int i = 0; i < 3; i++)
+		n[i] = l > 0.0 ? n[i] / l : 0.0;
+}
+
+// moeller-trumbore, hit closer than t_max
+static int ray_triangle(const double o[3], const double d[3], const double *p0,
+                        const double *p1, const double *p2, double t_max)
+{
+	double e1[3], e2[3], h[3], s[3], q[3];
+	for (int i = 0; i < 3; i++) {
+		e1[i] = p1[i] - p0[i];
+		e2[i] = p2[i] - p0[i];
+		s[i] = o[i] - p0[i];
+	}
+	h[0] = d[1] * e2[2] - d[2] * e2[1];
+	h[1] = d[2] * e2[0] - d[0] * e2[2];
+	h[2] = d[0] * e2[1] - d[1] * e2[0];
+	double a = e1[0] * h[0] + e1[1] * h[1] + e1[2] * h[2];
+	if (fabs(a) < 1e-12)
+		return 0;
+	double f = 1.0 / a;
+	double u = f * (s[0] * h[0] + s[1] * h[1] + s[2] * h[2]);
+	if (u < 0.0 || u > 1.0)
+		return 0;
+	q[0] = s[1] * e1[2] - s[2] * e1[1];
+	q[1] = s[2] * e1[0] - s[0] * e1[2];
+	q[2] = s[0] * e1[1] - s[1] * e1[0];
+	double v = f * (d[0] * q[0] + d[1] * q[1] + d[2] * q[2]);
+	if (v < 0.0 || u + v > 1.0)
+		return 0;
+	double t = f * (e2[0] * q[0] + e2[1] * q[1] + e2[2] * q[2]);
+	return t > 0.0 && t < t_max;
+}
+
+// fraction of cosine weighted hemisphere rays around n which are not occluded
+static double ambient_occlusion(const double *positions, int count, const double p[3], const double n[3])
+{
+	double t[3], b[3], o[3];
+	if (fabs(n[0]) < 0.9) // tangent frame
+		t[0] = 0.0, t[1] = -n[2], t[2] = n[1];
+	else
+		t[0] = n[2], t[1] = 0.0, t[2] = -n[0];
+	double l = sqrt(t[0] * t[0] + t[1] * t[1] + t[2] * t[2]);
+	for (int i = 0; i < 3; i++) {
+		t[i] /= l;
+		o[i] = p[i] + n[i] * 1e-4;
+	}
+	b[0] = n[1] * t[2] - n[2] * t[1];
+	b[1] = n[2] * t[0] - n[0] * t[2];
+	b[2] = n[0] * t[1] - n[1] * t[0];
+
+	int visible = 0;
+	for (int r = 0; r < BAKE_RAYS; r++) {
+		// fibonacci spiral on the unit disk, projected onto the hemisphere
+		double radius = sqrt((r + 0.5) / BAKE_RAYS), phi = r * 2.399963229728653;
+		double x = radius * cos(phi), y = radius * sin(phi), z = sqrt(1.0 - radius * radius);
+		double d[3];
+		for (int i = 0; i < 3; i++)
+			d[i] = t[i] * x + b[i] * y + n[i] * z;
+		int hit = 0;
+		for (int i = 0; i < count && !hit; i += 3)
+			hit = ray_triangle(o, d, &positions[i * 3], &positions[i * 3 + 3], &positions[i * 3 + 6], BAKE_DISTANCE);
+		visible += !hit;
+	}
+	return (double)visible / BAKE_RAYS;
+}
+
+static void write_baked(const mesh_t *mesh)
+{
+	double *positions = malloc(mesh->count * 3 * sizeof(double));
+	for (int i = 0; i < mesh->count; i++)
+		vertex_position(&mesh->vertices[i], &positions[i * 3]);
+	unsigned char *baked = malloc(mesh->count);
+
+	for (int i = 0; i < mesh->count; i++) {
+		const vertex_t *v = &mesh->vertices[i];
+		int j = 0; // triangle lists repeat vertices: bake each one only once
+		while (j < i && (mesh->vertices[j].x != v->x || mesh->vertices[j].y != v->y || mesh->vertices[j].z != v->z ||
+		                 mesh->vertices[j].nx != v->nx || mesh->vertices[j].ny != v->ny || mesh->vertices[j].nz != v->nz))
+			j++;
+		if (j < i) {
+			baked[i] = baked[j];
+			continue;
+		}
+		double n[3];
+		vertex_normal(v, n);
+		double ndotl = n[0] * bake_light[0] + n[1] * bake_light[1] + n[2] * bake_light[2];
+		double light = ambient_occlusion(positions, mesh->count, &positions[i * 3], n) *
+		               (bake_ambient + bake_diffuse * (ndotl > 0.0 ? ndotl : 0.0));
+		baked[i] = (unsigned char)floor((light > 1.0 ? 1.0 : light) * 255.0 + 0.5);
+	}
+
+	printf("const vertex_baked_t baked%s[] =\n", mesh->index);
+	printf("{ // ambient occlusion * (ambient + diffuse)\n");
+	for (int i = 0; i < mesh->count; i++)
+		printf("\t{ %u },\n", baked[i]);
+	printf("};\n");
+	free(baked);
+	free(positions);
+}
+
+static void usage(void)
+{
+	fprintf(stderr, "usage: meshconv faces|split|bake mesh.h > out.h\n");
+	exit(1);
+}
+
+int main(int argc, char **argv)
+{
+	mesh_t mesh;
+	if (argc != 3)
+		usage();
+	load_mesh(argv[2], &mesh);
+	if (!strcmp(argv[1], "faces"))
+		write_faces(&mesh);
+	else if (!strcmp(argv[1], "split"))
+		write_split(&mesh);
+	else if (!strcmp(argv[1], "bake"))
+		write_baked(&mesh);
+	else
+		usage();
+	free(mesh.vertices);
+	return 0;
+}
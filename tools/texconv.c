@@ -0,0 +1,451 @@
+/**
+ * texconv -- offline processing of r3d example textures
+ *
+ * reads a RGB565 texture header (C source export of GIMP, see
+ * examples/textures) and writes a texture derived from it as a new
+ * header to stdout.
+ *
+ * usage:
+ *   texconv mips texture.h > texture_mips.h
+ *     full mip chain down to 1x1 (r3d_mipmap_t, see r3d.h)
+ *   texconv tiled texture.h > texture_mips.h
+ *     same as mips, but with texels stored in 4x4 tiles
+ *     (R3D_TEXTURE_RGB565_TILED)
+ *   texconv p8|p4 texture.h > texture_mips.h
+ *     mip chain with 8/4 bit indices into a shared 256/16 color palette
+ *   texconv bc1 texture.h > texture_mips.h
+ *     mip chain down to 4x4 in 4 bit per texel blocks (R3D_TEXTURE_BC1)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+typedef struct {
+	char name[64];
+	unsigned width, height;
+	unsigned short *data;
+} texture_t;
+
+static char *read_file(const char *filename)
+{
+	FILE *f = fopen(filename, "rb");
+	if (!f) {
+		perror(filename);
+		exit(1);
+	}
+	fseek(f, 0, SEEK_END);
+	long size = ftell(f);
+	fseek(f, 0, SEEK_SET);
+	char *data = malloc(size + 1);
+	if (fread(data, 1, size, f) != (size_t)size) {
+		perror(filename);
+		exit(1);
+	}
+	data[size] = '\0';
+	fclose(f);
+	return data;
+}
+
+// decodes the concatenated string literals starting at p
+static size_t parse_strings(const char *p, unsigned char *out, size_t capacity)
+{
+	size_t n = 0;
+	for (;;) {
+		p += strspn(p, " \t\r\n");
+		if (*p != '"')
+			return n;
+		for (p++; *p != '"'; p++) {
+			unsigned c = (unsigned char)*p;
+			if (c == '\\') {
+				p++;
+				if (*p >= '0' && *p <= '7') {
+					c = 0;
+					for (int i = 0; i < 3 && *p >= '0' && *p <= '7'; i++)
+						c = c * 8 + (*p++ - '0');
+					p--;
+				} else {
+					switch (*p) {
+					case 'n': c = '\n'; break;
+					case 't': c = '\t'; break;
+					case 'r': c = '\r'; break;
+					case 'a': c = '\a'; break;
+					case 'b': c = '\b'; break;
+					case 'f': c = '\f'; break;
+					case 'v': c = '\v'; break;
+					default: c = (unsigned char)*p; break;
+					}
+				}
+			}
+			if (n < capacity)
+				out[n] = c;
+			n++;
+		}
+		p++;
+	}
+}
+
+// parses "static const struct { ... } <name> = { w, h, "..." };"
+static void load_texture(const char *filename, texture_t *texture)
+{
+	char *data = read_file(filename);
+	char *p = strchr(data, '}');
+	if (!p || sscanf(p + 1, " %63[A-Za-z0-9_] = { %u , %u ,", texture->name,
+	                 &texture->width, &texture->height) != 3) {
+		fprintf(stderr, "%s: no texture found\n", filename);
+		exit(1);
+	}
+	p = strchr(strchr(p, '='), '"');
+	size_t size = texture->width * texture->height * 2;
+	unsigned char *bytes = malloc(size);
+	if (!p || parse_strings(p, bytes, size) < size) {
+		fprintf(stderr, "%s: texture data too short\n", filename);
+		exit(1);
+	}
+	texture->data = malloc(size);
+	for (size_t i = 0; i < size / 2; i++) // little endian
+		texture->data[i] = bytes[i * 2] | (bytes[i * 2 + 1] << 8);
+	free(bytes);
+	free(data);
+}
+
+static void unpack_rgb565(unsigned c, unsigned rgb[3])
+{
+	unsigned r = c >> 11, g = (c >> 5) & 63, b = c & 31;
+	rgb[0] = (r << 3) | (r >> 2);
+	rgb[1] = (g << 2) | (g >> 4);
+	rgb[2] = (b << 3) | (b >> 2);
+}
+
+static unsigned pack_rgb565(const unsigned rgb[3])
+{
+	unsigned r = (rgb[0] * 31 + 127) / 255;
+	unsigned g = (rgb[1] * 63 + 127) / 255;
+	unsigned b = (rgb[2] * 31 + 127) / 255;
+	return (r << 11) | (g << 5) | b;
+}
+
+// 2x2 box filter (1xN and Nx1 levels average two texels)
+static unsigned short *downsample(const unsigned short *src, unsigned width, unsigned height)
+{
+	unsigned w = width > 1 ? width / 2 : 1;
+	unsigned h = height > 1 ? height / 2 : 1;
+	unsigned short *dst = malloc(w * h * sizeof(unsigned short));
+	for (unsigned y = 0; y < h; y++) {
+		for (unsigned x = 0; x < w; x++) {
+			unsigned sum[3] = { 0, 0, 0 }, n = 0;
+			for (unsigned sy = y * 2; sy < y * 2 + 2 && sy < height; sy++) {
+				for (unsigned sx = x * 2; sx < x * 2 + 2 && sx < width; sx++) {
+					unsigned rgb[3];
+					unpack_rgb565(src[sy * width + sx], rgb);
+					for (int i = 0; i < 3; i++)
+						sum[i] += rgb[i];
+					n++;
+				}
+			}
+			for (int i = 0; i < 3; i++)
+				sum[i] = (sum[i] + n / 2) / n;
+			dst[y * w + x] = pack_rgb565(sum);
+		}
+	}
+	return dst;
+}
+
+// 4x4 tiles, tiles and texels within them in row-major order
+static unsigned short *tile(const unsigned short *src, unsigned width, unsigned height)
+{
+	unsigned short *dst = malloc(width * height * sizeof(unsigned short));
+	for (unsigned y = 0; y < height; y++)
+		for (unsigned x = 0; x < width; x++)
+			dst[(y / 4) * width * 4 + (x / 4) * 16 + (y % 4) * 4 + x % 4] = src[y * width + x];
+	return dst;
+}
+
+enum { RGB565, RGB565_TILED, P8, P4, BC1 };
+
+static const char *format_names[] = {
+	"R3D_TEXTURE_RGB565", "R3D_TEXTURE_RGB565_TILED",
+	"R3D_TEXTURE_P8", "R3D_TEXTURE_P4", "R3D_TEXTURE_BC1"
+};
+
+static unsigned distance(const unsigned a[3], const unsigned b[3])
+{
+	int dr = (int)a[0] - (int)b[0], dg = (int)a[1] - (int)b[1], db = (int)a[2] - (int)b[2];
+	return dr * dr + dg * dg + db * db;
+}
+
+static int nearest(const unsigned (*colors)[3], int n, const unsigned rgb[3])
+{
+	int best = 0;
+	for (int i = 1; i < n; i++)
+		if (distance(colors[i], rgb) < distance(colors[best], rgb))
+			best = i;
+	return best;
+}
+
+static int channel_compare;
+
+static int compare_channel(const void *a, const void *b)
+{
+	return (int)((const unsigned *)a)[channel_compare] - (int)((const unsigned *)b)[channel_compare];
+}
+
+// median cut on level 0, refined by a few k-means iterations
+static void build_palette(const texture_t *texture, int n, unsigned short *palette)
+{
+	unsigned count = texture->width * texture->height;
+	unsigned (*pixels)[3] = malloc(count * sizeof(*pixels));
+	for (unsigned i = 0; i < count; i++)
+		unpack_rgb565(texture->data[i], pixels[i]);
+
+	unsigned start[256], end[256], colors[256][3];
+	int boxes = 1;
+	start[0] = 0, end[0] = count;
+	while (boxes < n) {
+		int split = -1, channel = 0;
+		unsigned range = 0;
+		for (int i = 0; i < boxes; i++) { // box with the largest channel range
+			for (int c = 0; c < 3; c++) {
+				unsigned lo = 255, hi = 0;
+				for (unsigned j = start[i]; j < end[i]; j++) {
+					lo = pixels[j][c] < lo ? pixels[j][c] : lo;
+					hi = pixels[j][c] > hi ? pixels[j][c] : hi;
+				}
+				if (hi > lo && hi - lo > range)
+					split = i, channel = c, range = hi - lo;
+			}
+		}
+		if (split < 0) // less than n colors
+			break;
+		channel_compare = channel;
+		qsort(pixels[start[split]], end[split] - start[split], sizeof(*pixels), compare_channel);
+		unsigned median = (start[split] + end[split]) / 2;
+		while (median > start[split] + 1 && pixels[median - 1][channel] == pixels[median][channel])
+			median--;
+		start[boxes] = median, end[boxes] = end[split];
+		end[split] = median;
+		boxes++;
+	}
+
+	for (int k = 0; k <= 8; k++) {
+		unsigned long sum[256][3] = { { 0 } }, members[256] = { 0 };
+		for (int i = 0; i < boxes; i++) {
+			for (unsigned j = start[i]; j < end[i]; j++) {
+				int c = k == 0 ? i : nearest((const unsigned (*)[3])colors, boxes, pixels[j]);
+				for (int ch = 0; ch < 3; ch++)
+					sum[c][ch] += pixels[j][ch];
+				members[c]++;
+			}
+		}
+		for (int i = 0; i < boxes; i++)
+			for (int ch = 0; ch < 3 && members[i]; ch++)
+				colors[i][ch] = (sum[i][ch] + members[i] / 2) / members[i];
+	}
+	for (int i = 0; i < n; i++)
+		palette[i] = pack_rgb565(colors[i < boxes ? i : 0]);
+	free(pixels);
+}
+
+// 4 colors of a BC1 block, decoded like the r3d sampler does
+static void bc1_colors(unsigned c0, unsigned c1, unsigned colors[4][3])
+{
+	unsigned e0[3] = { c0 >> 11, (c0 >> 5) & 63, c0 & 31 };
+	unsigned e1[3] = { c1 >> 11, (c1 >> 5) & 63, c1 & 31 };
+	unsigned c[4];
+	c[0] = c0, c[1] = c1;
+	c[2] = ((2 * e0[0] + e1[0]) / 3 << 11) | ((2 * e0[1] + e1[1]) / 3 << 5) | (2 * e0[2] + e1[2]) / 3;
+	c[3] = ((e0[0] + 2 * e1[0]) / 3 << 11) | ((e0[1] + 2 * e1[1]) / 3 << 5) | (e0[2] + 2 * e1[2]) / 3;
+	for (int i = 0; i < 4; i++)
+		unpack_rgb565(c[i], colors[i]);
+}
+
+// endpoints on the principal axis of the block colors
+static void encode_bc1_block(const unsigned rgb[16][3], unsigned char *out)
+{
+	double mean[3] = { 0, 0, 0 }, cov[3][3] = { { 0 } }, axis[3] = { 1, 1, 1 };
+	for (int i = 0; i < 16; i++)
+		for (int c = 0; c < 3; c++)
+			mean[c] += rgb[i][c] / 16.0;
+	for (int i = 0; i < 16; i++)
+		for (int a = 0; a < 3; a++)
+			for (int b = 0; b < 3; b++)
+				cov[a][b] += (rgb[i][a] - mean[a]) * (rgb[i][b] - mean[b]);
+	for (int k = 0; k < 8; k++) { // power iteration
+		double v[3], l = 0;
+		for (int a = 0; a < 3; a++) {
+			v[a] = cov[a][0] * axis[0] + cov[a][1] * axis[1] + cov[a][2] * axis[2];
+			l += v[a] * v[a];
+		}
+		if (l == 0)
+			break;
+		for (int a = 0; a < 3; a++)
+			axis[a] = v[a] / sqrt(l);
+	}
+	double lo = 0, hi = 0;
+	for (int i = 0; i < 16; i++) {
+		double t = 0;
+		for (int c = 0; c < 3; c++)
+			t += (rgb[i][c] - mean[c]) * axis[c];
+		lo = t < lo ? t : lo;
+		hi = t > hi ? t : hi;
+	}
+	unsigned e[2][3];
+	for (int c = 0; c < 3; c++) {
+		double v0 = mean[c] + axis[c] * hi, v1 = mean[c] + axis[c] * lo;
+		e[0][c] = v0 < 0 ? 0 : (v0 > 255 ? 255 : (unsigned)(v0 + 0.5));
+		e[1][c] = v1 < 0 ? 0 : (v1 > 255 ? 255 : (unsigned)(v1 + 0.5));
+	}
+	unsigned c0 = pack_rgb565(e[0]), c1 = pack_rgb565(e[1]);
+	if (c0 < c1) { // c0 > c1: four color block
+		unsigned t = c0;
+		c0 = c1, c1 = t;
+	}
+	unsigned colors[4][3], indices = 0;
+	bc1_colors(c0, c1, colors);
+	for (int i = 0; i < 16; i++)
+		indices |= (unsigned)nearest((const unsigned (*)[3])colors, c0 == c1 ? 1 : 4, rgb[i]) << (i * 2);
+	out[0] = c0 & 255, out[1] = c0 >> 8;
+	out[2] = c1 & 255, out[3] = c1 >> 8;
+	for (int i = 0; i < 4; i++)
+		out[4 + i] = (indices >> (i * 8)) & 255;
+}
+
+// encodes a mip level, returns its size in bytes
+static unsigned encode_level(const unsigned short *texels, unsigned w, unsigned h, int format,
+                             const unsigned short *palette, unsigned char *out)
+{
+	unsigned colors[256][3], rgb[16][3];
+	int n = format == P8 ? 256 : 16;
+	if (format == P8 || format == P4)
+		for (int i = 0; i < n; i++)
+			unpack_rgb565(palette[i], colors[i]);
+
+	switch (format) {
+	case RGB565:
+	case RGB565_TILED: {
+		unsigned short *tiles = format == RGB565_TILED && w >= 4 && h >= 4 ? tile(texels, w, h) : 0;
+		for (unsigned i = 0; i < w * h; i++) {
+			unsigned c = tiles ? tiles[i] : texels[i];
+			out[i * 2] = c & 255, out[i * 2 + 1] = c >> 8;
+		}
+		free(tiles);
+		return w * h * 2;
+	}
+	case P8:
+	case P4:
+		memset(out, 0, w * h);
+		for (unsigned i = 0; i < w * h; i++) {
+			unpack_rgb565(texels[i], rgb[0]);
+			unsigned index = nearest((const unsigned (*)[3])colors, n, rgb[0]);
+			if (format == P8)
+				out[i] = index;
+			else
+				out[i / 2] |= index << ((i & 1) * 4); // low nibble first
+		}
+		return format == P8 ? w * h : (w * h + 1) / 2;
+	default: // BC1: 4x4 blocks in row-major order
+		for (unsigned by = 0; by < h / 4; by++) {
+			for (unsigned bx = 0; bx < w / 4; bx++) {
+				for (int i = 0; i < 16; i++)
+					unpack_rgb565(texels[(by * 4 + i / 4) * w + bx * 4 + i % 4], rgb[i]);
+				encode_bc1_block((const unsigned (*)[3])rgb, out + (by * (w / 4) + bx) * 8);
+			}
+		}
+		return w * h / 2;
+	}
+}
+
+static void write_bytes(const unsigned char *data, unsigned count, unsigned *column)
+{
+	for (unsigned i = 0; i < count; i++) {
+		if (*column == 0)
+			printf("  \"");
+		printf("\\%o", data[i]);
+		if (++*column == 18) {
+			printf("\"\n");
+			*column = 0;
+		}
+	}
+}
+
+static void write_mips(const texture_t *texture, int format)
+{
+	unsigned min = format == BC1 ? 4 : 1; // BC1 levels consist of whole blocks
+	if (texture->width < min || texture->height < min) {
+		fprintf(stderr, "%s: texture too small\n", texture->name);
+		exit(1);
+	}
+	unsigned levels = 1;
+	for (unsigned w = texture->width, h = texture->height; (w > 1 || h > 1) && w / 2 >= min && h / 2 >= min; levels++) {
+		w = w > 1 ? w / 2 : 1;
+		h = h > 1 ? h / 2 : 1;
+	}
+
+	printf("static const struct { uint16_t w, h, levels, format; uint8_t d[]; } %s_mips =\n",
+	       texture->name);
+	printf("{\n  %u, %u, %u, %s,\n", texture->width, texture->height, levels, format_names[format]);
+
+	unsigned column = 0, size = 0;
+	unsigned char *bytes = malloc(texture->width * texture->height * 2 + 512);
+	unsigned short palette[256];
+	if (format == P8 || format == P4) { // shared by all levels, before the first level
+		int n = format == P8 ? 256 : 16;
+		build_palette(texture, n, palette);
+		for (int i = 0; i < n; i++)
+			bytes[i * 2] = palette[i] & 255, bytes[i * 2 + 1] = palette[i] >> 8;
+		write_bytes(bytes, n * 2, &column);
+		size += n * 2;
+	}
+
+	unsigned w = texture->width, h = texture->height;
+	unsigned short *level = texture->data;
+	for (unsigned i = 0; i < levels; i++) {
+		unsigned n = encode_level(level, w, h, format, palette, bytes);
+		write_bytes(bytes, n, &column);
+		size += n;
+		if (i + 1 < levels) {
+			unsigned short *next = downsample(level, w, h);
+			if (level != texture->data)
+				free(level);
+			level = next;
+			w = w > 1 ? w / 2 : 1;
+			h = h > 1 ? h / 2 : 1;
+		}
+	}
+	if (level != texture->data)
+		free(level);
+	free(bytes);
+	if (column)
+		printf("\"\n");
+	printf("};\n");
+	fprintf(stderr, "%s: %u levels, %u bytes\n", texture->name, levels, size);
+}
+
+static void usage(void)
+{
+	fprintf(stderr, "usage: texconv mips|tiled|p8|p4|bc1 texture.h > out.h\n");
+	exit(1);
+}
+
+int main(int argc, char **argv)
+{
+	texture_t texture;
+	if (argc != 3)
+		usage();
+	load_texture(argv[2], &texture);
+	if (!strcmp(argv[1], "mips"))
+		write_mips(&texture, RGB565);
+	else if (!strcmp(argv[1], "tiled"))
+		write_mips(&texture, RGB565_TILED);
+	else if (!strcmp(argv[1], "p8"))
+		write_mips(&texture, P8);
+	else if (!strcmp(argv[1], "p4"))
+		write_mips(&texture, P4);
+	else if (!strcmp(argv[1], "bc1"))
+		write_mips(&texture, BC1);
+	else
+		usage();
+	free(texture.data);
+	return 0;
+}